@@ -5,7 +5,7 @@
 '  o fun-01 initAlnMatrixST:
 '    - Sets all variables in matrixST to 0
 '  o fun-02 freeAlnMatrixST
-'    - Sets all variables in matrixST to 0
+'    - Frees matrixST and all of its variables
 \~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~*/
 
 /*--------------------------------------------------------\
@@ -39,13 +39,11 @@ void initAlnMatrixST(
 void freeAlnMatrixST(
   struct alnMatrixStruct *matrixST /*Struct to free*/
 ){ /*~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~\
-   ' Fun-0w TOC: Sec-01: freeAlnMatrixST
-   '  - Sets all variables in matrixST to 0
+   ' Fun-02 TOC: Sec-01: freeAlnMatrixST
+   '  - Frees matrixST and all of its variables
    \~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~*/
 
-   struct scoresStruct *scoreST = 0;
-
-   freeScoresST(&matrixST->bestScoreST, 0)
+   if(matrixST == 0) return;
 
    if(matrixST->dirMatrixST != 0)
    { /*If freeing the matrix*/
@@ -57,33 +55,10 @@ void freeAlnMatrixST(
      #endif
    } /*If freeing the matrix*/
 
-   if(matrixST->refBasesST != 0)
-   { /*if I need to free the reference scores*/
-     scoreST = matrixST->refBasesST;
-
-     for(
-       unsigned long ulScore = 0;
-       ulScore < matrixST->lenRefScoresUL;
-       ++ulScore
-     ){ /*for loop free all scores structs*/
-       freeScoresST(scoreST, 0); /*0 for not on stack*/
-       ++scoreST;
-     } /*for loop free all scores structs*/
-   } /*if I need to free the reference scores*/
-
-   if(matrixST->qryBasesST != 0)
-   { /*if I need to free the query scores*/
-     scoreST = matrixST->qryBasesST;
-
-     for(
-       unsigned long ulScore = 0;
-       ulScore < matrixST->lenQueryScoresUL;
-       ++ulScore
-     ){ /*for loop free all scores structs*/
-       freeScoresST(scoreST, 0); /*0 for not on stack*/
-       ++scoreST;
-     } /*for loop free all scores structs*/
-   } /*if I need to free the query scores*/
+   /*The scores for each base are one array (calloc)*/
+   if(matrixST->refBasesST != 0) free(matrixST->refBasesST);
+   if(matrixST->qryBasesST != 0) free(matrixST->qryBasesST);
 
+   free(matrixST); /*Always made with calloc*/
    return;
 } /*freeAlnMatrixST*/
@@ -19,7 +19,7 @@
 '  o fun-01 initAlnMatrixST:
 '    - Sets all variables in matrixST to 0
 '  o fun-02 freeAlnMatrixST
-'    - Sets all variables in matrixST to 0
+'    - Frees matrixST and all of its variables
 \~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~*/
 
 #ifndef ALNMATRIXSTRUCT_H
@@ -66,12 +66,15 @@ void initAlnMatrixST(
 | Output:
 |  - Modifies
 |    o Frees alnMatrix and all of its held variables
+|  - Note:
+|    o matrixST must be on the heap. Set your pointer to 0
+|      after calling this.
 \--------------------------------------------------------*/
 void freeAlnMatrixST(
   struct alnMatrixStruct *matrixST /*Struct to free*/
 ); /*~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~\
    ' Fun-02 TOC: Sec-01: freeAlnMatrixST
-   '  - Sets all variables in matrixST to 0
+   '  - Frees matrixST and all of its variables
    \~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~*/
 
 #endif
@@ -4,10 +4,13 @@
 #  - Runs a Needlman Wunsch or Smith Waterman alignment on
 #    a pair of fasta files
 # Includes:
-#  - "hirschberg.h"
-#  - "needleman.h"
-#  - "memWater.h"
+#  - "alnSeqBatch.h"
+#  - "refIndex.h"
+#  o "hirschberg.h"
+#  o "needleman.h"
+#  o "memWater.h"
 #  o "waterman.h"
+#  o "stripedAln.h"
 #  o "generalAlnFun.h"
 #  o "alnStruct.h"
 #  o "alnMatrixStruct.h"
@@ -24,9 +27,8 @@
 #  o <stdint.h>
 #########################################################*/
 
-#include "hirschberg.h"
-#include "needleman.h"
-#include "memWater.h"
+#include "alnSeqBatch.h"
+#include "refIndex.h"
 
 /*~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~\
 ' SOP: Start Of Program
@@ -51,6 +53,7 @@ char * checkInput(
     char **queryFileCStr,   // File name of the query file
     char **outFileCStr,     // Name of the output file
     char **scoreMtrxFileStr, /*Holds scoring matrix file*/
+    char **indexOutStr,     /*File to write ref index to*/
     struct alnSet *settings // Aligment settings
 ); /*~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~\
    ' Fun-01 TOC: checkInput
@@ -121,14 +124,9 @@ int main(
    '  o main sec-03:
    '    - read in the reference sequence
    '  o main sec-04:
-   '    - read in the query sequence
+   '    - Open the query file
    '  o main sec-05:
-   '    - Do the alingment
-   '  o main sec-06:
-   '    - Print out multi-alignments or find the single
-   '      alignment array
-   '  o main sec-07:
-   '    - Print out the alignment
+   '    - Align the queries and print the alignments
    \~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~*/
 
    /*>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>\
@@ -142,25 +140,20 @@ int main(
    char *outFileCStr = 0;
    char *inputCStr = 0;
    char *scoreMtrxFileStr = 0;
+   char *indexOutStr = 0;  /*-write-index file*/
 
    // Holds the reference sequence
    struct seqStruct refST;
-   struct seqStruct queryST;
+   struct refIndex indexST; /*Mapped reference (-ref)*/
 
    // Caputures error type from functions
    unsigned char errUC = 0;
-   long bestScoreL = 0;  // Allows me to free score matrix
 
    // For holding settings
    struct alnSet settings;
 
-   // For holding alignment output
-   struct alnMatrixStruct *alnMtrxST = 0;
-   struct alnStruct *alnST = 0;
-   struct scoresStruct *bestScoreST = 0; /*For memWater*/
-
    FILE *faFILE = 0;
-   FILE *outFILE = 0; /*Print alternative aligments to*/
+   FILE *outFILE = 0; /*Print alignments to*/
 
    /*>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>\
    ^ Main Sec-2:
@@ -177,6 +170,7 @@ int main(
            &queryFileCStr,
            &outFileCStr,
            &scoreMtrxFileStr,
+           &indexOutStr,
            &settings
    ); // Get the user input
 
@@ -266,9 +260,6 @@ int main(
 
             exit(-1);
         } /*If an invalid output file*/
-
-        fclose(outFILE);
-        outFILE = 0;
    } /*If printing output to a file*/
 
    /*>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>\
@@ -276,6 +267,42 @@ int main(
    ^  - read in the reference sequence
    \<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<*/
 
+   /*An index (-write-index) is mapped instead of read*/
+   initSeqST(&refST);
+   errUC = mapRefIndex(refFileCStr, &indexST);
+
+   if(errUC == 0)
+   { /*If the reference is an index*/
+      refST = indexST.refST;
+      goto writeIndex;
+   } /*If the reference is an index*/
+
+   if(errUC == 2)
+   { /*If the index was made by another alnSeq build*/
+      fprintf(
+        stderr,
+        "Reference (-ref %s) index is from a different\n",
+        refFileCStr
+      );
+      fprintf(
+        stderr,
+        "  alnSeq version or build; remake it with"
+      );
+      fprintf(stderr, " -write-index\n");
+      exit(-1);
+   } /*If the index was made by another alnSeq build*/
+
+   if(errUC == 4)
+   { /*If the index could not be used*/
+      fprintf(
+        stderr,
+        "Reference (-ref %s) index is cut short or\n",
+        refFileCStr
+      );
+      fprintf(stderr, "  could not be mapped\n");
+      exit(-1);
+   } /*If the index could not be used*/
+
    faFILE = fopen(refFileCStr, "r");
 
    if(faFILE == 0) 
@@ -290,7 +317,6 @@ int main(
    } // If reference file could not be opened
 
    // Read in the reference sequence
-   initSeqST(&refST);
    errUC = readFaSeq(faFILE, &refST);
    fclose(faFILE);
    faFILE = 0;
@@ -315,254 +341,49 @@ int main(
        exit(-1);
    } // Invalid fasta file
 
-   /*>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>\
-   ^ Main Sec-04:
-   ^  - read in the query sequence
-   \<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<*/
-
-   faFILE = fopen(queryFileCStr, "r");
-
-   if(faFILE == 0) 
-   { // If reference file could not be opened
-       freeSeqST(&refST, 0); // 0 to makr on the stack
-
-       fprintf(
-         stderr,
-         "Query (-query %s) could not be opend\n",
-         queryFileCStr
-       );
+   writeIndex:
 
-       exit(-1);
-   } // If reference file could not be opened
+   if(indexOutStr != 0)
+   { /*If only writing the reference index*/
+      faFILE = fopen(indexOutStr, "w");
+      errUC = 2;
 
+      if(faFILE != 0)
+      { /*If the index file was opened*/
+         errUC = writeRefIndex(&refST, faFILE);
+         if(fclose(faFILE)) errUC = 2;
+         faFILE = 0;
+      } /*If the index file was opened*/
 
-   // Read in the query sequence
-   initSeqST(&queryST);
-   errUC = readFaSeq(faFILE, &queryST);
-   fclose(faFILE);
-   faFILE = 0;
+      freeRefST(&refST, &indexST);
 
-   if(errUC & 2)
-   { // Invalid fasta file
-       freeSeqST(&refST, 0); // 0 to makr on the stack
-       freeSeqST(&queryST, 0); // 0 to makr on the stack
+      if(outFILE != 0) fclose(outFILE);
 
-       fprintf(
-         stderr,
-         "Query (-query %s) is not valid\n",
-         refFileCStr
-       );
-       exit(-1);
-   } // Invalid fasta file
+      if(errUC)
+      { /*If the index could not be written*/
+         fprintf(
+           stderr,
+           "Could not write index (-write-index %s)\n",
+           indexOutStr
+         );
+         exit(-1);
+      } /*If the index could not be written*/
 
-   if(errUC & 64)
-   { // Invalid fasta file
-      freeSeqST(&refST, 0); // 0 to makr on the stack
-      freeSeqST(&queryST, 0); // 0 to makr on the stack
-      fprintf(stderr, "Memory allocation error\n");
-      exit(-1);
-   } // Invalid fasta file
+      exit(0);
+   } /*If only writing the reference index*/
 
    /*>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>\
-   ^ Main Sec-05:
-   ^  - Do the alingment
-   ^  o main sec-05 sub-01:
-   ^    - Set up for the alignment
-   ^  o main sec-05 sub-02:
-   ^    - Check if doing a Needleman alignment
-   ^  o main sec-05 sub-02:
-   ^    - Check if doing an Waterman alignment
-   ^  o main sec-05 sub-04:
-   ^    - Check if doing an memory efficent Waterman
-   ^      alignment that prints out alternative alignment
-   ^      positions (Gets combined with a Hirschberg)
-   ^  o main sec-05 sub-05:
-   ^    - Check if doing an memory efficent Waterman
-   ^      alignment that prints out a single alignment
-   ^      (uses a Hirschberg to get the alignment)
-   ^  o main sec-05 sub-06:
-   ^    - Check if doing an Hirschberg alignment
-   ^  o main sec-05 sub-07:
-   ^    - Let user know this was an invalid alignment
-   ^  o main sec-05 sub-08:
-   ^    - Check if the alignment failed
+   ^ Main Sec-04:
+   ^  - Open the query file
    \<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<*/
 
-   /******************************************************\
-   * Main Sec-05 Sub-01:
-   *  - Set up for the alignment
-   \******************************************************/
-
-   /*Right know these are hardoced in, but at some piont
-   `  it might be nice to allow the user the manipulate.
-   */
-
-   if(outFileCStr == 0) outFILE = stdout;
-   else outFILE = fopen(outFileCStr, "w");
-
-   seqToLookupIndex(&refST);
-   seqToLookupIndex(&queryST);
-
-   queryST.endAlnUL = queryST.lenSeqUL - 1;
-   queryST.offsetUL = 0;
-
-   refST.endAlnUL = refST.lenSeqUL - 1;
-   refST.offsetUL = 0;
-
-   /******************************************************\
-   * Main Sec-05 Sub-02:
-   *  - Check if doing an Needleman alignment
-   \******************************************************/
-
-   if(settings.useNeedleBl != 0)
-     alnMtrxST = NeedlemanAln(&queryST, &refST, &settings);
-
-   /******************************************************\
-   * Main Sec-05 Sub-03:
-   *  - Check if doing an Waterman alignment
-   \******************************************************/
-
-   else if(settings.useWaterBl != 0)
-   { /*else if doing a waterman alignment*/
-     if(settings.refQueryScanBl)
-     { /*IF keeping some alternative alignments*/
-       alnMtrxST=WatermanAltAln(&queryST,&refST,&settings);
-
-       if(alnMtrxST == 0) goto alignmentFailed;
-
-       printAltWaterAlns(
-          alnMtrxST,
-          settings.minScoreL,
-          outFILE /*Prefix to name files*/
-       ); /*Print out alternative alignment positions*/
-     } /*IF keeping some alternative alignments*/
-
-     else alnMtrxST=WatermanAln(&queryST,&refST,&settings);
-   } /*else if doing a waterman alignment*/
-
-   /******************************************************\
-   * Main Sec-05 Sub-04:
-   *  - Check if doing an memory efficent Waterman
-   *    alignment that prints out alternative alignment
-   *    positions (Gets combined with a Hirschberg)
-   \******************************************************/
-
-   else if(settings.memWaterBl != 0)
-   { /*Else if; doing a memory waterman alignment*/
-      if(settings.refQueryScanBl)
-      { /*If doing an query-ref scan*/
-         alnMtrxST =
-            memWaterAltAln(&queryST, &refST, &settings);
-
-         if(alnMtrxST == 0) goto alignmentFailed;
-
-         if(settings.justScoresBl) goto printAlts;
-
-         refST.offsetUL =
-            alnMtrxST->bestScoreST.refStartUL;
-         queryST.offsetUL =
-            alnMtrxST->bestScoreST.qryStartUL;
-
-         refST.endAlnUL = alnMtrxST->bestScoreST.refEndUL;
-         queryST.endAlnUL =alnMtrxST->bestScoreST.qryEndUL;
-
-         alnST = Hirschberg(&refST, &queryST, &settings);
-
-         if(alnST == 0)
-         { /*If the hirschberg alignment failed*/
-            freeAlnMatrixST(alnMtrxST);
-            alnMtrxST = 0;
-            goto alignmentFailed;
-         } /*If the hirschberg alignment failed*/
-
-         printAlts:
-
-         printAltWaterAlns(
-            alnMtrxST,
-            settings.minScoreL,
-            outFILE /*Prefix to name files*/
-         ); /*Print out alternative alignment positions*/
-
-         if(settings.justScoresBl) goto noAlnOutFree;
-
-         bestScoreL = alnMtrxST->bestScoreST.scoreL;
-         freeAlnMatrixST(alnMtrxST); /*No longer need*/
-         alnMtrxST = 0;
-
-         goto noDirMatrix;
-      } /*If doing an query-ref scan*/
-
-      /***************************************************\
-      * Main Sec-05 Sub-05:
-      *  - Check if doing an memory efficent Waterman
-      *    alignment that prints out a single alignment
-      *    (uses a Hirschberg to get the alignment)
-      \***************************************************/
-
-      else
-      { /*Else I am just finding the best alignment*/
-         bestScoreST =
-            memWaterAln(&queryST,&refST,&settings);
-
-         if(bestScoreST == 0) goto alignmentFailed;
-
-         if(settings.justScoresBl)
-         { /*If I am just printing out coordinates*/
-            fprintf(
-               outFILE,
-               "%li\t%lu\t%lu\t%lu\t%lu\n",
-               bestScoreST->scoreL,
-               bestScoreST->refStartUL,
-               bestScoreST->qryStartUL,
-               bestScoreST->refEndUL,
-               bestScoreST->qryEndUL
-            );
-
-            goto noAlnOutFree;
-         } /*If I am just printing out coordinates*/
-
-         refST.offsetUL = bestScoreST->refStartUL;
-         queryST.offsetUL = bestScoreST->qryStartUL;
-         refST.endAlnUL = bestScoreST->refEndUL;
-         queryST.endAlnUL = bestScoreST->qryEndUL;
-
-         alnST = Hirschberg(&refST, &queryST, &settings);
-
-         /*Free the current uneeded variables*/
-         bestScoreL = bestScoreST->scoreL;
-         freeScoresST(bestScoreST, 0);
-         bestScoreST = 0;
-
-         if(alnST == 0) goto alignmentFailed;
-         else goto noDirMatrix;
-      } /*Else I am just finding the best alignment*/
-   } /*Else if; doing a memory waterman alignment*/
-
-   /******************************************************\
-   * Main Sec-05 Sub-06:
-   *  - Check if doing an Hirschberg alignment
-   \******************************************************/
-
-   else if(settings.useHirschBl != 0)
-   { /*Else if doing an Hirschberg alignment*/
-     alnST = Hirschberg(&refST, &queryST, &settings);
-     if(alnST == 0) goto alignmentFailed;
-     goto noDirMatrix;
-
-     /* The Hirschberg returns an alignment structure,
-     `  instead of an directional matrix.
-     */
-   } /*Else if doing an Hirschberg alignment*/
-
-   /******************************************************\
-   * Main Sec-05 Sub-07:
-   *  - Let user know this was an invalid alignment
-   \******************************************************/
-
-   else
-   { /*If no aignment was requested*/
-      freeSeqST(&refST, 0);   /*0 to mark on the stack*/
-      freeSeqST(&queryST, 0); /*0 to mark on the stack*/
+   if(
+         !settings.useNeedleBl
+      && !settings.useWaterBl
+      && !settings.memWaterBl
+      && !settings.useHirschBl
+   ){ /*If no aignment was requested*/
+      freeRefST(&refST, &indexST);
 
       printHelpMesg(stderr, 1); /*short help*/
       fprintf(
@@ -573,104 +394,74 @@ int main(
       exit(-1);
    } /*If no aignment was requested*/
 
-   /******************************************************\
-   * Main Sec-05 Sub-08:
-   *  - Check if the alignment failed
-   \******************************************************/
-
-   if(alnMtrxST == 0)
-   { /*If did not have enough memory*/
-      alignmentFailed:
+   faFILE = fopen(queryFileCStr, "r");
 
-      freeSeqST(&refST, 0); // 0 to makr on the stack
-      freeSeqST(&queryST, 0); // 0 to makr on the stack
+   if(faFILE == 0) 
+   { // If reference file could not be opened
+       freeRefST(&refST, &indexST);
 
        fprintf(
          stderr,
-         "Memory allocation error in aligment step\n"
+         "Query (-query %s) could not be opend\n",
+         queryFileCStr
        );
+
        exit(-1);
-   } /*If did not have enough memory*/
+   } // If reference file could not be opened
 
    /*>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>\
-   ^ Main Sec-06:
-   ^  - Print out multi-alignments or find the single
-   ^    alignment array
+   ^ Main Sec-05:
+   ^  - Align the queries and print the alignments
    \<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<*/
 
-   if(outFileCStr != 0) outFILE = fopen(outFileCStr, "w");
-
-   else
+   if(outFileCStr == 0)
    { /*Else putting output to stdout*/
      outFILE = stdout;
      outFileCStr = "out";
    } /*Else putting output to stdout*/
 
-   alnST =
-      dirMatrixToAlnST(
+   errUC =
+      alnBatch(
          &refST,
-         &queryST,
-         &alnMtrxST->bestScoreST,
-         alnMtrxST->dirMatrixST
-   );
-   bestScoreL = alnMtrxST->bestScoreST.scoreL;
-   freeAlnMatrixST(alnMtrxST); // No longer need
-   alnMtrxST = 0;
+         indexST.mapStr != 0 ? &indexST.printST : 0,
+         faFILE,
+         &settings,
+         outFILE,
+         outFileCStr,
+         scoreMtrxFileStr /*File name for scoring matrix*/
+      ); /*Align each query to the reference*/
 
-   if(alnST == 0)
-   { // IF i falied to make an alignment array
-      freeSeqST(&refST, 0); // 0 to makr on the stack
-      freeSeqST(&queryST, 0); // 0 to makr on the stack
+   fclose(faFILE);
+   faFILE = 0;
+
+   if(outFILE != stdout) fclose(outFILE);
+   freeRefST(&refST, &indexST);
 
+   if(errUC == 2)
+   { // Invalid fasta file
        fprintf(
          stderr,
-         "Memory error when making alignment array\n"
+         "Query (-query %s) is not valid\n",
+         queryFileCStr
        );
-
        exit(-1);
-   } // IF i falied to make an alignment array
-
-   /*>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>\
-   ^ Main Sec-07:
-   ^  - Print out the alignment
-   \<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<*/
-
-   noDirMatrix: /*For aligners that return an alnStruct*/
+   } // Invalid fasta file
 
-   lookupIndexToSeq(&refST);
-   lookupIndexToSeq(&queryST);
+   if(errUC == 64)
+   { /*If did not have enough memory*/
+       fprintf(
+         stderr,
+         "Memory allocation error in aligment step\n"
+       );
+       exit(-1);
+   } /*If did not have enough memory*/
 
-   if(
-      printAln(
-         outFILE,
-         outFileCStr,
-         &refST,
-         &queryST,
-         alnST,
-         bestScoreL,
-         &settings,
-         scoreMtrxFileStr /*File name for scoring matrix*/
-      )
-   ){ /*If could not print out the alignmnet*/
+   if(errUC)
+   { /*If could not print out the alignmnet*/
       fprintf(stderr, "Failed to print alignment\n");
-
-      fclose(outFILE);
-      freeAlnST(alnST, 1); /*NEED TO SET UP*/
-
-      freeSeqST(&refST, 0);   /*0 to specify on stack*/
-      freeSeqST(&queryST, 0); /* 0 to do a stack free*/
-
       exit(1);
    } /*If could not print out the alignmnet*/
 
-   freeAlnST(alnST, 1);
-
-   noAlnOutFree: /*When memWater just printing positions*/
-
-   fclose(outFILE);
-   freeSeqST(&refST, 0);   /*0 to specify on stack*/
-   freeSeqST(&queryST, 0); /* 0 to do a stack free*/
-
    exit(0);
 } /*main*/
 
@@ -690,6 +481,7 @@ char * checkInput(
     char **queryFileCStr,   /*File name of the query file*/
     char **outFileCStr,     /*Name of the output file*/
     char **scoreMtrxFileStr,/*Holds scoring matrix file*/
+    char **indexOutStr,     /*File to write ref index to*/
     struct alnSet *settings /*Aligment settings*/
 ){ /*~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~\
    ' Fun-01 TOC: checkInput
@@ -727,6 +519,9 @@ char * checkInput(
         else if(strcmp(tmpCStr, "-out") == 0)
             *outFileCStr = singleArgCStr;
 
+        else if(strcmp(tmpCStr, "-write-index") == 0)
+            *indexOutStr = singleArgCStr;
+
         #if !defined NOGAPOPEN
            else if(strcmp(tmpCStr, "-gapopen") == 0)
                settings->gapOpenI =
@@ -771,6 +566,7 @@ char * checkInput(
             settings->useWaterBl = 0;
             settings->useHirschBl = 0;
             settings->memWaterBl = 0;
+            settings->diffAlnBl = 0;
             --intArg;
         } /*Else if using a needleman alignment*/
 
@@ -780,6 +576,7 @@ char * checkInput(
             settings->useWaterBl = 1;
             settings->useHirschBl = 0;
             settings->memWaterBl = 0;
+            settings->diffAlnBl = 0;
             --intArg;
         } /*Else if doing a waterman smith alignment*/
 
@@ -789,6 +586,7 @@ char * checkInput(
             settings->useWaterBl = 0;
             settings->useHirschBl = 1;
             settings->memWaterBl = 0;
+            settings->diffAlnBl = 0;
             --intArg;
         } /*Else if doing a Hirshberg alignment*/
 
@@ -798,14 +596,32 @@ char * checkInput(
             settings->useWaterBl = 0;
             settings->useHirschBl = 0;
             settings->memWaterBl = 1;
+            settings->diffAlnBl = 0;
             --intArg;
         } /*Else if I am doing a memory effecient water*/
 
+        else if(strcmp(tmpCStr, "-use-diff") == 0)
+        { /*Else if scoring with the difference kernel*/
+            settings->useNeedleBl = 1;
+            settings->useWaterBl = 0;
+            settings->useHirschBl = 0;
+            settings->memWaterBl = 0;
+            settings->diffAlnBl = 1;
+            settings->justScoresBl = 1;
+            --intArg;
+        } /*Else if scoring with the difference kernel*/
+
         else if(strcmp(tmpCStr, "-only-scores") == 0)
-        { /*Else if only printing scores for memWater*/
+        { /*Else if only printing scores*/
            settings->justScoresBl = 1;
            --intArg;
-        } /*Else if only printing scores for memWater*/
+        } /*Else if only printing scores*/
+
+        else if(strcmp(tmpCStr, "-batch") == 0)
+        { /*Else if aligning every query in the file*/
+           settings->batchBl = 1;
+           --intArg;
+        } /*Else if aligning every query in the file*/
 
         else if(strcmp(tmpCStr, "-scores-and-aln") == 0)
         { /*Else if only printing alignments for memWater*/
@@ -813,6 +629,36 @@ char * checkInput(
            --intArg;
         } /*Else if only printing alignments for memWater*/
 
+        else if(strcmp(tmpCStr, "-vect-auto") == 0)
+        { /*Else if using the best vectors the cpu has*/
+           settings->vectTypeC = defVectAuto;
+           --intArg;
+        } /*Else if using the best vectors the cpu has*/
+
+        else if(strcmp(tmpCStr, "-no-vect") == 0)
+        { /*Else if not using vectors*/
+           settings->vectTypeC = defVectScalar;
+           --intArg;
+        } /*Else if not using vectors*/
+
+        else if(strcmp(tmpCStr, "-vect-sse2") == 0)
+        { /*Else if using at most SSE2 vectors*/
+           settings->vectTypeC = defVectSSE2;
+           --intArg;
+        } /*Else if using at most SSE2 vectors*/
+
+        else if(strcmp(tmpCStr, "-vect-avx2") == 0)
+        { /*Else if using at most AVX2 vectors*/
+           settings->vectTypeC = defVectAVX2;
+           --intArg;
+        } /*Else if using at most AVX2 vectors*/
+
+        else if(strcmp(tmpCStr, "-vect-avx512") == 0)
+        { /*Else if using at most AVX512 vectors*/
+           settings->vectTypeC = defVectAVX512;
+           --intArg;
+        } /*Else if using at most AVX512 vectors*/
+
         else if(strcmp(tmpCStr, "-format-expand-cig") == 0)
         { /*Else if using the expanded cigar format*/
            settings->formatFlag = defExpandCig;
@@ -855,6 +701,36 @@ char * checkInput(
           settings->minScoreL =
              strtol(singleArgCStr, &dummyStr, 10);
 
+        else if(strcmp(tmpCStr, "-alt-top") == 0)
+        { /*Else if only keeping the best alternatives*/
+          if(*singleArgCStr == '-') return tmpCStr;
+
+          settings->altTopUL =
+             strtoul(singleArgCStr, &dummyStr, 10);
+        } /*Else if only keeping the best alternatives*/
+
+        else if(strcmp(tmpCStr, "-band") == 0)
+        { /*Else if setting the band size*/
+          if(*singleArgCStr == '-') return tmpCStr;
+
+          settings->bandUL =
+             strtoul(singleArgCStr, &dummyStr, 10);
+        } /*Else if setting the band size*/
+
+        else if(strcmp(tmpCStr, "-adapt-band") == 0)
+        { /*Else if widening the band when at the edge*/
+           settings->adaptBandBl = 1;
+           --intArg;
+        } /*Else if widening the band when at the edge*/
+
+        else if(strcmp(tmpCStr, "-threads") == 0)
+        { /*Else if setting the number of threads*/
+          settings->threadsI =
+             strtol(singleArgCStr, &dummyStr, 10);
+
+          if(settings->threadsI < 1) return tmpCStr;
+        } /*Else if setting the number of threads*/
+
         /*Only do these checks when the user has not
         ` called a direction flag during compile time
         */
@@ -1014,6 +890,29 @@ void printHelpMesg(
       outFILE,
       "    o Fasta file with reference sequence.\n"
    );
+   fprintf(
+      outFILE,
+      "    o Can also be an index made with -write-index.\n"
+   );
+
+   fprintf(outFILE, "  -write-index: [None]\n");
+   fprintf(
+      outFILE,
+      "    o Write -ref as a pre-converted index to this\n"
+   );
+   fprintf(outFILE, "      file and quit (-query not needed).\n");
+   fprintf(
+      outFILE,
+      "    o The index is memory mapped when used as -ref,\n"
+   );
+   fprintf(
+      outFILE,
+      "      so runs that share it skip reading the fasta\n"
+   );
+   fprintf(
+      outFILE,
+      "      file and share one copy in memory.\n"
+   );
 
    fprintf(outFILE, "  -out: [stdout]\n");
    fprintf(outFILE,"    o File to output alignment to.\n");
@@ -1071,6 +970,28 @@ void printHelpMesg(
      "positions and a Hirschberg to find the alignment.\n"
    );
 
+   if(defUseDiff)
+       fprintf(outFILE, "  -use-diff: [Yes]\n");
+   else fprintf(outFILE, "  -use-diff: [No]\n");
+
+   fprintf(
+      outFILE,
+      "    o Find the Needleman score with the 8 bit"
+   );
+   fprintf(outFILE, " difference\n      recurrence");
+   fprintf(outFILE, " (Suzuki-Kasahara) kernel.\n");
+   fprintf(
+      outFILE,
+      "    o Only prints the scores (-only-scores). Uses"
+   );
+   fprintf(outFILE, " the\n      striped Needleman if the");
+   fprintf(outFILE, " scores do not fit in 8 bits.\n");
+   fprintf(
+      outFILE,
+      "    o Same score as -no-vect. Uses vectors even with"
+   );
+   fprintf(outFILE, "\n      -no-vect.\n");
+
    /******************************************************\
    * Fun-03 Sec-02 Sub-03:
    *  - Alignment paramaters block
@@ -1132,14 +1053,130 @@ void printHelpMesg(
    fprintf(outFILE, " ending\n");
    fprintf(
       outFILE,
-      "      coordinates of an alingnment (mem-water only)"
+      "      coordinates of an alingnment (needle, water,"
    );
-   fprintf(outFILE, "\n");
+   fprintf(outFILE, "\n      and mem-water)\n");
    fprintf(
       outFILE,
       "    o Disable this setting with -scores-and-aln\n"
    );
 
+   if(defBatchBl)
+      fprintf(outFILE,"  -batch: [Yes]\n");
+   else
+      fprintf(outFILE,"  -batch: [No]\n");
+
+   fprintf(
+      outFILE,
+      "    o Align every sequence in the -query fasta or"
+   );
+   fprintf(outFILE, " fastq\n      file to the reference.\n");
+   fprintf(
+      outFILE,
+      "    o The reference is only read in and set up"
+   );
+   fprintf(outFILE, " once.\n");
+   fprintf(
+      outFILE,
+      "    o The query id is printed before each line of"
+   );
+   fprintf(outFILE, "\n      -only-scores output.\n");
+
+   fprintf(outFILE, "  -threads: [%i]\n", defThreads);
+   fprintf(
+      outFILE,
+      "    o Number of threads to align -batch queries"
+   );
+   fprintf(outFILE, " with.\n");
+   fprintf(
+      outFILE,
+      "    o Output is in the same order as the query"
+   );
+   fprintf(outFILE, " file.\n");
+   fprintf(
+      outFILE,
+      "    o Without -batch, splits a -use-hirschberg"
+   );
+   fprintf(outFILE, " alignment\n");
+   fprintf(
+      outFILE,
+      "      into sub-problems that are aligned on"
+   );
+   fprintf(outFILE, " separate threads.\n");
+
+   fprintf(outFILE, "  -band: [%i]\n", defBand);
+   fprintf(
+      outFILE,
+      "    o Only score the cells within this many bases of"
+   );
+   fprintf(outFILE, " the\n      diagonal (needle and water).\n");
+   fprintf(
+      outFILE,
+      "    o Uses much less memory and time for sequences"
+   );
+   fprintf(outFILE, " that are\n      nearly the same.\n");
+   fprintf(outFILE, "    o 0 does not band the alignment.\n");
+
+   if(defAdaptBandBl)
+      fprintf(outFILE,"  -adapt-band: [Yes]\n");
+   else
+      fprintf(outFILE,"  -adapt-band: [No]\n");
+
+   fprintf(
+      outFILE,
+      "    o Redo a banded alignment with double the band"
+   );
+   fprintf(outFILE, " size\n      till the alignment is off");
+   fprintf(outFILE, " the band edge and the\n      score");
+   fprintf(outFILE, " stops changing.\n");
+   fprintf(
+      outFILE,
+      "    o Starts with -band or %i when -band is 0.\n",
+      defAdaptBandStart
+   );
+
+   if(defVectType == defVectAuto)
+      fprintf(outFILE,"  -vect-auto: [Yes]\n");
+   else
+      fprintf(outFILE,"  -vect-auto: [No]\n");
+
+   fprintf(
+      outFILE,
+      "    o Use the best vector instructions (SSE2, AVX2,"
+   );
+   fprintf(outFILE, " or\n");
+   fprintf(
+      outFILE,
+      "      AVX512) the cpu has to find the scores and"
+   );
+   fprintf(outFILE, " the\n      Waterman ends (water,");
+   fprintf(outFILE, " mem-water, band, and\n");
+   fprintf(outFILE, "      -only-scores).\n");
+   fprintf(
+      outFILE,
+      "    o Same scores and alignments as -no-vect."
+   );
+   fprintf(outFILE, "\n");
+
+   if(defVectType == defVectScalar)
+      fprintf(outFILE,"  -no-vect: [Yes]\n");
+   else
+      fprintf(outFILE,"  -no-vect: [No]\n");
+
+   fprintf(
+      outFILE,
+      "    o Do not use vector instructions.\n"
+   );
+
+   fprintf(outFILE,"  -vect-sse2: [No]\n");
+   fprintf(outFILE,"  -vect-avx2: [No]\n");
+   fprintf(outFILE,"  -vect-avx512: [No]\n");
+   fprintf(
+      outFILE,
+      "    o Use at most SSE2, AVX2, or AVX512BW vector"
+   );
+   fprintf(outFILE, "\n      instructions.\n");
+
    if(defPAln) fprintf(outFILE,"  -print-aligned: [No]\n");
    else fprintf(outFILE,"  -print-aligned: [Yes]\n");
 
@@ -1344,6 +1381,25 @@ void printHelpMesg(
    );
    fprintf(outFILE, "      alignment.\n");
 
+   fprintf(outFILE, "  -alt-top: [%i]\n", defAltTop);
+   fprintf(
+      outFILE,
+      "    o -use-mem-water -query-ref-scan only.\n"
+   );
+   fprintf(
+      outFILE,
+      "    o Only print this many of the highest scoring\n"
+   );
+   fprintf(
+      outFILE,
+      "      alternative alignments (sorted by score).\n"
+   );
+   fprintf(
+      outFILE,
+      "    o 0 prints every alternative as soon as it is\n"
+   );
+   fprintf(outFILE, "      found.\n");
+
    /******************************************************\
    * Fun-03 Sec-02 Sub-07:
    *  - Selecting alignment direction block
@@ -0,0 +1,1058 @@
+/*#########################################################
+# Name: alnSeqBatch
+# Use:
+#  - Aligns every query in a fasta or fastq file to one
+#    reference. The reference is converted and its striped
+#    profile is built once for all queries.
+# Includes:
+#  - "alnSeqBatch.h"
+#  o "hirschberg.h"
+#  o "needleman.h"
+#  o "memWater.h"
+#  o "bandAln.h"
+#  o "diffAln.h"
+#  o "waterman.h"
+#  o "stripedAln.h"
+#  o "generalAlnFun.h"
+#  o "alnStruct.h"
+#  o "alnMatrixStruct.h"
+#  o "twoBitArrays.h"
+#  o "scoresST.h"
+#  o "seqStruct.h"
+#  o "alnSetStruct.h"
+#  o "alnSeqDefaults.h"
+# C standard libraries:
+#  - <string.h>
+#  o <pthread.h>
+#  o <stdlib.h>
+#  o <stdio.h>
+#  o <stdint.h>
+#########################################################*/
+
+/*Needed for open_memstream*/
+#define _POSIX_C_SOURCE 200809L
+
+#include "alnSeqBatch.h"
+
+#include <string.h>
+
+/*~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~\
+' SOF: Start Of Functions
+'  o fun-01 alnQuery:
+'    - Aligns one query to the reference and prints the
+'      alignment or scores
+'  o fun-02 alnBatch:
+'    - Aligns every query in a fasta/fastq file to the
+'      reference
+'  o fun-03 readBatchQry:
+'    - Reads the next query from a fasta or fastq file
+'  o fun-04 alnThread:
+'    - Aligns queries in a block till there are no queries
+'      left (run by pthread_create)
+'  o fun-05 alnBatchThreads:
+'    - Aligns the queries in a file with multiple threads
+\~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~*/
+
+/*--------------------------------------------------------\
+| Name: alnQuery
+| Call:
+|   alnQuery(
+|      refST, refPrintST, qryST, settings, profST, pIdBl,
+|      outFILE, outStr, scoreMtrxFileStr
+|   );
+| Use:
+|   - Aligns one query to the reference with the method in
+|     settings and prints the result
+| Input:
+|   - refST:
+|     o Reference sequence, already converted with
+|       seqToLookupIndex
+|   - refPrintST:
+|     o Reference with the sequence as letters. This is
+|       only used to print the alignment.
+|   - qryST:
+|     o Query sequence (as letters)
+|   - settings:
+|     o Settings for the alignment
+|   - profST:
+|     o Striped reference profile to reuse between queries
+|       (0 to use a temporary profile)
+|   - pIdBl:
+|     o 1: Print the query id before the -only-scores line
+|     o 0: Only print the scores
+|   - outFILE:
+|     o File to print the alignment or scores to
+|   - outStr:
+|     o Output file name to print in the alignment header
+|   - scoreMtrxFileStr:
+|     o Scoring matrix file name for the alignment header
+| Output:
+|  - Prints:
+|    o The alignment, scores, or alternative alignments to
+|      outFILE
+|  - Modifies:
+|    o qryST->seqCStr is converted to lookup indexes. It
+|      is converted back when an alignment is printed.
+|    o refST offsetUL and endAlnUL
+|  - Returns:
+|    o 0 for success
+|    o 1 if the alignment could not be printed
+|    o 64 for memory errors
+\--------------------------------------------------------*/
+unsigned char alnQuery(
+   struct seqStruct *refST,     /*Reference (lookup index)*/
+   struct seqStruct *refPrintST,/*Reference (letters)*/
+   struct seqStruct *qryST,     /*Query to align*/
+   struct alnSet *settings,     /*Settings for alignment*/
+   struct stripedProf *profST,  /*Reused profile or 0*/
+   char pIdBl,                  /*1: print id with scores*/
+   FILE *outFILE,               /*File to print to*/
+   char *outStr,                /*Output name for header*/
+   char *scoreMtrxFileStr       /*Scoring matrix file*/
+){ /*~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~\
+   ' Fun-01 TOC: alnQuery
+   '  - Aligns one query to the reference and prints the
+   '    alignment or scores
+   '  o fun-01 sec-01:
+   '    - Variable declerations
+   '  o fun-01 sec-02:
+   '    - Set up the query
+   '  o fun-01 sec-03:
+   '    - Do the alignment
+   '  o fun-01 sec-04:
+   '    - Print the scores
+   '  o fun-01 sec-05:
+   '    - Print the alignment
+   \~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~*/
+
+   /*>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>\
+   ^ Fun-01 Sec-01:
+   ^  - Variable declerations
+   \<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<*/
+
+   unsigned char errUC = 0;
+   long bestScoreL = 0;
+   char *idStr = 0;
+
+   struct alnMatrixStruct *alnMtrxST = 0;
+   struct alnStruct *alnST = 0;
+   struct scoresStruct *bestScoreST = 0;
+
+   /*>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>\
+   ^ Fun-01 Sec-02:
+   ^  - Set up the query
+   \<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<*/
+
+   seqToLookupIndex(qryST);
+
+   qryST->endAlnUL = qryST->lenSeqUL - 1;
+   qryST->offsetUL = 0;
+
+   refST->endAlnUL = refST->lenSeqUL - 1;
+   refST->offsetUL = 0;
+
+   /*>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>\
+   ^ Fun-01 Sec-03:
+   ^  - Do the alignment
+   ^  o fun-01 sec-03 sub-01:
+   ^    - Needleman alignment
+   ^  o fun-01 sec-03 sub-02:
+   ^    - Waterman alignment
+   ^  o fun-01 sec-03 sub-03:
+   ^    - Memory efficent Waterman alignment
+   ^  o fun-01 sec-03 sub-04:
+   ^    - Hirschberg alignment
+   \<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<*/
+
+   /******************************************************\
+   * Fun-01 Sec-03 Sub-01:
+   *  - Needleman alignment
+   \******************************************************/
+
+   if(settings->useNeedleBl != 0)
+   { /*If doing a Needleman alignment*/
+     if(settings->justScoresBl)
+     { /*If only finding the score*/
+        bestScoreST = calloc(1, sizeof(struct scoresStruct));
+        if(bestScoreST == 0) return 64;
+        initScoresST(bestScoreST);
+
+        errUC = 1;
+
+        if(settings->diffAlnBl)
+           errUC =
+              diffNeedleScore(
+                 qryST,
+                 refST,
+                 settings,
+                 bestScoreST
+              ); /*Use the 8 bit difference kernel*/
+
+        if(errUC == 0) goto printScores;
+        if(errUC == 64) goto memErr;
+        /*Else scores do not fit in 8 bits; use striped*/
+
+        errUC =
+           stripedNeedleScore(
+              qryST,
+              refST,
+              settings,
+              profST,
+              bestScoreST
+           ); /*Use the striped vector kernel*/
+
+        if(errUC == 0) goto printScores;
+        if(errUC == 64) goto memErr;
+        /*Else no vector support, use the scalar Needle*/
+     } /*If only finding the score*/
+
+     if(
+           !settings->justScoresBl
+        && (settings->bandUL != 0 || settings->adaptBandBl)
+     ){ /*If only scoring the cells in a band*/
+        alnST =
+           bandAln(qryST, refST, settings, profST, &bestScoreL);
+
+        if(alnST == 0) goto memErr;
+        goto printAlignment;
+     } /*If only scoring the cells in a band*/
+
+     alnMtrxST = NeedlemanAln(qryST, refST, settings);
+     if(alnMtrxST == 0) goto memErr;
+
+     if(settings->justScoresBl)
+     { /*If only printing the scalar score*/
+        bestScoreST->scoreL = alnMtrxST->bestScoreST.scoreL;
+        bestScoreST->refStartUL = refST->offsetUL;
+        bestScoreST->qryStartUL = qryST->offsetUL;
+        bestScoreST->refEndUL = refST->endAlnUL;
+        bestScoreST->qryEndUL = qryST->endAlnUL;
+
+        freeAlnMatrixST(alnMtrxST);
+        alnMtrxST = 0;
+        goto printScores;
+     } /*If only printing the scalar score*/
+   } /*If doing a Needleman alignment*/
+
+   /******************************************************\
+   * Fun-01 Sec-03 Sub-02:
+   *  - Waterman alignment
+   \******************************************************/
+
+   else if(settings->useWaterBl != 0)
+   { /*else if doing a waterman alignment*/
+     if(settings->refQueryScanBl)
+     { /*IF keeping some alternative alignments*/
+       alnMtrxST = WatermanAltAln(qryST, refST, settings);
+       if(alnMtrxST == 0) goto memErr;
+
+       printAltWaterAlns(
+          alnMtrxST,
+          settings->minScoreL,
+          outFILE
+       ); /*Print out alternative alignment positions*/
+     } /*IF keeping some alternative alignments*/
+
+     else if(settings->justScoresBl)
+     { /*Else if only finding the score*/
+        bestScoreST =
+           memWaterAln(qryST, refST, settings, profST);
+
+        if(bestScoreST == 0) goto memErr;
+        goto printScores;
+     } /*Else if only finding the score*/
+
+     else if(settings->bandUL != 0 || settings->adaptBandBl)
+     { /*Else if only scoring the cells in a band*/
+        alnST =
+           bandAln(qryST, refST, settings, profST, &bestScoreL);
+
+        if(alnST == 0) goto memErr;
+        goto printAlignment;
+     } /*Else if only scoring the cells in a band*/
+
+     else
+        alnMtrxST =
+           WatermanAln(qryST, refST, settings, profST);
+
+     if(alnMtrxST == 0) goto memErr;
+   } /*else if doing a waterman alignment*/
+
+   /******************************************************\
+   * Fun-01 Sec-03 Sub-03:
+   *  - Memory efficent Waterman alignment
+   \******************************************************/
+
+   else if(settings->memWaterBl != 0)
+   { /*Else if; doing a memory waterman alignment*/
+      if(settings->refQueryScanBl)
+      { /*If doing an query-ref scan*/
+         /*Print the alternatives as they are found, so
+         ` only one reference row of them is in memory
+         */
+         bestScoreST = calloc(1, sizeof(struct scoresStruct));
+         if(bestScoreST == 0) goto memErr;
+
+         errUC =
+            memWaterAltStream(
+               qryST,
+               refST,
+               settings,
+               bestScoreST,
+               outFILE
+            );
+
+         if(errUC == 64) goto memErr;
+
+         if(errUC == 0)
+         { /*If the streaming scan worked*/
+            bestScoreL = bestScoreST->scoreL;
+
+            refST->offsetUL = bestScoreST->refStartUL;
+            qryST->offsetUL = bestScoreST->qryStartUL;
+            refST->endAlnUL = bestScoreST->refEndUL;
+            qryST->endAlnUL = bestScoreST->qryEndUL;
+
+            freeScoresST(bestScoreST, 1); /*On heap*/
+            bestScoreST = 0;
+
+            if(settings->justScoresBl) return 0;
+
+            alnST = Hirschberg(refST, qryST, settings);
+            if(alnST == 0) goto memErr;
+            goto printAlignment;
+         } /*If the streaming scan worked*/
+
+         /*Sequences to long for 32 bit coordinates*/
+         freeScoresST(bestScoreST, 1);
+         bestScoreST = 0;
+
+         alnMtrxST = memWaterAltAln(qryST, refST, settings);
+         if(alnMtrxST == 0) goto memErr;
+
+         if(!settings->justScoresBl)
+         { /*If I need the alignment*/
+            refST->offsetUL =
+               alnMtrxST->bestScoreST.refStartUL;
+            qryST->offsetUL =
+               alnMtrxST->bestScoreST.qryStartUL;
+            refST->endAlnUL =
+               alnMtrxST->bestScoreST.refEndUL;
+            qryST->endAlnUL =
+               alnMtrxST->bestScoreST.qryEndUL;
+
+            alnST = Hirschberg(refST, qryST, settings);
+            if(alnST == 0) goto memErr;
+         } /*If I need the alignment*/
+
+         printAltWaterAlns(
+            alnMtrxST,
+            settings->minScoreL,
+            outFILE
+         ); /*Print out alternative alignment positions*/
+
+         bestScoreL = alnMtrxST->bestScoreST.scoreL;
+         freeAlnMatrixST(alnMtrxST);
+         alnMtrxST = 0;
+
+         if(settings->justScoresBl) return 0;
+         goto printAlignment;
+      } /*If doing an query-ref scan*/
+
+      bestScoreST = memWaterAln(qryST,refST,settings,profST);
+      if(bestScoreST == 0) goto memErr;
+
+      if(settings->justScoresBl) goto printScores;
+
+      refST->offsetUL = bestScoreST->refStartUL;
+      qryST->offsetUL = bestScoreST->qryStartUL;
+      refST->endAlnUL = bestScoreST->refEndUL;
+      qryST->endAlnUL = bestScoreST->qryEndUL;
+
+      bestScoreL = bestScoreST->scoreL;
+      freeScoresST(bestScoreST, 1); /*On heap*/
+      bestScoreST = 0;
+
+      alnST = Hirschberg(refST, qryST, settings);
+      if(alnST == 0) goto memErr;
+      goto printAlignment;
+   } /*Else if; doing a memory waterman alignment*/
+
+   /******************************************************\
+   * Fun-01 Sec-03 Sub-04:
+   *  - Hirschberg alignment
+   \******************************************************/
+
+   else
+   { /*Else doing an Hirschberg alignment*/
+      alnST = Hirschberg(refST, qryST, settings);
+      if(alnST == 0) goto memErr;
+      goto printAlignment;
+   } /*Else doing an Hirschberg alignment*/
+
+   alnST =
+      dirMatrixToAlnST(
+         refST,
+         qryST,
+         &alnMtrxST->bestScoreST,
+         alnMtrxST->dirMatrixST
+   );
+
+   bestScoreL = alnMtrxST->bestScoreST.scoreL;
+   freeAlnMatrixST(alnMtrxST); /*No longer need*/
+   alnMtrxST = 0;
+
+   if(alnST == 0) return 64;
+   goto printAlignment;
+
+   /*>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>\
+   ^ Fun-01 Sec-04:
+   ^  - Print the scores
+   \<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<*/
+
+   printScores:
+
+   if(pIdBl)
+   { /*If printing the query id*/
+      idStr = qryST->idCStr;
+      if(*idStr == '>' || *idStr == '@') ++idStr;
+
+      while(*idStr > 32)
+      { /*Loop: print the id (till first white space)*/
+         fputc(*idStr, outFILE);
+         ++idStr;
+      } /*Loop: print the id (till first white space)*/
+
+      fputc('\t', outFILE);
+   } /*If printing the query id*/
+
+   fprintf(
+      outFILE,
+      "%li\t%lu\t%lu\t%lu\t%lu\n",
+      bestScoreST->scoreL,
+      bestScoreST->refStartUL,
+      bestScoreST->qryStartUL,
+      bestScoreST->refEndUL,
+      bestScoreST->qryEndUL
+   );
+
+   freeScoresST(bestScoreST, 1); /*On heap*/
+   return 0;
+
+   /*>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>\
+   ^ Fun-01 Sec-05:
+   ^  - Print the alignment
+   \<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<*/
+
+   printAlignment:
+
+   lookupIndexToSeq(qryST);
+
+   errUC =
+      printAln(
+         outFILE,
+         outStr,
+         refPrintST,
+         qryST,
+         alnST,
+         bestScoreL,
+         settings,
+         scoreMtrxFileStr /*File name for scoring matrix*/
+      );
+
+   freeAlnST(alnST, 1);
+   return (errUC != 0); /*1 if could not print alignment*/
+
+   memErr:
+
+   if(bestScoreST != 0) freeScoresST(bestScoreST, 1); /*On heap*/
+   if(alnMtrxST != 0) freeAlnMatrixST(alnMtrxST);
+   return 64;
+} /*alnQuery*/
+
+/*--------------------------------------------------------\
+| Name: alnBatch
+| Call:
+|   alnBatch(
+|      refST, refPrintST, qryFILE, settings, outFILE,
+|      outStr, scoreMtrxFileStr
+|   );
+| Use:
+|   - Aligns the queries in a fasta or fastq file to the
+|     reference. The reference lookup indexes and its
+|     striped profile are only built once.
+| Input:
+|   - refST:
+|     o Reference sequence (as letters, or as lookup
+|       indexes if refPrintST is not 0)
+|   - refPrintST:
+|     o Reference sequence as uppercase letters (from a
+|       reference index; refIndex.h)
+|     o 0 to convert refST and build the printed copy
+|   - qryFILE:
+|     o fasta or fastq file with the queries
+|   - settings:
+|     o Settings for the alignments. settings->batchBl
+|       is 1 to align every query in qryFILE and 0 to only
+|       align the first query.
+|   - outFILE:
+|     o File to print the alignments or scores to
+|   - outStr:
+|     o Output file name to print in alignment headers
+|   - scoreMtrxFileStr:
+|     o Scoring matrix file name for alignment headers
+| Output:
+|  - Prints:
+|    o The alignment, scores, or alternative alignments
+|      for each query to outFILE
+|  - Modifies:
+|    o refST->seqCStr to be lookup indexes (refPrintST is
+|      0 only)
+|  - Returns:
+|    o 0 for success
+|    o 1 if an alignment could not be printed
+|    o 2 if qryFILE had an invalid entry
+|    o 64 for memory errors
+\--------------------------------------------------------*/
+unsigned char alnBatch(
+   struct seqStruct *refST,   /*Reference to align to*/
+   struct seqStruct *refPrintST, /*0 or printed ref*/
+   FILE *qryFILE,             /*File with the queries*/
+   struct alnSet *settings,   /*Settings for alignment*/
+   FILE *outFILE,             /*File to print to*/
+   char *outStr,              /*Output name for header*/
+   char *scoreMtrxFileStr     /*Scoring matrix file*/
+){ /*~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~\
+   ' Fun-02 TOC: alnBatch
+   '  - Aligns every query in a fasta/fastq file to the
+   '    reference
+   '  o fun-02 sec-01:
+   '    - Variable declerations
+   '  o fun-02 sec-02:
+   '    - Set up the reference
+   '  o fun-02 sec-03:
+   '    - Align each query
+   '  o fun-02 sec-04:
+   '    - Clean up
+   \~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~*/
+
+   /*>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>\
+   ^ Fun-02 Sec-01:
+   ^  - Variable declerations
+   \<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<*/
+
+   unsigned char errUC = 0;
+   char fqBl = 0;  /*1: query file is a fastq file*/
+   int peekI = 0;  /*First character in the query file*/
+
+   struct seqStruct printST;    /*Reference as letters*/
+   char *printSeqStr = 0;       /*Freed at end (if made)*/
+   struct seqStruct qryST;
+   struct stripedProf profST;   /*Reused for each query*/
+
+   initSeqST(&qryST);
+   initStripedProf(&profST);
+
+   /*>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>\
+   ^ Fun-02 Sec-02:
+   ^  - Set up the reference
+   \<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<*/
+
+   if(refPrintST != 0)
+   { /*If the reference came from an index*/
+      printST = *refPrintST;
+      goto alignQueries;
+   } /*If the reference came from an index*/
+
+   /*The copy shares the id, but has its own sequence*/
+   printST = *refST;
+   printSeqStr = malloc(refST->lenSeqUL + 1);
+   if(printSeqStr == 0) return 64;
+   printST.seqCStr = printSeqStr;
+
+   seqToLookupIndex(refST);
+
+   /*Printed alignments use uppercase bases*/
+   memcpy(printST.seqCStr, refST->seqCStr, refST->lenSeqUL);
+   printST.seqCStr[refST->lenSeqUL] = '\0';
+   lookupIndexToSeq(&printST);
+
+   /*>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>\
+   ^ Fun-02 Sec-03:
+   ^  - Align each query
+   \<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<*/
+
+   alignQueries:
+
+   peekI = fgetc(qryFILE);
+   if(peekI == '@') fqBl = 1;
+   if(peekI != EOF) ungetc(peekI, qryFILE);
+
+   if(settings->batchBl && settings->threadsI > 1)
+   { /*If splitting the queries between threads*/
+      errUC =
+         alnBatchThreads(
+            refST,
+            &printST,
+            qryFILE,
+            fqBl,
+            settings,
+            outFILE,
+            outStr,
+            scoreMtrxFileStr
+         );
+   } /*If splitting the queries between threads*/
+
+   else
+   { /*Else aligning the queries on this thread*/
+      do { /*Loop: align each query*/
+         errUC = readBatchQry(qryFILE, fqBl, &qryST);
+
+         if(errUC == 0)
+         { /*If at the end of the file*/
+            /*Need at least one query*/
+            if(!settings->batchBl) errUC = 2;
+            break;
+         } /*If at the end of the file*/
+
+         if(errUC != 1) break; /*Invalid file or memory*/
+
+         errUC =
+            alnQuery(
+               refST,
+               &printST,
+               &qryST,
+               settings,
+               &profST,
+               settings->batchBl, /*Print ids with scores*/
+               outFILE,
+               outStr,
+               scoreMtrxFileStr
+            );
+
+         if(errUC) break;
+      } while(settings->batchBl); /*Loop: align each query*/
+   } /*Else aligning the queries on this thread*/
+
+   /*>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>\
+   ^ Fun-02 Sec-04:
+   ^  - Clean up
+   \<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<*/
+
+   free(printSeqStr);
+   freeStripedProf(&profST);
+   freeSeqST(&qryST, 0); /*0 to mark on the stack*/
+
+   return errUC;
+} /*alnBatch*/
+
+/*--------------------------------------------------------\
+| Name: readBatchQry
+| Call: readBatchQry(qryFILE, fqBl, qryST);
+| Use:
+|   - Reads the next query from a fasta or fastq file
+| Input:
+|   - qryFILE:
+|     o fasta or fastq file with the queries
+|   - fqBl:
+|     o 1: qryFILE is a fastq file
+|     o 0: qryFILE is a fasta file
+|   - qryST:
+|     o seqStruct to read the query into. Its buffers are
+|       reused.
+| Output:
+|  - Modifies:
+|    o qryST to have the next query
+|  - Returns:
+|    o 0 if there were no more queries (EOF)
+|    o 1 if a query was read in
+|    o 2 if qryFILE had an invalid entry
+|    o 64 for memory errors
+\--------------------------------------------------------*/
+unsigned char readBatchQry(
+   FILE *qryFILE,           /*File with the queries*/
+   char fqBl,               /*1: fastq file; 0: fasta*/
+   struct seqStruct *qryST  /*Will hold the query*/
+){ /*~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~\
+   ' Fun-03 TOC: readBatchQry
+   '  - Reads the next query from a fasta or fastq file
+   \~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~*/
+
+   unsigned char errUC = 0;
+
+   /*The readers do not clear the sequence length when
+   ` they hit the end of the file
+   */
+   qryST->lenSeqUL = 0;
+
+   if(fqBl) errUC = readFqSeq(qryFILE, qryST);
+   else errUC = readFaSeq(qryFILE, qryST);
+
+   if(errUC & 64) return 64;
+   if(errUC & ~1) return 2;   /*Invalid entry*/
+   if(qryST->lenSeqUL == 0) return 0; /*End of file*/
+   return 1;
+} /*readBatchQry*/
+
+/*--------------------------------------------------------\
+| Name: alnThread
+| Call: pthread_create(&thread, 0, alnThread, threadST);
+| Use:
+|   - Aligns queries in a block till there are no queries
+|     left. Each query is taken from the block when the
+|     thread is ready for it, so slow queries do not hold
+|     back the other threads.
+| Input:
+|   - threadST:
+|     o alnThreadST with the reference copies, query block,
+|       and output buffers for this thread
+| Output:
+|  - Modifies:
+|    o outAryStr/lenOutAryUL in threadST to have the
+|      output for each query this thread aligned
+|    o errUC in threadST to have the alnQuery error or
+|      64 if an output buffer could not be made
+|    o nextQryUL in threadST to be past the block
+|  - Returns:
+|    o 0 (errors are in threadST->errUC)
+\--------------------------------------------------------*/
+void * alnThread(
+   void *threadST  /*alnThreadST with the thread settings*/
+){ /*~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~\
+   ' Fun-04 TOC: alnThread
+   '  - Aligns queries in a block till there are no queries
+   '    left
+   \~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~*/
+
+   struct alnThreadST *parmST =
+      (struct alnThreadST *) threadST;
+   unsigned long qryUL = 0;
+   FILE *memFILE = 0;
+
+   parmST->errUC = 0;
+
+   for(;;)
+   { /*Loop: align queries till the block is empty*/
+      pthread_mutex_lock(parmST->qryMutex);
+         qryUL = *parmST->nextQryUL;
+         ++(*parmST->nextQryUL);
+      pthread_mutex_unlock(parmST->qryMutex);
+
+      if(qryUL >= parmST->numQryUL) break;
+
+      /*Each query gets its own buffer, so the output can
+      ` be printed in the same order as the queries
+      */
+      memFILE =
+         open_memstream(
+            &parmST->outAryStr[qryUL],
+            &parmST->lenOutAryUL[qryUL]
+         );
+
+      if(memFILE == 0)
+      { /*If I could not make the output buffer*/
+         parmST->errUC = 64;
+         break;
+      } /*If I could not make the output buffer*/
+
+      parmST->errUC =
+         alnQuery(
+            &parmST->refST,
+            &parmST->refPrintST,
+            &parmST->qryAryST[qryUL],
+            parmST->settings,
+            &parmST->profST,
+            1,                /*Print ids with scores*/
+            memFILE,
+            parmST->outStr,
+            parmST->scoreMtrxFileStr
+         );
+
+      fclose(memFILE);
+      if(parmST->errUC) break;
+   } /*Loop: align queries till the block is empty*/
+
+   return 0;
+} /*alnThread*/
+
+/*--------------------------------------------------------\
+| Name: alnBatchThreads
+| Call:
+|   alnBatchThreads(
+|      refST, refPrintST, qryFILE, fqBl, settings, outFILE,
+|      outStr, scoreMtrxFileStr
+|   );
+| Use:
+|   - Aligns the queries in a fasta or fastq file to the
+|     reference with settings->threadsI threads. Queries
+|     are read in blocks and the output for each block is
+|     printed in the same order as the queries.
+| Input:
+|   - refST:
+|     o Reference sequence, already converted with
+|       seqToLookupIndex
+|   - refPrintST:
+|     o Reference with the sequence as letters
+|   - qryFILE:
+|     o fasta or fastq file with the queries
+|   - fqBl:
+|     o 1: qryFILE is a fastq file
+|     o 0: qryFILE is a fasta file
+|   - settings:
+|     o Settings for the alignments
+|   - outFILE:
+|     o File to print the alignments or scores to
+|   - outStr:
+|     o Output file name to print in alignment headers
+|   - scoreMtrxFileStr:
+|     o Scoring matrix file name for alignment headers
+| Output:
+|  - Prints:
+|    o The alignment or scores for each query to outFILE
+|  - Returns:
+|    o 0 for success
+|    o 1 if an alignment could not be printed
+|    o 2 if qryFILE had an invalid entry
+|    o 64 for memory errors
+\--------------------------------------------------------*/
+unsigned char alnBatchThreads(
+   struct seqStruct *refST,     /*Reference (lookup index)*/
+   struct seqStruct *refPrintST,/*Reference (letters)*/
+   FILE *qryFILE,               /*File with the queries*/
+   char fqBl,                   /*1: fastq file; 0: fasta*/
+   struct alnSet *settings,     /*Settings for alignment*/
+   FILE *outFILE,               /*File to print to*/
+   char *outStr,                /*Output name for header*/
+   char *scoreMtrxFileStr       /*Scoring matrix file*/
+){ /*~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~\
+   ' Fun-05 TOC: alnBatchThreads
+   '  - Aligns the queries in a file with multiple threads
+   '  o fun-05 sec-01:
+   '    - Variable declerations
+   '  o fun-05 sec-02:
+   '    - Allocate memory and set up the threads
+   '  o fun-05 sec-03:
+   '    - Read, align, and print each block of queries
+   '  o fun-05 sec-04:
+   '    - Clean up
+   \~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~*/
+
+   /*>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>\
+   ^ Fun-05 Sec-01:
+   ^  - Variable declerations
+   \<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<*/
+
+   unsigned char errUC = 0;
+   unsigned char readErrUC = 1;
+   int threadI = 0;
+   int numThreadsI = settings->threadsI;
+   unsigned long qryUL = 0;
+   unsigned long numQryUL = 0;  /*Queries in this block*/
+   unsigned long nextQryUL = 0; /*Next query to align*/
+   unsigned long lenBlockUL =
+      (unsigned long) numThreadsI * defQryPerThread;
+
+   struct seqStruct *qryAryST = 0;  /*Block of queries*/
+   char **outAryStr = 0;            /*Output of each query*/
+   size_t *lenOutAryUL = 0;
+   struct alnThreadST *threadAryST = 0;
+   pthread_t *threadAry = 0;
+   pthread_mutex_t qryMutex;
+
+   /*>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>\
+   ^ Fun-05 Sec-02:
+   ^  - Allocate memory and set up the threads
+   \<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<*/
+
+   qryAryST = calloc(lenBlockUL, sizeof(struct seqStruct));
+   outAryStr = calloc(lenBlockUL, sizeof(char *));
+   lenOutAryUL = calloc(lenBlockUL, sizeof(size_t));
+   threadAryST =
+      calloc(numThreadsI, sizeof(struct alnThreadST));
+   threadAry = calloc(numThreadsI, sizeof(pthread_t));
+
+   if(
+         qryAryST == 0
+      || outAryStr == 0
+      || lenOutAryUL == 0
+      || threadAryST == 0
+      || threadAry == 0
+   ){ /*If I had a memory error*/
+      errUC = 64;
+      goto cleanUp;
+   } /*If I had a memory error*/
+
+   for(qryUL = 0; qryUL < lenBlockUL; ++qryUL)
+      initSeqST(&qryAryST[qryUL]);
+
+   for(threadI = 0; threadI < numThreadsI; ++threadI)
+   { /*Loop: set up each thread*/
+      /*Each thread changes the offsets of its reference
+      ` and printAln edits the ids in place, so each
+      ` thread gets its own structures and id. The
+      ` sequences are only read, so they are shared.
+      */
+      threadAryST[threadI].refST = *refST;
+      threadAryST[threadI].refPrintST = *refPrintST;
+      initStripedProf(&threadAryST[threadI].profST);
+
+      threadAryST[threadI].refPrintST.idCStr =
+         malloc(refPrintST->lenIdUL + 1);
+
+      if(threadAryST[threadI].refPrintST.idCStr == 0)
+      { /*If I had a memory error*/
+         errUC = 64;
+         goto cleanUp;
+      } /*If I had a memory error*/
+
+      memcpy(
+         threadAryST[threadI].refPrintST.idCStr,
+         refPrintST->idCStr,
+         refPrintST->lenIdUL
+      );
+
+      threadAryST[threadI].refPrintST.idCStr[
+         refPrintST->lenIdUL
+      ] = '\0';
+
+      threadAryST[threadI].refPrintST.lenIdBuffUL =
+         refPrintST->lenIdUL + 1;
+      threadAryST[threadI].refST.idCStr =
+         threadAryST[threadI].refPrintST.idCStr;
+
+      threadAryST[threadI].settings = settings;
+      threadAryST[threadI].qryAryST = qryAryST;
+      threadAryST[threadI].outAryStr = outAryStr;
+      threadAryST[threadI].lenOutAryUL = lenOutAryUL;
+      threadAryST[threadI].nextQryUL = &nextQryUL;
+      threadAryST[threadI].qryMutex = &qryMutex;
+      threadAryST[threadI].outStr = outStr;
+      threadAryST[threadI].scoreMtrxFileStr =
+         scoreMtrxFileStr;
+   } /*Loop: set up each thread*/
+
+   pthread_mutex_init(&qryMutex, 0);
+
+   /*>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>\
+   ^ Fun-05 Sec-03:
+   ^  - Read, align, and print each block of queries
+   ^  o fun-05 sec-03 sub-01:
+   ^    - Read in the next block of queries
+   ^  o fun-05 sec-03 sub-02:
+   ^    - Align the block
+   ^  o fun-05 sec-03 sub-03:
+   ^    - Print the block in order
+   \<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<*/
+
+   while(readErrUC == 1)
+   { /*Loop: align each block of queries*/
+
+      /***************************************************\
+      * Fun-05 Sec-03 Sub-01:
+      *  - Read in the next block of queries
+      \***************************************************/
+
+      numQryUL = 0;
+
+      while(numQryUL < lenBlockUL)
+      { /*Loop: read in the block*/
+         readErrUC =
+            readBatchQry(qryFILE, fqBl, &qryAryST[numQryUL]);
+
+         if(readErrUC != 1) break;
+         ++numQryUL;
+      } /*Loop: read in the block*/
+
+      if(readErrUC > 1)
+      { /*If the query file was invalid*/
+         errUC = readErrUC;
+         break;
+      } /*If the query file was invalid*/
+
+      if(numQryUL == 0) break;
+
+      /***************************************************\
+      * Fun-05 Sec-03 Sub-02:
+      *  - Align the block
+      \***************************************************/
+
+      nextQryUL = 0;
+
+      for(threadI = 0; threadI < numThreadsI; ++threadI)
+      { /*Loop: launch the threads*/
+         threadAryST[threadI].numQryUL = numQryUL;
+
+         pthread_create(
+            &threadAry[threadI],
+            0,
+            alnThread,
+            &threadAryST[threadI]
+         );
+      } /*Loop: launch the threads*/
+
+      for(threadI = 0; threadI < numThreadsI; ++threadI)
+      { /*Loop: wait for the threads to finish*/
+         pthread_join(threadAry[threadI], 0);
+
+         if(threadAryST[threadI].errUC > errUC)
+            errUC = threadAryST[threadI].errUC;
+      } /*Loop: wait for the threads to finish*/
+
+      /***************************************************\
+      * Fun-05 Sec-03 Sub-03:
+      *  - Print the block in order
+      \***************************************************/
+
+      for(qryUL = 0; qryUL < numQryUL; ++qryUL)
+      { /*Loop: print the output for each query*/
+         if(outAryStr[qryUL] == 0) continue;
+
+         if(!errUC)
+            fwrite(
+               outAryStr[qryUL],
+               sizeof(char),
+               lenOutAryUL[qryUL],
+               outFILE
+            );
+
+         free(outAryStr[qryUL]);
+         outAryStr[qryUL] = 0;
+      } /*Loop: print the output for each query*/
+
+      if(errUC) break;
+   } /*Loop: align each block of queries*/
+
+   pthread_mutex_destroy(&qryMutex);
+
+   /*>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>\
+   ^ Fun-05 Sec-04:
+   ^  - Clean up
+   \<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<*/
+
+   cleanUp:
+
+   if(qryAryST != 0)
+   { /*If I need to free the queries*/
+      for(qryUL = 0; qryUL < lenBlockUL; ++qryUL)
+         freeSeqST(&qryAryST[qryUL], 0); /*0 for no free*/
+
+      free(qryAryST);
+   } /*If I need to free the queries*/
+
+   if(threadAryST != 0)
+   { /*If I need to free the thread structures*/
+      for(threadI = 0; threadI < numThreadsI; ++threadI)
+      { /*Loop: free the thread copies*/
+         free(threadAryST[threadI].refPrintST.idCStr);
+         freeStripedProf(&threadAryST[threadI].profST);
+      } /*Loop: free the thread copies*/
+
+      free(threadAryST);
+   } /*If I need to free the thread structures*/
+
+   free(outAryStr);
+   free(lenOutAryUL);
+   free(threadAry);
+
+   return errUC;
+} /*alnBatchThreads*/
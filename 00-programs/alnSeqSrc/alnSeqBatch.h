@@ -0,0 +1,352 @@
+/*#########################################################
+# Name: alnSeqBatch
+# Use:
+#  - Aligns every query in a fasta or fastq file to one
+#    reference. The reference is converted and its striped
+#    profile is built once for all queries.
+# Includes:
+#  - "hirschberg.h"
+#  - "needleman.h"
+#  - "memWater.h"
+#  - "bandAln.h"
+#  - "diffAln.h"
+#  o "waterman.h"
+#  o "stripedAln.h"
+#  o "generalAlnFun.h"
+#  o "alnStruct.h"
+#  o "alnMatrixStruct.h"
+#  o "twoBitArrays.h"
+#  o "scoresST.h"
+#  o "seqStruct.h"
+#  o "alnSetStruct.h"
+#  o "alnSeqDefaults.h"
+# C standard libraries:
+#  - <pthread.h>
+#  o <string.h>
+#  o <stdlib.h>
+#  o <stdio.h>
+#  o <stdint.h>
+#########################################################*/
+
+#ifndef ALNSEQBATCH_H
+#define ALNSEQBATCH_H
+
+#include <pthread.h>
+
+#include "hirschberg.h"
+#include "needleman.h"
+#include "memWater.h"
+#include "bandAln.h"
+#include "diffAln.h"
+
+/*~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~\
+' SOH: Start Of Header
+'  o fun-01 alnQuery:
+'    - Aligns one query to the reference and prints the
+'      alignment or scores
+'  o struct-01 alnThreadST:
+'    - Holds the settings and buffers for one thread
+'  o fun-02 alnBatch:
+'    - Aligns every query in a fasta/fastq file to the
+'      reference
+'  o fun-03 readBatchQry:
+'    - Reads the next query from a fasta or fastq file
+'  o fun-04 alnThread:
+'    - Aligns queries in a block till there are no queries
+'      left (run by pthread_create)
+'  o fun-05 alnBatchThreads:
+'    - Aligns the queries in a file with multiple threads
+\~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~*/
+
+/*--------------------------------------------------------\
+| Struct-01: alnThreadST
+|  - Holds the settings and buffers for one thread. The
+|    reference copies and the profile are kept between
+|    blocks of queries.
+\--------------------------------------------------------*/
+typedef struct alnThreadST
+{ /*alnThreadST*/
+   struct seqStruct refST;      /*Reference (lookup index)*/
+   struct seqStruct refPrintST; /*Reference (letters)*/
+     /*Both copies have their own id and offsets, but share
+     ` the sequences with the other threads
+     */
+   struct stripedProf profST;   /*Reused for each query*/
+   struct alnSet *settings;     /*Shared settings*/
+
+   struct seqStruct *qryAryST;  /*Block of queries*/
+   unsigned long numQryUL;      /*Queries in the block*/
+   char **outAryStr;            /*Output of each query*/
+   size_t *lenOutAryUL;         /*Length of each output*/
+
+   unsigned long *nextQryUL;    /*Next query to align*/
+   pthread_mutex_t *qryMutex;   /*Locks nextQryUL*/
+
+   char *outStr;                /*Output name for header*/
+   char *scoreMtrxFileStr;      /*Scoring matrix file*/
+   unsigned char errUC;         /*Error from the thread*/
+}alnThreadST;
+
+/*--------------------------------------------------------\
+| Name: alnQuery
+| Call:
+|   alnQuery(
+|      refST, refPrintST, qryST, settings, profST, pIdBl,
+|      outFILE, outStr, scoreMtrxFileStr
+|   );
+| Use:
+|   - Aligns one query to the reference with the method in
+|     settings and prints the result
+| Input:
+|   - refST:
+|     o Reference sequence, already converted with
+|       seqToLookupIndex
+|   - refPrintST:
+|     o Reference with the sequence as letters. This is
+|       only used to print the alignment.
+|   - qryST:
+|     o Query sequence (as letters)
+|   - settings:
+|     o Settings for the alignment
+|   - profST:
+|     o Striped reference profile to reuse between queries
+|       (0 to use a temporary profile)
+|   - pIdBl:
+|     o 1: Print the query id before the -only-scores line
+|     o 0: Only print the scores
+|   - outFILE:
+|     o File to print the alignment or scores to
+|   - outStr:
+|     o Output file name to print in the alignment header
+|   - scoreMtrxFileStr:
+|     o Scoring matrix file name for the alignment header
+| Output:
+|  - Prints:
+|    o The alignment, scores, or alternative alignments to
+|      outFILE
+|  - Modifies:
+|    o qryST->seqCStr is converted to lookup indexes. It
+|      is converted back when an alignment is printed.
+|    o refST offsetUL and endAlnUL
+|  - Returns:
+|    o 0 for success
+|    o 1 if the alignment could not be printed
+|    o 64 for memory errors
+\--------------------------------------------------------*/
+unsigned char alnQuery(
+   struct seqStruct *refST,     /*Reference (lookup index)*/
+   struct seqStruct *refPrintST,/*Reference (letters)*/
+   struct seqStruct *qryST,     /*Query to align*/
+   struct alnSet *settings,     /*Settings for alignment*/
+   struct stripedProf *profST,  /*Reused profile or 0*/
+   char pIdBl,                  /*1: print id with scores*/
+   FILE *outFILE,               /*File to print to*/
+   char *outStr,                /*Output name for header*/
+   char *scoreMtrxFileStr       /*Scoring matrix file*/
+); /*~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~\
+   ' Fun-01 TOC: alnQuery
+   '  - Aligns one query to the reference and prints the
+   '    alignment or scores
+   '  o fun-01 sec-01:
+   '    - Variable declerations
+   '  o fun-01 sec-02:
+   '    - Set up the query
+   '  o fun-01 sec-03:
+   '    - Do the alignment
+   '  o fun-01 sec-04:
+   '    - Print the scores
+   '  o fun-01 sec-05:
+   '    - Print the alignment
+   \~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~*/
+
+/*--------------------------------------------------------\
+| Name: alnBatch
+| Call:
+|   alnBatch(
+|      refST, refPrintST, qryFILE, settings, outFILE,
+|      outStr, scoreMtrxFileStr
+|   );
+| Use:
+|   - Aligns the queries in a fasta or fastq file to the
+|     reference. The reference lookup indexes and its
+|     striped profile are only built once.
+| Input:
+|   - refST:
+|     o Reference sequence (as letters, or as lookup
+|       indexes if refPrintST is not 0)
+|   - refPrintST:
+|     o Reference sequence as uppercase letters (from a
+|       reference index; refIndex.h)
+|     o 0 to convert refST and build the printed copy
+|   - qryFILE:
+|     o fasta or fastq file with the queries
+|   - settings:
+|     o Settings for the alignments. settings->batchBl
+|       is 1 to align every query in qryFILE and 0 to only
+|       align the first query.
+|   - outFILE:
+|     o File to print the alignments or scores to
+|   - outStr:
+|     o Output file name to print in alignment headers
+|   - scoreMtrxFileStr:
+|     o Scoring matrix file name for alignment headers
+| Output:
+|  - Prints:
+|    o The alignment, scores, or alternative alignments
+|      for each query to outFILE
+|  - Modifies:
+|    o refST->seqCStr to be lookup indexes (refPrintST is
+|      0 only)
+|  - Returns:
+|    o 0 for success
+|    o 1 if an alignment could not be printed
+|    o 2 if qryFILE had an invalid entry
+|    o 64 for memory errors
+\--------------------------------------------------------*/
+unsigned char alnBatch(
+   struct seqStruct *refST,   /*Reference to align to*/
+   struct seqStruct *refPrintST, /*0 or printed ref*/
+   FILE *qryFILE,             /*File with the queries*/
+   struct alnSet *settings,   /*Settings for alignment*/
+   FILE *outFILE,             /*File to print to*/
+   char *outStr,              /*Output name for header*/
+   char *scoreMtrxFileStr     /*Scoring matrix file*/
+); /*~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~\
+   ' Fun-02 TOC: alnBatch
+   '  - Aligns every query in a fasta/fastq file to the
+   '    reference
+   '  o fun-02 sec-01:
+   '    - Variable declerations
+   '  o fun-02 sec-02:
+   '    - Set up the reference
+   '  o fun-02 sec-03:
+   '    - Align each query
+   '  o fun-02 sec-04:
+   '    - Clean up
+   \~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~*/
+
+/*--------------------------------------------------------\
+| Name: readBatchQry
+| Call: readBatchQry(qryFILE, fqBl, qryST);
+| Use:
+|   - Reads the next query from a fasta or fastq file
+| Input:
+|   - qryFILE:
+|     o fasta or fastq file with the queries
+|   - fqBl:
+|     o 1: qryFILE is a fastq file
+|     o 0: qryFILE is a fasta file
+|   - qryST:
+|     o seqStruct to read the query into. Its buffers are
+|       reused.
+| Output:
+|  - Modifies:
+|    o qryST to have the next query
+|  - Returns:
+|    o 0 if there were no more queries (EOF)
+|    o 1 if a query was read in
+|    o 2 if qryFILE had an invalid entry
+|    o 64 for memory errors
+\--------------------------------------------------------*/
+unsigned char readBatchQry(
+   FILE *qryFILE,           /*File with the queries*/
+   char fqBl,               /*1: fastq file; 0: fasta*/
+   struct seqStruct *qryST  /*Will hold the query*/
+); /*~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~\
+   ' Fun-03 TOC: readBatchQry
+   '  - Reads the next query from a fasta or fastq file
+   \~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~*/
+
+/*--------------------------------------------------------\
+| Name: alnThread
+| Call: pthread_create(&thread, 0, alnThread, threadST);
+| Use:
+|   - Aligns queries in a block till there are no queries
+|     left. Each query is taken from the block when the
+|     thread is ready for it, so slow queries do not hold
+|     back the other threads.
+| Input:
+|   - threadST:
+|     o alnThreadST with the reference copies, query block,
+|       and output buffers for this thread
+| Output:
+|  - Modifies:
+|    o outAryStr/lenOutAryUL in threadST to have the
+|      output for each query this thread aligned
+|    o errUC in threadST to have the alnQuery error or
+|      64 if an output buffer could not be made
+|    o nextQryUL in threadST to be past the block
+|  - Returns:
+|    o 0 (errors are in threadST->errUC)
+\--------------------------------------------------------*/
+void * alnThread(
+   void *threadST  /*alnThreadST with the thread settings*/
+); /*~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~\
+   ' Fun-04 TOC: alnThread
+   '  - Aligns queries in a block till there are no queries
+   '    left
+   \~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~*/
+
+/*--------------------------------------------------------\
+| Name: alnBatchThreads
+| Call:
+|   alnBatchThreads(
+|      refST, refPrintST, qryFILE, fqBl, settings, outFILE,
+|      outStr, scoreMtrxFileStr
+|   );
+| Use:
+|   - Aligns the queries in a fasta or fastq file to the
+|     reference with settings->threadsI threads. Queries
+|     are read in blocks and the output for each block is
+|     printed in the same order as the queries.
+| Input:
+|   - refST:
+|     o Reference sequence, already converted with
+|       seqToLookupIndex
+|   - refPrintST:
+|     o Reference with the sequence as letters
+|   - qryFILE:
+|     o fasta or fastq file with the queries
+|   - fqBl:
+|     o 1: qryFILE is a fastq file
+|     o 0: qryFILE is a fasta file
+|   - settings:
+|     o Settings for the alignments
+|   - outFILE:
+|     o File to print the alignments or scores to
+|   - outStr:
+|     o Output file name to print in alignment headers
+|   - scoreMtrxFileStr:
+|     o Scoring matrix file name for alignment headers
+| Output:
+|  - Prints:
+|    o The alignment or scores for each query to outFILE
+|  - Returns:
+|    o 0 for success
+|    o 1 if an alignment could not be printed
+|    o 2 if qryFILE had an invalid entry
+|    o 64 for memory errors
+\--------------------------------------------------------*/
+unsigned char alnBatchThreads(
+   struct seqStruct *refST,     /*Reference (lookup index)*/
+   struct seqStruct *refPrintST,/*Reference (letters)*/
+   FILE *qryFILE,               /*File with the queries*/
+   char fqBl,                   /*1: fastq file; 0: fasta*/
+   struct alnSet *settings,     /*Settings for alignment*/
+   FILE *outFILE,               /*File to print to*/
+   char *outStr,                /*Output name for header*/
+   char *scoreMtrxFileStr       /*Scoring matrix file*/
+); /*~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~\
+   ' Fun-05 TOC: alnBatchThreads
+   '  - Aligns the queries in a file with multiple threads
+   '  o fun-05 sec-01:
+   '    - Variable declerations
+   '  o fun-05 sec-02:
+   '    - Allocate memory and set up the threads
+   '  o fun-05 sec-03:
+   '    - Read, align, and print each block of queries
+   '  o fun-05 sec-04:
+   '    - Clean up
+   \~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~*/
+
+#endif
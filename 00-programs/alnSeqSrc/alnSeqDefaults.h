@@ -11,15 +11,34 @@
 #define ALNSEQDEFAULTS_H
 
 /*Gereral find co-infections settings*/
-#define defVersion 20231010  /*Version number for alnSeq*/
+#define defVersion 20261017  /*Version number for alnSeq*/
 
 // Aligment method being used
 #define defUseNeedle 1  /*do Needleman-Wunsch alignment*/
 #define defUseWater 0   /*Do a waterman smith alignment*/
 #define defUseHirsch 0  /*Use a Hirschberg alignment*/
 #define defUseMemWater 0 /*Use a memory efficent water*/
+#define defUseDiff 0 /*Score needle with the 8 bit kernel*/
 #define defJustScoresBl 0 /*memory efficent water only*/
    /*Only print out coordiantes and scores for memWater*/
+#define defBatchBl 0 /*1: Align every query in the file*/
+#define defThreads 1 /*Threads to use with -batch*/
+#define defHirschThreadCells (1 << 20)
+   /*Sub-problems with fewer cells (ref length * query
+   ` length) than this are aligned on one thread when
+   ` -threads splits a Hirschberg alignment
+   */
+#define defQryPerThread 64
+   /*Queries read in for each thread before the threads
+   ` are started. The output is held in memory till every
+   ` query in the block is aligned.
+   */
+#define defBand 0 /*Band size for needle/water; 0 is off*/
+#define defAdaptBandBl 0 /*1: Widen band when hit edge*/
+#define defAdaptBandStart 32
+   /*Starting band size for -adapt-band when -band is not
+   ` used
+   */
 
 /*Output file formating (only change defFormat)*/
 #define defExpandCig 0 /*Expanded cigar format flag*/
@@ -40,6 +59,11 @@
     /*Min score to keep an non-best alignment when doing
     ` an mutli-entry Waterman Smith alignment
     */
+#define defAltTop 0
+    /*Number of alternative alignments to keep (highest
+    ` scores) for -use-mem-water -query-ref-scan.
+    ` 0: print every alternative as soon as it is found
+    */
 
 
 /*Output settings*/
@@ -69,6 +93,18 @@
 
 #define defBestDir defInsDelSnp
 
+/*Vector instruction set for the striped scoring kernel
+`  (stripedAln.c). This is checked at run time with cpuid,
+`  so the same binary works on older cpus.
+*/
+#define defVectAuto 0   /*Use the best the cpu has*/
+#define defVectScalar 1 /*Do not use vectors*/
+#define defVectSSE2 2   /*Use SSE2 (or scalar)*/
+#define defVectAVX2 3   /*Use AVX2 (or SSE2)*/
+#define defVectAVX512 4 /*Use AVX512BW (or AVX2)*/
+
+#define defVectType defVectAuto
+
 /*Scoring variables*/
 #define defGapOpen -10  /*Penalty for starting indel*/
 
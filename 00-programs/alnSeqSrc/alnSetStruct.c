@@ -59,16 +59,24 @@ void initAlnSet(
    alnSetST->pFullAlnBl = defPAln;
    alnSetST->formatFlag = defFormat;
    alnSetST->justScoresBl = defJustScoresBl;
+   alnSetST->batchBl = defBatchBl;
+   alnSetST->threadsI = defThreads;
+   alnSetST->bandUL = defBand;
+   alnSetST->adaptBandBl = defAdaptBandBl;
 
    /*Choose the aligment style*/
    alnSetST->useNeedleBl = defUseNeedle;
    alnSetST->useWaterBl = defUseWater;
    alnSetST->useHirschBl = defUseHirsch;
    alnSetST->memWaterBl = defUseMemWater;
+   alnSetST->diffAlnBl = defUseDiff;
 
    /*Select direction to keep if everything is equal*/
    alnSetST->bestDirC = defBestDir;
 
+   /*Vector instruction set to score with*/
+   alnSetST->vectTypeC = defVectType;
+
    /*General alignment variables*/
    alnSetST->gapOpenI = defGapOpen;
    alnSetST->gapExtendI = defGapExtend;
@@ -76,6 +84,7 @@ void initAlnSet(
    /*Waterman specific variables*/
    alnSetST->refQueryScanBl = defQueryRefScan;
    alnSetST->minScoreL = defMinScore;
+   alnSetST->altTopUL = defAltTop;
   
    /*score matrix Initalize*/
    for(uint8_t colUC = 0; colUC < 26; ++colUC)
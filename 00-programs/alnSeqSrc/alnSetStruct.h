@@ -79,18 +79,43 @@ typedef struct alnSet
      /*1: print coordiantes and scores only
      ` 0: Print the alignment
      */
+   char batchBl;
+     /*1: Align every query in the query file
+     ` 0: Only align the first query
+     */
+   int threadsI;   /*Threads for batchBl or Hirschberg*/
+
+   /*Banded needle and water alignments*/
+   unsigned long bandUL;
+     /*Cells to keep on each side of the diagonal
+     ` 0: Do not band the alignment
+     */
+   char adaptBandBl;
+     /*1: Double the band till the alignment does not
+     `    touch the band edge
+     ` 0: Only use bandUL
+     */
 
    /*Preference for alignment algorithim used*/
    char useNeedleBl;
    char useWaterBl;
    char useHirschBl;
    char memWaterBl;
+   char diffAlnBl;
+     /*1: Score Needleman alignments with the difference
+     `    recurrence kernel (diffAln.c)
+     */
 
    /*Directional priorities (see alnSeqDefualts.h for
    ` options)
    */
    char bestDirC;
 
+   /*Vector instruction set for the scoring only steps
+   ` (see defVect* in alnSeqDefaults.h)
+   */
+   char vectTypeC;
+
    /*General alignment variables*/
    int32_t gapOpenI;    /*Penalty for starting an indel*/
    int32_t gapExtendI;  /* Penalty for extending an indel*/
@@ -118,6 +143,10 @@ typedef struct alnSet
      `  in the reference and query in a Waterman alignment
      */
    long minScoreL;  /*Min score to keep alignment*/
+   unsigned long altTopUL;
+     /*Number of best alternative alignments to print
+     ` (memWaterAltStream); 0 prints every alternative
+     */
 }alnSet;
 
 /*---------------------------------------------------------------------\
@@ -300,8 +300,14 @@ struct alnStruct * dirMatrixToAlnST(
   /*Variables for searching through the direction matrix*/
   #if !defined BYTEMATRIX
      uint8_t bitElmUC = 0;
+     unsigned long runUL = 0; /*Length of a deletion run*/
   #endif
 
+  /*Elements in one matrix row. Row aligned matrixes
+  ` (makeTwoBitMtrx) pad rows to whole limbs
+  */
+  long lenRowL = lenRefL + 1;
+
   /*>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>\
   ^ Fun-02 Sec-02:
   ^  - Assign memory and initalize variables
@@ -311,6 +317,11 @@ struct alnStruct * dirMatrixToAlnST(
   if(alnST == 0) return 0;
     /*alnST is already initilized for non pointer values*/
 
+  #if !defined BYTEMATRIX
+     if(dirMatrixST->lenRowUL != 0)
+        lenRowL = (long) dirMatrixST->lenRowUL;
+  #endif
+
   alnST->refAlnStr =
      calloc(refST->lenSeqUL + 1, sizeof(char));
 
@@ -353,14 +364,17 @@ struct alnStruct * dirMatrixToAlnST(
   *  - Find the cell with the best score
   \*******************************************************/
 
-  startIndexUL = (1 + scoreST->qryEndUL);
+  startIndexUL = (1 + scoreST->qryEndUL - qryST->offsetUL);
      /* 1 + to account for qryEndUL indel column*/
      /* Not accounting for qryEndUL being index 0, because
      `  bestScoreST.refEndUL as the reference position in
      `  the row*/
-  startIndexUL *= (1 + lenRefL);
-     /*1 + to account for deletion row*/
-  startIndexUL += 1 + scoreST->refEndUL;
+     /* - offsetUL, because the matrix only covers the
+     `  offsetUL to endAlnUL window
+     */
+  startIndexUL *= lenRowL;
+     /*lenRefL + 1 (+ padding) to account for indel column*/
+  startIndexUL += 1 + scoreST->refEndUL - refST->offsetUL;
      /* 1 + to account for refEndUL being index 0*/
   
 
@@ -406,12 +420,13 @@ struct alnStruct * dirMatrixToAlnST(
         --qryIndexL;
         ++(alnST->numInssUL);
         #if !defined BYTEMATRIX
-           twoBitMvBackXElm(dirMatrixST, lenRefL + 1);
+           twoBitMvBackXElm(dirMatrixST, lenRowL);
         #else
-           dirMatrixST -= (lenRefL + 1);
+           dirMatrixST -= lenRowL;
         #endif
           /* lenRefL (index 1) cells per row; need + 1 to
-          `  get to the cell above
+          `  get to the cell above. For row aligned two bit
+          `  matrixes this only moves the limb pointer.
           */
         break;
       /*Case: insertion (defMvIns)*/
@@ -437,9 +452,9 @@ struct alnStruct * dirMatrixToAlnST(
         } /*Else was a SNP*/
 
         #if !defined BYTEMATRIX
-           twoBitMvBackXElm(dirMatrixST, lenRefL + 2);
+           twoBitMvBackXElm(dirMatrixST, lenRowL + 1);
         #else
-           dirMatrixST -= (lenRefL + 2);
+           dirMatrixST -= (lenRowL + 1);
         #endif
           /*need + 2 to get to the next diagnol cell*/
         --qrySeqStr;
@@ -452,16 +467,29 @@ struct alnStruct * dirMatrixToAlnST(
 
       case defMvDel:
       /*Case: deletion (defMvDel)*/
-        *(alnST->refAlnStr + refIndexL) = defGapFlag;
-        ++(alnST->numDelsUL);
-
         #if !defined BYTEMATRIX
-           twoBitMvBackOneElm(dirMatrixST);
+           /*Deletions are next to each other in a row, so
+           ` the whole run can be found a limb at a time
+           */
+           runUL = twoBitRunBack(dirMatrixST);
+
+           memset(
+              alnST->refAlnStr + refIndexL - (long) runUL + 1,
+              defGapFlag,
+              runUL
+           );
+
+           alnST->numDelsUL += runUL;
+           alnST->lenAlnUL += runUL - 1;
+           refSeqStr -= runUL;
+           refIndexL -= (long) runUL;
         #else
+           *(alnST->refAlnStr + refIndexL) = defGapFlag;
+           ++(alnST->numDelsUL);
            --dirMatrixST;
+           --refSeqStr;
+           --refIndexL;
         #endif
-        --refSeqStr;
-        --refIndexL;
         break;
       /*Case: deletion (defMvDel)*/
     } /*Switch: check if bases is gap, match, or snp*/
@@ -0,0 +1,804 @@
+/*#########################################################
+# Name: bandAln
+# Use:
+#  - Holds functions for doing a banded Needleman Wunsch or
+#    Waterman Smith alignment. Only the cells in the band
+#    around the diagonal are scored and kept in the
+#    direction matrix.
+# Libraries:
+#   - "bandAln.h"
+#   o "memWater.h"
+#   o "waterman.h"
+#   o "stripedAln.h"
+#   o "generalAlnFun.h"
+#   o "alnStruct.h"
+#   o "alnMatrixStruct.h"
+#   o "twoBitArrays.h"
+#   o "scoresST.h"
+#   o "seqStruct.h"
+#   o "alnSetStruct.h"
+#   o "alnSeqDefaults.h"
+# C Standard libraries Used:
+#   o <limits.h>
+#   o <stdlib.h>
+#   o <stdint.h>
+#   o <stdio.h>
+#########################################################*/
+
+#include "bandAln.h"
+
+/*~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~\
+' SOF: Start Of Functions
+'  - fun-01 bandFillAln:
+'    o Fills the banded direction matrix for a Needleman
+'      or Waterman alignment
+'  - fun-02 bandDirToAlnST:
+'    o Builds an alignment array from a banded direction
+'      matrix
+'  - fun-03 bandAln:
+'    o Does a banded alignment, widening the band when the
+'      alignment hits the band edge or the score changes
+'      (-adapt-band)
+\~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~*/
+
+/*--------------------------------------------------------\
+| Output:
+|  - Returns:
+|    o alnMatrixStruct with the banded direction matrix
+|      and the best score
+|    o 0 for memory allocation errors
+|  - Modifies:
+|    o bandUL to hold the band size used
+\--------------------------------------------------------*/
+struct alnMatrixStruct * bandFillAln(
+    struct seqStruct *qryST, /*query sequence and data*/
+    struct seqStruct *refST,  /*ref sequence and data*/
+    unsigned long *bandUL,    /*Cells on each side*/
+    char waterBl,             /*1: Waterman; 0: Needle*/
+    struct alnSet *settings   /*Settings for alignment*/
+){ /*~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~\
+   ' Fun-01 TOC: bandFillAln
+   '  - Fills the banded direction matrix for a Needleman
+   '    or Waterman alignment
+   '  o fun-01 sec-01:
+   '    - Variable declerations
+   '  o fun-01 sec-02:
+   '    - Find the band size and allocate memory
+   '  o fun-01 sec-03:
+   '    - Fill in the indel row (no query bases)
+   '  o fun-01 sec-04:
+   '    - Fill the band with scores
+   '  o fun-01 sec-05:
+   '    - Clean up and return the matrix
+   \~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~*/
+
+   /*>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>\
+   ^ Fun-01 Sec-01:
+   ^  - Variable declerations
+   \<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<*/
+
+   char *refStartStr = refST->seqCStr + refST->offsetUL;
+   char *qryIterStr = qryST->seqCStr + qryST->offsetUL;
+
+   /*The + 1 is to account for index 0 of endAlnUL*/
+   unsigned long lenQryUL =
+       qryST->endAlnUL - qryST->offsetUL + 1;
+   unsigned long lenRefUL =
+       refST->endAlnUL - refST->offsetUL + 1;
+
+   unsigned long lenBandUL = 0; /*Cells in one row*/
+   unsigned long rowUL = 0;     /*Row (query base) on*/
+   unsigned long cellUL = 0;    /*Cell on in the row*/
+   unsigned long lastCellUL = 0;/*Same column; last row*/
+   long colL = 0;               /*Column (ref base) on*/
+   long startColL = 0;          /*First column in row*/
+   long lastStartColL = 0;      /*First column last row*/
+
+   /*Scoring variables*/
+   long insScoreL = 0;   /*Score for doing an insertion*/
+   long snpScoreL = 0;   /*Score for doing an match/snp*/
+   long delScoreL = 0;   /*Score for doing an deletion*/
+
+   /*Only the current and last row of the band is kept*/
+   long *scoreRowLP = 0;
+   long *lastScoreRowLP = 0;
+   long *swapLP = 0;
+
+   char *dirRowStr = 0;     /*Directions for this row*/
+   char *lastDirRowStr = 0; /*Directions for last row*/
+   char *swapStr = 0;
+
+   #if !defined BYTEMATRIX
+      struct twoBitAry *dirMatrix = 0;/*Direction matrix*/
+   #else
+      char *dirMatrix = 0;            /*Direction matrix*/
+      char *dirOnStr = 0;             /*Cell on*/
+   #endif
+
+   struct alnMatrixStruct *retMtxST = 0;
+
+   /*>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>\
+   ^ Fun-01 Sec-02:
+   ^  - Find the band size and allocate memory
+   \<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<*/
+
+   /*The center of the band moves lenRefUL / lenQryUL
+   ` columns each row. The band needs to be at least this
+   ` wide for each row to connect to the last row.
+   */
+   if(*bandUL < lenRefUL / lenQryUL + 1)
+      *bandUL = lenRefUL / lenQryUL + 1;
+
+   /*Past this point the band covers the full matrix*/
+   if(*bandUL > lenRefUL) *bandUL = lenRefUL;
+
+   lenBandUL = (*bandUL << 1) + 1;
+
+   retMtxST = calloc(1, sizeof(struct alnMatrixStruct));
+   if(retMtxST == 0) return 0;
+   initAlnMatrixST(retMtxST);
+
+   /*Both score rows are in one array*/
+   scoreRowLP = malloc((lenBandUL << 1) * sizeof(long));
+   if(scoreRowLP == 0) goto memErr;
+   lastScoreRowLP = scoreRowLP + lenBandUL;
+
+   dirRowStr = malloc((lenBandUL << 1) * sizeof(char));
+   if(dirRowStr == 0) goto memErr;
+   lastDirRowStr = dirRowStr + lenBandUL;
+
+   #if !defined BYTEMATRIX
+      dirMatrix =
+         makeTwoBit((lenQryUL + 1) * lenBandUL, 0);
+   #else
+      dirMatrix =
+         calloc((lenQryUL + 1) * lenBandUL, sizeof(char));
+      dirOnStr = dirMatrix;
+   #endif
+
+   if(dirMatrix == 0) goto memErr;
+   retMtxST->dirMatrixST = dirMatrix;
+
+   /*>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>\
+   ^ Fun-01 Sec-03:
+   ^  - Fill in the indel row (no query bases)
+   \<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<*/
+
+   startColL = bandStartCol(0, lenRefUL, lenQryUL,*bandUL);
+   colL = startColL;
+
+   for(cellUL = 0; cellUL < lenBandUL; ++cellUL)
+   { /*Loop: fill in the indel row*/
+      if(colL < 0 || colL > (long) lenRefUL)
+      { /*If this cell is outside of the matrix*/
+         scoreRowLP[cellUL] = defBandOutScore;
+         dirRowStr[cellUL] = defMvStop;
+      } /*If this cell is outside of the matrix*/
+
+      else if(colL == 0 || waterBl)
+      { /*Else if the top left cell or a Waterman*/
+         scoreRowLP[cellUL] = 0;
+         dirRowStr[cellUL] = defMvStop;
+      } /*Else if the top left cell or a Waterman*/
+
+      else
+      { /*Else this is a deletion*/
+         #ifdef NOGAPOPEN
+            scoreRowLP[cellUL] = colL * settings->gapExtendI;
+         #else
+            scoreRowLP[cellUL] =
+                 settings->gapOpenI
+               + (colL - 1) * settings->gapExtendI;
+         #endif
+
+         dirRowStr[cellUL] = defMvDel;
+      } /*Else this is a deletion*/
+
+      #if !defined BYTEMATRIX
+         changeTwoBitElm(dirMatrix, dirRowStr[cellUL]);
+         twoBitMvToNextElm(dirMatrix);
+      #else
+         *dirOnStr = dirRowStr[cellUL];
+         ++dirOnStr;
+      #endif
+
+      ++colL;
+   } /*Loop: fill in the indel row*/
+
+   /*>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>\
+   ^ Fun-01 Sec-04:
+   ^  - Fill the band with scores
+   ^  o fun-01 sec-04 sub-01:
+   ^    - Set up the next row
+   ^  o fun-01 sec-04 sub-02:
+   ^    - Handle cells outside the matrix & indel column
+   ^  o fun-01 sec-04 sub-03:
+   ^    - Find the snp, insertion, and deletion scores
+   ^  o fun-01 sec-04 sub-04:
+   ^    - Find the best score and direction
+   \<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<*/
+
+   for(rowUL = 1; rowUL <= lenQryUL; ++rowUL)
+   { /*Loop: fill in each row (query base)*/
+
+      /***************************************************\
+      * Fun-01 Sec-04 Sub-01:
+      *  - Set up the next row
+      \***************************************************/
+
+      swapLP = scoreRowLP;
+      scoreRowLP = lastScoreRowLP;
+      lastScoreRowLP = swapLP;
+
+      swapStr = dirRowStr;
+      dirRowStr = lastDirRowStr;
+      lastDirRowStr = swapStr;
+
+      lastStartColL = startColL;
+      startColL =
+         bandStartCol(rowUL, lenRefUL, lenQryUL, *bandUL);
+      colL = startColL;
+
+      /*The band only moves right, so the same column in
+      ` the last row is (startColL - lastStartColL) cells
+      ` ahead
+      */
+      lastCellUL = startColL - lastStartColL;
+
+      for(cellUL = 0; cellUL < lenBandUL; ++cellUL)
+      { /*Loop: fill in each cell in the band*/
+
+         /**************************************************\
+         * Fun-01 Sec-04 Sub-02:
+         *  - Handle cells outside the matrix & indel column
+         \**************************************************/
+
+         if(colL < 0 || colL > (long) lenRefUL)
+         { /*If this cell is outside of the matrix*/
+            scoreRowLP[cellUL] = defBandOutScore;
+            dirRowStr[cellUL] = defMvStop;
+            goto nextCell;
+         } /*If this cell is outside of the matrix*/
+
+         if(colL == 0)
+         { /*If on the indel column*/
+            if(waterBl)
+            { /*If doing a Waterman alignment*/
+               scoreRowLP[cellUL] = 0;
+               dirRowStr[cellUL] = defMvStop;
+               goto nextCell;
+            } /*If doing a Waterman alignment*/
+
+            #ifdef NOGAPOPEN
+               scoreRowLP[cellUL] =
+                  rowUL * settings->gapExtendI;
+            #else
+               scoreRowLP[cellUL] =
+                    settings->gapOpenI
+                  + (rowUL - 1) * settings->gapExtendI;
+            #endif
+
+            dirRowStr[cellUL] = defMvIns;
+            goto nextCell;
+         } /*If on the indel column*/
+
+         /**************************************************\
+         * Fun-01 Sec-04 Sub-03:
+         *  - Find the snp, insertion, and deletion scores
+         \**************************************************/
+
+         /*Cell up and to the left (last row)*/
+         if(lastCellUL > 0 && lastCellUL - 1 < lenBandUL)
+            snpScoreL =
+                 getBaseScore(
+                    qryIterStr,
+                    refStartStr + colL - 1,
+                    settings
+                 )
+               + lastScoreRowLP[lastCellUL - 1];
+         else
+            snpScoreL = defBandOutScore;
+
+         /*Cell above (last row)*/
+         if(lastCellUL < lenBandUL)
+         { /*If the cell above is in the band*/
+            #ifdef NOGAPOPEN
+               insScoreL =
+                    lastScoreRowLP[lastCellUL]
+                  + settings->gapExtendI;
+            #else
+               indelScore(
+                  insScoreL,
+                  lastDirRowStr[lastCellUL],
+                  lastScoreRowLP[lastCellUL],
+                  settings
+               );
+            #endif
+         } /*If the cell above is in the band*/
+
+         else
+            insScoreL = defBandOutScore;
+
+         /*Cell to the left (this row)*/
+         if(cellUL > 0)
+         { /*If the cell to the left is in the band*/
+            #ifdef NOGAPOPEN
+               delScoreL =
+                  scoreRowLP[cellUL-1] +settings->gapExtendI;
+            #else
+               indelScore(
+                  delScoreL,
+                  dirRowStr[cellUL - 1],
+                  scoreRowLP[cellUL - 1],
+                  settings
+               );
+            #endif
+         } /*If the cell to the left is in the band*/
+
+         else
+            delScoreL = defBandOutScore;
+
+         /**************************************************\
+         * Fun-01 Sec-04 Sub-04:
+         *  - Find the best score and direction
+         \**************************************************/
+
+         #if !defined BYTEMATRIX
+            if(waterBl)
+               waterTwoBitMaxScore(
+                  dirMatrix,
+                  settings,
+                  &insScoreL,
+                  &snpScoreL,
+                  &delScoreL,
+                  scoreRowLP + cellUL
+               );
+            else
+               twoBitMaxScore(
+                  dirMatrix,
+                  settings,
+                  &insScoreL,
+                  &snpScoreL,
+                  &delScoreL,
+                  scoreRowLP + cellUL
+               );
+
+            dirRowStr[cellUL] = getTwoBitElm(dirMatrix);
+         #else
+            if(waterBl)
+               waterByteMaxScore(
+                  dirOnStr,
+                  settings,
+                  &insScoreL,
+                  &snpScoreL,
+                  &delScoreL,
+                  scoreRowLP + cellUL
+               );
+            else
+               charMaxScore(
+                  dirOnStr,
+                  settings,
+                  &insScoreL,
+                  &snpScoreL,
+                  &delScoreL,
+                  scoreRowLP + cellUL
+               );
+
+            dirRowStr[cellUL] = *dirOnStr;
+         #endif
+
+         /*Same check as WatermanAln, so ties keep the
+         ` first cell found
+         */
+         if(
+               waterBl
+            && retMtxST->bestScoreST.scoreL<scoreRowLP[cellUL]
+         ){ /*If have a new best score*/
+            retMtxST->bestScoreST.scoreL =scoreRowLP[cellUL];
+
+            retMtxST->bestScoreST.refEndUL =
+               refST->offsetUL + colL - 1;
+            retMtxST->bestScoreST.qryEndUL =
+               qryST->offsetUL + rowUL - 1;
+         } /*If have a new best score*/
+
+         nextCell:
+
+         /*The cells outside the matrix and the indel
+         ` column were not set with the max functions
+         */
+         #if !defined BYTEMATRIX
+            changeTwoBitElm(dirMatrix, dirRowStr[cellUL]);
+            twoBitMvToNextElm(dirMatrix);
+         #else
+            *dirOnStr = dirRowStr[cellUL];
+            ++dirOnStr;
+         #endif
+
+         ++colL;
+         ++lastCellUL;
+      } /*Loop: fill in each cell in the band*/
+
+      ++qryIterStr;
+   } /*Loop: fill in each row (query base)*/
+
+   /*>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>\
+   ^ Fun-01 Sec-05:
+   ^  - Clean up and return the matrix
+   \<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<*/
+
+   if(!waterBl)
+   { /*If a Needleman, the best score is the last cell*/
+      /*The last cell is always the center of the band*/
+      retMtxST->bestScoreST.scoreL = scoreRowLP[*bandUL];
+      retMtxST->bestScoreST.refEndUL = refST->endAlnUL;
+      retMtxST->bestScoreST.qryEndUL = qryST->endAlnUL;
+   } /*If a Needleman, the best score is the last cell*/
+
+   /*The row arrays start at the lower address*/
+   if(scoreRowLP < lastScoreRowLP) free(scoreRowLP);
+   else free(lastScoreRowLP);
+
+   if(dirRowStr < lastDirRowStr) free(dirRowStr);
+   else free(lastDirRowStr);
+
+   return retMtxST;
+
+   memErr:
+
+   if(scoreRowLP != 0) free(scoreRowLP);
+   if(dirRowStr != 0) free(dirRowStr);
+   freeAlnMatrixST(retMtxST);
+   return 0;
+} /*bandFillAln*/
+
+/*--------------------------------------------------------\
+| Output:
+|  - Returns:
+|    o alnStruct with the alingment array
+|    o 0 for memory allocation errors
+|  - Modifies:
+|    o edgeBl to be 1 if the path touched the band edge
+|      or 0 if not
+\--------------------------------------------------------*/
+struct alnStruct * bandDirToAlnST(
+    struct seqStruct *refST,
+    struct seqStruct *qryST,
+    struct alnMatrixStruct *alnMtrxST,
+    unsigned long bandUL,
+    char *edgeBl
+){ /*~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~\
+   ' Fun-02 TOC: bandDirToAlnST
+   '  - Builds an alignment array from a banded direction
+   '    matrix
+   '  o fun-02 sec-01:
+   '    - Variable declerations
+   '  o fun-02 sec-02:
+   '    - Assign memory and initalize variables
+   '  o fun-02 sec-03:
+   '    - Build the alignment array
+   '  o fun-02 sec-04:
+   '    - Find the starting and ending softmasked regions
+   \~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~*/
+
+   /*>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>\
+   ^ Fun-02 Sec-01:
+   ^  - Variable declerations
+   \<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<*/
+
+   struct scoresStruct *scoreST = &alnMtrxST->bestScoreST;
+
+   unsigned long lenQryUL =
+       qryST->endAlnUL - qryST->offsetUL + 1;
+   unsigned long lenRefUL =
+       refST->endAlnUL - refST->offsetUL + 1;
+   unsigned long lenBandUL = (bandUL << 1) + 1;
+
+   /*Position in the matrix (row 0 & column 0 are indels)*/
+   unsigned long rowUL =
+      1 + scoreST->qryEndUL - qryST->offsetUL;
+   long colL = 1 + scoreST->refEndUL - refST->offsetUL;
+   long startColL = 0;
+   unsigned long cellUL = 0;
+
+   long qryIndexL = scoreST->qryEndUL;
+   long refIndexL = scoreST->refEndUL;
+   long lastRefMatchSnpL = 0;
+   long lastQryMatchSnpL = 0;
+   uint8_t dirUC = 0;
+
+   struct alnStruct *alnST = 0;
+
+   /*>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>\
+   ^ Fun-02 Sec-02:
+   ^  - Assign memory and initalize variables
+   \<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<*/
+
+   *edgeBl = 0;
+
+   alnST = calloc(1, sizeof(struct alnStruct));
+   if(alnST == 0) return 0;
+
+   alnST->refAlnStr =
+      calloc(refST->lenSeqUL + 1, sizeof(char));
+
+   if(alnST->refAlnStr == 0)
+   { /*If I had a memory error*/
+      freeAlnST(alnST, 1);
+      return 0;
+   } /*If I had a memory error*/
+
+   alnST->qryAlnStr =
+      calloc(qryST->lenSeqUL + 1, sizeof(char));
+
+   if(alnST->qryAlnStr == 0)
+   { /*If I had a memory error*/
+      freeAlnST(alnST, 1);
+      return 0;
+   } /*If I had a memory error*/
+
+   alnST->refLenUL = refST->lenSeqUL;
+   alnST->qryLenUL = qryST->lenSeqUL;
+
+   alnST->refEndAlnUL = scoreST->refEndUL;
+   alnST->qryEndAlnUL = scoreST->qryEndUL;
+
+   /*>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>\
+   ^ Fun-02 Sec-03:
+   ^  - Build the alignment array
+   \<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<*/
+
+   while(1)
+   { /*Loop: while I have more bases in the alignment*/
+      startColL =
+         bandStartCol(rowUL, lenRefUL, lenQryUL, bandUL);
+      cellUL = colL - startColL;
+
+      /*Check if the path is on the band edge. Edges that
+      ` are outside of the matrix do not count.
+      */
+      if(cellUL == 0 && startColL > 0) *edgeBl = 1;
+
+      else if(
+            cellUL == lenBandUL - 1
+         && colL < (long) lenRefUL
+      ) *edgeBl = 1;
+
+      #if !defined BYTEMATRIX
+         twoBitMvXElmFromStart(
+            alnMtrxST->dirMatrixST,
+            rowUL * lenBandUL + cellUL
+         );
+
+         dirUC = getTwoBitElm(alnMtrxST->dirMatrixST);
+      #else
+         dirUC =
+            alnMtrxST->dirMatrixST[rowUL*lenBandUL+cellUL];
+      #endif
+
+      switch(dirUC)
+      { /*Switch: check if bases is gap, match, or snp*/
+         case defMvStop: goto finishAlignment;
+
+         case defMvIns:
+         /*Case: insertion (defMvIns)*/
+            *(alnST->qryAlnStr + qryIndexL) = defGapFlag;
+            ++(alnST->numInssUL);
+
+            --qryIndexL;
+            --rowUL;
+            break;
+         /*Case: insertion (defMvIns)*/
+
+         case defMvSnp:
+         /*Case: match/snp (defMvSnp)*/
+            lastRefMatchSnpL = refIndexL;
+            lastQryMatchSnpL = qryIndexL;
+
+            if(
+               checkIfBasesMatch(
+                  qryST->seqCStr + qryIndexL,
+                  refST->seqCStr + refIndexL
+               )
+            ){ /*If the bases were a match*/
+               *(alnST->qryAlnStr+qryIndexL)=defMatchFlag;
+               *(alnST->refAlnStr+refIndexL)=defMatchFlag;
+               ++(alnST->numMatchesUL);
+            } /*If the bases were a match*/
+
+            else
+            { /*Else was a SNP*/
+               *(alnST->qryAlnStr + qryIndexL) = defSnpFlag;
+               *(alnST->refAlnStr + refIndexL) = defSnpFlag;
+               ++(alnST->numSnpsUL);
+            } /*Else was a SNP*/
+
+            --qryIndexL;
+            --refIndexL;
+            --rowUL;
+            --colL;
+            break;
+         /*Case: match/snp (defMvSnp)*/
+
+         case defMvDel:
+         /*Case: deletion (defMvDel)*/
+            *(alnST->refAlnStr + refIndexL) = defGapFlag;
+            ++(alnST->numDelsUL);
+
+            --refIndexL;
+            --colL;
+            break;
+         /*Case: deletion (defMvDel)*/
+      } /*Switch: check if bases is gap, match, or snp*/
+
+      ++(alnST->lenAlnUL);
+   } /*Loop: while I have more bases in the alignment*/
+
+   finishAlignment:
+
+   alnST->refStartAlnUL = lastRefMatchSnpL;
+   alnST->qryStartAlnUL = lastQryMatchSnpL;
+
+   /*>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>\
+   ^ Fun-02 Sec-04:
+   ^  - Find the starting and ending softmasked regions
+   \<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<*/
+
+   while(refIndexL >= 0)
+   { /*Loop: mask the starting reference bases*/
+      *(alnST->refAlnStr + refIndexL) = defSoftMaskFlag;
+      --refIndexL;
+   } /*Loop: mask the starting reference bases*/
+
+   while(qryIndexL >= 0)
+   { /*Loop: mask the starting query bases*/
+      *(alnST->qryAlnStr + qryIndexL) = defSoftMaskFlag;
+      --qryIndexL;
+   } /*Loop: mask the starting query bases*/
+
+   /*Calloc set all unaligned bases at the end to 0*/
+   refIndexL = alnST->refLenUL - 1;
+
+   while(refIndexL >= 0 && *(alnST->refAlnStr+refIndexL)==0)
+   { /*Loop: mask the ending reference bases*/
+      *(alnST->refAlnStr + refIndexL) = defSoftMaskFlag;
+      --refIndexL;
+   } /*Loop: mask the ending reference bases*/
+
+   qryIndexL = alnST->qryLenUL - 1;
+
+   while(qryIndexL >= 0 && *(alnST->qryAlnStr+qryIndexL)==0)
+   { /*Loop: mask the ending query bases*/
+      *(alnST->qryAlnStr + qryIndexL) = defSoftMaskFlag;
+      --qryIndexL;
+   } /*Loop: mask the ending query bases*/
+
+   *(alnST->refAlnStr + alnST->refLenUL) = defEndAlnFlag;
+   *(alnST->qryAlnStr + alnST->qryLenUL) = defEndAlnFlag;
+
+   return alnST;
+} /*bandDirToAlnST*/
+
+/*--------------------------------------------------------\
+| Output:
+|  - Returns:
+|    o alnStruct with the alingment array
+|    o 0 for memory allocation errors
+|  - Modifies:
+|    o scoreL to have the alignment score
+|    o offsetUL and endAlnUL in qryST and refST for
+|      Waterman alignments (aligned region)
+\--------------------------------------------------------*/
+struct alnStruct * bandAln(
+    struct seqStruct *qryST,
+    struct seqStruct *refST,
+    struct alnSet *settings,
+    struct stripedProf *profST,
+    long *scoreL
+){ /*~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~\
+   ' Fun-03 TOC: bandAln
+   '  - Does a banded alignment, widening the band when the
+   '    alignment hits the band edge or the score changes
+   '    (-adapt-band)
+   '  o fun-03 sec-01:
+   '    - Variable declerations
+   '  o fun-03 sec-02:
+   '    - Find the aligned region for Waterman alignments
+   '  o fun-03 sec-03:
+   '    - Align till the path is inside the band
+   \~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~*/
+
+   /*>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>\
+   ^ Fun-03 Sec-01:
+   ^  - Variable declerations
+   \<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<*/
+
+   unsigned long bandUL = settings->bandUL;
+   char waterBl = !settings->useNeedleBl;
+   char edgeBl = 0;
+   long lastScoreL = defBandOutScore; /*Last band score*/
+
+   struct scoresStruct *waterScoreST = 0;
+   struct alnMatrixStruct *alnMtrxST = 0;
+   struct alnStruct *alnST = 0;
+
+   if(bandUL == 0) bandUL = defAdaptBandStart;
+
+   /*>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>\
+   ^ Fun-03 Sec-02:
+   ^  - Find the aligned region for Waterman alignments
+   \<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<*/
+
+   /*The band is centered on the diagonal of the aligned
+   ` region. memWaterAln finds the region with the striped
+   ` kernel (or the scalar code if there are no vectors).
+   */
+   if(waterBl)
+   { /*If doing a Waterman alignment*/
+      waterScoreST =
+         memWaterAln(qryST, refST, settings, profST);
+
+      if(waterScoreST == 0) return 0;
+
+      if(waterScoreST->scoreL > 0)
+      { /*If memWaterAln found the aligned region*/
+         refST->offsetUL = waterScoreST->refStartUL;
+         refST->endAlnUL = waterScoreST->refEndUL;
+         qryST->offsetUL = waterScoreST->qryStartUL;
+         qryST->endAlnUL = waterScoreST->qryEndUL;
+      } /*If memWaterAln found the aligned region*/
+
+      freeScoresST(waterScoreST, 1); /*On heap*/
+      waterScoreST = 0;
+   } /*If doing a Waterman alignment*/
+
+   /*>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>\
+   ^ Fun-03 Sec-03:
+   ^  - Align till the path is inside the band
+   \<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<*/
+
+   while(1)
+   { /*Loop: align till the path is inside the band*/
+      alnMtrxST =
+         bandFillAln(qryST, refST, &bandUL, waterBl, settings);
+
+      if(alnMtrxST == 0) return 0;
+
+      alnST =
+         bandDirToAlnST(
+            refST,
+            qryST,
+            alnMtrxST,
+            bandUL,
+            &edgeBl
+         );
+
+      *scoreL = alnMtrxST->bestScoreST.scoreL;
+      freeAlnMatrixST(alnMtrxST);
+      alnMtrxST = 0;
+
+      if(alnST == 0) return 0;
+
+      if(!settings->adaptBandBl) break;
+
+      /*A path inside the band can still miss a better path
+      ` outside of it. So, the band is widened till the
+      ` path is off the edge and the score stops changing.
+      */
+      if(!edgeBl && *scoreL == lastScoreL) break;
+
+      /*bandFillAln caps the band at the reference length
+      ` (full matrix), so this always ends
+      */
+      if(bandUL >= refST->endAlnUL - refST->offsetUL + 1)
+         break;
+
+      lastScoreL = *scoreL;
+
+      freeAlnST(alnST, 1);
+      alnST = 0;
+      bandUL <<= 1;
+   } /*Loop: align till the path is inside the band*/
+
+   return alnST;
+} /*bandAln*/
@@ -0,0 +1,203 @@
+/*#########################################################
+# Name: bandAln
+# Use:
+#  - Holds functions for doing a banded Needleman Wunsch or
+#    Waterman Smith alignment. Only the cells in the band
+#    around the diagonal are scored and kept in the
+#    direction matrix.
+# Libraries:
+#   - "memWater.h"
+#   o "waterman.h"
+#   o "stripedAln.h"
+#   o "generalAlnFun.h"
+#   o "alnStruct.h"
+#   o "alnMatrixStruct.h"
+#   o "twoBitArrays.h"
+#   o "scoresST.h"
+#   o "seqStruct.h"
+#   o "alnSetStruct.h"
+#   o "alnSeqDefaults.h"
+# C Standard libraries Used:
+#   - <limits.h>
+#   o <stdlib.h>
+#   o <stdint.h>
+#   o <stdio.h>
+#########################################################*/
+
+/*~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~\
+' SOH: Start Of Header
+'  - macro-01 bandStartCol:
+'    o Finds the first column (reference base) in the band
+'      for a row (query base)
+'  - fun-01 bandFillAln:
+'    o Fills the banded direction matrix for a Needleman
+'      or Waterman alignment
+'  - fun-02 bandDirToAlnST:
+'    o Builds an alignment array from a banded direction
+'      matrix
+'  - fun-03 bandAln:
+'    o Does a banded alignment, widening the band when the
+'      alignment hits the band edge or the score changes
+'      (-adapt-band)
+\~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~*/
+
+#ifndef BANDALN_H
+#define BANDALN_H
+
+#include <limits.h>
+#include "memWater.h"
+
+/*Score for cells outside of the band. This is low enough
+` to never be picked, but will not overflow when the gap
+` penalties are added to it.
+*/
+#define defBandOutScore (LONG_MIN / 4)
+
+/*--------------------------------------------------------\
+| Name: bandStartCol (Macro-01:)
+| Use:
+|  - Finds the first column (reference base) in the band
+|    for a row (query base). The band is centered on the
+|    line from the top left to the bottom right cell.
+| Input:
+|  - rowUL:
+|    o Row to find the first column for (0 is the indel
+|      row)
+|  - lenRefUL:
+|    o Number of reference bases in the matrix
+|  - lenQryUL:
+|    o Number of query bases in the matrix
+|  - bandUL:
+|    o Number of cells on each side of the center
+| Output:
+|  - Returns:
+|    o First column in the band (as a long). This can be
+|      negative for the first rows.
+\--------------------------------------------------------*/
+#define bandStartCol(rowUL, lenRefUL, lenQryUL, bandUL)(\
+     (long) (((rowUL) * (lenRefUL)) / (lenQryUL)) \
+   - (long) (bandUL) \
+)
+
+/*--------------------------------------------------------\
+| Name: bandFillAln (Fun-01:)
+| Call:
+|   - alnMtrxST =
+|       bandFillAln(qryST, refST, bandUL, waterBl, set);
+| Use:
+|  - Fills the banded direction matrix for a Needleman
+|    or Waterman alignment. Each row of the direction
+|    matrix holds (2 * bandUL) + 1 cells, starting at
+|    bandStartCol().
+| Input:
+|  - qryST:
+|    o Query sequence to align. The offsetUL and endAlnUL
+|      values mark the region to align.
+|  - refST:
+|    o Reference sequence to align. The offsetUL and
+|      endAlnUL values mark the region to align.
+|  - bandUL:
+|    o Number of cells to keep on each side of the center
+|      diagonal. This is raised when it is to small to
+|      connect one row to the next.
+|  - waterBl:
+|    o 1: Waterman Smith (local) alignment
+|    o 0: Needleman Wunsch (global) alignment
+|  - settings:
+|    o Has the scoring matrix and gap penalties
+| Output:
+|  - Returns:
+|    o alnMatrixStruct with the banded direction matrix
+|      and the best score
+|    o 0 for memory allocation errors
+|  - Modifies:
+|    o bandUL to hold the band size used
+\--------------------------------------------------------*/
+struct alnMatrixStruct * bandFillAln(
+    struct seqStruct *qryST, /*query sequence and data*/
+    struct seqStruct *refST,  /*ref sequence and data*/
+    unsigned long *bandUL,    /*Cells on each side*/
+    char waterBl,             /*1: Waterman; 0: Needle*/
+    struct alnSet *settings   /*Settings for alignment*/
+);
+
+/*--------------------------------------------------------\
+| Name: bandDirToAlnST (Fun-02:)
+| Call:
+|   - alnST =
+|       bandDirToAlnST(refST,qryST,alnMtrxST,band,&edge);
+| Use:
+|  - Builds an alignment array from a banded direction
+|    matrix made by bandFillAln
+| Input:
+|  - refST:
+|    o Reference sequence used with bandFillAln
+|  - qryST:
+|    o Query sequence used with bandFillAln
+|  - alnMtrxST:
+|    o Has the banded direction matrix and best score
+|  - bandUL:
+|    o Band size returned by bandFillAln
+|  - edgeBl:
+|    o Set to 1 if the alignment touched the edge of the
+|      band (better alignment may be outside the band)
+| Output:
+|  - Returns:
+|    o alnStruct with the alingment array
+|    o 0 for memory allocation errors
+|  - Modifies:
+|    o edgeBl to be 1 if the path touched the band edge
+|      or 0 if not
+\--------------------------------------------------------*/
+struct alnStruct * bandDirToAlnST(
+    struct seqStruct *refST,
+    struct seqStruct *qryST,
+    struct alnMatrixStruct *alnMtrxST,
+    unsigned long bandUL,
+    char *edgeBl
+);
+
+/*--------------------------------------------------------\
+| Name: bandAln (Fun-03:)
+| Call:
+|   - alnST =
+|      bandAln(qryST, refST, settings, profST, &scoreL);
+| Use:
+|  - Does a banded Needleman (settings->useNeedleBl) or
+|    Waterman alignment. The Waterman alignment first
+|    finds the aligned region with memWaterAln.
+|  - If settings->adaptBandBl is 1, the band is doubled
+|    and the alignment redone till the path does not touch
+|    the band edge and the score is the same as the last
+|    band.
+| Input:
+|  - qryST:
+|    o Query sequence to align (as lookup indexes)
+|  - refST:
+|    o Reference sequence to align (as lookup indexes)
+|  - settings:
+|    o Has the band size (bandUL), adaptive band setting
+|      (adaptBandBl), and the scoring settings
+|  - profST:
+|    o Reference profile to reuse for the Waterman
+|      striped kernel (0 to use a temporary profile)
+|  - scoreL:
+|    o Will hold the score of the alignment
+| Output:
+|  - Returns:
+|    o alnStruct with the alingment array
+|    o 0 for memory allocation errors
+|  - Modifies:
+|    o scoreL to have the alignment score
+|    o offsetUL and endAlnUL in qryST and refST for
+|      Waterman alignments (aligned region)
+\--------------------------------------------------------*/
+struct alnStruct * bandAln(
+    struct seqStruct *qryST,
+    struct seqStruct *refST,
+    struct alnSet *settings,
+    struct stripedProf *profST,
+    long *scoreL
+);
+
+#endif
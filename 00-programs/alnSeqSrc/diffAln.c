@@ -0,0 +1,485 @@
+/*#########################################################
+# Name: diffAln
+# Use:
+#  - Holds a difference recurrence (Suzuki and Kasahara)
+#    scoring kernel for Needleman alignments. Only the
+#    score is found.
+# Libraries:
+#  - "diffAln.h"
+#  - "diffAlnKern.h" (included once per kernel)
+#  o "stripedAln.h"
+#  o "alnSetStruct.h"
+#  o "scoresST.h"
+#  o "alnSeqDefaults.h"
+#  o "cStrToNumberFun.h"
+#  o "twoBitArrays.h"
+#  o "seqStruct.h"
+# C Standard Libraries:
+#  - <stdlib.h>
+#  - <immintrin.h> (x86 only)
+#  o <stdint.h>
+#  o <string.h>
+#  o <stdio.h>
+#########################################################*/
+
+#include "diffAln.h"
+
+#include <stdlib.h>
+
+/*~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~\
+' SOF: Start Of Functions
+'  o sec-01:
+'    - Build the vector kernels (x86 only)
+'  o fun-01 diffNeedleScore:
+'    - Finds the score of a Needleman alignment with the
+'      difference recurrence kernel
+\~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~*/
+
+/*>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>\
+^ Sec-01:
+^  - Build the vector kernels (x86 only)
+^  o sec-01 sub-01:
+^    - SSE2 kernel
+^  o sec-01 sub-02:
+^    - AVX2 kernel
+^  o sec-01 sub-03:
+^    - AVX512 kernel
+\<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<*/
+
+#if defined __GNUC__ && (defined __x86_64__ || defined __i386__)
+   #define DIFFX86
+
+   #include <immintrin.h>
+
+   /******************************************************\
+   * Sec-01 Sub-01:
+   *  - SSE2 kernel
+   \******************************************************/
+
+   /*SSE2 only has an unsigned int8 max, so flip the sign
+   ` bit, use the unsigned max, and flip it back
+   */
+   #define diffSSE2MaxI8(vect1, vect2) \
+      _mm_xor_si128( \
+         _mm_max_epu8( \
+            _mm_xor_si128(vect1, _mm_set1_epi8(-128)), \
+            _mm_xor_si128(vect2, _mm_set1_epi8(-128)) \
+         ), \
+         _mm_set1_epi8(-128) \
+      )
+
+   #define diffSSE2MinI8(vect1, vect2) \
+      _mm_xor_si128( \
+         _mm_min_epu8( \
+            _mm_xor_si128(vect1, _mm_set1_epi8(-128)), \
+            _mm_xor_si128(vect2, _mm_set1_epi8(-128)) \
+         ), \
+         _mm_set1_epi8(-128) \
+      )
+
+   #define kernName diffSSE2I8
+   #define kernTarget __attribute__((target("sse2")))
+   #define vectT __m128i
+   #define defLanes 16
+   #define vLoad(ptr) _mm_loadu_si128((__m128i *) (ptr))
+   #define vStore(ptr, vect) \
+      _mm_storeu_si128((__m128i *) (ptr), (vect))
+   #define vStoreN(ptr, vect, numUI){ \
+      int8_t tmpAry[16]; \
+      _mm_storeu_si128((__m128i *) tmpAry, (vect)); \
+      memcpy((ptr), tmpAry, (numUI)); \
+   }
+   #define vSet1(val) _mm_set1_epi8(val)
+   #define vAdd(vect1, vect2) _mm_adds_epi8(vect1, vect2)
+   #define vSub(vect1, vect2) _mm_subs_epi8(vect1, vect2)
+   #define vMax(vect1, vect2) diffSSE2MaxI8(vect1, vect2)
+   #define vMin(vect1, vect2) diffSSE2MinI8(vect1, vect2)
+   #define vAnd(vect1, vect2) _mm_and_si128(vect1, vect2)
+   #define vOr(vect1, vect2) _mm_or_si128(vect1, vect2)
+   #define vAndNot(vect1, vect2) _mm_andnot_si128(vect1,vect2)
+   #define vCmpEq(vect1, vect2) _mm_cmpeq_epi8(vect1, vect2)
+   #define vEqSel(vect1, vect2, eqVect, neVect) \
+      _mm_or_si128( \
+         _mm_and_si128( \
+            _mm_cmpeq_epi8(vect1, vect2), \
+            eqVect \
+         ), \
+         _mm_andnot_si128( \
+            _mm_cmpeq_epi8(vect1, vect2), \
+            neVect \
+         ) \
+      )
+   #include "diffAlnKern.h"
+
+   /******************************************************\
+   * Sec-01 Sub-02:
+   *  - AVX2 kernel
+   \******************************************************/
+
+   #define kernName diffAVX2I8
+   #define kernTarget __attribute__((target("avx2")))
+   #define vectT __m256i
+   #define defLanes 32
+   #define vLoad(ptr) _mm256_loadu_si256((__m256i *) (ptr))
+   #define vStore(ptr, vect) \
+      _mm256_storeu_si256((__m256i *) (ptr), (vect))
+   #define vStoreN(ptr, vect, numUI){ \
+      int8_t tmpAry[32]; \
+      _mm256_storeu_si256((__m256i *) tmpAry, (vect)); \
+      memcpy((ptr), tmpAry, (numUI)); \
+   }
+   #define vSet1(val) _mm256_set1_epi8(val)
+   #define vAdd(vect1, vect2) _mm256_adds_epi8(vect1,vect2)
+   #define vSub(vect1, vect2) _mm256_subs_epi8(vect1,vect2)
+   #define vMax(vect1, vect2) _mm256_max_epi8(vect1, vect2)
+   #define vMin(vect1, vect2) _mm256_min_epi8(vect1, vect2)
+   #define vAnd(vect1, vect2) _mm256_and_si256(vect1, vect2)
+   #define vOr(vect1, vect2) _mm256_or_si256(vect1, vect2)
+   #define vAndNot(vect1, vect2) \
+      _mm256_andnot_si256(vect1, vect2)
+   #define vCmpEq(vect1, vect2) _mm256_cmpeq_epi8(vect1,vect2)
+   #define vEqSel(vect1, vect2, eqVect, neVect) \
+      _mm256_blendv_epi8( \
+         neVect, \
+         eqVect, \
+         _mm256_cmpeq_epi8(vect1, vect2) \
+      )
+   #include "diffAlnKern.h"
+
+   /******************************************************\
+   * Sec-01 Sub-03:
+   *  - AVX512 kernel
+   \******************************************************/
+
+   #define kernName diffAVX512I8
+   #define kernTarget \
+      __attribute__((target("avx512f,avx512bw")))
+   #define vectT __m512i
+   #define defLanes 64
+   #define vLoad(ptr) _mm512_loadu_si512((void *) (ptr))
+   #define vStore(ptr, vect) \
+      _mm512_storeu_si512((void *) (ptr), (vect))
+   #define vStoreN(ptr, vect, numUI) \
+      _mm512_mask_storeu_epi8( \
+         (void *) (ptr), \
+         (((__mmask64) 1) << (numUI)) - 1, \
+         vect \
+      )
+   #define vSet1(val) _mm512_set1_epi8(val)
+   #define vAdd(vect1, vect2) _mm512_adds_epi8(vect1,vect2)
+   #define vSub(vect1, vect2) _mm512_subs_epi8(vect1,vect2)
+   #define vMax(vect1, vect2) _mm512_max_epi8(vect1, vect2)
+   #define vMin(vect1, vect2) _mm512_min_epi8(vect1, vect2)
+   #define vAnd(vect1, vect2) _mm512_and_si512(vect1, vect2)
+   #define vOr(vect1, vect2) _mm512_or_si512(vect1, vect2)
+   #define vAndNot(vect1, vect2) \
+      _mm512_andnot_si512(vect1, vect2)
+   #define vCmpEq(vect1, vect2) \
+      _mm512_movm_epi8(_mm512_cmpeq_epi8_mask(vect1, vect2))
+   #define vEqSel(vect1, vect2, eqVect, neVect) \
+      _mm512_mask_blend_epi8( \
+         _mm512_cmpeq_epi8_mask(vect1, vect2), \
+         neVect, \
+         eqVect \
+      )
+   #include "diffAlnKern.h"
+#endif /*If on an x86 cpu*/
+
+/*--------------------------------------------------------\
+| Output:
+|  - Modifies:
+|    o retScoreST to have the score of the Needleman
+|      alignment and the start/end coordinates
+|  - Returns:
+|    o 0 for success
+|    o 1 if there is no vector support or the scores
+|      do not fit in int8 elements (use NeedlemanAln)
+|    o 64 for memory errors
+\--------------------------------------------------------*/
+unsigned char diffNeedleScore(
+   struct seqStruct *qryST,   /*Query; offsetUL-endAlnUL*/
+   struct seqStruct *refST,   /*Ref; offsetUL-endAlnUL*/
+   struct alnSet *settings,   /*Settings for alignment*/
+   struct scoresStruct *retScoreST /*Holds the score*/
+){ /*~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~\
+   ' Fun-01 TOC: diffNeedleScore
+   '  - Finds the score of a Needleman alignment with the
+   '    difference recurrence kernel
+   '  o fun-01 sec-01:
+   '    - Variable declerations
+   '  o fun-01 sec-02:
+   '    - Find the gap penalties and check the score range
+   '  o fun-01 sec-03:
+   '    - Convert the sequences and build the score table
+   '  o fun-01 sec-04:
+   '    - Run the kernel
+   \~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~*/
+
+   /*>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>\
+   ^ Fun-01 Sec-01:
+   ^  - Variable declerations
+   \<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<*/
+
+   unsigned char vectTypeUC = 0;
+
+   char *refStr = refST->seqCStr + refST->offsetUL;
+   char *qryStr = qryST->seqCStr + qryST->offsetUL;
+   unsigned long lenRowUL = 0; /*Elements in one row*/
+   unsigned long indexUL = 0;
+
+   uint32_t refBaseUI = 0;  /*Bit for each ref base seen*/
+   uint32_t qryBaseUI = 0;  /*Bit for each qry base seen*/
+   unsigned char qryUC = 0;
+   unsigned char refUC = 0;
+   char simpleBl = 1;       /*1: scores are match/snp*/
+   char matchSetBl = 0;     /*1: matchC was set*/
+   char snpSetBl = 0;       /*1: snpC was set*/
+
+   long openL = (long) settings->gapOpenI;
+   long extendL = (long) settings->gapExtendI;
+   long scoreL = 0;
+   long maxAbsL = 0;        /*Largest absolute score*/
+   long maxGapL = 0;        /*Largest absolute gap score*/
+   char dirC = settings->bestDirC; /*Tie order*/
+
+   int8_t *memAry = 0;
+   struct diffMem memST;
+
+   /*>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>\
+   ^ Fun-01 Sec-02:
+   ^  - Find the gap penalties and check the score range
+   \<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<*/
+
+   /*The kernel gives the same score as NeedlemanAln, so
+   ` -use-diff does not need -vect-auto to turn vectors on
+   */
+   if(settings->vectTypeC == defVectScalar)
+      vectTypeUC = getVectType(defVectAuto);
+   else
+      vectTypeUC =
+         getVectType((unsigned char) settings->vectTypeC);
+
+   #ifndef DIFFX86
+      vectTypeUC = defVectScalar;
+   #endif
+
+   if(vectTypeUC == defVectScalar) return 1;
+
+   #ifdef NOGAPOPEN
+      /*Every gap is scored as an extension*/
+      openL = extendL;
+   #endif
+
+   /*Same tie order as charMaxScore*/
+   #if defined SNPINSDEL
+      dirC = defSnpInsDel;
+   #elif defined SNPDELINS
+      dirC = defSnpDelIns;
+   #elif defined INSSNPDEL
+      dirC = defInsSnpDel;
+   #elif defined INSDELSNP
+      dirC = defInsDelSnp;
+   #elif defined DELSNPINS
+      dirC = defDelSnpIns;
+   #elif defined DELINSSNP
+      dirC = defDelInsSnp;
+   #endif
+
+   memST.insTieC =
+      -(int8_t) (
+            dirC == defInsSnpDel
+         || dirC == defInsDelSnp
+         || dirC == defDelInsSnp
+      );
+
+   memST.delTieC =
+      -(int8_t) (
+            dirC == defDelSnpIns
+         || dirC == defDelInsSnp
+         || dirC == defInsDelSnp
+      );
+
+   maxGapL = openL < 0 ? -openL : openL;
+   if(extendL > maxGapL) maxGapL = extendL;
+   if(-extendL > maxGapL) maxGapL = -extendL;
+
+   memST.lenRefUL = refST->endAlnUL - refST->offsetUL + 1;
+   memST.lenQryUL = qryST->endAlnUL - qryST->offsetUL + 1;
+   memST.openC = (int8_t) 0;
+   memST.extendC = (int8_t) 0;
+   memST.matchC = 0;
+   memST.snpC = 0;
+   memST.overflowC = 0;
+
+   /*>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>\
+   ^ Fun-01 Sec-03:
+   ^  - Convert the sequences and build the score table
+   ^  o fun-01 sec-03 sub-01:
+   ^    - Allocate memory
+   ^  o fun-01 sec-03 sub-02:
+   ^    - Convert the sequences
+   ^  o fun-01 sec-03 sub-03:
+   ^    - Build the score table
+   ^  o fun-01 sec-03 sub-04:
+   ^    - Check if the differences fit in int8
+   \<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<*/
+
+   /******************************************************\
+   * Fun-01 Sec-03 Sub-01:
+   *  - Allocate memory
+   \******************************************************/
+
+   lenRowUL = memST.lenRefUL + 1 + defDiffPad;
+
+   /*ref, u, v, f, and s rows, the query, and table*/
+   memAry =
+      calloc(
+           5 * lenRowUL
+         + memST.lenQryUL + defDiffPad
+         + 1024,
+         sizeof(int8_t)
+      );
+
+   if(memAry == 0) return 64;
+
+   memST.refAry = memAry;
+   memST.uAry = memST.refAry + lenRowUL;
+   memST.vAry = memST.uAry + lenRowUL;
+   memST.fAry = memST.vAry + lenRowUL;
+   memST.sAry = memST.fAry + lenRowUL;
+   memST.tblAry = memST.sAry + lenRowUL;
+   memST.qryAry = memST.tblAry + 1024;
+
+   /******************************************************\
+   * Fun-01 Sec-03 Sub-02:
+   *  - Convert the sequences
+   \******************************************************/
+
+   for(indexUL = 0; indexUL < memST.lenRefUL; ++indexUL)
+   { /*Loop: copy the reference bases*/
+      refUC = (uint8_t) refStr[indexUL] & defClearNonAlph;
+      memST.refAry[indexUL + 1] = (int8_t) refUC;
+      refBaseUI |= ((uint32_t) 1) << refUC;
+   } /*Loop: copy the reference bases*/
+
+   for(indexUL = 0; indexUL < memST.lenQryUL; ++indexUL)
+   { /*Loop: copy the query bases (reversed)*/
+      qryUC =
+           (uint8_t) qryStr[memST.lenQryUL - 1 - indexUL]
+         & defClearNonAlph;
+
+      memST.qryAry[indexUL] = (int8_t) qryUC;
+      qryBaseUI |= ((uint32_t) 1) << qryUC;
+   } /*Loop: copy the query bases (reversed)*/
+
+   /******************************************************\
+   * Fun-01 Sec-03 Sub-03:
+   *  - Build the score table
+   \******************************************************/
+
+   for(qryUC = 0; qryUC < 32; ++qryUC)
+   { /*Loop: through all query bases*/
+      if(! (qryBaseUI & (((uint32_t) 1) << qryUC)))
+         continue; /*Base is not in the query*/
+
+      for(refUC = 0; refUC < 32; ++refUC)
+      { /*Loop: through all reference bases*/
+         if(! (refBaseUI & (((uint32_t) 1) << refUC)))
+            continue; /*Base is not in the reference*/
+
+         if(
+               ! stripedValidIndex(qryUC)
+            || ! stripedValidIndex(refUC)
+         ) scoreL = 0;
+
+         else
+            scoreL =
+               getBaseScore(
+                  (char *) &qryUC,
+                  (char *) &refUC,
+                  settings
+               );
+
+         if(scoreL > maxAbsL) maxAbsL = scoreL;
+         if(-scoreL > maxAbsL) maxAbsL = -scoreL;
+
+         memST.tblAry[(qryUC << 5) | refUC] =
+            (int8_t) scoreL;
+
+         /*Check if the scores are only matches and snps*/
+         if(qryUC == refUC)
+         { /*If this is a match*/
+            if(matchSetBl && scoreL != memST.matchC)
+               simpleBl = 0;
+
+            memST.matchC = (int8_t) scoreL;
+            matchSetBl = 1;
+         } /*If this is a match*/
+
+         else
+         { /*Else this is a snp*/
+            if(snpSetBl && scoreL != memST.snpC)
+               simpleBl = 0;
+
+            memST.snpC = (int8_t) scoreL;
+            snpSetBl = 1;
+         } /*Else this is a snp*/
+      } /*Loop: through all reference bases*/
+   } /*Loop: through all query bases*/
+
+   /*A vector compare is faster than a table look up*/
+   if(simpleBl) memST.tblAry = 0;
+
+   /******************************************************\
+   * Fun-01 Sec-03 Sub-04:
+   *  - Check if the differences fit in int8
+   \******************************************************/
+
+   if(3 * maxGapL + maxAbsL > defDiffMaxRange)
+   { /*If the scores could saturate int8*/
+      free(memAry);
+      return 1;
+   } /*If the scores could saturate int8*/
+
+   memST.openC = (int8_t) openL;
+   memST.extendC = (int8_t) extendL;
+
+   /*A difference plus a gap penalty must fit in int8*/
+   memST.limC = (int8_t) (defDiffMaxRange - maxGapL);
+
+   /*>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>\
+   ^ Fun-01 Sec-04:
+   ^  - Run the kernel
+   \<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<*/
+
+   #ifdef DIFFX86
+      switch(vectTypeUC)
+      { /*Switch: find the kernel to use*/
+         case defVectAVX512:
+            scoreL = diffAVX512I8(&memST);
+            break;
+
+         case defVectAVX2:
+            scoreL = diffAVX2I8(&memST);
+            break;
+
+         default:
+            scoreL = diffSSE2I8(&memST);
+            break;
+      } /*Switch: find the kernel to use*/
+   #endif
+
+   free(memAry);
+
+   if(memST.overflowC) return 1; /*Gap went past int8*/
+
+   retScoreST->scoreL = scoreL;
+
+   /*A global alignment always covers both windows*/
+   retScoreST->refStartUL = refST->offsetUL;
+   retScoreST->qryStartUL = qryST->offsetUL;
+   retScoreST->refEndUL = refST->endAlnUL;
+   retScoreST->qryEndUL = qryST->endAlnUL;
+
+   return 0;
+} /*diffNeedleScore*/
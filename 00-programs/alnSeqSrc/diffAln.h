@@ -0,0 +1,120 @@
+/*#########################################################
+# Name: diffAln
+# Use:
+#  - Holds a difference recurrence (Suzuki and Kasahara)
+#    scoring kernel for Needleman alignments. Each cell
+#    only keeps the small differences between it and its
+#    neighbors, so the scores fit in int8 elements (16,
+#    32, or 64 cells per SSE2, AVX2, or AVX512 vector).
+#  - The cells are scored by anti-diagonal, so there is no
+#    lazy F loop like the striped kernel has.
+#  - Only finds the score. It does not build a direction
+#    matrix.
+#  - Uses the same gap model as NeedlemanAln (a gap after
+#    a snp/match is a gap open, after anything else it is
+#    an extension) and the same tie order (bestDirC), so
+#    the scores match the scalar Needleman.
+# Libraries:
+#  - "stripedAln.h"
+#  o "alnSetStruct.h"
+#  o "scoresST.h"
+#  o "alnSeqDefaults.h"
+#  o "cStrToNumberFun.h"
+#  o "twoBitArrays.h"
+#  o "seqStruct.h"
+# C Standard Libraries:
+#  o <stdint.h>
+#  o <string.h>
+#  o <stdlib.h>
+#  o <stdio.h>
+#########################################################*/
+
+/*~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~\
+' SOH: Start Of Header
+'  o st-01 diffMem:
+'    - Holds the converted sequences and difference rows
+'      for the difference recurrence kernel
+'  o fun-01 diffNeedleScore:
+'    - Finds the score of a Needleman alignment with the
+'      difference recurrence kernel
+\~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~*/
+
+#ifndef DIFFALN_H
+#define DIFFALN_H
+
+#include "stripedAln.h"
+
+/*Largest value the differences and gap penalties can
+` reach before an int8 could saturate
+` (3 * largest gap penalty + largest score). The kernel
+` also checks every difference, since a long gap can go
+` past this.
+*/
+#define defDiffMaxRange 126
+
+/*Extra elements at the end of each row, so that a full
+` vector can always be loaded (one AVX512 vector)
+*/
+#define defDiffPad 64
+
+/*--------------------------------------------------------\
+| ST-01: diffMem
+|  - Holds the converted sequences and difference rows
+|    for the difference recurrence kernel
+|  - The rows are indexed by reference base (index 1).
+|    Element 0 is the gap column.
+\--------------------------------------------------------*/
+typedef struct diffMem
+{ /*diffMem*/
+   int8_t *refAry;   /*Reference bases (index 1)*/
+   int8_t *qryAry;   /*Query bases (reversed, index 0)*/
+   int8_t *uAry;     /*Cell score - score of cell above*/
+   int8_t *vAry;     /*Cell score - score of left cell*/
+   int8_t *fAry;     /*-1: cell came from a snp/match*/
+   int8_t *sAry;     /*Scores for one anti-diagonal*/
+   int8_t *tblAry;   /*32 x 32 scores; 0 for match/snp*/
+
+   unsigned long lenRefUL;
+   unsigned long lenQryUL;
+
+   int8_t matchC;    /*Match score (no tblAry)*/
+   int8_t snpC;      /*Mismatch score (no tblAry)*/
+   int8_t openC;     /*Gap open penalty*/
+   int8_t extendC;   /*Gap extension penalty*/
+   int8_t insTieC;   /*-1: insertions beat snps on ties*/
+   int8_t delTieC;   /*-1: deletions beat snps on ties*/
+   int8_t limC;      /*Largest difference that is safe*/
+   char overflowC;   /*Set to 1 if limC was passed*/
+}diffMem;
+
+/*--------------------------------------------------------\
+| Output:
+|  - Modifies:
+|    o retScoreST to have the score of the Needleman
+|      alignment and the start/end coordinates
+|  - Returns:
+|    o 0 for success
+|    o 1 if there is no vector support or the scores
+|      do not fit in int8 elements (use NeedlemanAln)
+|    o 64 for memory errors
+\--------------------------------------------------------*/
+unsigned char diffNeedleScore(
+   struct seqStruct *qryST,   /*Query; offsetUL-endAlnUL*/
+   struct seqStruct *refST,   /*Ref; offsetUL-endAlnUL*/
+   struct alnSet *settings,   /*Settings for alignment*/
+   struct scoresStruct *retScoreST /*Holds the score*/
+); /*~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~\
+   ' Fun-01 TOC: diffNeedleScore
+   '  - Finds the score of a Needleman alignment with the
+   '    difference recurrence kernel
+   '  o fun-01 sec-01:
+   '    - Variable declerations
+   '  o fun-01 sec-02:
+   '    - Find the gap penalties and check the score range
+   '  o fun-01 sec-03:
+   '    - Convert the sequences and build the score table
+   '  o fun-01 sec-04:
+   '    - Run the kernel
+   \~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~*/
+
+#endif
@@ -0,0 +1,344 @@
+/*#########################################################
+# Name: diffAlnKern
+# Use:
+#  - Template for the difference recurrence (Suzuki and
+#    Kasahara) 8 bit scoring kernel. diffAln.c includes
+#    this file once for each instruction set.
+#  - There is no include guard on purpose. Every macro
+#    below is undefined at the end of this file.
+# Macros the includer must define:
+#  - kernName: Name of the function to make
+#  - kernTarget: __attribute__((target("..."))) for cpu
+#  - vectT: Vector type (__m128i, __m256i, __m512i)
+#  - defLanes: Number of int8 elements in a vector
+#  - vLoad(ptr): Unaligned vector load
+#  - vStore(ptr, vect): Unaligned vector store
+#  - vStoreN(ptr, vect, numUI): Store the first numUI
+#    elements of vect (numUI < defLanes)
+#  - vSet1(val): Set all elements to val
+#  - vAdd(vect1, vect2): Saturating int8 add
+#  - vSub(vect1, vect2): Saturating int8 subtract
+#  - vMax(vect1, vect2): int8 element maximum
+#  - vMin(vect1, vect2): int8 element minimum
+#  - vAnd(vect1, vect2): Bitwise and
+#  - vOr(vect1, vect2): Bitwise or
+#  - vAndNot(vect1, vect2): ~vect1 & vect2
+#  - vCmpEq(vect1, vect2): -1 where vect1 and vect2 are
+#    equal, else 0
+#  - vEqSel(vect1, vect2, eqVect, neVect): eqVect where
+#    vect1 and vect2 are equal, else neVect
+# Libraries:
+#  - "diffAln.h" (by includer)
+#########################################################*/
+
+/*~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~\
+' SOF: Start Of Functions
+'  o fun-01 kernName:
+'    - Finds the score of a global alignment with the
+'      difference recurrence
+\~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~*/
+
+/*--------------------------------------------------------\
+| Output:
+|  - Returns:
+|    o Score of the global alignment
+|  - Modifies:
+|    o The difference rows in memST (used as scratch)
+|    o memST->overflowC to 1 if a difference left the
+|      range int8 can hold (score is not valid)
+\--------------------------------------------------------*/
+static kernTarget long kernName(
+   struct diffMem *memST    /*Sequences and scratch rows*/
+){ /*~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~\
+   ' Fun-01 TOC: kernName
+   '  - Finds the score of a global alignment with the
+   '    difference recurrence
+   '  o fun-01 sec-01:
+   '    - Variable declerations
+   '  o fun-01 sec-02:
+   '    - Set up the gap row and gap column
+   '  o fun-01 sec-03:
+   '    - Score each anti-diagonal
+   \~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~*/
+
+   /*>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>\
+   ^ Fun-01 Sec-01:
+   ^  - Variable declerations
+   \<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<*/
+
+   unsigned long lenRefUL = memST->lenRefUL;
+   unsigned long lenQryUL = memST->lenQryUL;
+   unsigned long diagUL = 0;   /*Anti-diagonal on*/
+   unsigned long startUL = 0;  /*First ref base in diag*/
+   unsigned long endUL = 0;    /*Last ref base in diag*/
+   unsigned long colUL = 0;    /*First ref base in vector*/
+   unsigned long numVectUL = 0;
+   unsigned long qryOffUL = 0; /*Query base for colUL 0*/
+   unsigned int numUI = 0;     /*Elements left in a diag*/
+   unsigned int indexUI = 0;
+
+   int8_t *refAry = memST->refAry;
+   int8_t *qryAry = memST->qryAry;
+   int8_t *uAry = memST->uAry;   /*Cell minus cell above*/
+   int8_t *vAry = memST->vAry;   /*Cell minus left cell*/
+   int8_t *fAry = memST->fAry;   /*-1: cell came from snp*/
+   int8_t *sAry = memST->sAry;   /*Scores for a diagonal*/
+   int8_t *tblAry = memST->tblAry;
+
+   int8_t openC = memST->openC;     /*Gap open penalty*/
+   int8_t extendC = memST->extendC; /*Gap extend penalty*/
+   int8_t limC = memST->limC;       /*Max |u| and |v|*/
+   int8_t tmpAry[defLanes];
+
+   /*Score of the last row. Starts at the gap column and
+   ` adds the horizontal difference of each cell.
+   */
+   long scoreL =
+      (long) openC + (long) extendC * (long) (lenQryUL - 1);
+
+   vectT sVect;       /*Match/snp scores*/
+   vectT uVect;       /*u for the cells to the left*/
+   vectT vVect;       /*v for the cells above*/
+   vectT insVect;     /*Insertion score - diagonal score*/
+   vectT delVect;     /*Deletion score - diagonal score*/
+   vectT zVect;       /*Cell score - diagonal score*/
+   vectT newUVect;    /*u for the scored cells*/
+   vectT newVVect;    /*v for the scored cells*/
+   vectT snpVect;     /*-1 if the cell came from a snp*/
+   vectT tieVect;     /*-1 if a gap beat the snp on a tie*/
+   vectT minVect;     /*Smallest u or v found*/
+   vectT maxVect;     /*Largest u or v found*/
+
+   vectT matchScoreVect = vSet1(memST->matchC);
+   vectT snpScoreVect = vSet1(memST->snpC);
+   vectT openVect = vSet1(openC);
+   vectT extendVect = vSet1(extendC);
+   vectT insTieVect = vSet1(memST->insTieC);
+   vectT delTieVect = vSet1(memST->delTieC);
+
+   minVect = vSet1(0);
+   maxVect = vSet1(0);
+
+   /*>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>\
+   ^ Fun-01 Sec-02:
+   ^  - Set up the gap row and gap column
+   \<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<*/
+
+   /*Same as NeedlemanAln. The first cell in the gap row
+   ` and gap column is a gap open, the rest are
+   ` extensions. The gap row and column are not snps, so
+   ` a gap leaving them is an extension.
+   */
+   vAry[1] = openC;
+   fAry[1] = 0;
+
+   for(colUL = 2; colUL <= lenRefUL; ++colUL)
+   { /*Loop: set up the gap row*/
+      vAry[colUL] = extendC;
+      fAry[colUL] = 0;
+   } /*Loop: set up the gap row*/
+
+   uAry[0] = openC; /*First query base*/
+   fAry[0] = 0;
+
+   /*>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>\
+   ^ Fun-01 Sec-03:
+   ^  - Score each anti-diagonal
+   ^  o fun-01 sec-03 sub-01:
+   ^    - Find the cells in this anti-diagonal
+   ^  o fun-01 sec-03 sub-02:
+   ^    - Score the cells (last vector first)
+   ^  o fun-01 sec-03 sub-03:
+   ^    - Update the gap column and last row score
+   \<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<*/
+
+   for(diagUL = 2; diagUL <= lenRefUL+lenQryUL; ++diagUL)
+   { /*Loop: through all anti-diagonals*/
+
+      /***************************************************\
+      * Fun-01 Sec-03 Sub-01:
+      *  - Find the cells in this anti-diagonal
+      \***************************************************/
+
+      /*Cell (query row, ref column) is on anti-diagonal
+      ` row + column. The query is reversed, so the query
+      ` bases are in the same order as the ref bases.
+      */
+      if(diagUL > lenQryUL) startUL = diagUL - lenQryUL;
+      else startUL = 1;
+
+      if(diagUL - 1 < lenRefUL) endUL = diagUL - 1;
+      else endUL = lenRefUL;
+
+      /*Wraps past 0 when diagUL > lenQryUL, but adding
+      ` colUL (>= diagUL - lenQryUL) brings it back
+      */
+      qryOffUL = lenQryUL - diagUL;
+
+      if(tblAry != 0)
+      { /*If the scoring matrix is not match/snp*/
+         for(colUL = startUL; colUL <= endUL; ++colUL)
+            sAry[colUL] =
+               tblAry[
+                    ((uint8_t) qryAry[qryOffUL + colUL] << 5)
+                  | (uint8_t) refAry[colUL]
+               ];
+      } /*If the scoring matrix is not match/snp*/
+
+      numVectUL = (endUL - startUL + defLanes) / defLanes;
+
+      /***************************************************\
+      * Fun-01 Sec-03 Sub-02:
+      *  - Score the cells (last vector first)
+      \***************************************************/
+
+      /*Going backwards lets u and f be updated in place.
+      ` Each vector reads u and f from the column before,
+      ` which the next (lower) vector has not changed yet.
+      */
+      while(numVectUL > 0)
+      { /*Loop: through all vectors in the anti-diagonal*/
+         --numVectUL;
+         colUL = startUL + numVectUL * defLanes;
+
+         if(tblAry != 0) sVect = vLoad(sAry + colUL);
+         else
+            sVect =
+               vEqSel(
+                  vLoad(refAry + colUL),
+                  vLoad(qryAry + (qryOffUL + colUL)),
+                  matchScoreVect,
+                  snpScoreVect
+               );
+
+         uVect = vLoad(uAry + colUL - 1);
+         vVect = vLoad(vAry + colUL);
+
+         /*indelScore: a gap after a snp is a gap open,
+         ` after anything else it is an extension
+         */
+         snpVect = vLoad(fAry + colUL);
+         insVect =
+            vAdd(
+               vVect,
+               vOr(
+                  vAnd(snpVect, openVect),
+                  vAndNot(snpVect, extendVect)
+               )
+            ); /*Insertion; from the cell above*/
+
+         snpVect = vLoad(fAry + colUL - 1);
+         delVect =
+            vAdd(
+               uVect,
+               vOr(
+                  vAnd(snpVect, openVect),
+                  vAndNot(snpVect, extendVect)
+               )
+            ); /*Deletion; from the left cell*/
+
+         zVect = vMax(sVect, vMax(insVect, delVect));
+
+         /*The cell only came from a snp if no gap that is
+         ` prefered on ties (settings->bestDirC) equals it
+         */
+         tieVect =
+            vOr(
+               vAnd(vCmpEq(insVect, zVect), insTieVect),
+               vAnd(vCmpEq(delVect, zVect), delTieVect)
+            );
+
+         snpVect = vAndNot(tieVect, vCmpEq(sVect, zVect));
+
+         /*u is from the cell above, v from the left cell*/
+         newUVect = vSub(zVect, vVect);
+         newVVect = vSub(zVect, uVect);
+
+         numUI = (unsigned int) (endUL + 1 - colUL);
+
+         if(numUI >= defLanes)
+         { /*If the full vector is in the anti-diagonal*/
+            vStore(uAry + colUL, newUVect);
+            vStore(vAry + colUL, newVVect);
+            vStore(fAry + colUL, snpVect);
+
+            minVect = vMin(minVect, vMin(newUVect,newVVect));
+            maxVect = vMax(maxVect, vMax(newUVect,newVVect));
+         } /*If the full vector is in the anti-diagonal*/
+
+         else
+         { /*Else only part of the vector is used*/
+            /*Keep the gap row values past the last cell*/
+            vStoreN(uAry + colUL, newUVect, numUI);
+            vStoreN(vAry + colUL, newVVect, numUI);
+            vStoreN(fAry + colUL, snpVect, numUI);
+
+            /*Only check the cells that were kept*/
+            vStore(tmpAry, newUVect);
+
+            for(indexUI = 0; indexUI < numUI; ++indexUI)
+            { /*Loop: check the kept u values*/
+               if(tmpAry[indexUI] < -limC) goto overflow;
+               if(tmpAry[indexUI] > limC) goto overflow;
+            } /*Loop: check the kept u values*/
+
+            vStore(tmpAry, newVVect);
+
+            for(indexUI = 0; indexUI < numUI; ++indexUI)
+            { /*Loop: check the kept v values*/
+               if(tmpAry[indexUI] < -limC) goto overflow;
+               if(tmpAry[indexUI] > limC) goto overflow;
+            } /*Loop: check the kept v values*/
+         } /*Else only part of the vector is used*/
+      } /*Loop: through all vectors in the anti-diagonal*/
+
+      /***************************************************\
+      * Fun-01 Sec-03 Sub-03:
+      *  - Update the gap column and last row score
+      \***************************************************/
+
+      /*The gap column after the first query base only
+      ` extends the gap
+      */
+      uAry[0] = extendC;
+
+      if(diagUL > lenQryUL) scoreL += vAry[diagUL - lenQryUL];
+   } /*Loop: through all anti-diagonals*/
+
+   /*Any difference past limC may have saturated, so the
+   ` score would be wrong
+   */
+   vStore(tmpAry, minVect);
+
+   for(indexUI = 0; indexUI < defLanes; ++indexUI)
+      if(tmpAry[indexUI] < -limC) goto overflow;
+
+   vStore(tmpAry, maxVect);
+
+   for(indexUI = 0; indexUI < defLanes; ++indexUI)
+      if(tmpAry[indexUI] > limC) goto overflow;
+
+   return scoreL;
+
+   overflow:
+   memST->overflowC = 1;
+   return 0;
+} /*kernName*/
+
+#undef kernName
+#undef kernTarget
+#undef vectT
+#undef defLanes
+#undef vLoad
+#undef vStore
+#undef vStoreN
+#undef vSet1
+#undef vAdd
+#undef vSub
+#undef vMax
+#undef vMin
+#undef vAnd
+#undef vOr
+#undef vAndNot
+#undef vCmpEq
+#undef vEqSel
@@ -13,6 +13,7 @@
 #  o "alnSetStruct.h"
 #  o "alnSeqDefaults.h"
 # C Standard Libraries:
+#  o <pthread.h>
 #  o <stdlib.h>
 #  o <stdint.h>
 #  o <stdio.h>  // by alnSetStructure.h
@@ -42,6 +43,18 @@
 '  o fun-06 twoBitAlnToAlnST:
 '    - Converts a two bit array with an alignment to an
 '      alnStruct structure
+'  o fun-07 findHirschMid:
+'    - Scores the forward and reverse halves and finds the
+'      reference base to split the alignment at
+'  o fun-08 reverseHirschThread:
+'    - Runs scoreReverseHirsch on its own thread
+'  o fun-09 pushHirschTask:
+'    - Adds a sub-problem to a hirschPool task stack
+'  o fun-10 hirschThread:
+'    - Aligns sub-problems from the task stack till all
+'      sub-problems are aligned
+'  o fun-11 hirschThreadAln:
+'    - Runs a Hirschberg alignment on a pool of threads
 \~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~*/
 
 /*--------------------------------------------------------\
@@ -89,6 +102,9 @@ struct alnStruct * Hirschberg(
 
    struct alnStruct *alnST = 0;
 
+   int threadsI = 1;  /*Threads to split alignment with*/
+   char errC = 0;
+
    #if defined HIRSCHTWOBIT
       struct twoBitAry *refAln = 0;
       struct twoBitAry *qryAln = 0;
@@ -253,21 +269,57 @@ struct alnStruct * Hirschberg(
    /*Sening in offset values, because alignment array is
    ` sized to the alignmnet region
    */
-   HirschbergFun(
-     refST->seqCStr + refST->offsetUL,
-     0,                /*1st reference base to align*/
-     lenRefUL,         /*Length of ref region to align*/
-     qryST->seqCStr + qryST->offsetUL,
-     0,                /*1st query base to align*/
-     lenQryUL,         /*length of query target region*/
-     forwardScoreRowL, /*For scoring*/
-     reverseScoreRowL, /*For scoring*/
-     refAln,      /*Holds the reference alignment*/
-     qryAln,      /*Holds the query alignment*/
-     dirRow,      /*Direction row for thread safe scoring*/
-     settings     /*Settings for the alignment*/
-   );
-     /*dirRow becomes a dummy variable for -DNOGAPOPEN*/
+   /*-batch uses its threads to align queries instead.
+   ` The two bit arrays share bytes between sub-problems,
+   ` so they can not be split between threads.
+   */
+   #ifdef HIRSCHTWOBIT
+      threadsI = 1;
+   #else
+      threadsI = settings->batchBl ? 1 : settings->threadsI;
+   #endif
+
+   if(
+         threadsI > 1
+      && lenRefUL * lenQryUL >= defHirschThreadCells
+   ){ /*If splitting the alignment between threads*/
+      errC =
+         hirschThreadAln(
+           refST->seqCStr + refST->offsetUL,
+           lenRefUL,
+           qryST->seqCStr + qryST->offsetUL,
+           lenQryUL,
+           forwardScoreRowL,
+           reverseScoreRowL,
+           refAln,
+           qryAln,
+           dirRow,
+           settings,
+           threadsI
+         );
+
+      /*Not enough memory for the pool; use one thread*/
+      if(errC) threadsI = 1;
+   } /*If splitting the alignment between threads*/
+
+   else threadsI = 1;
+
+   if(threadsI == 1)
+      HirschbergFun(
+        refST->seqCStr + refST->offsetUL,
+        0,                /*1st reference base to align*/
+        lenRefUL,         /*Length of ref region to align*/
+        qryST->seqCStr + qryST->offsetUL,
+        0,                /*1st query base to align*/
+        lenQryUL,         /*length of query target region*/
+        forwardScoreRowL, /*For scoring*/
+        reverseScoreRowL, /*For scoring*/
+        refAln,      /*Holds the reference alignment*/
+        qryAln,      /*Holds the query alignment*/
+        dirRow,      /*Direction row for thread safe scoring*/
+        settings     /*Settings for the alignment*/
+      );
+        /*dirRow becomes a dummy variable for -DNOGAPOPEN*/
 
    /*>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>\
    ^  Fun-01 Sec-04:
@@ -340,10 +392,8 @@ void HirschbergFun(
    '  o fun-02 sec-02:
    '    - Check if on a leaf (final part of alignment
    '  o fun-02 sec-03:
-   '    - Get scores
+   '    - Get scores and find the midpoint
    '  o fun-02 sec-04:
-   '    - Find the midpoint
-   '  o fun-02 sec-05:
    '    - Run the next hirschberg alignment
    \~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~*/
 
@@ -353,8 +403,6 @@ void HirschbergFun(
    \<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<*/
 
    uint8_t bitC = 0;
-   long forwardIndelColL = 0;
-   long reverseIndelColL = 0;
    unsigned long midPointUL = 0;
 
    /*>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>\
@@ -551,79 +599,27 @@ void HirschbergFun(
 
    /*>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>\
    ^ Fun-02 Sec-03:
-   ^  - Get scores
+   ^  - Get scores and find the midpoint
    \<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<*/
 
-    forwardIndelColL = 
-      scoreForwardHirsch(
+   midPointUL =
+      findHirschMid(
         refSeqCStr,       /*Entire reference sequence*/
         refStartUL,       /*Starting base of ref target*/
         refLenUL,         /*length of ref target region*/
         qrySeqCStr,       /*Query seq with coordinates*/
         qryStartUL,       /*Starting base of query target*/
-        qryLenUL / 2,     /*Length of query target region*/
+        qryLenUL,         /*Length of query target region*/
         forwardScoreRowL, /*Array of scores to fill*/
+        reverseScoreRowL, /*Array of scores to fill*/
         refAlnST,         /*direction row for gap extend*/
-        settings          /*setttings to use*/
-    ); /*Get the scores for the forward direction*/
-    /*For -DNOGAPOPEN, refAlnST is ignored*/
-
-    reverseIndelColL = 
-      scoreReverseHirsch(
-        refSeqCStr,         /*Entire reference sequence*/
-        refStartUL,         /*Starting base of ref target*/
-        refLenUL,           /*length of ref target region*/
-        qrySeqCStr,         /*Query seq with coordinates*/
-        qryStartUL + (qryLenUL / 2),/*new query start*/
-        qryLenUL - (qryLenUL / 2),  /*New query length*/
-        reverseScoreRowL,  /*Array of scores to fill*/
-        dirRow,            /*direction row for gap extend*/
-        settings           /* setttings to use*/
-      ); /*Get the scores for the reverse direction*/
-      /*For -DNOGAPOPEN, dirRow is ignored*/
-      /* I can get away with queryLen/2 here, because 
-      `  queryLen is index 1 and the function takes in
-      `  an lenth 1 argument
-      `  I made this section thread safe by using refAlnST
-      `    for the forward score and dirRow for the
-      `    reverse row.
-      */
+        dirRow,           /*direction row for gap extend*/
+        settings,         /*setttings to use*/
+        0                 /*Score on this thread only*/
+      );
 
    /*>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>\
    ^  Fun-02 Sec-04:
-   ^   - Find the midpoint
-   \<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<*/
-
-   *(forwardScoreRowL + refStartUL + refLenUL - 1) +=
-     reverseIndelColL;
-
-   midPointUL = refLenUL;
-
-   for(
-     unsigned long baseUL = 0;
-     baseUL < refLenUL - 1;
-     ++baseUL
-   ) { /*Loop; add up all scores*/
-     *(forwardScoreRowL + refStartUL + baseUL) += 
-       *(reverseScoreRowL + refStartUL + baseUL + 1);
-       /*The reverse row is already reversed*/
-
-     if(
-       *(forwardScoreRowL + refStartUL + baseUL) >
-       *(forwardScoreRowL + refStartUL + midPointUL -1)
-     ) midPointUL = baseUL + 1;
-   } /*Loop; add up all scores*/
-
-   *(reverseScoreRowL + refStartUL) += forwardIndelColL;
-
-   if(
-     *(reverseScoreRowL + refStartUL) >
-     *(forwardScoreRowL + refStartUL + midPointUL - 1)
-   ) midPointUL = 0;
-
-
-   /*>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>\
-   ^  Fun-02 Sec-05:
    ^    - Run the Hirschberg alignment
    \<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<*/
 
@@ -2005,3 +2001,514 @@ struct alnStruct * twoBitAlnToAlnST(
 
     return alnST;
 } /*twoBitAlnToAlnST*/
+
+/*--------------------------------------------------------\
+| Output:
+|  - Returns:
+|    o Number of reference bases to put in the first
+|      sub-problem (midpoint)
+|  - Modifies:
+|    o forwardScoreRowL and reverseScoreRowL (from
+|      refStartUL to refStartUL + refLenUL)
+|    o refAlnST and dirRow (same range), which are used
+|      as direction rows
+\--------------------------------------------------------*/
+unsigned long findHirschMid(
+  char *refSeqCStr,          /*Reference sequence*/
+  unsigned long refStartUL,  /*index 0 starting ref base*/
+  unsigned long refLenUL,    /*index 1 Length of target*/
+  char *qrySeqCStr,          /*Query sequence*/
+  unsigned long qryStartUL, /*Index 0 Starting query base*/
+  unsigned long qryLenUL,    /*index 1 length of target*/
+  long *forwardScoreRowL,    /*Forward scores*/
+  long *reverseScoreRowL,    /*Reverse scores*/
+  #ifdef HIRSCHTWOBIT
+     struct twoBitAry *refAlnST,/*forward direction row*/
+     struct twoBitAry *dirRow,  /*reverse direction row*/
+  #else
+     char *refAlnST,         /*forward direction row*/
+     char *dirRow,           /*reverse direction row*/
+  #endif
+  struct alnSet *settings,   /*setttings to use*/
+  char threadBl
+    /*1: Score the reverse half on a second thread
+    ` 0: Score both halves on this thread
+    */
+){ /*~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~\
+   ' Fun-07 TOC: findHirschMid
+   '  - Scores the forward and reverse halves and finds the
+   '    reference base to split the alignment at
+   '  o fun-07 sec-01:
+   '    - Variable declerations
+   '  o fun-07 sec-02:
+   '    - Get scores
+   '  o fun-07 sec-03:
+   '    - Find the midpoint
+   \~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~*/
+
+   /*>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>\
+   ^  Fun-07 Sec-01:
+   ^    - Variable declerations
+   \<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<*/
+
+   long forwardIndelColL = 0;
+   long reverseIndelColL = 0;
+   unsigned long midPointUL = 0;
+
+   struct hirschScore revScoreST;
+   pthread_t revThread;
+
+   /*>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>\
+   ^ Fun-07 Sec-02:
+   ^  - Get scores
+   \<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<*/
+
+   /* I can get away with queryLen/2 here, because 
+   `  queryLen is index 1 and the function takes in
+   `  an lenth 1 argument
+   `  I made this section thread safe by using refAlnST
+   `    for the forward score and dirRow for the
+   `    reverse row.
+   */
+   revScoreST.refSeqCStr = refSeqCStr;
+   revScoreST.refStartUL = refStartUL;
+   revScoreST.refLenUL = refLenUL;
+   revScoreST.qrySeqCStr = qrySeqCStr;
+   revScoreST.qryStartUL = qryStartUL + (qryLenUL / 2);
+   revScoreST.qryLenUL = qryLenUL - (qryLenUL / 2);
+   revScoreST.scoreRowL = reverseScoreRowL;
+   revScoreST.dirRow = dirRow;
+   revScoreST.settings = settings;
+   revScoreST.indelColL = 0;
+
+   /*Fall back to one thread if the thread was not made*/
+   if(threadBl)
+      threadBl =
+         !pthread_create(
+            &revThread,
+            0,
+            reverseHirschThread,
+            &revScoreST
+         );
+
+   forwardIndelColL = 
+     scoreForwardHirsch(
+       refSeqCStr,       /*Entire reference sequence*/
+       refStartUL,       /*Starting base of ref target*/
+       refLenUL,         /*length of ref target region*/
+       qrySeqCStr,       /*Query seq with coordinates*/
+       qryStartUL,       /*Starting base of query target*/
+       qryLenUL / 2,     /*Length of query target region*/
+       forwardScoreRowL, /*Array of scores to fill*/
+       refAlnST,         /*direction row for gap extend*/
+       settings          /*setttings to use*/
+   ); /*Get the scores for the forward direction*/
+   /*For -DNOGAPOPEN, refAlnST is ignored*/
+
+   if(threadBl) pthread_join(revThread, 0);
+   else reverseHirschThread(&revScoreST);
+
+   reverseIndelColL = revScoreST.indelColL;
+
+   /*>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>\
+   ^  Fun-07 Sec-03:
+   ^   - Find the midpoint
+   \<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<*/
+
+   *(forwardScoreRowL + refStartUL + refLenUL - 1) +=
+     reverseIndelColL;
+
+   midPointUL = refLenUL;
+
+   for(
+     unsigned long baseUL = 0;
+     baseUL < refLenUL - 1;
+     ++baseUL
+   ) { /*Loop; add up all scores*/
+     *(forwardScoreRowL + refStartUL + baseUL) += 
+       *(reverseScoreRowL + refStartUL + baseUL + 1);
+       /*The reverse row is already reversed*/
+
+     if(
+       *(forwardScoreRowL + refStartUL + baseUL) >
+       *(forwardScoreRowL + refStartUL + midPointUL -1)
+     ) midPointUL = baseUL + 1;
+   } /*Loop; add up all scores*/
+
+   *(reverseScoreRowL + refStartUL) += forwardIndelColL;
+
+   if(
+     *(reverseScoreRowL + refStartUL) >
+     *(forwardScoreRowL + refStartUL + midPointUL - 1)
+   ) midPointUL = 0;
+
+   return midPointUL;
+} /*findHirschMid*/
+
+/*--------------------------------------------------------\
+| Output:
+|  - Modifies:
+|    o scoreST->scoreRowL and scoreST->dirRow to have the
+|      reverse scores and directions
+|    o scoreST->indelColL to have the indel column score
+|  - Returns:
+|    o 0 (pthread return value)
+\--------------------------------------------------------*/
+void * reverseHirschThread(
+  void *scoreST /*hirschScore struct with the input*/
+){ /*~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~\
+   ' Fun-08 TOC: reverseHirschThread
+   '  - Runs scoreReverseHirsch on its own thread
+   \~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~*/
+
+   struct hirschScore *revST = (struct hirschScore *)scoreST;
+
+   revST->indelColL =
+     scoreReverseHirsch(
+       revST->refSeqCStr,
+       revST->refStartUL,
+       revST->refLenUL,
+       revST->qrySeqCStr,
+       revST->qryStartUL,
+       revST->qryLenUL,
+       revST->scoreRowL,
+       revST->dirRow,   /*For -DNOGAPOPEN, is ignored*/
+       revST->settings
+     ); /*Get the scores for the reverse direction*/
+
+   return 0;
+} /*reverseHirschThread*/
+
+/*--------------------------------------------------------\
+| Output:
+|  - Modifies:
+|    o poolST->taskAryST to have the new task
+|  - Returns:
+|    o 0 for success
+|    o 64 for memory errors (task was not added)
+\--------------------------------------------------------*/
+char pushHirschTask(
+  struct hirschPool *poolST, /*Pool to add task to*/
+  unsigned long refStartUL,  /*index 0 starting ref base*/
+  unsigned long refLenUL,    /*index 1 Length of target*/
+  unsigned long qryStartUL, /*Index 0 Starting query base*/
+  unsigned long qryLenUL     /*index 1 length of target*/
+){ /*~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~\
+   ' Fun-09 TOC: pushHirschTask
+   '  - Adds a sub-problem to the task stack
+   \~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~*/
+
+   struct hirschTask *tmpTaskST = 0;
+   struct hirschTask *taskST = 0;
+
+   pthread_mutex_lock(&poolST->poolMutex);
+
+   if(poolST->numTasksUL >= poolST->sizeTasksUL)
+   { /*If I need more memory for the task stack*/
+      tmpTaskST =
+         realloc(
+            poolST->taskAryST,
+              (poolST->sizeTasksUL << 1)
+            * sizeof(struct hirschTask)
+         );
+
+      if(tmpTaskST == 0)
+      { /*If I had a memory error*/
+         pthread_mutex_unlock(&poolST->poolMutex);
+         return 64;
+      } /*If I had a memory error*/
+
+      poolST->taskAryST = tmpTaskST;
+      poolST->sizeTasksUL <<= 1;
+   } /*If I need more memory for the task stack*/
+
+   taskST = poolST->taskAryST + poolST->numTasksUL;
+   taskST->refStartUL = refStartUL;
+   taskST->refLenUL = refLenUL;
+   taskST->qryStartUL = qryStartUL;
+   taskST->qryLenUL = qryLenUL;
+   ++poolST->numTasksUL;
+
+   pthread_cond_signal(&poolST->poolCond);
+   pthread_mutex_unlock(&poolST->poolMutex);
+   return 0;
+} /*pushHirschTask*/
+
+/*--------------------------------------------------------\
+| Output:
+|  - Modifies:
+|    o poolST->refAlnST and poolST->qryAlnST to have the
+|      alignment of each task done by this thread
+|  - Returns:
+|    o 0 (pthread return value)
+\--------------------------------------------------------*/
+void * hirschThread(
+  void *poolST /*hirschPool struct shared by threads*/
+){ /*~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~\
+   ' Fun-10 TOC: hirschThread
+   '  - Aligns sub-problems from the task stack till all
+   '    sub-problems are aligned
+   '  o fun-10 sec-01:
+   '    - Variable declerations
+   '  o fun-10 sec-02:
+   '    - Get the next task
+   '  o fun-10 sec-03:
+   '    - Split the task till it is small
+   \~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~*/
+
+   /*>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>\
+   ^  Fun-10 Sec-01:
+   ^    - Variable declerations
+   \<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<*/
+
+   struct hirschPool *pool = (struct hirschPool *) poolST;
+   struct hirschTask taskST;
+   unsigned long midPointUL = 0;
+   char threadBl = 0; /*1: Idle threads; score on two*/
+
+   /*>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>\
+   ^  Fun-10 Sec-02:
+   ^    - Get the next task
+   \<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<*/
+
+   pthread_mutex_lock(&pool->poolMutex);
+
+   while(1)
+   { /*Loop: Get tasks till every task is finished*/
+      while(pool->numTasksUL == 0 && pool->busyUL > 0)
+         pthread_cond_wait(&pool->poolCond,&pool->poolMutex);
+
+      /*No tasks left and no thread can add more tasks*/
+      if(pool->numTasksUL == 0) break;
+
+      --pool->numTasksUL;
+      taskST = pool->taskAryST[pool->numTasksUL];
+      ++pool->busyUL;
+
+      pthread_mutex_unlock(&pool->poolMutex);
+
+      /****************************************************\
+      * Fun-10 Sec-03:
+      *  - Split the task till it is small
+      \****************************************************/
+
+      while(
+            taskST.refLenUL > 1
+         && taskST.qryLenUL > 1
+         &&   taskST.refLenUL * taskST.qryLenUL
+            >= defHirschThreadCells
+      ){ /*Loop: split the task till it is small*/
+         /*Only use a second thread if a thread is idle*/
+         pthread_mutex_lock(&pool->poolMutex);
+         threadBl =
+              pool->busyUL + pool->numTasksUL
+            < (unsigned long) pool->threadsI;
+         pthread_mutex_unlock(&pool->poolMutex);
+
+         midPointUL =
+            findHirschMid(
+               pool->refSeqCStr,
+               taskST.refStartUL,
+               taskST.refLenUL,
+               pool->qrySeqCStr,
+               taskST.qryStartUL,
+               taskST.qryLenUL,
+               pool->forwardScoreRowL,
+               pool->reverseScoreRowL,
+               pool->refAlnST,
+               pool->dirRow,
+               pool->settings,
+               threadBl
+            );
+
+         /*The second half goes to the other threads*/
+         if(
+            pushHirschTask(
+               pool,
+               taskST.refStartUL + midPointUL,
+               taskST.refLenUL - midPointUL,
+               taskST.qryStartUL + (taskST.qryLenUL / 2),
+               taskST.qryLenUL - (taskST.qryLenUL / 2)
+            )
+         ){ /*If could not add the task; do it here*/
+            HirschbergFun(
+               pool->refSeqCStr,
+               taskST.refStartUL + midPointUL,
+               taskST.refLenUL - midPointUL,
+               pool->qrySeqCStr,
+               taskST.qryStartUL + (taskST.qryLenUL / 2),
+               taskST.qryLenUL - (taskST.qryLenUL / 2),
+               pool->forwardScoreRowL,
+               pool->reverseScoreRowL,
+               pool->refAlnST,
+               pool->qryAlnST,
+               pool->dirRow,
+               pool->settings
+            );
+         } /*If could not add the task; do it here*/
+
+         /*This thread keeps working on the first half*/
+         taskST.refLenUL = midPointUL;
+         taskST.qryLenUL = taskST.qryLenUL / 2;
+      } /*Loop: split the task till it is small*/
+
+      /*Small tasks and leafs are done on this thread*/
+      HirschbergFun(
+         pool->refSeqCStr,
+         taskST.refStartUL,
+         taskST.refLenUL,
+         pool->qrySeqCStr,
+         taskST.qryStartUL,
+         taskST.qryLenUL,
+         pool->forwardScoreRowL,
+         pool->reverseScoreRowL,
+         pool->refAlnST,
+         pool->qryAlnST,
+         pool->dirRow,
+         pool->settings
+      );
+
+      pthread_mutex_lock(&pool->poolMutex);
+      --pool->busyUL;
+
+      /*Wake up the waiting threads so they can exit*/
+      if(pool->busyUL == 0 && pool->numTasksUL == 0)
+         pthread_cond_broadcast(&pool->poolCond);
+   } /*Loop: Get tasks till every task is finished*/
+
+   pthread_mutex_unlock(&pool->poolMutex);
+   return 0;
+} /*hirschThread*/
+
+/*--------------------------------------------------------\
+| Output:
+|  - Modifies:
+|    o refAlnST and qryAlnST to hold the alignment
+|  - Returns:
+|    o 0 for success
+|    o 64 for memory errors
+\--------------------------------------------------------*/
+char hirschThreadAln(
+  char *refSeqCStr,          /*Reference sequence*/
+  unsigned long lenRefUL,    /*index 1 Length of target*/
+  char *qrySeqCStr,          /*Query sequence*/
+  unsigned long lenQryUL,    /*index 1 length of target*/
+  long *forwardScoreRowL,    /*Forward scores*/
+  long *reverseScoreRowL,    /*Reverse scores*/
+  #ifdef HIRSCHTWOBIT
+     struct twoBitAry *refAlnST,/*Holds ref alignment*/
+     struct twoBitAry *qryAlnST,/*Holds query alignment*/
+     struct twoBitAry *dirRow,  /*reverse direction row*/
+  #else
+     char *refAlnST,         /*Holds ref alignment*/
+     char *qryAlnST,         /*Holds query alignment*/
+     char *dirRow,           /*reverse direction row*/
+  #endif
+  struct alnSet *settings,   /*setttings to use*/
+  int threadsI               /*Number of threads to use*/
+){ /*~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~\
+   ' Fun-11 TOC: hirschThreadAln
+   '  - Runs a Hirschberg alignment on a pool of threads
+   '  o fun-11 sec-01:
+   '    - Variable declerations
+   '  o fun-11 sec-02:
+   '    - Set up the pool
+   '  o fun-11 sec-03:
+   '    - Run the threads
+   '  o fun-11 sec-04:
+   '    - Clean up
+   \~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~*/
+
+   /*>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>\
+   ^  Fun-11 Sec-01:
+   ^    - Variable declerations
+   \<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<*/
+
+   struct hirschPool poolST;
+   pthread_t *threadAry = 0;
+   int numThreadsI = 0; /*Threads started*/
+
+   /*>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>\
+   ^  Fun-11 Sec-02:
+   ^    - Set up the pool
+   \<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<*/
+
+   poolST.refSeqCStr = refSeqCStr;
+   poolST.qrySeqCStr = qrySeqCStr;
+   poolST.forwardScoreRowL = forwardScoreRowL;
+   poolST.reverseScoreRowL = reverseScoreRowL;
+   poolST.refAlnST = refAlnST;
+   poolST.qryAlnST = qryAlnST;
+   poolST.dirRow = dirRow;
+   poolST.settings = settings;
+   poolST.numTasksUL = 0;
+   poolST.busyUL = 0;
+   poolST.threadsI = threadsI;
+
+   /*Each split adds one task, so the stack is at most
+   ` a few tasks per thread
+   */
+   poolST.sizeTasksUL = (unsigned long) threadsI << 2;
+   poolST.taskAryST =
+      malloc(poolST.sizeTasksUL * sizeof(struct hirschTask));
+
+   if(poolST.taskAryST == 0) return 64;
+
+   /*The calling thread is one of the threads*/
+   threadAry = malloc((threadsI - 1) * sizeof(pthread_t));
+
+   if(threadAry == 0)
+   { /*If had a memory error*/
+      free(poolST.taskAryST);
+      return 64;
+   } /*If had a memory error*/
+
+   pthread_mutex_init(&poolST.poolMutex, 0);
+   pthread_cond_init(&poolST.poolCond, 0);
+
+   /*Add the full alignment as the first task*/
+   poolST.taskAryST->refStartUL = 0;
+   poolST.taskAryST->refLenUL = lenRefUL;
+   poolST.taskAryST->qryStartUL = 0;
+   poolST.taskAryST->qryLenUL = lenQryUL;
+   poolST.numTasksUL = 1;
+
+   /*>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>\
+   ^  Fun-11 Sec-03:
+   ^    - Run the threads
+   \<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<*/
+
+   for(
+      numThreadsI = 0;
+      numThreadsI < threadsI - 1;
+      ++numThreadsI
+   ){ /*Loop: start the threads*/
+      /*The other threads pick up the work if a thread
+      ` could not be made
+      */
+      if(
+         pthread_create(
+            threadAry + numThreadsI,
+            0,
+            hirschThread,
+            &poolST
+         )
+      ) break;
+   } /*Loop: start the threads*/
+
+   hirschThread(&poolST);
+
+   for(int iThread = 0; iThread < numThreadsI; ++iThread)
+      pthread_join(threadAry[iThread], 0);
+
+   /*>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>\
+   ^  Fun-11 Sec-04:
+   ^    - Clean up
+   \<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<*/
+
+   pthread_mutex_destroy(&poolST.poolMutex);
+   pthread_cond_destroy(&poolST.poolCond);
+   free(poolST.taskAryST);
+   free(threadAry);
+   return 0;
+} /*hirschThreadAln*/
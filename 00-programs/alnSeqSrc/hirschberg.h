@@ -13,6 +13,7 @@
 #  o "alnSetStruct.h"
 #  o "alnSeqDefaults.h"
 # C Standard Libraries:
+#  - <pthread.h>
 #  o <stdlib.h>
 #  o <stdint.h>
 #  o <stdio.h>  // by alnSetStructure.h
@@ -37,11 +38,32 @@
 '  o fun-06 twoBitAlnToAlnST:
 '    - Converts a two bit array with an alignment to an
 '      alnStruct structure
+'  o struct-01 hirschTask:
+'    - Holds the coordinates of one Hirschberg sub-problem
+'  o struct-02 hirschPool:
+'    - Holds the shared arrays and task stack for the
+'      threads in a Hirschberg alignment
+'  o struct-03 hirschScore:
+'    - Holds the input and output of a reverse scoring
+'      thread
+'  o fun-07 findHirschMid:
+'    - Scores the forward and reverse halves and finds the
+'      reference base to split the alignment at
+'  o fun-08 reverseHirschThread:
+'    - Runs scoreReverseHirsch on its own thread
+'  o fun-09 pushHirschTask:
+'    - Adds a sub-problem to the task stack
+'  o fun-10 hirschThread:
+'    - Aligns sub-problems from the task stack till all
+'      sub-problems are aligned (run by pthread_create)
+'  o fun-11 hirschThreadAln:
+'    - Runs a Hirschberg alignment on a pool of threads
 \~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~*/
 
 #ifndef HIRSCHBERG_H
 #define HIRSCHBERG_H
 
+#include <pthread.h>
 #include "alnStruct.h"
 
 /*--------------------------------------------------------\
@@ -113,10 +135,8 @@ void HirschbergFun(
    '  o fun-02 sec-02:
    '    - Check if on a leaf (final part of alignment
    '  o fun-02 sec-03:
-   '    - Get scores
+   '    - Get scores and find the midpoint
    '  o fun-02 sec-04:
-   '    - Find the midpoint
-   '  o fun-02 sec-05:
    '    - Run the next hirschberg alignment
    \~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~*/
 
@@ -265,4 +285,219 @@ struct alnStruct * twoBitAlnToAlnST(
    '    alnStruct structure
    \~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~*/
 
+/*--------------------------------------------------------\
+| Struct-01: hirschTask
+|  - Holds the coordinates of one Hirschberg sub-problem
+\--------------------------------------------------------*/
+typedef struct hirschTask
+{ /*hirschTask*/
+   unsigned long refStartUL; /*index 0; first ref base*/
+   unsigned long refLenUL;   /*index 1; ref bases*/
+   unsigned long qryStartUL; /*index 0; first query base*/
+   unsigned long qryLenUL;   /*index 1; query bases*/
+}hirschTask;
+
+/*--------------------------------------------------------\
+| Struct-02: hirschPool
+|  - Holds the shared arrays and task stack for the
+|    threads in a Hirschberg alignment
+|  - The sub-problems from one split cover different
+|    reference and query bases. So, each thread only
+|    touches its own part of the score, direction, and
+|    alignment arrays.
+\--------------------------------------------------------*/
+typedef struct hirschPool
+{ /*hirschPool*/
+   char *refSeqCStr;         /*Reference sequence*/
+   char *qrySeqCStr;         /*Query sequence*/
+   long *forwardScoreRowL;   /*Forward scores (full ref)*/
+   long *reverseScoreRowL;   /*Reverse scores (full ref)*/
+
+   #ifdef HIRSCHTWOBIT
+      struct twoBitAry *refAlnST;
+      struct twoBitAry *qryAlnST;
+      struct twoBitAry *dirRow;
+   #else
+      char *refAlnST;        /*Holds the ref alignment*/
+      char *qryAlnST;        /*Holds the query alignment*/
+      char *dirRow;          /*Reverse direction row*/
+   #endif
+
+   struct alnSet *settings;  /*Settings for alignment*/
+
+   struct hirschTask *taskAryST; /*Stack of sub-problems*/
+   unsigned long numTasksUL;     /*Tasks on the stack*/
+   unsigned long sizeTasksUL;    /*Size of taskAryST*/
+   unsigned long busyUL;         /*Threads with a task*/
+   int threadsI;                 /*Threads in the pool*/
+
+   pthread_mutex_t poolMutex;    /*Locks the stack*/
+   pthread_cond_t poolCond;      /*New task or finished*/
+}hirschPool;
+
+/*--------------------------------------------------------\
+| Struct-03: hirschScore
+|  - Holds the input and output of a reverse scoring
+|    thread
+\--------------------------------------------------------*/
+typedef struct hirschScore
+{ /*hirschScore*/
+   char *refSeqCStr;
+   unsigned long refStartUL;
+   unsigned long refLenUL;
+   char *qrySeqCStr;
+   unsigned long qryStartUL;
+   unsigned long qryLenUL;
+   long *scoreRowL;
+
+   #ifdef HIRSCHTWOBIT
+      struct twoBitAry *dirRow;
+   #else
+      char *dirRow;
+   #endif
+
+   struct alnSet *settings;
+   long indelColL;           /*Returned indel column*/
+}hirschScore;
+
+/*--------------------------------------------------------\
+| Output:
+|  - Returns:
+|    o Number of reference bases to put in the first
+|      sub-problem (midpoint)
+|  - Modifies:
+|    o forwardScoreRowL and reverseScoreRowL (from
+|      refStartUL to refStartUL + refLenUL)
+|    o refAlnST and dirRow (same range), which are used
+|      as direction rows
+\--------------------------------------------------------*/
+unsigned long findHirschMid(
+  char *refSeqCStr,          /*Reference sequence*/
+  unsigned long refStartUL,  /*index 0 starting ref base*/
+  unsigned long refLenUL,    /*index 1 Length of target*/
+  char *qrySeqCStr,          /*Query sequence*/
+  unsigned long qryStartUL, /*Index 0 Starting query base*/
+  unsigned long qryLenUL,    /*index 1 length of target*/
+  long *forwardScoreRowL,    /*Forward scores*/
+  long *reverseScoreRowL,    /*Reverse scores*/
+  #ifdef HIRSCHTWOBIT
+     struct twoBitAry *refAlnST,/*forward direction row*/
+     struct twoBitAry *dirRow,  /*reverse direction row*/
+  #else
+     char *refAlnST,         /*forward direction row*/
+     char *dirRow,           /*reverse direction row*/
+  #endif
+  struct alnSet *settings,   /*setttings to use*/
+  char threadBl
+    /*1: Score the reverse half on a second thread
+    ` 0: Score both halves on this thread
+    */
+); /*~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~\
+   ' Fun-07 TOC: findHirschMid
+   '  - Scores the forward and reverse halves and finds the
+   '    reference base to split the alignment at
+   '  o fun-07 sec-01:
+   '    - Variable declerations
+   '  o fun-07 sec-02:
+   '    - Get scores
+   '  o fun-07 sec-03:
+   '    - Find the midpoint
+   \~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~*/
+
+/*--------------------------------------------------------\
+| Output:
+|  - Modifies:
+|    o scoreST->scoreRowL and scoreST->dirRow to have the
+|      reverse scores and directions
+|    o scoreST->indelColL to have the indel column score
+|  - Returns:
+|    o 0 (pthread return value)
+\--------------------------------------------------------*/
+void * reverseHirschThread(
+  void *scoreST /*hirschScore struct with the input*/
+); /*~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~\
+   ' Fun-08 TOC: reverseHirschThread
+   '  - Runs scoreReverseHirsch on its own thread
+   \~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~*/
+
+/*--------------------------------------------------------\
+| Output:
+|  - Modifies:
+|    o poolST->taskAryST to have the new task
+|  - Returns:
+|    o 0 for success
+|    o 64 for memory errors (task was not added)
+\--------------------------------------------------------*/
+char pushHirschTask(
+  struct hirschPool *poolST, /*Pool to add task to*/
+  unsigned long refStartUL,  /*index 0 starting ref base*/
+  unsigned long refLenUL,    /*index 1 Length of target*/
+  unsigned long qryStartUL, /*Index 0 Starting query base*/
+  unsigned long qryLenUL     /*index 1 length of target*/
+); /*~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~\
+   ' Fun-09 TOC: pushHirschTask
+   '  - Adds a sub-problem to the task stack
+   \~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~*/
+
+/*--------------------------------------------------------\
+| Output:
+|  - Modifies:
+|    o poolST->refAlnST and poolST->qryAlnST to have the
+|      alignment of each task done by this thread
+|  - Returns:
+|    o 0 (pthread return value)
+\--------------------------------------------------------*/
+void * hirschThread(
+  void *poolST /*hirschPool struct shared by threads*/
+); /*~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~\
+   ' Fun-10 TOC: hirschThread
+   '  - Aligns sub-problems from the task stack till all
+   '    sub-problems are aligned
+   '  o fun-10 sec-01:
+   '    - Variable declerations
+   '  o fun-10 sec-02:
+   '    - Get the next task
+   '  o fun-10 sec-03:
+   '    - Split the task till it is small
+   \~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~*/
+
+/*--------------------------------------------------------\
+| Output:
+|  - Modifies:
+|    o refAlnST and qryAlnST to hold the alignment
+|  - Returns:
+|    o 0 for success
+|    o 64 for memory errors
+\--------------------------------------------------------*/
+char hirschThreadAln(
+  char *refSeqCStr,          /*Reference sequence*/
+  unsigned long lenRefUL,    /*index 1 Length of target*/
+  char *qrySeqCStr,          /*Query sequence*/
+  unsigned long lenQryUL,    /*index 1 length of target*/
+  long *forwardScoreRowL,    /*Forward scores*/
+  long *reverseScoreRowL,    /*Reverse scores*/
+  #ifdef HIRSCHTWOBIT
+     struct twoBitAry *refAlnST,/*Holds ref alignment*/
+     struct twoBitAry *qryAlnST,/*Holds query alignment*/
+     struct twoBitAry *dirRow,  /*reverse direction row*/
+  #else
+     char *refAlnST,         /*Holds ref alignment*/
+     char *qryAlnST,         /*Holds query alignment*/
+     char *dirRow,           /*reverse direction row*/
+  #endif
+  struct alnSet *settings,   /*setttings to use*/
+  int threadsI               /*Number of threads to use*/
+); /*~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~\
+   ' Fun-11 TOC: hirschThreadAln
+   '  - Runs a Hirschberg alignment on a pool of threads
+   '  o fun-11 sec-01:
+   '    - Variable declerations
+   '  o fun-11 sec-02:
+   '    - Set up the pool
+   '  o fun-11 sec-03:
+   '    - Run the threads
+   '  o fun-11 sec-04:
+   '    - Clean up
+   \~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~*/
+
 #endif
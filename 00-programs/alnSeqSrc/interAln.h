@@ -0,0 +1,219 @@
+/*#########################################################
+# Name: interAln
+# Use:
+#  - Holds an inter-sequence vector Waterman Smith kernel.
+#    Each int16 element (lane) of a vector holds a
+#    different query/reference pair, so 8, 16, or 32
+#    pairs (SSE2, AVX2, AVX512) are scored at once.
+#  - This is made for many short queries (primers) aligned
+#    to many short references (read windows), where the
+#    striped kernel would waste most of each vector.
+#  - Bases are 4 bit IUPAC masks (A = 1, C = 2, G = 4,
+#    T/U = 8). Two bases match if their masks share a bit,
+#    so degenerate primer bases (R, Y, N, ...) match every
+#    base they stand for.
+#  - Does not depend on alnSetStruct, so programs outside
+#    of alnSeq (trimPrimers) can link it. The scores are
+#    the alnSeq defaults (alnSeqDefaults.h).
+# Libraries:
+# C Standard Libraries:
+#  - <stdio.h>
+#  - <stdint.h>
+#########################################################*/
+
+/*~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~\
+' SOH: Start Of Header
+'  o st-01 interHit:
+'    - Holds the score and coordinates of the best local
+'      alignment for one query/reference pair
+'  o fun-01 interSeqToMask:
+'    - Converts a sequence to 4 bit IUPAC masks
+'  o fun-02 interRevCompMask:
+'    - Reverse complements a sequence of 4 bit masks
+'  o fun-03 interMaxScore:
+'    - Finds the best possible score for a query
+'  o fun-04 interWaterScores:
+'    - Finds the best score and end of many pairs with the
+'      inter-sequence kernel
+'  o fun-05 interFindStart:
+'    - Finds the start of an alignment found by
+'      interWaterScores
+'  o fun-06 interPrimerPaf:
+'    - Aligns every primer in a fasta file to every read in
+'      a fastq file and prints the hits as paf lines
+\~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~*/
+
+#ifndef INTERALN_H
+#define INTERALN_H
+
+#include <stdio.h>
+#include <stdint.h>
+
+/*Minimum percent of the best possible primer score a hit
+` needs to be printed by interPrimerPaf
+*/
+#define defInterMinPerc 70
+
+/*Number of bases at each read end to search for primers
+` when only the end primers are wanted (trimPrimers
+` -end-trim)
+*/
+#define defInterEndLen 200
+
+/*Number of query/reference pairs to collect before calling
+` the kernel. Pairs are sorted by length in a batch, so
+` larger batches waste less of each vector on padding.
+*/
+#define defInterBatchPairs 4096
+
+/*Largest score the int16 kernel can hold with room left
+` for the gap penalties
+*/
+#define defInterMaxScore 30000
+
+/*--------------------------------------------------------\
+| ST-01: interHit
+|  - Holds the score and coordinates of the best local
+|    alignment for one query/reference pair
+|  - Coordinates are index 0 and the ends are inclusive
+\--------------------------------------------------------*/
+typedef struct interHit
+{ /*interHit*/
+   long scoreL;              /*Best score (0 is no hit)*/
+   unsigned long refStartUL; /*First reference base*/
+   unsigned long refEndUL;   /*Last reference base*/
+   unsigned long qryStartUL; /*First query base*/
+   unsigned long qryEndUL;   /*Last query base*/
+}interHit;
+
+/*--------------------------------------------------------\
+| Output:
+|  - Modifies:
+|    o seqStr to have 4 bit IUPAC masks instead of bases.
+|      Anything that is not a base is set to 0 (never
+|      matches).
+\--------------------------------------------------------*/
+void interSeqToMask(
+   char *seqStr,         /*Sequence to convert*/
+   unsigned long lenSeqUL  /*Number of bases in seqStr*/
+);
+
+/*--------------------------------------------------------\
+| Output:
+|  - Modifies:
+|    o outStr to have the reverse complement of seqStr
+|      (both are 4 bit masks)
+\--------------------------------------------------------*/
+void interRevCompMask(
+   char *seqStr,          /*Masks to reverse complement*/
+   char *outStr,          /*Gets reverse complement*/
+   unsigned long lenSeqUL /*Number of bases in seqStr*/
+);
+
+/*--------------------------------------------------------\
+| Output:
+|  - Returns:
+|    o Score of a query that matches at every base
+\--------------------------------------------------------*/
+long interMaxScore(
+   unsigned long lenQryUL /*Length of the query*/
+);
+
+/*--------------------------------------------------------\
+| Output:
+|  - Modifies:
+|    o hitAry to have the best score and end of each pair.
+|      The start coordinates are set to the end (use
+|      interFindStart to find the start).
+|  - Returns:
+|    o 0 for success
+|    o 2 if a query is to long for int16 scores (the best
+|      possible score is over defInterMaxScore)
+|    o 64 for memory errors
+\--------------------------------------------------------*/
+unsigned char interWaterScores(
+   char **qryAry,           /*Queries (interSeqToMask)*/
+   unsigned long *lenQryAry,/*Length of each query*/
+   char **refAry,           /*References (interSeqToMask)*/
+   unsigned long *lenRefAry,/*Length of each reference*/
+   unsigned long numPairsUL,/*Number of pairs to score*/
+   struct interHit *hitAry  /*Gets the score of each pair*/
+); /*~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~\
+   ' Fun-04 TOC: interWaterScores
+   '  - Finds the best score and end of many pairs with the
+   '    inter-sequence kernel
+   '  o fun-04 sec-01:
+   '    - Variable declerations
+   '  o fun-04 sec-02:
+   '    - Pick the kernel and sort pairs by length
+   '  o fun-04 sec-03:
+   '    - Score each group of pairs
+   '  o fun-04 sec-04:
+   '    - Clean up
+   \~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~*/
+
+/*--------------------------------------------------------\
+| Output:
+|  - Modifies:
+|    o refStartUL and qryStartUL in hitST to be the start
+|      of the alignment ending at refEndUL and qryEndUL
+|  - Returns:
+|    o 0 for success
+|    o 64 for memory errors
+\--------------------------------------------------------*/
+unsigned char interFindStart(
+   char *qryStr,           /*Query (interSeqToMask)*/
+   char *refStr,           /*Reference (interSeqToMask)*/
+   struct interHit *hitST  /*Hit from interWaterScores*/
+); /*~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~\
+   ' Fun-05 TOC: interFindStart
+   '  - Finds the start of an alignment found by
+   '    interWaterScores
+   '  o fun-05 sec-01:
+   '    - Variable declerations
+   '  o fun-05 sec-02:
+   '    - Set up the reverse window
+   '  o fun-05 sec-03:
+   '    - Align backwards from the end till the score is
+   '      found
+   \~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~*/
+
+/*--------------------------------------------------------\
+| Output:
+|  - Prints:
+|    o One paf line (read is the query, primer is the
+|      target) to outFILE for every primer (and primer
+|      reverse complement) that hit a read. Lines for a
+|      read are printed together, like minimap2 does.
+|  - Returns:
+|    o 0 for success
+|    o 2 if the primer file could not be opened or had no
+|      primers
+|    o 4 if the fastq file could not be opened or was not
+|      a fastq file
+|    o 64 for memory errors
+\--------------------------------------------------------*/
+unsigned char interPrimerPaf(
+   char *primFaStr,       /*Fasta file with primers*/
+   char *fqStr,           /*Fastq file with reads*/
+   unsigned long endLenUL,
+      /*0: search the whole read; else search only the
+      `    first and last endLenUL bases of each read
+      */
+   unsigned char minPercUC, /*Min percent of max score*/
+   FILE *outFILE          /*File to print paf lines to*/
+); /*~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~\
+   ' Fun-06 TOC: interPrimerPaf
+   '  - Aligns every primer in a fasta file to every read
+   '    in a fastq file and prints the hits as paf lines
+   '  o fun-06 sec-01:
+   '    - Variable declerations
+   '  o fun-06 sec-02:
+   '    - Read in the primers
+   '  o fun-06 sec-03:
+   '    - Read in reads and score them in batches
+   '  o fun-06 sec-04:
+   '    - Clean up
+   \~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~*/
+
+#endif
@@ -0,0 +1,233 @@
+/*#########################################################
+# Name: interAlnKern
+# Use:
+#  - Template for the inter-sequence Waterman Smith
+#    kernel. interAln.c includes this file once for each
+#    instruction set (and once for the scalar fallback).
+#  - There is no include guard on purpose. Every macro
+#    below is undefined at the end of this file.
+#  - The sequences are stored by position, with one element
+#    per lane (base at position x for lane y is at
+#    x * defLanes + y).
+# Macros the includer must define:
+#  - kernName: Name of the function to make
+#  - kernTarget: __attribute__((target("..."))) for cpu
+#  - vectT: Vector type (__m128i, __m256i, __m512i, long)
+#  - defLanes: Number of int16 elements in a vector
+#  - vLoad(ptr): Unaligned vector load (int16 pointer)
+#  - vStore(ptr, vect): Unaligned vector store
+#  - vSet1(val): Set all elements to val
+#  - vAdd(vect1, vect2): Saturating int16 add
+#  - vMax(vect1, vect2): int16 element maximum
+#  - vScore(qry, ref, matchVect, snpVect): matchVect where
+#    the qry and ref masks share a bit, else snpVect
+#  - vGtSel(vect1, vect2, gtVect, leVect): gtVect where
+#    vect1 is greater than vect2, else leVect
+#  - vGtAny(vect1, vect2): 1 if any element in vect1 is
+#    greater than vect2
+# Libraries:
+#  - "interAln.h" (by includer)
+#########################################################*/
+
+/*~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~\
+' SOF: Start Of Functions
+'  o fun-01 kernName:
+'    - Finds the best local score and end of defLanes
+'      query/reference pairs
+\~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~*/
+
+/*--------------------------------------------------------\
+| Output:
+|  - Modifies:
+|    o bestAry, qryEndAry, and refEndAry to have the best
+|      score, query end, and reference end of each lane
+|    o hAry, eAry, and tmpAry (used as scratch)
+\--------------------------------------------------------*/
+static kernTarget void kernName(
+   int16_t *qryVAry,   /*Queries (lenQryUL x defLanes)*/
+   int16_t *refVAry,   /*References (lenRefUL x defLanes)*/
+   unsigned long lenQryUL,  /*Longest query*/
+   unsigned long lenRefUL,  /*Longest reference*/
+   int16_t *hAry,      /*Last column scores (lenQryUL)*/
+   int16_t *eAry,      /*Last column ref gaps (lenQryUL)*/
+   int16_t *tmpAry,    /*2 x defLanes of scratch*/
+   int16_t *bestAry,   /*Gets best score (defLanes)*/
+   int16_t *qryEndAry, /*Gets query end (defLanes)*/
+   unsigned long *refEndAry, /*Gets ref end (defLanes)*/
+   int16_t matchS,     /*Score for a match*/
+   int16_t snpS,       /*Score for a mismatch*/
+   int16_t openS,      /*Gap open penalty (< 0)*/
+   int16_t extendS     /*Gap extension penalty (< 0)*/
+){ /*~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~\
+   ' Fun-01 TOC: kernName
+   '  - Finds the best local score and end of defLanes
+   '    query/reference pairs
+   '  o fun-01 sec-01:
+   '    - Variable declerations
+   '  o fun-01 sec-02:
+   '    - Blank the first column
+   '  o fun-01 sec-03:
+   '    - Score each reference base (column)
+   \~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~*/
+
+   /*>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>\
+   ^ Fun-01 Sec-01:
+   ^  - Variable declerations
+   \<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<*/
+
+   unsigned long refUL = 0;
+   unsigned long qryUL = 0;
+   unsigned int laneUI = 0;
+
+   int16_t *colMaxAry = tmpAry;
+   int16_t *colPosAry = tmpAry + defLanes;
+
+   vectT refVect;     /*Reference bases for this column*/
+   vectT hVect;       /*Score of the current cell*/
+   vectT hLeftVect;   /*Score of the cell to the left*/
+   vectT hDiagVect;   /*Score of the diagonal cell*/
+   vectT eVect;       /*Reference gap (from the left)*/
+   vectT fVect;       /*Query gap (from above)*/
+   vectT colMaxVect;  /*Best score in this column*/
+   vectT colPosVect;  /*Query base of colMaxVect*/
+   vectT posVect;     /*Query base on*/
+   vectT bestVect;    /*Best score so far*/
+
+   vectT zeroVect = vSet1(0);
+   vectT oneVect = vSet1(1);
+   vectT matchVect = vSet1(matchS);
+   vectT snpVect = vSet1(snpS);
+   vectT openVect = vSet1(openS);
+   vectT extendVect = vSet1(extendS);
+
+   /*Low enough to never be picked, but saturates instead
+   ` of wrapping when a penalty is added
+   */
+   vectT minVect = vSet1(-30000);
+
+   /*>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>\
+   ^ Fun-01 Sec-02:
+   ^  - Blank the first column
+   \<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<*/
+
+   for(qryUL = 0; qryUL < lenQryUL; ++qryUL)
+   { /*Loop: blank the first column*/
+      vStore(hAry + qryUL * defLanes, zeroVect);
+      vStore(eAry + qryUL * defLanes, minVect);
+   } /*Loop: blank the first column*/
+
+   for(laneUI = 0; laneUI < defLanes; ++laneUI)
+   { /*Loop: blank the best scores*/
+      bestAry[laneUI] = 0;
+      qryEndAry[laneUI] = 0;
+      refEndAry[laneUI] = 0;
+   } /*Loop: blank the best scores*/
+
+   bestVect = zeroVect;
+
+   /*>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>\
+   ^ Fun-01 Sec-03:
+   ^  - Score each reference base (column)
+   ^  o fun-01 sec-03 sub-01:
+   ^    - Score the cells in the column
+   ^  o fun-01 sec-03 sub-02:
+   ^    - Check if any lane has a new best score
+   \<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<*/
+
+   for(refUL = 0; refUL < lenRefUL; ++refUL)
+   { /*Loop: through all reference bases*/
+
+      /***************************************************\
+      * Fun-01 Sec-03 Sub-01:
+      *  - Score the cells in the column
+      \***************************************************/
+
+      refVect = vLoad(refVAry + refUL * defLanes);
+      hDiagVect = zeroVect;
+      fVect = minVect;
+      colMaxVect = zeroVect;
+      colPosVect = zeroVect;
+      posVect = zeroVect;
+
+      /*Padding (mask 0) never matches, so the padded cells
+      ` of shorter pairs are always below their best score
+      */
+      for(qryUL = 0; qryUL < lenQryUL; ++qryUL)
+      { /*Loop: through all query bases*/
+         hLeftVect = vLoad(hAry + qryUL * defLanes);
+
+         eVect =
+            vMax(
+               vAdd(hLeftVect, openVect),
+               vAdd(
+                  vLoad(eAry + qryUL * defLanes),
+                  extendVect
+               )
+            );
+
+         hVect =
+            vAdd(
+               hDiagVect,
+               vScore(
+                  vLoad(qryVAry + qryUL * defLanes),
+                  refVect,
+                  matchVect,
+                  snpVect
+               )
+            );
+
+         hVect = vMax(hVect, vMax(eVect, fVect));
+         hVect = vMax(hVect, zeroVect);
+
+         vStore(hAry + qryUL * defLanes, hVect);
+         vStore(eAry + qryUL * defLanes, eVect);
+         hDiagVect = hLeftVect;
+
+         fVect =
+            vMax(
+               vAdd(hVect, openVect),
+               vAdd(fVect, extendVect)
+            );
+
+         /*Keep the first (lowest) query base on ties*/
+         colPosVect =
+            vGtSel(hVect, colMaxVect, posVect, colPosVect);
+         colMaxVect = vMax(colMaxVect, hVect);
+         posVect = vAdd(posVect, oneVect);
+      } /*Loop: through all query bases*/
+
+      /***************************************************\
+      * Fun-01 Sec-03 Sub-02:
+      *  - Check if any lane has a new best score
+      \***************************************************/
+
+      if(! vGtAny(colMaxVect, bestVect)) continue;
+
+      vStore(colMaxAry, colMaxVect);
+      vStore(colPosAry, colPosVect);
+
+      for(laneUI = 0; laneUI < defLanes; ++laneUI)
+      { /*Loop: update lanes with a better score*/
+         if(colMaxAry[laneUI] <= bestAry[laneUI]) continue;
+
+         bestAry[laneUI] = colMaxAry[laneUI];
+         qryEndAry[laneUI] = colPosAry[laneUI];
+         refEndAry[laneUI] = refUL;
+      } /*Loop: update lanes with a better score*/
+
+      bestVect = vMax(bestVect, colMaxVect);
+   } /*Loop: through all reference bases*/
+} /*kernName*/
+
+#undef kernName
+#undef kernTarget
+#undef vectT
+#undef defLanes
+#undef vLoad
+#undef vStore
+#undef vSet1
+#undef vAdd
+#undef vMax
+#undef vScore
+#undef vGtSel
+#undef vGtAny
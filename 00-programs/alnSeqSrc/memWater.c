@@ -7,6 +7,7 @@
 #    used to find the actual alignment.
 # Includes:
 #   - "waterman.h"
+#   o "stripedAln.h"
 #   o "generalAlnFun.h"
 #   o "alnStruct.h"
 #   o "alnMatrixStruct.h"
@@ -32,11 +33,23 @@
 ' o fun-02 mamWaterAltAln:
 '   - Run a memory efficent Waterman Smith alignment that
 '     returns alternative alignmetns
+' o fun-03 altHeapSiftDown:
+'   - Moves the root of the top alternatives min heap down
+'     till the heap is in order (memWaterAltStream)
+' o fun-04 altHitKeep:
+'   - Prints an alternative alignment or adds it to the
+'     top alternatives heap (memWaterAltStream)
+' o fun-05 altHitPrintTop:
+'   - Prints the top alternatives heap from highest to
+'     lowest score (memWaterAltStream)
+' o fun-06 memWaterAltStream:
+'   - Run a memory efficent Waterman Smith alignment that
+'     prints alternative alignments as they are finished
 \~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~*/
 
 /*--------------------------------------------------------\
 | Name: memWaterAln
-| Call: memWaterAln(qryST, refST, settings);
+| Call: memWaterAln(qryST, refST, settings, profST);
 | Use:
 |   - Performs a memory efficent Smith Waterman alignment
 |     on a pair of sequences
@@ -53,6 +66,10 @@
 |     o alnSet structure with the setttings, such as
 |       gap open, gap extend, scoring matrix, and preffered
 |       direction.
+|   - profST:
+|     o stripedProf to reuse for the reference profile
+|       when aligning many queries to one reference
+|     o 0 to build a temporary profile
 | Output:
 |  - Returns:
 |    o scoresStruct with the best score
@@ -61,7 +78,11 @@
 struct scoresStruct * memWaterAln(
     struct seqStruct *qryST, /*query sequence*/
     struct seqStruct *refST, /*ref sequence*/
-    struct alnSet *settings  /*Settings for alignment*/
+    struct alnSet *settings, /*Settings for alignment*/
+    struct stripedProf *profST
+       /*Reference profile to reuse between alignments
+       ` (0 to use a temporary profile)
+       */
 ){ /*~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~\
    ' Fun-01 TOC: memWaterAln
    '  - Run a memory efficent Waterman Smith alignment on
@@ -174,6 +195,18 @@ struct scoresStruct * memWaterAln(
    if(bestScoreST == 0) return 0;
    initScoresST(bestScoreST);
 
+   /*Use the striped vector kernel if the cpu has one*/
+   switch(
+      stripedWaterScore(qryST,refST,settings,profST,bestScoreST)
+   ){ /*Switch: check if the vector alignment worked*/
+      case 0: return bestScoreST;
+
+      case 64:
+         freeScoresST(bestScoreST, 0);
+         return 0;
+   } /*Switch: check if the vector alignment worked*/
+     /*1 is no vector support, so use the scalar code*/
+
    scoreRowLP = calloc((lenRefUL + 1), sizeof(long));
    /*+ 1 is for the indel column*/
    if(scoreRowLP == 0)
@@ -588,6 +621,9 @@ struct scoresStruct * memWaterAln(
       scoreOnLP = scoreRowLP;
       ++qryIterStr; /*Move to the next query base*/
 
+      /*Do not score the end of string marker*/
+      if(qryIterStr > qryEndStr) break;
+
       /*Find the next score for an snp/match*/
       nextSnpSL = 
            getBaseScore(qryIterStr,refStartStr,settings)
@@ -1263,9 +1299,13 @@ struct alnMatrixStruct * memWaterAltAln(
       \**************************************************/
 
       /*Move to indel column and apply gap extension*/
+      scoreOnLP = scoreRowLP;
       *scoreOnLP = 0; /*First column is always insertion*/
       ++qryIterStr; /*Move to the next query base*/
 
+      /*Do not score the end of string marker*/
+      if(qryIterStr > qryEndStr) break;
+
       /*Find the next score for an snp/match*/
       nextSnpSL = 
            getBaseScore(qryIterStr,refStartStr,settings)
@@ -1370,3 +1410,899 @@ struct alnMatrixStruct * memWaterAltAln(
    return retMtxST;
 } /*memWaterAltAln*/
 
+
+/*--------------------------------------------------------\
+| Output:
+|  - Modifies:
+|    o heapAry to be a min heap again after the root was
+|      replaced
+\--------------------------------------------------------*/
+static void altHeapSiftDown(
+   struct altHit *heapAry,  /*Min heap (by score)*/
+   unsigned long numHeapUL  /*Number of hits in heapAry*/
+){ /*~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~\
+   ' Fun-03 TOC: altHeapSiftDown
+   '  - Moves the root of the top alternatives min heap
+   '    down till the heap is in order
+   \~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~*/
+
+   unsigned long parUL = 0;
+   unsigned long childUL = 1;
+   struct altHit swapST;
+
+   while(childUL < numHeapUL)
+   { /*Loop: till the parent is below both children*/
+      if(
+            childUL + 1 < numHeapUL
+         && heapAry[childUL + 1].scoreL
+            < heapAry[childUL].scoreL
+      ) ++childUL; /*Right child is the lower score*/
+
+      if(heapAry[parUL].scoreL <= heapAry[childUL].scoreL)
+         break;
+
+      swapST = heapAry[parUL];
+      heapAry[parUL] = heapAry[childUL];
+      heapAry[childUL] = swapST;
+
+      parUL = childUL;
+      childUL = (parUL << 1) + 1;
+   } /*Loop: till the parent is below both children*/
+} /*altHeapSiftDown*/
+
+/*--------------------------------------------------------\
+| Output:
+|  - Prints:
+|    o hitST to outFILE if topUL is 0
+|  - Modifies:
+|    o heapAry and numHeapUL to hold hitST if topUL is not
+|      0 and hitST is one of the topUL best alternatives.
+|      The lowest score is dropped when heapAry is full.
+|      Hits with the same start and end as a kept hit are
+|      not added.
+\--------------------------------------------------------*/
+static void altHitKeep(
+   struct altHit *hitST,     /*Finished alternative*/
+   struct altHit *heapAry,   /*Min heap of top hits*/
+   unsigned long *numHeapUL, /*Number of hits in heapAry*/
+   unsigned long topUL,      /*Max hits in heapAry*/
+   FILE *outFILE             /*Gets hitST if topUL is 0*/
+){ /*~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~\
+   ' Fun-04 TOC: altHitKeep
+   '  - Prints an alternative alignment or adds it to the
+   '    top alternatives heap
+   \~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~*/
+
+   unsigned long childUL = 0;
+   unsigned long parUL = 0;
+   struct altHit swapST;
+
+   if(topUL == 0)
+   { /*If printing every alternative*/
+      fprintf(
+         outFILE,
+         "Alt: %li %lu %lu %lu %lu\n",
+         hitST->scoreL,
+         (unsigned long) hitST->refStartUI,
+         (unsigned long) hitST->qryStartUI,
+         (unsigned long) hitST->refEndUI,
+         (unsigned long) hitST->qryEndUI
+      );
+
+      return;
+   } /*If printing every alternative*/
+
+   /*Ties keep the first alternative found*/
+   if(*numHeapUL >= topUL && hitST->scoreL <= heapAry->scoreL)
+      return;
+
+   /*The best alignment for a query base is often also the
+   ` best alignment for its last reference base. Only keep
+   ` it once, so the top hits are distinct.
+   */
+   for(childUL = 0; childUL < *numHeapUL; ++childUL)
+   { /*Loop: check if the hit is already in the heap*/
+      if(
+            heapAry[childUL].refStartUI == hitST->refStartUI
+         && heapAry[childUL].qryStartUI == hitST->qryStartUI
+         && heapAry[childUL].refEndUI == hitST->refEndUI
+         && heapAry[childUL].qryEndUI == hitST->qryEndUI
+      ) return; /*Already kept this alignment*/
+   } /*Loop: check if the hit is already in the heap*/
+
+   if(*numHeapUL < topUL)
+   { /*If the heap still has room*/
+      childUL = *numHeapUL;
+      heapAry[childUL] = *hitST;
+      ++(*numHeapUL);
+
+      while(childUL > 0)
+      { /*Loop: move the new hit up the heap*/
+         parUL = (childUL - 1) >> 1;
+
+         if(heapAry[parUL].scoreL <= heapAry[childUL].scoreL)
+            break;
+
+         swapST = heapAry[parUL];
+         heapAry[parUL] = heapAry[childUL];
+         heapAry[childUL] = swapST;
+         childUL = parUL;
+      } /*Loop: move the new hit up the heap*/
+
+      return;
+   } /*If the heap still has room*/
+
+   *heapAry = *hitST;
+   altHeapSiftDown(heapAry, *numHeapUL);
+} /*altHitKeep*/
+
+/*--------------------------------------------------------\
+| Output:
+|  - Prints:
+|    o Every hit in heapAry to outFILE (highest score
+|      first)
+|  - Modifies:
+|    o heapAry to be sorted from highest to lowest score
+\--------------------------------------------------------*/
+static void altHitPrintTop(
+   struct altHit *heapAry,  /*Min heap of top hits*/
+   unsigned long numHeapUL, /*Number of hits in heapAry*/
+   FILE *outFILE            /*File to print hits to*/
+){ /*~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~\
+   ' Fun-05 TOC: altHitPrintTop
+   '  - Prints the top alternatives heap from highest to
+   '    lowest score
+   \~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~*/
+
+   unsigned long lastUL = numHeapUL;
+   struct altHit swapST;
+
+   /*Heap sort: moving the lowest score to the end each
+   ` round leaves the array highest to lowest
+   */
+   while(lastUL > 1)
+   { /*Loop: sort the heap*/
+      --lastUL;
+      swapST = heapAry[0];
+      heapAry[0] = heapAry[lastUL];
+      heapAry[lastUL] = swapST;
+      altHeapSiftDown(heapAry, lastUL);
+   } /*Loop: sort the heap*/
+
+   for(lastUL = 0; lastUL < numHeapUL; ++lastUL)
+      fprintf(
+         outFILE,
+         "Alt: %li %lu %lu %lu %lu\n",
+         heapAry[lastUL].scoreL,
+         (unsigned long) heapAry[lastUL].refStartUI,
+         (unsigned long) heapAry[lastUL].qryStartUI,
+         (unsigned long) heapAry[lastUL].refEndUI,
+         (unsigned long) heapAry[lastUL].qryEndUI
+      );
+} /*altHitPrintTop*/
+
+/*--------------------------------------------------------\
+| Name: memWaterAltStream
+| Call: memWaterAltStream(
+|          qryST, refST, settings, bestScoreST, outFILE);
+| Use:
+|   - Performs a memory efficent Smith Waterman alignment
+|     that prints the best alignment ending on each query
+|     and reference base
+| Input;
+|   - qryST:
+|     o SeqStruct with the query sequence and index 0
+|       coordinates to start (offsetUL)/end (endAlnUL) the
+|       alignment
+|   - refST:
+|     o SeqStruct with the reference sequence and
+|       coordinates to start (offsetUL)/end (endAlnUL) the
+|       alignment
+|   - settings:
+|     o alnSet structure with the setttings, such as
+|       gap open, gap extend, min score, number of
+|       alternatives to keep, scoring matrix, and
+|       preffered direction.
+|   - bestScoreST:
+|     o scoresStruct to hold the best alignment
+|   - outFILE:
+|     o File to print the alternative alignments to
+| Output:
+|  - Prints:
+|    o Alternative alignments to outFILE
+|  - Modifies:
+|    o bestScoreST to have the best alignment
+|  - Returns:
+|    o 0 for success
+|    o 1 if coordinates do not fit in 32 bits
+|    o 64 for memory allocation errors
+\--------------------------------------------------------*/
+unsigned char memWaterAltStream(
+    struct seqStruct *qryST,   /*query sequence and data*/
+    struct seqStruct *refST,   /*ref sequence and data*/
+    struct alnSet *settings,   /*Settings for alignment*/
+    struct scoresStruct *bestScoreST, /*Gets best score*/
+    FILE *outFILE              /*Gets alternatives*/
+){ /*~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~\
+   ' Fun-06 TOC: memWaterAltStream
+   '  - Run a memory efficent Waterman Smith alignment that
+   '    prints alternative alignments as they are finished
+   '  o fun-06 sec-01:
+   '    - Variable declerations
+   '  o fun-06 sec-02:
+   '    - Allocate memory for alignment
+   '  o fun-06 sec-03:
+   '    - Fill in initial negatives for ref
+   '  o fun-06 sec-04:
+   '    - Fill the matrix with scores
+   '  o fun-06 sec-05:
+   '    - Print the reference alternatives and clean up
+   \~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~*/
+
+   /*>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>\
+   ^ Fun-06 Sec-01: Variable declerations
+   ^  o fun-06 sec-01 sub-01:
+   ^    - Variables dealing with the query and reference
+   ^      starting positions
+   ^  o fun-06 sec-01 sub-02:
+   ^    - Variables holding the scores (only two rows)
+   ^  o fun-06 sec-01 sub-03:
+   ^    - Directinol matrix variables
+   ^  o fun-06 sec-01 sub-04:
+   ^    - Variables for the alternative alignments
+   \<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<*/
+
+   /******************************************************\
+   * Fun-06 Sec-01 Sub-01:
+   *  - Variables dealing with the query and reference
+   *    starting positions
+   \******************************************************/
+
+   /*Get start & end of the query and reference sequences*/
+   char *refStartStr = refST->seqCStr + refST->offsetUL;
+   char *refEndStr = refST->seqCStr + refST->endAlnUL;
+
+   char *qryStartStr = qryST->seqCStr + qryST->offsetUL;
+   char *qryEndStr = qryST->seqCStr + qryST->endAlnUL;
+
+   char *qryIterStr = 0;
+   char *refIterStr = 0;
+
+   unsigned long lenRefUL =
+       refST->endAlnUL - refST->offsetUL + 1;
+     /*The + 1 is to account for index 0 of endAlnUL*/
+
+   unsigned long lenQryUL =
+       qryST->endAlnUL - qryST->offsetUL + 1;
+
+   /******************************************************\
+   * Fun-06 Sec-01 Sub-02:
+   *  - Variables holding the scores (only two rows)
+   \******************************************************/
+
+   long insScoreL = 0;   /*Score for doing an insertion*/
+   long snpScoreL = 0;   /*Score for doing an match/snp*/
+   long delScoreL = 0;   /*Score for doing an deletion*/
+   long nextSnpSL = 0;   /*Score for the next match/snp*/
+
+   long *scoreRowLP = 0; /*matrix to use in alignment*/
+   long *scoreOnLP = 0;  /*Score I am working on*/
+
+   /******************************************************\
+   * Fun-06 Sec-01 Sub-03:
+   *  - Directinol matrix variables
+   \******************************************************/
+
+   /*Direction matrix (one cell holds a single direction)*/
+   #if defined TWOBITMSW
+      struct twoBitAry *dirRow = 0;/*Holds directions*/
+      unsigned char lastDirC = 0;
+      unsigned char lastLastDirC = 0;
+   #else
+      char *dirRow = 0;  /*Holds directions*/
+      char *firstDir = 0; /*Holds directions*/
+      char lastDirC = 0;
+      char lastLastDirC = 0;
+   #endif
+
+   /******************************************************\
+   * Fun-06 Sec-01 Sub-04:
+   *  - Variables for the alternative alignments
+   \******************************************************/
+
+   /*For recording the start position (32 bit)*/
+   uint32_t *refStartUI = 0;
+   uint32_t *qryStartUI = 0;
+   uint32_t *refStartFirstIndexUI = 0;
+   uint32_t *qryStartFirstIndexUI = 0;
+   uint32_t lastRefStartUI = refST->offsetUL;
+   uint32_t lastQryStartUI = qryST->offsetUL;
+
+   /*Best alignment ending on each reference base. The
+   ` query base best is printed when its row is done, so
+   ` only one is needed.
+   */
+   struct altHit *refHitAry = 0;
+   struct altHit *refHitST = 0;
+   struct altHit qryHitST;
+
+   /*Top alternatives (min heap) when altTopUL is not 0*/
+   struct altHit *heapAry = 0;
+   unsigned long numHeapUL = 0;
+   unsigned long topUL = settings->altTopUL;
+
+   /*>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>\
+   ^ Fun-06 Sec-02:
+   ^  - Allocate memory for alignment
+   ^  o fun-06 sec-02 sub-01:
+   ^    - Check the coordinates fit in 32 bits
+   ^  o fun-06 sec-02 sub-02:
+   ^    - Allocate memory for the alignment
+   ^  o fun-06 sec-02 sub-03:
+   ^    - Allocate memory for alternative alignments
+   \<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<*/
+
+   /******************************************************\
+   * Fun-06 Sec-02 Sub-01:
+   *  - Check the coordinates fit in 32 bits
+   \******************************************************/
+
+   if(
+         refST->endAlnUL > UINT32_MAX
+      || qryST->endAlnUL > UINT32_MAX
+   ) return 1;
+
+   initScoresST(bestScoreST);
+
+   /*There can never be more alternatives than reference
+   ` and query bases
+   */
+   if(topUL > lenRefUL + lenQryUL)
+      topUL = lenRefUL + lenQryUL;
+
+   /******************************************************\
+   * Fun-06 Sec-02 Sub-02:
+   *  - Allocate memory for the alignment
+   \******************************************************/
+
+   scoreRowLP = calloc((lenRefUL + 1), sizeof(long));
+   /*+ 1 is for the indel column*/
+   if(scoreRowLP == 0) goto memErr;
+
+   #if defined TWOBITMSW
+      dirRow = makeTwoBit(lenRefUL+1 , 0);
+   #else
+      dirRow = calloc(lenRefUL + 1 ,sizeof(char));
+      firstDir = dirRow;
+   #endif
+
+   if(dirRow == 0) goto memErr;
+
+   /******************************************************\
+   * Fun-06 Sec-02 Sub-03:
+   *  - Allocate memory for alternative alignments
+   \******************************************************/
+
+   refStartUI = calloc(lenRefUL, sizeof(uint32_t));
+   refStartFirstIndexUI = refStartUI;
+   if(refStartUI == 0) goto memErr;
+
+   /*One query position recoreded per refference position*/
+   qryStartUI = calloc(lenRefUL, sizeof(uint32_t));
+   qryStartFirstIndexUI = qryStartUI;
+   if(qryStartUI == 0) goto memErr;
+
+   /*calloc sets every score to 0 (no alternative)*/
+   refHitAry = calloc(lenRefUL, sizeof(struct altHit));
+   if(refHitAry == 0) goto memErr;
+
+   if(topUL > 0)
+   { /*If only keeping the best alternatives*/
+      heapAry = malloc(topUL * sizeof(struct altHit));
+      if(heapAry == 0) goto memErr;
+   } /*If only keeping the best alternatives*/
+
+   /*Print out the alternative alignment header*/
+   fprintf(outFILE, "Alt: score fristRefBase ");
+   fprintf(outFILE, " firstQueryBase lastRefBase");
+   fprintf(outFILE, " lastQueryBase\n");
+
+   /*>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>\
+   ^ Fun-06 Sec-03:
+   ^  - Fill in initial negatives for reference
+   \<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<*/
+
+   /*Fill in the indel column in the indel row*/
+   #if defined TWOBITMSW
+      changeTwoBitElm(dirRow, defMvStop);
+      twoBitMvToNextElm(dirRow);
+   #else
+      *dirRow = defMvStop;
+      ++dirRow;
+   #endif
+
+   refIterStr = refStartStr;
+   while(refIterStr <= refEndStr)
+   { /*loop; till have initalized the first row*/
+     #if defined TWOBITMSW
+        changeTwoBitElm(dirRow, defMvStop);
+        twoBitMvToNextElm(dirRow);
+     #else
+        *dirRow = defMvStop;
+        ++dirRow;
+     #endif
+
+     ++refIterStr; /*Move though the next base*/
+   } /*loop; till have initalized the first row*/
+
+   /*>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>\
+   ^ Fun-06 Sec-04:
+   ^  - Fill the matrix with scores
+   ^  o fun-06 sec-04 sub-01:
+   ^    - Get the initial scores
+   ^  o fun-06 sec-04 sub-02:
+   ^    - Do the first move
+   ^  o fun-06 sec-04 sub-03:
+   ^    - Fill out the matrix
+   ^  o fun-06 sec-04 sub-04:
+   ^    - Find the next matches score
+   ^  o fun-06 sec-04 sub-05:
+   ^    - Find the best score for the last round
+   ^  o fun-06 sec-04 sub-06:
+   ^    - Find the score for the next deletion
+   ^  o fun-06 sec-04 sub-07:
+   ^    - Check if is an alternative base best score
+   ^  o fun-06 sec-04 sub-08:
+   ^    - Move to the next reference base
+   ^  o fun-06 sec-04 sub-09:
+   ^    - Find the scores for the next insertion
+   ^  o fun-06 sec-04 sub-10:
+   ^    - Find the best score for the last base
+   ^  o fun-06 sec-04 sub-11:
+   ^    - Is the last base in row an alternative alignment?
+   ^  o fun-06 sec-04 sub-12:
+   ^    - The query base alternative is finished; print it
+   ^  o fun-06 sec-04 sub-13:
+   ^    - Move to the indel column
+   ^  o fun-06 sec-04 sub-14:
+   ^    - Find the scores for the first base in the row
+   \<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<*/
+
+   /******************************************************\
+   * Fun-06 Sec-04 Sub-01:
+   *  - Get the initial scores
+   \******************************************************/
+
+   #if defined TWOBITMSW
+      twoBitMvXElmFromStart(dirRow, 0);
+   #else
+      dirRow = firstDir;
+   #endif
+
+   qryIterStr = qryStartStr;
+   refIterStr = refStartStr;
+   scoreOnLP = scoreRowLP;
+   refStartUI = refStartFirstIndexUI;
+   qryStartUI = qryStartFirstIndexUI;
+   refHitST = refHitAry;
+   qryHitST.scoreL = 0;
+
+   nextSnpSL =
+        getBaseScore(qryIterStr, refIterStr, settings)
+      + *scoreOnLP;
+
+   /*These are always negative*/
+   *scoreOnLP = 0;
+   delScoreL = 0;
+   insScoreL = 0;
+   lastLastDirC = 0;
+   ++scoreOnLP;
+
+   /******************************************************\
+   * Fun-06 Sec-04 Sub-02:
+   *  - Do the first move
+   \******************************************************/
+
+   #if defined TWOBITMSW
+      changeTwoBitElm(dirRow, defMvStop);
+      twoBitMvToNextElm(dirRow);
+   #else
+     *dirRow = defMvStop;
+     ++dirRow;
+   #endif
+
+   /******************************************************\
+   * Fun-06 Sec-04 Sub-03:
+   *  - Fill out the matrix
+   \******************************************************/
+
+   /*Starting on the first sequence row*/
+   while(qryIterStr <= qryEndStr)
+   { /*loop; compare query base against all ref bases*/
+
+     refIterStr = refStartStr + 1;
+
+     /*First reference bases column*/
+     while(refIterStr <= refEndStr)
+     { /* loop; compare one query to one reference base*/
+
+       /**************************************************\
+       * Fun-06 Sec-04 Sub-04:
+       *  - Find the next matches score
+       \**************************************************/
+
+       snpScoreL = nextSnpSL;
+
+       nextSnpSL =
+          getBaseScore(
+              qryIterStr,
+              refIterStr,
+              settings
+       ); /*Find the score for the two base pairs*/
+
+       nextSnpSL += *scoreOnLP;
+
+       /**************************************************\
+       * Fun-06 Sec-04 Sub-05:
+       *  - Find the best score for the last round
+       \**************************************************/
+
+       lastDirC = lastLastDirC;
+       #if defined TWOBITMSW
+          lastLastDirC = getTwoBitElm(dirRow);
+          waterTwoBitMaxScore(
+            dirRow,
+            settings,
+            &insScoreL,
+            &snpScoreL,
+            &delScoreL,
+            scoreOnLP
+          ); /*Update the scores*/
+
+       #else
+          lastLastDirC = *dirRow;
+          waterByteMaxScore(
+            dirRow,
+            settings,
+            &insScoreL,
+            &snpScoreL,
+            &delScoreL,
+            scoreOnLP
+          ); /*Update the scores*/
+       #endif
+
+       /**************************************************\
+       * Fun-06 Sec-04 Sub-06:
+       *  - Find the the next deletion score
+       \**************************************************/
+
+       #if defined TWOBITMSW && !defined NOGAPOPEN
+          indelScore(
+             delScoreL,
+             getTwoBitElm(dirRow),
+             *scoreOnLP,
+             settings
+          );
+       #elif !defined NOGAPOPEN
+          indelScore(
+             delScoreL,
+             *dirRow,
+             *scoreOnLP,
+             settings
+          );
+       #else
+          delScoreL = *scoreOnLP + settings->gapExtendI;
+       #endif
+
+       /**************************************************\
+       * Fun-06 Sec-04 Sub-07:
+       *  - Check if is an alternative base best score
+       \**************************************************/
+
+       updateStartPos(
+          #if defined TWOBITMSW
+             getTwoBitElm(dirRow),
+          #else
+             *dirRow,
+          #endif
+          lastDirC,
+          lastRefStartUI,
+          lastQryStartUI,
+          refStartUI,
+          qryStartUI,
+          refIterStr - 1,
+          refST->seqCStr,
+          qryIterStr,
+          qryST->seqCStr
+       ); /*macro in water.h*/
+
+       if(
+             *scoreOnLP >= settings->minScoreL
+          && *scoreOnLP > qryHitST.scoreL
+       ){ /*If this is the best score for the query base*/
+          qryHitST.scoreL = *scoreOnLP;
+          qryHitST.refStartUI = *refStartUI;
+          qryHitST.qryStartUI = *qryStartUI;
+          qryHitST.refEndUI =
+             refIterStr - refST->seqCStr - 1;
+          qryHitST.qryEndUI = qryIterStr - qryST->seqCStr;
+       } /*If this is the best score for the query base*/
+
+       if(
+             *scoreOnLP >= settings->minScoreL
+          && *scoreOnLP > refHitST->scoreL
+       ){ /*If this is the best score for the ref base*/
+          refHitST->scoreL = *scoreOnLP;
+          refHitST->refStartUI = *refStartUI;
+          refHitST->qryStartUI = *qryStartUI;
+          refHitST->refEndUI =
+             refIterStr - refST->seqCStr - 1;
+          refHitST->qryEndUI = qryIterStr - qryST->seqCStr;
+       } /*If this is the best score for the ref base*/
+
+       if(*scoreOnLP > bestScoreST->scoreL)
+       { /*If this is the current best score*/
+          bestScoreST->scoreL = *scoreOnLP;
+
+          bestScoreST->refStartUL = *refStartUI;
+          bestScoreST->qryStartUL = *qryStartUI;
+
+          bestScoreST->refEndUL =
+            refIterStr - refST->seqCStr - 1;
+          bestScoreST->qryEndUL= qryIterStr-qryST->seqCStr;
+       } /*If this is the current best score*/
+
+       /***********************************************\
+       * Fun-06 Sec-04 Sub-08:
+       *  - Move to next reference base
+       \***********************************************/
+
+       ++refHitST;
+       ++refStartUI;
+       ++qryStartUI;
+       ++refIterStr; /*Move to next reference base*/
+       ++scoreOnLP;  /*Move to the next score*/
+
+       #if defined TWOBITMSW
+          twoBitMvToNextElm(dirRow);
+       #else
+          ++dirRow;
+       #endif
+
+       /**************************************************\
+       * Fun-06 Sec-04 Sub-09:
+       *  - Find the the next insertion score
+       \**************************************************/
+
+       #if defined TWOBITMSW && !defined NOGAPOPEN
+          indelScore(
+             insScoreL,
+             getTwoBitElm(dirRow),
+             *scoreOnLP,
+             settings
+          );
+       #elif !defined NOGAPOPEN
+          indelScore(
+             insScoreL,
+             *dirRow,
+             *scoreOnLP,
+             settings
+          );
+       #else
+          insScoreL = *scoreOnLP + settings->gapExtendI;
+       #endif
+     } /*loop; compare one query to one reference base*/
+
+     /****************************************************\
+     * Fun-06 Sec-04 Sub-10:
+     *  - Find the best score for the last base
+     \****************************************************/
+
+     lastDirC = lastLastDirC;
+     #if defined TWOBITMSW
+        waterTwoBitMaxScore(
+          dirRow,
+          settings,
+          &insScoreL,
+          &nextSnpSL,
+          &delScoreL,
+          scoreOnLP
+        ); /*Update the score and direction*/
+     #else
+        waterByteMaxScore(
+          dirRow,
+          settings,
+          &insScoreL,
+          &nextSnpSL,
+          &delScoreL,
+          scoreOnLP
+        ); /*Update the score and direction*/
+     #endif
+
+     /****************************************************\
+     * Fun-06 Sec-04 Sub-11:
+     *  - Is the last base in row an alternative alignment?
+     \****************************************************/
+
+     updateStartPos(
+        #if defined TWOBITMSW
+           getTwoBitElm(dirRow),
+        #else
+           *dirRow,
+        #endif
+        lastDirC,
+        lastRefStartUI,
+        lastQryStartUI,
+        refStartUI,
+        qryStartUI,
+        refIterStr - 1,
+        refST->seqCStr,
+        qryIterStr,
+        qryST->seqCStr
+     );
+
+     if(
+           *scoreOnLP >= settings->minScoreL
+        && *scoreOnLP > qryHitST.scoreL
+     ){ /*If this is the best score for the query base*/
+        qryHitST.scoreL = *scoreOnLP;
+        qryHitST.refStartUI = *refStartUI;
+        qryHitST.qryStartUI = *qryStartUI;
+        qryHitST.refEndUI = refIterStr - refST->seqCStr - 1;
+        qryHitST.qryEndUI = qryIterStr - qryST->seqCStr;
+     } /*If this is the best score for the query base*/
+
+     if(
+           *scoreOnLP >= settings->minScoreL
+        && *scoreOnLP > refHitST->scoreL
+     ){ /*If this is the best score for the ref base*/
+        refHitST->scoreL = *scoreOnLP;
+        refHitST->refStartUI = *refStartUI;
+        refHitST->qryStartUI = *qryStartUI;
+        refHitST->refEndUI = refIterStr - refST->seqCStr - 1;
+        refHitST->qryEndUI = qryIterStr - qryST->seqCStr;
+     } /*If this is the best score for the ref base*/
+
+     if(*scoreOnLP > bestScoreST->scoreL)
+     { /*If this is the current best score*/
+        bestScoreST->scoreL = *scoreOnLP;
+
+        bestScoreST->refStartUL = *refStartUI;
+        bestScoreST->qryStartUL = *qryStartUI;
+
+        bestScoreST->refEndUL= refIterStr-refST->seqCStr-1;
+        bestScoreST->qryEndUL= qryIterStr-qryST->seqCStr;
+     } /*If this is the current best score*/
+
+     /****************************************************\
+     * Fun-06 Sec-04 Sub-12:
+     *  - The query base alternative is finished; print it
+     \****************************************************/
+
+     /*No later cell can end on this query base*/
+     if(qryHitST.scoreL > 0)
+        altHitKeep(
+           &qryHitST,
+           heapAry,
+           &numHeapUL,
+           topUL,
+           outFILE
+        );
+
+     qryHitST.scoreL = 0;
+     refHitST = refHitAry;
+     refStartUI = refStartFirstIndexUI;
+     qryStartUI = qryStartFirstIndexUI;
+
+     /**************************************************\
+     *  Fun-06 Sec-04 Sub-13:
+     *   - Move to the indel column
+     \**************************************************/
+
+      #if defined TWOBITMSW
+         twoBitMvXElmFromStart(dirRow, 0);
+         changeTwoBitElm(dirRow, defMvStop);
+         twoBitMvToNextElm(dirRow);
+      #else
+         dirRow = firstDir;
+         *dirRow = defMvStop;
+         ++dirRow;
+      #endif
+
+      /**************************************************\
+      * Fun-06 Sec-04 Sub-14:
+      *  - Find the scores for the first base in the row
+      \**************************************************/
+
+      /*Move to indel column and apply gap extension*/
+      scoreOnLP = scoreRowLP;
+      ++qryIterStr; /*Move to the next query base*/
+
+      /*Do not score the end of string marker*/
+      if(qryIterStr > qryEndStr) break;
+
+      /*Find the next score for an snp/match*/
+      nextSnpSL = 
+           getBaseScore(qryIterStr,refStartStr,settings)
+         + *scoreOnLP;
+
+      /*Update the indel column and find next deletion*/
+      lastLastDirC = 0;
+      *scoreOnLP = 0; /*First column is always insertion*/
+      delScoreL = *scoreOnLP + settings->gapExtendI;
+      ++scoreOnLP; /*Move to the first base pair*/
+
+     #if defined TWOBITMSW && !defined NOGAPOPEN
+        indelScore(
+           insScoreL,
+           getTwoBitElm(dirRow),
+           *scoreOnLP,
+           settings
+        );
+     #elif !defined NOGAPOPEN
+        indelScore(
+           insScoreL,
+           *dirRow,
+           *scoreOnLP,
+           settings
+        );
+     #else
+        insScoreL = *scoreOnLP + settings->gapExtendI;
+     #endif
+   } /*loop; compare query base against all ref bases*/
+
+   /*>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>\
+   ^ Fun-06 Sec-05:
+   ^  - Print the reference alternatives and clean up
+   \<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<*/
+
+   /*The reference base alternatives are only finished
+   ` after the last query base
+   */
+   for(
+      refHitST = refHitAry;
+      refHitST < refHitAry + lenRefUL;
+      ++refHitST
+   ){ /*Loop: print the reference base alternatives*/
+      if(refHitST->scoreL > 0)
+         altHitKeep(
+            refHitST,
+            heapAry,
+            &numHeapUL,
+            topUL,
+            outFILE
+         );
+   } /*Loop: print the reference base alternatives*/
+
+   if(topUL > 0) altHitPrintTop(heapAry, numHeapUL, outFILE);
+
+   #if defined TWOBITMSW
+      freeTwoBit(dirRow, 0, 0); /*0 frees everything*/
+   #else
+      free(firstDir);
+   #endif
+
+   free(scoreRowLP);
+   free(refStartFirstIndexUI);
+   free(qryStartFirstIndexUI);
+   free(refHitAry);
+   free(heapAry);
+
+   return 0;
+
+   memErr:
+
+   #if defined TWOBITMSW
+      if(dirRow != 0) freeTwoBit(dirRow, 0, 0);
+   #else
+      free(firstDir);
+   #endif
+
+   free(scoreRowLP);
+   free(refStartFirstIndexUI);
+   free(qryStartFirstIndexUI);
+   free(refHitAry);
+   free(heapAry);
+
+   return 64;
+} /*memWaterAltStream*/
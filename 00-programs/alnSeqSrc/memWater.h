@@ -7,6 +7,7 @@
 #    used to find the actual alignment.
 # Includes:
 #   - "waterman.h"
+#   - "stripedAln.h"
 #   o "generalAlnFun.h"
 #   o "alnStruct.h"
 #   o "alnMatrixStruct.h"
@@ -26,20 +27,42 @@
 #define MEMWATER_H
 
 #include "waterman.h"
+#include "stripedAln.h"
 
 /*~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~\
 ' memWater SOH: Start Of Header
+' o st-01 altHit:
+'   - Compact alternative alignment (32 bit coordinates)
 ' o fun-01 memWaterAln:
 '   - Run a memory efficent Waterman Smith alignment on
 '     input sequences
 ' o fun-02 mamWaterAltAln:
 '   - Run a memory efficent Waterman Smith alignment that
 '     returns alternative alignmetns
+' o fun-06 memWaterAltStream:
+'   - Run a memory efficent Waterman Smith alignment that
+'     prints alternative alignments as they are finished
 \~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~*/
 
+/*--------------------------------------------------------\
+| ST-01: altHit
+|  - Holds one alternative alignment for
+|    memWaterAltStream. Uses 32 bit coordinates, so it is
+|    a little over half the size of a scoresStruct.
+|  - Coordinates are index 0
+\--------------------------------------------------------*/
+typedef struct altHit
+{ /*altHit*/
+   long scoreL;          /*Score of the alignment*/
+   uint32_t refStartUI;  /*First reference base*/
+   uint32_t qryStartUI;  /*First query base*/
+   uint32_t refEndUI;    /*Last reference base*/
+   uint32_t qryEndUI;    /*Last query base*/
+}altHit;
+
 /*--------------------------------------------------------\
 | Name: memWaterAln
-| Call: memWaterAln(qryST, refST, settings);
+| Call: memWaterAln(qryST, refST, settings, profST);
 | Use:
 |   - Performs a memory efficent Smith Waterman alignment
 |     on a pair of sequences
@@ -56,6 +79,10 @@
 |     o alnSet structure with the setttings, such as
 |       gap open, gap extend, scoring matrix, and preffered
 |       direction.
+|   - profST:
+|     o stripedProf to reuse for the reference profile
+|       when aligning many queries to one reference
+|     o 0 to build a temporary profile
 | Output:
 |  - Returns:
 |    o scoresStruct with the best score
@@ -64,7 +91,11 @@
 struct scoresStruct * memWaterAln(
     struct seqStruct *qryST, /*query sequence*/
     struct seqStruct *refST, /*ref sequence*/
-    struct alnSet *settings  /*Settings for alignment*/
+    struct alnSet *settings, /*Settings for alignment*/
+    struct stripedProf *profST
+       /*Reference profile to reuse between alignments
+       ` (0 to use a temporary profile)
+       */
 ); /*~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~\
    ' Fun-01 TOC: WatermanAltAln
    '  - Run a Waterman Smith alignment on input sequences
@@ -130,4 +161,74 @@ struct alnMatrixStruct * memWaterAltAln(
    '    - Set up for returing the matrix (clean up/wrap up)
    \~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~*/
 
+/*--------------------------------------------------------\
+| Name: memWaterAltStream
+| Call: memWaterAltStream(
+|          qryST, refST, settings, bestScoreST, outFILE);
+| Use:
+|   - Performs a memory efficent Smith Waterman alignment
+|     that finds the best alignment ending on each query
+|     and reference base (same as memWaterAltAln), but
+|     prints the alternatives instead of returning them
+| Input;
+|   - qryST:
+|     o SeqStruct with the query sequence and index 0
+|       coordinates to start (offsetUL)/end (endAlnUL) the
+|       alignment
+|   - refST:
+|     o SeqStruct with the reference sequence and
+|       coordinates to start (offsetUL)/end (endAlnUL) the
+|       alignment
+|   - settings:
+|     o alnSet structure with the setttings, such as
+|       gap open, gap extend, min score (minScoreL), number
+|       of alternatives to keep (altTopUL), scoring matrix,
+|       and preffered direction.
+|   - bestScoreST:
+|     o scoresStruct to hold the best alignment
+|   - outFILE:
+|     o File to print the alternative alignments to
+| Output:
+|  - Prints:
+|    o The alternative alignments as "Alt:" lines (same
+|      format as printAltWaterAlns) to outFILE
+|      - altTopUL = 0: The query base alternatives are
+|        printed as each query row is finished, then the
+|        reference base alternatives are printed
+|      - altTopUL > 0: Only the altTopUL highest scoring
+|        alternatives are printed (highest first)
+|  - Modifies:
+|    o bestScoreST to have the best score and coordinates
+|  - Returns:
+|    o 0 for success
+|    o 1 if a coordinate will not fit in 32 bits (use
+|      memWaterAltAln)
+|    o 64 for memory allocation errors
+| Note:
+|  - Memory is O(reference length) + O(altTopUL), where
+|    memWaterAltAln is O(reference + query length) with
+|    twice the bytes per alternative
+\--------------------------------------------------------*/
+unsigned char memWaterAltStream(
+    struct seqStruct *qryST,   /*query sequence and data*/
+    struct seqStruct *refST,   /*ref sequence and data*/
+    struct alnSet *settings,   /*Settings for alignment*/
+    struct scoresStruct *bestScoreST, /*Gets best score*/
+    FILE *outFILE              /*Gets alternatives*/
+); /*~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~\
+   ' Fun-06 TOC: memWaterAltStream
+   '  - Run a memory efficent Waterman Smith alignment that
+   '    prints alternative alignments as they are finished
+   '  o fun-06 sec-01:
+   '    - Variable declerations
+   '  o fun-06 sec-02:
+   '    - Allocate memory for alignment
+   '  o fun-06 sec-03:
+   '    - Fill in initial negatives for ref
+   '  o fun-06 sec-04:
+   '    - Fill the matrix with scores
+   '  o fun-06 sec-05:
+   '    - Print the reference alternatives and clean up
+   \~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~*/
+
 #endif
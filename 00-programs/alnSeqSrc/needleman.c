@@ -94,18 +94,26 @@ struct alnMatrixStruct * NeedlemanAln(
    long *scoreOnLP = 0;  /*Score I am working on*/
 
    /*Direction matrix (one cell holds a single direction)*/
-   #if !defined BYTEMATRIX && !defined NOGAPOPEN
-      struct twoBitAry *dirMatrix = 0;/*Direction matrix*/
-      struct twoBitAry insDir;     /*Direction above cell*/
-   #elif !defined BYTEMATRIX
-      struct twoBitAry *dirMatrix = 0;/*Direction matrix*/
-   #elif !defined NOGAPOPEN 
+   #if !defined NOGAPOPEN 
       char *dirMatrix = 0;/*Direction matrix*/
       char *insDir;       /*Direction above cell*/
    #else
       char *dirMatrix = 0;    /*Direction matrix*/
    #endif
 
+   /*For two bit matrixes the directions for a row are
+   ` found in a byte row (dirMatrix points to) and then
+   ` packed into the two bit matrix a limb at a time.
+   */
+   #if !defined BYTEMATRIX
+      struct twoBitAry *dirMatrixST = 0; /*Packed matrix*/
+      char *dirRowStr = 0;   /*Memory for both rows*/
+      char *rowOnStr = 0;    /*Row finding directions for*/
+      char *lastRowStr = 0;  /*Row above rowOnStr*/
+      char *swapStr = 0;     /*For swapping rows*/
+      unsigned long rowUL = 0; /*Row on in dirMatrixST*/
+   #endif
+
    /*Structure to return*/
    struct alnMatrixStruct *retMtxST = 0;
 
@@ -130,25 +138,47 @@ struct alnMatrixStruct * NeedlemanAln(
    } /*If I had a memory error*/
 
    #if !defined BYTEMATRIX
-      dirMatrix=
-         makeTwoBit((lenRefUL+1) * (lenQryUL+1) + 2,0);
-     /* Calls calloc and adds an extra element at end
-     `  - lenRefUL + 1 accounts for insertion reference row
-     `  - lenQeurI + 1 accounts for insertion query column
+      dirMatrixST =
+         makeTwoBitMtrx(lenQryUL + 1, lenRefUL + 1);
+     /* Calls calloc; each row starts on a new limb
+     `  - lenRefUL + 1 accounts for insertion query column
+     `  - lenQeurI + 1 accounts for deletion reference row
      */
+
+      if(dirMatrixST == 0)
+      { /*If I do not have a direction matrix*/
+        freeAlnMatrixST(retMtxST);
+        free(scoreRowLP);
+        return 0;
+      } /*If I do not have a direction matrix*/
+
+      retMtxST->dirMatrixST = dirMatrixST;
+
+      dirRowStr = malloc(((lenRefUL + 1) << 1) * sizeof(char));
+
+      if(dirRowStr == 0)
+      { /*If I do not have the direction rows*/
+        freeAlnMatrixST(retMtxST);
+        free(scoreRowLP);
+        return 0;
+      } /*If I do not have the direction rows*/
+
+      rowOnStr = dirRowStr;
+      lastRowStr = dirRowStr + lenRefUL + 1;
+      dirMatrix = rowOnStr;
    #else
       dirMatrix =
          calloc((lenRefUL+1) *(lenQryUL+1)+2,sizeof(char));
-   #endif
 
-   if(dirMatrix == 0)
-   { /*If I do not have a direction matrix for each cell*/
-     freeAlnMatrixST(retMtxST);
-     free(scoreRowLP);
-     return 0;
-   } /*If I do not have a direction matrix for each cell*/
+      if(dirMatrix == 0)
+      { /*If I do not have a direction matrix for each cell*/
+        freeAlnMatrixST(retMtxST);
+        free(scoreRowLP);
+        return 0;
+      } /*If I do not have a direction matrix for each cell*/
 
-   retMtxST->dirMatrixST = dirMatrix;
+      retMtxST->dirMatrixST = dirMatrix;
+   #endif
 
    /*>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>\
    ^ Fun-01 Sec-03:
@@ -161,26 +191,15 @@ struct alnMatrixStruct * NeedlemanAln(
    ++scoreOnLP;            /*Move to next cell (score)*/
 
    /*The insertion/match/snp score is on the previous row*/
-   #if !defined BYTEMATRIX
-      #if !defined NOGAPOPEN
-         cpTwoBitPos(dirMatrix, &insDir);
-      #endif
-
-      changeTwoBitElm(dirMatrix, defMvStop);
-      twoBitMvToNextElm(dirMatrix);
-      changeTwoBitElm(dirMatrix, defMvDel);
-      twoBitMvToNextElm(dirMatrix);
-   #else
-      #if !defined NOGAPOPEN
-         insDir = dirMatrix;
-      #endif
-
-      *dirMatrix = defMvStop;
-      ++dirMatrix;
-      *dirMatrix = defMvDel;
-      ++dirMatrix;
+   #if !defined NOGAPOPEN
+      insDir = dirMatrix;
    #endif
 
+   *dirMatrix = defMvStop;
+   ++dirMatrix;
+   *dirMatrix = defMvDel;
+   ++dirMatrix;
+
    /*2nd score (first indel in matrix)*/
    #ifdef NOGAPOPEN
       *scoreOnLP = settings->gapExtendI;
@@ -197,18 +216,28 @@ struct alnMatrixStruct * NeedlemanAln(
      *scoreOnLP = *(scoreOnLP - 1) + settings->gapExtendI;
 
      /*Move to the next cell (ref base)*/
-     #if !defined BYTEMATRIX
-        changeTwoBitElm(dirMatrix, defMvDel);
-        twoBitMvToNextElm(dirMatrix);
-     #else
-        *dirMatrix = defMvDel;
-        ++dirMatrix;
-     #endif
+     *dirMatrix = defMvDel;
+     ++dirMatrix;
 
      ++scoreOnLP;
      ++refIterStr;
    } /*loop; till have initalized the first row*/
 
+   #if !defined BYTEMATRIX
+      /*Save the first row and move to the next row*/
+      twoBitPackRow(dirMatrixST, 0, rowOnStr, lenRefUL + 1);
+
+      swapStr = rowOnStr;
+      rowOnStr = lastRowStr;
+      lastRowStr = swapStr;
+
+      dirMatrix = rowOnStr;
+
+      #if !defined NOGAPOPEN
+         insDir = lastRowStr;
+      #endif
+   #endif
+
    /*>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>\
    ^ Fun-01 Sec-04:
    ^  - Fill the matrix with scores
@@ -258,15 +287,7 @@ struct alnMatrixStruct * NeedlemanAln(
    ++scoreOnLP;
    insScoreL = *scoreOnLP + settings->gapExtendI;
 
-   #if !defined BYTEMATRIX && !defined NOGAPOPEN
-      changeTwoBitElm(dirMatrix, defMvIns);
-      twoBitMvToNextElm(dirMatrix);
-      twoBitMvToNextElm(&insDir);
-      twoBitMvToNextElm(&insDir);
-   #elif !defined BYTEMATRIX
-      changeTwoBitElm(dirMatrix, defMvIns);
-      twoBitMvToNextElm(dirMatrix);
-   #elif !defined NOGAPOPEN
+   #if !defined NOGAPOPEN
      *dirMatrix = defMvIns;
      ++dirMatrix;
      insDir += 2;
@@ -311,38 +332,20 @@ struct alnMatrixStruct * NeedlemanAln(
            nextSnpSL += *scoreOnLP;
 
            /*Find the best score*/
-           #if !defined BYTEMATRIX
-              twoBitMaxScore(
-                dirMatrix,
-                settings,
-                &insScoreL,
-                &snpScoreL,
-                &delScoreL,
-                scoreOnLP
-              ); /*Update the score and direction*/
-           #else
-              charMaxScore(
-                dirMatrix,
-                settings,
-                &insScoreL,
-                &snpScoreL,
-                &delScoreL,
-                scoreOnLP
-              ); /*Update the score and direction*/
-           #endif
+           charMaxScore(
+             dirMatrix,
+             settings,
+             &insScoreL,
+             &snpScoreL,
+             &delScoreL,
+             scoreOnLP
+           ); /*Update the score and direction*/
 
            /*Find the next deletion score*/
            /*Need to move the direction here, so I have
            ` the previous bases direction.
            */
-           #if !defined BYTEMATRIX && !defined NOGAPOPEN
-              indelScore(
-                 delScoreL,
-                 getTwoBitElm(dirMatrix),
-                 *scoreOnLP,
-                 settings
-              );
-           #elif !defined NOGAPOPEN
+           #if !defined NOGAPOPEN
               indelScore(
                  delScoreL,
                  *dirMatrix,
@@ -358,14 +361,7 @@ struct alnMatrixStruct * NeedlemanAln(
            */
            ++scoreOnLP;
 
-           #if !defined BYTEMATRIX && !defined NOGAPOPEN
-              indelScore(
-                 insScoreL,
-                 getTwoBitElm(&insDir),
-                 *scoreOnLP,
-                 settings
-              );
-           #elif !defined NOGAPOPEN
+           #if !defined NOGAPOPEN
               indelScore(
                  insScoreL,
                  *insDir,
@@ -377,12 +373,7 @@ struct alnMatrixStruct * NeedlemanAln(
            #endif
 
            /*Move to the next direction*/
-           #if !defined BYTEMATRIX && !defined NOGAPOPEN
-              twoBitMvToNextElm(dirMatrix);
-              twoBitMvToNextElm(&insDir);
-           #elif !defined BYTEMATRIX
-              twoBitMvToNextElm(dirMatrix);
-           #elif !defined NOGAPOPEN
+           #if !defined NOGAPOPEN
               ++dirMatrix;
               ++insDir;
            #else
@@ -407,25 +398,14 @@ struct alnMatrixStruct * NeedlemanAln(
        ` case, this score can only apply to indels. So,
        ` I need to move off it to avoid overwirting it
        */
-       #if !defined BYTEMATRIX
-          twoBitMaxScore(
-            dirMatrix,
-            settings,
-            &insScoreL,
-            &nextSnpSL,
-            &delScoreL,
-            scoreOnLP
-          ); /*Update the score and direction*/
-       #else
-          charMaxScore(
-            dirMatrix,
-            settings,
-            &insScoreL,
-            &nextSnpSL,
-            &delScoreL,
-            scoreOnLP
-          ); /*Update the score and direction*/
-       #endif
+       charMaxScore(
+         dirMatrix,
+         settings,
+         &insScoreL,
+         &nextSnpSL,
+         &delScoreL,
+         scoreOnLP
+       ); /*Update the score and direction*/
 
        /**************************************************\
        *  Fun-01 Sec-04 Sub-05:
@@ -438,16 +418,29 @@ struct alnMatrixStruct * NeedlemanAln(
        ` next subsection. I need to find the score for a
        ` deletion before the update.
        */
-       #if !defined BYTEMATRIX && !defined NOGAPOPEN
-          twoBitMvToNextElm(dirMatrix);
-          changeTwoBitElm(dirMatrix, defMvIns);
-          twoBitMvToNextElm(dirMatrix);
-
-          twoBitMvToNextElm(&insDir);
-       #elif !defined BYTEMATRIX
-          twoBitMvToNextElm(dirMatrix);
-          changeTwoBitElm(dirMatrix, defMvIns);
-          twoBitMvToNextElm(dirMatrix);
+       #if !defined BYTEMATRIX
+          /*Save the finished row and swap rows. insDir
+          ` ends on the first base of the saved row.
+          */
+          ++rowUL;
+          twoBitPackRow(
+             dirMatrixST,
+             rowUL,
+             rowOnStr,
+             lenRefUL + 1
+          );
+
+          swapStr = rowOnStr;
+          rowOnStr = lastRowStr;
+          lastRowStr = swapStr;
+
+          dirMatrix = rowOnStr;
+          *dirMatrix = defMvIns;
+          ++dirMatrix;
+
+          #if !defined NOGAPOPEN
+             insDir = lastRowStr + 1;
+          #endif
        #elif !defined NOGAPOPEN
           ++dirMatrix;
           *dirMatrix = defMvIns;
@@ -479,16 +472,7 @@ struct alnMatrixStruct * NeedlemanAln(
        ++scoreOnLP; /*Move to the first base pair*/
 
       /*At this point insDir is on the first base*/
-      #if !defined BYTEMATRIX && !defined NOGAPOPEN
-         indelScore(
-            insScoreL,
-            getTwoBitElm(&insDir),
-            *scoreOnLP,
-            settings
-         );
-
-         twoBitMvToNextElm(&insDir);
-      #elif !defined NOGAPOPEN
+      #if !defined NOGAPOPEN
          indelScore(
             insScoreL,
             *insDir,
@@ -497,7 +481,7 @@ struct alnMatrixStruct * NeedlemanAln(
          );
 
          ++insDir;
-      #elif !defined BYTEMATRIX
+      #else
          insScoreL = *scoreOnLP + settings->gapExtendI;
       #endif
       /*At this piont insDir is on the second base*/
@@ -508,11 +492,11 @@ struct alnMatrixStruct * NeedlemanAln(
    ^  - Set up for returing the matrix (clean up/wrap up)
    \<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<*/
 
-   /*Account for being two cells out of bounds*/
+   /*Account for being two cells out of bounds. The two bit
+   ` matrix only has the packed rows.
+   */
    #if !defined BYTEMATRIX
-      twoBitMvBackOneElm(dirMatrix);
-      changeTwoBitElm(dirMatrix, defMvStop);
-      twoBitMvBackOneElm(dirMatrix);
+      free(dirRowStr);
    #else
       *(dirMatrix - 1) = defMvStop;
    #endif
@@ -0,0 +1,291 @@
+/*#########################################################
+# Name: refIndex
+# Use:
+#  - Writes and memory maps pre-converted reference files
+#    (index files)
+# Libraries:
+#  - "refIndex.h"
+#  o "alnSetStruct.h"
+#  o "seqStruct.h"
+#  o "alnSeqDefaults.h"
+# C Standard Libraries:
+#  - <string.h>
+#  - <sys/mman.h>
+#  - <sys/stat.h>
+#  - <fcntl.h>
+#  - <unistd.h>
+#  o <stdio.h>
+#  o <stdlib.h>
+#  o <stdint.h>
+#########################################################*/
+
+/*mmap, fstat, and open are POSIX (not in --std=c99)*/
+#define _POSIX_C_SOURCE 200809L
+
+#include "refIndex.h"
+
+#include <string.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <fcntl.h>
+#include <unistd.h>
+
+/*~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~\
+' SOF: Start Of Functions
+'  o fun-01 writeRefIndex:
+'    - Writes a reference to an index file
+'  o fun-02 mapRefIndex:
+'    - Memory maps an index file
+'  o fun-03 unmapRefIndex:
+'    - Unmaps an index file mapped by mapRefIndex
+'  o fun-04 freeRefST:
+'    - Frees a reference that was read from a fasta file
+'      or unmaps it if it came from an index
+\~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~*/
+
+/*--------------------------------------------------------\
+| Output:
+|  - Prints:
+|    o The index for refST to outFILE
+|  - Modifies:
+|    o refST->seqCStr to be uppercase (lookupIndexToSeq)
+|  - Returns:
+|    o 0 for success
+|    o 2 if the index could not be written
+\--------------------------------------------------------*/
+unsigned char writeRefIndex(
+   struct seqStruct *refST, /*Reference to index*/
+   FILE *outFILE            /*File to write index to*/
+){ /*~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~\
+   ' Fun-01 TOC: writeRefIndex
+   '  - Writes a reference to an index file
+   \~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~*/
+
+   struct refIndexHead headST;
+
+   memset(&headST, 0, sizeof(struct refIndexHead));
+   memcpy(headST.magicStr, defRefIndexMagic, 8);
+   headST.versionUI = defRefIndexVersion;
+   headST.cnvtUI = defRefIndexCnvt;
+   headST.lenIdUL = refST->lenIdUL;
+   headST.lenSeqUL = refST->lenSeqUL;
+
+   if(fwrite(&headST,sizeof(struct refIndexHead),1,outFILE)!=1)
+      return 2;
+
+   /*The + 1's are for the '\0' at the end*/
+   if(
+        fwrite(refST->idCStr, 1, refST->lenIdUL + 1, outFILE)
+     != refST->lenIdUL + 1
+   ) return 2;
+
+   /*Same conversion alnBatch does*/
+   seqToLookupIndex(refST);
+
+   if(
+        fwrite(refST->seqCStr,1,refST->lenSeqUL + 1,outFILE)
+     != refST->lenSeqUL + 1
+   ) return 2;
+
+   lookupIndexToSeq(refST);
+
+   if(
+        fwrite(refST->seqCStr,1,refST->lenSeqUL + 1,outFILE)
+     != refST->lenSeqUL + 1
+   ) return 2;
+
+   if(fflush(outFILE)) return 2;
+   return 0;
+} /*writeRefIndex*/
+
+/*--------------------------------------------------------\
+| Output:
+|  - Modifies:
+|    o indexST to have the mapped index and the reference
+|      sequences (see st-02)
+|  - Returns:
+|    o 0 for success
+|    o 1 if fileStr is not an index file (a fasta file)
+|      or could not be opened
+|    o 2 if the index is from a different version or was
+|      made with different -DNOSEQCNVT settings
+|    o 4 if the index could not be mapped or is cut short
+\--------------------------------------------------------*/
+unsigned char mapRefIndex(
+   char *fileStr,           /*Index file to map*/
+   struct refIndex *indexST /*Gets the mapped index*/
+){ /*~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~\
+   ' Fun-02 TOC: mapRefIndex
+   '  - Memory maps an index file
+   '  o fun-02 sec-01:
+   '    - Variable declerations
+   '  o fun-02 sec-02:
+   '    - Check the header
+   '  o fun-02 sec-03:
+   '    - Map the file and set up the sequences
+   \~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~*/
+
+   /*>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>\
+   ^ Fun-02 Sec-01:
+   ^  - Variable declerations
+   \<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<*/
+
+   int fileI = 0;
+   void *mapPtr = 0;
+   char *tmpStr = 0;
+   unsigned long lenNeedUL = 0;
+
+   struct refIndexHead headST;
+   struct stat statST;
+
+   memset(indexST, 0, sizeof(struct refIndex));
+   initSeqST(&indexST->refST);
+   initSeqST(&indexST->printST);
+
+   /*>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>\
+   ^ Fun-02 Sec-02:
+   ^  - Check the header
+   \<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<*/
+
+   /*The caller reports files that can not be opened*/
+   fileI = open(fileStr, O_RDONLY);
+   if(fileI < 0) return 1;
+
+   if(fstat(fileI, &statST) != 0)
+   { /*If I could not get the file size*/
+      close(fileI);
+      return 1;
+   } /*If I could not get the file size*/
+
+   /*Fasta files are never this short and never start with
+   ` the magic number
+   */
+   if(
+         (unsigned long) statST.st_size
+         < sizeof(struct refIndexHead)
+      ||    read(fileI, &headST, sizeof(struct refIndexHead))
+         != (ssize_t) sizeof(struct refIndexHead)
+      || memcmp(headST.magicStr, defRefIndexMagic, 8) != 0
+   ){ /*If this is not an index file*/
+      close(fileI);
+      return 1;
+   } /*If this is not an index file*/
+
+   if(
+         headST.versionUI != defRefIndexVersion
+      || headST.cnvtUI != defRefIndexCnvt
+   ){ /*If this index was made by another alnSeq build*/
+      close(fileI);
+      return 2;
+   } /*If this index was made by another alnSeq build*/
+
+   /*header, id + '\0', and two sequences + '\0'*/
+   lenNeedUL =
+        sizeof(struct refIndexHead)
+      + headST.lenIdUL + 1
+      + ((headST.lenSeqUL + 1) << 1);
+
+   if((unsigned long) statST.st_size < lenNeedUL)
+   { /*If the index was cut short*/
+      close(fileI);
+      return 4;
+   } /*If the index was cut short*/
+
+   /*>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>\
+   ^ Fun-02 Sec-03:
+   ^  - Map the file and set up the sequences
+   \<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<*/
+
+   /*MAP_PRIVATE with write permission is copy on write.
+   ` Pages are shared with other processes till written,
+   ` which alnSeq does not do to the reference.
+   */
+   mapPtr =
+      mmap(
+         0,
+         lenNeedUL,
+         PROT_READ | PROT_WRITE,
+         MAP_PRIVATE,
+         fileI,
+         0
+      );
+
+   close(fileI); /*The mapping stays after close*/
+   if(mapPtr == MAP_FAILED) return 4;
+
+   indexST->mapStr = mapPtr;
+   indexST->lenMapUL = lenNeedUL;
+
+   tmpStr = indexST->mapStr + sizeof(struct refIndexHead);
+   indexST->refST.idCStr = tmpStr;
+   indexST->refST.lenIdUL = headST.lenIdUL;
+   tmpStr += headST.lenIdUL + 1;
+
+   indexST->refST.seqCStr = tmpStr;
+   indexST->refST.lenSeqUL = headST.lenSeqUL;
+   tmpStr += headST.lenSeqUL + 1;
+
+   indexST->printST.idCStr = indexST->refST.idCStr;
+   indexST->printST.lenIdUL = headST.lenIdUL;
+   indexST->printST.seqCStr = tmpStr;
+   indexST->printST.lenSeqUL = headST.lenSeqUL;
+
+   /*Everything after the id assumes c-strings*/
+   if(
+         indexST->refST.idCStr[headST.lenIdUL] != '\0'
+      || indexST->refST.seqCStr[headST.lenSeqUL] != '\0'
+      || indexST->printST.seqCStr[headST.lenSeqUL] != '\0'
+   ){ /*If the index is corrupt*/
+      unmapRefIndex(indexST);
+      return 4;
+   } /*If the index is corrupt*/
+
+   return 0;
+} /*mapRefIndex*/
+
+/*--------------------------------------------------------\
+| Output:
+|  - Frees:
+|    o The mapping in indexST (if any) and sets indexST to
+|      blank values
+\--------------------------------------------------------*/
+void unmapRefIndex(
+   struct refIndex *indexST /*Index to unmap*/
+){ /*~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~\
+   ' Fun-03 TOC: unmapRefIndex
+   '  - Unmaps an index file mapped by mapRefIndex
+   \~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~*/
+
+   if(indexST->mapStr != 0)
+      munmap(indexST->mapStr, indexST->lenMapUL);
+
+   indexST->mapStr = 0;
+   indexST->lenMapUL = 0;
+   initSeqST(&indexST->refST);
+   initSeqST(&indexST->printST);
+} /*unmapRefIndex*/
+
+/*--------------------------------------------------------\
+| Output:
+|  - Frees:
+|    o indexST if it has a mapped index, else frees the
+|      sequences in refST (refST is on the stack)
+\--------------------------------------------------------*/
+void freeRefST(
+   struct seqStruct *refST, /*Reference from readFaSeq*/
+   struct refIndex *indexST /*Reference from mapRefIndex*/
+){ /*~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~\
+   ' Fun-04 TOC: freeRefST
+   '  - Frees a reference that was read from a fasta file
+   '    or unmaps it if it came from an index
+   \~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~*/
+
+   if(indexST->mapStr != 0)
+   { /*If the reference points into the mapped index*/
+      unmapRefIndex(indexST);
+      initSeqST(refST);
+      return;
+   } /*If the reference points into the mapped index*/
+
+   freeSeqST(refST, 0); /*0 to mark on the stack*/
+} /*freeRefST*/
@@ -0,0 +1,162 @@
+/*#########################################################
+# Name: refIndex
+# Use:
+#  - Writes and memory maps pre-converted reference files
+#    (index files). The index holds the reference id, the
+#    reference as lookup indexes (seqToLookupIndex), and
+#    the reference as uppercase letters (for printing), so
+#    alnSeq does not have to read or convert the fasta.
+#  - The index is mapped read only (copy on write), so
+#    alnSeq runs using the same index share one copy in
+#    the page cache.
+#  - Index files are a local cache. They use the byte
+#    order of the computer that made them.
+# Libraries:
+#  - "alnSetStruct.h"
+#  o "seqStruct.h"
+#  o "alnSeqDefaults.h"
+# C Standard Libraries:
+#  o <stdio.h>
+#  o <stdlib.h>
+#  o <stdint.h>
+#########################################################*/
+
+/*~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~\
+' SOH: Start Of Header
+'  o st-01 refIndexHead:
+'    - Header at the start of an index file
+'  o st-02 refIndex:
+'    - Holds a memory mapped index file
+'  o fun-01 writeRefIndex:
+'    - Writes a reference to an index file
+'  o fun-02 mapRefIndex:
+'    - Memory maps an index file
+'  o fun-03 unmapRefIndex:
+'    - Unmaps an index file mapped by mapRefIndex
+'  o fun-04 freeRefST:
+'    - Frees a reference that was read from a fasta file
+'      or unmaps it if it came from an index
+\~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~*/
+
+#ifndef REFINDEX_H
+#define REFINDEX_H
+
+#include "alnSetStruct.h"
+
+#define defRefIndexMagic "alnSeqRI" /*First 8 bytes of file*/
+#define defRefIndexVersion 1 /*Change with the file layout*/
+
+/*1: sequence in the index is lookup indexes (default);
+` 0: sequence is letters (-DNOSEQCNVT). Both alnSeq and the
+` index must agree.
+*/
+#ifdef NOSEQCNVT
+   #define defRefIndexCnvt 0
+#else
+   #define defRefIndexCnvt 1
+#endif
+
+/*--------------------------------------------------------\
+| ST-01: refIndexHead
+|  - Header at the start of an index file
+|  - After the header is the id, the lookup index sequence,
+|    and the letter sequence. Each ends with a '\0'.
+\--------------------------------------------------------*/
+typedef struct refIndexHead
+{ /*refIndexHead*/
+   char magicStr[8];    /*defRefIndexMagic (no '\0')*/
+   uint32_t versionUI;  /*defRefIndexVersion*/
+   uint32_t cnvtUI;     /*defRefIndexCnvt*/
+   uint64_t lenIdUL;    /*Length of the id*/
+   uint64_t lenSeqUL;   /*Length of the sequence*/
+}refIndexHead;
+
+/*--------------------------------------------------------\
+| ST-02: refIndex
+|  - Holds a memory mapped index file
+|  - refST and printST point into the mapped file. Do not
+|    call freeSeqST on them; use unmapRefIndex.
+\--------------------------------------------------------*/
+typedef struct refIndex
+{ /*refIndex*/
+   char *mapStr;            /*Start of the mapped file*/
+   unsigned long lenMapUL;  /*Bytes mapped*/
+
+   struct seqStruct refST;  /*Reference (lookup indexes)*/
+   struct seqStruct printST;/*Reference (letters)*/
+}refIndex;
+
+/*--------------------------------------------------------\
+| Output:
+|  - Prints:
+|    o The index for refST to outFILE
+|  - Modifies:
+|    o refST->seqCStr to be uppercase (lookupIndexToSeq)
+|  - Returns:
+|    o 0 for success
+|    o 2 if the index could not be written
+\--------------------------------------------------------*/
+unsigned char writeRefIndex(
+   struct seqStruct *refST, /*Reference to index*/
+   FILE *outFILE            /*File to write index to*/
+); /*~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~\
+   ' Fun-01 TOC: writeRefIndex
+   '  - Writes a reference to an index file
+   \~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~*/
+
+/*--------------------------------------------------------\
+| Output:
+|  - Modifies:
+|    o indexST to have the mapped index and the reference
+|      sequences (see st-02)
+|  - Returns:
+|    o 0 for success
+|    o 1 if fileStr is not an index file (a fasta file)
+|      or could not be opened
+|    o 2 if the index is from a different version or was
+|      made with different -DNOSEQCNVT settings
+|    o 4 if the index could not be mapped or is cut short
+\--------------------------------------------------------*/
+unsigned char mapRefIndex(
+   char *fileStr,           /*Index file to map*/
+   struct refIndex *indexST /*Gets the mapped index*/
+); /*~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~\
+   ' Fun-02 TOC: mapRefIndex
+   '  - Memory maps an index file
+   '  o fun-02 sec-01:
+   '    - Variable declerations
+   '  o fun-02 sec-02:
+   '    - Check the header
+   '  o fun-02 sec-03:
+   '    - Map the file and set up the sequences
+   \~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~*/
+
+/*--------------------------------------------------------\
+| Output:
+|  - Frees:
+|    o The mapping in indexST (if any) and sets indexST to
+|      blank values
+\--------------------------------------------------------*/
+void unmapRefIndex(
+   struct refIndex *indexST /*Index to unmap*/
+); /*~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~\
+   ' Fun-03 TOC: unmapRefIndex
+   '  - Unmaps an index file mapped by mapRefIndex
+   \~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~*/
+
+/*--------------------------------------------------------\
+| Output:
+|  - Frees:
+|    o indexST if it has a mapped index, else frees the
+|      sequences in refST (refST is on the stack)
+\--------------------------------------------------------*/
+void freeRefST(
+   struct seqStruct *refST, /*Reference from readFaSeq*/
+   struct refIndex *indexST /*Reference from mapRefIndex*/
+); /*~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~\
+   ' Fun-04 TOC: freeRefST
+   '  - Frees a reference that was read from a fasta file
+   '    or unmaps it if it came from an index
+   \~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~*/
+
+#endif
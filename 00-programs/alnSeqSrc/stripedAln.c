@@ -0,0 +1,972 @@
+/*#########################################################
+# Name: stripedAln
+# Use:
+#  - Holds a striped (Farrar) vector scoring pass for the
+#    Needleman and Waterman alignments. These functions
+#    only find scores and coordinates. They do not build a
+#    direction matrix.
+# Libraries:
+#  - "stripedAln.h"
+#  - "stripedAlnKern.h" (included once per kernel)
+#  o "alnSetStruct.h"
+#  o "scoresST.h"
+#  o "alnSeqDefaults.h"
+#  o "cStrToNumberFun.h"
+#  o "twoBitArrays.h"
+#  o "seqStruct.h"
+# C Standard Libraries:
+#  - <stdlib.h>
+#  - <immintrin.h> (x86 only)
+#  o <stdint.h>
+#  o <string.h>
+#  o <stdio.h>
+#########################################################*/
+
+#include "stripedAln.h"
+
+#include <stdlib.h>
+
+/*~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~\
+' SOF: Start Of Functions
+'  o sec-01:
+'    - Build the vector kernels (x86 only)
+'  o fun-01 getVectType:
+'    - Finds the best vector instruction set this cpu
+'      supports
+'  o fun-02 initStripedProf:
+'    - Sets all variables in a stripedProf struct to 0
+'  o fun-03 freeStripedProf:
+'    - Frees all variables in a stripedProf struct
+'  o fun-04 makeStripedProf:
+'    - Builds a striped profile for a sequence
+'  o fun-05 stripedScore:
+'    - Scores one sequence against a striped profile
+'  o fun-06 stripedWaterScore:
+'    - Finds the best score and coordinates of a
+'      Waterman alignment with the striped kernel
+'  o fun-07 stripedNeedleScore:
+'    - Finds the score of a Needleman alignment with the
+'      striped kernel
+\~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~*/
+
+/*Number of profile rows (one for each base & 31 value)*/
+#define defStripedRows 32
+
+/*Bounds for the int32 kernels. These are not the real
+` int32 limits, so adding a few gap penalties to
+` defStriped32Min will never underflow.
+*/
+#define defStriped32Min (-(1 << 30))
+#define defStriped32Max (1 << 30)
+
+/*Score given to the padding at the end of a profile*/
+#define defStriped16Pad -16384
+#define defStriped32Pad (-(1 << 28))
+
+/*Max (lenProf + lenSeq) * max score for a 16 bit global
+` alignment. Above this the score may saturate.
+*/
+#define defStriped16MaxGlobal 30000
+
+/*Rank of each move (defMv*) in each tie order (bestDirC).
+` Moves with lower ranks win ties, like charMaxScore.
+*/
+static const unsigned char stripedRankAry[6][4] =
+{
+   {0, 2, 1, 0}, /*defSnpInsDel*/
+   {0, 1, 2, 0}, /*defSnpDelIns*/
+   {0, 2, 0, 1}, /*defInsSnpDel*/
+   {0, 1, 0, 2}, /*defInsDelSnp*/
+   {0, 0, 2, 1}, /*defDelSnpIns*/
+   {0, 0, 1, 2}  /*defDelInsSnp*/
+};
+
+/*>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>\
+^ Sec-01:
+^  - Build the vector kernels (x86 only)
+^  o sec-01 sub-01:
+^    - SSE2 kernels
+^  o sec-01 sub-02:
+^    - AVX2 kernels
+^  o sec-01 sub-03:
+^    - AVX512 kernels
+\<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<*/
+
+#if defined __GNUC__ && (defined __x86_64__ || defined __i386__)
+   #define STRIPEDX86
+
+   #include <immintrin.h>
+
+   /******************************************************\
+   * Sec-01 Sub-01:
+   *  - SSE2 kernels
+   \******************************************************/
+
+   /*1 if any bit in a vector is set*/
+   #define stripedSSE2AnyNz(vect) \
+      (  _mm_movemask_epi8( \
+            _mm_cmpeq_epi8(vect, _mm_setzero_si128()) \
+         ) \
+       != 0xffff \
+      )
+
+   #define kernName stripedSSE2I16
+   #define kernTarget __attribute__((target("sse2")))
+   #define vectT __m128i
+   #define elmT int16_t
+   #define defLanes 8
+   #define defElmMin INT16_MIN
+   #define defElmMax INT16_MAX
+   #define defElmMask 0xffffUL
+   #define defCoordWords 2
+   #define vLoad(ptr) _mm_loadu_si128((__m128i *) (ptr))
+   #define vStore(ptr, vect) \
+      _mm_storeu_si128((__m128i *) (ptr), (vect))
+   #define vSet1(val) _mm_set1_epi16(val)
+   #define vAdd(vect1, vect2) _mm_adds_epi16(vect1, vect2)
+   #define vMax(vect1, vect2) _mm_max_epi16(vect1, vect2)
+   #define vAnd(vect1, vect2) _mm_and_si128(vect1, vect2)
+   #define vOr(vect1, vect2) _mm_or_si128(vect1, vect2)
+   #define vXor(vect1, vect2) _mm_xor_si128(vect1, vect2)
+   #define vAndNot(vect1, vect2) _mm_andnot_si128(vect1,vect2)
+   #define vCmpGt(vect1, vect2) _mm_cmpgt_epi16(vect1, vect2)
+   #define vCmpEq(vect1, vect2) _mm_cmpeq_epi16(vect1, vect2)
+   #define vAnyGt(vect1, vect2) \
+      _mm_movemask_epi8(_mm_cmpgt_epi16(vect1, vect2))
+   #define vAnyNz(vect) stripedSSE2AnyNz(vect)
+   #define vShiftIns(vect, val) \
+      _mm_insert_epi16(_mm_slli_si128(vect, 2), val, 0)
+   #include "stripedAlnKern.h"
+
+   /*SSE2 has no int32 max, so use a compare and mask*/
+   #define stripedSSE2MaxI32(vect1, vect2) \
+      _mm_or_si128( \
+         _mm_and_si128( \
+            _mm_cmpgt_epi32(vect1, vect2), \
+            vect1 \
+         ), \
+         _mm_andnot_si128( \
+            _mm_cmpgt_epi32(vect1, vect2), \
+            vect2 \
+         ) \
+      )
+
+   #define kernName stripedSSE2I32
+   #define kernTarget __attribute__((target("sse2")))
+   #define vectT __m128i
+   #define elmT int32_t
+   #define defLanes 4
+   #define defElmMin defStriped32Min
+   #define defElmMax defStriped32Max
+   #define defElmMask 0xffffffffUL
+   #define defCoordWords 1
+   #define vLoad(ptr) _mm_loadu_si128((__m128i *) (ptr))
+   #define vStore(ptr, vect) \
+      _mm_storeu_si128((__m128i *) (ptr), (vect))
+   #define vSet1(val) _mm_set1_epi32(val)
+   #define vAdd(vect1, vect2) _mm_add_epi32(vect1, vect2)
+   #define vMax(vect1, vect2) stripedSSE2MaxI32(vect1, vect2)
+   #define vAnd(vect1, vect2) _mm_and_si128(vect1, vect2)
+   #define vOr(vect1, vect2) _mm_or_si128(vect1, vect2)
+   #define vXor(vect1, vect2) _mm_xor_si128(vect1, vect2)
+   #define vAndNot(vect1, vect2) _mm_andnot_si128(vect1,vect2)
+   #define vCmpGt(vect1, vect2) _mm_cmpgt_epi32(vect1, vect2)
+   #define vCmpEq(vect1, vect2) _mm_cmpeq_epi32(vect1, vect2)
+   #define vAnyGt(vect1, vect2) \
+      _mm_movemask_epi8(_mm_cmpgt_epi32(vect1, vect2))
+   #define vAnyNz(vect) stripedSSE2AnyNz(vect)
+   #define vShiftIns(vect, val) \
+      _mm_or_si128( \
+         _mm_slli_si128(vect, 4), \
+         _mm_cvtsi32_si128(val) \
+      )
+   #include "stripedAlnKern.h"
+
+   /******************************************************\
+   * Sec-01 Sub-02:
+   *  - AVX2 kernels
+   \******************************************************/
+
+   /*Moves all elements up one lane (across the 128 bit
+   ` boundary) and sets lane 0 to 0
+   */
+   #define stripedAVX2Shift(vect, bytes) \
+      _mm256_alignr_epi8( \
+         vect, \
+         _mm256_permute2x128_si256(vect, vect, 0x08), \
+         16 - (bytes) \
+      )
+
+   #define kernName stripedAVX2I16
+   #define kernTarget __attribute__((target("avx2")))
+   #define vectT __m256i
+   #define elmT int16_t
+   #define defLanes 16
+   #define defElmMin INT16_MIN
+   #define defElmMax INT16_MAX
+   #define defElmMask 0xffffUL
+   #define defCoordWords 2
+   #define vLoad(ptr) _mm256_loadu_si256((__m256i *) (ptr))
+   #define vStore(ptr, vect) \
+      _mm256_storeu_si256((__m256i *) (ptr), (vect))
+   #define vSet1(val) _mm256_set1_epi16(val)
+   #define vAdd(vect1, vect2) _mm256_adds_epi16(vect1,vect2)
+   #define vMax(vect1, vect2) _mm256_max_epi16(vect1, vect2)
+   #define vAnd(vect1, vect2) _mm256_and_si256(vect1, vect2)
+   #define vOr(vect1, vect2) _mm256_or_si256(vect1, vect2)
+   #define vXor(vect1, vect2) _mm256_xor_si256(vect1, vect2)
+   #define vAndNot(vect1, vect2) \
+      _mm256_andnot_si256(vect1, vect2)
+   #define vCmpGt(vect1, vect2) _mm256_cmpgt_epi16(vect1,vect2)
+   #define vCmpEq(vect1, vect2) _mm256_cmpeq_epi16(vect1,vect2)
+   #define vAnyGt(vect1, vect2) \
+      _mm256_movemask_epi8(_mm256_cmpgt_epi16(vect1,vect2))
+   #define vAnyNz(vect) (! _mm256_testz_si256(vect, vect))
+   #define vShiftIns(vect, val) \
+      _mm256_insert_epi16(stripedAVX2Shift(vect, 2), val, 0)
+   #include "stripedAlnKern.h"
+
+   #define kernName stripedAVX2I32
+   #define kernTarget __attribute__((target("avx2")))
+   #define vectT __m256i
+   #define elmT int32_t
+   #define defLanes 8
+   #define defElmMin defStriped32Min
+   #define defElmMax defStriped32Max
+   #define defElmMask 0xffffffffUL
+   #define defCoordWords 1
+   #define vLoad(ptr) _mm256_loadu_si256((__m256i *) (ptr))
+   #define vStore(ptr, vect) \
+      _mm256_storeu_si256((__m256i *) (ptr), (vect))
+   #define vSet1(val) _mm256_set1_epi32(val)
+   #define vAdd(vect1, vect2) _mm256_add_epi32(vect1, vect2)
+   #define vMax(vect1, vect2) _mm256_max_epi32(vect1, vect2)
+   #define vAnd(vect1, vect2) _mm256_and_si256(vect1, vect2)
+   #define vOr(vect1, vect2) _mm256_or_si256(vect1, vect2)
+   #define vXor(vect1, vect2) _mm256_xor_si256(vect1, vect2)
+   #define vAndNot(vect1, vect2) \
+      _mm256_andnot_si256(vect1, vect2)
+   #define vCmpGt(vect1, vect2) _mm256_cmpgt_epi32(vect1,vect2)
+   #define vCmpEq(vect1, vect2) _mm256_cmpeq_epi32(vect1,vect2)
+   #define vAnyGt(vect1, vect2) \
+      _mm256_movemask_epi8(_mm256_cmpgt_epi32(vect1,vect2))
+   #define vAnyNz(vect) (! _mm256_testz_si256(vect, vect))
+   #define vShiftIns(vect, val) \
+      _mm256_insert_epi32(stripedAVX2Shift(vect, 4), val, 0)
+   #include "stripedAlnKern.h"
+
+   /******************************************************\
+   * Sec-01 Sub-03:
+   *  - AVX512 kernels
+   \******************************************************/
+
+   /*Index to move every int16 up one lane (lane 0 gets
+   ` lane 0, but is overwritten after the permute)
+   */
+   static const int16_t stripedAVX512ShiftIdxAry[32] =
+      {0,0,1,2,3,4,5,6,7,8,9,10,11,12,13,14,15,16,17,18,
+       19,20,21,22,23,24,25,26,27,28,29,30};
+
+   #define kernName stripedAVX512I16
+   #define kernTarget \
+      __attribute__((target("avx512f,avx512bw")))
+   #define vectT __m512i
+   #define elmT int16_t
+   #define defLanes 32
+   #define defElmMin INT16_MIN
+   #define defElmMax INT16_MAX
+   #define defElmMask 0xffffUL
+   #define defCoordWords 2
+   #define vLoad(ptr) _mm512_loadu_si512((void *) (ptr))
+   #define vStore(ptr, vect) \
+      _mm512_storeu_si512((void *) (ptr), (vect))
+   #define vSet1(val) _mm512_set1_epi16(val)
+   #define vAdd(vect1, vect2) _mm512_adds_epi16(vect1,vect2)
+   #define vMax(vect1, vect2) _mm512_max_epi16(vect1, vect2)
+   #define vAnd(vect1, vect2) _mm512_and_si512(vect1, vect2)
+   #define vOr(vect1, vect2) _mm512_or_si512(vect1, vect2)
+   #define vXor(vect1, vect2) _mm512_xor_si512(vect1, vect2)
+   #define vAndNot(vect1, vect2) \
+      _mm512_andnot_si512(vect1, vect2)
+   #define vCmpGt(vect1, vect2) \
+      _mm512_maskz_set1_epi16( \
+         _mm512_cmpgt_epi16_mask(vect1, vect2), \
+         -1 \
+      )
+   #define vCmpEq(vect1, vect2) \
+      _mm512_maskz_set1_epi16( \
+         _mm512_cmpeq_epi16_mask(vect1, vect2), \
+         -1 \
+      )
+   #define vAnyGt(vect1, vect2) \
+      (_mm512_cmpgt_epi16_mask(vect1, vect2) != 0)
+   #define vAnyNz(vect) (_mm512_test_epi16_mask(vect,vect) != 0)
+   #define vShiftIns(vect, val) \
+      _mm512_mask_set1_epi16( \
+         _mm512_permutexvar_epi16( \
+            _mm512_loadu_si512( \
+               (void *) stripedAVX512ShiftIdxAry \
+            ), \
+            vect \
+         ), \
+         1, \
+         val \
+      )
+   #include "stripedAlnKern.h"
+
+   #define kernName stripedAVX512I32
+   #define kernTarget \
+      __attribute__((target("avx512f,avx512bw")))
+   #define vectT __m512i
+   #define elmT int32_t
+   #define defLanes 16
+   #define defElmMin defStriped32Min
+   #define defElmMax defStriped32Max
+   #define defElmMask 0xffffffffUL
+   #define defCoordWords 1
+   #define vLoad(ptr) _mm512_loadu_si512((void *) (ptr))
+   #define vStore(ptr, vect) \
+      _mm512_storeu_si512((void *) (ptr), (vect))
+   #define vSet1(val) _mm512_set1_epi32(val)
+   #define vAdd(vect1, vect2) _mm512_add_epi32(vect1, vect2)
+   #define vMax(vect1, vect2) _mm512_max_epi32(vect1, vect2)
+   #define vAnd(vect1, vect2) _mm512_and_si512(vect1, vect2)
+   #define vOr(vect1, vect2) _mm512_or_si512(vect1, vect2)
+   #define vXor(vect1, vect2) _mm512_xor_si512(vect1, vect2)
+   #define vAndNot(vect1, vect2) \
+      _mm512_andnot_si512(vect1, vect2)
+   #define vCmpGt(vect1, vect2) \
+      _mm512_maskz_set1_epi32( \
+         _mm512_cmpgt_epi32_mask(vect1, vect2), \
+         -1 \
+      )
+   #define vCmpEq(vect1, vect2) \
+      _mm512_maskz_set1_epi32( \
+         _mm512_cmpeq_epi32_mask(vect1, vect2), \
+         -1 \
+      )
+   #define vAnyGt(vect1, vect2) \
+      (_mm512_cmpgt_epi32_mask(vect1, vect2) != 0)
+   #define vAnyNz(vect) (_mm512_test_epi32_mask(vect,vect) != 0)
+   #define vShiftIns(vect, val) \
+      _mm512_alignr_epi32(vect, _mm512_set1_epi32(val), 15)
+   #include "stripedAlnKern.h"
+#endif /*If on an x86 cpu*/
+
+/*--------------------------------------------------------\
+| Output:
+|  - Returns:
+|    o defVectSSE2, defVectAVX2, or defVectAVX512 for the
+|      best instruction set the cpu has
+|    o defVectScalar if no vector support (non-x86)
+\--------------------------------------------------------*/
+unsigned char getVectType(
+   unsigned char requestUC /*defVect* the user wanted*/
+){ /*~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~\
+   ' Fun-01 TOC: getVectType
+   '  - Finds the best vector instruction set this cpu
+   '    supports (never above requestUC)
+   \~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~*/
+
+   if(requestUC == defVectScalar) return defVectScalar;
+
+   #ifdef STRIPEDX86
+      __builtin_cpu_init();
+
+      if(
+            (
+                requestUC == defVectAuto
+             || requestUC == defVectAVX512
+            )
+         && __builtin_cpu_supports("avx512bw")
+      ) return defVectAVX512;
+
+      if(
+            requestUC != defVectSSE2
+         && __builtin_cpu_supports("avx2")
+      ) return defVectAVX2;
+
+      if(__builtin_cpu_supports("sse2")) return defVectSSE2;
+   #endif
+
+   return defVectScalar;
+} /*getVectType*/
+
+/*--------------------------------------------------------\
+| Output:
+|  - Modifies:
+|    o All values in profST to be 0
+\--------------------------------------------------------*/
+void initStripedProf(
+   struct stripedProf *profST
+){ /*~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~\
+   ' Fun-02 TOC: initStripedProf
+   '  - Sets all variables in a stripedProf struct to 0
+   \~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~*/
+
+   profST->profAryC = 0;
+   profST->hStoreAryC = 0;
+   profST->hLoadAryC = 0;
+   profST->sStoreAryC = 0;
+   profST->sLoadAryC = 0;
+   profST->idxAryC = 0;
+   profST->stStoreAryC = 0;
+   profST->stLoadAryC = 0;
+   profST->memV = 0;
+   profST->seqStr = 0;
+   profST->lenMemUL = 0;
+
+   profST->lenProfUL = 0;
+   profST->lenSegUL = 0;
+   profST->lanesUI = 0;
+   profST->widthUC = 0;
+   profST->vectTypeUC = defVectScalar;
+   profST->refBl = 0;
+
+   profST->bestDirC = 0;
+   profST->tieSnpEC = 0;
+   profST->tieFSnpC = 0;
+   profST->tieFEC = 0;
+
+   profST->gapOpenI = 0;
+   profST->gapExtendI = 0;
+   profST->maxScoreI = 0;
+   profST->minScoreI = 0;
+} /*initStripedProf*/
+
+/*--------------------------------------------------------\
+| Output:
+|  - Frees:
+|    o All memory in profST and re-initializes profST
+|    o Does not free profST
+\--------------------------------------------------------*/
+void freeStripedProf(
+   struct stripedProf *profST
+){ /*~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~\
+   ' Fun-03 TOC: freeStripedProf
+   '  - Frees all variables in a stripedProf struct
+   \~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~*/
+
+   if(profST == 0) return;
+   if(profST->memV != 0) free(profST->memV);
+   initStripedProf(profST);
+} /*freeStripedProf*/
+
+/*--------------------------------------------------------\
+| Output:
+|  - Modifies:
+|    o profST to have a profile for seqStr. Old memory in
+|      profST is reused when it is large enough.
+|    o Nothing if profST already has a profile for
+|      seqStr (same pointer, length, and settings). Call
+|      freeStripedProf if seqStr was changed in place.
+|  - Returns:
+|    o 0 for success
+|    o 1 if there is no vector support (use scalar)
+|    o 64 for memory errors
+\--------------------------------------------------------*/
+unsigned char makeStripedProf(
+   char *seqStr,          /*Sequence (lookup index)*/
+   unsigned long lenSeqUL,/*Number of bases in seqStr*/
+   char refBl,            /*1: seqStr is the reference*/
+   unsigned char widthUC, /*defStriped16 or defStriped32*/
+   struct alnSet *settings,/*Scoring matrix and gaps*/
+   struct stripedProf *profST /*Profile to build*/
+){ /*~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~\
+   ' Fun-04 TOC: makeStripedProf
+   '  - Builds a striped profile for a sequence
+   '  o fun-04 sec-01:
+   '    - Variable declerations
+   '  o fun-04 sec-02:
+   '    - Check if the profile can be reused
+   '  o fun-04 sec-03:
+   '    - Find the vector size and allocate memory
+   '  o fun-04 sec-04:
+   '    - Fill in the profile
+   \~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~*/
+
+   /*>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>\
+   ^ Fun-04 Sec-01:
+   ^  - Variable declerations
+   \<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<*/
+
+   unsigned char vectTypeUC =
+      getVectType((unsigned char) settings->vectTypeC);
+   unsigned int bytesUI = 0;  /*Bytes in one vector*/
+   unsigned int elmBytesUI = widthUC >> 3;
+   unsigned int wordsUI = defStripedWords32;
+   unsigned int wordUI = 0;
+   unsigned long lenColUL = 0;/*Elements in one column*/
+   unsigned long lenMemUL = 0;
+   unsigned long segUL = 0;
+   unsigned long posUL = 0;
+   unsigned int laneUI = 0;
+   unsigned char rowUC = 0;
+   unsigned char baseUC = 0;
+   long scoreL = 0;
+   char *memStr = 0;
+   char dirC = settings->bestDirC; /*Tie order*/
+   unsigned char eMvUC = defMvIns;  /*Gap across columns*/
+   unsigned char fMvUC = defMvDel;  /*Gap down a column*/
+
+   /*>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>\
+   ^ Fun-04 Sec-02:
+   ^  - Check if the profile can be reused
+   \<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<*/
+
+   /*Same tie order as charMaxScore*/
+   #if defined SNPINSDEL
+      dirC = defSnpInsDel;
+   #elif defined SNPDELINS
+      dirC = defSnpDelIns;
+   #elif defined INSSNPDEL
+      dirC = defInsSnpDel;
+   #elif defined INSDELSNP
+      dirC = defInsDelSnp;
+   #elif defined DELSNPINS
+      dirC = defDelSnpIns;
+   #elif defined DELINSSNP
+      dirC = defDelInsSnp;
+   #endif
+
+   if(dirC < defSnpInsDel || dirC > defDelInsSnp)
+      dirC = defBestDir;
+
+   if(
+         profST->seqStr == seqStr
+      && seqStr != 0
+      && profST->lenProfUL == lenSeqUL
+      && profST->widthUC == widthUC
+      && profST->refBl == refBl
+      && profST->vectTypeUC == vectTypeUC
+      && profST->bestDirC == dirC
+      && profST->gapExtendI == settings->gapExtendI
+      #ifndef NOGAPOPEN
+         && profST->gapOpenI == settings->gapOpenI
+      #endif
+   ) return 0; /*Already have this profile*/
+
+   /*>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>\
+   ^ Fun-04 Sec-03:
+   ^  - Find the vector size and allocate memory
+   \<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<*/
+
+   switch(vectTypeUC)
+   { /*Switch: find the vector size*/
+      case defVectSSE2: bytesUI = 16; break;
+      case defVectAVX2: bytesUI = 32; break;
+      case defVectAVX512: bytesUI = 64; break;
+      default: return 1; /*No vector support*/
+   } /*Switch: find the vector size*/
+
+   profST->seqStr = 0; /*In case of a memory error*/
+   profST->vectTypeUC = vectTypeUC;
+   profST->widthUC = widthUC;
+   profST->refBl = refBl;
+   profST->lenProfUL = lenSeqUL;
+   profST->lanesUI = bytesUI / elmBytesUI;
+   profST->lenSegUL =
+      (lenSeqUL + profST->lanesUI - 1) / profST->lanesUI;
+   profST->gapOpenI = settings->gapOpenI;
+   profST->gapExtendI = settings->gapExtendI;
+
+   #ifdef NOGAPOPEN
+      /*Every gap is scored as an extension*/
+      profST->gapOpenI = settings->gapExtendI;
+   #endif
+
+   /*When the profile is the reference, a gap across the
+   ` columns (seqStr) is an insertion and a gap down the
+   ` profile is a deletion
+   */
+   if(! refBl)
+   { /*If the profile is the query*/
+      eMvUC = defMvDel;
+      fMvUC = defMvIns;
+   } /*If the profile is the query*/
+
+   profST->bestDirC = dirC;
+   profST->tieSnpEC =
+      -(char) (
+           stripedRankAry[(int) dirC][defMvSnp]
+         < stripedRankAry[(int) dirC][eMvUC]
+      );
+   profST->tieFSnpC =
+      -(char) (
+           stripedRankAry[(int) dirC][fMvUC]
+         < stripedRankAry[(int) dirC][defMvSnp]
+      );
+   profST->tieFEC =
+      -(char) (
+           stripedRankAry[(int) dirC][fMvUC]
+         < stripedRankAry[(int) dirC][eMvUC]
+      );
+
+   if(widthUC == defStriped16) wordsUI = defStripedWords16;
+   lenColUL = profST->lenSegUL * profST->lanesUI;
+
+   /*Profile + 4 rows of scores/snps (hStore, hLoad,
+   ` sStore, sLoad), the element positions, and two sets
+   ` of start coordinates (query and reference)
+   */
+   lenMemUL =
+        (defStripedRows + 4 + 5 * wordsUI)
+      * lenColUL
+      * elmBytesUI
+      + defStripedAlign;
+
+   if(profST->lenMemUL < lenMemUL)
+   { /*If I need more memory*/
+      if(profST->memV != 0) free(profST->memV);
+      profST->memV = malloc(lenMemUL);
+      profST->lenMemUL = 0;
+
+      if(profST->memV == 0) return 64;
+      profST->lenMemUL = lenMemUL;
+   } /*If I need more memory*/
+
+   /*Align the arrays to a cache line*/
+   memStr =
+        (char *) profST->memV
+      + (   defStripedAlign
+          - ((uintptr_t) profST->memV % defStripedAlign)
+        ) % defStripedAlign;
+
+   profST->profAryC = memStr;
+   memStr += defStripedRows * lenColUL * elmBytesUI;
+   profST->hStoreAryC = memStr;
+   memStr += lenColUL * elmBytesUI;
+   profST->hLoadAryC = memStr;
+   memStr += lenColUL * elmBytesUI;
+   profST->sStoreAryC = memStr;
+   memStr += lenColUL * elmBytesUI;
+   profST->sLoadAryC = memStr;
+   memStr += lenColUL * elmBytesUI;
+   profST->idxAryC = memStr;
+   memStr += wordsUI * lenColUL * elmBytesUI;
+   profST->stStoreAryC = memStr;
+   memStr += 2 * wordsUI * lenColUL * elmBytesUI;
+   profST->stLoadAryC = memStr;
+
+   /*>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>\
+   ^ Fun-04 Sec-04:
+   ^  - Fill in the profile
+   \<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<*/
+
+   profST->maxScoreI = 0;
+   profST->minScoreI = 0;
+
+   for(segUL = 0; segUL < profST->lenSegUL; ++segUL)
+   { /*Loop; find the position of each element*/
+      for(laneUI = 0; laneUI < profST->lanesUI; ++laneUI)
+      { /*Loop; through all elements in the vector*/
+         posUL = laneUI * profST->lenSegUL + segUL;
+
+         for(wordUI = 0; wordUI < wordsUI; ++wordUI)
+         { /*Loop; split the position into elements*/
+            if(widthUC == defStriped16)
+               ((int16_t *) profST->idxAryC)[
+                    wordUI * lenColUL
+                  + segUL * profST->lanesUI
+                  + laneUI
+               ] = (int16_t) (posUL >> (wordUI << 4));
+            else
+               ((int32_t *) profST->idxAryC)[
+                    segUL * profST->lanesUI
+                  + laneUI
+               ] = (int32_t) posUL;
+         } /*Loop; split the position into elements*/
+      } /*Loop; through all elements in the vector*/
+   } /*Loop; find the position of each element*/
+
+   for(rowUC = 0; rowUC < defStripedRows; ++rowUC)
+   { /*Loop; through all possible bases*/
+      for(segUL = 0; segUL < profST->lenSegUL; ++segUL)
+      { /*Loop; through all vectors in the column*/
+         for(laneUI = 0; laneUI < profST->lanesUI; ++laneUI)
+         { /*Loop; through all elements in the vector*/
+            posUL = laneUI * profST->lenSegUL + segUL;
+
+            if(posUL >= lenSeqUL)
+            { /*If this is padding past the sequence end*/
+               if(widthUC == defStriped16)
+                  scoreL = defStriped16Pad;
+               else
+                  scoreL = defStriped32Pad;
+            } /*If this is padding past the sequence end*/
+
+            else
+            { /*Else this is a base in the sequence*/
+               baseUC =
+                  (uint8_t) seqStr[posUL] & defClearNonAlph;
+
+               if(
+                     ! stripedValidIndex(rowUC)
+                  || ! stripedValidIndex(baseUC)
+               ) scoreL = 0;
+
+               else if(refBl)
+                  scoreL =
+                     getBaseScore(
+                        (char *) &rowUC,
+                        (char *) &baseUC,
+                        settings
+                     );
+               else
+                  scoreL =
+                     getBaseScore(
+                        (char *) &baseUC,
+                        (char *) &rowUC,
+                        settings
+                     );
+
+               if(scoreL > profST->maxScoreI)
+                  profST->maxScoreI = scoreL;
+               if(scoreL < profST->minScoreI)
+                  profST->minScoreI = scoreL;
+            } /*Else this is a base in the sequence*/
+
+            if(widthUC == defStriped16)
+               ((int16_t *) profST->profAryC)[
+                    rowUC * lenColUL
+                  + segUL * profST->lanesUI
+                  + laneUI
+               ] = (int16_t) scoreL;
+            else
+               ((int32_t *) profST->profAryC)[
+                    rowUC * lenColUL
+                  + segUL * profST->lanesUI
+                  + laneUI
+               ] = (int32_t) scoreL;
+         } /*Loop; through all elements in the vector*/
+      } /*Loop; through all vectors in the column*/
+   } /*Loop; through all possible bases*/
+
+   profST->seqStr = seqStr;
+   return 0;
+} /*makeStripedProf*/
+
+/*--------------------------------------------------------\
+| Output:
+|  - Modifies:
+|    o retScoreST to have the score, end of the alignment
+|      in the profile (refEndUL), and end of the
+|      alignment in seqStr (qryEndUL). These are index 0
+|      and are relative to the start of each sequence.
+|  - Returns:
+|    o 0 for success
+|    o 1 if the 16 bit scores overflowed (use 32 bits)
+\--------------------------------------------------------*/
+unsigned char stripedScore(
+   struct stripedProf *profST, /*Profile to score with*/
+   char *seqStr,          /*Sequence (lookup index)*/
+   unsigned long lenSeqUL,/*Number of bases in seqStr*/
+   char alnTypeC,         /*defStriped(Local/Global)*/
+   struct scoresStruct *retScoreST /*Holds the score*/
+){ /*~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~\
+   ' Fun-05 TOC: stripedScore
+   '  - Scores one sequence against a striped profile
+   \~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~*/
+
+   long maxAbsL = profST->maxScoreI;
+
+   if(-profST->minScoreI > maxAbsL)
+      maxAbsL = -profST->minScoreI;
+   if(-profST->gapOpenI > maxAbsL)
+      maxAbsL = -profST->gapOpenI;
+   if(-profST->gapExtendI > maxAbsL)
+      maxAbsL = -profST->gapExtendI;
+
+   /*Global scores can go far below 0, so make sure the
+   ` 16 bit elements can not saturate
+   */
+   if(
+         profST->widthUC == defStriped16
+      && alnTypeC == defStripedGlobal
+      &&   (long) (profST->lenProfUL + lenSeqUL) * maxAbsL
+         >= defStriped16MaxGlobal
+   ) return 1;
+
+   #ifdef STRIPEDX86
+      switch(profST->vectTypeUC)
+      { /*Switch: find the kernel to use*/
+         case defVectAVX512:
+            if(profST->widthUC == defStriped16)
+               return stripedAVX512I16(
+                  profST,seqStr,lenSeqUL,alnTypeC,retScoreST);
+            return stripedAVX512I32(
+               profST, seqStr, lenSeqUL, alnTypeC, retScoreST);
+
+         case defVectAVX2:
+            if(profST->widthUC == defStriped16)
+               return stripedAVX2I16(
+                  profST,seqStr,lenSeqUL,alnTypeC,retScoreST);
+            return stripedAVX2I32(
+               profST, seqStr, lenSeqUL, alnTypeC, retScoreST);
+
+         case defVectSSE2:
+            if(profST->widthUC == defStriped16)
+               return stripedSSE2I16(
+                  profST,seqStr,lenSeqUL,alnTypeC,retScoreST);
+            return stripedSSE2I32(
+               profST, seqStr, lenSeqUL, alnTypeC, retScoreST);
+      } /*Switch: find the kernel to use*/
+   #endif
+
+   /*Should never happen, makeStripedProf would have
+   ` failed first
+   */
+   return 1;
+} /*stripedScore*/
+
+/*--------------------------------------------------------\
+| Output:
+|  - Modifies:
+|    o retScoreST to have the best score and the index 0
+|      start and end coordinates of the best Waterman
+|      alignment (same as memWaterAln)
+|  - Returns:
+|    o 0 for success
+|    o 1 if there is no vector support (use scalar)
+|    o 64 for memory errors
+\--------------------------------------------------------*/
+unsigned char stripedWaterScore(
+   struct seqStruct *qryST,   /*Query; offsetUL-endAlnUL*/
+   struct seqStruct *refST,   /*Ref; offsetUL-endAlnUL*/
+   struct alnSet *settings,   /*Settings for alignment*/
+   struct stripedProf *profST,/*Reused memory or 0*/
+   struct scoresStruct *retScoreST /*Holds the score*/
+){ /*~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~\
+   ' Fun-06 TOC: stripedWaterScore
+   '  - Finds the best score and coordinates of a
+   '    Waterman alignment with the striped kernel
+   \~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~*/
+
+   char *refStr = refST->seqCStr + refST->offsetUL;
+   unsigned char errUC = 0;
+   unsigned char widthUC = defStriped16;
+   struct stripedProf tmpProfST;
+
+   initStripedProf(&tmpProfST);
+   if(profST == 0) profST = &tmpProfST;
+
+   /*Keep a reused profile that already had to go to 32
+   ` bits, instead of rebuilding it for every query
+   */
+   if(profST->seqStr == refStr) widthUC = profST->widthUC;
+
+   for(;;)
+   { /*Loop; till the scores fit in the element size*/
+      errUC =
+         makeStripedProf(
+            refStr,
+            refST->endAlnUL - refST->offsetUL + 1,
+            1,        /*Profile is the reference*/
+            widthUC,
+            settings,
+            profST
+         );
+
+      if(errUC) break;
+
+      errUC =
+         stripedScore(
+            profST,
+            qryST->seqCStr + qryST->offsetUL,
+            qryST->endAlnUL - qryST->offsetUL + 1,
+            defStripedLocal,
+            retScoreST
+         );
+
+      if(!errUC || widthUC == defStriped32) break;
+      widthUC = defStriped32;
+   } /*Loop; till the scores fit in the element size*/
+
+   if(errUC == 0)
+   { /*If the kernel found the alignment*/
+      if(retScoreST->scoreL <= 0)
+      { /*If there was no alignment*/
+         initScoresST(retScoreST); /*Same as memWaterAln*/
+      } /*If there was no alignment*/
+
+      else
+      { /*Else convert to sequence coordinates*/
+         retScoreST->refStartUL += refST->offsetUL;
+         retScoreST->refEndUL += refST->offsetUL;
+         retScoreST->qryStartUL += qryST->offsetUL;
+         retScoreST->qryEndUL += qryST->offsetUL;
+      } /*Else convert to sequence coordinates*/
+   } /*If the kernel found the alignment*/
+
+   freeStripedProf(&tmpProfST);
+   return errUC;
+} /*stripedWaterScore*/
+
+/*--------------------------------------------------------\
+| Output:
+|  - Modifies:
+|    o retScoreST to have the score of the Needleman
+|      alignment and the start/end coordinates
+|  - Returns:
+|    o 0 for success
+|    o 1 if there is no vector support (use scalar)
+|    o 64 for memory errors
+\--------------------------------------------------------*/
+unsigned char stripedNeedleScore(
+   struct seqStruct *qryST,   /*Query; offsetUL-endAlnUL*/
+   struct seqStruct *refST,   /*Ref; offsetUL-endAlnUL*/
+   struct alnSet *settings,   /*Settings for alignment*/
+   struct stripedProf *profST,/*Reused memory or 0*/
+   struct scoresStruct *retScoreST /*Holds the score*/
+){ /*~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~\
+   ' Fun-07 TOC: stripedNeedleScore
+   '  - Finds the score of a Needleman alignment with the
+   '    striped kernel
+   \~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~*/
+
+   unsigned char errUC = 0;
+   unsigned char widthUC = defStriped16;
+   struct stripedProf tmpProfST;
+
+   initStripedProf(&tmpProfST);
+   if(profST == 0) profST = &tmpProfST;
+
+   if(profST->seqStr == refST->seqCStr + refST->offsetUL)
+      widthUC = profST->widthUC; /*Keep a reused profile*/
+
+   for(;;)
+   { /*Loop; till the scores fit in the element size*/
+      errUC =
+         makeStripedProf(
+            refST->seqCStr + refST->offsetUL,
+            refST->endAlnUL - refST->offsetUL + 1,
+            1,        /*Profile is the reference*/
+            widthUC,
+            settings,
+            profST
+         );
+
+      if(errUC) break;
+
+      errUC =
+         stripedScore(
+            profST,
+            qryST->seqCStr + qryST->offsetUL,
+            qryST->endAlnUL - qryST->offsetUL + 1,
+            defStripedGlobal,
+            retScoreST
+         );
+
+      if(!errUC || widthUC == defStriped32) break;
+      widthUC = defStriped32;
+   } /*Loop; till the scores fit in the element size*/
+
+   /*A global alignment always covers both windows*/
+   retScoreST->refStartUL = refST->offsetUL;
+   retScoreST->qryStartUL = qryST->offsetUL;
+   retScoreST->refEndUL = refST->endAlnUL;
+   retScoreST->qryEndUL = qryST->endAlnUL;
+
+   freeStripedProf(&tmpProfST);
+   return errUC;
+} /*stripedNeedleScore*/
@@ -0,0 +1,273 @@
+/*#########################################################
+# Name: stripedAln
+# Use:
+#  - Holds a striped (Farrar) vector scoring pass for the
+#    Needleman and Waterman alignments. These functions
+#    only find scores and coordinates. They do not build a
+#    direction matrix.
+#  - The vector instruction set (SSE2, AVX2, or AVX512) is
+#    picked at run time with cpuid, so one binary works
+#    on every x86 cpu. Non-x86 cpus use the scalar code.
+#  - Uses the same gap model and tie order as the scalar
+#    aligners (a gap after a snp/match is an opening,
+#    all other gaps are extensions), so the scores and
+#    coordinates are the same as the scalar code.
+# Libraries:
+#  - "alnSetStruct.h"
+#  - "scoresST.h"
+#  o "alnSeqDefaults.h"
+#  o "cStrToNumberFun.h"
+#  o "twoBitArrays.h"
+#  o "seqStruct.h"
+# C Standard Libraries:
+#  - <stdint.h>
+#  - <string.h>
+#  o <stdlib.h>
+#  o <stdio.h>
+#  - <immintrin.h> (x86 only)
+#########################################################*/
+
+/*~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~\
+' SOH: Start Of Header
+'  o st-01 stripedProf:
+'    - Holds a striped profile for one sequence and the
+'      score/gap rows reused by every alignment
+'  o fun-01 getVectType:
+'    - Finds the best vector instruction set this cpu
+'      supports
+'  o fun-02 initStripedProf:
+'    - Sets all variables in a stripedProf struct to 0
+'  o fun-03 freeStripedProf:
+'    - Frees all variables in a stripedProf struct
+'  o fun-04 makeStripedProf:
+'    - Builds a striped profile for a sequence
+'  o fun-05 stripedScore:
+'    - Scores one sequence against a striped profile
+'  o fun-06 stripedWaterScore:
+'    - Finds the best score and coordinates of a
+'      Waterman alignment with the striped kernel
+'  o fun-07 stripedNeedleScore:
+'    - Finds the score of a Needleman alignment with the
+'      striped kernel
+\~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~*/
+
+#ifndef STRIPEDALN_H
+#define STRIPEDALN_H
+
+#include <stdint.h>
+#include <string.h>
+
+#include "alnSetStruct.h"
+#include "scoresST.h"
+
+/*defVect* (instruction sets) are in alnSeqDefaults.h*/
+
+/*Alignment types for stripedScore*/
+#define defStripedLocal 0  /*Waterman (min score is 0)*/
+#define defStripedGlobal 1 /*Needleman (score last cell)*/
+
+/*Bits used for stripedProf->widthUC*/
+#define defStriped16 16
+#define defStriped32 32
+
+/*Elements used for a coordinate in each width. 16 bit
+` elements hold half of a 32 bit coordinate.
+*/
+#define defStripedWords16 2
+#define defStripedWords32 1
+
+/*Number of extra bytes to align the rows to a vector*/
+#define defStripedAlign 64
+
+/*Checks if a look up index has a score in the matrix*/
+#ifdef NOSEQCNVT
+   #define stripedValidIndex(indexUC) \
+      ((indexUC) > 0 && (indexUC) < 27)
+#else
+   #define stripedValidIndex(indexUC) ((indexUC) < 27)
+#endif
+
+/*--------------------------------------------------------\
+| ST-01: stripedProf
+|  - Holds a striped profile for one sequence and the
+|    score/gap rows reused by every alignment
+|  - Element x of the sequence is stored in lane
+|    x / lenSegUL of vector x % lenSegUL
+|  - Start coordinates are split into 16 bit pieces for
+|    the 16 bit kernels (defStripedWords16)
+\--------------------------------------------------------*/
+typedef struct stripedProf
+{ /*stripedProf*/
+   char *profAryC;      /*Profile (one row per base)*/
+   char *hStoreAryC;    /*Scores for the current column*/
+   char *hLoadAryC;     /*Scores for the last column*/
+   char *sStoreAryC;    /*-1: current column cell is snp*/
+   char *sLoadAryC;     /*-1: last column cell is snp*/
+   char *idxAryC;       /*Position of each element*/
+   char *stStoreAryC;   /*Starts for the current column*/
+   char *stLoadAryC;    /*Starts for the last column*/
+   void *memV;          /*malloc pointer (for free)*/
+   char *seqStr;        /*Sequence the profile is for*/
+   unsigned long lenMemUL; /*Bytes in memV*/
+
+   unsigned long lenProfUL; /*Number of bases in profile*/
+   unsigned long lenSegUL;  /*Vectors per column*/
+   unsigned int lanesUI;    /*Elements per vector*/
+   unsigned char widthUC;   /*16 or 32 bit elements*/
+   unsigned char vectTypeUC;/*Instruction set used*/
+   char refBl;             /*1: profile is the reference*/
+
+   char bestDirC;          /*Tie order (alnSet bestDirC)*/
+   char tieSnpEC;     /*-1: snp beats seqStr gap on ties*/
+   char tieFSnpC;     /*-1: profile gap beats snp on ties*/
+   char tieFEC;       /*-1: profile gap beats seqStr gap*/
+
+   int32_t gapOpenI;       /*Gap opening penalty (< 0)*/
+   int32_t gapExtendI;     /*Gap extension penalty (< 0)*/
+   int32_t maxScoreI;      /*Largest score in the profile*/
+   int32_t minScoreI;      /*Lowest score in the profile*/
+}stripedProf;
+
+/*--------------------------------------------------------\
+| Output:
+|  - Returns:
+|    o defVectSSE2, defVectAVX2, or defVectAVX512 for the
+|      best instruction set the cpu has
+|    o defVectScalar if no vector support (non-x86)
+\--------------------------------------------------------*/
+unsigned char getVectType(
+   unsigned char requestUC /*defVect* the user wanted*/
+); /*~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~\
+   ' Fun-01 TOC: getVectType
+   '  - Finds the best vector instruction set this cpu
+   '    supports (never above requestUC)
+   \~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~*/
+
+/*--------------------------------------------------------\
+| Output:
+|  - Modifies:
+|    o All values in profST to be 0
+\--------------------------------------------------------*/
+void initStripedProf(
+   struct stripedProf *profST
+); /*~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~\
+   ' Fun-02 TOC: initStripedProf
+   '  - Sets all variables in a stripedProf struct to 0
+   \~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~*/
+
+/*--------------------------------------------------------\
+| Output:
+|  - Frees:
+|    o All memory in profST and re-initializes profST
+|    o Does not free profST
+\--------------------------------------------------------*/
+void freeStripedProf(
+   struct stripedProf *profST
+); /*~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~\
+   ' Fun-03 TOC: freeStripedProf
+   '  - Frees all variables in a stripedProf struct
+   \~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~*/
+
+/*--------------------------------------------------------\
+| Output:
+|  - Modifies:
+|    o profST to have a profile for seqStr. Old memory in
+|      profST is reused when it is large enough.
+|    o Nothing if profST already has a profile for
+|      seqStr (same pointer, length, and settings). Call
+|      freeStripedProf if seqStr was changed in place.
+|  - Returns:
+|    o 0 for success
+|    o 1 if there is no vector support (use scalar)
+|    o 64 for memory errors
+\--------------------------------------------------------*/
+unsigned char makeStripedProf(
+   char *seqStr,          /*Sequence (lookup index)*/
+   unsigned long lenSeqUL,/*Number of bases in seqStr*/
+   char refBl,            /*1: seqStr is the reference*/
+   unsigned char widthUC, /*defStriped16 or defStriped32*/
+   struct alnSet *settings,/*Scoring matrix and gaps*/
+   struct stripedProf *profST /*Profile to build*/
+); /*~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~\
+   ' Fun-04 TOC: makeStripedProf
+   '  - Builds a striped profile for a sequence
+   '  o fun-04 sec-01:
+   '    - Variable declerations
+   '  o fun-04 sec-02:
+   '    - Find the vector size and allocate memory
+   '  o fun-04 sec-03:
+   '    - Fill in the profile
+   \~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~*/
+
+/*--------------------------------------------------------\
+| Output:
+|  - Modifies:
+|    o retScoreST to have the score, end of the alignment
+|      in the profile (refEndUL), and end of the
+|      alignment in seqStr (qryEndUL). These are index 0
+|      and are relative to the start of each sequence.
+|    o Local alignments also get the start of the
+|      alignment (refStartUL and qryStartUL). Ties for the
+|      best cell are the same as memWaterAln when the
+|      profile is the reference.
+|  - Returns:
+|    o 0 for success
+|    o 1 if the 16 bit scores overflowed (use 32 bits)
+\--------------------------------------------------------*/
+unsigned char stripedScore(
+   struct stripedProf *profST, /*Profile to score with*/
+   char *seqStr,          /*Sequence (lookup index)*/
+   unsigned long lenSeqUL,/*Number of bases in seqStr*/
+   char alnTypeC,         /*defStriped(Local/Global)*/
+   struct scoresStruct *retScoreST /*Holds the score*/
+); /*~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~\
+   ' Fun-05 TOC: stripedScore
+   '  - Scores one sequence against a striped profile
+   \~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~*/
+
+/*--------------------------------------------------------\
+| Output:
+|  - Modifies:
+|    o retScoreST to have the best score and the index 0
+|      start and end coordinates of the best Waterman
+|      alignment
+|  - Returns:
+|    o 0 for success
+|    o 1 if there is no vector support (use scalar)
+|    o 64 for memory errors
+\--------------------------------------------------------*/
+unsigned char stripedWaterScore(
+   struct seqStruct *qryST,   /*Query; offsetUL-endAlnUL*/
+   struct seqStruct *refST,   /*Ref; offsetUL-endAlnUL*/
+   struct alnSet *settings,   /*Settings for alignment*/
+   struct stripedProf *profST,/*Reused memory or 0*/
+   struct scoresStruct *retScoreST /*Holds the score*/
+); /*~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~\
+   ' Fun-06 TOC: stripedWaterScore
+   '  - Finds the best score and coordinates of a
+   '    Waterman alignment with the striped kernel
+   \~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~*/
+
+/*--------------------------------------------------------\
+| Output:
+|  - Modifies:
+|    o retScoreST to have the score of the Needleman
+|      alignment and the start/end coordinates
+|  - Returns:
+|    o 0 for success
+|    o 1 if there is no vector support (use scalar)
+|    o 64 for memory errors
+\--------------------------------------------------------*/
+unsigned char stripedNeedleScore(
+   struct seqStruct *qryST,   /*Query; offsetUL-endAlnUL*/
+   struct seqStruct *refST,   /*Ref; offsetUL-endAlnUL*/
+   struct alnSet *settings,   /*Settings for alignment*/
+   struct stripedProf *profST,/*Reused memory or 0*/
+   struct scoresStruct *retScoreST /*Holds the score*/
+); /*~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~\
+   ' Fun-07 TOC: stripedNeedleScore
+   '  - Finds the score of a Needleman alignment with the
+   '    striped kernel
+   \~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~*/
+
+#endif
@@ -0,0 +1,658 @@
+/*#########################################################
+# Name: stripedAlnKern
+# Use:
+#  - Template for the striped (Farrar) scoring kernel.
+#    stripedAln.c includes this file once for each
+#    instruction set and element width.
+#  - There is no include guard on purpose. Every macro
+#    below is undefined at the end of this file.
+# Macros the includer must define:
+#  - kernName: Name of the function to make
+#  - kernTarget: __attribute__((target("..."))) for cpu
+#  - vectT: Vector type (__m128i, __m256i, __m512i)
+#  - elmT: Element type (int16_t or int32_t)
+#  - defLanes: Number of elements in a vector
+#  - defElmMin: Smallest value used (negative infinity)
+#  - defElmMax: Largest value an element can hold
+#  - defElmMask: Mask to read an element as unsigned
+#  - defCoordWords: Elements needed to hold a coordinate
+#  - vLoad(ptr): Unaligned vector load
+#  - vStore(ptr, vect): Unaligned vector store
+#  - vSet1(val): Set all elements to val
+#  - vAdd(vect1, vect2): Add (saturating for 16 bit)
+#  - vMax(vect1, vect2): Element maximum
+#  - vAnd, vOr, vXor (vect1, vect2): Bitwise and/or/xor
+#  - vAndNot(vect1, vect2): ~vect1 & vect2
+#  - vCmpGt(vect1, vect2): -1 if vect1 > vect2, else 0
+#  - vCmpEq(vect1, vect2): -1 if vect1 == vect2, else 0
+#  - vAnyGt(vect1, vect2): 1 if any vect1 element is
+#    greater than the matching vect2 element
+#  - vAnyNz(vect): 1 if any element is not 0
+#  - vShiftIns(vect, val): Move every element up one lane
+#    and put val in lane 0
+# Libraries:
+#  - "stripedAln.h" (by includer)
+#########################################################*/
+
+/*~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~\
+' SOF: Start Of Functions
+'  o fun-01 kernName:
+'    - Scores one sequence against a striped profile
+'  o fun-02 kernClamp:
+'    - Keeps a boundary score above defElmMin (macro)
+'  o fun-03 kernBlend:
+'    - Picks elements from two vectors with a mask (macro)
+'  o fun-04 kernGap:
+'    - Adds the gap penalty for leaving a cell (macro)
+\~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~*/
+
+/*--------------------------------------------------------\
+| Output:
+|  - Returns:
+|    o scoreL if it is above defElmMin
+|    o defElmMin if scoreL is to small for an element
+\--------------------------------------------------------*/
+#define kernClamp(scoreL) \
+   ((scoreL) < (long) defElmMin ? defElmMin : (scoreL))
+   /*~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~\
+   ' Fun-02 TOC: kernClamp
+   '  - Keeps a boundary score above defElmMin
+   \~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~*/
+
+/*--------------------------------------------------------\
+| Output:
+|  - Returns:
+|    o Vector with elements from yesVect were maskVect is
+|      -1 and elements from noVect were maskVect is 0
+\--------------------------------------------------------*/
+#define kernBlend(maskVect, yesVect, noVect) \
+   vOr( \
+      vAnd((maskVect), (yesVect)), \
+      vAndNot((maskVect), (noVect)) \
+   )
+   /*~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~\
+   ' Fun-03 TOC: kernBlend
+   '  - Picks elements from two vectors with a mask
+   \~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~*/
+
+/*--------------------------------------------------------\
+| Output:
+|  - Returns:
+|    o hVect plus the gap opening penalty for cells that
+|      were a snp/match (snpVect is -1) and the gap
+|      extension penalty for all other cells. This is the
+|      same as the indelScore macro (generalAlnFun.h).
+\--------------------------------------------------------*/
+#define kernGap(hVect, snpVect) \
+   vAdd((hVect), kernBlend((snpVect), openVect, extendVect))
+   /*~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~\
+   ' Fun-04 TOC: kernGap
+   '  - Adds the gap penalty for leaving a cell
+   \~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~*/
+
+/*--------------------------------------------------------\
+| Output:
+|  - Modifies:
+|    o retScoreST to have the score and the index 0 end
+|      of the alignment in the profile (refEndUL if the
+|      profile is the reference) and seqStr. Local
+|      alignments also get the index 0 start.
+|  - Returns:
+|    o 0 for success
+|    o 1 if the best score overflowed the element size
+\--------------------------------------------------------*/
+static kernTarget unsigned char kernName(
+   struct stripedProf *profST, /*Profile to score with*/
+   char *seqStr,          /*Sequence (lookup index)*/
+   unsigned long lenSeqUL,/*Number of bases in seqStr*/
+   char alnTypeC,         /*defStriped(Local/Global)*/
+   struct scoresStruct *retScoreST /*Holds the score*/
+){ /*~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~\
+   ' Fun-01 TOC: kernName
+   '  - Scores one sequence against a striped profile
+   '  o fun-01 sec-01:
+   '    - Variable declerations
+   '  o fun-01 sec-02:
+   '    - Set up the first (gap) column
+   '  o fun-01 sec-03:
+   '    - Score each base in seqStr
+   '  o fun-01 sec-04:
+   '    - Find the cell with the best score
+   \~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~*/
+
+   /*>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>\
+   ^ Fun-01 Sec-01:
+   ^  - Variable declerations
+   \<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<*/
+
+   unsigned long lenSegUL = profST->lenSegUL;
+   unsigned long lenColUL = lenSegUL * defLanes;
+   unsigned long lastSegUL = (lenSegUL - 1) * defLanes;
+   unsigned long segUL = 0;   /*Vector on in the column*/
+   unsigned long colUL = 0;   /*Base on in seqStr*/
+   unsigned long posUL = 0;   /*Base on in the profile*/
+   unsigned long indexUL = 0;
+   unsigned long bestColUL = 0;
+   unsigned long bestPosUL = 0;
+   unsigned long startAryUL[2 * defCoordWords];
+   unsigned int laneUI = 0;
+   unsigned int wordUI = 0;
+   char localBl = (alnTypeC == defStripedLocal);
+   char lazyBl = 0;  /*1: in the lazy F loop*/
+   char changeBl = 0;/*1: lazy F loop changed a cell*/
+
+   elmT *profAry = (elmT *) profST->profAryC;
+   elmT *hStoreAry = (elmT *) profST->hStoreAryC;
+   elmT *hLoadAry = (elmT *) profST->hLoadAryC;
+   elmT *sStoreAry = (elmT *) profST->sStoreAryC;
+   elmT *sLoadAry = (elmT *) profST->sLoadAryC;
+   elmT *idxAry = (elmT *) profST->idxAryC;
+   elmT *stStoreAry = (elmT *) profST->stStoreAryC;
+   elmT *stLoadAry = (elmT *) profST->stLoadAryC;
+   elmT *rowAry = 0;  /*Profile row for the seqStr base*/
+   elmT *swapAry = 0;
+
+   long gapOpenL = profST->gapOpenI;
+   long gapExtendL = profST->gapExtendI;
+   long edgeL = 0;    /*Score of the diagnol gap cell*/
+   long fEdgeL = 0;   /*Profile gap from the gap row*/
+   long bestL = 0;
+
+   vectT hVect;       /*Score (H) of the current cells*/
+   vectT sVect;       /*-1 if the cell is a snp/match*/
+   vectT diagVect;    /*Score of the diagnol cells*/
+   vectT eVect;       /*Gaps in seqStr (from last column)*/
+   vectT fVect;       /*Gaps in profile (moves by row)*/
+   vectT snpVect;     /*Score for a snp/match*/
+   vectT snpWinVect;  /*-1 if snp beat the seqStr gap*/
+   vectT fWinVect;    /*-1 if the profile gap won*/
+   vectT maxVect;     /*Best score in this column*/
+   vectT bestVect;    /*Best score in all columns*/
+   vectT changeVect;  /*Non-zero if a lazy F cell changed*/
+
+   vectT colWordAry[defCoordWords]; /*seqStr position*/
+   vectT diagStAry[2 * defCoordWords]; /*Diagnol start*/
+   vectT fStAry[2 * defCoordWords];    /*Profile gap start*/
+   vectT stAry[2 * defCoordWords];     /*Cell start*/
+   vectT tmpVect;
+
+   vectT openVect = vSet1(profST->gapOpenI);
+   vectT extendVect = vSet1(profST->gapExtendI);
+   vectT zeroVect = vSet1(0);
+   vectT minVect = vSet1(defElmMin);
+
+   /*Same tie order as charMaxScore (-1 if first wins)*/
+   vectT tieSnpEVect = vSet1(profST->tieSnpEC);
+   vectT tieFSnpVect = vSet1(profST->tieFSnpC);
+   vectT tieFEVect = vSet1(profST->tieFEC);
+
+   /*>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>\
+   ^ Fun-01 Sec-02:
+   ^  - Set up the first (gap) column
+   \<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<*/
+
+   /*The gap column is never a snp/match (sLoadAry is 0),
+   ` so gaps out of it are extensions, like NeedlemanAln
+   */
+   for(segUL = 0; segUL < lenSegUL; ++segUL)
+   { /*Loop; through all vectors in the column*/
+      for(laneUI = 0; laneUI < defLanes; ++laneUI)
+      { /*Loop; through all elements in the vector*/
+         posUL = laneUI * lenSegUL + segUL;
+
+         if(localBl) edgeL = 0;
+         else edgeL = gapOpenL + gapExtendL * (long) posUL;
+
+         hLoadAry[segUL * defLanes + laneUI] =
+            (elmT) kernClamp(edgeL);
+      } /*Loop; through all elements in the vector*/
+   } /*Loop; through all vectors in the column*/
+
+   memset(sLoadAry, 0, lenColUL * sizeof(elmT));
+
+   for(wordUI = 0; wordUI < 2 * defCoordWords; ++wordUI)
+   { /*Loop; clear the start coordinates*/
+      memset(
+         stLoadAry + wordUI * lenColUL,
+         0,
+         lenColUL * sizeof(elmT)
+      );
+   } /*Loop; clear the start coordinates*/
+
+   for(wordUI = 0; wordUI < 2 * defCoordWords; ++wordUI)
+      startAryUL[wordUI] = 0;
+
+   if(localBl) bestL = 0;
+   else bestL = defElmMin;
+
+   bestVect = vSet1((elmT) bestL);
+
+   /*>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>\
+   ^ Fun-01 Sec-03:
+   ^  - Score each base in seqStr
+   ^  o fun-01 sec-03 sub-01:
+   ^    - Set up the gap row for this column
+   ^  o fun-01 sec-03 sub-02:
+   ^    - Find the snp/match and seqStr gap scores
+   ^  o fun-01 sec-03 sub-03:
+   ^    - Add in the profile gap and find the direction
+   ^  o fun-01 sec-03 sub-04:
+   ^    - Find the start of local alignments
+   ^  o fun-01 sec-03 sub-05:
+   ^    - Save the cell and move to the next vector
+   ^  o fun-01 sec-03 sub-06:
+   ^    - Check if this column has a new best score
+   \<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<*/
+
+   /*Scores use the alnSeq gap model. A gap out of a cell
+   ` costs the gap opening penalty when the cell was a
+   ` snp/match and the extension penalty otherwise. Ties
+   ` use the same order as the scalar aligners, so each
+   ` cell gets the same score and direction.
+   */
+   for(colUL = 0; colUL < lenSeqUL; ++colUL)
+   { /*Loop; through all bases in seqStr*/
+
+      /***************************************************\
+      * Fun-01 Sec-03 Sub-01:
+      *  - Set up the gap row for this column
+      \***************************************************/
+
+      rowAry =
+           profAry
+         + (unsigned long)
+              ((uint8_t) seqStr[colUL] & defClearNonAlph)
+           * lenColUL;
+
+      if(localBl)
+      { /*If doing a local alignment*/
+         edgeL = 0;
+         fEdgeL = defElmMin; /*Can never be above 0*/
+      } /*If doing a local alignment*/
+
+      else
+      { /*Else doing a global alignment*/
+         if(colUL == 0) edgeL = 0;
+         else edgeL = gapOpenL+gapExtendL*(long)(colUL-1);
+
+         /*The gap row cell is a gap, so extend it*/
+         fEdgeL =
+            gapOpenL + gapExtendL * (long) (colUL + 1);
+      } /*Else doing a global alignment*/
+
+      edgeL = kernClamp(edgeL);
+      fEdgeL = kernClamp(fEdgeL);
+
+      for(wordUI = 0; wordUI < defCoordWords; ++wordUI)
+         colWordAry[wordUI] =
+            vSet1(
+               (elmT)
+                  (colUL >> (wordUI * sizeof(elmT) * 8))
+            ); /*Split the position into elements*/
+
+      fVect = vShiftIns(minVect, (elmT) fEdgeL);
+
+      for(wordUI = 0; wordUI < 2 * defCoordWords; ++wordUI)
+         fStAry[wordUI] = zeroVect;
+
+      maxVect = minVect;
+      lazyBl = 0;
+      changeBl = 0;
+      segUL = 0;
+
+      for(;;)
+      { /*Loop; through all vectors (and lazy F loop)*/
+
+         /************************************************\
+         * Fun-01 Sec-03 Sub-02:
+         *  - Find the snp/match and seqStr gap scores
+         \************************************************/
+
+         indexUL = segUL * defLanes;
+
+         if(segUL == 0)
+         { /*If on the first vector, shift the last*/
+            diagVect =
+               vShiftIns(
+                  vLoad(hLoadAry + lastSegUL),
+                  (elmT) edgeL
+               );
+
+            if(localBl)
+            { /*If need the start coordinates*/
+               for(wordUI=0; wordUI < 2*defCoordWords; ++wordUI)
+                  diagStAry[wordUI] =
+                     vShiftIns(
+                        vLoad(
+                             stLoadAry
+                           + wordUI * lenColUL
+                           + lastSegUL
+                        ),
+                        0
+                     );
+            } /*If need the start coordinates*/
+         } /*If on the first vector, shift the last*/
+
+         else
+         { /*Else the diagnol is the last vector*/
+            diagVect = vLoad(hLoadAry + indexUL - defLanes);
+
+            if(localBl)
+            { /*If need the start coordinates*/
+               for(wordUI=0; wordUI < 2*defCoordWords; ++wordUI)
+                  diagStAry[wordUI] =
+                     vLoad(
+                          stLoadAry
+                        + wordUI * lenColUL
+                        + indexUL
+                        - defLanes
+                     );
+            } /*If need the start coordinates*/
+         } /*Else the diagnol is the last vector*/
+
+         snpVect = vAdd(diagVect, vLoad(rowAry + indexUL));
+
+         eVect =
+            kernGap(
+               vLoad(hLoadAry + indexUL),
+               vLoad(sLoadAry + indexUL)
+            );
+
+         /*snp beats the gap if it is larger or ties and
+         ` the tie order perfers snps
+         */
+         snpWinVect =
+            vOr(
+               vCmpGt(snpVect, eVect),
+               vAnd(vCmpEq(snpVect, eVect), tieSnpEVect)
+            );
+
+         hVect = vMax(snpVect, eVect);
+
+         /************************************************\
+         * Fun-01 Sec-03 Sub-03:
+         *  - Add in the profile gap and find the direction
+         \************************************************/
+
+         fWinVect =
+            vOr(
+               vCmpGt(fVect, hVect),
+               vAnd(
+                  vCmpEq(fVect, hVect),
+                  kernBlend(snpWinVect,tieFSnpVect,tieFEVect)
+               )
+            );
+
+         hVect = vMax(hVect, fVect);
+         sVect = vAndNot(fWinVect, snpWinVect);
+
+         if(localBl)
+         { /*If doing a local alignment*/
+            /*Cells at or below 0 are stops*/
+            tmpVect = vCmpGt(hVect, zeroVect);
+            hVect = vAnd(hVect, tmpVect);
+            sVect = vAnd(sVect, tmpVect);
+
+            /*********************************************\
+            * Fun-01 Sec-03 Sub-04:
+            *  - Find the start of local alignments
+            \*********************************************/
+
+            /*A snp/match after a stop starts an alignment*/
+            tmpVect = vCmpEq(diagVect, zeroVect);
+
+            for(wordUI = 0; wordUI < 2*defCoordWords; ++wordUI)
+            { /*Loop; through the start coordinates*/
+               if(wordUI < defCoordWords)
+                  stAry[wordUI] =
+                     vLoad(idxAry+wordUI*lenColUL+indexUL);
+               else
+                  stAry[wordUI] =
+                     colWordAry[wordUI - defCoordWords];
+
+               stAry[wordUI] =
+                  kernBlend(
+                     tmpVect,
+                     stAry[wordUI],
+                     diagStAry[wordUI]
+                  ); /*Start of the snp/match*/
+
+               stAry[wordUI] =
+                  kernBlend(
+                     snpWinVect,
+                     stAry[wordUI],
+                     vLoad(
+                          stLoadAry
+                        + wordUI * lenColUL
+                        + indexUL
+                     )
+                  ); /*Start of the snp or seqStr gap*/
+
+               stAry[wordUI] =
+                  kernBlend(
+                     fWinVect,
+                     fStAry[wordUI],
+                     stAry[wordUI]
+                  ); /*Start of the cell*/
+            } /*Loop; through the start coordinates*/
+         } /*If doing a local alignment*/
+
+         /************************************************\
+         * Fun-01 Sec-03 Sub-05:
+         *  - Save the cell and move to the next vector
+         \************************************************/
+
+         if(lazyBl)
+         { /*If in the lazy F loop*/
+            /*No change means the rest of the column
+            ` already has the right profile gaps
+            */
+            changeVect =
+               vOr(
+                  vXor(hVect, vLoad(hStoreAry + indexUL)),
+                  vXor(sVect, vLoad(sStoreAry + indexUL))
+               );
+
+            if(localBl)
+            { /*If the starts also need to match*/
+               for(wordUI=0; wordUI < 2*defCoordWords; ++wordUI)
+                  changeVect =
+                     vOr(
+                        changeVect,
+                        vXor(
+                           stAry[wordUI],
+                           vLoad(
+                                stStoreAry
+                              + wordUI * lenColUL
+                              + indexUL
+                           )
+                        )
+                     );
+            } /*If the starts also need to match*/
+
+            if(! vAnyNz(changeVect)) break;
+            changeBl = 1;
+         } /*If in the lazy F loop*/
+
+         else maxVect = vMax(maxVect, hVect);
+
+         vStore(hStoreAry + indexUL, hVect);
+         vStore(sStoreAry + indexUL, sVect);
+
+         if(localBl)
+         { /*If saving the start coordinates*/
+            for(wordUI = 0; wordUI < 2*defCoordWords; ++wordUI)
+            { /*Loop; save the start coordinates*/
+               vStore(
+                  stStoreAry + wordUI * lenColUL + indexUL,
+                  stAry[wordUI]
+               );
+
+               fStAry[wordUI] = stAry[wordUI];
+            } /*Loop; save the start coordinates*/
+         } /*If saving the start coordinates*/
+
+         fVect = kernGap(hVect, sVect);
+         ++segUL;
+
+         if(segUL == lenSegUL)
+         { /*If need to move to the next lane*/
+            /*The first vector did not know the gaps from
+            ` the last vector, so redo it (lazy F loop)
+            */
+            segUL = 0;
+            lazyBl = 1;
+            fVect = vShiftIns(fVect, (elmT) fEdgeL);
+
+            for(wordUI = 0; wordUI < 2*defCoordWords; ++wordUI)
+               fStAry[wordUI] = vShiftIns(fStAry[wordUI], 0);
+         } /*If need to move to the next lane*/
+      } /*Loop; through all vectors (and lazy F loop)*/
+
+      /***************************************************\
+      * Fun-01 Sec-03 Sub-06:
+      *  - Check if this column has a new best score
+      \***************************************************/
+
+      if(changeBl && localBl)
+      { /*If the lazy F loop changed scores*/
+         maxVect = minVect;
+
+         for(segUL = 0; segUL < lenSegUL; ++segUL)
+            maxVect =
+               vMax(maxVect, vLoad(hStoreAry+segUL*defLanes));
+      } /*If the lazy F loop changed scores*/
+
+      if(localBl && vAnyGt(maxVect, bestVect))
+      { /*If may have a new best score*/
+         /*Same order as memWaterAln, the first cell with
+         ` the best score is kept
+         */
+         for(posUL = 0; posUL < profST->lenProfUL; ++posUL)
+         { /*Loop; find the best cell*/
+            indexUL =
+                 (posUL % lenSegUL) * defLanes
+               + posUL / lenSegUL;
+
+            if(hStoreAry[indexUL] > bestL)
+            { /*If this cell has a better score*/
+               bestL = hStoreAry[indexUL];
+               bestPosUL = posUL;
+               bestColUL = colUL;
+
+               for(wordUI=0; wordUI < 2*defCoordWords; ++wordUI)
+                  startAryUL[wordUI] =
+                       (unsigned long)
+                       stStoreAry[wordUI * lenColUL + indexUL]
+                     & defElmMask;
+            } /*If this cell has a better score*/
+         } /*Loop; find the best cell*/
+
+         bestVect = vSet1((elmT) bestL);
+      } /*If may have a new best score*/
+
+      swapAry = hLoadAry;
+      hLoadAry = hStoreAry;
+      hStoreAry = swapAry;
+
+      swapAry = sLoadAry;
+      sLoadAry = sStoreAry;
+      sStoreAry = swapAry;
+
+      swapAry = stLoadAry;
+      stLoadAry = stStoreAry;
+      stStoreAry = swapAry;
+   } /*Loop; through all bases in seqStr*/
+
+   /*>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>\
+   ^ Fun-01 Sec-04:
+   ^  - Find the cell with the best score
+   \<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<*/
+
+   if(! localBl)
+   { /*If doing a global alignment*/
+      bestPosUL = profST->lenProfUL - 1;
+      bestColUL = lenSeqUL - 1;
+
+      /*The last column is in hLoadAry after the swap*/
+      bestL =
+         hLoadAry[
+              (bestPosUL % lenSegUL) * defLanes
+            + bestPosUL / lenSegUL
+         ];
+   } /*If doing a global alignment*/
+
+   else if(bestL >= (long) defElmMax - profST->maxScoreI)
+      return 1; /*Overflowed the element size*/
+
+   retScoreST->scoreL = bestL;
+
+   if(profST->refBl)
+   { /*If the profile is the reference*/
+      retScoreST->refEndUL = bestPosUL;
+      retScoreST->qryEndUL = bestColUL;
+   } /*If the profile is the reference*/
+
+   else
+   { /*Else the profile is the query*/
+      retScoreST->refEndUL = bestColUL;
+      retScoreST->qryEndUL = bestPosUL;
+   } /*Else the profile is the query*/
+
+   if(localBl && bestL > 0)
+   { /*If have the start of a local alignment*/
+      /*Rebuild the coordinates from the elements*/
+      posUL = 0;
+      colUL = 0;
+
+      for(wordUI = 0; wordUI < defCoordWords; ++wordUI)
+      { /*Loop; merge the elements*/
+         posUL |=
+            startAryUL[wordUI] << (wordUI*sizeof(elmT)*8);
+         colUL |=
+               startAryUL[wordUI + defCoordWords]
+            << (wordUI * sizeof(elmT) * 8);
+      } /*Loop; merge the elements*/
+
+      if(profST->refBl)
+      { /*If the profile is the reference*/
+         retScoreST->refStartUL = posUL;
+         retScoreST->qryStartUL = colUL;
+      } /*If the profile is the reference*/
+
+      else
+      { /*Else the profile is the query*/
+         retScoreST->refStartUL = colUL;
+         retScoreST->qryStartUL = posUL;
+      } /*Else the profile is the query*/
+   } /*If have the start of a local alignment*/
+
+   return 0;
+} /*kernName*/
+
+#undef kernGap
+#undef kernBlend
+#undef kernClamp
+#undef kernName
+#undef kernTarget
+#undef vectT
+#undef elmT
+#undef defLanes
+#undef defElmMin
+#undef defElmMax
+#undef defElmMask
+#undef defCoordWords
+#undef vLoad
+#undef vStore
+#undef vSet1
+#undef vAdd
+#undef vMax
+#undef vAnd
+#undef vOr
+#undef vXor
+#undef vAndNot
+#undef vCmpGt
+#undef vCmpEq
+#undef vAnyGt
+#undef vAnyNz
+#undef vShiftIns
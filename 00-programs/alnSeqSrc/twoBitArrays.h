@@ -2,9 +2,12 @@
 # Name: twoBitArrays
 # Use:
 #   o Holds functions to handle two bit arrays
+#   o Each limb is a uint64_t holding 32 two bit elements.
+#     Element 0 is in the lowest two bits.
 # Includes:
 # C Standard Includes:
 #   - <stdint.h>
+#   - <stdlib.h>
 #########################################################*/
 
 #ifndef TWOBITARRAYS_H
@@ -13,6 +16,13 @@
 #include <stdint.h>
 #include <stdlib.h>
 
+#define defTwoBitLimbElms 32  /*Elements in one limb*/
+#define defTwoBitLimbShift 5  /*log2(defTwoBitLimbElms)*/
+#define defTwoBitElmMask 31   /*defTwoBitLimbElms - 1*/
+
+/*Every element set to 1 (for broadcasting a value)*/
+#define defTwoBitOnes 0x5555555555555555ULL
+
 /*Get the negative flag for a character*/
 /*--------------------------------------------------------\
 | Use:
@@ -51,13 +61,13 @@ static inline char getCNegBit(
 '  - fun-08 changeTwoBitElm:
 '     o Changes a single two bit value in a two bit array.
 '  - fun-09 blankTwoBitLimb:
-'     o Sets a uint8_t (a limb) in a two bit array to 0.
-'       Each limb holds four two bit elments.
+'     o Sets a uint64_t (a limb) in a two bit array to 0.
+'       Each limb holds 32 two bit elments.
 '  - fun-10 twoBitMvToNextLimb:
-'     o Moves to start of the next limb (uint8_t) in two
+'     o Moves to start of the next limb (uint64_t) in two
 '       bit array
 '  - fun-11 twoBitMvToLastLimb:
-'     o Moves to start of the previous limb (uint8_t) in
+'     o Moves to start of the previous limb (uint64_t) in
 '       two bit array
 '  - fun-12 makeTwoBit:
 '     o Make a two bit array struct
@@ -72,6 +82,14 @@ static inline char getCNegBit(
 '     o Get the length of a two-bit array
 '  - fun-17 twoBitGetIndex:
 '    - Returns the index of the current two bit element
+'  - fun-18 makeTwoBitMtrx:
+'    - Make a two bit matrix with rows starting on limbs
+'  - fun-19 twoBitPackRow:
+'    - Packs a row of byte directions into a two bit
+'      matrix a limb at a time
+'  - fun-20 twoBitRunBack:
+'    - Counts the elements in a run of the current value
+'      (going back) and moves to the end of the run
 \~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~*/
 
 /*--------------------------------------------------------\
@@ -80,10 +98,13 @@ static inline char getCNegBit(
 \--------------------------------------------------------*/
 typedef struct twoBitAry
 { // twoBitArry structure
-  uint8_t *firstLimbUCPtr; // First limb in two bit array
-  uint8_t *limbOnUCPtr;    // Limb currently working on
+  uint64_t *firstLimbULPtr; // First limb in two bit array
+  uint64_t *limbOnULPtr;    // Limb currently working on
   int8_t elmOnC;         // element on in the limb
   unsigned long lenAryUL;  // Number of limbs in the array
+  unsigned long lenRowUL;
+     // Elements in one row (padded to whole limbs) for
+     // makeTwoBitMtrx. 0 if not a matrix (makeTwoBit)
 }twoBitAry;
 
 /*--------------------------------------------------------\
@@ -91,7 +112,7 @@ typedef struct twoBitAry
 |  - Returns:
 |    o Two bits of interest from the two bit array
 | Note:
-|  - Each limb has four two bit elements
+|  - Each limb has 32 two bit elements
 \--------------------------------------------------------*/
 static inline uint8_t getTwoBitElm(
   struct twoBitAry *twoBitST // Array to get element from
@@ -100,13 +121,10 @@ static inline uint8_t getTwoBitElm(
    '  - Get an element from a two bit array
    \~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~*/
 
-    /*This was a branchless attempt. It had little affect
-      on the speed. For this to work, the case must
-      be reversed
-    */
-    char shiftC = twoBitST->elmOnC << 1;
     return
-        (*twoBitST->limbOnUCPtr & (3 << shiftC)) >> shiftC;
+         (uint8_t)
+         (*twoBitST->limbOnULPtr >> (twoBitST->elmOnC << 1))
+       & 3;
 } // getTwoBitElm
 
 /*--------------------------------------------------------\
@@ -123,8 +141,9 @@ static inline void twoBitMvToNextElm(
    \~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~*/
 
    ++twoBitST->elmOnC;
-   twoBitST->limbOnUCPtr += (twoBitST->elmOnC >> 2);
-   twoBitST->elmOnC &= 3;
+   twoBitST->limbOnULPtr +=
+      (twoBitST->elmOnC >> defTwoBitLimbShift);
+   twoBitST->elmOnC &= defTwoBitElmMask;
    return;
 } // twoBitMvToNextElm
 
@@ -143,8 +162,8 @@ static inline void twoBitMvForXElm(
 
    // Get whole shifts to perform
    shiftByUL += twoBitST->elmOnC;
-   twoBitST->limbOnUCPtr += (shiftByUL >> 2);
-   twoBitST->elmOnC = (shiftByUL & 3);
+   twoBitST->limbOnULPtr += (shiftByUL >> defTwoBitLimbShift);
+   twoBitST->elmOnC = (shiftByUL & defTwoBitElmMask);
    return;
 } // twoBitMvForXElm
 
@@ -162,11 +181,11 @@ static inline void twoBitMvBackOneElm(
 
    /*Does not alter speed from a switch*/
    --twoBitST->elmOnC;
-   twoBitST->limbOnUCPtr -= getCNegBit(twoBitST->elmOnC);
+   twoBitST->limbOnULPtr -= getCNegBit(twoBitST->elmOnC);
    /*Adds an extra 1 if I am moving back extra elements*/
-   twoBitST->elmOnC = 3 & twoBitST->elmOnC;
-    /*-1 goes to 3, and all other values are 3 or less and
-    ` so remain the same
+   twoBitST->elmOnC &= defTwoBitElmMask;
+    /*-1 goes to 31, and all other values are 31 or less
+    ` and so remain the same
     */
    return; 
 } // twoBitMvToNextElm
@@ -182,34 +201,21 @@ static inline void twoBitMvBackXElm(
 ){ /*~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~\
    ' Fun-06 TOC: Sec-1 Sub-1: twoBitMvBackXElm
    '  - Moves back X elements back in a 2-bit array
-   '  - THIS HAS NO BEEN TESTED
    \~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~*/
 
    /*Figure out how many elements I am moving back*/
-   twoBitST->elmOnC = twoBitST->elmOnC - (shiftL & 3);
+   twoBitST->elmOnC =
+      twoBitST->elmOnC - (shiftL & defTwoBitElmMask);
 
-   twoBitST->limbOnUCPtr -=
-      ((shiftL >> 2) + getCNegBit(twoBitST->elmOnC));
+   twoBitST->limbOnULPtr -=
+      (  (shiftL >> defTwoBitLimbShift)
+       + getCNegBit(twoBitST->elmOnC)
+      );
    /*Adds an extra 1 if I am moving back extra elements*/
 
-   twoBitST->elmOnC =
-        twoBitST->elmOnC
-      ^ (  -(getCNegBit(twoBitST->elmOnC))
-         & (twoBitST->elmOnC ^ (twoBitST->elmOnC + 4))
-        );
-     /*This is a minimize function, but instead of
-     ` Returning the minimum if negative, it returns
-     ` the minimum + 4.
-     ` -(twoBitST->elmOnC < 0)
-     `   Is -1 (111....) if elmOnC is negative
-     `   Is 0 other if elmOnC is not negative.
-     ` elmOnC + 4
-     `   This is the correct ending index if elmOnC is
-     `   negative.
-     ` elmOnC ^ (-1 & (elmOnC ^ (elmOnC + 4)))
-     `   This returns elmOnC + 4
-     ` elmOnC ^ (0 & (elmOnC ^ (elmOnC + 4)))
-     `   This returns elmOnC
+   twoBitST->elmOnC &= defTwoBitElmMask;
+     /*-31 to -1 go to 1 to 31 (the element in the previous
+     ` limb). 0 to 31 remain the same.
      */
    return;
 } // twoBitMvBackXElm
@@ -229,25 +235,17 @@ static inline void changeTwoBitElm(
    '  - Changes a single two bit value in a two bit array.
    \~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~*/
 
-    /* This was a branchless attempt. It had little affect
-    `  on the acutal speed and may have had a slight slow
-    `  down.*/
-    char valC = twoBitST->elmOnC << 1;
-    char clearC = 3 << valC;
-
-    valC = newValueUC << valC;
-    /*This shifts the new value to its correct position
-    ` in the two bit array
-    */
+    char shiftC = twoBitST->elmOnC << 1;
 
-    *twoBitST->limbOnUCPtr =
-      (*twoBitST->limbOnUCPtr & (~clearC)) | valC;
+    *twoBitST->limbOnULPtr =
+         (*twoBitST->limbOnULPtr & ~(((uint64_t) 3) << shiftC))
+       | (((uint64_t) newValueUC) << shiftC);
     /*This clears and then sets the value to its correct
     `  postion:
-    ` & (~valC):
-    `   ~valC removes
+    ` & ~(3 << shiftC):
+    `   removes the old value
     ` and then
-    ` sets the postion to the input value (| valC).
+    ` sets the postion to the input value (| newValue).
     */
 
     return;
@@ -263,10 +261,10 @@ static inline void blankTwoBitLimb(
 ){ /*~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~\
    ' Fun-09 TOC: Sec-1 Sub-1: blankTwoBitLimb
    '  - Sets a limb in a two bit array to 0.
-   '    Each limb holds four two bit elments.
+   '    Each limb holds 32 two bit elments.
    \~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~*/
 
-   twoBitST->limbOnUCPtr = 0;
+   *twoBitST->limbOnULPtr = 0;
    twoBitST->elmOnC = 0;
 } // blankTwoBitLimb
 
@@ -285,7 +283,7 @@ static inline void twoBitMvToNextLimb(
    '  - Moves back to start of limb in a two bit array
    \~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~*/
 
-   ++twoBitST->limbOnUCPtr;
+   ++twoBitST->limbOnULPtr;
    twoBitST->elmOnC = 0;
 
    return;
@@ -294,17 +292,17 @@ static inline void twoBitMvToNextLimb(
 /*--------------------------------------------------------\
 | Output:
 |  - Modifies:
-|    o lastLimbUCPtr to point to the previous limb
+|    o twoBitST to point to the previous limb
 \--------------------------------------------------------*/
 static inline void twoBitMvToLastLimb(
     struct twoBitAry *twoBitST // array to move back in
 ){ /*~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~\
    ' Fun-11 TOC: Sec-1 Sub-1: twoBitMvToLastLimb
-   '  - Moves to the start of the previous limb (uint8_t)
+   '  - Moves to the start of the previous limb (uint64_t)
    '    in the two bit array
    \~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~*/
 
-   --twoBitST->limbOnUCPtr;
+   --twoBitST->limbOnULPtr;
    twoBitST->elmOnC = 0;
 
    return;
@@ -313,7 +311,7 @@ static inline void twoBitMvToLastLimb(
 /*--------------------------------------------------------\
 | Output:
 |  - Returns:
-|    - twoBitAry structure with an unit8_t array of limbs
+|    - twoBitAry structure with an unit64_t array of limbs
 |    - blankAryBl = 1: returns a blank twoBitAry structer
 \--------------------------------------------------------*/
 static inline struct twoBitAry * makeTwoBit(
@@ -330,25 +328,31 @@ static inline struct twoBitAry * makeTwoBit(
 
    if(twoBitST == 0) return 0; // Memory error
    twoBitST->elmOnC = 0;
+   twoBitST->lenRowUL = 0;
 
    switch(blankAryBl)
    { // Switch check if making an array
      case 1:
-       twoBitST->firstLimbUCPtr = 0;
-       twoBitST->limbOnUCPtr = 0;
+       twoBitST->firstLimbULPtr = 0;
+       twoBitST->limbOnULPtr = 0;
        twoBitST->lenAryUL = 0;
        return twoBitST;
    } // Switch check if making an array
 
-   twoBitST->firstLimbUCPtr =
-     calloc((lenArryUL >> 2) + 1, sizeof(uint8_t));
-     // Each limb (uint8_t) has four elements, so I need
-     // to divide the number of elements by 4 (>> 2)
+   twoBitST->lenAryUL = (lenArryUL >> defTwoBitLimbShift) + 1;
+     // Each limb (uint64_t) has 32 elements, so I need
+     // to divide the number of elements by 32 (>> 5)
+
+   twoBitST->firstLimbULPtr =
+     calloc(twoBitST->lenAryUL, sizeof(uint64_t));
 
-   if(twoBitST->firstLimbUCPtr == 0) return 0;
+   if(twoBitST->firstLimbULPtr == 0)
+   { // If I had a memory error
+     free(twoBitST);
+     return 0;
+   } // If I had a memory error
 
-   twoBitST->lenAryUL = ((lenArryUL >> 2) << 2) + 4;
-   twoBitST->limbOnUCPtr = twoBitST->firstLimbUCPtr;
+   twoBitST->limbOnULPtr = twoBitST->firstLimbULPtr;
 
    return twoBitST;
 } // makeTwoBitArray
@@ -367,10 +371,11 @@ static inline void cpTwoBitPos(
    '  - copy pointers of cpTwoBitST to dupTwoBitST
    \~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~*/
 
-   dupTwoBitST->firstLimbUCPtr =cpTwoBitST->firstLimbUCPtr;
-   dupTwoBitST->limbOnUCPtr = cpTwoBitST->limbOnUCPtr;
+   dupTwoBitST->firstLimbULPtr =cpTwoBitST->firstLimbULPtr;
+   dupTwoBitST->limbOnULPtr = cpTwoBitST->limbOnULPtr;
    dupTwoBitST->elmOnC = cpTwoBitST->elmOnC;
    dupTwoBitST->lenAryUL = cpTwoBitST->lenAryUL;
+   dupTwoBitST->lenRowUL = cpTwoBitST->lenRowUL;
 
    return;
 } // cpTwoBitPos
@@ -394,13 +399,13 @@ static inline void freeTwoBit(
    switch(doNotFreeAryBl)
    { // switch, check if freeing the array
      case 0:
-       if(stToFree->firstLimbUCPtr != 0)
-         free(stToFree->firstLimbUCPtr);
+       if(stToFree->firstLimbULPtr != 0)
+         free(stToFree->firstLimbULPtr);
    } // switch, check if freeing the array
    
    switch(twoBitOnStackBl)
    { // switch; check if freeing the twobit structer
-     case 1: free(stToFree);
+     case 0: free(stToFree);
    } // switch; check if freeing the twobit structer
 
    return;
@@ -422,10 +427,10 @@ static inline void twoBitMvXElmFromStart(
    \~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~*/
 
    // Get whole shifts to perform
-   twoBitST->limbOnUCPtr =
-     twoBitST->firstLimbUCPtr + (shiftByUL >> 2);
+   twoBitST->limbOnULPtr =
+     twoBitST->firstLimbULPtr+(shiftByUL >> defTwoBitLimbShift);
 
-   twoBitST->elmOnC = (shiftByUL & 3);
+   twoBitST->elmOnC = (shiftByUL & defTwoBitElmMask);
    return;
 } // twoBitMvXElmFromStart
 
@@ -442,7 +447,7 @@ static inline unsigned long twoBitGetLen(
    '  - Get the length of a two-bit array
    \~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~*/
 
-   return twoBitST->lenAryUL << 2;
+   return twoBitST->lenAryUL << defTwoBitLimbShift;
 } // twoBitGetLen
 
 /*--------------------------------------------------------\
@@ -458,9 +463,172 @@ static inline unsigned long twoBitGetIndex(
    '    on
    \~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~*/
   return (
-     ((twoBitST->limbOnUCPtr-twoBitST->firstLimbUCPtr) <<2)
+       (   (twoBitST->limbOnULPtr - twoBitST->firstLimbULPtr)
+        << defTwoBitLimbShift
+       )
     + twoBitST->elmOnC
   ); // Return the index
 } // twoBitGetIndex
 
+/*--------------------------------------------------------\
+| Output:
+|  - Returns:
+|    - twoBitAry structure with numRowsUL rows of lenRowUL
+|      elements. Each row starts on a new limb, so a row is
+|      lenRowUL rounded up to 32 elements (twoBitST->lenRowUL)
+|    - 0 for memory errors
+| Note:
+|  - Moving up one row is twoBitMvBackXElm(lenRowUL), which
+|    only moves the limb pointer
+\--------------------------------------------------------*/
+static inline struct twoBitAry * makeTwoBitMtrx(
+  unsigned long numRowsUL, // Number of rows in the matrix
+  unsigned long lenRowUL   // Number of elements in a row
+){ /*~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~\
+   ' Fun-18 TOC: Sec-1 Sub-1: makeTwoBitMtrx
+   '  - Make a two bit matrix with rows starting on limbs
+   \~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~*/
+
+   unsigned long limbsPerRowUL =
+      (lenRowUL + defTwoBitElmMask) >> defTwoBitLimbShift;
+
+   struct twoBitAry *twoBitST =
+     malloc(sizeof(struct twoBitAry));
+
+   if(twoBitST == 0) return 0; // Memory error
+
+   /*+ 1 limb so moving one past the last element is safe*/
+   twoBitST->lenAryUL = limbsPerRowUL * numRowsUL + 1;
+   twoBitST->lenRowUL = limbsPerRowUL << defTwoBitLimbShift;
+   twoBitST->elmOnC = 0;
+
+   twoBitST->firstLimbULPtr =
+     calloc(twoBitST->lenAryUL, sizeof(uint64_t));
+
+   if(twoBitST->firstLimbULPtr == 0)
+   { // If I had a memory error
+     free(twoBitST);
+     return 0;
+   } // If I had a memory error
+
+   twoBitST->limbOnULPtr = twoBitST->firstLimbULPtr;
+   return twoBitST;
+} // makeTwoBitMtrx
+
+/*--------------------------------------------------------\
+| Output:
+|  - Modifies:
+|    o Row rowUL of twoBitST to hold the first lenUL
+|      directions in dirStr (only the first two bits of
+|      each byte are used)
+| Note:
+|  - twoBitST must be from makeTwoBitMtrx
+|  - The position in twoBitST is not changed
+|  - Each limb is built in a register and stored once.
+|    The fixed 32 element inner loop has only constant
+|    shifts, so the compiler can vectorize it.
+\--------------------------------------------------------*/
+static inline void twoBitPackRow(
+  struct twoBitAry *twoBitST, // Matrix to add row to
+  unsigned long rowUL,        // Row to overwrite
+  char *dirStr,               // Directions to pack
+  unsigned long lenUL         // Number of directions
+){ /*~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~\
+   ' Fun-19 TOC: Sec-1 Sub-1: twoBitPackRow
+   '  - Packs a row of byte directions into a two bit
+   '    matrix a limb at a time
+   \~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~*/
+
+   uint64_t *limbULPtr =
+        twoBitST->firstLimbULPtr
+      + rowUL * (twoBitST->lenRowUL >> defTwoBitLimbShift);
+
+   uint64_t limbUL = 0;
+   unsigned int elmUI = 0;
+
+   while(lenUL >= defTwoBitLimbElms)
+   { /*Loop: Pack the full limbs*/
+      limbUL = 0;
+
+      for(elmUI = 0; elmUI < defTwoBitLimbElms; ++elmUI)
+         limbUL |=
+              ((uint64_t) (dirStr[elmUI] & 3))
+           << (elmUI << 1);
+
+      *limbULPtr = limbUL;
+      ++limbULPtr;
+      dirStr += defTwoBitLimbElms;
+      lenUL -= defTwoBitLimbElms;
+   } /*Loop: Pack the full limbs*/
+
+   if(lenUL == 0) return;
+
+   limbUL = 0;
+
+   for(elmUI = 0; elmUI < lenUL; ++elmUI)
+      limbUL |= ((uint64_t) (dirStr[elmUI] & 3)) << (elmUI << 1);
+
+   *limbULPtr = limbUL;
+} // twoBitPackRow
+
+/*--------------------------------------------------------\
+| Output:
+|  - Returns:
+|    o Number of elements (from the current element back)
+|      that have the same value as the current element
+|  - Modifies:
+|    o twoBitST to point to the first element before the
+|      run (the first element with a different value)
+| Note:
+|  - The run must end inside the array (an element before
+|    the run has a different value)
+|  - A limb is checked at a time, instead of an element at
+|    a time
+\--------------------------------------------------------*/
+static inline unsigned long twoBitRunBack(
+  struct twoBitAry *twoBitST // Array to find run in
+){ /*~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~\
+   ' Fun-20 TOC: Sec-1 Sub-1: twoBitRunBack
+   '  - Counts the elements in a run of the current value
+   '    (going back) and moves to the end of the run
+   \~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~*/
+
+   uint64_t valUL = defTwoBitOnes * getTwoBitElm(twoBitST);
+   uint64_t diffUL = 0;
+   unsigned long runUL = 0;
+   unsigned int zerosUI = 0;
+
+   /*Shift the current element to the top two bits. Bits
+   ` for elements after the current element are removed.
+   ` Elements that match valUL are 00 after the xor.
+   */
+   diffUL =
+        (*twoBitST->limbOnULPtr ^ valUL)
+     << ((defTwoBitElmMask - twoBitST->elmOnC) << 1);
+
+   while(diffUL == 0)
+   { /*Loop: Till a different element is found*/
+      /*The whole limb (up to the element on) matches*/
+      runUL += twoBitST->elmOnC + 1;
+      --twoBitST->limbOnULPtr;
+      twoBitST->elmOnC = defTwoBitElmMask;
+      diffUL = *twoBitST->limbOnULPtr ^ valUL;
+   } /*Loop: Till a different element is found*/
+
+   /*Count the matching elements at the top of diffUL*/
+   #if defined __GNUC__
+      zerosUI = __builtin_clzll(diffUL) >> 1;
+   #else
+      while(!(diffUL >> 62))
+      { /*Loop: Count matching elements*/
+         diffUL <<= 2;
+         ++zerosUI;
+      } /*Loop: Count matching elements*/
+   #endif
+
+   runUL += zerosUI;
+   twoBitST->elmOnC -= zerosUI;
+   return runUL;
+} // twoBitRunBack
+
 #endif
@@ -7,6 +7,7 @@
 #   - "generalAlnFun.h"
 #   - "alnStruct.h"
 #   - "alnMatrixStruct.h"
+#   - "stripedAln.h"
 #   o "twoBitArrays.h"
 #   o "scoresST.h"
 #   o "seqStruct.h"
@@ -56,7 +57,11 @@ struct alnMatrixStruct * WatermanAln(
       `  seqST->offsetUL (index 0) and the point to end
       `  the alignment seqST->endAlnUL (index 0).
       */
-    struct alnSet *settings /*Settings for the alignment*/
+    struct alnSet *settings, /*Settings for the alignment*/
+    struct stripedProf *profST
+       /*Reference profile to reuse between alignments
+       ` (0 to use a temporary profile)
+       */
 ){ /*~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~\
    ' Fun-01 TOC: WatermanAln
    '  - Run a Waterman Smith alignment on input sequences
@@ -148,11 +153,49 @@ struct alnMatrixStruct * WatermanAln(
    /*The structure to return (has results)*/
    struct alnMatrixStruct *retMtxST = 0;
 
+   /*For finding the aligned region with vectors*/
+   struct scoresStruct vectScoreST;
+   unsigned char errUC = 0;
+
    /*>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>\
    ^ Fun-01 Sec-02:
    ^  - Allocate memory for alignment
    \<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<*/
 
+   /*Find the end of the alignment with the striped
+   ` kernel, so the direction matrix does not cover the
+   ` bases after it. This changes the endAlnUL values in
+   ` qryST and refST (dirMatrixToAlnST uses these).
+   ` A cell only depends on the cells above and to its
+   ` left, so cutting off the end does not change the
+   ` alignment. The start is not cut, because the gap
+   ` penalties depend on the direction of the last cell
+   ` (cutting it can change the path).
+   */
+   initScoresST(&vectScoreST);
+   errUC =
+      stripedWaterScore(
+         qryST,
+         refST,
+         settings,
+         profST,
+         &vectScoreST
+      );
+
+   if(errUC == 64) return 0;
+
+   if(errUC == 0 && vectScoreST.scoreL > 0)
+   { /*If the vector kernel found the alignment end*/
+      refST->endAlnUL = vectScoreST.refEndUL;
+      qryST->endAlnUL = vectScoreST.qryEndUL;
+
+      refEndStr = refST->seqCStr + refST->endAlnUL;
+      qryEndStr = qryST->seqCStr + qryST->endAlnUL;
+
+      lenQryUL = qryST->endAlnUL - qryST->offsetUL + 1;
+      lenRefUL = refST->endAlnUL - refST->offsetUL + 1;
+   } /*If the vector kernel found the alignment end*/
+
    retMtxST = calloc(1, sizeof(struct alnMatrixStruct));
    if(retMtxST == 0) return 0;
    initAlnMatrixST(retMtxST);
@@ -7,6 +7,7 @@
 #   - "generalAlnFun.h"
 #   - "alnStruct.h"
 #   - "alnMatrixStruct.h"
+#   - "stripedAln.h"
 #   o "twoBitArrays.h"
 #   o "scoresST.h"
 #   o "seqStruct.h"
@@ -49,6 +50,7 @@
 #include "generalAlnFun.h"
 #include "alnStruct.h"
 #include "alnMatrixStruct.h"
+#include "stripedAln.h"
 
 /*--------------------------------------------------------\
 | Output:
@@ -64,7 +66,11 @@ struct alnMatrixStruct * WatermanAln(
       `  seqST->offsetUL (index 0) and the point to end
       `  the alignment seqST->endAlnUL (index 0).
       */
-    struct alnSet *settings /*Settings for the alignment*/
+    struct alnSet *settings, /*Settings for the alignment*/
+    struct stripedProf *profST
+       /*Reference profile to reuse between alignments
+       ` (0 to use a temporary profile)
+       */
 ); /*~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~\
    ' Fun-01 TOC: WatermanAln
    '  - Run a Waterman Smith alignment on input sequences
@@ -97,7 +97,6 @@ int main(
     struct readBin *binTree = 0; /*Holds output bins, will be freeded*/
 
     struct samEntry samStruct;
-    struct samEntry oldStruct;
 
     struct minAlnStats minStats;
 
@@ -136,8 +135,6 @@ int main(
             \n         genes.\
             \n       - If this setting is off, then supplemental\
             \n         alignments are just ignored.\
-            \n       - This setting requires running minimap2 with\
-            \n         just one thread for binning.\
             \n Additional Help messages:\
             \n    -h-bin:\
             \n        - Print out the parameters for the binning step.\
@@ -262,7 +259,6 @@ int main(
 
     blankMinStats(&minStats);
     initSamEntry(&samStruct); /*Remove old stats in sam file*/
-    initSamEntry(&oldStruct); /*Remove old stats in sam file*/
 
     /*>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>\
     ^ Main Sec-3: Get user input
@@ -359,14 +355,12 @@ int main(
             rmSupAlnBl,   /*Remove reads with supplementary alignments*/
             trimBl,       /*1: trim reads, 0: do not*/
             &samStruct, /*Holds minimap2 output*/
-            &oldStruct, /*Holds previous line of minimap2 output*/
             &minStats,
             &errUC     /*Reports any errors*/
     ); /*Bin reads using the provided references*/
 
     /*No longer need the samEntry structures*/
     freeStackSamEntry(&samStruct);
-    freeStackSamEntry(&oldStruct);
 
     if(binTree == 0)
     { /*If had an error*/
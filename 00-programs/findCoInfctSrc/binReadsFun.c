@@ -13,8 +13,14 @@
 '     o Bins reads to a consensus to from a cluster.
 '     o This differes from binReads in that it is extracting reads from
 '       the former bin and it does not produce a stats file.
+'   fun-3 samHasSupAln:
+'     o Checks if a sam alignment has an SA tag (static)
 \~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~*/
 
+static char samHasSupAln(
+    struct samEntry *samST /*Sam alignment to check*/
+); /*Checks if a sam alignment has an SA tag*/
+
 /*---------------------------------------------------------------------\
 | Output:
 |   - Modifies:
@@ -37,8 +43,7 @@ struct readBin * binReads(
     char *threadsCStr,       /*Numbe of threads to use with minimap2*/
     char rmSupAlnBl,         /*Remove supplementary alignments*/
     char trimBl,             /*1: trim reads, 0: do not*/
-    struct samEntry *newSam, /*Holds minimap2 output*/
-    struct samEntry *oldSam, /*Holds previous line of minimap2 output*/
+    struct samEntry *samST,  /*Holds minimap2 output*/
     struct minAlnStats *minStats,
     unsigned char *errUC     /*Reports any errors*/
 ) /*Bin reads with a set of references*/
@@ -49,26 +54,22 @@ struct readBin * binReads(
     '   fun-1 sec-1: Variable declerations
     '   fun-1 sec-2: Run minimap2 & read in first line of output
     '   fun-1 sec-3: Check if first line is valid
-    '   fun-1 sec-4: Get past the header & read in/score the first entry
-    '   fun-1 sec-5: Bin reads
-    '   fun-1 sec-6: Print out the last read
+    '   fun-1 sec-4: Bin reads
+    '   fun-1 sec-5: Flush & close the bin files
     \~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~*/
 
     /*>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>\
     ^ Fun-1 Sec-1: Varaible declerations
     \<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<*/
 
-    char minimap2CMDCStr[2048];
     char binFileCStr[256];
     char statFileCStr[256];
     char refIdCStr[256];
     char *tmpCStr = 0;
-    char dupBL = 0;        /*Was the last read a duplicate*/
     uint8_t zeroUChar = 0;    /*For when I need to pass a 0 as a pointer*/
     char funErrUC = 0;     /*Holding err output from called functions*/
     unsigned char printStatsHeadUC = 0;/*tells to print stat file head*/
 
-    struct samEntry *tmpSam = 0;       /*For swaping newSam and oldSam*/
     struct samEntry *samZeroStruct = 0; /*Points were avoiding ref*/
 
     struct readBin *tmpBin = 0;
@@ -76,33 +77,31 @@ struct readBin * binReads(
 
     struct readBinStack binStack[200]; /*Stack for read bin AVL tree*/
 
-    FILE *stdinFILE = 0;
-    FILE *fqBinFILE = 0;
-    FILE *statFILE = 0;
+    /*Keeps the bin fastq and stats files open between reads*/
+    struct binWriterList writeList;
+
+    struct samMapper mapST; /*Maps the reads (minimap2)*/
 
     /*>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>\
     ^ Fun-1 Sec-2: Run minimap2 & read in first line of output
     \<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<*/
 
-    /*Running minimap2 with on thread so that I can detect duplicate
-      entries. Otherwise minimap2 will have no order for ouput
-      mappings*/
-    tmpCStr = cStrCpInvsDelm(minimap2CMDCStr, minimap2CMD);
-
-    /*I can only use one thread when remove all reads with supplemental
-      alignments, but can use multiple when ignoring supplemental
-      alignments*/
-    if(rmSupAlnBl & 1)
-        tmpCStr = cpParmAndArg(tmpCStr, "-t", "1");
-    else
-        tmpCStr = cpParmAndArg(tmpCStr, "-t", threadsCStr);
+    /*Reads with supplemental alignments are found by the SA tag on the
+      primary alignment, not by the order of minimap2s output. So
+      minimap2 can use every thread, even when removing reads with
+      supplemental alignments*/
+    funErrUC = openSamMapper(refsPathCStr, fqPathCStr, threadsCStr, &mapST);
 
-    tmpCStr = cpParmAndArg(tmpCStr, refsPathCStr, fqPathCStr);
+    if(!(funErrUC & 1))
+    { /*If could not start minimap2*/
+        *errUC = funErrUC;
+        return 0;
+    } /*If could not start minimap2*/
 
-    stdinFILE = popen(minimap2CMDCStr, "r"); /*run minimap2*/
+    initBinWriterList(&writeList, defMaxOpenBins);
 
-    blankSamEntry(oldSam); /*Remove old stats in sam file*/
-    funErrUC = readSamLine(oldSam, stdinFILE);
+    blankSamEntry(samST); /*Remove old stats in sam file*/
+    funErrUC = readSamMapper(samST, &mapST);
         /*get the first line from minimap2*/
 
     /*>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>\
@@ -111,7 +110,7 @@ struct readBin * binReads(
 
     if(!(funErrUC & 1))
     { /*If an error occured*/
-        pclose(stdinFILE);    /*No longer need open (due to error*/
+        closeSamMapper(&mapST);    /*No longer need open (due to error*/
 
         if(!(funErrUC & 64))
         { /*If errored out*/
@@ -126,181 +125,84 @@ struct readBin * binReads(
         } /*If had memory allocation error*/
     } /*If an error occured*/
 
-    if(*(oldSam->samEntryCStr) != '@')
+    if(*(samST->samEntryCStr) != '@')
     { /*If their is no header line, minimap2 likely errored out*/
-        pclose(stdinFILE);
+        closeSamMapper(&mapST);
         *errUC = 2;
         return 0;
     } /*If minimap2 did not produce a header, it likely error out*/
 
     /*>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>\
-    ^ Fun-1 Sec-4: Get past the header & read in/score the first entry
-    \<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<*/
-
-    while(funErrUC & 1)
-    { /*While not past the first header*/
-        if(*oldSam->samEntryCStr == '@')
-        { /*If was a header*/
-            blankSamEntry(oldSam); /*Remove old stats in sam file*/
-            funErrUC = readSamLine(oldSam, stdinFILE); /*read new line*/
-            continue; /*Is a header line, move to next line in file*/
-        } /*If was a header*/
-
-        if(trimBl & 1)
-            funErrUC = trimSamEntry(oldSam); /*Trim the read*/
-        else if(oldSam->flagUSht & (2048 | 256 | 4))
-            funErrUC = 1 << 2; /*Let next step know to ignore*/
-
-        if(funErrUC >> 2)
-        { /*If entry did not have a sequence, discard*/
-            /*make the new alignment (not dupicate) the old alignment*/
-            tmpSam = oldSam;
-            oldSam = oldSam;
-            oldSam = tmpSam;
-
-            /*Read the next sam entry*/
-            blankSamEntry(oldSam); /*Remove old stats in sam file*/
-            funErrUC = readSamLine(oldSam, stdinFILE);
-            continue;
-        } /*If entry did not have a sequence, discard*/
-
-        else
-            funErrUC = 1; /*So next loop fires*/
-
-        findQScores(oldSam); /*Find the Q-scores*/
-
-        scoreAln(
-            minStats,      /*thesholds for read to reference map*/
-            oldSam,
-            samZeroStruct, /*Not using reference for scoring*/ 
-            &zeroUChar,    /*Not using reference, so no Q-score*/
-            &zeroUChar     /*Not using reference, so no deletions*/
-        );
-
-        if(rmSupAlnBl & 1)
-        { /*If removing all reads with supplemental alignments*/
-            blankSamEntry(newSam); /*Remove old stats in sam file*/
-            funErrUC = readSamLine(newSam, stdinFILE);
-        } /*If removing all reads with supplemental alignments*/
-
-        else 
-        { /*Else ignoring supplemental alignments*/
-            newSam = oldSam;
-            blankReadStats(newSam); /*Remove old stats in sam file*/
-        } /*Else ignoring supplemental alignments*/
-
-        break; /*Found the start of the second entry*/
-    } /*While not past the first header*/
-
-    /*>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>\
-    ^ Fun-1 Sec-5: Bin reads
-    ^   fun-1 sec-5 sub-1: Detect if supplmental & check if removing
-    ^      reads with supplemental alignments
-    ^   fun-1 sec-5 sub-2: Trim and score sam file alignment
-    ^   fun-1 sec-5 sub-3: Set up bin file names
-    ^   fun-1 sec-5 sub-4: Check if can open the bin & stats file
-    ^   fun-1 sec-5 sub-5: Append reads to file & add to tree
-    ^   fun-1 sec-5 sub-6: Print out the stats and fastq entry
+    ^ Fun-1 Sec-4: Bin reads
+    ^   fun-1 sec-4 sub-1: Skip headers, supplemental alignments, &
+    ^      reads with supplemental alignments (if removing)
+    ^   fun-1 sec-4 sub-2: Trim and score sam file alignment
+    ^   fun-1 sec-4 sub-3: Set up bin file names
+    ^   fun-1 sec-4 sub-4: Add read to tree & get the bins open files
+    ^   fun-1 sec-4 sub-5: Print out the stats and fastq entry
     \<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<*/
 
     /******************************************************************\
-    * Fun-1 Sec-5 Sub-1: Detect if supplmental & if removing all reads
-    *    with supplementals, remove
+    * Fun-1 Sec-4 Sub-1: Skip headers, supplemental alignments, & reads
+    *    with supplemental alignments (if removing)
     \******************************************************************/
 
     while(funErrUC & 1)
     { /*While their is a samfile entry to read in*/
-        dupBL = 0; /*So that I know I can print out the last read*/
-
-        if(*newSam->samEntryCStr == '@')
+        if(*samST->samEntryCStr == '@')
         { /*If was a header*/
-            blankSamEntry(newSam); /*Remove old stats in sam file*/
-            funErrUC = readSamLine(newSam, stdinFILE);
+            blankSamEntry(samST); /*Remove old stats in sam file*/
+            funErrUC = readSamMapper(samST, &mapST);
             continue; /*Is a header line, move to next line in file*/
         } /*If was a header*/
 
-        if(newSam->flagUSht & (2048 | 256 | 4))
-        { /*If is supplemental (2048), secondary (256), or no map (4)*/
-            blankSamEntry(newSam); /*Remove old stats in sam file*/
-            funErrUC = readSamLine(newSam, stdinFILE);
-
-            if((rmSupAlnBl & newSam->flagUSht) & 2048)
-            { /*If is a supplemental alignment & remove supplementals*/
-                dupBL = 1; /*Mark that a duplicate was detected*/
-
-                while(newSam->flagUSht & (2048 | 256 | 4))
-                { /*While the entries are duplicates*/
-                    /*Remove previous reads stats & get next alignment*/
-                    blankSamEntry(newSam);
-                    funErrUC = readSamLine(newSam, stdinFILE);
-
-                    if(!(funErrUC & 1))
-                        break;      /*end of file or other error*/
-                } /*While the entries are duplicates*/
-
-                blankSamEntry(oldSam);
-
-                if(funErrUC & 1)
-                { /*If need to grab the next line still*/
-                    funErrUC = readSamLine(oldSam, stdinFILE);
-                    dupBL = 0;
-                } /*If need to grab the next line still*/
-
-                tmpSam = newSam;
-                newSam = oldSam;
-                oldSam = tmpSam;
-            } /*If is a supplemental alignment & remove supplementals*/
-
-            continue; /*Move check the next alignment*/
-        } /*If is supplemental (2048), secondary (256), or no map (4)*/
+        if(
+              samST->flagUSht & (2048 | 256 | 4)
+           || ((rmSupAlnBl & 1) && samHasSupAln(samST))
+        ){ /*If supplemental, secondary, no map, or a chimera*/
+            /*The primary alignment of a read with a supplemental
+              alignment has an SA tag, so the whole read is discarded
+              when its primary alignment is found. The supplemental
+              alignments are always ignored.*/
+            blankSamEntry(samST); /*Remove old stats in sam file*/
+            funErrUC = readSamMapper(samST, &mapST);
+            continue;
+        } /*If supplemental, secondary, no map, or a chimera*/
     
         /**************************************************************\
-        * Fun-1 Sec-5 Sub-2: Trim and score sam file alignment
+        * Fun-1 Sec-4 Sub-2: Trim and score sam file alignment
         \**************************************************************/
 
         /*Convert & print out sam file entry*/
         if(trimBl & 1)
-            funErrUC = trimSamEntry(newSam); /*If trimming reads*/
+            funErrUC = trimSamEntry(samST); /*If trimming reads*/
 
-        findQScores(newSam); /*Find the Q-scores*/
+        findQScores(samST); /*Find the Q-scores*/
 
         scoreAln(
             minStats, /*thesholds for read to reference map*/
-            newSam,
+            samST,
             samZeroStruct, /*Not using reference for scoring*/ 
             &zeroUChar,    /*Not using reference, so no Q-score*/
             &zeroUChar     /*Not using reference, so no deletions*/
         );
 
-        if(rmSupAlnBl & 1)
-            tmpSam = oldSam;
-        else
-            tmpSam = newSam;
-
         if(
-          checkRead(minStats, tmpSam) == 0 ||
-          !(checkIfKeepRead(minStats, tmpSam) & 1)
+          checkRead(minStats, samST) == 0 ||
+          !(checkIfKeepRead(minStats, samST) & 1)
         ) { /*If the read is under the min quality, discard*/
-            if(rmSupAlnBl & 1)
-            { /*If doing a chimera removal*/
-                /*make the new alignment (not dupicate) old alignment*/
-                tmpSam = newSam;
-                newSam = oldSam;
-                oldSam = tmpSam;
-            } /*If doing a chimera removal*/
-
             /*Remove old stats, not keeping and get next alinment*/
-            blankSamEntry(newSam);
-            funErrUC = readSamLine(newSam, stdinFILE);
+            blankSamEntry(samST);
+            funErrUC = readSamMapper(samST, &mapST);
             continue;
         } /*If the read is under the min quality, discard*/
 
         /**************************************************************\
-        * Fun-1 Sec-5 Sub-3: Set up bin file names
+        * Fun-1 Sec-4 Sub-3: Set up bin file names
         \**************************************************************/
 
         /*Grab the reference id*/
-        cStrCpInvsDelm(refIdCStr, tmpSam->refCStr);
+        cStrCpInvsDelm(refIdCStr, samST->refCStr);
 
         /*Build the bin file name*/
         tmpCStr = cStrCpInvsDelm(binFileCStr, prefixCStr);
@@ -314,32 +216,7 @@ struct readBin * binReads(
         cStrCpInvsDelm(tmpCStr, "--stats.tsv");/*Add stats file ending*/
 
         /**************************************************************\
-        * Fun-1 Sec-5 Sub-4: Check if can open the bin & stats file
-        \**************************************************************/
-
-        statFILE = fopen(statFileCStr, "a");
-
-        if(statFILE == 0)
-        { /*If can not open the stats file*/
-            freeBinTree(&binTree);
-            pclose(stdinFILE);
-            *errUC = 4;
-            return 0;
-        } /*If can not open the stats file*/
-
-        fqBinFILE = fopen(binFileCStr, "a");
-
-        if(fqBinFILE == 0)
-        { /*If can not open the fastq binning file*/
-            freeBinTree(&binTree);
-            pclose(stdinFILE);
-            fclose(statFILE);
-            *errUC = 8;
-            return 0;
-        } /*If can not open the stats file*/
-
-        /**************************************************************\
-        * Fun-1 Sec-5 Sub-5: Append reads to file & add to tree
+        * Fun-1 Sec-4 Sub-4: Add read to tree & get the bins open files
         \**************************************************************/
 
         tmpBin =
@@ -353,16 +230,27 @@ struct readBin * binReads(
 
         if(tmpBin == 0)
         { /*If a memory error occured*/
+            closeAllBinWriters(&writeList);
             freeBinTree(&binTree);
-            fclose(statFILE);
-            fclose(fqBinFILE);
-            pclose(stdinFILE);
+            closeSamMapper(&mapST);
             *errUC = 64;
             return 0;
         } /*If a memory error occured*/
 
+        /*Opens the bins files only if they are not already open*/
+        funErrUC = getBinWriter(&writeList, tmpBin);
+
+        if(!(funErrUC & 1))
+        { /*If could not open the bin or stats file*/
+            closeAllBinWriters(&writeList);
+            freeBinTree(&binTree);
+            closeSamMapper(&mapST);
+            *errUC = funErrUC;
+            return 0;
+        } /*If could not open the bin or stats file*/
+
         /**************************************************************\
-        * Fun-1 Sec-5 Sub-6: Print out the stats and fastq entry
+        * Fun-1 Sec-4 Sub-5: Print out the stats and fastq entry
         \**************************************************************/
 
         if(tmpBin->numReadsULng == 1) /*This is a new bin*/
@@ -370,134 +258,29 @@ struct readBin * binReads(
         else
             printStatsHeadUC = 0; /*Else do not print the header*/
 
-        /*Print out the old sam entry (is not a duplicate)*/
         /*Add sequence and stats to their files*/
-        samToFq(tmpSam, fqBinFILE); /*Print sequence to fastq file*/
+        samToFq(samST, tmpBin->writeST->fqFILE);
 
         /*Print the stats to its bin file*/
-        printSamStats(tmpSam, &printStatsHeadUC, statFILE);
-
-        fclose(fqBinFILE);
-        fclose(statFILE);
-
-        fqBinFILE = 0;  /*So program knows that no file is open*/
-        statFILE = 0;   /*So program knows that no file is open*/
+        printSamStats(samST, &printStatsHeadUC, tmpBin->writeST->statFILE);
             
-        blankSamEntry(tmpSam); /*Remove old stats in sam file*/
- 
-        if(rmSupAlnBl & 1)
-        { /*If doing a chimera removal*/
-            /*Swap pointers around (the new alignent becomes the old)*/
-            tmpSam = newSam;
-            newSam = oldSam;
-            oldSam = tmpSam;
-        } /*If doing a chimera removal*/
-
         /*Read in the next line*/
-        funErrUC = readSamLine(newSam, stdinFILE);
+        blankSamEntry(samST); /*Remove old stats in sam file*/
+        funErrUC = readSamMapper(samST, &mapST);
     } /*While their is a samfile entry to read in*/
 
-    pclose(stdinFILE);
+    closeSamMapper(&mapST);
 
     /*>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>\
-    ^ Fun-1 Sec-6: Print out the last read
-    ^   fun-1 sec-6 sub-1: Check if should keep last read
-    ^   fun-1 sec-6 sub-2: Prepare the fastq & stats file names
-    ^   fun-1 sec-6 sub-3: Check if can open fastq & stats file
-    ^   fun-1 sec-6 sub-4: Add read to the tree of bins
-    ^   fun-1 sec-6 sub-5: Print out the read & its stats to the bin
+    ^ Fun-1 Sec-5: Flush & close the bin files
     \<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<*/
 
-    /******************************************************************\
-    * Fun-1 Sec-6 Sub-1: Check if should keep last read
-    \******************************************************************/
-
-    if(rmSupAlnBl & 1 && dupBL == 0)
-    { /*If I have a final read to print out*/
-        if(checkRead(minStats, oldSam) == 0 ||
-          !(checkIfKeepRead(minStats, oldSam) & 1)
-        ) return binTree; /*If is a low quality read*/
-
-        /**************************************************************\
-        * Fun-1 Sec-6 Sub-2: Prepare the fastq & stats file names
-        \**************************************************************/
-
-        /*Grab the reference id*/
-        cStrCpInvsDelm(refIdCStr, oldSam->refCStr);
-
-        /*Build the bin file name*/
-        tmpCStr = cStrCpInvsDelm(binFileCStr, prefixCStr);
-        tmpCStr = cStrCpInvsDelm(tmpCStr, "--");
-        tmpCStr = cStrCpInvsDelm(tmpCStr, refIdCStr);
-        cStrCpInvsDelm(tmpCStr, ".fastq"); /*Add in fastq ending*/
-
-        tmpCStr = cStrCpInvsDelm(statFileCStr, prefixCStr);
-        tmpCStr = cStrCpInvsDelm(tmpCStr, "--");
-        tmpCStr = cStrCpInvsDelm(tmpCStr, refIdCStr);
-        cStrCpInvsDelm(tmpCStr, "--stats.tsv");/*Add stats file ending*/
-
-        /**************************************************************\
-        * Fun-1 Sec-6 Sub-3: Check if can open fastq & stats file
-        \**************************************************************/
-
-        statFILE = fopen(statFileCStr, "a");
-
-        if(statFILE == 0)
-        { /*If can not open the stats file*/
-            freeBinTree(&binTree);
-            pclose(stdinFILE);
-            *errUC = 4;
-            return 0;
-        } /*If can not open the stats file*/
-
-        fqBinFILE = fopen(binFileCStr, "a");
-
-        if(fqBinFILE == 0)
-        { /*If can not open the fastq binning file*/
-            freeBinTree(&binTree);
-            pclose(stdinFILE);
-            fclose(statFILE);
-            *errUC = 8;
-            return 0;
-        } /*If can not open the stats file*/
-
-        /**************************************************************\
-        * Fun-1 Sec-6 Sub-4: Add read to the tree of bins
-        \**************************************************************/
-
-        tmpBin =
-            insBinIntoTree(
-                refIdCStr,
-                prefixCStr,       /*Fastq file for the bin*/
-                statFileCStr,      /*Stats file for the bin*/
-                &binTree, /*Root of bin tree*/
-                binStack  /*Stack to use in rebalencing tree*/
-        ); /*Find or add bin to tree*/
-
-        if(tmpBin == 0)
-        { /*If a memory error occured*/
-            freeBinTree(&binTree);
-            fclose(statFILE);
-            fclose(fqBinFILE);
-            pclose(stdinFILE);
-            *errUC = 64;
-            return 0;
-        } /*If a memory error occured*/
-
-        /**************************************************************\
-        * Fun-1 Sec-6 Sub-5: Print out the read & its stats to the bin
-        \**************************************************************/
-
-        /*Print out the old sam entry (is not a duplicate)*/
-        /*Add sequence and stats to their files*/
-        samToFq(oldSam, fqBinFILE); /*Print sequence to fastq file*/
-
-        /*Print the stats to its bin file*/
-        printSamStats(oldSam, &printStatsHeadUC, statFILE);
-
-        fclose(fqBinFILE);
-        fclose(statFILE);
-    } /*If I have a final read to print out*/
+    if(!(closeAllBinWriters(&writeList) & 1))
+    { /*If could not write out a bin (full disk?)*/
+        freeBinTree(&binTree);
+        *errUC = 2;
+        return 0;
+    } /*If could not write out a bin (full disk?)*/
 
     return binTree;
 } /*binReads*/
@@ -538,17 +321,16 @@ uint8_t binReadToCon(
     uint8_t zeroUChar = 0;
     uint8_t headBool = 0; /*Tells if frist round in stats file*/
 
-    char minimap2CmdCStr[2048];  /*Holds minimap2 command to run*/
     char *tmpCStr = 0;
-    char *tmpStatsCStr = "2023-01-17-1239-stats-tmp-01928327456123.tsv";
-    char *tmpFqCStr = "2023-01-17-1239-fastq-tmp-019283274561234.fastq";
+    char tmpStatsCStr[300]; /*Temporary stats file (named after bin)*/
+    char tmpFqCStr[300];    /*Temporary fastq file (named after bin)*/
 
     struct samEntry *zeroSam = 0; /*Just to tell no reference struct*/
 
     FILE *tmpStatsFILE = 0; /*Stats keeping*/
     FILE *clustFILE = 0;/*Holds reads that mapped to the consensuses*/
     FILE *otherBinFILE = 0;/*Holds reads that did not map*/
-    FILE *stdinFILE = 0;   /*Holds minimap2 output*/
+    struct samMapper mapST;/*Maps reads to the consensus (minimap2)*/
 
     /*>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>\
     ^ Fun-2 Sec-2: Set defaults & run minimap2
@@ -557,25 +339,26 @@ uint8_t binReadToCon(
     binTree->numReadsULng = 0;  /*Reseting size after binning*/
     binClust->numReadsULng = 0; /*For counting number reads in bin*/
 
-    tmpCStr = cStrCpInvsDelm(minimap2CmdCStr, minimap2CMD);
-    tmpCStr = cpParmAndArg(tmpCStr, "-t", threadsCStr);
-    cpParmAndArg(
-        tmpCStr,
-        binClust->consensusCStr,
-        binTree->fqPathCStr
-    ); /*Add the file names to the minimap2 command*/
+    errUChar =
+        openSamMapper(
+            binClust->consensusCStr,
+            binTree->fqPathCStr,
+            threadsCStr,
+            &mapST
+    ); /*Start mapping the reads to the consensus*/
 
-    stdinFILE = popen(minimap2CmdCStr, "r");
+    if(!(errUChar & 1))
+        return errUChar; /*Minimap2 failed (2) or memory error (64)*/
 
     /*Remove the old stats data in the structures*/
     blankSamEntry(samStruct);
 
     /*Read First line so can check if errored out*/
-    errUChar = readSamLine(samStruct, stdinFILE);
+    errUChar = readSamMapper(samStruct, &mapST);
 
     if(*samStruct->samEntryCStr != '@')
     { /*If their is no header*/
-        pclose(stdinFILE);
+        closeSamMapper(&mapST);
         return 2; /*Minimap2 failed*/        
     } /*If their is no header*/
 
@@ -590,6 +373,24 @@ uint8_t binReadToCon(
     * Fun-2 Sec-3 Sub-1: open the temporary files & bin stat file
     \******************************************************************/
 
+    /*The temporary files are named after the bin, so bins can be
+      clustered at the same time (findCoInftClust.c)*/
+    tmpCStr = cStrCpInvsDelm(tmpFqCStr, binTree->fqPathCStr);
+
+    /*Get to end of .fastq or .fq*/
+    if(*(tmpCStr - 2) == 't') tmpCStr -= 6; /*.fastq*/
+    else tmpCStr -= 3;                      /*.fq*/
+
+    cStrCpInvsDelm(tmpCStr, "--tmp.fastq");
+
+    tmpCStr = cStrCpInvsDelm(tmpStatsCStr, binTree->fqPathCStr);
+
+    /*Get to end of .fastq or .fq*/
+    if(*(tmpCStr - 2) == 't') tmpCStr -= 6; /*.fastq*/
+    else tmpCStr -= 3;                      /*.fq*/
+
+    cStrCpInvsDelm(tmpCStr, "--tmp-stats.tsv");
+
     tmpStatsFILE = fopen(tmpStatsCStr, "w"); /*Open the temp file*/
     otherBinFILE = fopen(tmpFqCStr, "w"); /*file for discarded reads*/
 
@@ -627,7 +428,7 @@ uint8_t binReadToCon(
         { /*If was a header*/
             /*Read in next entry*/
             blankSamEntry(samStruct);
-            errUChar = readSamLine(samStruct, stdinFILE);
+            errUChar = readSamMapper(samStruct, &mapST);
             continue; /*Is a header line, move to next line in file*/
         } /*If was a header*/
 
@@ -635,7 +436,7 @@ uint8_t binReadToCon(
         { /*If was a secondary or supplementary alignement, ignore*/
             /*Read in next entry*/
             blankSamEntry(samStruct);
-            errUChar = readSamLine(samStruct, stdinFILE);
+            errUChar = readSamMapper(samStruct, &mapST);
             continue; /*Is a header line, move to next line in file*/
         } /*If was a secondary or supplementary alignement, ignore*/
 
@@ -649,7 +450,7 @@ uint8_t binReadToCon(
 
             /*Read in next entry*/
             blankSamEntry(samStruct);
-            errUChar = readSamLine(samStruct, stdinFILE);
+            errUChar = readSamMapper(samStruct, &mapST);
             continue; /*Is a header line, move to next line in file*/
         } /*Make sure the read mapped to something*/
 
@@ -698,14 +499,14 @@ uint8_t binReadToCon(
 
         /*Read in the next line*/
         blankSamEntry(samStruct);
-        errUChar = readSamLine(samStruct, stdinFILE);
+        errUChar = readSamMapper(samStruct, &mapST);
     } /*While their is a samfile entry to read in*/
 
     /*>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>\
     ^ Fun-2 Sec-5: Clean up and rename files
     \<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<*/
 
-    pclose(stdinFILE);
+    closeSamMapper(&mapST);
     fclose(clustFILE);
     fclose(otherBinFILE);
     fclose(tmpStatsFILE);
@@ -720,3 +521,25 @@ uint8_t binReadToCon(
 
     return 1; /*No errors*/
 } /*binReadToCon*/
+
+/*---------------------------------------------------------------------\
+| Output:
+|   - Returns:
+|     o 1 if the alignment in samST has an SA tag (the read has a
+|       supplemental alignment)
+|     o 0 if the alignment does not have an SA tag
+\---------------------------------------------------------------------*/
+static char samHasSupAln(
+    struct samEntry *samST /*Sam alignment to check*/
+) /*Checks if a sam alignment has an SA tag*/
+{ /*samHasSupAln*/
+
+    /*~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~\
+    ' Fun-3 TOC: Sec-1 Sub-1: samHasSupAln
+    \~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~*/
+
+    /*The sequence and q-score entries have no tabs, so starting at the
+      cigar will only find the SA tag*/
+    if(samST->cigarCStr == 0) return 0;
+    return strstr(samST->cigarCStr, "\tSA:Z:") != 0;
+} /*samHasSupAln*/
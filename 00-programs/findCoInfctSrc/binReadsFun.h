@@ -5,6 +5,8 @@
 #   - "cStrFun.h"
 #   - "trimSam.h"
 #   - "findCoInftBinTree.h"
+#   - "findCoInftBinWrite.h"
+#   - "findCoInftSamMap.h"
 #   - "findCoInftChecks.h"
 #   o "samEntryStruct.h"
 #   o "defaultSettings.h"
@@ -25,6 +27,8 @@
 #include "findCoInftChecks.h" /*Checking functions for alignments*/
 #include "cStrFun.h"          /*C-string manipuplation*/
 #include "findCoInftBinTree.h"/*To build the readBin tree*/
+#include "findCoInftBinWrite.h"/*Open bin files while binning*/
+#include "findCoInftSamMap.h" /*Maps reads with minimap2*/
 
 /*---------------------------------------------------------------------\
 | Output:
@@ -48,8 +52,7 @@ struct readBin * binReads(
     char *threadsCStr,       /*Numbe of threads to use with minimap2*/
     char rmSupAlnBl,         /*Remove supplementary alignments*/
     char trimBl,             /*1: trim reads, 0: do not*/
-    struct samEntry *newSam, /*Holds minimap2 output*/
-    struct samEntry *oldSam, /*Holds previous line of minimap2 output*/
+    struct samEntry *samST,  /*Holds minimap2 output*/
     struct minAlnStats *minStats,
     unsigned char *errUC     /*Reports any errors*/
 ); /*Bin reads with a set of references*/
@@ -164,6 +164,11 @@ int main(
             \n    -min-length: [500]\
             \n      - Discard consensuses or read mappings\
             \n        that are under the input length.\
+            \n    -fq-index: [No]\
+            \n      - Keep a sorted read id index of the\
+            \n        fastq (prefix.fastq.idx), so each\
+            \n        round can pull reads out of the\
+            \n        fastq without rescanning it.\
             \n Additional Help messages:\
             \n    -h-build-consensus:\
             \n      - Help message for consensus building\
@@ -452,6 +457,8 @@ int main(
     fastqStruct.topReadsCStr[0] = '\0';
     fastqStruct.consensusCStr[0] = '\0';
     fastqStruct.numReadsULng = 0;
+    fastqStruct.fqIdxBl = 0;
+    fastqStruct.writeST = 0;
 
     /*>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>
     # Main Sec-3: Get user input
@@ -830,6 +837,10 @@ int main(
     /*remove(fastqStruct.bestReadCStr); *//*Make sure no extra files*/
         /*buildCon function already did this*/
     remove(fastqStruct.fqPathCStr);
+
+    /*Remove the read id index of the fastq (-fq-index)*/
+    sprintf(tmpCmdCStr, "%s%s", fastqStruct.fqPathCStr, defFqIdxExt);
+    remove(tmpCmdCStr);
     remove(fastqStruct.bestReadCStr);
 
     if(statsPathCStr != 0)
@@ -980,6 +991,12 @@ char * getUserInput(
         else if(strcmp(parmStr, "-min-con-length") == 0)
             conSet->minConLenUI = strtoul(argStr, &tmpStr, 10);
 
+        else if(strcmp(parmStr, "-fq-index") == 0)
+        { /*Else if: using a read id index for the fastq*/
+            conSet->fqIdxBl = 1;
+            --intArg; /*Account for this being a true or false*/
+        } /*Else if: using a read id index for the fastq*/
+
         /*************************************************\
         * Fun-1 Sec-2 Sub-2:
         *  - Selecting the consensus methods
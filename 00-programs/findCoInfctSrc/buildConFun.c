@@ -23,12 +23,6 @@
 '    - Polish a consensus with medaka using the best reads
 '  o fun-7 cmpCons:
 '    - Compares two consensus(recursive call if tree input)
-'  o fun-9 freeBaseStruct:
-'    - Frees a base struct from a linked list.
-'    - The freeded base is set to the alternate base if
-'      their is an alternate base
-'    - The freed base is set to 0 if no alternative base is
-'      present.
 '  o fun-9 initMajConStruct:
 '    - Set default settings for struct holding majority
 '      consensus settings
@@ -43,6 +37,13 @@
 '      building settings.
 '  o fun-13 ivarCon:
 '    - Builds a consensus using ivar
+'  o fun-14 initBasePile:
+'    - Sets up a pileup (for simpleMajCon) with a reference
+'  o fun-15 getInsCol:
+'    - Gets (or makes) the next insertion column at a
+'      position in a pileup
+'  o fun-16 freeBasePile:
+'    - Frees the arrays in a pileup
 '  o macro-01 initIvarSet:
 '    - Initializes the settings for an ivarSet structuer
 '    - in buildConFun.h only
@@ -50,6 +51,12 @@
 
 #include "buildConFun.h"
 
+/*Pileup index (see pileBaseCStr) of each base. Anything that is not
+  an A, C, G, T, or U is counted as an N*/
+static const unsigned char pileBaseIdxAryUC[256] =
+    {['A'] = 1, ['C'] = 2, ['G'] = 3, ['T'] = 4, ['U'] = 4,
+     ['a'] = 1, ['c'] = 2, ['g'] = 3, ['t'] = 4, ['u'] = 4};
+
 /*---------------------------------------------------------------------\
 | Output:
 |   - Returns:
@@ -159,6 +166,7 @@ unsigned char buildCon(
         return 2;
 
     totalReadsUL = conData->numReadsULng;
+    conData->fqIdxBl = conSet->fqIdxBl;
 
     /*>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>\
     ^ Fun-1 Sec-5: Polish the read or reference
@@ -556,8 +564,9 @@ unsigned char simpleMajCon(
     '    fun-4 sec-2: Check if the bestRead and topReads files exist
     '        - Also reads in the reference sequence
     '    fun-4 sec-3: Prepare the minimap2 command
-    '    fun-4 sec-4: Make consensus array & initalize with reference
+    '    fun-4 sec-4: Make the pileup & initalize with reference
     '    fun-4 sec-5: Map reads to the reference read
+    '    fun-4 sec-6: Merge bases into a single majority consensus
     '    fun-4 sec-7: Print out cosensus & do clean up
     \~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~*/
 
@@ -566,29 +575,33 @@ unsigned char simpleMajCon(
     \<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<*/
 
     char qEntryBl = 0;           /*Marks if reference has Q-core entry*/
-    char minimap2CmdCStr[2048];  /*Holds minimap2 command to run*/
     char *tmpCStr = 0;           /*Temp ptr for c-string manipulations*/
     char *cigCStr = 0;           /*Reading the cigar entry*/
     char *seqCStr = 0;           /*Manipulating/reading the sequence*/
     char *qCStr = 0;             /*Manipulating/reading q-score entry*/
 
-    unsigned char qScoreUChar = 0; /*Holds the Q-score for a base*/
+    unsigned char baseUC = 0;    /*Pileup index of a base*/
+    unsigned char keepUC = 0;    /*1: base is of high enough quality*/
+    unsigned char refUC = 0;     /*1: base is the reference base*/
     uint8_t errUChar = 0;        /*Holds error messages from functions*/
 
     uint32_t cigEntryUInt = 0;  /*Holds number of bases in cigar entry*/
+    uint32_t posUI = 0;         /*Position on the reference*/
+    uint32_t colUI = 0;         /*Insertion column (index + 1)*/
+    uint32_t uiBase = 0;        /*Base on in a cigar entry*/
+    uint32_t *cntAryUI = 0;     /*Counts working on in the pileup*/
 
     unsigned long minNumBasesUL = 0; /*Min read support to keep a base*/
     unsigned long minInsUL = 0;   /*Min read support to keep insertion*/
     unsigned long numSupReadsUL = 0; /*NumberOfReads supporting a base*/
+    unsigned long bestSupUL = 0;     /*Support for the majority base*/
     unsigned long numSeqUL = 0;      /*Number of mapped sequences*/
     unsigned long numMisSeqUL = 0;   /*Number of mapped sequences*/
 
-    struct baseStruct *headBase = 0; /*Head of the list of bases*/
-    struct baseStruct *incBase = 0;  /*First base at a position*/
-    struct baseStruct *lastBase = 0; /*Base before tmpBase*/
-    struct baseStruct *tmpBase = 0;  /*Base position working on*/
+    struct basePile pileST;     /*Pileup of the mapped reads*/
 
     FILE *stdinFILE = 0;        /*For reading and writing files*/
+    struct samMapper mapST;     /*Maps reads to the best read*/
 
     /*>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>\
     ^ Fun-4 Sec-2: Check if the bestRead and topReads files exist
@@ -624,41 +637,13 @@ unsigned char simpleMajCon(
         qEntryBl = 0;
     } /*Else reference is the consensus*/
 
+    fclose(stdinFILE);
+
     if(errUChar & 64)
-    { /*if had a memory allocation error*/
-        fclose(stdinFILE);
         return 64; /*Memory allocation error*/
-    } /*if had a memory allocation error*/
 
     if(!(errUChar & 1))
-    { /*If had an issue with the consensus*/
-        fclose(stdinFILE);
         return 2; /*issue with consensus*/
-    } /*If had an issue with the consensus*/
-
-    /*Make sure have doube the sequence + q-score size for insertions*/
-    if(samStruct->readLenUInt * 2 > samStruct->lenBuffULng)
-    { /*If need to increase the size of the buffer*/
-        samStruct->samEntryCStr =
-            realloc(
-                samStruct->samEntryCStr,
-                sizeof(char) * samStruct->readLenUInt * 2
-        ); /*Resize the structs buffer*/
-
-        if(samStruct->samEntryCStr == 0)
-        { /*If had a memory allocation wrror*/
-            fclose(stdinFILE);
-            return 64;
-        } /*If had a memory allocation wrror*/
-    } /*If need to increase the size of the buffer*/
-
-    /*Make the consensus array*/
-    fclose(stdinFILE);
-
-    if(errUChar & 64)
-        return 64;
-    if(!(errUChar & 1))
-        return 4; /*Invalide reference*/
 
     /*Check if can open the top reads file*/
     stdinFILE = fopen(binStruct->topReadsCStr, "r");
@@ -682,100 +667,59 @@ unsigned char simpleMajCon(
     tmpCStr = uCharToCStr(tmpCStr, *clustUC); /*Add cluster number*/
     tmpCStr=cStrCpInvsDelm(tmpCStr, "--con.fasta");
 
-    /*Prepare the minimap2 command*/
-    tmpCStr = cStrCpInvsDelm(minimap2CmdCStr, minimap2CMD);
-    tmpCStr = cpParmAndArg(tmpCStr, "-t", threadsCStr);
-    cpParmAndArg(
-        tmpCStr,
-        binStruct->bestReadCStr,
-        binStruct->topReadsCStr
-    );
-
     /*>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>\
-    ^ Fun-4 Sec-4: Make the consensus array & initalize with reference
+    ^ Fun-4 Sec-4: Make the pileup & initalize with reference
     \<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<*/
 
-    seqCStr = samStruct->seqCStr;
-    qCStr = samStruct->qCStr;
-    tmpBase = 0;
-
-    /*Initalize base struct using the reference read*/
+    errUChar =
+        initBasePile(
+            &pileST,
+            samStruct->seqCStr,
+            qEntryBl ? samStruct->qCStr : 0, /*Only if have Q-scores*/
+            settings->minBaseQUC
+    ); /*Set up the pileup with the reference*/
 
-    while(*seqCStr > 16)
-    { /*While have bases to read in*/
-        if(*seqCStr < 33)
-            continue;
-
-        tmpBase = malloc(sizeof(struct baseStruct));
-
-        if(tmpBase == 0)
-        { /*If had a memory allocation error*/
-            lastBase = 0;       /*So function knows no previous bases*/
-
-            /*Free all the made bases*/
-            while(headBase != 0)
-                headBase = freeBaseStruct(&headBase, lastBase);
-
-            return 64;
-        } /*If had a memory allocation error*/
-
-        if(headBase == 0)
-            headBase = tmpBase;           /*If is the first base*/
-        else
-            lastBase->nextBase = tmpBase; /*Set up list*/
-
-        tmpBase->nextBase = 0; /*Only matches at this point*/
-        tmpBase->altBase = 0;  /*No inserts at this point*/
-        tmpBase->baseChar = *seqCStr;    /*Record the base*/
-        tmpBase->errTypeChar = 0;        /*match = 0, snp=1, ins=2*/
-
-        qScoreUChar = *qCStr - Q_ADJUST; /*Get the Q-score*/
-
-        /*qEntryBl ensures if only files if their was a Q-score entry*/
-        if(qEntryBl && qScoreUChar < settings->minBaseQUC)
-        { /*If base is to low of quality to keep, make a blank struct*/
-            tmpBase->errTypeChar = 0;  /*match=0, snp=1, ins=2*/
-            tmpBase->numSupReadsUL = 0;
-        } /*If base is to low of quality to keep, make a blank struct*/
-
-        else
-            tmpBase->numSupReadsUL = 1;        /*match = 0, snp=1, ins=2*/
-
-        lastBase = tmpBase;
-        ++seqCStr;
-        ++qCStr;
-    } /*While have bases to read in*/
+    if(errUChar & 64)
+        return 64;
 
     /*>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>\
     ^ Fun-4 Sec-5: Map reads to the reference read
     ^    fun-4 sec-5 sub-1: run miniamp2 and read in first line
     ^    fun-4 sec-5 sub-2: Read in sequence and position on first base
-    ^    fun-4 sec-5 sub-3: Add matches & SNPs to consensus array
-    ^    Fun-4 Sec-5 sub-4: Get base matching cigar (match/snp or ins)
-    ^    fun-4 sec-5 sub-5: Check if should keep base or discard
-    ^    fun-4 sec-5 sub-6: Find matching base at position
-    ^    fun-4 sec-5 sub-7: Make new base (no matching) or update count
-    ^    fun-4 sec-5 sub-8: Make sure on an insertion
-    ^    fun-4 sec-5 sub-9: Check if should keep ins
-    ^    fun-4 sec-5 sub-10: Find matching ins at pos
-    ^    fun-4 sec-5 sub-11: check if need to make ins
-    ^    fun-4 sec-5 sub-12: Ingnore deletions
-    ^    fun-4 sec-5 sub-13: Ingnore soft masking
+    ^    fun-4 sec-5 sub-3: Add matches to the pileup
+    ^    fun-4 sec-5 sub-4: Add SNPs to the pileup
+    ^    fun-4 sec-5 sub-5: Add insertions to the pileup
+    ^    fun-4 sec-5 sub-6: Ingnore deletions
+    ^    fun-4 sec-5 sub-7: Ingnore soft masking
     \<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<*/
 
     /******************************************************************\
     * Fun-4 Sec-5 Sub-1: run miniamp2 and read in first line
     \******************************************************************/
 
-    stdinFILE = popen(minimap2CmdCStr, "r");
+    errUChar =
+        openSamMapper(
+            binStruct->bestReadCStr,
+            binStruct->topReadsCStr,
+            threadsCStr,
+            &mapST
+    ); /*Start mapping the top reads to the best read*/
+
+    if(!(errUChar & 1))
+    { /*If could not run minimap2*/
+        freeBasePile(&pileST);
+        return 32;
+    } /*If could not run minimap2*/
+
     blankSamEntry(samStruct); /*Make sure start with blank*/
 
     /*Read in a single sam file line to check if valid (header)*/
-    errUChar = readSamLine(samStruct, stdinFILE);
+    errUChar = readSamMapper(samStruct, &mapST);
 
     if(!(errUChar & 1))
     { /*If an error occured*/
-        pclose(stdinFILE);
+        closeSamMapper(&mapST);
+        freeBasePile(&pileST);
         return 32;
     } /*If an error occured*/
 
@@ -788,7 +732,7 @@ unsigned char simpleMajCon(
         if(*samStruct->samEntryCStr == '@')
         { /*If on a header entry, read in next entry*/
             blankSamEntry(samStruct);
-            errUChar = readSamLine(samStruct, stdinFILE);
+            errUChar = readSamMapper(samStruct, &mapST);
             continue;
         } /*If on a header entry, read in next entry*/
 
@@ -799,14 +743,14 @@ unsigned char simpleMajCon(
         if(*seqCStr == '*' || (*qCStr == '*' && *(qCStr + 1) == '\t'))
         { /*If no entry to check*/
             blankSamEntry(samStruct);
-            errUChar = readSamLine(samStruct, stdinFILE);
+            errUChar = readSamMapper(samStruct, &mapST);
             continue;
         } /*If no entry to check*/
 
         if(samStruct->flagUSht & 4)
         { /*If was an unampped read*/
             blankSamEntry(samStruct);
-            errUChar = readSamLine(samStruct, stdinFILE);
+            errUChar = readSamMapper(samStruct, &mapST);
             ++numMisSeqUL;
             ++numSeqUL;
             continue;
@@ -815,7 +759,7 @@ unsigned char simpleMajCon(
         if(samStruct->flagUSht & 2048)
         { /*If was an supplemental read*/
             blankSamEntry(samStruct);
-            errUChar = readSamLine(samStruct, stdinFILE);
+            errUChar = readSamMapper(samStruct, &mapST);
             continue; /*Do not bother with supplemental alignments*/
             /*My logic is that this is PCR data, so any supplemental
               alignment is a repeat region, from rolling circle
@@ -824,327 +768,154 @@ unsigned char simpleMajCon(
               I want to ignore.*/
         } /*If was an supplemental read*/
 
-        /*Get first base in the list*/
         ++numSeqUL; /*Count the number of non-supplemental reads*/
-        incBase = headBase;
-        cigEntryUInt = samStruct->posOnRefUInt - 1;
-            /*-1 for 1 index for posOnRef, but 0 index fo incBase*/
+        posUI = samStruct->posOnRefUInt - 1;
+            /*-1 for 1 index for posOnRef, but 0 index for the pileup*/
 
-        while(cigEntryUInt > 0)
-        { /*While not on the starting base*/
-            incBase = incBase->nextBase;
-            --cigEntryUInt;
-        } /*While not on the starting base*/
+        if(posUI > pileST.lenRefUI)
+            posUI = pileST.lenRefUI;
 
         while(*cigCStr != '\t')
         { /*While not at the end of the sam alignment sequence*/
             /*Get the cigar entry*/
             readCigEntry(&cigCStr, &cigEntryUInt);
 
-        /**************************************************************\
-        * Fun-4 Sec-5 Sub-3: Add matches & SNPs to consensus array
-        \**************************************************************/
+            /*Mapped bases can not go past the end of the reference*/
+            if(
+                   *cigCStr != 'I'
+                && *cigCStr != 'S'
+                && cigEntryUInt > pileST.lenRefUI - posUI
+            ) cigEntryUInt = pileST.lenRefUI - posUI;
 
             switch(*cigCStr)
             { /*switch: check the error type & add bases to consensus*/
-                case 'X':              /*snp, similar loop to match*/
-                case '=':              /*Match, similar loop to snp*/
+
+                /******************************************************\
+                * Fun-4 Sec-5 Sub-3: Add matches to the pileup
+                \******************************************************/
+
+                case '=':
+                /*Switch: Match*/
+                    /*Matches are always the reference base, so only the
+                      Q-score needs to be checked. This loop has no
+                      branches, so the compiler can vectorize it*/
+                    cntAryUI = pileST.matchAryUI + posUI;
+
+                    for(uiBase = 0; uiBase < cigEntryUInt; ++uiBase)
+                        cntAryUI[uiBase] +=
+                              (unsigned char) (qCStr[uiBase] - Q_ADJUST)
+                           >= settings->minBaseQUC;
+
+                    posUI += cigEntryUInt;
+                    seqCStr += cigEntryUInt;
+                    qCStr += cigEntryUInt;
+                    break;
+                /*Switch: Match*/
+
+                /******************************************************\
+                * Fun-4 Sec-5 Sub-4: Add SNPs to the pileup
+                \******************************************************/
+
+                case 'X':              /*snp*/
                 case '\t':             /*Match at end of cigar*/
-                /*Switch: Match, end of cigar match, snp, or insertion*/
+                /*Switch: snp or end of cigar match*/
                     while(cigEntryUInt > 0)
-                    { /*While have bases to add to the bases list*/
+                    { /*While have bases to add to the pileup*/
                         --cigEntryUInt;
 
-                        /**********************************************\
-                        * Fun-4 Sec-5 Sub-4: Find first non-insertion
-                        \**********************************************/
-
-                        while(incBase->errTypeChar & 2)
-                        { /*Get off the insertion*/
-                            lastBase = incBase;
-                            incBase = incBase->nextBase;
-                        } /*Get off the insertion*/
-
-                        /**********************************************\
-                        * Fun-4 Sec-5 Sub-5: Check if should keep base
-                        \**********************************************/
-
-                        tmpBase = incBase; /*Base position on*/
-                        qScoreUChar = *qCStr - Q_ADJUST; /*get Q-score*/
-
-                        if(qScoreUChar < settings->minBaseQUC)
-                        { /*If the base is low quality, skip*/
-                            /*Move to the next base in the list*/
-                            lastBase = incBase;
-                            incBase = incBase->nextBase;
-
-                            /*Move to the next base in the sam entry*/
-                            ++seqCStr;
-                            ++qCStr;
-                            continue; /*No support for position*/
-                        } /*If the base is low quality, skip*/
-
-                        /**********************************************\
-                        * Fun-4 Sec-5 Sub-6: Find alt matching base
-                        \**********************************************/
-
-                        while(tmpBase->baseChar != *seqCStr)
-                        { /*While the bases are not equal*/
-                            if(tmpBase->baseChar == 0)
-                                break; /*Empty base*/
-
-                            lastBase = tmpBase;
-                            tmpBase = tmpBase->altBase;
-
-                            if(tmpBase == 0)
-                                break; /*Need to create a new base*/
-                        } /*While the bases are not equal*/
-
-                        /**********************************************\
-                        * Fun-4 Sec-5 Sub-7: Make or update alt base
-                        \**********************************************/
-
-                        if(tmpBase == 0)
-                        { /*If need to create a new base*/
-                            lastBase->altBase =
-                                malloc(sizeof(struct baseStruct));
-
-                            tmpBase = lastBase->altBase;
-                            tmpBase->nextBase = 0; /*Is an alterantive*/
-                            tmpBase->altBase = 0;  /*No alternatives*/
-
-                            tmpBase->numSupReadsUL = 0;
-                            tmpBase->baseChar = *seqCStr;
-                            tmpBase->errTypeChar = 0;
-                        } /*If need to create a new base*/
-
-                        else if(tmpBase->baseChar == 0)
-                            tmpBase->baseChar = *seqCStr;
-
-                        ++tmpBase->numSupReadsUL;
-
-                        /*Move to the next base*/
-                        lastBase = incBase;
-                        incBase = incBase->nextBase;
+                        baseUC =
+                            pileBaseIdxAryUC[(unsigned char) *seqCStr];
+                        refUC = baseUC == pileST.refBaseAryUC[posUI];
+                        keepUC =
+                              (unsigned char) (*qCStr - Q_ADJUST)
+                           >= settings->minBaseQUC;
+
+                        pileST.matchAryUI[posUI] += keepUC & refUC;
+                        pileST.altAryUI[posUI * defPileBases + baseUC]
+                            += keepUC & !refUC;
+
+                        ++posUI;
                         ++seqCStr;
                         ++qCStr;
-                    } /*While have bases to add to the bases list*/
-            
+                    } /*While have bases to add to the pileup*/
+
                     break;
-                /*Switch: Match, end of cigar match, snp, or insertion*/
+                /*Switch: snp or end of cigar match*/
 
+                /******************************************************\
+                * Fun-4 Sec-5 Sub-5: Add insertions to the pileup
+                \******************************************************/
 
                 case 'I':   /*Is an insertion*/
                 /*Switch: for insertions*/
+                    colUI = 0; /*Start at the first column*/
 
                     while(cigEntryUInt > 0)
-                    { /*While have bases to add to the bases list*/
+                    { /*While have bases to add to the pileup*/
                         --cigEntryUInt;
 
-                        /**********************************************\
-                        * Fun-4 Sec-5 Sub-8: Make sure on an insertion
-                        \**********************************************/
-
-                        /*Insertions at the ends will likely be treated
-                          as softmasks by minimap2. This means that
-                          incBase will != 0 for insertions
-                        */
-                        if(!(incBase->errTypeChar & 2))
-                        { /*If next base is not an insertion*/
-                            tmpBase=malloc(sizeof(struct baseStruct));
-
-                            if(lastBase->errTypeChar & 2)
-                            { /*If the last base was an ins*/ 
-                                tmpBase->nextBase = incBase->nextBase;
-                                incBase->nextBase = tmpBase;
-                                incBase = tmpBase;
-                            } /*If the last base was an ins*/ 
-
-                            else
-                            { /*else the last base was not an ins*/ 
-                                tmpBase->nextBase = incBase;
-                                lastBase->nextBase = tmpBase;
-                                incBase = tmpBase;
-                            } /*else the last base was not an ins*/ 
-
-                            /*Set defualts for the new base*/
-                            incBase->altBase = 0;
-                            incBase->errTypeChar = 2;
-                            incBase->baseChar = 0;
-                            incBase->numSupReadsUL = 0;
-                        } /*If next base is not an insertion*/
-
-                        /**********************************************\
-                        * Fun-4 Sec-5 Sub-9: Check if should keep ins
-                        \**********************************************/
-    
-                        tmpBase = incBase; /*Base position on*/
-                        qScoreUChar = *qCStr - Q_ADJUST; /*get Q-score*/
-    
-                        if(qScoreUChar < settings->minInsQUC)
-                        { /*If the base is low quality, skip*/
-                            /*Move to the next base in the list*/
-    
-                            /*This avoids scattered insertions*/
-                            if(
-                                cigEntryUInt > 0 &&  /*More insertions*/
-                                !(incBase->nextBase->errTypeChar & 2)
-                                    /*^^Next base is not an insertion*/
-                            ) { /*If have other insertions to process*/
-                                /*Make a new base for next insertion*/
-                                tmpBase =
-                                    malloc(sizeof(struct baseStruct));
-    
-                                tmpBase->nextBase = incBase->nextBase;
-                                incBase->nextBase = tmpBase;
-                                lastBase = incBase;
-                                incBase = tmpBase;
-    
-                                /*Set the defaulst for the new base*/
-                                incBase->altBase = 0;
-                                incBase->errTypeChar = 2;
-                                incBase->baseChar = 0;
-                                incBase->numSupReadsUL = 0;
-                            } /*If have other insertions to process*/
-    
-                            else
-                            { /*Else is safe to move to the next base*/
-                                lastBase = incBase;
-                                incBase = incBase->nextBase;
-                            } /*Else is safe to move to the next base*/
-    
-                            /*Move to the next base in the sam entry*/
-                            ++seqCStr;
-                            ++qCStr;
-                            continue;
-                        } /*If the base is low quality, skip*/
-    
-                        /**********************************************\
-                        * Fun-4 Sec-5 Sub-10: Find matching ins at pos
-                        \**********************************************/
-    
-                        while(tmpBase->baseChar != *seqCStr)
-                        { /*While the bases are not equal*/
-                            if(tmpBase->baseChar == 0)
-                                break; /*Empty base*/
-    
-                            lastBase = tmpBase;
-                            tmpBase = tmpBase->altBase;
-    
-                            if(tmpBase == 0)
-                                 break; /*Need to create a new base*/
-                        } /*While the bases are not equal*/
-    
-                        /**********************************************\
-                        * Fun-4 Sec-5 Sub-11: check if need to make ins
-                        \**********************************************/
-    
-                        if(tmpBase == 0)
-                        { /*If need to create a new base*/
-                            lastBase->altBase =
-                                    malloc(sizeof(struct baseStruct));
-    
-                            tmpBase = lastBase->altBase;
-                            tmpBase->nextBase = 0; /*Is an alterantive*/
-                            tmpBase->altBase = 0;  /*No alternatives*/
-    
-                            tmpBase->errTypeChar = 2; /*Insertion*/
-                            tmpBase->baseChar = *seqCStr;
-                            tmpBase->numSupReadsUL = 0;
-                        } /*If need to create a new base*/
-    
-                        else if(tmpBase->baseChar == 0)
-                            tmpBase->baseChar = *seqCStr;
-    
-                        ++tmpBase->numSupReadsUL;
-    
-                        /*This avoids scattered deletions*/
-                        if(
-                            cigEntryUInt > 0 &&  /*More insertions*/
-                            !(incBase->nextBase->errTypeChar & 2)
-                                    /*^^Next base is not an insertion*/
-                        ) { /*If have other insertions to process*/
-                            /*Make a new base for next insertion*/
-                            tmpBase =
-                                malloc(sizeof(struct baseStruct));
-    
-                            tmpBase->nextBase = incBase->nextBase;
-                            incBase->nextBase = tmpBase;
-                            lastBase = incBase;
-                            incBase = tmpBase;
-    
-                            /*Set the defaulst for the new base*/
-                            incBase->altBase = 0;
-                            incBase->errTypeChar = 2;
-                            incBase->baseChar = 0;
-                            incBase->numSupReadsUL = 0;
-                        } /*If have other insertions to process*/
-    
-                        else /*Can move to the next base*/
-                        { /*Else is safe to move to the next base*/
-                            lastBase = incBase;
-                            incBase = incBase->nextBase;
-                        } /*Else is safe to move to the next base*/
-    
+                        /*The nth inserted base goes in the nth column
+                          before this position*/
+                        colUI = getInsCol(&pileST, posUI, colUI);
+
+                        if(colUI == 0)
+                        { /*If had a memory allocation error*/
+                            closeSamMapper(&mapST);
+                            freeBasePile(&pileST);
+                            return 64;
+                        } /*If had a memory allocation error*/
+
+                        baseUC =
+                            pileBaseIdxAryUC[(unsigned char) *seqCStr];
+                        keepUC =
+                              (unsigned char) (*qCStr - Q_ADJUST)
+                           >= settings->minInsQUC;
+
+                        pileST.insAryST[colUI - 1].baseCntAryUI[baseUC]
+                            += keepUC;
+
                         ++seqCStr;
                         ++qCStr;
-                    } /*While have bases to add to the bases list*/
+                    } /*While have bases to add to the pileup*/
                 
                     break;
                 /*Switch: for insertions*/
 
                 /******************************************************\
-                * Fun-4 Sec-5 Sub-12: Ignore deletions
+                * Fun-4 Sec-5 Sub-6: Ignore deletions
                 \******************************************************/
 
                 case 'D':
-                    /*Deletions will be marked as empty and will be 
-                      caught if their are to few bases, so can ignore.*/
-
-                    while(cigEntryUInt > 0)
-                    { /*While have bases to ignore*/
-                        --cigEntryUInt;
-
-                        /*Move past other sequences insertions*/
-                        while(incBase->errTypeChar & 2)
-                            incBase = incBase->nextBase; 
-
-                        lastBase = incBase;
-                        incBase = incBase->nextBase;
-                    } /*While have bases to ignore*/
-
+                    /*Deletions will have to few supporting reads and
+                      will be removed, so can ignore.*/
+                    posUI += cigEntryUInt;
                     break;
 
                 /******************************************************\
-                * Fun-4 Sec-5 Sub-13: Ignore soft masking
+                * Fun-4 Sec-5 Sub-7: Ignore soft masking
                 \******************************************************/
 
                 case 'S':
                 /*Switch: ingnore soft maskes 'S'*/
-                    while(cigEntryUInt > 0)
-                    { /*While have bases to ignore*/
-                        --cigEntryUInt;
-                        ++seqCStr;
-                        ++qCStr;
-                    } /*While have bases to ignore*/
-
+                    seqCStr += cigEntryUInt;
+                    qCStr += cigEntryUInt;
                     break;
                 /*Switch: ingnore soft maskes 'S'*/
             } /*switch: check the error type & add bases to consensus*/
         } /*While not at the end of the sam alignment sequence*/
 
         blankSamEntry(samStruct);
-        errUChar = readSamLine(samStruct, stdinFILE);
+        errUChar = readSamMapper(samStruct, &mapST);
     } /*While have alignments to read in from the sam file*/
 
-    pclose(stdinFILE);
+    closeSamMapper(&mapST);
 
     /*>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>\
     ^ Fun-4 Sec-6: Merge bases into a single majority consensus
     ^    fun-4 sec-6 sub-1: Set up for deciding bases to keep
-    ^    fun-4 sec-6 sub-2: Find best alternate base for each position
-    ^    fun-4 sec-6 sub-3: Check if should keep base
-    ^    fun-4 sec-6 sub-4: Add the base & Q-score to the sequence
+    ^    fun-4 sec-6 sub-2: Add the insertions before the position
+    ^    fun-4 sec-6 sub-3: Find the majority base at the position
+    ^    fun-4 sec-6 sub-4: Check if should keep base
     \<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<*/
 
     /******************************************************************\
@@ -1156,79 +927,102 @@ unsigned char simpleMajCon(
     minInsUL = numSeqUL * settings->minReadsPercInsFlt;
     settings->lenConUL = 0;
 
+    /*Make sure the buffer can hold every position and insertion*/
+    if(pileST.lenRefUI + pileST.numInsUI + 1 > samStruct->lenBuffULng)
+    { /*If need to increase the size of the buffer*/
+        tmpCStr =
+            realloc(
+                samStruct->samEntryCStr,
+                sizeof(char) * (pileST.lenRefUI + pileST.numInsUI + 1)
+        ); /*Resize the structs buffer*/
+
+        if(tmpCStr == 0)
+        { /*If had a memory allocation error*/
+            freeBasePile(&pileST);
+            return 64;
+        } /*If had a memory allocation error*/
+
+        samStruct->samEntryCStr = tmpCStr;
+        samStruct->lenBuffULng = pileST.lenRefUI + pileST.numInsUI + 1;
+    } /*If need to increase the size of the buffer*/
+
     seqCStr = samStruct->samEntryCStr;
     samStruct->readLenUInt = 0;
-    lastBase = 0;                     /*For freeing the list*/
 
-    /******************************************************************\
-    * Fun-4 Sec-6 Sub-2: Find the best alternate base for each position
-    \******************************************************************/
+    for(posUI = 0; posUI <= pileST.lenRefUI; ++posUI)
+    { /*For all positions in the consensus, keep the majority bases*/
 
-    while(headBase != 0)
-    { /*For all positions in the consensus, remove non-majority bases*/
-        incBase = headBase;         /*Move to 1st alternative base*/
-        tmpBase = headBase->altBase;
-        numSupReadsUL = incBase->numSupReadsUL;
-       
-        while(tmpBase != 0)
-        { /*While have bases to remove*/
-            numSupReadsUL += tmpBase->numSupReadsUL;
+        /**************************************************************\
+        * Fun-4 Sec-6 Sub-2: Add the insertions before the position
+        \**************************************************************/
 
-            if(incBase->numSupReadsUL < tmpBase->numSupReadsUL) 
-                headBase = freeBaseStruct(&incBase, lastBase);
-                /*Freeing puts tmpBase were incBase is*/
+        colUI = pileST.insHeadAryUI[posUI];
 
-            else
-            { /*If removing the current base in the list*/
-                /*Need to make sure freeBaseStruct does nothing funny*/
-                incBase->altBase = tmpBase->altBase;
-                tmpBase->altBase = 0;
-                freeBaseStruct(&tmpBase, lastBase);
-            } /*If removing the current base in the list*/
+        while(colUI != 0)
+        { /*While have insertion columns at this position*/
+            cntAryUI = pileST.insAryST[colUI - 1].baseCntAryUI;
+            colUI = pileST.insAryST[colUI - 1].nextColUI;
 
-            tmpBase = incBase->altBase; /*Move to next alternate base*/
-        } /*While have bases to remove*/
+            baseUC = 0;
+            numSupReadsUL = cntAryUI[0];
 
-        /**************************************************************\
-        * Fun-4 Sec-6 Sub-3: Check if should keep base
-        \**************************************************************/
+            for(uiBase = 1; uiBase < defPileBases; ++uiBase)
+            { /*Loop: Find the majority inserted base*/
+                numSupReadsUL += cntAryUI[uiBase];
+
+                if(cntAryUI[uiBase] > cntAryUI[baseUC])
+                    baseUC = uiBase;
+            } /*Loop: Find the majority inserted base*/
 
-        if(headBase->errTypeChar & 2)
-        { /*If is an insertion*/
             /*Find the % of reads/supplemental alignments needed to
               support this position*/
+            if(numSupReadsUL < minInsUL || numSupReadsUL == 0)
+                continue; /*To few insertions to have support*/
 
-            if(numSupReadsUL < minInsUL)
-            { /*If have to few insertions to have support*/
-                headBase = freeBaseStruct(&headBase, lastBase);
-                continue;                /*Move on to the next base*/       
-            } /*If have to few insertions to have support*/
-        } /*If is an insertion*/
+            *seqCStr = pileBaseCStr[baseUC];
+            ++seqCStr;
+            ++settings->lenConUL;
+        } /*While have insertion columns at this position*/
 
-        else
-        { /*If is a match or SNP*/
-            /*Find the % of reads/supplemental alignments needed to
-              support this position*/
+        if(posUI == pileST.lenRefUI)
+            break; /*Was the insertions after the last base*/
+
+        /**************************************************************\
+        * Fun-4 Sec-6 Sub-3: Find the majority base at the position
+        \**************************************************************/
+
+        /*The reference base wins ties*/
+        baseUC = pileST.refBaseAryUC[posUI];
+        bestSupUL = pileST.matchAryUI[posUI];
+        numSupReadsUL = bestSupUL;
+        cntAryUI = pileST.altAryUI + posUI * defPileBases;
 
-            if(numSupReadsUL<minNumBasesUL)
-            { /*If have to few SNPs or matches to have support*/
-                headBase = freeBaseStruct(&headBase, lastBase);
-                continue;                /*Move on to the next base*/       
-            } /*If have to few SNPs or matches to have support*/
-        } /*If is a match or SNP*/
+        for(uiBase = 0; uiBase < defPileBases; ++uiBase)
+        { /*Loop: Find the majority base*/
+            numSupReadsUL += cntAryUI[uiBase];
+
+            if(cntAryUI[uiBase] > bestSupUL)
+            { /*If this base has more support*/
+                bestSupUL = cntAryUI[uiBase];
+                baseUC = uiBase;
+            } /*If this base has more support*/
+        } /*Loop: Find the majority base*/
 
         /**************************************************************\
-        * Fun-4 Sec-6 Sub-4: Add the base & Q-score to the sequence
+        * Fun-4 Sec-6 Sub-4: Check if should keep base
         \**************************************************************/
 
-        /*Put the base into the sequence*/
-        *seqCStr = headBase->baseChar; /*Set the base*/
+        /*Find the % of reads/supplemental alignments needed to
+          support this position*/
+        if(numSupReadsUL < minNumBasesUL)
+            continue; /*To few SNPs or matches to have support*/
+
+        *seqCStr = pileBaseCStr[baseUC]; /*Set the base*/
         ++seqCStr; /*Move to next sequence entry*/
         ++settings->lenConUL; /*count base in the consensus length*/
+    } /*For all positions in the consensus, keep the majority bases*/
 
-        /*Free base and move to the next base*/
-        headBase = freeBaseStruct(&headBase, lastBase);
-    } /*For all positions in the consensus, remove non-majority bases*/
+    freeBasePile(&pileST);
 
     /*>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>\
     ^ Fun-4 Sec-7: Print out cosensus & do clean up
@@ -1283,8 +1077,8 @@ void buildConWithRacon(
         tmpConCStr[lenTmpBuffUS],   /*Hold the consensus name*/
         *tmpCStr = 0,
         *tmpFileCStr = 0,    /*For swapping consensus file names*/
-        *tmpFastaFileCStr = "tmp-2023-12-01-con-1563577017123412.fasta",
-        *tmpSamFileCStr = "tmp-2023-12-01-map-15635770171234122342.sam";
+        tmpFastaFileCStr[lenTmpBuffUS], /*Temporary consensus*/
+        tmpSamFileCStr[lenTmpBuffUS];   /*Temporary minimap2 output*/
 
      unsigned long numBytesUL = 0; /*Number bytes read in by fread*/
      FILE *conFILE = 0; /*For counting the consensus length*/
@@ -1293,6 +1087,23 @@ void buildConWithRacon(
     ^ Fun-5 Sec-2: Set up the consensus name
     <<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<*/
 
+    /*The temporary files are named after the bin, so bins can be
+      clustered at the same time*/
+    tmpCStr = cStrCpInvsDelm(tmpFastaFileCStr, conBin->fqPathCStr);
+
+    /*Get to end of .fastq or .fq*/
+    if(*(tmpCStr - 2) == 't') tmpCStr -= 6; /*.fastq*/
+    else tmpCStr -= 3;                      /*.fq*/
+
+    cStrCpInvsDelm(tmpCStr, "--tmp-con.fasta");
+
+    tmpCStr = cStrCpInvsDelm(tmpSamFileCStr, conBin->fqPathCStr);
+
+    if(*(tmpCStr - 2) == 't') tmpCStr -= 6; /*.fastq*/
+    else tmpCStr -= 3;                      /*.fq*/
+
+    cStrCpInvsDelm(tmpCStr, "--tmp-map.sam");
+
     /*Check if need to build the consensus name*/
     if(conBin->consensusCStr[0] == '\0')
     { /*If using the best read for the first round of racon*/
@@ -1733,7 +1544,6 @@ struct readBin * cmpCons(
     uint8_t zeroUChar = 0;
 
     char *tmpCStr = 0;
-    char minimap2CmdCStr[2048];
 
     uint32_t
         incBuffUInt = 10000; /*Amount to increase buff size each time*/
@@ -1741,6 +1551,8 @@ struct readBin * cmpCons(
     FILE
         *stdinFILE = 0; /*File to see if input files are valid*/
 
+    struct samMapper mapST; /*Maps consensuses to each other*/
+
     struct readBin
         *refBin = 0;
 
@@ -1875,41 +1687,43 @@ struct readBin * cmpCons(
 
             blankSamEntry(samStruct);
 
-            /*Prepare the minimap2 command*/
-            tmpCStr = cStrCpInvsDelm(minimap2CmdCStr, minimap2CMD);
-            tmpCStr = cpParmAndArg(tmpCStr, "-t", threadsCStr);
-            cpParmAndArg(
-                tmpCStr,
-                conBin->consensusCStr,
-                refBin->consensusCStr
-            );
+            /*The consensus stays the same for every refBin, so the
+              libminimap2 build only indexes it once*/
+            errUChar =
+                openSamMapper(
+                    conBin->consensusCStr,
+                    refBin->consensusCStr,
+                    threadsCStr,
+                    &mapST
+            ); /*run minimap2*/
 
-            stdinFILE = popen(minimap2CmdCStr, "r"); /*run minimap2*/
+            if(!(errUChar & 1))
+                return 0;
 
             blankSamEntry(samStruct);
-            errUChar = readSamLine(samStruct, stdinFILE); /*1st line*/
+            errUChar = readSamMapper(samStruct, &mapST); /*1st line*/
 
             if(*samStruct->samEntryCStr != '@')
             { /*If no header*/
-                pclose(stdinFILE);
+                closeSamMapper(&mapST);
                 return 0;
             } /*If no header*/
 
             while(errUChar & 1)
             { /*While on the haeder lines*/
                 blankSamEntry(samStruct);
-                errUChar = readSamLine(samStruct, stdinFILE);
+                errUChar = readSamMapper(samStruct, &mapST);
 
                 if(*samStruct->samEntryCStr != '@')
                 { /*If off the header entries*/
-                    pclose(stdinFILE);
+                    closeSamMapper(&mapST);
                     break; /*If not a header*/
                 } /*If off the header entries*/
             } /*While on the haeder lines*/
 
             if(*samStruct->samEntryCStr == '@')
             { /*If their was only headers*/
-                pclose(stdinFILE);
+                closeSamMapper(&mapST);
                 continue;
             } /*If their was only headers*/
 
@@ -1937,77 +1751,6 @@ struct readBin * cmpCons(
     return 0;
 } /*cmpCons*/
 
-/*---------------------------------------------------------------------\
-| Output:
-|   o Returns:
-|     - The next base in the list (if altBase != 0, returns altBase)
-|   o Frees:
-|     - The baseToFree from memory
-|   o Modifies:
-|     - If their is an alternative base (baseToFree->altBase != 0)
-|         o lastBase->nextBase is set to baseToFree->altBase
-|         o bastToFree is set to bastToFree->altBase
-|     - If their is not alternative base (bastToFree->altBase == 0)
-|         o lastBase->nextBase is set to baseToFree->nextBase
-|         o bastToFree is set to 0
-| Note:
-|    o This function assumes that the next base pointer (nextBase) is
-|      is alwasy 0 (not set) for teh alternate base pointer (altBase==0)
-\---------------------------------------------------------------------*/
-struct baseStruct * freeBaseStruct(
-    struct baseStruct **baseToFree, /*Insertion list to free*/
-    struct baseStruct *lastBase     /*Base to assign pointers to*/
-) /*Frees an base from a linked list of bases*/
-{ /*freeBaseStruct*/
-
-    /*~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~\
-    ' Fun-8 TOC: Sec-1 Sub-1: freeBaseStruct
-    \~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~*/
-
-    if(*baseToFree == 0)
-        return 0;
-    
-    if((*baseToFree)->altBase != 0)
-    { /*If have an alternative base to keep as the next base*/
-        (*baseToFree)->altBase->nextBase = (*baseToFree)->nextBase;
-
-        if(lastBase != 0)
-        { /*If have a previous base*/
-            lastBase->nextBase = (*baseToFree)->altBase;
-            free(*baseToFree);
-            *baseToFree = lastBase->nextBase;
-        } /*If have a previous base*/
-
-        else
-        { /*Else this was the first base*/
-            lastBase = (*baseToFree)->altBase;
-            free(*baseToFree);
-            *baseToFree = lastBase;
-        } /*Else this was the first base*/
-
-        return *baseToFree;
-    } /*If have an alternative base to keep as the next base*/
-
-    else
-    { /*Else if their is only a next base*/
-        if(lastBase != 0)
-        { /*If have a previous base in the list*/
-            lastBase->nextBase = (*baseToFree)->nextBase;
-            free(*baseToFree);
-            *baseToFree = 0; /*Tell that their are no alternate bases*/
-            return lastBase->nextBase;
-        } /*If have a previous base in the list*/
-
-        else
-        { /*Else baseToFree was the first base*/
-            lastBase = (*baseToFree)->nextBase;
-            free(*baseToFree);
-            *baseToFree = 0; /*Tell that their are no alternate bases*/
-            return lastBase;
-        } /*Else baseToFree was the first base*/
-    } /*Else if their is only a next base*/
-} /*freeBaseStruct*/
-
 /*---------------------------------------------------------------------\
 | Output: Modifies: majConStruct to have default settings
 \---------------------------------------------------------------------*/
@@ -2095,6 +1838,7 @@ void initConBuildStruct(
     conSetST->minPercMappedReadsFlt =defMinPercMappedReads;
     
     conSetST->useStatBl = 0;
+    conSetST->fqIdxBl = 0;
     conSetST->clustUC = 0;
     conSetST->minReadsToBuildConUL = minReadsPerBin;
     conSetST->numRndsToPolishUI = defNumPolish;
@@ -2168,22 +1912,22 @@ unsigned char ivarCon(
 
 
    ushort lenIvarCmdUS = 2048;
-   char minimap2CmdStr[lenIvarCmdUS];
    char ivarCmdStr[lenIvarCmdUS];
    char *buffStr = 0;
       /*So can swap between buffers when checking the
-      ` sequence. I am using the minimap2CmdStr and
-      ` ivarCmdStr as buffers in the consensus check step.
+      ` sequence. I am using the ivarCmdStr as a buffer in
+      ` the consensus check step.
       */
 
    int lenPrefI = 512;
    char prefixStr[lenPrefI];   /*output File name*/
    char *prefEndStr = 0;
    char *tmpStr = 0;
+   char *qryPathStr = 0; /*Reads to map to the best read*/
 
    uchar errUC = 0;  /*Report errors*/
 
-   FILE *stdinFILE = 0;
+   struct samMapper mapST; /*Maps reads to the best read*/
    FILE *stdoutFILE = 0;
 
    /*>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>\
@@ -2192,7 +1936,7 @@ unsigned char ivarCon(
    ^  o fun-13 sec-02 sub-01:
    ^    - Build the consensus name
    ^  o fun-13 sec-02 sub-02:
-   ^    - Make the command for minimap2
+   ^    - Pick the reads to map with minimap2
    ^  o fun-13 sec-02 sub-03:
    ^    - Make the command for ivar
    \<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<*/
@@ -2220,31 +1964,17 @@ unsigned char ivarCon(
 
    /******************************************************\
    * Fun-13 Sec-02 Sub-02:
-   *  - Make the command for minimap2
+   *  - Pick the reads to map with minimap2
    \******************************************************/
 
-   tmpStr = cStrCpInvsDelm(minimap2CmdStr, minimap2CMD);
-   tmpStr = cpParmAndArg(tmpStr, "-t", threadsStr);
-
    /*Check if I am using a consensus file or best reads*/
    /*I set the best read to the last consensus when I am
    ` doing multiple iterations
    */
    if(conST->consensusCStr[0] == '\0')
-      tmpStr =
-         cpParmAndArg(
-            tmpStr,
-            conST->bestReadCStr,
-            conST->consensusCStr
-      ); /*Copy reads and the consensus*/
-
+      qryPathStr = conST->consensusCStr;
    else
-      tmpStr =
-         cpParmAndArg(
-            tmpStr,
-            conST->bestReadCStr,
-            conST->fqPathCStr
-      ); /*Copy the reads and the best read/consensus*/
+      qryPathStr = conST->fqPathCStr;
 
    /******************************************************\
    * Fun-13 Sec-02 Sub-03:
@@ -2324,15 +2054,22 @@ unsigned char ivarCon(
    *  - Call minimap2
    \******************************************************/
 
-   stdinFILE = popen(minimap2CmdStr, "r");
-   if(stdinFILE == 0) return 32;
+   errUC =
+      openSamMapper(
+         conST->bestReadCStr,
+         qryPathStr,
+         threadsStr,
+         &mapST
+   ); /*Start mapping the reads to the best read*/
+
+   if(!(errUC & 1)) return 32;
 
    blankSamEntry(samST);
-   errUC = readSamLine(samST, stdinFILE);
+   errUC = readSamMapper(samST, &mapST);
 
    if(!(errUC & 1))
    { /*If: I had an error with minimap2*/
-      pclose(stdinFILE);
+      closeSamMapper(&mapST);
       return 32;
    } /*If: I had an error with minimap2*/
 
@@ -2345,7 +2082,7 @@ unsigned char ivarCon(
 
    if(stdoutFILE == 0)
    { /*If: I had a pipe problem with ivar*/
-      pclose(stdinFILE);
+      closeSamMapper(&mapST);
       blankSamEntry(samST);
       return 2;
    } /*If: I had a pipe problem with ivar*/
@@ -2366,7 +2103,7 @@ unsigned char ivarCon(
            || (samST->flagUSht & 2048) /*Supplemental aln*/
          ){ /*If: This is not an entry I want to keep*/
             blankSamEntry(samST);
-            errUC = readSamLine(samST, stdinFILE);
+            errUC = readSamMapper(samST, &mapST);
             continue;
          } /*If: This is not an entry I want to keep*/
 
@@ -2375,11 +2112,10 @@ unsigned char ivarCon(
 
       printSamEntry(samST, stdoutFILE);
       blankSamEntry(samST);
-      errUC = readSamLine(samST, stdinFILE);
+      errUC = readSamMapper(samST, &mapST);
    } /*Loop: though the entire minimap2 output*/
 
-   pclose(stdinFILE);
-   stdinFILE = 0;
+   closeSamMapper(&mapST);
 
    pclose(stdoutFILE);
    stdoutFILE = 0;
@@ -2508,6 +2244,172 @@ unsigned char ivarCon(
    return 1;
 } /*ivarCon*/
 
+/*---------------------------------------------------------------------\
+| Output:
+|   - Modifies:
+|     o pileST to have one position for each base in seqCStr. Each
+|       reference base starts with one supporting read, unless its
+|       Q-score is under minBaseQUC
+|   - Returns:
+|     o 1 for success
+|     o 64 for a memory allocation error
+\---------------------------------------------------------------------*/
+uint8_t initBasePile(
+    struct basePile *pileST,  /*Pileup to set up*/
+    char *seqCStr,            /*Reference sequence*/
+    char *qCStr,              /*Reference Q-scores (0 if no Q-score)*/
+    unsigned char minBaseQUC  /*Min Q-score to support a base*/
+) /*Sets up a pileup with a reference sequence*/
+{ /*initBasePile*/
+
+    /*~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~\
+    ' Fun-14 TOC: initBasePile
+    '    fun-14 sec-1: Find the reference length & make the arrays
+    '    fun-14 sec-2: Add the reference bases
+    \~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~*/
+
+    /*>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>\
+    ^ Fun-14 Sec-1: Find the reference length & make the arrays
+    \<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<*/
+
+    uint32_t posUI = 0;
+
+    pileST->lenRefUI = 0;
+
+    while(seqCStr[pileST->lenRefUI] > 16)
+        ++pileST->lenRefUI;
+
+    pileST->refBaseAryUC =
+        malloc(sizeof(uint8_t) * (pileST->lenRefUI + 1));
+    pileST->matchAryUI =
+        calloc(pileST->lenRefUI + 1, sizeof(uint32_t));
+    pileST->altAryUI =
+        calloc((pileST->lenRefUI + 1) * defPileBases, sizeof(uint32_t));
+    pileST->insHeadAryUI =
+        calloc(pileST->lenRefUI + 1, sizeof(uint32_t));
+
+    pileST->insAryST = 0;
+    pileST->numInsUI = 0;
+    pileST->lenInsBuffUI = 0;
+
+    if(
+          pileST->refBaseAryUC == 0
+       || pileST->matchAryUI == 0
+       || pileST->altAryUI == 0
+       || pileST->insHeadAryUI == 0
+    ){ /*If had a memory allocation error*/
+       freeBasePile(pileST);
+       return 64;
+    } /*If had a memory allocation error*/
+
+    /*>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>\
+    ^ Fun-14 Sec-2: Add the reference bases
+    \<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<*/
+
+    for(posUI = 0; posUI < pileST->lenRefUI; ++posUI)
+    { /*Loop: Add the reference bases*/
+        pileST->refBaseAryUC[posUI] =
+            pileBaseIdxAryUC[(unsigned char) seqCStr[posUI]];
+
+        /*Low quality reference bases have no support*/
+        pileST->matchAryUI[posUI] =
+               qCStr == 0
+            || (unsigned char) (qCStr[posUI] - Q_ADJUST) >= minBaseQUC;
+    } /*Loop: Add the reference bases*/
+
+    return 1;
+} /*initBasePile*/
+
+/*---------------------------------------------------------------------\
+| Output:
+|   - Modifies:
+|     o pileST->insAryST to have a new column after lastColUI (or as
+|       the first column at posUI) if there was no column
+|   - Returns:
+|     o Index + 1 of the next insertion column at posUI
+|     o 0 for a memory allocation error
+\---------------------------------------------------------------------*/
+uint32_t getInsCol(
+    struct basePile *pileST, /*Pileup to get insertion column from*/
+    uint32_t posUI,          /*Position the insertion is before*/
+    uint32_t lastColUI       /*Last column (index + 1) 0 for first*/
+) /*Gets (or makes) the next insertion column at a position*/
+{ /*getInsCol*/
+
+    /*~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~\
+    ' Fun-15 TOC: Sec-1 Sub-1: getInsCol
+    \~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~*/
+
+    struct insPileCol *tmpColST = 0;
+    uint32_t colUI = 0;
+
+    if(lastColUI == 0)
+        colUI = pileST->insHeadAryUI[posUI];
+    else
+        colUI = pileST->insAryST[lastColUI - 1].nextColUI;
+
+    if(colUI != 0)
+        return colUI; /*Already have this column*/
+
+    if(pileST->numInsUI >= pileST->lenInsBuffUI)
+    { /*If need more columns*/
+        tmpColST =
+            realloc(
+                pileST->insAryST,
+                sizeof(struct insPileCol) * (pileST->lenInsBuffUI+1024)
+        ); /*Indexes are used for links, so realloc is safe*/
+
+        if(tmpColST == 0)
+            return 0;
+
+        pileST->insAryST = tmpColST;
+        pileST->lenInsBuffUI += 1024;
+    } /*If need more columns*/
+
+    tmpColST = &pileST->insAryST[pileST->numInsUI];
+    memset(tmpColST, 0, sizeof(struct insPileCol));
+    ++pileST->numInsUI;
+    colUI = pileST->numInsUI; /*Index + 1*/
+
+    if(lastColUI == 0)
+        pileST->insHeadAryUI[posUI] = colUI;
+    else
+        pileST->insAryST[lastColUI - 1].nextColUI = colUI;
+
+    return colUI;
+} /*getInsCol*/
+
+/*---------------------------------------------------------------------\
+| Output:
+|   - Frees:
+|     o The arrays in pileST (pileST is not freed)
+\---------------------------------------------------------------------*/
+void freeBasePile(
+    struct basePile *pileST  /*Pileup to free*/
+) /*Frees the arrays in a pileup*/
+{ /*freeBasePile*/
+
+    /*~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~\
+    ' Fun-16 TOC: Sec-1 Sub-1: freeBasePile
+    \~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~*/
+
+    free(pileST->refBaseAryUC);
+    free(pileST->matchAryUI);
+    free(pileST->altAryUI);
+    free(pileST->insHeadAryUI);
+    free(pileST->insAryST);
+
+    pileST->refBaseAryUC = 0;
+    pileST->matchAryUI = 0;
+    pileST->altAryUI = 0;
+    pileST->insHeadAryUI = 0;
+    pileST->insAryST = 0;
+
+    pileST->lenRefUI = 0;
+    pileST->numInsUI = 0;
+    pileST->lenInsBuffUI = 0;
+} /*freeBasePile*/
+
 /*--------------------------------------------------------\
 | Name: initIvarSet [initIvarSet(iverSetST);]
 | Macro-01:
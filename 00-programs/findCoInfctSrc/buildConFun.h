@@ -127,6 +127,10 @@ typedef struct conBuildStruct
          /*1: Use a stats file instead of read median-Q
          ` for finding a good read to build with
          */
+    char fqIdxBl;
+         /*1: Keep a read id index of the fastq (fqGetIdsIndex),
+         ` so each round does not rescan the fastq file
+         */
     uchar clustUC; /*Cluster number of consensus*/
     uint numRndsToPolishUI;
        /*This is used to determine the number of times
@@ -152,23 +156,45 @@ typedef struct conBuildStruct
     struct ivarSet ivarSetST;
 }condBuildStruct;
 
+#define defPileBases 5 /*N (any other base), A, C, G, and T*/
+#define pileBaseCStr "NACGT" /*Base for each pileup index*/
+
 /*---------------------------------------------------------------------\
-| Struct-6: baseStruct
+| Struct-6: insPileCol
 | Use:
-|    - Holds the base, error type (if insertion or deletion), & a
-|      counter for number of reads with the same base.
+|    - Holds the number of reads supporting each base at one insertion
+|      column. Columns at the same position are linked by nextColUI.
 \---------------------------------------------------------------------*/
-typedef struct baseStruct
-{ /*baseStruct*/
-    char baseChar;     /*What is the base (0 for deletion)*/
-    char errTypeChar;  /*0 = match, 1 = SNP, 2 = insertion*/
-    
-   /*Recored number of reads that supported this base (good quality)*/
-   unsigned long numSupReadsUL;
+typedef struct insPileCol
+{ /*insPileCol*/
+    uint32_t baseCntAryUI[defPileBases]; /*Reads supporting each base*/
+    uint32_t nextColUI; /*Next column at position (index + 1, 0: none)*/
+}insPileCol;
 
-   struct baseStruct *altBase; /*Alternate options for the base*/
-   struct baseStruct *nextBase; /*For linked lists*/
-}baseStruct;
+/*---------------------------------------------------------------------\
+| Struct-7: basePile
+| Use:
+|    - Pileup of the reads mapped to a reference for the majority
+|      consensus. Each reference position has one entry in the flat
+|      count arrays. Insertions are kept in a separate column table
+|      that is keyed by the position the insertion comes before.
+\---------------------------------------------------------------------*/
+typedef struct basePile
+{ /*basePile*/
+    uint32_t lenRefUI;       /*Number of positions in the reference*/
+    uint8_t *refBaseAryUC;   /*Pileup index of each reference base*/
+    uint32_t *matchAryUI;    /*Reads supporting the reference base*/
+    uint32_t *altAryUI;
+       /*Reads supporting other bases (defPileBases per position)*/
+    uint32_t *insHeadAryUI;
+       /*First insertion column before each position (index + 1,
+       ` 0: none). Has lenRefUI + 1 entries (last is the end)
+       */
+
+    struct insPileCol *insAryST; /*Insertion columns*/
+    uint32_t numInsUI;           /*Number of columns in insAryST*/
+    uint32_t lenInsBuffUI;       /*Columns allocated for insAryST*/
+}basePile;
 
 /*---------------------------------------------------------------------\
 | Output:
@@ -284,25 +310,44 @@ struct readBin * cmpCons(
 
 /*---------------------------------------------------------------------\
 | Output:
-|   o Returns:
-|     - The next base in the list (if altBase != 0, returns altBase)
-|   o Frees:
-|     - The baseToFree from memory
-|   o Modifies:
-|     - If their is an alternative base (baseToFree->altBase != 0)
-|         o lastBase->nextBase is set to baseToFree->altBase
-|         o bastToFree is set to bastToFree->altBase
-|     - If their is not alternative base (bastToFree->altBase == 0)
-|         o lastBase->nextBase is set to baseToFree->nextBase
-|         o bastToFree is set to 0
-| Note:
-|    o This function assumes that the next base pointer (nextBase) is
-|      is alwasy 0 (not set) for teh alternate base pointer (altBase==0)
+|   - Modifies:
+|     o pileST to have one position for each base in seqCStr. Each
+|       reference base starts with one supporting read, unless its
+|       Q-score is under minBaseQUC
+|   - Returns:
+|     o 1 for success
+|     o 64 for a memory allocation error
+\---------------------------------------------------------------------*/
+uint8_t initBasePile(
+    struct basePile *pileST,  /*Pileup to set up*/
+    char *seqCStr,            /*Reference sequence*/
+    char *qCStr,              /*Reference Q-scores (0 if no Q-score)*/
+    unsigned char minBaseQUC  /*Min Q-score to support a base*/
+); /*Sets up a pileup with a reference sequence*/
+
+/*---------------------------------------------------------------------\
+| Output:
+|   - Modifies:
+|     o pileST->insAryST to have a new column after lastColUI (or as
+|       the first column at posUI) if there was no column
+|   - Returns:
+|     o Index + 1 of the next insertion column at posUI
+|     o 0 for a memory allocation error
+\---------------------------------------------------------------------*/
+uint32_t getInsCol(
+    struct basePile *pileST, /*Pileup to get insertion column from*/
+    uint32_t posUI,          /*Position the insertion is before*/
+    uint32_t lastColUI       /*Last column (index + 1) 0 for first*/
+); /*Gets (or makes) the next insertion column at a position*/
+
+/*---------------------------------------------------------------------\
+| Output:
+|   - Frees:
+|     o The arrays in pileST (pileST is not freed)
 \---------------------------------------------------------------------*/
-struct baseStruct * freeBaseStruct(
-    struct baseStruct **baseToFree, /*Insertion list to free*/
-    struct baseStruct *lastBase     /*Base to assign pointers to*/
-); /*Frees an base from a linked list of bases*/
+void freeBasePile(
+    struct basePile *pileST  /*Pileup to free*/
+); /*Frees the arrays in a pileup*/
 
 /*---------------------------------------------------------------------\
 | Output: Modifies: majConStruct to have default settings
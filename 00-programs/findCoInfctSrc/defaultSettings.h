@@ -56,6 +56,7 @@
     /*Format is version.yearMonthDay*/
 #define defPrefix "out"      /*Default prefix to use*/
 #define defThreads "3"       /*Default number of threads to use*/
+#define defBinThreads 1      /*Number of bins to cluster at once*/
 #define rmReadsWithSupAln 0
     /*1: remove reads with supplementary aligments*/
 #define defReadsPerCon 300
@@ -356,6 +356,8 @@ int main(int lenArgsInt, char *argsCStr[])
     fclose(testFILE);
     testFILE = 0;
     strcpy(binTree.fqPathCStr, fqFileCStr);
+    binTree.fqIdxBl = 0;
+    binTree.writeST = 0;
 
     /*>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>\
     ^ Main Sec-4: Check if can open reference file (if one was input)
@@ -36,6 +36,7 @@
 #include "buildConFun.h" /*Various dependencies through readExtract.h*/
 #include "binReadsFun.h" /*Functions for binning reads*/
 #include "trimPrimersSearch.h" /*For trimming reads with primers*/
+#include "findCoInftClust.h" /*Builds clusters for each bin*/
 
 /*---------------------------------------------------------------------\
 | Output:
@@ -52,6 +53,7 @@ char * getUserInput(
     char **refsPathCStr, /*Holds path to references*/
     char **primPathCStr,/*Holds path to primer fasta file for trimming*/
     char *threadsCStr, /*Number threads for minimap2 & racon*/
+    uint32_t *binThreadsUI, /*Number of bins to cluster at once*/
     char *rmSupAlnBl,  /*1: Remove reads with supplemental alignments*/
     char *skipBinBl,   /*1: Skip the binning step, 0 do not*/
     char *skipClustBl, /*1: Skip the clusterin step, 0 do not*/
@@ -106,6 +108,7 @@ int main(
     char skipClustBl = defSkipClustBl; /*Skip clustering step?*/
     char prefCStr[100];        /*Holds the user prefix*/
     char threadsCStr[7];      /*Number of threads for minimap2 & racon*/
+    uint32_t binThreadsUI = defBinThreads; /*Bins to cluster at once*/
     double minReadsDbl = defMinPercReads;
         /*What percentage of reads should the final cluster have*/
 
@@ -126,6 +129,7 @@ int main(
     char *inutErrCStr = 0; /*holds user input error*/
 
     unsigned long totalKeptReadsUL = 0;
+    unsigned long numKeptReadsUL = 0; /*Reads kept by clustBins*/
 
     /*FILES opened*/
     FILE *logFILE = 0;      /*Holds the log*/
@@ -171,6 +175,12 @@ int main(
             \n        - Prefix to add to file names          [Out]\
             \n    -threads:\
             \n        - Number of threads to use             [3]\
+            \n    -bin-threads:                              [1]\
+            \n        - Number of bins to build consensuses\
+            \n          for at once. The -threads are split\
+            \n          between the bins (-threads 32\
+            \n          -bin-threads 8 gives minimap2 and\
+            \n          racon 4 threads for each bin).\
             \n    -primers:                                  [None]\
             \n        - Fasta file with primers to trim\
             \n          reads with.\
@@ -195,6 +205,10 @@ int main(
             \n        - Number of times to rebuild the\
             \n          consensus using a new set of best\
             \n          reads.\
+            \n    -fq-index:                                 [No]\
+            \n        - Keep a sorted read id index of each\
+            \n          bins fastq (fastq.idx), so each round\
+            \n          does not rescan the bins fastq.\
             \n    -min-read-length:                          [500]\
             \n       - Minimum read length to keep a read.\
             \n         Discard reads with read lengths under this\
@@ -340,8 +354,6 @@ int main(
             \n      genes.\
             \n    - If this setting is off, then supplemental\
             \n      alignments are just ignored.\
-            \n    - This setting requires running minimap2 with\
-            \n      just one thread for binning.\
             \n -read-ref-snps:                           [0.02 = 2%]\
             \n    - Minimum percentage of snps needed to\
             \n      discard a read during the read to\
@@ -712,6 +724,7 @@ int main(
             &refsPathCStr,
             &primPathCStr,
             threadsCStr,
+            &binThreadsUI,
             &rmSupAlnBl,
             &skipBinBl,   /*1: Skip the binning step, 0 do not*/
             &skipClustBl, /*1: Skip the clusterin step, 0 do not*/
@@ -1096,6 +1109,7 @@ int main(
 
     /*Print out the number of threads input*/
     fprintf(logFILE, "    -threads %s \\\n", threadsCStr);
+    fprintf(logFILE, "    -bin-threads %u \\\n", binThreadsUI);
 
     /*Print out the general settings*/
     fprintf(logFILE, "    -prefix %s \\\n", prefCStr);
@@ -1126,6 +1140,9 @@ int main(
     if(rmSupAlnBl & 1)
         fprintf(logFILE, "    -rm-sup-reads \\\n");
 
+    if(conSet.fqIdxBl & 1)
+        fprintf(logFILE, "    -fq-index \\\n");
+
     if(!(conSet.useStatBl & 1) || skipBinBl & 1)
     { /*If using the median Q-score*/
         fprintf(logFILE, "    -pick-read-with-med-q \\\n");
@@ -1655,8 +1672,10 @@ int main(
             0,              /*Not using paf file from stdin*/
             fqPathCStr,     /*reads to trim*/
             primOutFqCStr,  /*Output file*/
+            0,              /*Trim off every primer*/
             threadsCStr,
-            1               /*Using the hashing algorithm*/
+            1,              /*Using the hashing algorithm*/
+            0               /*Map primers with minimap2 (not interAln)*/
         ); /*Trim the reads*/
 
         fqPathCStr = primOutFqCStr; /*Set this as the default fastq*/
@@ -1673,7 +1692,6 @@ int main(
                 rmSupAlnBl,         /*Remove supplementary alignments*/
                 1,                  /*1: trim reads, 0: do not*/
                 &samStruct,
-                &refStruct,
                 &readToRefMinStats,
                 &errUC              /*Reports any errors*/
         );
@@ -1727,13 +1745,10 @@ int main(
     ^ Main Sec-7: Non-reference based binning steps
     ^    main sec-7 sub-1: Set up for clustering or consnsus buidling
     ^    main sec-7 sub-2: Print read counts for bins & decide if keep
-    ^    main sec-7 sub-3: Set up readBin to hold a clusters files
-    ^    main sec-7 sub-4: Build the consensus
-    ^    main sec-7 sub-5: Copy best read back into to its orignal bin
-    ^    main sec-7 sub-6: Bin reads to the consensus
-    ^    main sec-7 sub-7: Compare new consensus to old consensuses
-    ^    main sec-7 sub-8: Update list of clusters in bin
-    ^    main sec-7 sub-9: Add clusters to bin & move to next bin
+    ^    main sec-7 sub-3: Build the clusters for each bin
+    ^        - findCoInftClust.c builds the consensus, bins the reads to
+    ^          the consensus, and compares it to the bins other
+    ^          consensuses. -bin-threads bins are done at once.
     ^        - Before going in the bin list is an balanced tree
     ^        - after this the bins are in a list, with the left pointer
     ^          pointing towards the bins & the right pointer pointing
@@ -1788,10 +1803,7 @@ int main(
     \******************************************************************/
 
     while(clustOn != 0)
-    { /*While have reads to cluster*/
-        conSet.clustUC = 0;
-        lastClust = clustOn; /*Head of cluster list*/
-
+    { /*While have bins to check*/
         fprintf(
             statFILE,
             "%s\t%lu",
@@ -1823,185 +1835,62 @@ int main(
         fprintf(statFILE, "\tkept\tfirst-binning\n");
         fflush(statFILE); /*make sure io printed out*/
 
-        /**************************************************************\
-        * Main Sec-7 Sub-3: Set up readBin to hold a clusters files
-        \**************************************************************/
- 
-        while(clustOn->numReadsULng >= conSet.minReadsToBuildConUL)
-        { /*While have reads to bin*/
-            errUC = 0; /*reset*/
-
-            if(tmpBin == 0)
-                tmpBin = malloc(sizeof(struct readBin));
-
-            if(tmpBin != 0)
-            { /*If I need to blank the bin*/
-                blankReadBin(tmpBin);
-                tmpBin->balUChar = 1; /*To mark keeping*/
-            } /*If I need to blank the bin*/
-
-            else
-            { /*Else memory allocation error*/
-                logFILE = fopen(logFileCStr, "a");
-
-                fprintf(
-                    stderr,
-                    "Memory error in non-ref binning (main sec-7)\n"
-                ); /*Let user know about memory issue*/
-
-                fprintf(
-                    logFILE,
-                    "Memory error in non-ref binning (main sec-7)\n"
-                );
-
-                fclose(logFILE);
-                freeStackSamEntry(&samStruct);
-                freeStackSamEntry(&refStruct);
-
-                freeBinTree(&binTree);
-
-                exit(1); 
-            } /*Else memory allocation error*/
-
-            /**********************************************************\
-            * Main Sec-7 Sub-4: Buld the consensus
-            \**********************************************************/
-
-             errUC  = 
-                 buildCon(
-                     clustOn,
-                     0,        /*Path to fasta file with reference*/
-                     threadsCStr, /*# threads to use with system calls*/
-                     &conSet,     /*settings for building a consensus*/
-                     &samStruct,  /*Will hold sam file data*/
-                     &refStruct,  /*For read median Q extraction*/
-                     &readToReadMinStats,
-                     &readToConMinStats
-            ); /*Builds a consensus using fastq file & best read*/
-
-            if(errUC & 16)
-                continue;
-                /*Unable to build consensus, let loop terminate*/
-
-            if(errUC & 64)
-            { /*If had a memory allocation error*/
-                logFILE = fopen(logFileCStr, "a");
-
-                fprintf(
-                    stderr,
-                    "Memory error in cluster step (main sec-7 sub-2)\n"
-                ); /*Let user know about memory issue*/
-
-                fprintf(
-                    logFILE,
-                    "Memory error in cluster step (main sec-7 sub-2)\n"
-                );
-
-                fclose(logFILE);
-                freeStackSamEntry(&samStruct);
-                freeStackSamEntry(&refStruct);
-
-                freeBinTree(&binTree);
-                exit(1); 
-            } /*If had a memory allocation error*/
-
-            /**********************************************************\
-            * Main Sec-7 Sub-5: Copy best read back to its oringal bin
-            * buildCon already did this
-            \**********************************************************/
-
-            /*++clustOn->numReadsULng;*/ /*Account for the best read*/
-            /*tmpFILE = fopen(clustOn->bestReadCStr, "r");
-            fqBinFILE = fopen(clustOn->fqPathCStr, "a");
-
-            while(fgets(
-                    refStruct.samEntryCStr,
-                    refStruct.lenBuffULng,
-                    tmpFILE
-                )*/ /*Read in file line*/
-            /*) fprintf(tmpFILE, "%s", refStruct.samEntryCStr);
-    
-            fclose(tmpFILE);
-            fclose(fqBinFILE);
-
-            remove(clustOn->bestReadCStr);*/
-                 /*Remove best read consensus*/
-
-            /**********************************************************\
-            * Main Sec-7 Sub-6: Bin reads to the consensus
-            \**********************************************************/
-
-            /*Copy the consensus name to the clusters bin*/
-            strcpy(tmpBin->consensusCStr, clustOn->consensusCStr);
-
-            if(skipClustBl & 1)
-            { /*If not clustering, move onto the next bin*/
-                lastClust->rightChild = tmpBin;
-                /*So can merge bins durning consensus comparisions*/
-                tmpBin->numReadsULng = lastClust->numReadsULng;
-                totalKeptReadsUL += tmpBin->numReadsULng;
-
-                strcpy(tmpBin->fqPathCStr, lastClust->fqPathCStr);
-                lastClust->fqPathCStr[0] = '\0';/*avoid deleting atEnd*/
-                tmpBin = 0;
-                break;        /*If not clusterin, move to next bin*/
-            } /*If not clustering, move onto the next bin*/
-
-            binReadToCon(
-                &conSet.clustUC,    /*Cluster on*/
-                clustOn,            /*Bin working on*/
-                tmpBin,             /*Bin to hold the cluster*/
-                &samStruct,         /*To hold temporary input*/
-                &readToConMinStats, /*Settings to keep read to con*/
-                threadsCStr         /*# threads to use with Minimap2*/
-            ); /*Find reads that mapp to the consensus*/
-
-            /*Find how many reads were kept in clustering*/
-            totalKeptReadsUL += tmpBin->numReadsULng;
-
-            /**********************************************************\
-            * Main Sec-7 Sub-7: Compare new consensus to old consensuses
-            \**********************************************************/
-
-            *clustOn->consensusCStr = '\0';
+        lastBin = clustOn; /*For reording the list*/
+        clustOn = clustOn->leftChild;
+    } /*While have bins to check*/
 
-            bestBin =
-                cmpCons(
-                    tmpBin,       /*Bin with consensus to compare*/
-                    clustOn,     /*Other clusters to comapre to*/
-                    &samStruct,  /*Struct to hold input from minimap2*/
-                    &refStruct,  /*Struct to hold input from minimap2*/
-                    &conToConMinStats, /*Cons to consensus thresholds*/
-                    threadsCStr  /*Number threads to use with Minimap2*/
-            ); /*Compares a consenses to other consensuses*/
+    /******************************************************************\
+    * Main Sec-7 Sub-3: Build the clusters for each bin
+    \******************************************************************/
 
-            /**********************************************************\
-            * Main Sec-7 Sub-8: Update list of clusters in bin
-            \**********************************************************/
+    errUC =
+        clustBins(
+            binTree,            /*Bins to build clusters for*/
+            binThreadsUI,       /*Number of bins to cluster at once*/
+            &conSet,            /*settings for building a consensus*/
+            &readToReadMinStats,
+            &readToConMinStats,
+            &conToConMinStats,
+            threadsCStr,        /*Split between the bins*/
+            skipClustBl,
+            &numKeptReadsUL
+    ); /*Build the consensus & clusters for each bin*/
+
+    totalKeptReadsUL += numKeptReadsUL;
+
+    /*The bin threads used their own sam buffers, but cmpCons in sec-8
+      expects refStruct to have a buffer*/
+    if(refStruct.samEntryCStr == 0)
+    { /*If refStruct has no buffer yet*/
+        refStruct.samEntryCStr = malloc(sizeof(char) * 1024);
+
+        if(refStruct.samEntryCStr == 0)
+            errUC = 64;
+        else
+            refStruct.lenBuffULng = 1024;
+    } /*If refStruct has no buffer yet*/
 
-            if(bestBin != 0)
-            { /*If the consensuses are to similar (the same?)*/
-                mergeBins(bestBin, tmpBin);
-                continue; /*This cluster is not worth keeping*/
-            } /*If the consensuses are to similar (the same?)*/
+    if(errUC & 64)
+    { /*If had a memory allocation error*/
+        logFILE = fopen(logFileCStr, "a");
 
-            /*else add this bin to the end of the list*/
-            lastClust->rightChild = tmpBin;
-            lastClust = tmpBin;
-            tmpBin = 0;
-            ++conSet.clustUC;
-        } /*While have reads to bin*/
+        fprintf(
+            stderr,
+            "Memory error in cluster step (main sec-7 sub-3)\n"
+        ); /*Let user know about memory issue*/
 
-        /**************************************************************\
-        * Main Sec-7 Sub-9: Add clusters to bin & move to next bin
-        \**************************************************************/
+        fprintf(
+            logFILE,
+            "Memory error in cluster step (main sec-7 sub-3)\n"
+        );
 
-        lastBin = clustOn; /*For reording the list*/
-        clustOn = clustOn->leftChild;
-    } /*While have reads to cluster*/
+        fclose(logFILE);
+        freeStackSamEntry(&samStruct);
+        freeStackSamEntry(&refStruct);
 
-    if(tmpBin != 0)
-        freeReadBin(&tmpBin); /*Make sure no loose ends*/
+        freeBinTree(&binTree);
+        exit(1); 
+    } /*If had a memory allocation error*/
 
     /*>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>
     ^ Main Sec-8: Compare all consensus to remove false positives
@@ -2235,6 +2124,7 @@ char * getUserInput(
     char **refsPathCStr, /*Holds path to references*/
     char **primPathCStr,/*Holds path to primer fasta file for trimming*/
     char *threadsCStr, /*Number threads for minimap2 & racon*/
+    uint32_t *binThreadsUI, /*Number of bins to cluster at once*/
     char *rmSupAlnBl,  /*1: Remove reads with supplemental alignments*/
     char *skipBinBl,   /*1: Skip the binning step, 0 do not*/
     char *skipClustBl, /*1: Skip the clusterin step, 0 do not*/
@@ -2298,6 +2188,9 @@ char * getUserInput(
         else if(strcmp(parmCStr, "-threads") == 0)
             strcpy(threadsCStr, inputCStr);
 
+        else if(strcmp(parmCStr, "-bin-threads") == 0)
+            cStrToUInt(inputCStr, binThreadsUI);
+
         else if(strcmp(parmCStr, "-skip-bin") == 0)
         { /*Else if skipping the binning step*/
             *skipBinBl = 1;
@@ -2337,6 +2230,12 @@ char * getUserInput(
         else if(strcmp(parmCStr, "-min-con-length") == 0)
             conSet->minConLenUI = strtoul(inputCStr, &tmpCStr, 10);
 
+        else if(strcmp(parmCStr, "-fq-index") == 0)
+        { /*Else if using a read id index for the bin fastqs*/
+            conSet->fqIdxBl = 1;
+            --intArg; /*Account for this being a true or false*/
+        } /*Else if using a read id index for the bin fastqs*/
+
         else if(strcmp(parmCStr, "-disable-majority-consensus") == 0)
         { /*Else if user is ussing the best read instead of consensus*/
             conSet->majConSet.useMajConBl = 0;
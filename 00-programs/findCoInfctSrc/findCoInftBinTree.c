@@ -9,6 +9,7 @@
 ######################################################################*/
 
 #include "findCoInftBinTree.h"
+#include "fqGetIdsIndex.h" /*Only for defFqIdxExt*/
 
 /*~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~\
 ' clustGraphBinTree SOF:
@@ -82,6 +83,8 @@ struct readBin * makeReadBin(
 
     /*Variables not set by function*/
     retBin->balUChar = '\0';
+    retBin->fqIdxBl = 0;
+    retBin->writeST = 0;
     retBin->numReadsULng = 1;  /*Their is only one read in this bin*/
     retBin->leftChild = 0;
     retBin->rightChild = 0;
@@ -941,6 +944,10 @@ void rmBinFromList(
 
     struct readBin
         *tmpBin = 0;
+
+    char
+        idxPathCStr[256 + sizeof(defFqIdxExt)]; /*fastq read id index*/
+
     /*some of these files will not always exists, but I want to make
       sure they are removed when they are. So, I am just going to 
       ignore the error. All files have been created by this program
@@ -948,6 +955,9 @@ void rmBinFromList(
 
     remove((*binToRm)->fqPathCStr);
     remove((*binToRm)->statPathCStr);
+
+    sprintf(idxPathCStr, "%s%s", (*binToRm)->fqPathCStr, defFqIdxExt);
+    remove(idxPathCStr);
     remove((*binToRm)->bestReadCStr);
     remove((*binToRm)->topReadsCStr);
     remove((*binToRm)->consensusCStr);
@@ -984,6 +994,13 @@ void binDeleteFiles(
     FILE
         *checkFILE = 0; /*Check if file exists*/
 
+    char
+        idxPathCStr[256 + sizeof(defFqIdxExt)]; /*fastq read id index*/
+
+    /*Remove the read id index of the fastq, if one was made*/
+    sprintf(idxPathCStr, "%s%s", binToWipe->fqPathCStr, defFqIdxExt);
+    remove(idxPathCStr);
+
     /*Check if the fastq file needs to be deleted*/
     checkFILE = fopen(binToWipe->fqPathCStr, "r");
 
@@ -1131,6 +1148,7 @@ void blankReadBin(
     binToBlank->rightChild = 0;
     binToBlank->leftChild = 0;
     binToBlank->balUChar = 0;
+    binToBlank->writeST = 0;
 
     return;
 } /*blankReadBin*/
@@ -34,9 +34,21 @@ typedef struct readBin
     int8_t
         balUChar;              /*Tells if the node is balanced*/
 
+    char
+        fqIdxBl;
+        /*1: Extract reads with a read id index of fqPathCStr
+        `    (fqPathCStr + defFqIdxExt, see fqGetIdsIndex.h)
+        */
+
     unsigned long
         numReadsULng;     /*Number of reads in this bin*/ 
 
+    struct binWriter
+        *writeST;
+        /*Open fastq/stats files while binning (see
+        `    findCoInftBinWrite.h); 0 when not open
+        */
+
     struct readBin
         *leftChild, 
         *rightChild;
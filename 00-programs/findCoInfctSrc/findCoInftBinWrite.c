@@ -0,0 +1,267 @@
+/*######################################################################
+# Name: findCoInftBinWrite
+# Use:
+#   o Holds the functions to keep a bins fastq and stats files open
+#     while binning reads.
+######################################################################*/
+
+#include "findCoInftBinWrite.h"
+
+/*~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~\
+' findCoInftBinWrite SOF:
+'   fun-1 initBinWriterList:
+'     o Sets up an empty binWriterList
+'   fun-2 getBinWriter:
+'     o Gets (opens if needed) the writer for a bin
+'   fun-3 closeBinWriter:
+'     o Flushes and closes one binWriter
+'   fun-4 closeAllBinWriters:
+'     o Flushes and closes every binWriter in a list
+\~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~*/
+
+/*---------------------------------------------------------------------\
+| Output:
+|   - Modifies:
+|     o listST to be an empty list that keeps at most maxOpenUI bins
+|       open (0 for defMaxOpenBins)
+\---------------------------------------------------------------------*/
+void initBinWriterList(
+    struct binWriterList *listST, /*List to set up*/
+    uint32_t maxOpenUI            /*Max bins to keep open*/
+) /*Sets up an empty binWriterList*/
+{ /*initBinWriterList*/
+
+    /*~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~\
+    ' Fun-1 TOC: Sec-1 Sub-1: initBinWriterList
+    \~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~*/
+
+    listST->headST = 0;
+    listST->tailST = 0;
+    listST->numOpenUI = 0;
+
+    if(maxOpenUI == 0)
+        listST->maxOpenUI = defMaxOpenBins;
+    else
+        listST->maxOpenUI = maxOpenUI;
+
+    return;
+} /*initBinWriterList*/
+
+/*---------------------------------------------------------------------\
+| Output:
+|   - Modifies:
+|     o binST->writeST to point to an open writer for binST
+|     o listST to have the writer at its head. The least recently used
+|       writer is closed if listST is full.
+|   - Returns:
+|     o 1 for success
+|     o 4 if could not open the stats file (binST->statPathCStr)
+|     o 8 if could not open the fastq file (binST->fqPathCStr)
+|     o 64 for a memory allocation error
+\---------------------------------------------------------------------*/
+uint8_t getBinWriter(
+    struct binWriterList *listST, /*List of open writers*/
+    struct readBin *binST         /*Bin to get the writer for*/
+) /*Gets (opens if needed) the writer for a bin*/
+{ /*getBinWriter*/
+
+    /*~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~\
+    ' Fun-2 TOC: getBinWriter
+    '   fun-2 sec-1: If the bin is open, move it to the list head
+    '   fun-2 sec-2: Close the least recently used bin if list is full
+    '   fun-2 sec-3: Open the bin files
+    '   fun-2 sec-4: Add the writer to the list head
+    \~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~*/
+
+    /*>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>\
+    ^ Fun-2 Sec-1: If the bin is open, move it to the list head
+    \<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<*/
+
+    struct binWriter *writerST = binST->writeST;
+
+    if(writerST != 0)
+    { /*If the bin is already open*/
+        if(writerST == listST->headST)
+            return 1; /*Most bins repeat, so this is the common case*/
+
+        /*Remove the writer from its spot in the list*/
+        writerST->prevST->nextST = writerST->nextST;
+
+        if(writerST->nextST != 0)
+            writerST->nextST->prevST = writerST->prevST;
+        else
+            listST->tailST = writerST->prevST;
+
+        /*Move the writer to the head of the list*/
+        writerST->prevST = 0;
+        writerST->nextST = listST->headST;
+        listST->headST->prevST = writerST;
+        listST->headST = writerST;
+
+        return 1;
+    } /*If the bin is already open*/
+
+    /*>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>\
+    ^ Fun-2 Sec-2: Close the least recently used bin if list is full
+    \<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<*/
+
+    if(listST->numOpenUI >= listST->maxOpenUI)
+    { /*If need to close a bin to open this bin*/
+        if(!(closeBinWriter(listST, listST->tailST) & 1))
+            return 8; /*Could not write out the old bin*/
+    } /*If need to close a bin to open this bin*/
+
+    /*>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>\
+    ^ Fun-2 Sec-3: Open the bin files
+    \<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<*/
+
+    writerST = calloc(1, sizeof(struct binWriter));
+
+    if(writerST == 0)
+        return 64;
+
+    writerST->fqBuffCStr = malloc(defBinBuffBytes);
+    writerST->statBuffCStr = malloc(defBinBuffBytes);
+
+    if(writerST->fqBuffCStr == 0 || writerST->statBuffCStr == 0)
+    { /*If had a memory error*/
+        free(writerST->fqBuffCStr);
+        free(writerST->statBuffCStr);
+        free(writerST);
+        return 64;
+    } /*If had a memory error*/
+
+    writerST->statFILE = fopen(binST->statPathCStr, "a");
+
+    if(writerST->statFILE == 0)
+    { /*If can not open the stats file*/
+        free(writerST->fqBuffCStr);
+        free(writerST->statBuffCStr);
+        free(writerST);
+        return 4;
+    } /*If can not open the stats file*/
+
+    writerST->fqFILE = fopen(binST->fqPathCStr, "a");
+
+    if(writerST->fqFILE == 0)
+    { /*If can not open the fastq file*/
+        fclose(writerST->statFILE);
+        free(writerST->fqBuffCStr);
+        free(writerST->statBuffCStr);
+        free(writerST);
+        return 8;
+    } /*If can not open the fastq file*/
+
+    setvbuf(writerST->fqFILE, writerST->fqBuffCStr, _IOFBF, defBinBuffBytes);
+
+    setvbuf(
+        writerST->statFILE,
+        writerST->statBuffCStr,
+        _IOFBF,
+        defBinBuffBytes
+    );
+
+    /*>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>\
+    ^ Fun-2 Sec-4: Add the writer to the list head
+    \<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<*/
+
+    writerST->binST = binST;
+    binST->writeST = writerST;
+
+    writerST->prevST = 0;
+    writerST->nextST = listST->headST;
+
+    if(listST->headST != 0)
+        listST->headST->prevST = writerST;
+    else
+        listST->tailST = writerST; /*First writer in the list*/
+
+    listST->headST = writerST;
+    ++listST->numOpenUI;
+
+    return 1;
+} /*getBinWriter*/
+
+/*---------------------------------------------------------------------\
+| Output:
+|   - Closes:
+|     o The fastq and stats files in writerST (flushes the buffers)
+|   - Frees:
+|     o writerST and sets writerST->binST->writeST to 0
+|   - Modifies:
+|     o listST to not have writerST
+|   - Returns:
+|     o 1 for success
+|     o 2 if a flush or close failed (such as a full disk)
+\---------------------------------------------------------------------*/
+uint8_t closeBinWriter(
+    struct binWriterList *listST, /*List with writerST*/
+    struct binWriter *writerST    /*Writer to close*/
+) /*Flushes and closes one binWriter*/
+{ /*closeBinWriter*/
+
+    /*~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~\
+    ' Fun-3 TOC: Sec-1 Sub-1: closeBinWriter
+    \~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~*/
+
+    uint8_t errUC = 1;
+
+    if(writerST == 0)
+        return 1;
+
+    /*Remove the writer from the list*/
+    if(writerST->prevST != 0)
+        writerST->prevST->nextST = writerST->nextST;
+    else
+        listST->headST = writerST->nextST;
+
+    if(writerST->nextST != 0)
+        writerST->nextST->prevST = writerST->prevST;
+    else
+        listST->tailST = writerST->prevST;
+
+    --listST->numOpenUI;
+
+    /*fclose flushes the buffers, so close before freeing them*/
+    if(fclose(writerST->fqFILE) != 0)
+        errUC = 2;
+
+    if(fclose(writerST->statFILE) != 0)
+        errUC = 2;
+
+    free(writerST->fqBuffCStr);
+    free(writerST->statBuffCStr);
+
+    writerST->binST->writeST = 0;
+    free(writerST);
+
+    return errUC;
+} /*closeBinWriter*/
+
+/*---------------------------------------------------------------------\
+| Output:
+|   - Closes:
+|     o Every writer in listST (see closeBinWriter)
+|   - Returns:
+|     o 1 for success
+|     o 2 if a flush or close failed (such as a full disk)
+\---------------------------------------------------------------------*/
+uint8_t closeAllBinWriters(
+    struct binWriterList *listST  /*List of writers to close*/
+) /*Flushes and closes every binWriter in a list*/
+{ /*closeAllBinWriters*/
+
+    /*~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~\
+    ' Fun-4 TOC: Sec-1 Sub-1: closeAllBinWriters
+    \~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~*/
+
+    uint8_t errUC = 1;
+
+    while(listST->headST != 0)
+    { /*Loop: Close each open bin*/
+        if(!(closeBinWriter(listST, listST->headST) & 1))
+            errUC = 2;
+    } /*Loop: Close each open bin*/
+
+    return errUC;
+} /*closeAllBinWriters*/
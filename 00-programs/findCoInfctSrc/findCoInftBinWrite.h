@@ -0,0 +1,132 @@
+/*######################################################################
+# Name: findCoInftBinWrite
+# Use:
+#   o Keeps the fastq and stats files for each bin open (with large
+#     buffers) while reads are binned, so binReads does not open and
+#     close two files for every read.
+#   o The writer for a bin is stored in readBin->writeST. Only the
+#     defMaxOpenBins most recently used bins are kept open. The least
+#     recently used bin is flushed and closed when a new bin needs to
+#     be opened. Closed bins are reopened in append mode.
+# Includes:
+#   - "findCoInftBinTree.h"
+#   o <stdlib.h>
+#   o <stdio.h>
+#   o <stdint.h>
+######################################################################*/
+
+#ifndef FINDCOINFTBINWRITE_H
+#define FINDCOINFTBINWRITE_H
+
+#include "findCoInftBinTree.h"
+
+/*~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~\
+' findCoInftBinWrite SOH:
+'   struct-1 binWriter:
+'     o Open fastq and stats files for one bin
+'   struct-2 binWriterList:
+'     o Least recently used list of open binWriters
+'   fun-1 initBinWriterList:
+'     o Sets up an empty binWriterList
+'   fun-2 getBinWriter:
+'     o Gets (opens if needed) the writer for a bin
+'   fun-3 closeBinWriter:
+'     o Flushes and closes one binWriter
+'   fun-4 closeAllBinWriters:
+'     o Flushes and closes every binWriter in a list
+\~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~*/
+
+#define defBinBuffBytes (1 << 16) /*64kb buffer for each open file*/
+#define defMaxOpenBins 64         /*Max bins open (two files a bin)*/
+
+/*######################################################################
+# Struct-1: binWriter
+# Use: Holds the open fastq and stats files for one bin. The files use
+#      the fqBuffCStr and statBuffCStr buffers (setvbuf), so reads are
+#      written in defBinBuffBytes blocks.
+######################################################################*/
+typedef struct binWriter
+{ /*binWriter*/
+    struct readBin *binST;  /*Bin that owns this writer*/
+
+    FILE *fqFILE;           /*Open bin fastq file*/
+    FILE *statFILE;         /*Open bin stats file*/
+
+    char *fqBuffCStr;       /*Buffer for fqFILE*/
+    char *statBuffCStr;     /*Buffer for statFILE*/
+
+    struct binWriter *prevST; /*Writer used more recently*/
+    struct binWriter *nextST; /*Writer used less recently*/
+}binWriter;
+
+/*######################################################################
+# Struct-2: binWriterList
+# Use: List of open binWriters. The head is the most recently used
+#      writer and the tail is the next writer to close.
+######################################################################*/
+typedef struct binWriterList
+{ /*binWriterList*/
+    struct binWriter *headST; /*Most recently used writer*/
+    struct binWriter *tailST; /*Least recently used writer*/
+    uint32_t numOpenUI;       /*Number of open writers*/
+    uint32_t maxOpenUI;       /*Max number of open writers*/
+}binWriterList;
+
+/*---------------------------------------------------------------------\
+| Output:
+|   - Modifies:
+|     o listST to be an empty list that keeps at most maxOpenUI bins
+|       open (0 for defMaxOpenBins)
+\---------------------------------------------------------------------*/
+void initBinWriterList(
+    struct binWriterList *listST, /*List to set up*/
+    uint32_t maxOpenUI            /*Max bins to keep open*/
+); /*Sets up an empty binWriterList*/
+
+/*---------------------------------------------------------------------\
+| Output:
+|   - Modifies:
+|     o binST->writeST to point to an open writer for binST
+|     o listST to have the writer at its head. The least recently used
+|       writer is closed if listST is full.
+|   - Returns:
+|     o 1 for success
+|     o 4 if could not open the stats file (binST->statPathCStr)
+|     o 8 if could not open the fastq file (binST->fqPathCStr)
+|     o 64 for a memory allocation error
+\---------------------------------------------------------------------*/
+uint8_t getBinWriter(
+    struct binWriterList *listST, /*List of open writers*/
+    struct readBin *binST         /*Bin to get the writer for*/
+); /*Gets (opens if needed) the writer for a bin*/
+
+/*---------------------------------------------------------------------\
+| Output:
+|   - Closes:
+|     o The fastq and stats files in writerST (flushes the buffers)
+|   - Frees:
+|     o writerST and sets writerST->binST->writeST to 0
+|   - Modifies:
+|     o listST to not have writerST
+|   - Returns:
+|     o 1 for success
+|     o 2 if a flush or close failed (such as a full disk)
+\---------------------------------------------------------------------*/
+uint8_t closeBinWriter(
+    struct binWriterList *listST, /*List with writerST*/
+    struct binWriter *writerST    /*Writer to close*/
+); /*Flushes and closes one binWriter*/
+
+/*---------------------------------------------------------------------\
+| Output:
+|   - Closes:
+|     o Every writer in listST (see closeBinWriter)
+|   - Returns:
+|     o 1 for success
+|     o 2 if a flush or close failed (such as a full disk)
+\---------------------------------------------------------------------*/
+uint8_t closeAllBinWriters(
+    struct binWriterList *listST  /*List of writers to close*/
+); /*Flushes and closes every binWriter in a list*/
+
+#endif
@@ -0,0 +1,429 @@
+/*######################################################################
+# Name: findCoInftClust
+# Use:
+#   o Holds the functions to build the clusters (consensuses) for each
+#     bin, one bin or several bins at a time.
+######################################################################*/
+
+#include "findCoInftClust.h"
+
+/*~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~\
+' findCoInftClust SOF:
+'   fun-1 clustBin:
+'     o Builds the clusters (consensuses) for one bin
+'   fun-2 clustBinThread:
+'     o Clusters bins from a clustBinSet until no bins are left
+'   fun-3 clustBins:
+'     o Clusters every bin in a bin list, several bins at once
+\~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~*/
+
+/*---------------------------------------------------------------------\
+| Output:
+|   - Modifies:
+|     o binST->rightChild to point to the list of clusters built for
+|       the bin
+|     o numKeptReadsUL to hold the number of reads kept in clusters
+|   - Returns:
+|     o 1 for success
+|     o 64 for a memory allocation error
+\---------------------------------------------------------------------*/
+uint8_t clustBin(
+    struct readBin *binST,         /*Bin to build clusters for*/
+    struct conBuildStruct *conSet, /*Settings for building consensus*/
+    struct samEntry *samST,        /*For reading sam files*/
+    struct samEntry *refST,        /*For reading sam files*/
+    struct minAlnStats *readToReadMinStats, /*Read pull settings*/
+    struct minAlnStats *readToConMinStats,  /*Read cluster settings*/
+    struct minAlnStats *conToConMinStats,   /*Consensus compare sets*/
+    char *threadsCStr,             /*Threads for minimap2 & racon*/
+    char skipClustBl,              /*1: Only build one consensus*/
+    unsigned long *numKeptReadsUL  /*Number reads kept in clusters*/
+) /*Builds the clusters (consensuses) for one bin*/
+{ /*clustBin*/
+
+    /*~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~\
+    ' Fun-1 TOC: clustBin
+    '   fun-1 sec-1: Variable declerations
+    '   fun-1 sec-2: Set up a readBin to hold the clusters files
+    '   fun-1 sec-3: Build the consensus
+    '   fun-1 sec-4: Bin reads to the consensus
+    '   fun-1 sec-5: Compare new consensus to the bins old consensuses
+    '   fun-1 sec-6: Update list of clusters in bin
+    \~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~*/
+
+    /*>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>\
+    ^ Fun-1 Sec-1: Variable declerations
+    \<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<*/
+
+    uint8_t errUC = 0;
+
+    struct readBin *lastClust = binST; /*End of the cluster list*/
+    struct readBin *tmpBin = 0;        /*Cluster being built*/
+    struct readBin *bestBin = 0;       /*Cluster tmpBin is similar to*/
+
+    conSet->clustUC = 0;
+    *numKeptReadsUL = 0;
+
+    while(binST->numReadsULng >= conSet->minReadsToBuildConUL)
+    { /*While have reads to bin*/
+
+        /*>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>\
+        ^ Fun-1 Sec-2: Set up a readBin to hold the clusters files
+        \<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<*/
+
+        if(tmpBin == 0)
+            tmpBin = malloc(sizeof(struct readBin));
+
+        if(tmpBin == 0)
+            return 64;
+
+        blankReadBin(tmpBin);
+        tmpBin->balUChar = 1; /*To mark keeping*/
+
+        /*>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>\
+        ^ Fun-1 Sec-3: Build the consensus
+        \<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<*/
+
+        errUC  =
+            buildCon(
+                binST,
+                0,           /*Path to fasta file with reference*/
+                threadsCStr, /*# threads to use with system calls*/
+                conSet,      /*settings for building a consensus*/
+                samST,       /*Will hold sam file data*/
+                refST,       /*For read median Q extraction*/
+                readToReadMinStats,
+                readToConMinStats
+        ); /*Builds a consensus using fastq file & best read*/
+
+        if(errUC & 16)
+            continue;
+            /*Unable to build consensus, let loop terminate*/
+
+        if(errUC & 64)
+        { /*If had a memory allocation error*/
+            freeReadBin(&tmpBin);
+            return 64;
+        } /*If had a memory allocation error*/
+
+        /*>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>\
+        ^ Fun-1 Sec-4: Bin reads to the consensus
+        \<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<*/
+
+        /*Copy the consensus name to the clusters bin*/
+        strcpy(tmpBin->consensusCStr, binST->consensusCStr);
+
+        if(skipClustBl & 1)
+        { /*If not clustering, move onto the next bin*/
+            lastClust->rightChild = tmpBin;
+            /*So can merge bins durning consensus comparisions*/
+            tmpBin->numReadsULng = lastClust->numReadsULng;
+            *numKeptReadsUL += tmpBin->numReadsULng;
+
+            strcpy(tmpBin->fqPathCStr, lastClust->fqPathCStr);
+            lastClust->fqPathCStr[0] = '\0'; /*avoid deleting atEnd*/
+            return 1;
+        } /*If not clustering, move onto the next bin*/
+
+        binReadToCon(
+            &conSet->clustUC,  /*Cluster on*/
+            binST,             /*Bin working on*/
+            tmpBin,            /*Bin to hold the cluster*/
+            samST,             /*To hold temporary input*/
+            readToConMinStats, /*Settings to keep read to con*/
+            threadsCStr        /*# threads to use with Minimap2*/
+        ); /*Find reads that mapp to the consensus*/
+
+        /*Find how many reads were kept in clustering*/
+        *numKeptReadsUL += tmpBin->numReadsULng;
+
+        /*>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>\
+        ^ Fun-1 Sec-5: Compare new consensus to the bins old consensuses
+        \<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<*/
+
+        *binST->consensusCStr = '\0';
+
+        bestBin =
+            cmpCons(
+                tmpBin,           /*Bin with consensus to compare*/
+                binST,            /*Other clusters to comapre to*/
+                samST,            /*Struct to hold input from minimap2*/
+                refST,            /*Struct to hold input from minimap2*/
+                conToConMinStats, /*Cons to consensus thresholds*/
+                threadsCStr       /*Number threads to use with Minimap2*/
+        ); /*Compares a consenses to other consensuses*/
+
+        /*>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>\
+        ^ Fun-1 Sec-6: Update list of clusters in bin
+        \<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<*/
+
+        if(bestBin != 0)
+        { /*If the consensuses are to similar (the same?)*/
+            mergeBins(bestBin, tmpBin);
+            continue; /*This cluster is not worth keeping*/
+        } /*If the consensuses are to similar (the same?)*/
+
+        /*else add this bin to the end of the list*/
+        lastClust->rightChild = tmpBin;
+        lastClust = tmpBin;
+        tmpBin = 0;
+        ++conSet->clustUC;
+    } /*While have reads to bin*/
+
+    if(tmpBin != 0)
+        freeReadBin(&tmpBin); /*Make sure no loose ends*/
+
+    return 1;
+} /*clustBin*/
+
+/*---------------------------------------------------------------------\
+| Output:
+|   - Modifies:
+|     o Each clustBinJob the thread takes from setPtr (see clustBin)
+|   - Returns:
+|     o 0 (pthread return value is not used)
+\---------------------------------------------------------------------*/
+void * clustBinThread(
+    void *setPtr  /*clustBinSet struct with the bins to cluster*/
+) /*Clusters bins from a clustBinSet until no bins are left*/
+{ /*clustBinThread*/
+
+    /*~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~\
+    ' Fun-2 TOC: clustBinThread
+    '   fun-2 sec-1: Variable declerations and set up this threads copy
+    '   fun-2 sec-2: Cluster bins until no bins are left
+    '   fun-2 sec-3: Clean up
+    \~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~*/
+
+    /*>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>\
+    ^ Fun-2 Sec-1: Variable declerations and set up this threads copy
+    \<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<*/
+
+    struct clustBinSet *setST = (struct clustBinSet *) setPtr;
+    struct clustBinJob *jobST = 0;
+    uint32_t jobUI = 0;
+
+    /*buildCon changes the consensus length and cluster number in
+      conSet, so each thread needs its own copy*/
+    struct conBuildStruct conSet = *setST->conSet;
+    struct samEntry samST;
+    struct samEntry refST;
+
+    initSamEntry(&samST);
+    initSamEntry(&refST);
+
+    /*cmpCons expects refST to have a buffer (same size readSamLine
+      starts with)*/
+    samST.samEntryCStr = malloc(sizeof(char) * 1024);
+    refST.samEntryCStr = malloc(sizeof(char) * 1024);
+
+    if(samST.samEntryCStr != 0)
+        samST.lenBuffULng = 1024;
+
+    if(refST.samEntryCStr != 0)
+        refST.lenBuffULng = 1024;
+
+    /*>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>\
+    ^ Fun-2 Sec-2: Cluster bins until no bins are left
+    \<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<*/
+
+    while(1)
+    { /*Loop: Cluster bins*/
+        pthread_mutex_lock(&setST->jobMutex);
+        jobUI = setST->nextJobUI;
+        ++setST->nextJobUI;
+        pthread_mutex_unlock(&setST->jobMutex);
+
+        if(jobUI >= setST->numJobsUI)
+            break; /*No bins left*/
+
+        jobST = &setST->jobAryST[jobUI];
+
+        if(samST.samEntryCStr == 0 || refST.samEntryCStr == 0)
+        { /*If could not set up the sam buffers*/
+            jobST->errUC = 64;
+            continue;
+        } /*If could not set up the sam buffers*/
+
+        jobST->errUC =
+            clustBin(
+                jobST->binST,
+                &conSet,
+                &samST,
+                &refST,
+                setST->readToReadMinStats,
+                setST->readToConMinStats,
+                setST->conToConMinStats,
+                setST->threadsCStr,
+                setST->skipClustBl,
+                &jobST->numKeptReadsUL
+        ); /*Build the clusters for this bin*/
+    } /*Loop: Cluster bins*/
+
+    /*>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>\
+    ^ Fun-2 Sec-3: Clean up
+    \<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<*/
+
+    freeStackSamEntry(&samST);
+    freeStackSamEntry(&refST);
+
+    return 0;
+} /*clustBinThread*/
+
+/*---------------------------------------------------------------------\
+| Output:
+|   - Modifies:
+|     o Each bin in binList to have its clusters (see clustBin)
+|     o numKeptReadsUL to hold the number of reads kept in clusters
+|   - Returns:
+|     o 1 for success
+|     o 64 for a memory allocation error
+| Note:
+|   - The bins are clustered in list order with one bin thread, and
+|     the read counts are summed in list order, so the output is the
+|     same for any number of bin threads.
+\---------------------------------------------------------------------*/
+uint8_t clustBins(
+    struct readBin *binList,       /*List of bins (leftChild is next)*/
+    uint32_t numBinThreadsUI,      /*Number of bins to cluster at once*/
+    struct conBuildStruct *conSet, /*Settings for building consensus*/
+    struct minAlnStats *readToReadMinStats, /*Read pull settings*/
+    struct minAlnStats *readToConMinStats,  /*Read cluster settings*/
+    struct minAlnStats *conToConMinStats,   /*Consensus compare sets*/
+    char *threadsCStr,             /*Total threads to use*/
+    char skipClustBl,              /*1: Only build one consensus*/
+    unsigned long *numKeptReadsUL  /*Number reads kept in clusters*/
+) /*Clusters every bin in a bin list, several bins at once*/
+{ /*clustBins*/
+
+    /*~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~\
+    ' Fun-3 TOC: clustBins
+    '   fun-3 sec-1: Variable declerations
+    '   fun-3 sec-2: Make a job for each bin & take bins off the list
+    '   fun-3 sec-3: Split the threads between the bins
+    '   fun-3 sec-4: Cluster the bins
+    '   fun-3 sec-5: Put the bins back in the list & sum the read counts
+    \~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~*/
+
+    /*>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>\
+    ^ Fun-3 Sec-1: Variable declerations
+    \<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<*/
+
+    uint8_t errUC = 1;
+    uint32_t numJobsUI = 0;
+    uint32_t numThreadsUI = 0;
+    uint32_t threadUI = 0;
+    char toolThreadsCStr[16]; /*Threads for each minimap2/racon call*/
+
+    struct readBin *binOn = binList;
+    struct clustBinSet setST;
+    pthread_t *threadAry = 0;
+
+    *numKeptReadsUL = 0;
+
+    /*>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>\
+    ^ Fun-3 Sec-2: Make a job for each bin & take bins off the list
+    \<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<*/
+
+    for(binOn = binList; binOn != 0; binOn = binOn->leftChild)
+        ++numJobsUI;
+
+    if(numJobsUI == 0)
+        return 1;
+
+    setST.jobAryST = calloc(numJobsUI, sizeof(struct clustBinJob));
+
+    if(setST.jobAryST == 0)
+        return 64;
+
+    binOn = binList;
+
+    for(uint32_t jobUI = 0; jobUI < numJobsUI; ++jobUI)
+    { /*Loop: Make a job for each bin*/
+        setST.jobAryST[jobUI].binST = binOn;
+        setST.jobAryST[jobUI].nextBinST = binOn->leftChild;
+        setST.jobAryST[jobUI].errUC = 1;
+
+        /*cmpCons compares a new cluster to every cluster in the later
+          bins, which have no clusters yet when one bin is clustered at
+          a time. Taking the bin off the list keeps this true when other
+          threads are adding clusters to the later bins*/
+        binOn = binOn->leftChild;
+        setST.jobAryST[jobUI].binST->leftChild = 0;
+    } /*Loop: Make a job for each bin*/
+
+    /*>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>\
+    ^ Fun-3 Sec-3: Split the threads between the bins
+    \<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<*/
+
+    if(numBinThreadsUI < 1)
+        numBinThreadsUI = 1;
+
+    if(numBinThreadsUI > numJobsUI)
+        numBinThreadsUI = numJobsUI; /*Give spare threads to the tools*/
+
+    numThreadsUI = 0;
+    cStrToUInt(threadsCStr, &numThreadsUI);
+    numThreadsUI /= numBinThreadsUI;
+
+    if(numThreadsUI < 1)
+        numThreadsUI = 1;
+
+    if(numBinThreadsUI > 1)
+        sprintf(toolThreadsCStr, "%u", numThreadsUI);
+    else
+        strcpy(toolThreadsCStr, threadsCStr); /*Same as user input*/
+
+    setST.numJobsUI = numJobsUI;
+    setST.nextJobUI = 0;
+    pthread_mutex_init(&setST.jobMutex, 0);
+
+    setST.conSet = conSet;
+    setST.readToReadMinStats = readToReadMinStats;
+    setST.readToConMinStats = readToConMinStats;
+    setST.conToConMinStats = conToConMinStats;
+    setST.threadsCStr = toolThreadsCStr;
+    setST.skipClustBl = skipClustBl;
+
+    /*>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>\
+    ^ Fun-3 Sec-4: Cluster the bins
+    \<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<*/
+
+    if(numBinThreadsUI > 1)
+        threadAry = malloc(sizeof(pthread_t) * (numBinThreadsUI - 1));
+
+    if(threadAry == 0)
+        numBinThreadsUI = 1; /*Memory error or one bin at a time*/
+
+    for(threadUI = 0; threadUI < numBinThreadsUI - 1; ++threadUI)
+    { /*Loop: Start the bin threads*/
+        if(pthread_create(&threadAry[threadUI],0,clustBinThread,&setST))
+            break; /*Could not start the thread, use what I have*/
+    } /*Loop: Start the bin threads*/
+
+    clustBinThread(&setST); /*This thread does bins as well*/
+
+    for(uint32_t joinUI = 0; joinUI < threadUI; ++joinUI)
+        pthread_join(threadAry[joinUI], 0);
+
+    free(threadAry);
+    pthread_mutex_destroy(&setST.jobMutex);
+
+    /*>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>\
+    ^ Fun-3 Sec-5: Put the bins back in the list & sum the read counts
+    \<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<*/
+
+    for(uint32_t jobUI = 0; jobUI < numJobsUI; ++jobUI)
+    { /*Loop: Relink the bins in list order*/
+        setST.jobAryST[jobUI].binST->leftChild =
+            setST.jobAryST[jobUI].nextBinST;
+
+        *numKeptReadsUL += setST.jobAryST[jobUI].numKeptReadsUL;
+
+        if(!(setST.jobAryST[jobUI].errUC & 1))
+            errUC = setST.jobAryST[jobUI].errUC;
+    } /*Loop: Relink the bins in list order*/
+
+    free(setST.jobAryST);
+    return errUC;
+} /*clustBins*/
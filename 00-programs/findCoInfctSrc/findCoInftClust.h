@@ -0,0 +1,135 @@
+/*######################################################################
+# Name: findCoInftClust
+# Use:
+#   o Builds the clusters (consensuses) for each bin after the reads
+#     are binned to the references (findCoInft main sec-7).
+#   o Each bin is independent, so clustBins can work on several bins
+#     at once (-bin-threads). The -threads are split between the bins,
+#     so each minimap2/racon/medaka call gets threads / bin-threads.
+# Includes:
+#   - "buildConFun.h"
+#   - "binReadsFun.h"
+#   - <pthread.h>
+#   o "defaultSettings.h"
+#   o "findCoInftBinTree.h"
+#   o "samEntryStruct.h"
+#   o <stdlib.h>
+#   o <stdio.h>
+#   o <stdint.h>
+######################################################################*/
+
+#ifndef FINDCOINFTCLUST_H
+#define FINDCOINFTCLUST_H
+
+#include <pthread.h>
+#include "buildConFun.h"
+#include "binReadsFun.h"
+
+/*~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~\
+' findCoInftClust SOH:
+'   struct-1 clustBinJob:
+'     o One bin to cluster and the results of clustering it
+'   struct-2 clustBinSet:
+'     o Settings and jobs shared by the bin threads
+'   fun-1 clustBin:
+'     o Builds the clusters (consensuses) for one bin
+'   fun-2 clustBinThread:
+'     o Clusters bins from a clustBinSet until no bins are left
+'   fun-3 clustBins:
+'     o Clusters every bin in a bin list, several bins at once
+\~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~*/
+
+/*######################################################################
+# Struct-1: clustBinJob
+# Use: Holds one bin to cluster. The bin is taken off the bin list
+#      (nextBinST) while it is clustered, so cmpCons only compares the
+#      bins clusters to each other.
+######################################################################*/
+typedef struct clustBinJob
+{ /*clustBinJob*/
+    struct readBin *binST;       /*Bin to cluster*/
+    struct readBin *nextBinST;   /*binST->leftChild in the bin list*/
+    unsigned long numKeptReadsUL;/*Reads kept in binST's clusters*/
+    uint8_t errUC;               /*Return value of clustBin*/
+}clustBinJob;
+
+/*######################################################################
+# Struct-2: clustBinSet
+# Use: Holds the jobs and settings shared by every bin thread. Each
+#      thread uses its own copy of conSet and its own samEntry structs.
+######################################################################*/
+typedef struct clustBinSet
+{ /*clustBinSet*/
+    struct clustBinJob *jobAryST; /*Bins to cluster*/
+    uint32_t numJobsUI;           /*Number of bins in jobAryST*/
+    uint32_t nextJobUI;           /*Next bin to hand out*/
+    pthread_mutex_t jobMutex;     /*Locks nextJobUI*/
+
+    struct conBuildStruct *conSet;          /*Consensus settings*/
+    struct minAlnStats *readToReadMinStats; /*Read pull settings*/
+    struct minAlnStats *readToConMinStats;  /*Read cluster settings*/
+    struct minAlnStats *conToConMinStats;   /*Consensus compare sets*/
+    char *threadsCStr;  /*Threads for each minimap2/racon call*/
+    char skipClustBl;   /*1: Only build one consensus per bin*/
+}clustBinSet;
+
+/*---------------------------------------------------------------------\
+| Output:
+|   - Modifies:
+|     o binST->rightChild to point to the list of clusters built for
+|       the bin
+|     o numKeptReadsUL to hold the number of reads kept in clusters
+|   - Returns:
+|     o 1 for success
+|     o 64 for a memory allocation error
+\---------------------------------------------------------------------*/
+uint8_t clustBin(
+    struct readBin *binST,         /*Bin to build clusters for*/
+    struct conBuildStruct *conSet, /*Settings for building consensus*/
+    struct samEntry *samST,        /*For reading sam files*/
+    struct samEntry *refST,        /*For reading sam files*/
+    struct minAlnStats *readToReadMinStats, /*Read pull settings*/
+    struct minAlnStats *readToConMinStats,  /*Read cluster settings*/
+    struct minAlnStats *conToConMinStats,   /*Consensus compare sets*/
+    char *threadsCStr,             /*Threads for minimap2 & racon*/
+    char skipClustBl,              /*1: Only build one consensus*/
+    unsigned long *numKeptReadsUL  /*Number reads kept in clusters*/
+); /*Builds the clusters (consensuses) for one bin*/
+
+/*---------------------------------------------------------------------\
+| Output:
+|   - Modifies:
+|     o Each clustBinJob the thread takes from setPtr (see clustBin)
+|   - Returns:
+|     o 0 (pthread return value is not used)
+\---------------------------------------------------------------------*/
+void * clustBinThread(
+    void *setPtr  /*clustBinSet struct with the bins to cluster*/
+); /*Clusters bins from a clustBinSet until no bins are left*/
+
+/*---------------------------------------------------------------------\
+| Output:
+|   - Modifies:
+|     o Each bin in binList to have its clusters (see clustBin)
+|     o numKeptReadsUL to hold the number of reads kept in clusters
+|   - Returns:
+|     o 1 for success
+|     o 64 for a memory allocation error
+| Note:
+|   - The bins are clustered in list order with one bin thread, and
+|     the read counts are summed in list order, so the output is the
+|     same for any number of bin threads.
+\---------------------------------------------------------------------*/
+uint8_t clustBins(
+    struct readBin *binList,       /*List of bins (leftChild is next)*/
+    uint32_t numBinThreadsUI,      /*Number of bins to cluster at once*/
+    struct conBuildStruct *conSet, /*Settings for building consensus*/
+    struct minAlnStats *readToReadMinStats, /*Read pull settings*/
+    struct minAlnStats *readToConMinStats,  /*Read cluster settings*/
+    struct minAlnStats *conToConMinStats,   /*Consensus compare sets*/
+    char *threadsCStr,             /*Total threads to use*/
+    char skipClustBl,              /*1: Only build one consensus*/
+    unsigned long *numKeptReadsUL  /*Number reads kept in clusters*/
+); /*Clusters every bin in a bin list, several bins at once*/
+
+#endif
@@ -0,0 +1,1574 @@
+/*######################################################################
+# Name: findCoInftSamMap
+# Use:
+#   o Holds the functions to map reads to a reference with minimap2,
+#     either with popen (default) or in process with libminimap2
+#     (-DLIBMINIMAP2).
+######################################################################*/
+
+#include "findCoInftSamMap.h"
+
+/*~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~\
+' findCoInftSamMap SOF:
+'   fun-1 openSamMapper:
+'     o Starts mapping a query file to a reference file
+'   fun-2 readSamMapper:
+'     o Reads the next sam header or alignment into a samEntry
+'   fun-3 closeSamMapper:
+'     o Stops mapping and frees the samMapper variables
+'   fun-4 freeSamMapIdx:
+'     o Frees the kept reference indexes (libminimap2 only)
+'   libminimap2 only (static):
+'   fun-5 hashSamMapFile:
+'     o Gets the length and a hash of a files contents
+'   fun-6 getSamMapIdx:
+'     o Gets a kept index or indexes the reference
+'   fun-7 releaseSamMapIdx:
+'     o Marks a mapper as no longer using an index
+'   fun-8 getSamMapLine:
+'     o Reads one full line from the query file
+'   fun-9 readSamMapQry:
+'     o Reads one fasta or fastq entry from the query file
+'   fun-10 samMapThread:
+'     o Maps every numThreadsI query in a batch (thread function)
+'   fun-11 loadSamMapBatch:
+'     o Reads in and maps the next batch of queries
+'   fun-12 growSamEntryBuff:
+'     o Makes sure a samEntry can hold a line of a set length
+'   fun-13 samMapAlnToSam:
+'     o Converts one alignment to a samEntry
+'   fun-14 samMapUnmapToSam:
+'     o Converts an unmapped query to a samEntry
+'   fun-15 findKeptMapIdx:
+'     o Finds the kept index made from a reference (mutex held)
+\~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~*/
+
+#ifdef LIBMINIMAP2
+
+/*Reference indexes kept between openSamMapper calls. Each bin thread
+  maps to its own reference, so several indexes are kept. When all
+  defMapIdxKeep slots are in use, the new index is owned by its mapper
+  and freed when it is closed*/
+typedef struct samMapIdx
+{ /*samMapIdx*/
+    char *pathCStr;       /*File the index was made from*/
+    uint64_t lenFileUL;   /*Length of the file*/
+    uint64_t hashUL;      /*Hash of the file contents*/
+    mm_idx_t *idxST;      /*Minimizer index*/
+    uint32_t numUsersUI;  /*Number of open mappers using idxST*/
+    uint64_t lastUseUL;   /*keptMapIdxUseUL when last opened*/
+    char keptBl;          /*1: This is a kept index*/
+}samMapIdx;
+
+/*Only the lookups and slot changes are locked; indexing is not*/
+static struct samMapIdx *keptMapIdxAryST[defMapIdxKeep];
+static uint64_t keptMapIdxUseUL = 0; /*For finding the oldest index*/
+static pthread_mutex_t keptMapIdxMutex = PTHREAD_MUTEX_INITIALIZER;
+
+/*Settings for libminimap2 (same as minimap2CMD)*/
+static mm_idxopt_t samMapIdxOptST;
+static mm_mapopt_t samMapOptST;
+static char samMapOptSetBl = 0;
+
+/*Holds the mapper and thread number for samMapThread*/
+typedef struct samMapThreadArg
+{ /*samMapThreadArg*/
+    struct samMapper *mapST;
+    int threadI;
+}samMapThreadArg;
+
+static uint8_t hashSamMapFile(char *, uint64_t *, uint64_t *);
+static struct samMapIdx * getSamMapIdx(char *, int, uint8_t *);
+static void releaseSamMapIdx(struct samMapIdx *);
+static uint8_t getSamMapLine(struct samMapper *, uint32_t *);
+static uint8_t readSamMapQry(struct samMapper *, struct samMapQry *);
+static void * samMapThread(void *);
+static uint8_t loadSamMapBatch(struct samMapper *);
+static uint8_t growSamEntryBuff(struct samEntry *, uint64_t);
+static struct samMapIdx * findKeptMapIdx(char *, uint64_t, uint64_t);
+
+static uint8_t samMapAlnToSam(
+    struct samEntry *,
+    struct samMapper *,
+    struct samMapQry *,
+    mm_reg1_t *
+);
+
+static uint8_t samMapUnmapToSam(struct samEntry *, struct samMapQry *);
+
+#endif
+
+/*---------------------------------------------------------------------\
+| Output:
+|   - Modifies:
+|     o mapST to be ready for readSamMapper
+|   - Returns:
+|     o 1 for success
+|     o 2 if minimap2 could not be run or the reference/query files
+|       could not be opened
+|     o 64 for a memory allocation error
+\---------------------------------------------------------------------*/
+uint8_t openSamMapper(
+    char *refPathCStr,        /*Reference to map to (fasta/fastq)*/
+    char *qryPathCStr,        /*Sequences to map (fasta/fastq)*/
+    char *threadsCStr,        /*Number of threads to use*/
+    struct samMapper *mapST   /*Set up to map qryPathCStr*/
+) /*Starts mapping a query file to a reference file*/
+{ /*openSamMapper*/
+
+    /*~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~\
+    ' Fun-1 TOC: openSamMapper
+    '   fun-1 sec-1: Variable declerations
+    '   fun-1 sec-2: Set up libminimap2 (if compiled with libminimap2)
+    '   fun-1 sec-3: Run minimap2 with popen
+    \~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~*/
+
+    /*>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>\
+    ^ Fun-1 Sec-1: Variable declerations
+    \<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<*/
+
+    char minimap2CmdCStr[2048];
+    char *tmpCStr = 0;
+
+    #ifdef LIBMINIMAP2
+       uint8_t errUC = 0;
+       uint32_t numThreadsUI = 0;
+    #endif
+
+    memset(mapST, 0, sizeof(struct samMapper));
+
+    /*>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>\
+    ^ Fun-1 Sec-2: Set up libminimap2 (if compiled with libminimap2)
+    \<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<*/
+
+    #ifdef LIBMINIMAP2
+       cStrToUInt(threadsCStr, &numThreadsUI);
+       mapST->numThreadsI = numThreadsUI < 1 ? 1 : (int) numThreadsUI;
+
+       mapST->idxST =
+           getSamMapIdx(refPathCStr, mapST->numThreadsI, &errUC);
+
+       if(mapST->idxST == 0)
+       { /*If could not index the reference*/
+           if(errUC != 4)
+               return errUC;  /*Not a multi-part index*/
+
+           goto samMapPopen; /*Reference to big for one index*/
+       } /*If could not index the reference*/
+
+       mapST->mapOptST = samMapOptST;
+       mm_mapopt_update(&mapST->mapOptST, mapST->idxST->idxST);
+
+       mapST->qryFILE = gzopen(qryPathCStr, "r");
+
+       if(mapST->qryFILE == 0)
+       { /*If could not open the query file*/
+           closeSamMapper(mapST);
+           return 2;
+       } /*If could not open the query file*/
+
+       mapST->qryAryST = calloc(defMapBatch, sizeof(struct samMapQry));
+
+       mapST->tBuffAryST =
+           calloc(mapST->numThreadsI, sizeof(mm_tbuf_t *));
+
+       if(mapST->qryAryST == 0 || mapST->tBuffAryST == 0)
+       { /*If had a memory error*/
+           closeSamMapper(mapST);
+           return 64;
+       } /*If had a memory error*/
+
+       for(int iThread = 0; iThread < mapST->numThreadsI; ++iThread)
+       { /*Loop: Set up the thread buffers*/
+           mapST->tBuffAryST[iThread] = mm_tbuf_init();
+
+           if(mapST->tBuffAryST[iThread] == 0)
+           { /*If had a memory error*/
+               closeSamMapper(mapST);
+               return 64;
+           } /*If had a memory error*/
+       } /*Loop: Set up the thread buffers*/
+
+       return 1;
+
+       samMapPopen:
+    #endif
+
+    /*>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>\
+    ^ Fun-1 Sec-3: Run minimap2 with popen
+    \<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<*/
+
+    tmpCStr = cStrCpInvsDelm(minimap2CmdCStr, minimap2CMD);
+    tmpCStr = cpParmAndArg(tmpCStr, "-t", threadsCStr);
+    cpParmAndArg(tmpCStr, refPathCStr, qryPathCStr);
+
+    mapST->samFILE = popen(minimap2CmdCStr, "r");
+
+    if(mapST->samFILE == 0)
+        return 2;
+
+    return 1;
+} /*openSamMapper*/
+
+/*---------------------------------------------------------------------\
+| Output:
+|   - Modifies:
+|     o samST to hold the next header or alignment. The header lines
+|       (@SQ and @PG) come first, then one line for each primary or
+|       supplemental alignment or unmapped query. Secondary
+|       alignments are not output.
+|   - Returns:
+|     o 1 if succeded
+|     o 2 if end of file (no more alignments)
+|     o 64 if memory allocation error
+\---------------------------------------------------------------------*/
+uint8_t readSamMapper(
+    struct samEntry *samST,   /*Gets the next sam entry*/
+    struct samMapper *mapST   /*Mapping to get entry from*/
+) /*Reads the next sam header or alignment into a samEntry*/
+{ /*readSamMapper*/
+
+    /*~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~\
+    ' Fun-2 TOC: readSamMapper
+    '   fun-2 sec-1: Read from minimap2 (popen path)
+    '   fun-2 sec-2: Print the header lines
+    '   fun-2 sec-3: Print the next alignment
+    \~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~*/
+
+    /*>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>\
+    ^ Fun-2 Sec-1: Read from minimap2 (popen path)
+    \<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<*/
+
+    if(mapST->samFILE != 0)
+        return readSamLine(samST, mapST->samFILE);
+
+    #ifdef LIBMINIMAP2
+    { /*libminimap2 block*/
+       struct samMapQry *qryST = 0;
+       mm_reg1_t *alnST = 0;
+       mm_idx_t *idxST = 0;
+       uint8_t errUC = 0;
+
+       if(mapST->idxST == 0)
+           return 2; /*Mapper was never opened*/
+
+       idxST = mapST->idxST->idxST;
+
+       /*>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>\
+       ^ Fun-2 Sec-2: Print the header lines
+       \<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<*/
+
+       if(mapST->onHeadUI <= idxST->n_seq)
+       { /*If printing a header line*/
+           if(mapST->onHeadUI < idxST->n_seq)
+           { /*If printing the reference (@SQ) headers*/
+               if(!(
+                  growSamEntryBuff(
+                      samST,
+                      strlen(idxST->seq[mapST->onHeadUI].name) + 64
+                  ) & 1
+               )) return 64;
+
+               sprintf(
+                   samST->samEntryCStr,
+                   "@SQ\tSN:%s\tLN:%u\n",
+                   idxST->seq[mapST->onHeadUI].name,
+                   idxST->seq[mapST->onHeadUI].len
+               );
+           } /*If printing the reference (@SQ) headers*/
+
+           else
+           { /*Else printing the program (@PG) header*/
+               if(!(growSamEntryBuff(samST, 128) & 1))
+                   return 64;
+
+               sprintf(
+                   samST->samEntryCStr,
+                   "@PG\tID:minimap2\tPN:minimap2\tVN:%s\n",
+                   MM_VERSION
+               );
+           } /*Else printing the program (@PG) header*/
+
+           ++mapST->onHeadUI;
+
+           /*Header lines have no alignment (same as processSamEntry)*/
+           samST->queryCStr = 0;
+           samST->refCStr = 0;
+           samST->cigarCStr = 0;
+           samST->seqCStr = 0;
+           samST->qCStr = 0;
+           samST->mapqUChar = 0;
+           samST->flagUSht = 0;
+           return 1;
+       } /*If printing a header line*/
+
+       /*>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>\
+       ^ Fun-2 Sec-3: Print the next alignment
+       \<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<*/
+
+       while(1)
+       { /*Loop: Find the next alignment to print*/
+           if(mapST->onQryUI >= mapST->numQryUI)
+           { /*If need to map the next batch of queries*/
+               if(mapST->eofBl)
+                   return 2;
+
+               errUC = loadSamMapBatch(mapST);
+
+               if(errUC & 64)
+                   return 64;
+
+               if(!(errUC & 1) || mapST->numQryUI == 0)
+                   return 2; /*End of file or invalid query file*/
+           } /*If need to map the next batch of queries*/
+
+           qryST = &mapST->qryAryST[mapST->onQryUI];
+
+           if(qryST->numAlnI == 0 && mapST->onAlnI == 0)
+           { /*If the query did not map*/
+               ++mapST->onAlnI;
+               return samMapUnmapToSam(samST, qryST);
+           } /*If the query did not map*/
+
+           while(mapST->onAlnI < qryST->numAlnI)
+           { /*Loop: Find the next primary or supplemental alignment*/
+               alnST = &qryST->alnST[mapST->onAlnI];
+               ++mapST->onAlnI;
+
+               if(alnST->id != alnST->parent)
+                   continue; /*Secondary alignment (--secondary=no)*/
+
+               return samMapAlnToSam(samST, mapST, qryST, alnST);
+           } /*Loop: Find the next primary or supplemental alignment*/
+
+           ++mapST->onQryUI;
+           mapST->onAlnI = 0;
+       } /*Loop: Find the next alignment to print*/
+    } /*libminimap2 block*/
+    #endif
+
+    return 2;
+} /*readSamMapper*/
+
+/*---------------------------------------------------------------------\
+| Output:
+|   - Closes:
+|     o minimap2 (popen path) or the query file
+|   - Frees:
+|     o Variables in mapST (mapST is not freed). The reference index
+|       is kept for the next openSamMapper call
+\---------------------------------------------------------------------*/
+void closeSamMapper(
+    struct samMapper *mapST   /*Mapping to close*/
+) /*Stops mapping and frees the samMapper variables*/
+{ /*closeSamMapper*/
+
+    /*~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~\
+    ' Fun-3 TOC: Sec-1 Sub-1: closeSamMapper
+    \~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~*/
+
+    if(mapST->samFILE != 0)
+        pclose(mapST->samFILE);
+
+    mapST->samFILE = 0;
+
+    #ifdef LIBMINIMAP2
+       if(mapST->qryAryST != 0)
+       { /*If have queries to free*/
+           for(uint32_t uiQry = 0; uiQry < defMapBatch; ++uiQry)
+           { /*Loop: Free the queries*/
+               for(int iAln=0; iAln < mapST->qryAryST[uiQry].numAlnI; ++iAln)
+                   free(mapST->qryAryST[uiQry].alnST[iAln].p);
+
+               free(mapST->qryAryST[uiQry].alnST);
+               free(mapST->qryAryST[uiQry].idCStr);
+               free(mapST->qryAryST[uiQry].seqCStr);
+               free(mapST->qryAryST[uiQry].qCStr);
+           } /*Loop: Free the queries*/
+
+           free(mapST->qryAryST);
+       } /*If have queries to free*/
+
+       if(mapST->tBuffAryST != 0)
+       { /*If have thread buffers to free*/
+           for(int iThread = 0; iThread < mapST->numThreadsI; ++iThread)
+           { /*Loop: Free the thread buffers*/
+               if(mapST->tBuffAryST[iThread] != 0)
+                   mm_tbuf_destroy(mapST->tBuffAryST[iThread]);
+           } /*Loop: Free the thread buffers*/
+
+           free(mapST->tBuffAryST);
+       } /*If have thread buffers to free*/
+
+       if(mapST->qryFILE != 0)
+           gzclose(mapST->qryFILE);
+
+       free(mapST->lineCStr);
+
+       if(mapST->idxST != 0)
+           releaseSamMapIdx(mapST->idxST);
+
+       memset(mapST, 0, sizeof(struct samMapper));
+    #endif
+
+    return;
+} /*closeSamMapper*/
+
+/*---------------------------------------------------------------------\
+| Output:
+|   - Frees:
+|     o The kept reference indexes that are not in use. Does nothing
+|       for the popen path.
+\---------------------------------------------------------------------*/
+void freeSamMapIdx(
+    void
+) /*Frees the kept reference indexes (libminimap2 only)*/
+{ /*freeSamMapIdx*/
+
+    /*~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~\
+    ' Fun-4 TOC: Sec-1 Sub-1: freeSamMapIdx
+    \~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~*/
+
+    #ifdef LIBMINIMAP2
+       struct samMapIdx *idxST = 0;
+
+       pthread_mutex_lock(&keptMapIdxMutex);
+
+       for(int iIdx = 0; iIdx < defMapIdxKeep; ++iIdx)
+       { /*Loop: Free the kept indexes*/
+           idxST = keptMapIdxAryST[iIdx];
+
+           if(idxST == 0 || idxST->numUsersUI > 0)
+               continue; /*No index or the index is in use*/
+
+           mm_idx_destroy(idxST->idxST);
+           free(idxST->pathCStr);
+           free(idxST);
+           keptMapIdxAryST[iIdx] = 0;
+       } /*Loop: Free the kept indexes*/
+
+       pthread_mutex_unlock(&keptMapIdxMutex);
+    #endif
+
+    return;
+} /*freeSamMapIdx*/
+
+#ifdef LIBMINIMAP2
+
+/*---------------------------------------------------------------------\
+| Output:
+|   - Modifies:
+|     o lenFileUL to have the number of bytes in the file
+|     o hashUL to have the FNV-1a hash of the files contents
+|   - Returns:
+|     o 1 for success
+|     o 2 if could not open the file
+\---------------------------------------------------------------------*/
+static uint8_t hashSamMapFile(
+    char *pathCStr,       /*File to hash*/
+    uint64_t *lenFileUL,  /*Gets the file length*/
+    uint64_t *hashUL      /*Gets the hash*/
+) /*Gets the length and a hash of a files contents*/
+{ /*hashSamMapFile*/
+
+    /*~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~\
+    ' Fun-5 TOC: Sec-1 Sub-1: hashSamMapFile
+    '   - The references are one read, a few consensuses, or a small
+    '     set of references, so reading them is cheap next to indexing
+    '     them. This catches a file rewritten in the same second with
+    '     the same length (a new best read), which a time stamp misses
+    \~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~*/
+
+    unsigned char buffUCStr[1 << 15];
+    size_t numReadUL = 0;
+    FILE *inFILE = fopen(pathCStr, "rb");
+
+    if(inFILE == 0)
+        return 2;
+
+    *lenFileUL = 0;
+    *hashUL = 0xcbf29ce484222325ULL; /*FNV-1a offset basis*/
+
+    while((numReadUL = fread(buffUCStr, 1, sizeof(buffUCStr), inFILE)))
+    { /*Loop: Hash the file*/
+        *lenFileUL += numReadUL;
+
+        for(size_t ulByte = 0; ulByte < numReadUL; ++ulByte)
+        { /*Loop: Hash each byte*/
+            *hashUL ^= buffUCStr[ulByte];
+            *hashUL *= 0x100000001b3ULL; /*FNV-1a prime*/
+        } /*Loop: Hash each byte*/
+    } /*Loop: Hash the file*/
+
+    fclose(inFILE);
+    return 1;
+} /*hashSamMapFile*/
+
+/*---------------------------------------------------------------------\
+| Output:
+|   - Returns:
+|     o The kept index if one was made from the same file contents
+|     o A new index of refPathCStr if not. The new index is kept in an
+|       empty slot or the slot of the oldest unused index. If every
+|       slot is in use, the mapper owns the new index.
+|     o 0 for errors
+|   - Modifies:
+|     o errUC to be 2 if the reference could not be indexed
+|     o errUC to be 4 if the reference needs more than one index part
+|     o errUC to be 64 for memory errors
+\---------------------------------------------------------------------*/
+static struct samMapIdx * getSamMapIdx(
+    char *refPathCStr,    /*Reference to index*/
+    int numThreadsI,      /*Number threads to index with*/
+    uint8_t *errUC        /*Gets the error type*/
+) /*Gets a kept index or indexes the reference*/
+{ /*getSamMapIdx*/
+
+    /*~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~\
+    ' Fun-6 TOC: getSamMapIdx
+    '   - The mutex is not held while hashing or indexing the
+    '     reference, so bin threads only wait on each other for the
+    '     slot lookups
+    '   fun-6 sec-1: Set up the minimap2 settings (first call)
+    '   fun-6 sec-2: Check if an index is kept for this reference
+    '   fun-6 sec-3: Index the reference
+    '   fun-6 sec-4: Keep the new index
+    \~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~*/
+
+    /*>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>\
+    ^ Fun-6 Sec-1: Set up the minimap2 settings (first call)
+    \<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<*/
+
+    uint64_t lenFileUL = 0;
+    uint64_t hashUL = 0;
+    mm_idx_reader_t *idxReadST = 0;
+    mm_idx_t *idxST = 0;
+    struct samMapIdx *retST = 0;
+    struct samMapIdx *keptST = 0;
+    int slotI = -1;   /*Slot to keep the new index in*/
+
+    pthread_mutex_lock(&keptMapIdxMutex);
+
+    if(!samMapOptSetBl)
+    { /*If need to set up the minimap2 settings*/
+        /*Same as "--eqx --secondary=no -a -x map-ont"*/
+        mm_set_opt(0, &samMapIdxOptST, &samMapOptST);
+        mm_set_opt("map-ont", &samMapIdxOptST, &samMapOptST);
+
+        samMapOptST.flag |= MM_F_CIGAR | MM_F_EQX | MM_F_NO_PRINT_2ND;
+        samMapOptSetBl = 1;
+    } /*If need to set up the minimap2 settings*/
+
+    pthread_mutex_unlock(&keptMapIdxMutex);
+
+    /*>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>\
+    ^ Fun-6 Sec-2: Check if an index is kept for this reference
+    \<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<*/
+
+    if(!(hashSamMapFile(refPathCStr, &lenFileUL, &hashUL) & 1))
+    { /*If could not open the reference*/
+        *errUC = 2;
+        return 0;
+    } /*If could not open the reference*/
+
+    pthread_mutex_lock(&keptMapIdxMutex);
+    keptST = findKeptMapIdx(refPathCStr, lenFileUL, hashUL);
+    pthread_mutex_unlock(&keptMapIdxMutex);
+
+    if(keptST != 0)
+    { /*If an index is kept for this reference*/
+        *errUC = 1;
+        return keptST;
+    } /*If an index is kept for this reference*/
+
+    /*>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>\
+    ^ Fun-6 Sec-3: Index the reference
+    \<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<*/
+
+    idxReadST = mm_idx_reader_open(refPathCStr, &samMapIdxOptST, 0);
+
+    if(idxReadST == 0)
+    { /*If could not open the reference*/
+        *errUC = 2;
+        return 0;
+    } /*If could not open the reference*/
+
+    idxST = mm_idx_reader_read(idxReadST, numThreadsI);
+
+    if(idxST == 0 || !mm_idx_reader_eof(idxReadST))
+    { /*If no index or the reference needs more than one index part*/
+        *errUC = idxST == 0 ? 2 : 4;
+
+        if(idxST != 0)
+            mm_idx_destroy(idxST);
+
+        mm_idx_reader_close(idxReadST);
+        return 0;
+    } /*If no index or the reference needs more than one index part*/
+
+    mm_idx_reader_close(idxReadST);
+
+    retST = calloc(1, sizeof(struct samMapIdx));
+
+    if(retST != 0)
+        retST->pathCStr = malloc(strlen(refPathCStr) + 1);
+
+    if(retST == 0 || retST->pathCStr == 0)
+    { /*If had a memory error*/
+        free(retST);
+        mm_idx_destroy(idxST);
+        *errUC = 64;
+        return 0;
+    } /*If had a memory error*/
+
+    strcpy(retST->pathCStr, refPathCStr);
+    retST->lenFileUL = lenFileUL;
+    retST->hashUL = hashUL;
+    retST->idxST = idxST;
+    retST->numUsersUI = 1;
+
+    /*>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>\
+    ^ Fun-6 Sec-4: Keep the new index
+    \<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<*/
+
+    pthread_mutex_lock(&keptMapIdxMutex);
+
+    /*Another thread may have indexed this reference while this
+    ` thread was indexing it*/
+    keptST = findKeptMapIdx(refPathCStr, lenFileUL, hashUL);
+
+    if(keptST != 0)
+    { /*If another thread kept an index for this reference*/
+        pthread_mutex_unlock(&keptMapIdxMutex);
+
+        mm_idx_destroy(retST->idxST);
+        free(retST->pathCStr);
+        free(retST);
+
+        *errUC = 1;
+        return keptST;
+    } /*If another thread kept an index for this reference*/
+
+    for(int iIdx = 0; iIdx < defMapIdxKeep; ++iIdx)
+    { /*Loop: Find an empty slot or the oldest unused index*/
+        keptST = keptMapIdxAryST[iIdx];
+
+        if(keptST == 0)
+        { /*If this slot is empty*/
+            slotI = iIdx;
+            break;
+        } /*If this slot is empty*/
+
+        if(keptST->numUsersUI > 0)
+            continue; /*Index is in use*/
+
+        if(
+              slotI < 0
+           || keptST->lastUseUL < keptMapIdxAryST[slotI]->lastUseUL
+        ) slotI = iIdx;
+    } /*Loop: Find an empty slot or the oldest unused index*/
+
+    if(slotI >= 0)
+    { /*If can keep the new index*/
+        keptST = keptMapIdxAryST[slotI];
+
+        if(keptST != 0)
+        { /*If have an old index to free*/
+            mm_idx_destroy(keptST->idxST);
+            free(keptST->pathCStr);
+            free(keptST);
+        } /*If have an old index to free*/
+
+        retST->keptBl = 1;
+        retST->lastUseUL = ++keptMapIdxUseUL;
+        keptMapIdxAryST[slotI] = retST;
+    } /*If can keep the new index*/
+
+    pthread_mutex_unlock(&keptMapIdxMutex);
+    *errUC = 1;
+    return retST;
+} /*getSamMapIdx*/
+
+/*---------------------------------------------------------------------\
+| Output:
+|   - Modifies:
+|     o idxST->numUsersUI to be one less
+|   - Frees:
+|     o idxST if it is not the kept index and has no users
+\---------------------------------------------------------------------*/
+static void releaseSamMapIdx(
+    struct samMapIdx *idxST   /*Index a mapper is done with*/
+) /*Marks a mapper as no longer using an index*/
+{ /*releaseSamMapIdx*/
+
+    /*~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~\
+    ' Fun-7 TOC: Sec-1 Sub-1: releaseSamMapIdx
+    \~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~*/
+
+    pthread_mutex_lock(&keptMapIdxMutex);
+
+    --idxST->numUsersUI;
+
+    if(!idxST->keptBl && idxST->numUsersUI == 0)
+    { /*If this index is owned by the mapper*/
+        mm_idx_destroy(idxST->idxST);
+        free(idxST->pathCStr);
+        free(idxST);
+    } /*If this index is owned by the mapper*/
+
+    pthread_mutex_unlock(&keptMapIdxMutex);
+    return;
+} /*releaseSamMapIdx*/
+
+/*---------------------------------------------------------------------\
+| Output:
+|   - Modifies:
+|     o mapST->lineCStr to have the next line (no new line)
+|     o lenLineUI to have the length of the line
+|   - Returns:
+|     o 1 for success
+|     o 2 for end of file
+|     o 64 for memory errors
+\---------------------------------------------------------------------*/
+static uint8_t getSamMapLine(
+    struct samMapper *mapST,  /*Has the query file to read*/
+    uint32_t *lenLineUI       /*Gets the line length*/
+) /*Reads one full line from the query file*/
+{ /*getSamMapLine*/
+
+    /*~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~\
+    ' Fun-8 TOC: Sec-1 Sub-1: getSamMapLine
+    \~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~*/
+
+    char *tmpCStr = 0;
+    *lenLineUI = 0;
+
+    if(mapST->lineCStr == 0)
+    { /*If need a line buffer*/
+        mapST->lenLineUI = 1 << 12;
+        mapST->lineCStr = malloc(mapST->lenLineUI);
+
+        if(mapST->lineCStr == 0)
+            return 64;
+    } /*If need a line buffer*/
+
+    while(1)
+    { /*Loop: Read in the full line*/
+        tmpCStr =
+            gzgets(
+                mapST->qryFILE,
+                mapST->lineCStr + *lenLineUI,
+                mapST->lenLineUI - *lenLineUI
+            );
+
+        if(tmpCStr == 0)
+        { /*If at the end of the file*/
+            if(*lenLineUI == 0)
+                return 2;
+
+            break; /*Last line had no new line*/
+        } /*If at the end of the file*/
+
+        *lenLineUI += strlen(mapST->lineCStr + *lenLineUI);
+
+        if(mapST->lineCStr[*lenLineUI - 1] == '\n')
+            break;
+
+        if(*lenLineUI < mapST->lenLineUI - 1)
+            break; /*Last line had no new line*/
+
+        tmpCStr = realloc(mapST->lineCStr, mapST->lenLineUI << 1);
+
+        if(tmpCStr == 0)
+            return 64;
+
+        mapST->lineCStr = tmpCStr;
+        mapST->lenLineUI <<= 1;
+    } /*Loop: Read in the full line*/
+
+    while(
+          *lenLineUI > 0
+       && (   mapST->lineCStr[*lenLineUI - 1] == '\n'
+           || mapST->lineCStr[*lenLineUI - 1] == '\r')
+    ) --(*lenLineUI); /*Remove the new line*/
+
+    mapST->lineCStr[*lenLineUI] = '\0';
+    return 1;
+} /*getSamMapLine*/
+
+/*---------------------------------------------------------------------\
+| Output:
+|   - Modifies:
+|     o qryST to have the id, sequence, and q-score entry of the next
+|       fasta or fastq entry
+|   - Returns:
+|     o 1 for success
+|     o 2 for end of file
+|     o 4 for an invalid fasta/fastq file
+|     o 64 for memory errors
+\---------------------------------------------------------------------*/
+static uint8_t readSamMapQry(
+    struct samMapper *mapST,  /*Has the query file to read*/
+    struct samMapQry *qryST   /*Gets the next query*/
+) /*Reads one fasta or fastq entry from the query file*/
+{ /*readSamMapQry*/
+
+    /*~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~\
+    ' Fun-9 TOC: readSamMapQry
+    '   fun-9 sec-1: Read in the header and copy the read id
+    '   fun-9 sec-2: Read in the sequence
+    '   fun-9 sec-3: Read in the q-score entry (fastq)
+    \~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~*/
+
+    /*>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>\
+    ^ Fun-9 Sec-1: Read in the header and copy the read id
+    \<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<*/
+
+    uint32_t lenLineUI = 0;
+    uint32_t lenIdUI = 0;
+    uint32_t lenQUI = 0;
+    uint8_t errUC = 0;
+    char fqBl = 0;
+    char *tmpCStr = 0;
+
+    if(!mapST->pendLineBl)
+    { /*If need to read in the header*/
+        do{
+           errUC = getSamMapLine(mapST, &lenLineUI);
+
+           if(errUC != 1)
+               return errUC;
+        } while(lenLineUI == 0); /*Skip blank lines*/
+    } /*If need to read in the header*/
+
+    mapST->pendLineBl = 0;
+
+    if(mapST->lineCStr[0] != '>' && mapST->lineCStr[0] != '@')
+        return 4;
+
+    fqBl = (mapST->lineCStr[0] == '@');
+
+    while(mapST->lineCStr[lenIdUI + 1] > 32)
+        ++lenIdUI;
+
+    if(qryST->lenIdBuffUI < lenIdUI + 1)
+    { /*If need a larger read id buffer*/
+        tmpCStr = realloc(qryST->idCStr, lenIdUI + 1);
+
+        if(tmpCStr == 0)
+            return 64;
+
+        qryST->idCStr = tmpCStr;
+        qryST->lenIdBuffUI = lenIdUI + 1;
+    } /*If need a larger read id buffer*/
+
+    memcpy(qryST->idCStr, mapST->lineCStr + 1, lenIdUI);
+    qryST->idCStr[lenIdUI] = '\0';
+
+    /*>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>\
+    ^ Fun-9 Sec-2: Read in the sequence
+    \<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<*/
+
+    qryST->lenSeqUI = 0;
+
+    while(1)
+    { /*Loop: Read in the sequence lines*/
+        errUC = getSamMapLine(mapST, &lenLineUI);
+
+        if(errUC == 2)
+            break;          /*End of file*/
+
+        if(errUC != 1)
+            return errUC;
+
+        if(!fqBl && mapST->lineCStr[0] == '>')
+        { /*If on the next fasta entry*/
+            mapST->pendLineBl = 1;
+            break;
+        } /*If on the next fasta entry*/
+
+        if(fqBl && mapST->lineCStr[0] == '+')
+            break;          /*End of the fastq sequence*/
+
+        if(qryST->lenSeqBuffUI < qryST->lenSeqUI + lenLineUI + 1)
+        { /*If need larger sequence and q-score buffers*/
+            qryST->lenSeqBuffUI = (qryST->lenSeqUI + lenLineUI + 1) << 1;
+
+            tmpCStr = realloc(qryST->seqCStr, qryST->lenSeqBuffUI);
+
+            if(tmpCStr == 0)
+                return 64;
+
+            qryST->seqCStr = tmpCStr;
+            tmpCStr = realloc(qryST->qCStr, qryST->lenSeqBuffUI);
+
+            if(tmpCStr == 0)
+                return 64;
+
+            qryST->qCStr = tmpCStr;
+        } /*If need larger sequence and q-score buffers*/
+
+        memcpy(qryST->seqCStr + qryST->lenSeqUI, mapST->lineCStr, lenLineUI);
+        qryST->lenSeqUI += lenLineUI;
+    } /*Loop: Read in the sequence lines*/
+
+    if(qryST->lenSeqUI == 0)
+        return 4;
+
+    qryST->seqCStr[qryST->lenSeqUI] = '\0';
+
+    if(!fqBl)
+    { /*If this is a fasta entry*/
+        qryST->qCStr[0] = '\0';
+        return 1;
+    } /*If this is a fasta entry*/
+
+    /*>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>\
+    ^ Fun-9 Sec-3: Read in the q-score entry (fastq)
+    \<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<*/
+
+    while(lenQUI < qryST->lenSeqUI)
+    { /*Loop: Read in the q-score lines*/
+        errUC = getSamMapLine(mapST, &lenLineUI);
+
+        if(errUC == 2)
+            return 4;      /*Missing q-score entry*/
+
+        if(errUC != 1)
+            return errUC;
+
+        if(lenQUI + lenLineUI > qryST->lenSeqUI)
+            return 4;      /*Q-score entry longer than sequence*/
+
+        memcpy(qryST->qCStr + lenQUI, mapST->lineCStr, lenLineUI);
+        lenQUI += lenLineUI;
+    } /*Loop: Read in the q-score lines*/
+
+    qryST->qCStr[lenQUI] = '\0';
+    return 1;
+} /*readSamMapQry*/
+
+/*---------------------------------------------------------------------\
+| Output:
+|   - Modifies:
+|     o alnST and numAlnI in every numThreadsI query in the batch,
+|       starting at query threadI
+\---------------------------------------------------------------------*/
+static void * samMapThread(
+    void *argST   /*samMapThreadArg with the mapper and thread number*/
+) /*Maps every numThreadsI query in a batch (thread function)*/
+{ /*samMapThread*/
+
+    /*~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~\
+    ' Fun-10 TOC: Sec-1 Sub-1: samMapThread
+    \~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~*/
+
+    struct samMapper *mapST = ((struct samMapThreadArg *) argST)->mapST;
+    int threadI = ((struct samMapThreadArg *) argST)->threadI;
+    struct samMapQry *qryST = 0;
+
+    for(
+        uint32_t uiQry = threadI;
+        uiQry < mapST->numQryUI;
+        uiQry += mapST->numThreadsI
+    ){ /*Loop: Map this threads queries*/
+        qryST = &mapST->qryAryST[uiQry];
+
+        qryST->alnST =
+            mm_map(
+                mapST->idxST->idxST,
+                qryST->lenSeqUI,
+                qryST->seqCStr,
+                &qryST->numAlnI,
+                mapST->tBuffAryST[threadI],
+                &mapST->mapOptST,
+                qryST->idCStr
+            );
+
+        if(qryST->alnST == 0)
+            qryST->numAlnI = 0;
+    } /*Loop: Map this threads queries*/
+
+    return 0;
+} /*samMapThread*/
+
+/*---------------------------------------------------------------------\
+| Output:
+|   - Modifies:
+|     o mapST->qryAryST to have the next defMapBatch (or fewer)
+|       queries and their alignments
+|     o mapST->numQryUI to have the number of queries read in
+|     o mapST->eofBl to be 1 if read the last query
+|   - Returns:
+|     o 1 for success
+|     o 4 for an invalid fasta/fastq file
+|     o 64 for memory errors
+\---------------------------------------------------------------------*/
+static uint8_t loadSamMapBatch(
+    struct samMapper *mapST   /*Mapper to get the next batch for*/
+) /*Reads in and maps the next batch of queries*/
+{ /*loadSamMapBatch*/
+
+    /*~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~\
+    ' Fun-11 TOC: loadSamMapBatch
+    '   fun-11 sec-1: Free the old alignments and read in the queries
+    '   fun-11 sec-2: Map the queries
+    \~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~*/
+
+    /*>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>\
+    ^ Fun-11 Sec-1: Free the old alignments and read in the queries
+    \<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<*/
+
+    struct samMapQry *qryST = 0;
+    struct samMapThreadArg argAryST[mapST->numThreadsI];
+    pthread_t threadAryST[mapST->numThreadsI];
+    int numThreadsI = 0;
+    uint8_t errUC = 0;
+
+    for(uint32_t uiQry = 0; uiQry < mapST->numQryUI; ++uiQry)
+    { /*Loop: Free the alignments from the last batch*/
+        qryST = &mapST->qryAryST[uiQry];
+
+        for(int iAln = 0; iAln < qryST->numAlnI; ++iAln)
+            free(qryST->alnST[iAln].p);
+
+        free(qryST->alnST);
+        qryST->alnST = 0;
+        qryST->numAlnI = 0;
+    } /*Loop: Free the alignments from the last batch*/
+
+    mapST->numQryUI = 0;
+    mapST->onQryUI = 0;
+    mapST->onAlnI = 0;
+
+    while(mapST->numQryUI < defMapBatch)
+    { /*Loop: Read in the next batch of queries*/
+        errUC = readSamMapQry(mapST, &mapST->qryAryST[mapST->numQryUI]);
+
+        if(errUC == 2)
+        { /*If at the end of the file*/
+            mapST->eofBl = 1;
+            break;
+        } /*If at the end of the file*/
+
+        if(errUC != 1)
+        { /*If had an error*/
+            mapST->eofBl = 1;
+            return errUC;
+        } /*If had an error*/
+
+        ++mapST->numQryUI;
+    } /*Loop: Read in the next batch of queries*/
+
+    /*>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>\
+    ^ Fun-11 Sec-2: Map the queries
+    \<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<*/
+
+    for(int iThread = 0; iThread < mapST->numThreadsI; ++iThread)
+    { /*Loop: Start the mapping threads*/
+        argAryST[iThread].mapST = mapST;
+        argAryST[iThread].threadI = iThread;
+
+        if(iThread == 0 || (uint32_t) iThread >= mapST->numQryUI)
+            continue; /*Thread 0 is this thread*/
+
+        if(
+            pthread_create(
+                &threadAryST[numThreadsI],
+                0,
+                samMapThread,
+                &argAryST[iThread]
+            )
+        ) samMapThread(&argAryST[iThread]); /*Could not make thread*/
+
+        else
+            ++numThreadsI;
+    } /*Loop: Start the mapping threads*/
+
+    samMapThread(&argAryST[0]);
+
+    for(int iThread = 0; iThread < numThreadsI; ++iThread)
+        pthread_join(threadAryST[iThread], 0);
+
+    return 1;
+} /*loadSamMapBatch*/
+
+/*---------------------------------------------------------------------\
+| Output:
+|   - Modifies:
+|     o samST->samEntryCStr to have at least lenNeedUL bytes
+|   - Returns:
+|     o 1 for success
+|     o 64 for memory errors
+\---------------------------------------------------------------------*/
+static uint8_t growSamEntryBuff(
+    struct samEntry *samST,   /*samEntry to check*/
+    uint64_t lenNeedUL        /*Number of bytes needed*/
+) /*Makes sure a samEntry can hold a line of a set length*/
+{ /*growSamEntryBuff*/
+
+    /*~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~\
+    ' Fun-12 TOC: Sec-1 Sub-1: growSamEntryBuff
+    \~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~*/
+
+    char *tmpCStr = 0;
+
+    if(samST->samEntryCStr != 0 && samST->lenBuffULng >= lenNeedUL)
+        return 1;
+
+    tmpCStr = realloc(samST->samEntryCStr, lenNeedUL);
+
+    if(tmpCStr == 0)
+        return 64;
+
+    samST->samEntryCStr = tmpCStr;
+    samST->lenBuffULng = lenNeedUL;
+    return 1;
+} /*growSamEntryBuff*/
+
+/*---------------------------------------------------------------------\
+| Output:
+|   - Modifies:
+|     o samST to have alnST as a sam line (same format as minimap2).
+|       The pointers, flag, mapq, position, and cigar counts are set
+|       from alnST, so the line is not re-read with processSamEntry.
+|   - Returns:
+|     o 1 for success
+|     o 64 for memory errors
+\---------------------------------------------------------------------*/
+static uint8_t samMapAlnToSam(
+    struct samEntry *samST,   /*Gets the sam line*/
+    struct samMapper *mapST,  /*Has the reference index*/
+    struct samMapQry *qryST,  /*Query that was mapped*/
+    mm_reg1_t *alnST          /*Alignment to print*/
+) /*Converts one alignment to a samEntry*/
+{ /*samMapAlnToSam*/
+
+    /*~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~\
+    ' Fun-13 TOC: samMapAlnToSam
+    '   fun-13 sec-1: Variable declerations and find the buffer size
+    '   fun-13 sec-2: Set the id, flag, reference, & cigar
+    '   fun-13 sec-3: Set the sequence and q-score entries
+    '   fun-13 sec-4: Print the tags
+    \~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~*/
+
+    /*>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>\
+    ^ Fun-13 Sec-1: Variable declerations and find the buffer size
+    \<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<*/
+
+    mm_idx_t *idxST = mapST->idxST->idxST;
+    mm_reg1_t *otherST = 0;
+    char *outCStr = 0;
+    char *cigOpCStr = "MIDNSHP=XB";
+    char hardClipBl = !alnST->sam_pri; /*Supplemental alignment*/
+    uint32_t startClipUI = 0;
+    uint32_t endClipUI = 0;
+    uint32_t firstBaseUI = 0;
+    uint32_t endBaseUI = qryST->lenSeqUI;
+    uint32_t lenOutUI = 0;      /*Number of bases to print*/
+    uint32_t numCigUI = alnST->p != 0 ? alnST->p->n_cigar : 0;
+    uint32_t numMUI = 0;
+    uint32_t numIUI = 0;
+    uint32_t numDUI = 0;
+    uint32_t lenCigUI = 0;
+    uint16_t flagUS = 0;
+    int numOtherAlnI = 0;
+    uint64_t lenNeedUL = 0;
+
+    flagUS |= alnST->rev ? 16 : 0;
+    flagUS |= alnST->sam_pri ? 0 : 2048;
+
+    if(alnST->rev)
+    { /*If the query was reverse complemented*/
+        startClipUI = qryST->lenSeqUI - alnST->qe;
+        endClipUI = alnST->qs;
+    } /*If the query was reverse complemented*/
+
+    else
+    { /*Else the query was on the forward strand*/
+        startClipUI = alnST->qs;
+        endClipUI = qryST->lenSeqUI - alnST->qe;
+    } /*Else the query was on the forward strand*/
+
+    if(hardClipBl)
+    { /*If only printing the aligned bases*/
+        firstBaseUI = alnST->qs;
+        endBaseUI = alnST->qe;
+    } /*If only printing the aligned bases*/
+
+    lenOutUI = endBaseUI - firstBaseUI;
+
+    for(int iAln = 0; iAln < qryST->numAlnI; ++iAln)
+    { /*Loop: Count the other primary and supplemental alignments*/
+        otherST = &qryST->alnST[iAln];
+
+        if(otherST != alnST && otherST->id == otherST->parent)
+            ++numOtherAlnI;
+    } /*Loop: Count the other primary and supplemental alignments*/
+
+    lenNeedUL =
+          strlen(qryST->idCStr)
+        + strlen(idxST->seq[alnST->rid].name)
+        + ((uint64_t) numCigUI + 2) * 12
+        + (uint64_t) lenOutUI * 2
+        + (uint64_t) numOtherAlnI * 128
+        + 256;
+
+    for(int iAln = 0; iAln < qryST->numAlnI; ++iAln)
+    { /*Loop: Add the reference name lengths for the SA tag*/
+        otherST = &qryST->alnST[iAln];
+
+        if(otherST != alnST && otherST->id == otherST->parent)
+            lenNeedUL += strlen(idxST->seq[otherST->rid].name);
+    } /*Loop: Add the reference name lengths for the SA tag*/
+
+    if(!(growSamEntryBuff(samST, lenNeedUL) & 1))
+        return 64;
+
+    /*>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>\
+    ^ Fun-13 Sec-2: Set the id, flag, reference, & cigar
+    \<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<*/
+
+    outCStr = samST->samEntryCStr;
+
+    samST->queryCStr = outCStr;
+    samST->flagUSht = flagUS;
+    outCStr +=
+        sprintf(outCStr, "%s\t%u\t", qryST->idCStr, (unsigned int) flagUS);
+
+    samST->refCStr = outCStr;
+    samST->posOnRefUInt = (uint32_t) alnST->rs + 1;
+    samST->mapqUChar = (uint8_t) alnST->mapq;
+
+    outCStr +=
+        sprintf(
+            outCStr,
+            "%s\t%li\t%u\t",
+            idxST->seq[alnST->rid].name,
+            (long) alnST->rs + 1,
+            (unsigned int) alnST->mapq
+        );
+
+    /*The cigar counts are added in the same way as processSamEntry*/
+    samST->cigarCStr = outCStr;
+    samST->unTrimReadLenUInt = 0;
+
+    if(startClipUI)
+    { /*If the start of the query is clipped*/
+        outCStr +=
+            sprintf(outCStr, "%u%c", startClipUI, hardClipBl ? 'H' : 'S');
+
+        if(!hardClipBl)
+            samST->unTrimReadLenUInt += startClipUI;
+    } /*If the start of the query is clipped*/
+
+    if(numCigUI == 0)
+    { /*If minimap2 did not make a cigar*/
+        outCStr += sprintf(outCStr, "%iM", alnST->qe - alnST->qs);
+        samST->unTrimReadLenUInt += alnST->qe - alnST->qs;
+        samST->numMatchUInt += alnST->qe - alnST->qs;
+    } /*If minimap2 did not make a cigar*/
+
+    for(uint32_t uiCig = 0; uiCig < numCigUI; ++uiCig)
+    { /*Loop: Print the cigar*/
+        lenCigUI = alnST->p->cigar[uiCig] >> 4;
+
+        outCStr +=
+            sprintf(
+                outCStr,
+                "%u%c",
+                lenCigUI,
+                cigOpCStr[alnST->p->cigar[uiCig] & 0xf]
+            );
+
+        switch(cigOpCStr[alnST->p->cigar[uiCig] & 0xf])
+        { /*Switch: Add the cigar entry to the counts*/
+            case '=':
+            case 'M':
+                samST->unTrimReadLenUInt += lenCigUI;
+                samST->numMatchUInt += lenCigUI;
+                break;
+            case 'X':
+                samST->unTrimReadLenUInt += lenCigUI;
+                samST->numSNPUInt += lenCigUI;
+                break;
+            case 'I':
+                samST->unTrimReadLenUInt += lenCigUI;
+                samST->numInsUInt += lenCigUI;
+                break;
+            case 'D':
+                samST->numDelUInt += lenCigUI;
+                break;
+            case 'S':
+                samST->unTrimReadLenUInt += lenCigUI;
+                break;
+            default: break;
+        } /*Switch: Add the cigar entry to the counts*/
+    } /*Loop: Print the cigar*/
+
+    if(endClipUI)
+    { /*If the end of the query is clipped*/
+        outCStr +=
+            sprintf(outCStr, "%u%c", endClipUI, hardClipBl ? 'H' : 'S');
+
+        if(!hardClipBl)
+            samST->unTrimReadLenUInt += endClipUI;
+    } /*If the end of the query is clipped*/
+
+    samST->readLenUInt = samST->unTrimReadLenUInt;
+
+    outCStr += sprintf(outCStr, "\t*\t0\t0\t"); /*No mate*/
+
+    /*>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>\
+    ^ Fun-13 Sec-3: Set the sequence and q-score entries
+    \<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<*/
+
+    samST->seqCStr = outCStr;
+
+    if(!alnST->rev)
+    { /*If the query is on the forward strand*/
+        memcpy(outCStr, qryST->seqCStr + firstBaseUI, lenOutUI);
+        outCStr += lenOutUI;
+        *outCStr++ = '\t';
+        samST->qCStr = outCStr;
+
+        if(qryST->qCStr[0] == '\0')
+            *outCStr++ = '*';
+
+        else
+        { /*Else have a q-score entry*/
+            memcpy(outCStr, qryST->qCStr + firstBaseUI, lenOutUI);
+            outCStr += lenOutUI;
+        } /*Else have a q-score entry*/
+    } /*If the query is on the forward strand*/
+
+    else
+    { /*Else print the reverse complement*/
+        for(uint32_t uiBase = endBaseUI; uiBase > firstBaseUI; --uiBase)
+        { /*Loop: Reverse complement the sequence*/
+            switch(qryST->seqCStr[uiBase - 1])
+            { /*Switch: Complement the base*/
+                case 'A': *outCStr++ = 'T'; break;
+                case 'C': *outCStr++ = 'G'; break;
+                case 'G': *outCStr++ = 'C'; break;
+                case 'T': *outCStr++ = 'A'; break;
+                case 'U': *outCStr++ = 'A'; break;
+                case 'a': *outCStr++ = 't'; break;
+                case 'c': *outCStr++ = 'g'; break;
+                case 'g': *outCStr++ = 'c'; break;
+                case 't': *outCStr++ = 'a'; break;
+                case 'u': *outCStr++ = 'a'; break;
+                case 'n': *outCStr++ = 'n'; break;
+                default:  *outCStr++ = 'N'; break;
+            } /*Switch: Complement the base*/
+        } /*Loop: Reverse complement the sequence*/
+
+        *outCStr++ = '\t';
+        samST->qCStr = outCStr;
+
+        if(qryST->qCStr[0] == '\0')
+            *outCStr++ = '*';
+
+        else
+        { /*Else have a q-score entry*/
+            for(uint32_t uiBase = endBaseUI; uiBase > firstBaseUI; --uiBase)
+                *outCStr++ = qryST->qCStr[uiBase - 1];
+        } /*Else have a q-score entry*/
+    } /*Else print the reverse complement*/
+
+    /*>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>\
+    ^ Fun-13 Sec-4: Print the tags
+    \<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<*/
+
+    outCStr +=
+        sprintf(
+            outCStr,
+            "\tNM:i:%i\tAS:i:%i\ttp:A:%c",
+            alnST->blen - alnST->mlen
+               + (alnST->p != 0 ? (int) alnST->p->n_ambi : 0),
+            alnST->p != 0 ? alnST->p->dp_score : alnST->score,
+            alnST->sam_pri ? 'P' : 'S'
+        );
+
+    if(numOtherAlnI > 0)
+    { /*If have other alignments (SA tag)*/
+        outCStr += sprintf(outCStr, "\tSA:Z:");
+
+        for(int iAln = 0; iAln < qryST->numAlnI; ++iAln)
+        { /*Loop: Print the other alignments*/
+            otherST = &qryST->alnST[iAln];
+
+            if(otherST == alnST || otherST->id != otherST->parent)
+                continue;
+
+            numMUI = 0;
+            numIUI = 0;
+            numDUI = 0;
+
+            for(
+                uint32_t uiCig = 0;
+                otherST->p != 0 && uiCig < otherST->p->n_cigar;
+                ++uiCig
+            ){ /*Loop: Count matches, insertions, and deletions*/
+                switch(otherST->p->cigar[uiCig] & 0xf)
+                { /*Switch: Find the cigar type*/
+                    case 1: numIUI += otherST->p->cigar[uiCig] >> 4; break;
+                    case 2: numDUI += otherST->p->cigar[uiCig] >> 4; break;
+                    default: numMUI += otherST->p->cigar[uiCig] >> 4; break;
+                } /*Switch: Find the cigar type*/
+            } /*Loop: Count matches, insertions, and deletions*/
+
+            if(otherST->p == 0)
+                numMUI = otherST->qe - otherST->qs;
+
+            outCStr +=
+                sprintf(
+                    outCStr,
+                    "%s,%li,%c,",
+                    idxST->seq[otherST->rid].name,
+                    (long) otherST->rs + 1,
+                    otherST->rev ? '-' : '+'
+                );
+
+            if(otherST->rev)
+            { /*If the other alignment is reverse complemented*/
+                startClipUI = qryST->lenSeqUI - otherST->qe;
+                endClipUI = otherST->qs;
+            } /*If the other alignment is reverse complemented*/
+
+            else
+            { /*Else the other alignment is on the forward strand*/
+                startClipUI = otherST->qs;
+                endClipUI = qryST->lenSeqUI - otherST->qe;
+            } /*Else the other alignment is on the forward strand*/
+
+            if(startClipUI)
+                outCStr += sprintf(outCStr, "%uS", startClipUI);
+
+            outCStr += sprintf(outCStr, "%uM", numMUI);
+
+            if(numIUI)
+                outCStr += sprintf(outCStr, "%uI", numIUI);
+
+            if(numDUI)
+                outCStr += sprintf(outCStr, "%uD", numDUI);
+
+            if(endClipUI)
+                outCStr += sprintf(outCStr, "%uS", endClipUI);
+
+            outCStr +=
+                sprintf(
+                    outCStr,
+                    ",%u,%i;",
+                    (unsigned int) otherST->mapq,
+                    otherST->blen - otherST->mlen
+                       + (otherST->p != 0 ? (int) otherST->p->n_ambi : 0)
+                );
+        } /*Loop: Print the other alignments*/
+    } /*If have other alignments (SA tag)*/
+
+    *outCStr++ = '\n';
+    *outCStr = '\0';
+
+    return 1;
+} /*samMapAlnToSam*/
+
+/*---------------------------------------------------------------------\
+| Output:
+|   - Modifies:
+|     o samST to have qryST as an unmapped (flag 4) sam line. The
+|       pointers and flag are set here, so the line is not re-read
+|       with processSamEntry.
+|   - Returns:
+|     o 1 for success
+|     o 64 for memory errors
+\---------------------------------------------------------------------*/
+static uint8_t samMapUnmapToSam(
+    struct samEntry *samST,   /*Gets the sam line*/
+    struct samMapQry *qryST   /*Query that did not map*/
+) /*Converts an unmapped query to a samEntry*/
+{ /*samMapUnmapToSam*/
+
+    /*~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~\
+    ' Fun-14 TOC: Sec-1 Sub-1: samMapUnmapToSam
+    \~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~*/
+
+    char *outCStr = 0;
+    uint64_t lenNeedUL =
+        strlen(qryST->idCStr) + ((uint64_t) qryST->lenSeqUI << 1) + 64;
+
+    if(!(growSamEntryBuff(samST, lenNeedUL) & 1))
+        return 64;
+
+    outCStr = samST->samEntryCStr;
+    samST->queryCStr = outCStr;
+    outCStr += sprintf(outCStr, "%s\t4\t", qryST->idCStr);
+
+    samST->refCStr = outCStr;
+    outCStr += sprintf(outCStr, "*\t0\t0\t");
+
+    samST->cigarCStr = outCStr;
+    outCStr += sprintf(outCStr, "*\t*\t0\t0\t");
+
+    samST->seqCStr = outCStr;
+    outCStr += sprintf(outCStr, "%s\t", qryST->seqCStr);
+
+    samST->qCStr = outCStr;
+    sprintf(
+        outCStr,
+        "%s\n",
+        qryST->qCStr[0] != '\0' ? qryST->qCStr : "*"
+    );
+
+    /*No cigar, so no read length (same as processSamEntry)*/
+    samST->flagUSht = 4;
+    samST->mapqUChar = 0;
+    samST->posOnRefUInt = 0;
+    samST->unTrimReadLenUInt = 0;
+    samST->readLenUInt = 0;
+
+    return 1;
+} /*samMapUnmapToSam*/
+
+/*---------------------------------------------------------------------\
+| Output:
+|   - Returns:
+|     o The kept index made from refPathCStr with the same file length
+|       and hash. Its user count is increased by one.
+|     o 0 if no index is kept for refPathCStr
+|   - Note:
+|     o keptMapIdxMutex must be locked by the caller
+\---------------------------------------------------------------------*/
+static struct samMapIdx * findKeptMapIdx(
+    char *refPathCStr,    /*Reference to find the index for*/
+    uint64_t lenFileUL,   /*Length of the reference file*/
+    uint64_t hashUL       /*Hash of the reference file*/
+) /*Finds the kept index made from a reference (mutex held)*/
+{ /*findKeptMapIdx*/
+
+    /*~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~\
+    ' Fun-15 TOC: Sec-1 Sub-1: findKeptMapIdx
+    \~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~*/
+
+    struct samMapIdx *idxST = 0;
+
+    for(int iIdx = 0; iIdx < defMapIdxKeep; ++iIdx)
+    { /*Loop: Check each kept index*/
+        idxST = keptMapIdxAryST[iIdx];
+
+        if(
+              idxST != 0
+           && idxST->lenFileUL == lenFileUL
+           && idxST->hashUL == hashUL
+           && strcmp(idxST->pathCStr, refPathCStr) == 0
+        ){ /*If this index is for this reference*/
+            ++idxST->numUsersUI;
+            idxST->lastUseUL = ++keptMapIdxUseUL;
+            return idxST;
+        } /*If this index is for this reference*/
+    } /*Loop: Check each kept index*/
+
+    return 0;
+} /*findKeptMapIdx*/
+
+#endif
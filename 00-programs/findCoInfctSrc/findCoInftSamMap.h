@@ -0,0 +1,172 @@
+/*######################################################################
+# Name: findCoInftSamMap
+# Use:
+#   o Maps reads (or consensuses) to a reference and hands each
+#     alignment back in a samEntry struct, one line at a time (like
+#     readSamLine).
+#   o The default build runs minimap2 (minimap2CMD) with popen and
+#     reads its sam output with readSamLine.
+#   o Compiling with -DLIBMINIMAP2 (and linking -lminimap2 -lz -lm
+#     -lpthread) maps in process with libminimap2 instead. The indexes
+#     of the last defMapIdxKeep references are kept in memory and
+#     reused until the reference file changes, so mapping to the
+#     same best read or consensus over several rounds only indexes
+#     it once. If the reference is too large for a single index
+#     part, the popen path is used instead.
+# Includes:
+#   - "defaultSettings.h"
+#   - "samEntryStruct.h"
+#   - "cStrFun.h"
+#   o "cStrToNumberFun.h"
+#   o <stdlib.h>
+#   o <stdio.h>
+#   o <stdint.h>
+#   o <string.h>
+# Libminimap2 build only:
+#   - "minimap.h"
+#   - <zlib.h>
+#   - <pthread.h>
+######################################################################*/
+
+#ifndef FINDCOINFTSAMMAP_H
+#define FINDCOINFTSAMMAP_H
+
+#include "defaultSettings.h"
+#include "samEntryStruct.h"
+#include "cStrFun.h"
+
+#ifdef LIBMINIMAP2
+   #include <zlib.h>
+   #include <pthread.h>
+   #include "minimap.h"
+#endif
+
+/*~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~\
+' findCoInftSamMap SOH:
+'   struct-1 samMapQry:
+'     o One query sequence and its alignments (libminimap2 only)
+'   struct-2 samMapper:
+'     o Holds an open mapping of a query file to a reference
+'   fun-1 openSamMapper:
+'     o Starts mapping a query file to a reference file
+'   fun-2 readSamMapper:
+'     o Reads the next sam header or alignment into a samEntry
+'   fun-3 closeSamMapper:
+'     o Stops mapping and frees the samMapper variables
+'   fun-4 freeSamMapIdx:
+'     o Frees the kept reference indexes (libminimap2 only)
+\~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~*/
+
+#define defMapBatch 512 /*Queries mapped at once (libminimap2 only)*/
+#define defMapIdxKeep 8 /*Reference indexes kept (libminimap2 only)*/
+
+#ifdef LIBMINIMAP2
+/*######################################################################
+# Struct-1: samMapQry
+# Use: Holds one query sequence and the alignments libminimap2 found
+#      for it
+######################################################################*/
+typedef struct samMapQry
+{ /*samMapQry*/
+    char *idCStr;          /*Query id (no '@' or '>')*/
+    char *seqCStr;         /*Query sequence*/
+    char *qCStr;           /*Q-score entry (0 if a fasta)*/
+    uint32_t lenSeqUI;     /*Length of seqCStr*/
+
+    uint32_t lenIdBuffUI;  /*Bytes allocated to idCStr*/
+    uint32_t lenSeqBuffUI; /*Bytes allocated to seqCStr and qCStr*/
+
+    mm_reg1_t *alnST;      /*Alignments from mm_map*/
+    int numAlnI;           /*Number of alignments in alnST*/
+}samMapQry;
+#endif
+
+/*######################################################################
+# Struct-2: samMapper
+# Use: Holds one mapping of a query file to a reference file. Use
+#      openSamMapper to set up, readSamMapper to get the sam entries,
+#      and closeSamMapper to free.
+######################################################################*/
+typedef struct samMapper
+{ /*samMapper*/
+    FILE *samFILE;         /*minimap2 sam output (popen path)*/
+
+    #ifdef LIBMINIMAP2
+       struct samMapIdx *idxST; /*Kept index of the reference*/
+       mm_mapopt_t mapOptST;    /*Mapping settings for minimap2*/
+
+       gzFile qryFILE;          /*File with query sequences*/
+       char *lineCStr;          /*Buffer for reading the query file*/
+       uint32_t lenLineUI;      /*Bytes allocated to lineCStr*/
+       char pendLineBl;         /*1: lineCStr has an unused header*/
+
+       struct samMapQry *qryAryST; /*Batch of mapped queries*/
+       uint32_t numQryUI;       /*Number queries in qryAryST*/
+       uint32_t onQryUI;        /*Query to print next*/
+       int onAlnI;              /*Alignment to print next*/
+       char eofBl;              /*1: no queries left to read*/
+
+       uint32_t onHeadUI;       /*Next header line to print*/
+
+       int numThreadsI;         /*Number threads to map with*/
+       mm_tbuf_t **tBuffAryST;  /*Thread buffers (one a thread)*/
+    #endif
+}samMapper;
+
+/*---------------------------------------------------------------------\
+| Output:
+|   - Modifies:
+|     o mapST to be ready for readSamMapper
+|   - Returns:
+|     o 1 for success
+|     o 2 if minimap2 could not be run or the reference/query files
+|       could not be opened
+|     o 64 for a memory allocation error
+\---------------------------------------------------------------------*/
+uint8_t openSamMapper(
+    char *refPathCStr,        /*Reference to map to (fasta/fastq)*/
+    char *qryPathCStr,        /*Sequences to map (fasta/fastq)*/
+    char *threadsCStr,        /*Number of threads to use*/
+    struct samMapper *mapST   /*Set up to map qryPathCStr*/
+); /*Starts mapping a query file to a reference file*/
+
+/*---------------------------------------------------------------------\
+| Output:
+|   - Modifies:
+|     o samST to hold the next header or alignment. The header lines
+|       (@SQ and @PG) come first, then one line for each primary or
+|       supplemental alignment or unmapped query. Secondary
+|       alignments are not output.
+|   - Returns:
+|     o 1 if succeded
+|     o 2 if end of file (no more alignments)
+|     o 64 if memory allocation error
+\---------------------------------------------------------------------*/
+uint8_t readSamMapper(
+    struct samEntry *samST,   /*Gets the next sam entry*/
+    struct samMapper *mapST   /*Mapping to get entry from*/
+); /*Reads the next sam header or alignment into a samEntry*/
+
+/*---------------------------------------------------------------------\
+| Output:
+|   - Closes:
+|     o minimap2 (popen path) or the query file
+|   - Frees:
+|     o Variables in mapST (mapST is not freed). The reference index
+|       is kept for the next openSamMapper call
+\---------------------------------------------------------------------*/
+void closeSamMapper(
+    struct samMapper *mapST   /*Mapping to close*/
+); /*Stops mapping and frees the samMapper variables*/
+
+/*---------------------------------------------------------------------\
+| Output:
+|   - Frees:
+|     o The kept reference indexes that are not in use. Does nothing
+|       for the popen path.
+\---------------------------------------------------------------------*/
+void freeSamMapIdx(
+    void
+); /*Frees the kept reference indexes (libminimap2 only)*/
+
+#endif
@@ -4,6 +4,7 @@
 # Non c-standard includes:
 #   - "minAlnStatsStruct.h"
 #   - "fqGetIdsFqFun.h"      (For moving through a fastq file)
+#   - "fqGetIdsBlockScan.h"  (Finds the end of fastq entries)
 #   - "FCIStatsFun.h"
 #   o "defaultSettings.h"
 #   o "samEntryStruct.h"
@@ -16,6 +17,7 @@
 ######################################################################*/
 
 #include "fqAndFaFun.h"
+#include "fqGetIdsBlockScan.h"
 
 /*~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~\
 ' findCoInftMisc SOF:
@@ -34,6 +36,12 @@
 '     o Filters reads in a fastq file by length and mean/median Q-score
 '   fun-7 moveToNextFastqEntry:
 '     o Move to next entry in buffer holding data from a fastq file
+'   fun-8 checkGzipFile:
+'     o Checks if a file is gzip or BGZF compressed
+'   fun-9 openFastqFile:
+'     o Opens a fastq file for reading, gzip files are uncompressed
+'   fun-10 closeFastqFile:
+'     o Closes a fastq file opened with openFastqFile
 \~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~*/
 
 /*---------------------------------------------------------------------\
@@ -462,17 +470,24 @@ unsigned long getNumReadsInFq(
     char buffCS[1024];
     uint64_t tmpUL = 1024;
     unsigned long numReadsUL = 0;
-    FILE *fqFILE = fopen(fqFileCStr, "r");
+    uint8_t pipeBl = 0;  /*1: fastq is gzip compressed*/
+    FILE *fqFILE = 0;
 
     if(fqFileCStr == 0)
         return 0; /*No fastq file to work with*/
 
+    fqFILE = openFastqFile(fqFileCStr, &pipeBl);
+
+    if(fqFILE == 0)
+        return 0;
+
     tmpCS = buffCS;
     buffCS[0] = '\0';
 
      while(moveToNextFastqEntry(buffCS, &tmpCS,1024, &tmpUL,fqFILE) & 2)
          ++numReadsUL;
 
+     closeFastqFile(fqFILE, pipeBl);
      return numReadsUL;
 } /*getnUmReadsInFq*/
 
@@ -565,6 +580,7 @@ unsigned char filterReads(
     \<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<*/
 
     unsigned char errUC = 0;
+    uint8_t pipeBl = 0;  /*1: fastq is gzip compressed*/
     FILE *fqFILE = 0;
     FILE *outFILE = 0;
 
@@ -572,10 +588,7 @@ unsigned char filterReads(
     ^ Fun-6 Sec-2: Check if input files are valid
     \<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<*/
 
-    if(fqCStr == 0)
-        fqFILE = stdin;
-    else
-        fqFILE = fopen(fqCStr, "r");
+    fqFILE = openFastqFile(fqCStr, &pipeBl); /*0 is stdin*/
 
     if(fqFILE == 0)
         return 2;
@@ -587,7 +600,7 @@ unsigned char filterReads(
 
     if(outFILE == 0)
     { /*If I could not open the output file*/
-        fclose(fqFILE);
+        closeFastqFile(fqFILE, pipeBl);
         return 4;
     } /*If I could not open the output file*/
 
@@ -630,7 +643,7 @@ unsigned char filterReads(
     ^ Fun-6 Sec-4: Clean up
     \<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<*/
 
-    fclose(fqFILE);
+    closeFastqFile(fqFILE, pipeBl);
     fclose(outFILE);
 
     if(errUC != 0)
@@ -660,140 +673,167 @@ uint8_t moveToNextFastqEntry(
     /*~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~\
     ^ Fun-7 TOC:
     ^     fun-7 sec-1: Variable declerations
-    ^     fun-7 sec-2: Move past header
-    ^     fun-7 sec-3: Find number newlines in sequence & move to spacer
-    ^     fun-7 sec-4: Move past spacer
-    ^     fun-7 Sec-5: Move past Q-score entry
+    ^     fun-7 sec-2: Find the end of the entry (64 byte blocks)
     ~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~*/
 
     /*>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>
     ^ Fun-7 Sec-1: Variable declerations
     <<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<*/
 
-    unsigned long numSeqlinesULng = 0;  /*number of '\n' in sequence*/
-
-    /*>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>\
-    ^ Fun-7 Sec-2: Move past header
-    \<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<*/
- 
-    while(**pointInBufferCStr != '\n')
-    { /*While on header, move to sequence line*/
-
-        if(**pointInBufferCStr == '\0')
-        { /*If ran out of buffer & need to read in more of the file*/
-
-            if(*lenInputULng < buffSizeInt)
-                return 0;         /*Is not a complete fastq file*/
+    char *nextEntryCStr = 0;
+    struct fqBlockScan scanST;   /*Kept between buffers*/
 
-            *lenInputULng = fread(bufferCStr,
-                                 sizeof(char),
-                                 buffSizeInt,
-                                 fastqFile
-            ); /*Read in more of the file*/
-
-            *(bufferCStr + *lenInputULng) = '\0';/*make a c-string*/
-            *pointInBufferCStr = bufferCStr;
-            continue;                           /*so can check if '\n'*/
-        } /*If ran out of buffer & need to read more of the file*/
-
-        (*pointInBufferCStr)++;
-    } /*While on header, move to sequence line*/
-
-    ++(*pointInBufferCStr); /*get off the new line*/
+    initFqBlockScan(&scanST);
 
     /*>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>\
-    ^ Fun-7 Sec-3: Find number new lines in seqence line & move to spacer
+    ^ Fun-7 Sec-2: Find the end of the entry (64 byte blocks)
     \<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<*/
 
-    while(**pointInBufferCStr != '+')
-    { /*While on sequence, count number new lines & move to spacer*/
-
-        if(**pointInBufferCStr == '\0')
-        { /*If ran out of buffer & need to read in more of the file*/
-
-            if(*lenInputULng < buffSizeInt)
-                return 0;         /*Is not a complete fastq file*/
-
-            *lenInputULng = fread(bufferCStr,
-                                 sizeof(char),
-                                 buffSizeInt,
-                                 fastqFile
-            ); /*Read in more of the file*/
+    nextEntryCStr =
+        scanFqBlocks(
+            &scanST,
+            *pointInBufferCStr,
+            bufferCStr + *lenInputULng
+    );
+
+    while(nextEntryCStr == 0)
+    { /*While ran out of buffer & need to read in more of the file*/
+        if(*lenInputULng < buffSizeInt)
+        { /*If at end of the file*/
+            *pointInBufferCStr = bufferCStr + *lenInputULng;
+
+            if(fqBlockScanEndOk(&scanST))
+                return 4;     /*At end of file & on last line*/
+            else
+                return 0;     /*Is not a complete fastq file*/
+        } /*If at end of the file*/
+
+        *lenInputULng = fread(bufferCStr,
+                             sizeof(char),
+                             buffSizeInt,
+                             fastqFile
+        ); /*Read in more of the file*/
+
+        *(bufferCStr + *lenInputULng) = '\0';/*make a c-string*/
+        *pointInBufferCStr = bufferCStr;
+
+        nextEntryCStr =
+            scanFqBlocks(
+                &scanST,
+                bufferCStr,
+                bufferCStr + *lenInputULng
+        );
+    } /*While ran out of buffer & need to read in more of the file*/
+
+    *pointInBufferCStr = nextEntryCStr;
+    return 2; /*Copied name sucessfully*/
+} /*moveToNextFastqEntry*/
 
-            *(bufferCStr + *lenInputULng) = '\0';/*make a c-string*/
-            *pointInBufferCStr = bufferCStr;
-            continue;                           /*so can check if '\n'*/
-        } /*If ran out of buffer & need to read more of the file*/
+/*---------------------------------------------------------------------\
+| Output:
+|   - Returns:
+|     o defNotGzip if inFILE is not gzip compressed
+|     o defGzip if inFILE is gzip compressed
+|     o defBgzf if inFILE is gzip compressed in BGZF blocks
+|   - Modifies:
+|     o inFILE to be at its start
+\---------------------------------------------------------------------*/
+uint8_t checkGzipFile(
+    FILE *inFILE  /*File to check (not stdin)*/
+) /*Checks if a file is gzip or BGZF compressed*/
+{ /*checkGzipFile*/
 
-        if(**pointInBufferCStr == '\n')
-            numSeqlinesULng++; /*count new lines, for q-score entry*/
+    /*~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~\
+    ' Fun-8 TOC: checkGzipFile
+    '   - Gzip files start with 0x1f 0x8b. BGZF blocks are gzip members
+    '     with the FEXTRA flag (4) set and a "BC" extra sub-field that
+    '     has the size of the block (SAM/BAM spec section 4.1)
+    \~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~*/
 
-        (*pointInBufferCStr)++;
-    } /*While on sequence, count number new lines & move to spacer*/
+    unsigned char headAryUC[18];
+    size_t lenHeadUL = fread(headAryUC, sizeof(char), 18, inFILE);
 
-    /*>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>\
-    ^ Fun-7 Sec-4: Move past spacer entry
-    \<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<*/
- 
-    while(**pointInBufferCStr != '\n')
-    { /*While on the spacer entry*/
+    fseek(inFILE, 0, SEEK_SET);
 
-        if(**pointInBufferCStr == '\0')
-        { /*If ran out of buffer & need to read in more of the file*/
+    if(lenHeadUL < 2 || headAryUC[0] != 0x1f || headAryUC[1] != 0x8b)
+        return defNotGzip;
 
-            if(*lenInputULng < buffSizeInt)
-                return 0;         /*Is not a complete fastq file*/
+    if(
+          lenHeadUL == 18
+       && headAryUC[2] == 8          /*deflate*/
+       && (headAryUC[3] & 4)         /*Has extra fields*/
+       && headAryUC[10] == 6 && headAryUC[11] == 0 /*XLEN*/
+       && headAryUC[12] == 'B' && headAryUC[13] == 'C'
+       && headAryUC[14] == 2 && headAryUC[15] == 0 /*SLEN*/
+    ) return defBgzf;
 
-            *lenInputULng = fread(bufferCStr,
-                                 sizeof(char),
-                                 buffSizeInt,
-                                 fastqFile
-            ); /*Read in more of the file*/
+    return defGzip;
+} /*checkGzipFile*/
 
-            *(bufferCStr + *lenInputULng) = '\0';/*make a c-string*/
-            *pointInBufferCStr = bufferCStr;
-            continue;                           /*so can check if '\n'*/
-        } /*If ran out of buffer & need to read more of the file*/
+/*---------------------------------------------------------------------\
+| Output:
+|   - Returns:
+|     o FILE pointer to the uncompressed fastq file
+|       - stdin if fqCStr is 0
+|       - gzip -dc output (popen) if fqCStr is gzip compressed
+|     o 0 if could not open fqCStr
+|   - Modifies:
+|     o pipeBl to be 1 if the FILE must be closed with pclose
+\---------------------------------------------------------------------*/
+FILE * openFastqFile(
+    char *fqCStr,   /*Path to fastq (can be .gz) to open (0 for stdin)*/
+    uint8_t *pipeBl /*Set to 1 if opened with popen, else 0*/
+) /*Opens a fastq file for reading, gzip files are uncompressed*/
+{ /*openFastqFile*/
 
-        (*pointInBufferCStr)++;
-    } /*While on the spacer entry*/
+    /*~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~\
+    ' Fun-9 TOC: openFastqFile
+    '   - The fastq readers all use fread, so gzip files are read from
+    '     a gzip -dc pipe instead of being uncompressed to disk first
+    \~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~*/
 
-    ++(*pointInBufferCStr); /*get off the new line*/
+    char gzipCmdCStr[2048];  /*Holds the gzip command to run*/
+    FILE *fqFILE = 0;
 
-    /*>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>\
-    ^ Fun-7 Sec-5: Move past q-score entry (has same # of lines as seq)
-    \<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<*/
+    *pipeBl = 0;
 
-    while(numSeqlinesULng > 0)
-    { /*While have q-score entry lines to print out*/
+    if(fqCStr == 0)
+        return stdin;
 
-        if(**pointInBufferCStr == '\0')
-        { /*If ran out of buffer & need to read in more of the file*/
+    fqFILE = fopen(fqCStr, "r");
 
-            if(*lenInputULng < buffSizeInt)
-            { /*If at end of the file*/
-                if(numSeqlinesULng > 1)
-                    return 0;        /*Missing q-score lines for entry*/
-                else
-                    return 4;     /*At end of file & printed last line*/
-            } /*If at end of the file*/
+    if(fqFILE == 0)
+        return 0;
 
-            *lenInputULng = fread(bufferCStr,
-                                 sizeof(char),
-                                 buffSizeInt,
-                                 fastqFile
-            ); /*Read in more of the file*/
+    if(checkGzipFile(fqFILE) == defNotGzip)
+        return fqFILE;
 
-            *(bufferCStr + *lenInputULng) = '\0';/*make a c-string*/
-            *pointInBufferCStr = bufferCStr;
-            continue;                           /*so can check if '\n'*/
-        } /*If ran out of buffer & need to read more of the file*/
+    fclose(fqFILE);
 
-        if(**pointInBufferCStr == '\n')
-            numSeqlinesULng--;
+    if(
+         snprintf(gzipCmdCStr, 2048, "gzip -dc \"%s\"", fqCStr)
+      >= 2048
+    ) return 0; /*Path is to long for the command*/
 
-        (*pointInBufferCStr)++;
-    } /*While have q-score entry lines to print out*/
+    *pipeBl = 1;
+    return popen(gzipCmdCStr, "r");
+} /*openFastqFile*/
 
-    return 2; /*Copied name sucessfully*/
-} /*moveToNextFastqEntry*/
+/*---------------------------------------------------------------------\
+| Output:
+|   - Closes:
+|     o fqFILE (unless it is stdin)
+\---------------------------------------------------------------------*/
+void closeFastqFile(
+    FILE *fqFILE,  /*Fastq file from openFastqFile*/
+    uint8_t pipeBl /*pipeBl openFastqFile set*/
+) /*Closes a fastq file opened with openFastqFile*/
+{ /*closeFastqFile*/
+    if(fqFILE == 0 || fqFILE == stdin)
+        return;
+
+    if(pipeBl)
+        pclose(fqFILE);
+    else
+        fclose(fqFILE);
+} /*closeFastqFile*/
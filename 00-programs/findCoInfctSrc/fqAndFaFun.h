@@ -20,6 +20,11 @@
 #include "minAlnStatsStruct.h"
 #include "FCIStatsFun.h"
 
+/*Types of compression checkGzipFile finds*/
+#define defNotGzip 0 /*Plain text*/
+#define defGzip 1    /*Gzip compressed*/
+#define defBgzf 2    /*Gzip compressed with indepentent (BGZF) blocks*/
+
 /*---------------------------------------------------------------------\
 | Output:
 |   o Creates:
@@ -142,4 +147,39 @@ uint8_t moveToNextFastqEntry(
     FILE *fastqFile               /*Fastq file to get data from*/
 ); /*Moves to next fastq read, without printing out*/
 
+/*---------------------------------------------------------------------| Output:
+|   - Returns:
+|     o defNotGzip if inFILE is not gzip compressed
+|     o defGzip if inFILE is gzip compressed
+|     o defBgzf if inFILE is gzip compressed in BGZF blocks
+|   - Modifies:
+|     o inFILE to be at its start
+\---------------------------------------------------------------------*/
+uint8_t checkGzipFile(
+    FILE *inFILE  /*File to check (not stdin)*/
+); /*Checks if a file is gzip or BGZF compressed*/
+
+/*---------------------------------------------------------------------| Output:
+|   - Returns:
+|     o FILE pointer to the uncompressed fastq file
+|       - stdin if fqCStr is 0
+|       - gzip -dc output (popen) if fqCStr is gzip compressed
+|     o 0 if could not open fqCStr
+|   - Modifies:
+|     o pipeBl to be 1 if the FILE must be closed with pclose
+\---------------------------------------------------------------------*/
+FILE * openFastqFile(
+    char *fqCStr,   /*Path to fastq (can be .gz) to open (0 for stdin)*/
+    uint8_t *pipeBl /*Set to 1 if opened with popen, else 0*/
+); /*Opens a fastq file for reading, gzip files are uncompressed*/
+
+/*---------------------------------------------------------------------| Output:
+|   - Closes:
+|     o fqFILE (unless it is stdin)
+\---------------------------------------------------------------------*/
+void closeFastqFile(
+    FILE *fqFILE,  /*Fastq file from openFastqFile*/
+    uint8_t pipeBl /*pipeBl openFastqFile set*/
+); /*Closes a fastq file opened with openFastqFile*/
+
 #endif
@@ -13,6 +13,7 @@
 #      - Do not use with stdin-fastq (will break)
 #    -fastq file.fastq:
 #      - Fastq file to filter reads from                     [Required]
+#      - Can be gzip compressed (.fastq.gz)
 #      -no-hash:
 #          - Use a tree search instead of hashing.           [Default: hashing]
 #              - Default search is hash combined with tree. 
@@ -110,6 +111,7 @@ int main(int lenArgsInt, char *argsCStr[])
             \n      - Take filter file from stdin            [Default: not set]\
             \n    -fastq file.fastq:\
             \n      - Fastq file to filter reads from        [Required]\
+            \n      - Can be gzip compressed (.fastq.gz)\
             \n    - out:\
             \n      - Name of file to output reads to        [stdout]\
             \n    -no-hash:\
@@ -166,6 +168,7 @@ int main(int lenArgsInt, char *argsCStr[])
         fprintf(
             stdout,  /*stdout so user can pipe & grab easily*/
             "fqGetIds from findCoInft version: %.8f\n",
+            defVersion
         ); /*Print out the version number*/
         exit(0);
     } /*Else if the user wanted the version number*/
@@ -387,6 +390,13 @@ char * checkInput(int *lenArgsInt,        /*Number of arugments user input*/
     while(*tmpCStr != '\0')
         tmpCStr++;            /*find the end of the file name*/
 
+    if(
+        tmpCStr - *fastqFileCStr > 3 &&
+        *(tmpCStr - 1) == 'z' &&
+        *(tmpCStr - 2) == 'g' &&
+        *(tmpCStr - 3) == '.'
+    ) tmpCStr -= 3;   /*Gzip compressed fastq files (.fastq.gz) are fine*/
+
     if(
         *(tmpCStr - 1) != 'q' ||
         *(tmpCStr - 2) != 't' ||
@@ -398,7 +408,7 @@ char * checkInput(int *lenArgsInt,        /*Number of arugments user input*/
     { /*If input is not a fastq file*/
         fprintf(
             stderr,
-            "%s is not a fastq file (should end in .fastq)\n",
+            "%s is not a fastq file (should end in .fastq(.gz))\n",
             *fastqFileCStr
         ); /*Warn user that provided fastq file is not a fastq file*/
 
@@ -0,0 +1,267 @@
+/*#########################################################
+# Name: fqGetIdsArena
+# Use:
+#  - Bump pointer arena for the readInfo/bigNum nodes in
+#    the hash table or tree
+# Libraries:
+#  - "fqGetIdsArena.h"
+# C Standard Libraries
+#  o <stdint.h>
+#  o <stdlib.h>
+#  o <string.h>
+#  o <sys/mman.h> (-DHUGEPAGES only)
+#########################################################*/
+
+/*~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~\
+' SOF: Start Of Functions
+' o fun-01 makeMemArena:
+'   - Makes an arena with one block
+' o fun-02 arenaAlloc:
+'   - Gets memory from an arena
+' o fun-03 arenaRealloc:
+'   - Grows the last allocation in an arena (or copies)
+' o fun-04 freeMemArena:
+'   - Frees every block in an arena
+' o fun-05 addArenaBlock:
+'   - Adds a new block to an arena (static)
+\~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~*/
+
+#ifdef HUGEPAGES
+   #ifndef _DEFAULT_SOURCE
+      #define _DEFAULT_SOURCE /*MAP_ANONYMOUS & madvise (glibc)*/
+   #endif
+
+   #include <sys/mman.h>
+#endif
+
+#include <stdlib.h>
+#include <string.h>
+#include "fqGetIdsArena.h"
+
+/*Rounds a number of bytes up to the arena alignment*/
+#define arenaRoundUp(lenBytesUL)(\
+   ((lenBytesUL) + defArenaAlign - 1) & ~((uint64_t) defArenaAlign - 1)\
+)
+
+static uint8_t addArenaBlock(
+    struct memArena *arenaST,
+    uint64_t lenBytesUL
+);
+
+/*--------------------------------------------------------\
+| Output:
+|  - Returns:
+|    o Pointer to a memArena with one empty block
+|    o 0 if had a memory allocation error
+\--------------------------------------------------------*/
+struct memArena * makeMemArena(
+){ /*~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~\
+   ' Fun-01 TOC: makeMemArena
+   '  - Makes an arena with one block
+   \~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~*/
+
+    struct memArena *arenaST = malloc(sizeof(struct memArena));
+
+    if(arenaST == 0) return 0;
+
+    arenaST->blockList = 0;
+    arenaST->posCStr = 0;
+    arenaST->endCStr = 0;
+    arenaST->lastCStr = 0;
+
+    if(addArenaBlock(arenaST, 0) == 0)
+    { /*If could not make the first block*/
+        free(arenaST);
+        return 0;
+    } /*If could not make the first block*/
+
+    return arenaST;
+} /*makeMemArena*/
+
+/*--------------------------------------------------------\
+| Output:
+|  - Returns:
+|    o Pointer to lenBytesUL bytes (8 byte aligned)
+|    o 0 if had a memory allocation error
+|  - Modifies:
+|    o arenaST to have a new block if the newest block
+|      did not have room
+\--------------------------------------------------------*/
+void * arenaAlloc(
+    struct memArena *arenaST, /*Arena to get memory from*/
+    uint64_t lenBytesUL       /*Number of bytes wanted*/
+){ /*~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~\
+   ' Fun-02 TOC: arenaAlloc
+   '  - Gets memory from an arena
+   '  o fun-02 sec-01:
+   '    - Try the newest block
+   '  o fun-02 sec-02:
+   '    - Add a new block
+   \~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~*/
+
+    /*>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>\
+    ^ Fun-02 Sec-01:
+    ^  - Try the newest block
+    \<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<*/
+
+    lenBytesUL = arenaRoundUp(lenBytesUL);
+
+    if((uint64_t) (arenaST->endCStr - arenaST->posCStr) < lenBytesUL)
+    { /*If the newest block is full*/
+
+        /*>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>\
+        ^ Fun-02 Sec-02:
+        ^  - Add a new block
+        \<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<*/
+
+        /*The rest of the old block is lost. This is at most
+        ` one node per block, since nodes are small.
+        */
+        if(addArenaBlock(arenaST, lenBytesUL) == 0) return 0;
+    } /*If the newest block is full*/
+
+    arenaST->lastCStr = arenaST->posCStr;
+    arenaST->posCStr += lenBytesUL;
+
+    return arenaST->lastCStr;
+} /*arenaAlloc*/
+
+/*--------------------------------------------------------\
+| Output:
+|  - Returns:
+|    o Pointer to lenBytesUL bytes with the first
+|      oldBytesUL bytes of oldPtr. This is oldPtr if oldPtr
+|      was the last allocation and the block has room.
+|    o 0 if had a memory allocation error (oldPtr is kept)
+\--------------------------------------------------------*/
+void * arenaRealloc(
+    struct memArena *arenaST, /*Arena oldPtr is from*/
+    void *oldPtr,             /*Memory to grow*/
+    uint64_t oldBytesUL,      /*Bytes in oldPtr*/
+    uint64_t lenBytesUL       /*Number of bytes wanted*/
+){ /*~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~\
+   ' Fun-03 TOC: arenaRealloc
+   '  - Grows the last allocation in an arena. If oldPtr is
+   '    not the last allocation or the block is full, this
+   '    copies oldPtr to a new allocation (oldPtr is lost
+   '    until the arena is freed).
+   \~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~*/
+
+    char *newCStr = 0;
+
+    if(
+          (char *) oldPtr == arenaST->lastCStr
+       && (uint64_t) (arenaST->endCStr - arenaST->lastCStr)
+            >= arenaRoundUp(lenBytesUL)
+    ){ /*If can grow in place*/
+        arenaST->posCStr = arenaST->lastCStr + arenaRoundUp(lenBytesUL);
+        return oldPtr;
+    } /*If can grow in place*/
+
+    newCStr = arenaAlloc(arenaST, lenBytesUL);
+    if(newCStr == 0) return 0;
+
+    if(oldPtr != 0) memcpy(newCStr, oldPtr, oldBytesUL);
+    return newCStr;
+} /*arenaRealloc*/
+
+/*--------------------------------------------------------\
+| Output:
+|  - Frees:
+|    o Every block in arenaST, arenaST, and sets arenaST
+|      to 0
+\--------------------------------------------------------*/
+void freeMemArena(
+    struct memArena **arenaST /*Arena to free*/
+){ /*~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~\
+   ' Fun-04 TOC: freeMemArena
+   '  - Frees every block in an arena
+   \~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~*/
+
+    struct arenaBlock *blockST = 0;
+    struct arenaBlock *nextBlock = 0;
+
+    if(*arenaST == 0) return;
+
+    blockST = (*arenaST)->blockList;
+
+    while(blockST != 0)
+    { /*Loop: Free each block*/
+        nextBlock = blockST->nextBlock;
+
+        #ifdef HUGEPAGES
+           if(blockST->mapBl)
+               munmap(blockST, blockST->lenBlockUL);
+           else
+               free(blockST);
+        #else
+           free(blockST);
+        #endif
+
+        blockST = nextBlock;
+    } /*Loop: Free each block*/
+
+    free(*arenaST);
+    *arenaST = 0;
+} /*freeMemArena*/
+
+/*--------------------------------------------------------\
+| Output:
+|  - Modifies:
+|    o arenaST to have a new block (with at least
+|      lenBytesUL free bytes) at the head of blockList
+|  - Returns:
+|    o 1 if made the block
+|    o 0 if had a memory allocation error
+\--------------------------------------------------------*/
+static uint8_t addArenaBlock(
+    struct memArena *arenaST, /*Arena to add a block to*/
+    uint64_t lenBytesUL       /*Bytes the block must have*/
+){ /*~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~\
+   ' Fun-05 TOC: addArenaBlock
+   '  - Adds a new block to an arena
+   \~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~*/
+
+    uint64_t lenBlockUL = defArenaBlockBytes;
+    uint64_t lenHeadUL = arenaRoundUp(sizeof(struct arenaBlock));
+    struct arenaBlock *blockST = 0;
+
+    if(lenBytesUL + lenHeadUL > lenBlockUL)
+        lenBlockUL = lenBytesUL + lenHeadUL; /*Large request*/
+
+    #if defined(HUGEPAGES) && defined(MAP_ANONYMOUS) && defined(MADV_HUGEPAGE)
+       blockST =
+          mmap(
+             0,
+             lenBlockUL,
+             PROT_READ | PROT_WRITE,
+             MAP_PRIVATE | MAP_ANONYMOUS,
+             -1,
+             0
+          ); /*Map the block*/
+
+       if(blockST == MAP_FAILED) blockST = 0;
+       else
+       { /*Else ask for huge pages (ok if kernel says no)*/
+           madvise(blockST, lenBlockUL, MADV_HUGEPAGE);
+           blockST->mapBl = 1;
+       } /*Else ask for huge pages (ok if kernel says no)*/
+    #endif
+
+    if(blockST == 0)
+    { /*If not using huge pages (or mmap failed)*/
+        blockST = malloc(lenBlockUL);
+        if(blockST == 0) return 0;
+        blockST->mapBl = 0;
+    } /*If not using huge pages (or mmap failed)*/
+
+    blockST->lenBlockUL = lenBlockUL;
+    blockST->nextBlock = arenaST->blockList;
+    arenaST->blockList = blockST;
+
+    arenaST->posCStr = (char *) blockST + lenHeadUL;
+    arenaST->endCStr = (char *) blockST + lenBlockUL;
+    arenaST->lastCStr = 0;
+
+    return 1;
+} /*addArenaBlock*/
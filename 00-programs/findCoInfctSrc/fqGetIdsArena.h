@@ -0,0 +1,141 @@
+/*#########################################################
+# Name: fqGetIdsArena
+# Use:
+#  - Bump pointer arena for the readInfo/bigNum nodes in
+#    the hash table or tree. Nodes are carved out of large
+#    blocks, so there is no malloc header on each node and
+#    the whole table is freed by freeing the blocks, not by
+#    walking every tree.
+#  - Nodes from an arena can not be freed one at a time,
+#    so do not call freeReadTree or freeReadInfoStruct on
+#    them. Free the arena with freeMemArena.
+#  - Compile with -DHUGEPAGES to map the blocks with mmap
+#    and ask for transparent huge pages (fewer TLB misses
+#    on large id lists). Falls back to malloc if the system
+#    does not have MAP_ANONYMOUS or MADV_HUGEPAGE.
+# C Standard Libraries
+#  o <stdint.h>
+#  o <stdlib.h>
+#  o <string.h>
+#  o <sys/mman.h> (-DHUGEPAGES only)
+#########################################################*/
+
+#ifndef FQGETIDSARENA_H
+#define FQGETIDSARENA_H
+
+#include <stdint.h>
+
+/*~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~\
+' SOH: Start Of Header
+' o st-01 arenaBlock:
+'   - One block of memory in an arena
+' o st-02 memArena:
+'   - List of blocks and the bump pointer
+' o fun-01 makeMemArena:
+'   - Makes an arena with one block
+' o fun-02 arenaAlloc:
+'   - Gets memory from an arena
+' o fun-03 arenaRealloc:
+'   - Grows the last allocation in an arena (or copies)
+' o fun-04 freeMemArena:
+'   - Frees every block in an arena
+\~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~*/
+
+#define defArenaAlign 8 /*Every allocation is 8 byte aligned*/
+
+#ifdef HUGEPAGES
+   #define defArenaBlockBytes (1 << 23) /*8Mb (2Mb huge pages)*/
+#else
+   #define defArenaBlockBytes (1 << 20) /*1Mb*/
+#endif
+
+/*--------------------------------------------------------\
+| ST-01: arenaBlock
+|  - Header at the start of each block. The memory handed
+|    out starts after the header.
+\--------------------------------------------------------*/
+typedef struct arenaBlock
+{ /*arenaBlock*/
+    struct arenaBlock *nextBlock; /*Block made before this*/
+    uint64_t lenBlockUL;          /*Bytes in block (+header)*/
+    uint8_t mapBl;                /*1: mmap'ed, 0: malloc'ed*/
+}arenaBlock;
+
+/*--------------------------------------------------------\
+| ST-02: memArena
+|  - The newest block is at the head of blockList and is
+|    the only one memory is handed out from
+\--------------------------------------------------------*/
+typedef struct memArena
+{ /*memArena*/
+    struct arenaBlock *blockList; /*Newest block first*/
+    char *posCStr;                /*Next free byte*/
+    char *endCStr;                /*End of the newest block*/
+    char *lastCStr;               /*Last allocation (realloc)*/
+}memArena;
+
+/*--------------------------------------------------------\
+| Output:
+|  - Returns:
+|    o Pointer to a memArena with one empty block
+|    o 0 if had a memory allocation error
+\--------------------------------------------------------*/
+struct memArena * makeMemArena(
+); /*~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~\
+   ' Fun-01 TOC: makeMemArena
+   '  - Makes an arena with one block
+   \~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~*/
+
+/*--------------------------------------------------------\
+| Output:
+|  - Returns:
+|    o Pointer to lenBytesUL bytes (8 byte aligned)
+|    o 0 if had a memory allocation error
+|  - Modifies:
+|    o arenaST to have a new block if the newest block
+|      did not have room
+\--------------------------------------------------------*/
+void * arenaAlloc(
+    struct memArena *arenaST, /*Arena to get memory from*/
+    uint64_t lenBytesUL       /*Number of bytes wanted*/
+); /*~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~\
+   ' Fun-02 TOC: arenaAlloc
+   '  - Gets memory from an arena
+   '  o fun-02 sec-01:
+   '    - Try the newest block
+   '  o fun-02 sec-02:
+   '    - Add a new block
+   \~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~*/
+
+/*--------------------------------------------------------\
+| Output:
+|  - Returns:
+|    o Pointer to lenBytesUL bytes with the first
+|      oldBytesUL bytes of oldPtr. This is oldPtr if oldPtr
+|      was the last allocation and the block has room.
+|    o 0 if had a memory allocation error (oldPtr is kept)
+\--------------------------------------------------------*/
+void * arenaRealloc(
+    struct memArena *arenaST, /*Arena oldPtr is from*/
+    void *oldPtr,             /*Memory to grow*/
+    uint64_t oldBytesUL,      /*Bytes in oldPtr*/
+    uint64_t lenBytesUL       /*Number of bytes wanted*/
+); /*~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~\
+   ' Fun-03 TOC: arenaRealloc
+   '  - Grows the last allocation in an arena (or copies)
+   \~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~*/
+
+/*--------------------------------------------------------\
+| Output:
+|  - Frees:
+|    o Every block in arenaST, arenaST, and sets arenaST
+|      to 0
+\--------------------------------------------------------*/
+void freeMemArena(
+    struct memArena **arenaST /*Arena to free*/
+); /*~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~\
+   ' Fun-04 TOC: freeMemArena
+   '  - Frees every block in an arena
+   \~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~*/
+
+#endif
@@ -0,0 +1,196 @@
+/*######################################################################
+# Name: fqGetIdsBgzf
+# Use:
+#    Splits a BGZF (block gzip) fastq file into sections of whole
+#    blocks. BGZF blocks are separate gzip members, so each section
+#    can be uncompressed by its own thread.
+######################################################################*/
+
+/*~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~\
+' SOF: Start of Functions
+'   - fun-1 makeBgzfSections:
+'     o Splits a BGZF file into sections of whole blocks
+'   - fun-2 freeBgzfSections:
+'     o Frees a bgzfSections struct
+\~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~*/
+
+#include "fqGetIdsBgzf.h"
+
+/*---------------------------------------------------------------------\
+| Output:
+|   - Returns:
+|     o bgzfSections with about lenSectionUL uncompressed bytes per
+|       section (less if needed to give each thread a section)
+|     o 0 if bgzfFILE is not all BGZF blocks or had a memory error
+|   - Modifies:
+|     o bgzfFILE to be at its start
+\---------------------------------------------------------------------*/
+struct bgzfSections * makeBgzfSections(
+    FILE *bgzfFILE,             /*BGZF file to split up*/
+    unsigned long lenSectionUL, /*Uncompressed bytes per section*/
+    unsigned char numThreadsUC  /*Number of threads to split for*/
+) /*Splits a BGZF file into sections of whole blocks*/
+{ /*makeBgzfSections*/
+
+    /*~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~\
+    ' Fun-1 TOC: makeBgzfSections
+    '    fun-1 sec-1: Variable declerations
+    '    fun-1 sec-2: Find the start and uncompressed size of each block
+    '    fun-1 sec-3: Group the blocks into sections
+    \~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~*/
+
+    /*>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>\
+    ^ Fun-1 Sec-1: Variable declerations
+    \<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<*/
+
+    unsigned char headAryUC[18]; /*BGZF block header*/
+    unsigned char sizeAryUC[4];  /*ISIZE (uncompressed size) of block*/
+
+    unsigned long posUL = 0;      /*Start of the block on*/
+    unsigned long lenBlockUL = 0; /*Compressed size of the block on*/
+    unsigned long lenAllUL = 0;   /*Uncompressed size of the file*/
+    unsigned long lenSecUL = 0;   /*Uncompressed size of section on*/
+
+    /*Start and uncompressed size of every block*/
+    unsigned long *blockStartAryUL = 0;
+    unsigned long *blockLenAryUL = 0;
+    unsigned long numBlocksUL = 0;
+    unsigned long maxBlocksUL = 0;
+    void *tmpPtr = 0;
+
+    struct bgzfSections *bgzfST = 0;
+
+    /*>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>\
+    ^ Fun-1 Sec-2: Find the start and uncompressed size of each block
+    \<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<*/
+
+    fseek(bgzfFILE, 0, SEEK_SET);
+
+    while(fread(headAryUC, sizeof(char), 18, bgzfFILE) == 18)
+    { /*While have blocks to index*/
+        /*Check if this is a BGZF block (SAM/BAM spec section 4.1)*/
+        if(
+              headAryUC[0] != 0x1f || headAryUC[1] != 0x8b
+           || headAryUC[2] != 8 || !(headAryUC[3] & 4)
+           || headAryUC[10] != 6 || headAryUC[11] != 0
+           || headAryUC[12] != 'B' || headAryUC[13] != 'C'
+        ) goto notBgzf_fun1_sec3;
+
+        /*BSIZE is the block size - 1*/
+        lenBlockUL = (headAryUC[16] | (headAryUC[17] << 8)) + 1;
+
+        /*ISIZE is the last four bytes of the block (little endian)*/
+        fseek(bgzfFILE, posUL + lenBlockUL - 4, SEEK_SET);
+
+        if(fread(sizeAryUC, sizeof(char), 4, bgzfFILE) != 4)
+            goto notBgzf_fun1_sec3;
+
+        if(numBlocksUL == maxBlocksUL)
+        { /*If need more memory for the blocks*/
+            maxBlocksUL += 4096;
+
+            tmpPtr =
+                realloc(
+                    blockStartAryUL,
+                    maxBlocksUL * sizeof(unsigned long)
+            );
+
+            if(tmpPtr == 0)
+                goto notBgzf_fun1_sec3;
+
+            blockStartAryUL = tmpPtr;
+
+            tmpPtr =
+                realloc(blockLenAryUL, maxBlocksUL*sizeof(unsigned long));
+
+            if(tmpPtr == 0)
+                goto notBgzf_fun1_sec3;
+
+            blockLenAryUL = tmpPtr;
+        } /*If need more memory for the blocks*/
+
+        blockStartAryUL[numBlocksUL] = posUL;
+        blockLenAryUL[numBlocksUL] =
+              (unsigned long) sizeAryUC[0]
+            | ((unsigned long) sizeAryUC[1] << 8)
+            | ((unsigned long) sizeAryUC[2] << 16)
+            | ((unsigned long) sizeAryUC[3] << 24);
+
+        lenAllUL += blockLenAryUL[numBlocksUL];
+        ++numBlocksUL;
+
+        posUL += lenBlockUL;
+    } /*While have blocks to index*/
+
+    if(numBlocksUL == 0)
+        goto notBgzf_fun1_sec3;
+
+    /*>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>\
+    ^ Fun-1 Sec-3: Group the blocks into sections
+    \<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<*/
+
+    /*Same as uncompressed files, small files are split by thread*/
+    if(lenAllUL / numThreadsUC < lenSectionUL)
+        lenSectionUL = lenAllUL / numThreadsUC + 1;
+
+    bgzfST = calloc(1, sizeof(struct bgzfSections));
+
+    if(bgzfST == 0)
+        goto notBgzf_fun1_sec3;
+
+    /*Sections have at least one block, so at most numBlocksUL*/
+    bgzfST->compStartAryUL = malloc(numBlocksUL * sizeof(unsigned long));
+    bgzfST->lenAryUL = malloc(numBlocksUL * sizeof(unsigned long));
+
+    if(bgzfST->compStartAryUL == 0 || bgzfST->lenAryUL == 0)
+        goto notBgzf_fun1_sec3;
+
+    lenSecUL = 0;
+
+    for(unsigned long ulBlock = 0; ulBlock < numBlocksUL; ++ulBlock)
+    { /*Loop: add each block to a section*/
+        if(lenSecUL == 0)
+            bgzfST->compStartAryUL[bgzfST->numSectionsUL] =
+                blockStartAryUL[ulBlock];
+
+        lenSecUL += blockLenAryUL[ulBlock];
+
+        if(lenSecUL >= lenSectionUL || ulBlock == numBlocksUL - 1)
+        { /*If this section is full*/
+            bgzfST->lenAryUL[bgzfST->numSectionsUL] = lenSecUL;
+            ++bgzfST->numSectionsUL;
+            lenSecUL = 0;
+        } /*If this section is full*/
+    } /*Loop: add each block to a section*/
+
+    free(blockStartAryUL);
+    free(blockLenAryUL);
+    fseek(bgzfFILE, 0, SEEK_SET);
+    return bgzfST;
+
+    notBgzf_fun1_sec3:
+
+    free(blockStartAryUL);
+    free(blockLenAryUL);
+    freeBgzfSections(&bgzfST);
+    fseek(bgzfFILE, 0, SEEK_SET);
+    return 0;
+} /*makeBgzfSections*/
+
+/*---------------------------------------------------------------------\
+| Output:
+|   - Frees:
+|     o bgzfST and sets it to 0
+\---------------------------------------------------------------------*/
+void freeBgzfSections(
+    struct bgzfSections **bgzfST /*Sections to free*/
+) /*Frees a bgzfSections struct*/
+{ /*freeBgzfSections*/
+    if(*bgzfST == 0)
+        return;
+
+    free((*bgzfST)->compStartAryUL);
+    free((*bgzfST)->lenAryUL);
+    free(*bgzfST);
+    *bgzfST = 0;
+} /*freeBgzfSections*/
@@ -0,0 +1,53 @@
+/*######################################################################
+# Name: fqGetIdsBgzf
+# Use:
+#    Splits a BGZF (block gzip) fastq file into sections of whole
+#    blocks. BGZF blocks are separate gzip members, so each section
+#    can be uncompressed by its own thread.
+# Requires:
+#    C standard libraries only (<stdio.h>, <stdlib.h>)
+######################################################################*/
+
+#ifndef FQGETIDSBGZF_H
+#define FQGETIDSBGZF_H
+
+#include <stdio.h>
+#include <stdlib.h>
+
+/*---------------------------------------------------------------------\
+| Struct-1: bgzfSections
+|   o Where each section starts in the BGZF file and how many
+|     uncompressed bytes it has. Sections are whole blocks.
+\---------------------------------------------------------------------*/
+typedef struct bgzfSections
+{ /*bgzfSections*/
+    unsigned long *compStartAryUL; /*Compressed start of each section*/
+    unsigned long *lenAryUL;       /*Uncompressed length of sections*/
+    unsigned long numSectionsUL;   /*Number of sections*/
+}bgzfSections;
+
+/*---------------------------------------------------------------------\
+| Output:
+|   - Returns:
+|     o bgzfSections with about lenSectionUL uncompressed bytes per
+|       section (less if needed to give each thread a section)
+|     o 0 if bgzfFILE is not all BGZF blocks or had a memory error
+|   - Modifies:
+|     o bgzfFILE to be at its start
+\---------------------------------------------------------------------*/
+struct bgzfSections * makeBgzfSections(
+    FILE *bgzfFILE,             /*BGZF file to split up*/
+    unsigned long lenSectionUL, /*Uncompressed bytes per section*/
+    unsigned char numThreadsUC  /*Number of threads to split for*/
+); /*Splits a BGZF file into sections of whole blocks*/
+
+/*---------------------------------------------------------------------\
+| Output:
+|   - Frees:
+|     o bgzfST and sets it to 0
+\---------------------------------------------------------------------*/
+void freeBgzfSections(
+    struct bgzfSections **bgzfST /*Sections to free*/
+); /*Frees a bgzfSections struct*/
+
+#endif
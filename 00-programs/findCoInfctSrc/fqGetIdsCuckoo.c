@@ -0,0 +1,431 @@
+/*#########################################################
+# Name: fqGetIdsCuckoo
+# Use:
+#  - Cuckoo filter of read ids that is checked before the
+#    hash table or AVL tree
+# Libraries:
+#  - "fqGetIdsCuckoo.h"
+#  - "fqGetIdsStructs.h"
+# C Standard Libraries
+#  o <stdint.h>
+#  o <stdio.h>
+#  o <stdlib.h>
+#########################################################*/
+
+/*~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~\
+' SOF: Start Of Functions
+' o fun-01 makeCuckooFilt:
+'   - Makes an empty cuckoo filter for a number of ids
+' o fun-02 addIdToCuckooFilt:
+'   - Adds a read id to a cuckoo filter
+' o fun-03 findIdInCuckooFilt:
+'   - Checks if a read id may be in a cuckoo filter
+' o fun-04 cuckooFiltFromHash:
+'   - Makes a cuckoo filter with the read ids in a hash
+'     table (or AVL tree)
+' o fun-05 freeCuckooFilt:
+'   - Frees a cuckoo filter
+' o fun-06 hashIdForCuckoo:
+'   - Hashes all limbs of a read id (static)
+' o fun-07 bucketHasFp:
+'   - Checks if a bucket has a fingerprint (static)
+' o fun-08 addReadTreeToCuckoo:
+'   - Adds or counts the ids in a tree (static)
+\~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~*/
+
+#include "fqGetIdsCuckoo.h"
+
+/*Every 16 bits of a bucket set to one*/
+#define defCuckooOnesUL 0x0001000100010001ULL
+#define defCuckooHighUL 0x8000800080008000ULL
+
+/*Gets the other bucket a fingerprint can go in. This is
+` its own inverse, so either bucket gives the other one.
+*/
+#define cuckooAltBuck(buckUL, fpUS, maskUL)(\
+   ((buckUL) ^ (((uint64_t) (fpUS) * 0x5bd1e995ULL) >> 4)) & (maskUL)\
+)
+
+static uint64_t hashIdForCuckoo(struct bigNum *idBigNum);
+static uint8_t bucketHasFp(uint64_t bucketUL, uint16_t fpUS);
+static uint64_t addReadTreeToCuckoo(
+    struct readInfo *readTree,
+    struct cuckooFilt *cuckooST,
+    struct readNodeStack *readStack
+);
+
+/*--------------------------------------------------------\
+| Output:
+|  - Returns:
+|    o Pointer to an empty cuckooFilt with room for
+|      numIdsUL read ids
+|    o 0 if had a memory allocation error
+\--------------------------------------------------------*/
+struct cuckooFilt * makeCuckooFilt(
+    uint64_t numIdsUL  /*Number of read ids to hold*/
+){ /*~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~\
+   ' Fun-01 TOC: makeCuckooFilt
+   '  - Makes an empty cuckoo filter for a number of ids
+   \~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~*/
+
+    uint64_t numBucketsUL = 1;
+    struct cuckooFilt *cuckooST = 0;
+
+    /*Keep the buckets under 90% full (inserts start to
+    ` fail at about 95% for buckets of four)
+    */
+    while(numBucketsUL * defCuckooSlots * 9 < numIdsUL * 10)
+        numBucketsUL <<= 1;
+
+    cuckooST = malloc(sizeof(struct cuckooFilt));
+    if(cuckooST == 0) return 0;
+
+    cuckooST->bucketAryUL = calloc(numBucketsUL, sizeof(uint64_t));
+
+    if(cuckooST->bucketAryUL == 0)
+    { /*If had a memory allocation error*/
+        free(cuckooST);
+        return 0;
+    } /*If had a memory allocation error*/
+
+    cuckooST->maskUL = numBucketsUL - 1;
+    cuckooST->victimBuckUL = 0;
+    cuckooST->victimFpUS = 0;
+    cuckooST->victimBl = 0;
+    cuckooST->fullBl = 0;
+
+    return cuckooST;
+} /*makeCuckooFilt*/
+
+/*--------------------------------------------------------\
+| Output:
+|  - Modifies:
+|    o cuckooST to have the fingerprint of idBigNum
+|  - Returns:
+|    o 1 if the id was added
+|    o 0 if the filter is full (cuckooST->fullBl is set)
+\--------------------------------------------------------*/
+uint8_t addIdToCuckooFilt(
+    struct bigNum *idBigNum,     /*Read id to add*/
+    struct cuckooFilt *cuckooST  /*Filter to add id to*/
+){ /*~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~\
+   ' Fun-02 TOC: addIdToCuckooFilt
+   '  - Adds a read id to a cuckoo filter
+   '  o fun-02 sec-01:
+   '    - Variable declerations
+   '  o fun-02 sec-02:
+   '    - Try the two buckets for the fingerprint
+   '  o fun-02 sec-03:
+   '    - Kick fingerprints to their other bucket
+   \~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~*/
+
+    /*>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>\
+    ^ Fun-02 Sec-01:
+    ^  - Variable declerations
+    \<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<*/
+
+    uint64_t hashUL = 0;
+    uint64_t buckUL = 0;
+    uint64_t *bucketUL = 0;
+    uint16_t fpUS = 0;
+    uint16_t kickedUS = 0;
+    unsigned int slotUI = 0;
+    unsigned int kickUI = 0;
+    unsigned int triesUI = 0;
+
+    if(cuckooST->fullBl) return 0;
+
+    hashUL = hashIdForCuckoo(idBigNum);
+    fpUS = (uint16_t) (hashUL >> 48);
+    if(fpUS == 0) fpUS = 1;          /*0 marks empty slots*/
+
+    buckUL = hashUL & cuckooST->maskUL;
+
+    /*>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>\
+    ^ Fun-02 Sec-02:
+    ^  - Try the two buckets for the fingerprint
+    \<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<*/
+
+    for(triesUI = 0; triesUI < 2; ++triesUI)
+    { /*Loop: Check both buckets for an empty slot*/
+        bucketUL = cuckooST->bucketAryUL + buckUL;
+
+        for(slotUI = 0; slotUI < defCuckooSlots; ++slotUI)
+        { /*Loop: Find an empty slot*/
+            if(((*bucketUL >> (slotUI << 4)) & 0xffff) == 0)
+            { /*If the slot is empty*/
+                *bucketUL |= (uint64_t) fpUS << (slotUI << 4);
+                return 1;
+            } /*If the slot is empty*/
+        } /*Loop: Find an empty slot*/
+
+        buckUL = cuckooAltBuck(buckUL, fpUS, cuckooST->maskUL);
+    } /*Loop: Check both buckets for an empty slot*/
+
+    /*>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>\
+    ^ Fun-02 Sec-03:
+    ^  - Kick fingerprints to their other bucket
+    \<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<*/
+
+    for(kickUI = 0; kickUI < defCuckooMaxKicks; ++kickUI)
+    { /*Loop: Move fingerprints till find an empty slot*/
+        bucketUL = cuckooST->bucketAryUL + buckUL;
+
+        /*Swap with a slot (cycles so do not undo last kick)*/
+        slotUI = kickUI & (defCuckooSlots - 1);
+        kickedUS = (uint16_t) (*bucketUL >> (slotUI << 4));
+        *bucketUL &= ~((uint64_t) 0xffff << (slotUI << 4));
+        *bucketUL |= (uint64_t) fpUS << (slotUI << 4);
+
+        fpUS = kickedUS;
+        buckUL = cuckooAltBuck(buckUL, fpUS, cuckooST->maskUL);
+        bucketUL = cuckooST->bucketAryUL + buckUL;
+
+        for(slotUI = 0; slotUI < defCuckooSlots; ++slotUI)
+        { /*Loop: Find an empty slot*/
+            if(((*bucketUL >> (slotUI << 4)) & 0xffff) == 0)
+            { /*If the slot is empty*/
+                *bucketUL |= (uint64_t) fpUS << (slotUI << 4);
+                return 1;
+            } /*If the slot is empty*/
+        } /*Loop: Find an empty slot*/
+    } /*Loop: Move fingerprints till find an empty slot*/
+
+    if(cuckooST->victimBl == 0)
+    { /*If the victim slot is open*/
+        cuckooST->victimBl = 1;
+        cuckooST->victimFpUS = fpUS;
+        cuckooST->victimBuckUL = buckUL;
+        return 1;
+    } /*If the victim slot is open*/
+
+    cuckooST->fullBl = 1; /*Lost a fingerprint*/
+    return 0;
+} /*addIdToCuckooFilt*/
+
+/*--------------------------------------------------------\
+| Output:
+|  - Returns:
+|    o 1 if idBigNum may be in cuckooST
+|    o 0 if idBigNum is not in cuckooST
+\--------------------------------------------------------*/
+uint8_t findIdInCuckooFilt(
+    struct bigNum *idBigNum,     /*Read id to look for*/
+    struct cuckooFilt *cuckooST  /*Filter to search*/
+){ /*~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~\
+   ' Fun-03 TOC: findIdInCuckooFilt
+   '  - Checks if a read id may be in a cuckoo filter
+   \~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~*/
+
+    uint64_t hashUL = hashIdForCuckoo(idBigNum);
+    uint64_t buckUL = hashUL & cuckooST->maskUL;
+    uint16_t fpUS = (uint16_t) (hashUL >> 48);
+
+    if(fpUS == 0) fpUS = 1;
+
+    if(bucketHasFp(*(cuckooST->bucketAryUL + buckUL), fpUS))
+        return 1;
+
+    buckUL = cuckooAltBuck(buckUL, fpUS, cuckooST->maskUL);
+
+    if(bucketHasFp(*(cuckooST->bucketAryUL + buckUL), fpUS))
+        return 1;
+
+    if(
+          cuckooST->victimBl
+       && cuckooST->victimFpUS == fpUS
+       && (
+             cuckooST->victimBuckUL == buckUL
+          || cuckooST->victimBuckUL ==
+               cuckooAltBuck(buckUL, fpUS, cuckooST->maskUL)
+       )
+    ) return 1;
+
+    return cuckooST->fullBl;
+} /*findIdInCuckooFilt*/
+
+/*--------------------------------------------------------\
+| Output:
+|  - Returns:
+|    o Pointer to a cuckooFilt with every read id in
+|      hashTbl (or readTree if hashTbl is 0)
+|    o 0 if had a memory allocation error
+\--------------------------------------------------------*/
+struct cuckooFilt * cuckooFiltFromHash(
+    struct readInfo **hashTbl,  /*Hash table with read ids*/
+    uint64_t hashSizeUL,        /*Number of trees in hashTbl*/
+    struct readInfo *readTree,  /*AVL tree (if hashTbl is 0)*/
+    struct readNodeStack *readStack /*Stack for the trees*/
+){ /*~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~\
+   ' Fun-04 TOC: cuckooFiltFromHash
+   '  - Makes a cuckoo filter with the read ids in a hash
+   '    table (or AVL tree)
+   '  o fun-04 sec-01:
+   '    - Variable declerations
+   '  o fun-04 sec-02:
+   '    - Count the read ids and make the filter
+   '  o fun-04 sec-03:
+   '    - Add the read ids to the filter
+   \~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~*/
+
+    /*>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>\
+    ^ Fun-04 Sec-01:
+    ^  - Variable declerations
+    \<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<*/
+
+    uint64_t numIdsUL = 0;
+    uint64_t indexUL = 0;
+    struct cuckooFilt *cuckooST = 0;
+
+    /*>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>\
+    ^ Fun-04 Sec-02:
+    ^  - Count the read ids and make the filter
+    \<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<*/
+
+    if(hashTbl == 0)
+        numIdsUL = addReadTreeToCuckoo(readTree, 0, readStack);
+    else
+    { /*Else counting the ids in the hash table*/
+        for(indexUL = 0; indexUL < hashSizeUL; ++indexUL)
+            numIdsUL +=
+                addReadTreeToCuckoo(hashTbl[indexUL], 0, readStack);
+    } /*Else counting the ids in the hash table*/
+
+    cuckooST = makeCuckooFilt(numIdsUL);
+    if(cuckooST == 0) return 0;
+
+    /*>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>\
+    ^ Fun-04 Sec-03:
+    ^  - Add the read ids to the filter
+    \<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<*/
+
+    if(hashTbl == 0)
+        addReadTreeToCuckoo(readTree, cuckooST, readStack);
+    else
+    { /*Else adding the ids in the hash table*/
+        for(indexUL = 0; indexUL < hashSizeUL; ++indexUL)
+            addReadTreeToCuckoo(hashTbl[indexUL], cuckooST, readStack);
+    } /*Else adding the ids in the hash table*/
+
+    return cuckooST;
+} /*cuckooFiltFromHash*/
+
+/*--------------------------------------------------------\
+| Output:
+|  - Frees:
+|    o cuckooST and sets it to 0
+\--------------------------------------------------------*/
+void freeCuckooFilt(
+    struct cuckooFilt **cuckooST /*Filter to free*/
+){ /*~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~\
+   ' Fun-05 TOC: freeCuckooFilt
+   '  - Frees a cuckoo filter
+   \~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~*/
+
+    if(*cuckooST == 0) return;
+
+    free((*cuckooST)->bucketAryUL);
+    free(*cuckooST);
+    *cuckooST = 0;
+} /*freeCuckooFilt*/
+
+/*--------------------------------------------------------\
+| Output:
+|  - Returns:
+|    o 64 bit hash of all limbs in idBigNum (the AVL hash
+|      only uses the limb total, which is too weak here)
+\--------------------------------------------------------*/
+static uint64_t hashIdForCuckoo(
+    struct bigNum *idBigNum  /*Read id to hash*/
+){ /*~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~\
+   ' Fun-06 TOC: hashIdForCuckoo
+   '  - Hashes all limbs of a read id
+   \~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~*/
+
+    uint64_t hashUL =
+       0x9e3779b97f4a7c15ULL ^ idBigNum->lenUsedElmChar;
+    unsigned char limbUC = 0;
+
+    for(limbUC = 0; limbUC < idBigNum->lenUsedElmChar; ++limbUC)
+    { /*Loop: Mix in each limb*/
+        hashUL ^= (uint64_t) *(idBigNum->bigNumAryIOrL + limbUC);
+        hashUL *= 0xbf58476d1ce4e5b9ULL;
+        hashUL ^= hashUL >> 31;
+    } /*Loop: Mix in each limb*/
+
+    /*Final mix (murmur3 fmix64)*/
+    hashUL ^= hashUL >> 33;
+    hashUL *= 0xff51afd7ed558ccdULL;
+    hashUL ^= hashUL >> 33;
+    hashUL *= 0xc4ceb9fe1a85ec53ULL;
+    hashUL ^= hashUL >> 33;
+
+    return hashUL;
+} /*hashIdForCuckoo*/
+
+/*--------------------------------------------------------\
+| Output:
+|  - Returns:
+|    o 1 if one of the four slots in bucketUL is fpUS
+|    o 0 if fpUS is not in bucketUL
+\--------------------------------------------------------*/
+static uint8_t bucketHasFp(
+    uint64_t bucketUL, /*Bucket to check*/
+    uint16_t fpUS      /*Fingerprint to look for*/
+){ /*~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~\
+   ' Fun-07 TOC: bucketHasFp
+   '  - Checks if a bucket has a fingerprint. The xor sets
+   '    matching slots to 0 and the has zero trick checks
+   '    all four slots at once.
+   \~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~*/
+
+    bucketUL ^= fpUS * defCuckooOnesUL;
+
+    return
+      !!((bucketUL - defCuckooOnesUL) & ~bucketUL & defCuckooHighUL);
+} /*bucketHasFp*/
+
+/*--------------------------------------------------------\
+| Output:
+|  - Modifies:
+|    o cuckooST to have all ids in readTree (if not 0)
+|  - Returns:
+|    o Number of ids in readTree
+\--------------------------------------------------------*/
+static uint64_t addReadTreeToCuckoo(
+    struct readInfo *readTree,   /*Tree with read ids*/
+    struct cuckooFilt *cuckooST, /*0 to only count the ids*/
+    struct readNodeStack *readStack /*Stack for the tree*/
+){ /*~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~\
+   ' Fun-08 TOC: addReadTreeToCuckoo
+   '  - Adds or counts the ids in a tree (same walk as
+   '    freeReadTree)
+   \~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~*/
+
+    struct readInfo *readNode = 0;
+    uint64_t numIdsUL = 0;
+
+    if(readTree == 0) return 0;
+
+    readStack++; /*Get off the 0 at the start*/
+    pushReadNodeStack(&readStack, 0); /*Marks the end*/
+    pushReadNodeStack(&readStack, readTree);
+
+    while(readStack->readNode != 0)
+    { /*Loop: Visit every node in the tree*/
+        readNode = readStack->readNode;
+        popReadNodeStack(&readStack);
+
+        if(readNode->leftChild != 0)
+            pushReadNodeStack(&readStack, readNode->leftChild);
+        if(readNode->rightChild != 0)
+            pushReadNodeStack(&readStack, readNode->rightChild);
+
+        if(cuckooST != 0)
+            addIdToCuckooFilt(readNode->idBigNum, cuckooST);
+
+        ++numIdsUL;
+    } /*Loop: Visit every node in the tree*/
+
+    return numIdsUL;
+} /*addReadTreeToCuckoo*/
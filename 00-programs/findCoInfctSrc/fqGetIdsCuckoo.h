@@ -0,0 +1,151 @@
+/*#########################################################
+# Name: fqGetIdsCuckoo
+# Use:
+#  - Cuckoo filter of read ids that is checked before the
+#    hash table or AVL tree. Each id is a 16 bit
+#    fingerprint in one of two buckets of four (8 bytes a
+#    bucket), so a read id that is not in the filter file
+#    is found with at most two cache lines and without
+#    touching the readInfo/bigNum nodes.
+#  - A fingerprint match is only a maybe, so the hash
+#    table or tree still has to be searched (about 1 in
+#    8000 misses get through).
+# Libraries:
+#  - "fqGetIdsStructs.h"
+# C Standard Libraries
+#  o <stdint.h>
+#  o <stdio.h>
+#  o <stdlib.h>
+#########################################################*/
+
+#ifndef FQGETIDSCUCKOO_H
+#define FQGETIDSCUCKOO_H
+
+#include "fqGetIdsStructs.h" /*<stdlib.h>, <stdio.h>, <stdint.h>*/
+
+/*~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~\
+' SOH: Start Of Header
+' o st-01 cuckooFilt:
+'   - Buckets of fingerprints for the read ids
+' o fun-01 makeCuckooFilt:
+'   - Makes an empty cuckoo filter for a number of ids
+' o fun-02 addIdToCuckooFilt:
+'   - Adds a read id to a cuckoo filter
+' o fun-03 findIdInCuckooFilt:
+'   - Checks if a read id may be in a cuckoo filter
+' o fun-04 cuckooFiltFromHash:
+'   - Makes a cuckoo filter with the read ids in a hash
+'     table (or AVL tree)
+' o fun-05 freeCuckooFilt:
+'   - Frees a cuckoo filter
+\~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~*/
+
+#define defCuckooSlots 4      /*Fingerprints per bucket*/
+#define defCuckooMaxKicks 500 /*Moves before giving up*/
+
+/*--------------------------------------------------------\
+| ST-01: cuckooFilt
+|  - Buckets of four 16 bit fingerprints (0 is empty), so
+|    each bucket is one uint64_t
+|  - A fingerprint that could not be placed is kept as the
+|    victim. If a second one can not be placed fullBl is
+|    set and every id is a maybe (the filter is skipped).
+\--------------------------------------------------------*/
+typedef struct cuckooFilt
+{ /*cuckooFilt*/
+    uint64_t *bucketAryUL;  /*Buckets of fingerprints*/
+    uint64_t maskUL;        /*Number of buckets - 1 (2^n)*/
+
+    uint64_t victimBuckUL;  /*Bucket the victim goes in*/
+    uint16_t victimFpUS;    /*Fingerprint not placed*/
+    uint8_t victimBl;       /*1: have a victim*/
+    uint8_t fullBl;         /*1: ids were lost, always maybe*/
+}cuckooFilt;
+
+/*--------------------------------------------------------\
+| Output:
+|  - Returns:
+|    o Pointer to an empty cuckooFilt with room for
+|      numIdsUL read ids
+|    o 0 if had a memory allocation error
+\--------------------------------------------------------*/
+struct cuckooFilt * makeCuckooFilt(
+    uint64_t numIdsUL  /*Number of read ids to hold*/
+); /*~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~\
+   ' Fun-01 TOC: makeCuckooFilt
+   '  - Makes an empty cuckoo filter for a number of ids
+   \~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~*/
+
+/*--------------------------------------------------------\
+| Output:
+|  - Modifies:
+|    o cuckooST to have the fingerprint of idBigNum
+|  - Returns:
+|    o 1 if the id was added
+|    o 0 if the filter is full (cuckooST->fullBl is set)
+\--------------------------------------------------------*/
+uint8_t addIdToCuckooFilt(
+    struct bigNum *idBigNum,     /*Read id to add*/
+    struct cuckooFilt *cuckooST  /*Filter to add id to*/
+); /*~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~\
+   ' Fun-02 TOC: addIdToCuckooFilt
+   '  - Adds a read id to a cuckoo filter
+   '  o fun-02 sec-01:
+   '    - Variable declerations
+   '  o fun-02 sec-02:
+   '    - Try the two buckets for the fingerprint
+   '  o fun-02 sec-03:
+   '    - Kick fingerprints to their other bucket
+   \~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~*/
+
+/*--------------------------------------------------------\
+| Output:
+|  - Returns:
+|    o 1 if idBigNum may be in cuckooST
+|    o 0 if idBigNum is not in cuckooST
+\--------------------------------------------------------*/
+uint8_t findIdInCuckooFilt(
+    struct bigNum *idBigNum,     /*Read id to look for*/
+    struct cuckooFilt *cuckooST  /*Filter to search*/
+); /*~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~\
+   ' Fun-03 TOC: findIdInCuckooFilt
+   '  - Checks if a read id may be in a cuckoo filter
+   \~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~*/
+
+/*--------------------------------------------------------\
+| Output:
+|  - Returns:
+|    o Pointer to a cuckooFilt with every read id in
+|      hashTbl (or readTree if hashTbl is 0)
+|    o 0 if had a memory allocation error
+\--------------------------------------------------------*/
+struct cuckooFilt * cuckooFiltFromHash(
+    struct readInfo **hashTbl,  /*Hash table with read ids*/
+    uint64_t hashSizeUL,        /*Number of trees in hashTbl*/
+    struct readInfo *readTree,  /*AVL tree (if hashTbl is 0)*/
+    struct readNodeStack *readStack /*Stack for the trees*/
+); /*~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~\
+   ' Fun-04 TOC: cuckooFiltFromHash
+   '  - Makes a cuckoo filter with the read ids in a hash
+   '    table (or AVL tree)
+   '  o fun-04 sec-01:
+   '    - Variable declerations
+   '  o fun-04 sec-02:
+   '    - Count the read ids and make the filter
+   '  o fun-04 sec-03:
+   '    - Add the read ids to the filter
+   \~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~*/
+
+/*--------------------------------------------------------\
+| Output:
+|  - Frees:
+|    o cuckooST and sets it to 0
+\--------------------------------------------------------*/
+void freeCuckooFilt(
+    struct cuckooFilt **cuckooST /*Filter to free*/
+); /*~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~\
+   ' Fun-05 TOC: freeCuckooFilt
+   '  - Frees a cuckoo filter
+   \~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~*/
+
+#endif
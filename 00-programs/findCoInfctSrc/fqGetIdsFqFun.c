@@ -8,9 +8,15 @@
 ^ fastqGrepFastqFun TOC:
 ^   fun-1: parseFastqHeader: Sets pointer to start of fastq header
 ^   fun-2: printFastqEntry: Print out an entry in a fastq file
+^   fun-3: parseMapFastqHeader: Converts a read id in memory to a bigNum
+^   fun-4: mapNextFastqEntry: Finds the end of a fastq entry in memory
+^   fun-5: mapCheckFastqEntry: Checks if a line in memory is a header
+^   fun-6: checkFastqEntry: Checks if a line in a file is a header
 \~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~*/
 
 #include "fqGetIdsFqFun.h"
+#include "fqGetIdsBlockScan.h"
+#include <string.h> /*memmove*/
 
 /*---------------------------------------------------------------------/
 | Output:
@@ -122,15 +128,19 @@ uint8_t parseFastqHeader(
                 if(*lenInputULng < buffSizeInt)
                     return 0;     /*At end of file, but no sequence*/
 
-                /*Put file pointer back to the start of read name*/
-                fseek(fastqFile, *lenIdInt * -1, SEEK_CUR);
+                /*Move the read name to the start of the buffer. This
+                ` does not seek, so pipes (stdin or gzip) also work
+                */
+                memmove(bufferCStr, *startNameCStr, *lenIdInt);
 
-                *lenInputULng = fread(bufferCStr,
+                *lenInputULng = fread(bufferCStr + *lenIdInt,
                                      sizeof(char),
-                                     buffSizeInt,
+                                     buffSizeInt - *lenIdInt,
                                      fastqFile
                 ); /*Read in more of the file*/
 
+                *lenInputULng += *lenIdInt;
+
                 *(bufferCStr + *lenInputULng) = '\0';/*make a c-string*/
                 *startNameCStr = bufferCStr;
                 *endCStr = bufferCStr + *lenIdInt;
@@ -172,166 +182,385 @@ uint8_t printFastqEntry(
     /*>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>
     # Fun-2 TOC:
     #     fun-2 sec-1: Variable declerations
-    #     fun-2 sec-2: Print out the header
-    #     fun-2 sec-3: Print out & find number new lines in seqence line
-    #     fun-2 sec-4: Print out the spacer entry
-    #     fun-2 Sec-5: Print out the q-scores entry (same # lines as sequence)
-    #     fun-2 sec-6: Print out remaning parts of entry in buffer
+    #     fun-2 sec-2: Print out each buffer until the end of the entry
+    #     fun-2 sec-3: Print out remaning parts of entry in buffer
     <<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<*/
 
     /*>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>
     # Fun-2 Sec-1: Variable declerations
     <<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<*/
 
-    uint64_t
-        numSeqlinesULng = 0;  /*Record the number of new lines in the sequence*/
+    char *nextEntryCStr = 0;
+    struct fqBlockScan scanST;   /*Where in the entry (kept between buffers)*/
+
+    initFqBlockScan(&scanST);
 
     /*>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>
-    # Fun-2 Sec-2: Print out the header
+    # Fun-2 Sec-2: Print out each buffer until the end of the entry
     <<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<*/
- 
-    while(**pointInBufferCStr != '\n')
-    { /*While on header, move to sequence line*/
 
-        if(**pointInBufferCStr == '\0')
-        { /*If ran out of buffer & need to read in more of the file*/
-            /*print out old buffer*/
-            fprintf(outFILE, "%s", *readStartCStr);
+    nextEntryCStr =
+        scanFqBlocks(
+            &scanST,
+            *pointInBufferCStr,
+            bufferCStr + *lenInputULng
+    );
+
+    while(nextEntryCStr == 0)
+    { /*While ran out of buffer & need to read in more of the file*/
+        /*print out old buffer*/
+        fwrite(
+            *readStartCStr,
+            sizeof(char),
+            bufferCStr + *lenInputULng - *readStartCStr,
+            outFILE
+        );
 
-            if(*lenInputULng < buffSizeInt)
-                return 0;         /*Is not a complete fastq file*/
+        if(*lenInputULng < buffSizeInt)
+        { /*If at end of the file*/
+            *pointInBufferCStr = bufferCStr + *lenInputULng;
 
-            *lenInputULng = fread(bufferCStr,
-                                 sizeof(char),
-                                 buffSizeInt,
-                                 fastqFile
-            ); /*Read in more of the file*/
+            if(fqBlockScanEndOk(&scanST))
+                return 4;         /*At end of file & printed last line*/
+            else
+                return 0;         /*Is not a complete fastq file*/
+        } /*If at end of the file*/
 
-            *(bufferCStr + *lenInputULng) = '\0';/*make sure a c-string*/
-            *pointInBufferCStr = bufferCStr;
-            *readStartCStr = *pointInBufferCStr;
-            continue;                           /*so can check if '\n'*/
-        } /*If ran out of buffer & need to read more of the file*/
+        *lenInputULng = fread(bufferCStr,
+                             sizeof(char),
+                             buffSizeInt,
+                             fastqFile
+        ); /*Read in more of the file*/
 
-        (*pointInBufferCStr)++;
-    } /*While on header, move to sequence line*/
+        *(bufferCStr + *lenInputULng) = '\0';/*make sure a c-string*/
+        *pointInBufferCStr = bufferCStr;
+        *readStartCStr = *pointInBufferCStr;
 
-    ++(*pointInBufferCStr); /*get off the new line*/
+        nextEntryCStr =
+            scanFqBlocks(
+                &scanST,
+                bufferCStr,
+                bufferCStr + *lenInputULng
+        );
+    } /*While ran out of buffer & need to read in more of the file*/
 
     /*>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>
-    # Fun-2 Sec-3: Print out & find number new lines in seqence line
+    # Fun-2 Sec-3: Print out remaning parts of entry in buffer
     <<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<*/
 
-    while(**pointInBufferCStr != '+')
-    { /*While on sequence line, count number new lines & move to spacer*/
+    /*Finish printing out the read entry (ends with its new line)*/
+    fwrite(
+        *readStartCStr,
+        sizeof(char),
+        nextEntryCStr - *readStartCStr,
+        outFILE
+    );
 
-        if(**pointInBufferCStr == '\0')
-        { /*If ran out of buffer & need to read in more of the file*/
-            /*print out old buffer*/
-            fprintf(outFILE, "%s", *readStartCStr);
+    *pointInBufferCStr = nextEntryCStr - 1; /*Get back on the new line*/
+    
+    return 2; /*Copied name sucessfully*/
+} /*printFastqEntry*/
 
-            if(*lenInputULng < buffSizeInt)
-                return 0;         /*Is not a complete fastq file*/
+/*##############################################################################
+# Output:
+#    Modifies: idBigNum to hold the read id starting at idCStr
+#    Returns: Pointer to the first invisible character after the read id
+#    Note: This is parseFastqHeader for a fastq file that is in memory
+#          (memory mapped), so endFileCStr marks the end (no '\0').
+##############################################################################*/
+char * parseMapFastqHeader(
+    char *idCStr,            /*Start of read id (after the '@')*/
+    char *endFileCStr,       /*One past the last character of the file*/
+    struct bigNum *idBigNum  /*Will hold big number found*/
+) /*Converts a read id in memory to a bigNum*/
+{ /*parseMapFastqHeader*/
 
-            *lenInputULng = fread(bufferCStr,
-                                 sizeof(char),
-                                 buffSizeInt,
-                                 fastqFile
-            ); /*Read in more of the file*/
+    /*~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~\
+    ' Fun-3 TOC:
+    '    fun-3 sec-1: Variable declerations
+    '    fun-3 sec-2: Convert read id to bigNum read id (long array)
+    \~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~*/
 
-            *(bufferCStr + *lenInputULng) = '\0';/*make sure a c-string*/
-            *pointInBufferCStr = bufferCStr;
-            *readStartCStr = *pointInBufferCStr;
-            continue;                           /*so can check if '\n'*/
-        } /*If ran out of buffer & need to read more of the file*/
+    /*>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>\
+    ^ Fun-3 Sec-1: Variable declerations
+    \<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<*/
 
-        if(**pointInBufferCStr == '\n')
-            numSeqlinesULng++;    /*Record number new lines, for q-score entry*/
+    uint8_t charBit = 0;
 
-        (*pointInBufferCStr)++;
-    } /*While on sequence line, count number new lines & move to spacer*/
+    /*For speed versus memroy (MEM) compile settings*/
+    #ifndef MEM
+        #if defOSBit == 64
+            int *elmILPtr = 0;
+        #else
+            short *elmILPtr = 0;
+        #endif
+    #else
+        long *elmILPtr = 0;
+    #endif
 
-    /*>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>
-    # Fun-2 Sec-4: Print out the spacer entry
-    <<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<*/
- 
-    while(**pointInBufferCStr != '\n')
-    { /*While on the spacer entry*/
+    idBigNum->lenUsedElmChar = 0;
 
-        if(**pointInBufferCStr == '\0')
-        { /*If ran out of buffer & need to read in more of the file*/
-            /*print out old buffer*/
-            fprintf(outFILE, "%s", *readStartCStr);
+    #ifndef MEM
+        idBigNum->totalL = 0;
+    #endif
 
-            if(*lenInputULng < buffSizeInt)
-                return 0;         /*Is not a complete fastq file*/
+    /*>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>\
+    ^ Fun-3 Sec-2: Convert read id to bigNum read id (long array)
+    \<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<*/
 
-            *lenInputULng = fread(bufferCStr,
-                                 sizeof(char),
-                                 buffSizeInt,
-                                 fastqFile
-            ); /*Read in more of the file*/
+    /*Same conversion as parseFastqHeader, so the ids match the ids in
+    ` the hash table or AVL tree
+    */
+    do { /*While still on the read name part of header*/
+        /*Graph unsigned long element working on*/
+        elmILPtr = idBigNum->bigNumAryIOrL + idBigNum->lenUsedElmChar;
 
-            *(bufferCStr + *lenInputULng) = '\0';/*make sure a c-string*/
-            *pointInBufferCStr = bufferCStr;
-            *readStartCStr = *pointInBufferCStr;
-            continue;                           /*so can check if '\n'*/
-        } /*If ran out of buffer & need to read more of the file*/
+        /*Ids longer than the array are cut short*/
+        if(idBigNum->lenUsedElmChar < idBigNum->lenAllElmChar)
+            (idBigNum->lenUsedElmChar)++; /*Track number used longs*/
+        else
+            --elmILPtr;
 
-        (*pointInBufferCStr)++;
-    } /*While on the spacer entry*/
+        *elmILPtr = 0;
+        charBit = 0;
 
-    ++(*pointInBufferCStr); /*get off the new line*/
+        while(charBit < defMaxDigPerLimb && idCStr < endFileCStr)
+        { /*while empty bits in the current big number long element*/
+            if(hexTblCharAry[(unsigned char) *idCStr] & 64)
+                break; /*If have finshed converting the hex string*/
 
-    /*>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>
-    # Fun-2 Sec-5: Print out the q-scores entry (same number lines as sequence)
-    <<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<*/
+            if(!(hexTblCharAry[(unsigned char) *idCStr] & 32))
+            { /*If is a hex character*/
+                *elmILPtr = *elmILPtr << defBitsPerChar;
+                *elmILPtr += hexTblCharAry[(unsigned char) *idCStr];
+                ++charBit;
+            } /*If is a hex character*/
 
-    while(numSeqlinesULng > 0)
-    { /*While have q-score entry lines to print out*/
+            ++idCStr;
+        } /*while empty bits in the current big number long element*/
 
-        if(**pointInBufferCStr == '\0')
-        { /*If ran out of buffer & need to read in more of the file*/
-            /*print out old buffer*/
-            fprintf(outFILE, "%s", *readStartCStr);
+        /*Only used in speed setting*/
+        #ifndef MEM
+            idBigNum->totalL += *elmILPtr;
+        #endif
+    } while(idCStr < endFileCStr && (unsigned char) *idCStr > 32);
+    /*While still on the read name part of header*/
 
-            if(*lenInputULng < buffSizeInt)
-            { /*If at end of the file*/
-                if(numSeqlinesULng > 1)
-                    return 0;         /*Missing q-score lines for entry*/
-                else
-                    return 4;         /*At end of file & printed last line*/
-            } /*If at end of the file*/
+    return idCStr;
+} /*parseMapFastqHeader*/
 
-            *lenInputULng = fread(bufferCStr,
-                                 sizeof(char),
-                                 buffSizeInt,
-                                 fastqFile
-            ); /*Read in more of the file*/
+/*##############################################################################
+# Output:
+#    Returns:
+#        Pointer to the start of the next fastq entry (endFileCStr if last)
+#        0: If the entry is cut short (not a complete fastq entry)
+##############################################################################*/
+char * mapNextFastqEntry(
+    char *entryCStr,   /*Start of the fastq entry (the '@')*/
+    char *endFileCStr  /*One past the last character of the file*/
+) /*Finds the end of a fastq entry that is in memory*/
+{ /*mapNextFastqEntry*/
 
-            *(bufferCStr + *lenInputULng) = '\0';/*make sure a c-string*/
-            *pointInBufferCStr = bufferCStr;
-            *readStartCStr = *pointInBufferCStr;
-            continue;                           /*so can check if '\n'*/
-        } /*If ran out of buffer & need to read more of the file*/
+    /*~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~\
+    ' Fun-4 TOC:
+    '    fun-4 sec-1: Variable declerations
+    '    fun-4 sec-2: Find the end of the entry (64 byte blocks)
+    \~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~*/
 
-        if(**pointInBufferCStr == '\n')
-            numSeqlinesULng--;    /*Record number new lines, for q-score entry*/
+    /*>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>\
+    ^ Fun-4 Sec-1: Variable declerations
+    \<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<*/
 
-        (*pointInBufferCStr)++;
-    } /*While have q-score entry lines to print out*/
+    char *nextEntryCStr = 0;
+    struct fqBlockScan scanST;
 
-    /*>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>
-    # Fun-2 Sec-6: Print out remaning parts of entry in buffer
-    <<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<*/
+    /*>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>\
+    ^ Fun-4 Sec-2: Find the end of the entry (64 byte blocks)
+    \<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<*/
 
-    (*pointInBufferCStr)--;      /*Get back on the new line*/
-    **pointInBufferCStr = '\0'; /*Turn '\n' into '\0', so print stops at line*/
+    initFqBlockScan(&scanST);
+    nextEntryCStr = scanFqBlocks(&scanST, entryCStr, endFileCStr);
 
-    /*Finish printing out the read entry*/
-    fprintf(outFILE, "%s\n", *readStartCStr);
+    if(nextEntryCStr != 0) return nextEntryCStr;
 
-    **pointInBufferCStr = '\n'; /*Convert back to \n so no longer c-string*/
-    
-    return 2; /*Copied name sucessfully*/
-} /*printFastqEntry*/
+    /*Last line has no new line*/
+    if(fqBlockScanEndOk(&scanST)) return endFileCStr;
+
+    return 0; /*Entry is cut short*/
+} /*mapNextFastqEntry*/
+
+/*##############################################################################
+# Output:
+#    Returns:
+#        1: If entryCStr starts a fastq entry. The entry and the next
+#           defCheckFqEntries - 1 entries each have a sequence line, as many
+#           q-scores as bases, and are followed by a header ('@') or the end
+#           of the file.
+#        0: If entryCStr is not the start of a fastq entry (a q-score line
+#           starting with '@')
+#        2: If the entries go past endDataCStr and endFileBl is 0 (need
+#           more of the file to check)
+##############################################################################*/
+uint8_t mapCheckFastqEntry(
+    char *entryCStr,    /*Line starting with '@' to check*/
+    char *endDataCStr,  /*One past the last character in memory*/
+    uint8_t endFileBl   /*1: endDataCStr is the end of the file*/
+) /*Checks if a line in memory starting with '@' is a fastq header*/
+{ /*mapCheckFastqEntry*/
+
+    /*~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~\
+    ' Fun-5 TOC:
+    '    - A q-score line can start with '@' or '+', so a few q-score
+    '      lines can look like an entry. The entries after a q-score
+    '      line will not line up with the real entries, so the next
+    '      few entries are checked as well.
+    '    fun-5 sec-1: Variable declerations
+    '    fun-5 sec-2: Check each entry
+    \~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~*/
+
+    /*>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>\
+    ^ Fun-5 Sec-1: Variable declerations
+    \<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<*/
+
+    char *nextEntryCStr = 0;
+    struct fqBlockScan scanST;
+    int entryI = 0;
+
+    /*>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>\
+    ^ Fun-5 Sec-2: Check each entry
+    \<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<*/
+
+    for(entryI = 0; entryI < defCheckFqEntries; ++entryI)
+    { /*Loop: Check the entry and the entries after it*/
+        initFqBlockScan(&scanST);
+        nextEntryCStr = scanFqBlocks(&scanST, entryCStr, endDataCStr);
+
+        if(nextEntryCStr == 0)
+        { /*If the entry goes past the data I have*/
+            if(! endFileBl)
+                return 2;
+
+            /*Last line has no new line*/
+            return fqBlockScanEndOk(&scanST) && fqBlockScanLenOk(&scanST);
+        } /*If the entry goes past the data I have*/
+
+        if(! fqBlockScanLenOk(&scanST))
+            return 0;
+
+        while(nextEntryCStr < endDataCStr && *nextEntryCStr == '\n')
+            ++nextEntryCStr; /*Blank lines are skipped by the readers*/
+
+        if(nextEntryCStr == endDataCStr)
+            return endFileBl ? 1 : 2;
+
+        if(*nextEntryCStr != '@')
+            return 0;
+
+        entryCStr = nextEntryCStr;
+    } /*Loop: Check the entry and the entries after it*/
+
+    return 1;
+} /*mapCheckFastqEntry*/
+
+/*##############################################################################
+# Output:
+#    Returns:
+#        1: If the line at entryUL starts a fastq entry (same checks as
+#           mapCheckFastqEntry)
+#        0: If it is not the start of a fastq entry
+#    Modifies:
+#        bufferCStr to have part of the file (is used as scratch space)
+#        fastqFile to be at an unknown position (caller must seek)
+##############################################################################*/
+uint8_t checkFastqEntry(
+    unsigned long entryUL,   /*Position of the line starting with '@'*/
+    char *bufferCStr,        /*Buffer to read the entry into*/
+    uint32_t buffSizeInt,    /*Size of bufferCStr*/
+    FILE *fastqFile          /*Fastq file with the entry*/
+) /*Checks if a line in a file starting with '@' is a fastq header*/
+{ /*checkFastqEntry*/
+
+    /*~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~\
+    ' Fun-6 TOC:
+    '    - This is mapCheckFastqEntry for entries that may not fit in
+    '      the buffer. The scan state is kept between reads.
+    '    fun-6 sec-1: Variable declerations
+    '    fun-6 sec-2: Scan the entry
+    '    fun-6 sec-3: Check that the next entry starts with a header
+    \~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~*/
+
+    /*>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>\
+    ^ Fun-6 Sec-1: Variable declerations
+    \<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<*/
+
+    char *entryCStr = bufferCStr;
+    char *nextEntryCStr = 0;
+    uint64_t lenInputUL = 0;
+    struct fqBlockScan scanST;
+    int entryI = 0;
+
+    fseek(fastqFile, entryUL, SEEK_SET);
+    lenInputUL = fread(bufferCStr, sizeof(char), buffSizeInt, fastqFile);
+
+    for(entryI = 0; entryI < defCheckFqEntries; ++entryI)
+    { /*Loop: Check the entry and the entries after it*/
+
+        /*>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>\
+        ^ Fun-6 Sec-2: Scan the entry
+        \<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<*/
+
+        initFqBlockScan(&scanST);
+
+        nextEntryCStr =
+            scanFqBlocks(&scanST, entryCStr, bufferCStr + lenInputUL);
+
+        while(nextEntryCStr == 0)
+        { /*While the entry goes past the buffer*/
+            if(lenInputUL < buffSizeInt)
+            { /*If at the end of the file*/
+                /*Last line has no new line*/
+                return
+                    fqBlockScanEndOk(&scanST) && fqBlockScanLenOk(&scanST);
+            } /*If at the end of the file*/
+
+            lenInputUL =
+                fread(bufferCStr, sizeof(char), buffSizeInt, fastqFile);
+
+            nextEntryCStr =
+                scanFqBlocks(&scanST, bufferCStr, bufferCStr + lenInputUL);
+        } /*While the entry goes past the buffer*/
+
+        if(! fqBlockScanLenOk(&scanST))
+            return 0;
+
+        /*>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>\
+        ^ Fun-6 Sec-3: Check that the next entry starts with a header
+        \<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<*/
+
+        while(1)
+        { /*Loop: Find the first byte that is not a blank line*/
+            while(
+                   nextEntryCStr < bufferCStr + lenInputUL
+                && *nextEntryCStr == '\n'
+            ) ++nextEntryCStr; /*Blank lines are skipped by the readers*/
+
+            if(nextEntryCStr < bufferCStr + lenInputUL)
+                break;
+
+            if(lenInputUL < buffSizeInt)
+                return 1; /*Last entry in the file*/
+
+            lenInputUL =
+                fread(bufferCStr, sizeof(char), buffSizeInt, fastqFile);
+
+            nextEntryCStr = bufferCStr;
+        } /*Loop: Find the first byte that is not a blank line*/
+
+        if(*nextEntryCStr != '@')
+            return 0;
+
+        entryCStr = nextEntryCStr;
+    } /*Loop: Check the entry and the entries after it*/
+
+    return 1;
+} /*checkFastqEntry*/
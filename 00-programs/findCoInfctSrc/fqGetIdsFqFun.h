@@ -52,4 +52,68 @@ uint8_t printFastqEntry(
     FILE *fastqFile               /*Fastq file to get data from*/
 ); /*Reads input from file & marks end of read name*/
 
+/*##############################################################################
+# Output:
+#    Modifies: idBigNum to hold the read id starting at idCStr
+#    Returns: Pointer to the first invisible character after the read id
+#    Note: This is parseFastqHeader for a fastq file that is in memory
+#          (memory mapped), so endFileCStr marks the end (no '\0').
+##############################################################################*/
+char * parseMapFastqHeader(
+    char *idCStr,            /*Start of read id (after the '@')*/
+    char *endFileCStr,       /*One past the last character of the file*/
+    struct bigNum *idBigNum  /*Will hold big number found*/
+); /*Converts a read id in memory to a bigNum*/
+
+/*##############################################################################
+# Output:
+#    Returns:
+#        Pointer to the start of the next fastq entry (endFileCStr if last)
+#        0: If the entry is cut short (not a complete fastq entry)
+##############################################################################*/
+char * mapNextFastqEntry(
+    char *entryCStr,   /*Start of the fastq entry (the '@')*/
+    char *endFileCStr  /*One past the last character of the file*/
+); /*Finds the end of a fastq entry that is in memory*/
+
+/*Number of entries mapCheckFastqEntry and checkFastqEntry check before a
+` line starting with '@' is taken as a header
+*/
+#define defCheckFqEntries 4
+
+/*##############################################################################
+# Output:
+#    Returns:
+#        1: If entryCStr starts a fastq entry. The entry and the next
+#           defCheckFqEntries - 1 entries each have a sequence line, as many
+#           q-scores as bases, and are followed by a header ('@') or the end
+#           of the file.
+#        0: If entryCStr is not the start of a fastq entry (a q-score line
+#           starting with '@')
+#        2: If the entries go past endDataCStr and endFileBl is 0 (need
+#           more of the file to check)
+##############################################################################*/
+uint8_t mapCheckFastqEntry(
+    char *entryCStr,    /*Line starting with '@' to check*/
+    char *endDataCStr,  /*One past the last character in memory*/
+    uint8_t endFileBl   /*1: endDataCStr is the end of the file*/
+); /*Checks if a line in memory starting with '@' is a fastq header*/
+
+/*##############################################################################
+# Output:
+#    Returns:
+#        1: If the line at entryUL starts a fastq entry (same checks as
+#           mapCheckFastqEntry)
+#        0: If it is not the start of a fastq entry
+#    Modifies:
+#        bufferCStr to have part of the file (is used as scratch space)
+#        fastqFile to be at an unknown position (caller must seek)
+##############################################################################*/
+uint8_t checkFastqEntry(
+    unsigned long entryUL,   /*Position of the line starting with '@'*/
+    char *bufferCStr,        /*Buffer to read the entry into*/
+    uint32_t buffSizeInt,    /*Size of bufferCStr*/
+    FILE *fastqFile          /*Fastq file with the entry*/
+); /*Checks if a line in a file starting with '@' is a fastq header*/
+
 #endif
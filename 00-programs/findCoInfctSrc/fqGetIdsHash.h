@@ -26,6 +26,8 @@
 #    Modifies: numCharChar to hold the number of characters used in hash
 #    Modifies: digPerKeyUChar to hold the hash size (as multiple of two)
 #    Modifies: magickNumULng to hold the magick number for this hash table
+#    Note: If arenaST is not 0, the readInfo nodes are from arenaST, so
+#          free the table with free(hashTbl) & freeMemArena, not freeHashTbl
 ##############################################################################*/
 struct readInfo ** makeReadHash(
     FILE * filtFILE,               /*file with read id's to filter by*/
@@ -35,7 +37,8 @@ struct readInfo ** makeReadHash(
     uint64_t *hashSizeULng,       /*Will hold Size of hash table*/
     uint8_t *digPerKeyUChar,      /*Power of two hash size is at*/
     unsigned long *majicNumULng,  /*Holds majick number for kunths hash*/
-    uint8_t *failedChar           /*Tells if did not make hash table*/
+    uint8_t *failedChar,          /*Tells if did not make hash table*/
+    struct memArena *arenaST      /*Arena for the nodes (0: malloc)*/
 ); /*Makes a read hash array using input read ids*/
 
 /*##############################################################################
@@ -57,7 +60,8 @@ void insertHashEntry(
     struct readInfo *readNode,   /*readNode to insert into hash table*/
     const unsigned long *majicNumULng,  /*Majick number to mulitply by*/
     const uint8_t *digPerKeyUChar, /*Hash table size 2^digPerKeyUChar*/
-    struct readNodeStack *readStack /*Stack, (as array) for searching*/
+    struct readNodeStack *readStack, /*Stack, (as array) for searching*/
+    struct memArena *arenaST       /*Arena readNode is from (0: malloc)*/
 ); /*Iinserts a read into a hash table*/
 
 /*##############################################################################
@@ -0,0 +1,1101 @@
+/*######################################################################
+# Name: fqGetIdsIndex
+# Use:
+#    Sorted read id index (sidecar file) for a fastq file, so the
+#    same fastq can be searched many times without rescanning it.
+# Note:
+#    The index file is in the native byte order. It is a cache for the
+#    fastq on this machine, not a file to share.
+######################################################################*/
+
+/*~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~\
+' SOF: Start of Functions
+'   - fun-1 makeFqIndex:
+'     o Builds a sorted read id index for a fastq file
+'   - fun-2 writeFqIndex:
+'     o Saves a fastq index to its sidecar file
+'   - fun-3 readFqIndex:
+'     o Reads in a fastq index if it is up to date
+'   - fun-4 getFqIndex:
+'     o Gets an up to date index for a fastq file
+'   - fun-5 findFqIndexKey:
+'     o Binary search for the first entry with a read ids key
+'   - fun-6 preadFqIndexEntry:
+'     o Reads one fastq entry in with pread
+'   - fun-7 fqIndexEntryIsId:
+'     o Checks that a key match (index) is the read id looking for
+'   - fun-8 fqIndexExtract:
+'     o Extracts a list of reads from a fastq with its index
+'   - fun-9 rmFqIndexEntry:
+'     o Removes a read from an index
+'   - fun-10 freeFqIndex:
+'     o Frees a fqIndex struct
+'   - fun-11 fqIndexMvRead:
+'     o Moves one read out of an indexed fastq file
+'   - fun-12 bigNumToFqIdxKey:
+'     o Makes the 128 bit key for a read id
+'   - fun-13 fqIdxStamp:
+'     o Copies the size, inode, and modification time of a file
+'   - fun-14 cmpFqIdxEntries:
+'     o qsort compare for entries (by key)
+'   - fun-15 cmpFqIdxHits:
+'     o qsort compare for found reads (by position in file)
+\~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~*/
+
+/*For pread, mmap, and st_mtim*/
+#ifndef _POSIX_C_SOURCE
+    #define _POSIX_C_SOURCE 200809L
+#endif
+
+#include "fqGetIdsIndex.h"
+#include <string.h>
+#include <stddef.h>  /*offsetof*/
+#include <errno.h>
+#include <fcntl.h>
+#include <unistd.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+
+/*Bytes of the fqIndex struct that are the index file header*/
+#define defFqIdxHeadBytes offsetof(struct fqIndex, entryAry)
+
+/*Keys are made from the limbs, so MEM builds need their own index*/
+#define defFqIdxLimbBytes sizeof(*((struct bigNum *) 0)->bigNumAryIOrL)
+
+/*---------------------------------------------------------------------\
+| Struct-1: fqIdxHit
+|   o Entry that has the key of a read to extract and the read
+\---------------------------------------------------------------------*/
+typedef struct fqIdxHit
+{ /*fqIdxHit*/
+    struct fqIdxEntry *entryST; /*Entry with the key*/
+    struct bigNum *idBigNum;    /*Read id wanted*/
+}fqIdxHit;
+
+static void bigNumToFqIdxKey(
+    struct bigNum *idBigNum,
+    uint64_t *keyAryUL
+);
+
+static uint8_t fqIdxStamp(
+    char *pathCStr,
+    struct fqIndex *idxST
+);
+
+static int cmpFqIdxEntries(
+    const void *oneEntry,
+    const void *twoEntry
+);
+
+static int cmpFqIdxHits(
+    const void *oneHit,
+    const void *twoHit
+);
+
+/*---------------------------------------------------------------------\
+| Output:
+|   - Returns:
+|     o fqIndex with all reads in the fastq file
+|     o 0 if the file is not an uncompressed fastq or had a memory
+|       error
+\---------------------------------------------------------------------*/
+struct fqIndex * makeFqIndex(
+    char *fqPathCStr /*Fastq file to index*/
+) /*Builds a sorted read id index for a fastq file*/
+{ /*makeFqIndex*/
+
+    /*~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~\
+    ' Fun-1 TOC: makeFqIndex
+    '    fun-1 sec-1: Variable declerations
+    '    fun-1 sec-2: Stamp the index and map the fastq file
+    '    fun-1 sec-3: Find the key, start, and length of each read
+    '    fun-1 sec-4: Sort the entries by key and clean up
+    \~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~*/
+
+    /*>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>\
+    ^ Fun-1 Sec-1: Variable declerations
+    \<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<*/
+
+    char dummyConvertCStr[] = "0"; /*blank number to initalize bignum*/
+    int32_t lenIdInt = 256;
+
+    int fqFd = -1;
+    char *mapCStr = 0;     /*Memory mapped fastq file*/
+    char *entryCStr = 0;   /*Fastq entry on*/
+    char *nextCStr = 0;    /*Next fastq entry*/
+    char *endFileCStr = 0; /*One past the end of the fastq file*/
+
+    unsigned long maxEntriesUL = 0;
+    void *tmpPtr = 0;
+
+    struct bigNum *idBigNum = 0;
+    struct fqIdxEntry *entryST = 0;
+    struct fqIndex *idxST = calloc(1, sizeof(struct fqIndex));
+
+    /*>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>\
+    ^ Fun-1 Sec-2: Stamp the index and map the fastq file
+    \<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<*/
+
+    if(idxST == 0) return 0;
+
+    memcpy(idxST->magicAryC, defFqIdxMagic, 8);
+    idxST->limbBytesUI = defFqIdxLimbBytes;
+
+    if(!(fqIdxStamp(fqPathCStr, idxST) & 1)) goto err_fun1_sec4;
+    if(idxST->fileSizeUL == 0) return idxST; /*Empty fastq*/
+
+    idBigNum = makeBigNumStruct(dummyConvertCStr, &lenIdInt);
+    if(idBigNum == 0) goto err_fun1_sec4;
+
+    fqFd = open(fqPathCStr, O_RDONLY);
+    if(fqFd < 0) goto err_fun1_sec4;
+
+    mapCStr =
+        mmap(
+            0,
+            idxST->fileSizeUL,
+            PROT_READ,
+            MAP_PRIVATE,
+            fqFd,
+            0
+    ); /*Map the fastq file*/
+
+    close(fqFd); /*The map keeps its own reference to the file*/
+
+    if(mapCStr == MAP_FAILED)
+    { /*If could not map the file*/
+        mapCStr = 0;
+        goto err_fun1_sec4;
+    } /*If could not map the file*/
+
+    posix_madvise(mapCStr, idxST->fileSizeUL, POSIX_MADV_SEQUENTIAL);
+
+    /*Compressed files have positions that do not match the reads*/
+    if(*mapCStr != '@') goto err_fun1_sec4;
+
+    /*>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>\
+    ^ Fun-1 Sec-3: Find the key, start, and length of each read
+    \<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<*/
+
+    entryCStr = mapCStr;
+    endFileCStr = mapCStr + idxST->fileSizeUL;
+
+    while(entryCStr < endFileCStr)
+    { /*While have reads to index*/
+        if(*entryCStr != '@')
+        { /*If on a blank line (ends the file)*/
+            ++entryCStr;
+            continue;
+        } /*If on a blank line (ends the file)*/
+
+        nextCStr = mapNextFastqEntry(entryCStr, endFileCStr);
+        if(nextCStr == 0) goto err_fun1_sec4; /*Incomplete entry*/
+
+        if(idxST->numEntriesUL >= maxEntriesUL)
+        { /*If need more entries*/
+            maxEntriesUL += (maxEntriesUL >> 1) + 1024;
+            tmpPtr =
+                realloc(
+                    idxST->entryAry,
+                    maxEntriesUL * sizeof(struct fqIdxEntry)
+            );
+
+            if(tmpPtr == 0) goto err_fun1_sec4;
+            idxST->entryAry = tmpPtr;
+        } /*If need more entries*/
+
+        entryST = idxST->entryAry + idxST->numEntriesUL;
+
+        parseMapFastqHeader(entryCStr + 1, endFileCStr, idBigNum);
+        bigNumToFqIdxKey(idBigNum, entryST->keyAryUL);
+
+        entryST->offsetUL = entryCStr - mapCStr;
+        entryST->lenUL = nextCStr - entryCStr;
+        ++idxST->numEntriesUL;
+
+        entryCStr = nextCStr;
+    } /*While have reads to index*/
+
+    /*>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>\
+    ^ Fun-1 Sec-4: Sort the entries by key and clean up
+    \<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<*/
+
+    qsort(
+        idxST->entryAry,
+        idxST->numEntriesUL,
+        sizeof(struct fqIdxEntry),
+        cmpFqIdxEntries
+    );
+
+    munmap(mapCStr, idxST->fileSizeUL);
+    freeBigNumStruct(&idBigNum);
+    return idxST;
+
+    err_fun1_sec4:
+
+    if(mapCStr != 0) munmap(mapCStr, idxST->fileSizeUL);
+    if(idBigNum != 0) freeBigNumStruct(&idBigNum);
+    freeFqIndex(&idxST);
+    return 0;
+} /*makeFqIndex*/
+
+/*---------------------------------------------------------------------\
+| Output:
+|   - Creates:
+|     o fqPathCStr + defFqIdxExt with the index
+|   - Modifies:
+|     o Stamp in idxST to be the stamp of the current fastq file
+|   - Returns:
+|     o 1 if wrote the index
+|     o 4 if could not stat the fastq file
+|     o 8 if could not write the index file
+\---------------------------------------------------------------------*/
+uint8_t writeFqIndex(
+    struct fqIndex *idxST, /*Index to save*/
+    char *fqPathCStr       /*Fastq file the index is for*/
+) /*Saves a fastq index to its sidecar file*/
+{ /*writeFqIndex*/
+
+    /*~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~\
+    ' Fun-2 TOC: Sec-1 Sub-1: writeFqIndex
+    \~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~*/
+
+    char idxPathCStr[1024];
+    char tmpPathCStr[1024 + 8];
+    FILE *idxFILE = 0;
+    unsigned long numOutUL = 0;
+
+    if(!(fqIdxStamp(fqPathCStr, idxST) & 1)) return 4;
+
+    snprintf(idxPathCStr, 1024, "%s%s", fqPathCStr, defFqIdxExt);
+    snprintf(tmpPathCStr, 1024 + 8, "%s.tmp", idxPathCStr);
+
+    /*Write to a temporary file, so readers never see half an index*/
+    idxFILE = fopen(tmpPathCStr, "wb");
+    if(idxFILE == 0) return 8;
+
+    numOutUL = fwrite(idxST, defFqIdxHeadBytes, 1, idxFILE);
+
+    if(idxST->numEntriesUL > 0)
+        numOutUL +=
+            fwrite(
+                idxST->entryAry,
+                sizeof(struct fqIdxEntry),
+                idxST->numEntriesUL,
+                idxFILE
+        );
+
+    if(fclose(idxFILE) != 0 || numOutUL != idxST->numEntriesUL + 1)
+    { /*If could not write the whole index*/
+        remove(tmpPathCStr);
+        return 8;
+    } /*If could not write the whole index*/
+
+    if(rename(tmpPathCStr, idxPathCStr) != 0)
+    { /*If could not replace the old index*/
+        remove(tmpPathCStr);
+        return 8;
+    } /*If could not replace the old index*/
+
+    return 1;
+} /*writeFqIndex*/
+
+/*---------------------------------------------------------------------\
+| Output:
+|   - Returns:
+|     o fqIndex from fqPathCStr + defFqIdxExt
+|     o 0 if there is no index, the index is out of date, or had a
+|       memory error
+\---------------------------------------------------------------------*/
+struct fqIndex * readFqIndex(
+    char *fqPathCStr /*Fastq file to get the index for*/
+) /*Reads in a fastq index if it is up to date*/
+{ /*readFqIndex*/
+
+    /*~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~\
+    ' Fun-3 TOC: Sec-1 Sub-1: readFqIndex
+    \~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~*/
+
+    char idxPathCStr[1024];
+    FILE *idxFILE = 0;
+    struct fqIndex fqStampST; /*Stamp of the current fastq*/
+    struct fqIndex *idxST = 0;
+
+    if(!(fqIdxStamp(fqPathCStr, &fqStampST) & 1)) return 0;
+
+    snprintf(idxPathCStr, 1024, "%s%s", fqPathCStr, defFqIdxExt);
+    idxFILE = fopen(idxPathCStr, "rb");
+    if(idxFILE == 0) return 0;
+
+    idxST = calloc(1, sizeof(struct fqIndex));
+    if(idxST == 0) goto err_fun3;
+
+    if(fread(idxST, defFqIdxHeadBytes, 1, idxFILE) != 1) goto err_fun3;
+
+    /*Check if the index is for this version of the fastq file*/
+    if(
+          memcmp(idxST->magicAryC, defFqIdxMagic, 8) != 0
+       || idxST->limbBytesUI != defFqIdxLimbBytes
+       || idxST->fileSizeUL != fqStampST.fileSizeUL
+       || idxST->inodeUL != fqStampST.inodeUL
+       || idxST->mtimeSecSL != fqStampST.mtimeSecSL
+       || idxST->mtimeNsecSL != fqStampST.mtimeNsecSL
+    ) goto err_fun3;
+
+    if(idxST->numEntriesUL > 0)
+    { /*If have entries to read in*/
+        idxST->entryAry =
+            malloc(idxST->numEntriesUL * sizeof(struct fqIdxEntry));
+
+        if(idxST->entryAry == 0) goto err_fun3;
+
+        if(
+            fread(
+                idxST->entryAry,
+                sizeof(struct fqIdxEntry),
+                idxST->numEntriesUL,
+                idxFILE
+            ) != idxST->numEntriesUL
+        ) goto err_fun3;
+    } /*If have entries to read in*/
+
+    fclose(idxFILE);
+    return idxST;
+
+    err_fun3:
+
+    fclose(idxFILE);
+
+    if(idxST != 0)
+    { /*If need to free the partial index*/
+        if(idxST->entryAry != 0) free(idxST->entryAry);
+
+        free(idxST);
+    } /*If need to free the partial index*/
+
+    return 0;
+} /*readFqIndex*/
+
+/*---------------------------------------------------------------------\
+| Output:
+|   - Returns:
+|     o fqIndex for fqPathCStr (reads or builds & saves the index)
+|     o 0 if could not make an index
+\---------------------------------------------------------------------*/
+struct fqIndex * getFqIndex(
+    char *fqPathCStr /*Fastq file to get the index for*/
+) /*Gets an up to date index for a fastq file*/
+{ /*getFqIndex*/
+
+    /*~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~\
+    ' Fun-4 TOC: Sec-1 Sub-1: getFqIndex
+    \~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~*/
+
+    struct fqIndex *idxST = readFqIndex(fqPathCStr);
+
+    if(idxST != 0) return idxST;
+
+    idxST = makeFqIndex(fqPathCStr);
+
+    /*A index that can not be saved still works for this search*/
+    if(idxST != 0) writeFqIndex(idxST, fqPathCStr);
+
+    return idxST;
+} /*getFqIndex*/
+
+/*---------------------------------------------------------------------\
+| Output:
+|   - Returns:
+|     o First entry in idxST with the same key as idBigNum
+|     o idxST->numEntriesUL if no entry has the key
+\---------------------------------------------------------------------*/
+unsigned long findFqIndexKey(
+    struct fqIndex *idxST,  /*Index to search*/
+    struct bigNum *idBigNum /*Read id to find*/
+) /*Binary search for the first entry with a read ids key*/
+{ /*findFqIndexKey*/
+
+    /*~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~\
+    ' Fun-5 TOC: Sec-1 Sub-1: findFqIndexKey
+    \~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~*/
+
+    uint64_t keyAryUL[2];
+    unsigned long startUL = 0;
+    unsigned long endUL = idxST->numEntriesUL;
+    unsigned long midUL = 0;
+    struct fqIdxEntry *entryST = 0;
+
+    bigNumToFqIdxKey(idBigNum, keyAryUL);
+
+    while(startUL < endUL)
+    { /*Binary search for the first entry >= the key*/
+        midUL = startUL + ((endUL - startUL) >> 1);
+        entryST = idxST->entryAry + midUL;
+
+        if(
+              entryST->keyAryUL[0] < keyAryUL[0]
+           || (
+                    entryST->keyAryUL[0] == keyAryUL[0]
+                 && entryST->keyAryUL[1] < keyAryUL[1]
+              )
+        ) startUL = midUL + 1;
+
+        else endUL = midUL;
+    } /*Binary search for the first entry >= the key*/
+
+    if(startUL >= idxST->numEntriesUL) return idxST->numEntriesUL;
+
+    entryST = idxST->entryAry + startUL;
+
+    if(
+           entryST->keyAryUL[0] != keyAryUL[0]
+        || entryST->keyAryUL[1] != keyAryUL[1]
+    ) return idxST->numEntriesUL;
+
+    return startUL;
+} /*findFqIndexKey*/
+
+/*---------------------------------------------------------------------\
+| Output:
+|   - Modifies:
+|     o buffCStr to have the fastq entry (resized if to small)
+|     o lenBuffUL to be the new size of buffCStr
+|   - Returns:
+|     o 1 if read in the entry
+|     o 4 if could not read the entry from fqFd
+|     o 64 for memory errors
+\---------------------------------------------------------------------*/
+uint8_t preadFqIndexEntry(
+    struct fqIndex *idxST,   /*Index with the entry*/
+    unsigned long entryUL,   /*Entry to read in*/
+    int fqFd,                /*Open fastq file the index is for*/
+    char **buffCStr,         /*Buffer to hold the entry*/
+    unsigned long *lenBuffUL /*Size of buffCStr*/
+) /*Reads one fastq entry in with pread*/
+{ /*preadFqIndexEntry*/
+
+    /*~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~\
+    ' Fun-6 TOC: Sec-1 Sub-1: preadFqIndexEntry
+    \~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~*/
+
+    struct fqIdxEntry *entryST = idxST->entryAry + entryUL;
+    unsigned long lenReadUL = 0;
+    ssize_t lenInSL = 0;
+    void *tmpPtr = 0;
+
+    if(*lenBuffUL < entryST->lenUL)
+    { /*If need a bigger buffer*/
+        tmpPtr = realloc(*buffCStr, entryST->lenUL);
+        if(tmpPtr == 0) return 64;
+
+        *buffCStr = tmpPtr;
+        *lenBuffUL = entryST->lenUL;
+    } /*If need a bigger buffer*/
+
+    while(lenReadUL < entryST->lenUL)
+    { /*While have not read in the whole entry*/
+        lenInSL =
+            pread(
+                fqFd,
+                *buffCStr + lenReadUL,
+                entryST->lenUL - lenReadUL,
+                entryST->offsetUL + lenReadUL
+        );
+
+        if(lenInSL < 0 && errno == EINTR) continue;
+        if(lenInSL <= 0) return 4; /*Error or file is to short*/
+
+        lenReadUL += lenInSL;
+    } /*While have not read in the whole entry*/
+
+    return 1;
+} /*preadFqIndexEntry*/
+
+/*---------------------------------------------------------------------\
+| Output:
+|   - Returns:
+|     o 1 if the fastq entry in entryCStr has idBigNum as its read id
+|     o 0 if the read ids are different
+|   - Modifies:
+|     o scratchBigNum to have the entries read id
+\---------------------------------------------------------------------*/
+uint8_t fqIndexEntryIsId(
+    char *entryCStr,            /*Fastq entry from preadFqIndexEntry*/
+    unsigned long lenEntryUL,   /*Length of entryCStr*/
+    struct bigNum *idBigNum,    /*Read id looking for*/
+    struct bigNum *scratchBigNum/*Holds entries id (has limbs)*/
+) /*Checks that a key match (index) is the read id looking for*/
+{ /*fqIndexEntryIsId*/
+
+    /*~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~\
+    ' Fun-7 TOC: Sec-1 Sub-1: fqIndexEntryIsId
+    \~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~*/
+
+    if(lenEntryUL < 2 || *entryCStr != '@') return 0;
+
+    parseMapFastqHeader(
+        entryCStr + 1,
+        entryCStr + lenEntryUL,
+        scratchBigNum
+    );
+
+    return cmpBigNums(idBigNum, scratchBigNum) == 0;
+} /*fqIndexEntryIsId*/
+
+/*---------------------------------------------------------------------\
+| Output:
+|   - Prints:
+|     o The reads in readList to outFILE in the order they are in the
+|       fastq file
+|   - Modifies:
+|     o numPrintedUL to be the number of reads printed
+|   - Returns:
+|     o 1 if no errors
+|     o 4 if could not read the fastq file
+|     o 64 for memory errors
+\---------------------------------------------------------------------*/
+uint8_t fqIndexExtract(
+    struct fqIndex *idxST,      /*Index of the fastq file*/
+    char *fqPathCStr,           /*Fastq file to extract reads from*/
+    struct readInfo *readList,  /*Reads to extract (rightChild list)*/
+    FILE *outFILE,              /*File to print reads to*/
+    unsigned long *numPrintedUL /*Number of reads printed*/
+) /*Extracts a list of reads from a fastq with its index*/
+{ /*fqIndexExtract*/
+
+    /*~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~\
+    ' Fun-8 TOC: fqIndexExtract
+    '    fun-8 sec-1: Variable declerations
+    '    fun-8 sec-2: Find the entries with the keys of each read
+    '    fun-8 sec-3: Print the reads in file order
+    \~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~*/
+
+    /*>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>\
+    ^ Fun-8 Sec-1: Variable declerations
+    \<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<*/
+
+    char dummyConvertCStr[] = "0"; /*blank number to initalize bignum*/
+    int32_t lenIdInt = 256;
+
+    uint8_t errUC = 1;
+    int fqFd = -1;
+
+    char *buffCStr = 0;
+    unsigned long lenBuffUL = 0;
+
+    unsigned long entryUL = 0;
+    unsigned long firstUL = 0;     /*First entry with the reads key*/
+    unsigned long numHitsUL = 0;
+    unsigned long maxHitsUL = 0;
+    struct fqIdxHit *hitAryST = 0;
+    void *tmpPtr = 0;
+
+    struct readInfo *readOn = readList;
+    struct bigNum *scratchBigNum = 0;
+    struct fqIdxEntry *lastEntry = 0; /*Skips reads in the list twice*/
+
+    *numPrintedUL = 0;
+
+    /*>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>\
+    ^ Fun-8 Sec-2: Find the entries with the keys of each read
+    \<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<*/
+
+    while(readOn != 0)
+    { /*For all reads to extract*/
+        firstUL = findFqIndexKey(idxST, readOn->idBigNum);
+        entryUL = firstUL;
+
+        /*Different ids with the same key are removed in sec-3*/
+        while(
+               entryUL < idxST->numEntriesUL
+            && idxST->entryAry[entryUL].keyAryUL[0]
+                == idxST->entryAry[firstUL].keyAryUL[0]
+            && idxST->entryAry[entryUL].keyAryUL[1]
+                == idxST->entryAry[firstUL].keyAryUL[1]
+        ) { /*While have entries with the reads key*/
+            if(numHitsUL >= maxHitsUL)
+            { /*If need more hits*/
+                maxHitsUL += (maxHitsUL >> 1) + 64;
+                tmpPtr =
+                    realloc(hitAryST, maxHitsUL * sizeof(struct fqIdxHit));
+
+                if(tmpPtr == 0)
+                { /*If had a memory error*/
+                    errUC = 64;
+                    goto cleanUp_fun8_sec3;
+                } /*If had a memory error*/
+
+                hitAryST = tmpPtr;
+            } /*If need more hits*/
+
+            hitAryST[numHitsUL].entryST = idxST->entryAry + entryUL;
+            hitAryST[numHitsUL].idBigNum = readOn->idBigNum;
+            ++numHitsUL;
+            ++entryUL;
+        } /*While have entries with the reads key*/
+
+        readOn = readOn->rightChild;
+    } /*For all reads to extract*/
+
+    /*>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>\
+    ^ Fun-8 Sec-3: Print the reads in file order
+    \<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<*/
+
+    if(numHitsUL == 0) goto cleanUp_fun8_sec3;
+
+    qsort(hitAryST, numHitsUL, sizeof(struct fqIdxHit), cmpFqIdxHits);
+
+    scratchBigNum = makeBigNumStruct(dummyConvertCStr, &lenIdInt);
+
+    if(scratchBigNum == 0)
+    { /*If had a memory error*/
+        errUC = 64;
+        goto cleanUp_fun8_sec3;
+    } /*If had a memory error*/
+
+    fqFd = open(fqPathCStr, O_RDONLY);
+
+    if(fqFd < 0)
+    { /*If could not open the fastq file*/
+        errUC = 4;
+        goto cleanUp_fun8_sec3;
+    } /*If could not open the fastq file*/
+
+    for(unsigned long iHit = 0; iHit < numHitsUL; ++iHit)
+    { /*Loop through all entries with a wanted key*/
+        if(hitAryST[iHit].entryST == lastEntry)
+            continue; /*Already printed this read*/
+
+        entryUL = hitAryST[iHit].entryST - idxST->entryAry;
+        errUC =
+            preadFqIndexEntry(idxST, entryUL, fqFd, &buffCStr, &lenBuffUL);
+
+        if(!(errUC & 1)) break;
+
+        if(
+            !fqIndexEntryIsId(
+                buffCStr,
+                hitAryST[iHit].entryST->lenUL,
+                hitAryST[iHit].idBigNum,
+                scratchBigNum
+            )
+        ) continue; /*Different read with the same key*/
+
+        fwrite(buffCStr, 1, hitAryST[iHit].entryST->lenUL, outFILE);
+
+        /*The last read may not end in a new line*/
+        if(buffCStr[hitAryST[iHit].entryST->lenUL - 1] != '\n')
+            fputc('\n', outFILE);
+
+        lastEntry = hitAryST[iHit].entryST;
+        ++(*numPrintedUL);
+    } /*Loop through all entries with a wanted key*/
+
+    cleanUp_fun8_sec3:
+
+    if(fqFd >= 0) close(fqFd);
+    if(buffCStr != 0) free(buffCStr);
+    if(hitAryST != 0) free(hitAryST);
+    if(scratchBigNum != 0) freeBigNumStruct(&scratchBigNum);
+
+    return errUC;
+} /*fqIndexExtract*/
+
+/*---------------------------------------------------------------------\
+| Output:
+|   - Modifies:
+|     o idxST to not have entryUL and the reads after entryUL to start
+|       entryUL's length sooner (the fastq without the entry)
+\---------------------------------------------------------------------*/
+void rmFqIndexEntry(
+    struct fqIndex *idxST, /*Index to remove an entry from*/
+    unsigned long entryUL  /*Entry to remove*/
+) /*Removes a read from an index (read was removed from the fastq)*/
+{ /*rmFqIndexEntry*/
+
+    /*~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~\
+    ' Fun-9 TOC: Sec-1 Sub-1: rmFqIndexEntry
+    \~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~*/
+
+    uint64_t offsetUL = idxST->entryAry[entryUL].offsetUL;
+    uint64_t lenUL = idxST->entryAry[entryUL].lenUL;
+
+    /*Keep the entries sorted by key*/
+    memmove(
+        idxST->entryAry + entryUL,
+        idxST->entryAry + entryUL + 1,
+        (idxST->numEntriesUL - entryUL - 1) * sizeof(struct fqIdxEntry)
+    );
+
+    --idxST->numEntriesUL;
+
+    for(unsigned long iEntry = 0; iEntry < idxST->numEntriesUL; ++iEntry)
+    { /*Loop through all entries*/
+        if(idxST->entryAry[iEntry].offsetUL > offsetUL)
+            idxST->entryAry[iEntry].offsetUL -= lenUL;
+    } /*Loop through all entries*/
+} /*rmFqIndexEntry*/
+
+/*---------------------------------------------------------------------\
+| Output:
+|   - Frees:
+|     o idxST and sets it to 0
+\---------------------------------------------------------------------*/
+void freeFqIndex(
+    struct fqIndex **idxST /*Index to free*/
+) /*Frees a fqIndex struct*/
+{ /*freeFqIndex*/
+
+    /*~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~\
+    ' Fun-10 TOC: Sec-1 Sub-1: freeFqIndex
+    \~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~*/
+
+    if(*idxST == 0) return;
+
+    if((*idxST)->entryAry != 0) free((*idxST)->entryAry);
+    free(*idxST);
+    *idxST = 0;
+} /*freeFqIndex*/
+
+/*---------------------------------------------------------------------\
+| Output:
+|   - Prints:
+|     o The fastq entry with idCStr to keptFILE
+|   - Modifies:
+|     o fqPathCStr to not have the read (rewritten with a tmp file)
+|     o The index of fqPathCStr to not have the read (is not rebuilt)
+|   - Returns:
+|     o 1 if moved the read
+|     o 2 if could not index fqPathCStr or the read is not in it
+|     o 4 if could not read fqPathCStr or write the new fastq
+|     o 64 for memory errors
+|   - Note:
+|     o fqPathCStr is not changed unless 1 is returned
+\---------------------------------------------------------------------*/
+uint8_t fqIndexMvRead(
+    char *idCStr,     /*Read id to move ('@' at start is ignored)*/
+    char *fqPathCStr, /*Fastq file to move the read out of*/
+    FILE *keptFILE    /*File to print the read to*/
+) /*Moves one read out of an indexed fastq file*/
+{ /*fqIndexMvRead*/
+
+    /*~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~\
+    ' Fun-11 TOC: fqIndexMvRead
+    '    fun-11 sec-1: Variable declerations
+    '    fun-11 sec-2: Find the read with the index
+    '    fun-11 sec-3: Copy every other read to a temporary fastq
+    '    fun-11 sec-4: Replace the fastq and update the index
+    \~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~*/
+
+    /*>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>\
+    ^ Fun-11 Sec-1: Variable declerations
+    \<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<*/
+
+    char dummyConvertCStr[] = "0"; /*blank number to initalize bignum*/
+    int32_t lenIdInt = 256;
+
+    uint8_t errUC = 2;
+    int fqFd = -1;
+
+    char tmpPathCStr[1024];
+    char *buffCStr = 0;
+    unsigned long lenBuffUL = 0;
+
+    unsigned long entryUL = 0;
+    unsigned long firstUL = 0;
+    uint64_t offsetUL = 0;
+    uint64_t endUL = 0;
+    ssize_t lenInSL = 0;
+
+    struct bigNum *idBigNum = 0;
+    struct bigNum *scratchBigNum = 0;
+    struct fqIndex *idxST = 0;
+    FILE *tmpFILE = 0;
+
+    /*>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>\
+    ^ Fun-11 Sec-2: Find the read with the index
+    \<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<*/
+
+    idxST = getFqIndex(fqPathCStr);
+    if(idxST == 0) return 2;
+
+    idBigNum = makeBigNumStruct(dummyConvertCStr, &lenIdInt);
+    scratchBigNum = makeBigNumStruct(dummyConvertCStr, &lenIdInt);
+
+    if(idBigNum == 0 || scratchBigNum == 0)
+    { /*If had a memory error*/
+        errUC = 64;
+        goto cleanUp_fun11_sec4;
+    } /*If had a memory error*/
+
+    if(*idCStr == '@') ++idCStr;
+    parseMapFastqHeader(idCStr, idCStr + strlen(idCStr), idBigNum);
+
+    fqFd = open(fqPathCStr, O_RDONLY);
+
+    if(fqFd < 0)
+    { /*If could not open the fastq file*/
+        errUC = 4;
+        goto cleanUp_fun11_sec4;
+    } /*If could not open the fastq file*/
+
+    firstUL = findFqIndexKey(idxST, idBigNum);
+
+    for(
+        entryUL = firstUL;
+        entryUL < idxST->numEntriesUL;
+        ++entryUL
+    ){ /*Loop through the entries with the reads key*/
+        if(
+               idxST->entryAry[entryUL].keyAryUL[0]
+                != idxST->entryAry[firstUL].keyAryUL[0]
+            || idxST->entryAry[entryUL].keyAryUL[1]
+                != idxST->entryAry[firstUL].keyAryUL[1]
+        ) break; /*No more entries with the key*/
+
+        errUC =
+            preadFqIndexEntry(idxST, entryUL, fqFd, &buffCStr, &lenBuffUL);
+
+        if(!(errUC & 1)) goto cleanUp_fun11_sec4;
+
+        errUC = 2;
+
+        if(
+            fqIndexEntryIsId(
+                buffCStr,
+                idxST->entryAry[entryUL].lenUL,
+                idBigNum,
+                scratchBigNum
+            )
+        ){ /*If found the read*/
+            errUC = 1;
+            break;
+        } /*If found the read*/
+    } /*Loop through the entries with the reads key*/
+
+    if(errUC != 1) goto cleanUp_fun11_sec4; /*Not in the fastq*/
+
+    offsetUL = idxST->entryAry[entryUL].offsetUL;
+    endUL = offsetUL + idxST->entryAry[entryUL].lenUL;
+
+    fwrite(buffCStr, 1, idxST->entryAry[entryUL].lenUL, keptFILE);
+
+    if(buffCStr[idxST->entryAry[entryUL].lenUL - 1] != '\n')
+        fputc('\n', keptFILE); /*Last read in the file*/
+
+    /*>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>\
+    ^ Fun-11 Sec-3: Copy every other read to a temporary fastq
+    \<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<*/
+
+    snprintf(tmpPathCStr, 1024, "%s.tmp", fqPathCStr);
+    tmpFILE = fopen(tmpPathCStr, "w");
+
+    if(tmpFILE == 0)
+    { /*If could not make the temporary fastq*/
+        errUC = 4;
+        goto cleanUp_fun11_sec4;
+    } /*If could not make the temporary fastq*/
+
+    if(lenBuffUL < (1 << 16))
+    { /*If the buffer is to small for a fast copy*/
+        free(buffCStr);
+        lenBuffUL = 1 << 16;
+        buffCStr = malloc(lenBuffUL);
+
+        if(buffCStr == 0)
+        { /*If had a memory error*/
+            errUC = 64;
+            goto cleanUp_fun11_sec4;
+        } /*If had a memory error*/
+    } /*If the buffer is to small for a fast copy*/
+
+    /*Copy everything before and after the read (no parsing needed)*/
+    for(
+        uint64_t posUL = 0;
+        posUL < idxST->fileSizeUL;
+        posUL += lenInSL
+    ){ /*Loop till have copied the file*/
+        if(posUL == offsetUL) posUL = endUL;
+        if(posUL >= idxST->fileSizeUL) break;
+
+        lenInSL = lenBuffUL;
+
+        if(posUL < offsetUL && posUL + lenInSL > offsetUL)
+            lenInSL = offsetUL - posUL;
+
+        lenInSL = pread(fqFd, buffCStr, lenInSL, posUL);
+
+        if(lenInSL < 0 && errno == EINTR)
+        { /*If was interrupted*/
+            lenInSL = 0;
+            continue;
+        } /*If was interrupted*/
+
+        if(lenInSL <= 0)
+        { /*If could not read the fastq*/
+            errUC = 4;
+            goto cleanUp_fun11_sec4;
+        } /*If could not read the fastq*/
+
+        if(fwrite(buffCStr, 1, lenInSL, tmpFILE) != (size_t) lenInSL)
+        { /*If could not write the temporary fastq*/
+            errUC = 4;
+            goto cleanUp_fun11_sec4;
+        } /*If could not write the temporary fastq*/
+    } /*Loop till have copied the file*/
+
+    /*>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>\
+    ^ Fun-11 Sec-4: Replace the fastq and update the index
+    \<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<*/
+
+    if(fclose(tmpFILE) != 0 || rename(tmpPathCStr, fqPathCStr) != 0)
+    { /*If could not replace the fastq file*/
+        tmpFILE = 0;
+        errUC = 4;
+        goto cleanUp_fun11_sec4;
+    } /*If could not replace the fastq file*/
+
+    tmpFILE = 0;
+
+    /*Shifting the entries is cheaper than a rescan of the fastq*/
+    rmFqIndexEntry(idxST, entryUL);
+    writeFqIndex(idxST, fqPathCStr);
+
+    cleanUp_fun11_sec4:
+
+    if(tmpFILE != 0)
+    { /*If had an error while copying*/
+        fclose(tmpFILE);
+        remove(tmpPathCStr);
+    } /*If had an error while copying*/
+
+    if(fqFd >= 0) close(fqFd);
+    if(buffCStr != 0) free(buffCStr);
+    if(idBigNum != 0) freeBigNumStruct(&idBigNum);
+    if(scratchBigNum != 0) freeBigNumStruct(&scratchBigNum);
+    freeFqIndex(&idxST);
+
+    return errUC;
+} /*fqIndexMvRead*/
+
+/*---------------------------------------------------------------------\
+| Output:
+|   - Modifies:
+|     o keyAryUL to have the 128 bit key for idBigNum
+| Note:
+|   - UUIDs (nanopore) are 32 hex characters, so the key is close to
+|     the id itself. Other ids are hashed, so fqIndexEntryIsId is used
+|     to throw out different ids with the same key.
+\---------------------------------------------------------------------*/
+static void bigNumToFqIdxKey(
+    struct bigNum *idBigNum, /*Read id to make a key for*/
+    uint64_t *keyAryUL       /*Will hold the two halves of the key*/
+) /*Makes the 128 bit key for a read id*/
+{ /*bigNumToFqIdxKey*/
+
+    /*~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~\
+    ' Fun-12 TOC: Sec-1 Sub-1: bigNumToFqIdxKey
+    \~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~*/
+
+    uint64_t limbUL = 0;
+
+    keyAryUL[0] = 0x9E3779B97F4A7C15ULL ^ idBigNum->lenUsedElmChar;
+    keyAryUL[1] = 0xC2B2AE3D27D4EB4FULL + idBigNum->lenUsedElmChar;
+
+    for(unsigned char iLimb=0; iLimb < idBigNum->lenUsedElmChar; ++iLimb)
+    { /*Loop through all limbs in the big number*/
+        limbUL = (uint64_t) idBigNum->bigNumAryIOrL[iLimb];
+
+        /*Two different mixes, so the halves are independent*/
+        keyAryUL[0] = (keyAryUL[0] ^ limbUL) * 0x100000001B3ULL;
+        keyAryUL[0] ^= keyAryUL[0] >> 29;
+
+        keyAryUL[1] = (keyAryUL[1] + limbUL) * 0xFF51AFD7ED558CCDULL;
+        keyAryUL[1] ^= keyAryUL[1] >> 32;
+    } /*Loop through all limbs in the big number*/
+
+    /*Finish with murmur3's fmix64, so every bit is mixed*/
+    for(unsigned char iKey = 0; iKey < 2; ++iKey)
+    { /*Loop through both halves of the key*/
+        keyAryUL[iKey] ^= keyAryUL[iKey] >> 33;
+        keyAryUL[iKey] *= 0xFF51AFD7ED558CCDULL;
+        keyAryUL[iKey] ^= keyAryUL[iKey] >> 33;
+        keyAryUL[iKey] *= 0xC4CEB9FE1A85EC53ULL;
+        keyAryUL[iKey] ^= keyAryUL[iKey] >> 33;
+    } /*Loop through both halves of the key*/
+} /*bigNumToFqIdxKey*/
+
+/*---------------------------------------------------------------------\
+| Output:
+|   - Modifies:
+|     o fileSizeUL, inodeUL, mtimeSecSL, and mtimeNsecSL in idxST
+|   - Returns:
+|     o 1 if could stat pathCStr
+|     o 4 if could not stat pathCStr
+\---------------------------------------------------------------------*/
+static uint8_t fqIdxStamp(
+    char *pathCStr,       /*File to stamp*/
+    struct fqIndex *idxST /*Will hold the stamp*/
+) /*Copies the size, inode, and modification time of a file*/
+{ /*fqIdxStamp*/
+
+    /*~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~\
+    ' Fun-13 TOC: Sec-1 Sub-1: fqIdxStamp
+    \~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~*/
+
+    struct stat fileStat;
+
+    if(stat(pathCStr, &fileStat) != 0) return 4;
+
+    idxST->fileSizeUL = fileStat.st_size;
+    idxST->inodeUL = fileStat.st_ino;
+    idxST->mtimeSecSL = fileStat.st_mtim.tv_sec;
+    idxST->mtimeNsecSL = fileStat.st_mtim.tv_nsec;
+
+    return 1;
+} /*fqIdxStamp*/
+
+/*---------------------------------------------------------------------\
+| Output:
+|   - Returns:
+|     o < 0 if oneEntry has the smaller key
+|     o 0 if the keys are the same
+|     o > 0 if oneEntry has the bigger key
+\---------------------------------------------------------------------*/
+static int cmpFqIdxEntries(
+    const void *oneEntry,
+    const void *twoEntry
+) /*qsort compare for entries (by key)*/
+{ /*cmpFqIdxEntries*/
+    const struct fqIdxEntry *oneST = oneEntry;
+    const struct fqIdxEntry *twoST = twoEntry;
+
+    if(oneST->keyAryUL[0] != twoST->keyAryUL[0])
+        return oneST->keyAryUL[0] < twoST->keyAryUL[0] ? -1 : 1;
+
+    if(oneST->keyAryUL[1] != twoST->keyAryUL[1])
+        return oneST->keyAryUL[1] < twoST->keyAryUL[1] ? -1 : 1;
+
+    /*Same key (or duplicate read), keep file order*/
+    return (oneST->offsetUL > twoST->offsetUL) -
+           (oneST->offsetUL < twoST->offsetUL);
+} /*cmpFqIdxEntries*/
+
+/*---------------------------------------------------------------------\
+| Output:
+|   - Returns:
+|     o < 0 if oneHit is sooner in the fastq file
+|     o 0 if both hits are the same read
+|     o > 0 if oneHit is later in the fastq file
+\---------------------------------------------------------------------*/
+static int cmpFqIdxHits(
+    const void *oneHit,
+    const void *twoHit
+) /*qsort compare for found reads (by position in file)*/
+{ /*cmpFqIdxHits*/
+    const struct fqIdxHit *oneST = oneHit;
+    const struct fqIdxHit *twoST = twoHit;
+
+    return (oneST->entryST->offsetUL > twoST->entryST->offsetUL) -
+           (oneST->entryST->offsetUL < twoST->entryST->offsetUL);
+} /*cmpFqIdxHits*/
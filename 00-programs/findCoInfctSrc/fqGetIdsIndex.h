@@ -0,0 +1,209 @@
+/*######################################################################
+# Name: fqGetIdsIndex
+# Use:
+#    Sorted read id index (sidecar file) for a fastq file. The index
+#    has a 128 bit key for each read id and where the read is in the
+#    fastq file, so reads can be extracted with a binary search and a
+#    pread, instead of scanning the whole fastq file.
+#    The sidecar is fastq + defFqIdxExt and is rebuilt when the fastq
+#    file size, inode, or modification time changes.
+# Includes:
+#    - "fqGetIdsFqFun.h"
+#      o "fqGetIdsStructs.h"
+#        - <stdlib.h>
+#        - <stdio.h>
+#        - <stdint.h>
+######################################################################*/
+
+#ifndef FQGETIDSINDEX_H
+#define FQGETIDSINDEX_H
+
+#include "fqGetIdsFqFun.h"
+
+#define defFqIdxExt ".idx"         /*Ending added to the fastq name*/
+#define defFqIdxMagic "fqIdx01"    /*Marks an index file (8 bytes)*/
+
+/*---------------------------------------------------------------------\
+| Struct-1: fqIdxEntry
+|   o Key of a read id and where the read is in the fastq file
+\---------------------------------------------------------------------*/
+typedef struct fqIdxEntry
+{ /*fqIdxEntry*/
+    uint64_t keyAryUL[2]; /*128 bit key made from the read ids bigNum*/
+    uint64_t offsetUL;    /*Start of the read (the '@') in the fastq*/
+    uint64_t lenUL;       /*Number of bytes in the fastq entry*/
+}fqIdxEntry;
+
+/*---------------------------------------------------------------------\
+| Struct-2: fqIndex
+|   o Fastq file stamp (to detect changes) and the entries sorted by
+|     key. The first members are the header of the index file.
+\---------------------------------------------------------------------*/
+typedef struct fqIndex
+{ /*fqIndex*/
+    char magicAryC[8];        /*defFqIdxMagic*/
+    uint64_t fileSizeUL;      /*Size of the fastq file*/
+    uint64_t inodeUL;         /*Inode of the fastq file*/
+    int64_t mtimeSecSL;       /*Modification time (seconds)*/
+    int64_t mtimeNsecSL;      /*Modification time (nano seconds)*/
+    uint64_t numEntriesUL;    /*Number of reads in the index*/
+    uint32_t limbBytesUI;     /*Bytes per bigNum limb (MEM changes)*/
+    uint32_t padUI;
+
+    struct fqIdxEntry *entryAry; /*Entries sorted by key*/
+}fqIndex;
+
+/*---------------------------------------------------------------------\
+| Output:
+|   - Returns:
+|     o fqIndex with all reads in the fastq file
+|     o 0 if the file is not an uncompressed fastq or had a memory
+|       error
+\---------------------------------------------------------------------*/
+struct fqIndex * makeFqIndex(
+    char *fqPathCStr /*Fastq file to index*/
+); /*Builds a sorted read id index for a fastq file*/
+
+/*---------------------------------------------------------------------\
+| Output:
+|   - Creates:
+|     o fqPathCStr + defFqIdxExt with the index
+|   - Modifies:
+|     o Stamp in idxST to be the stamp of the current fastq file
+|   - Returns:
+|     o 1 if wrote the index
+|     o 4 if could not stat the fastq file
+|     o 8 if could not write the index file
+\---------------------------------------------------------------------*/
+uint8_t writeFqIndex(
+    struct fqIndex *idxST, /*Index to save*/
+    char *fqPathCStr       /*Fastq file the index is for*/
+); /*Saves a fastq index to its sidecar file*/
+
+/*---------------------------------------------------------------------\
+| Output:
+|   - Returns:
+|     o fqIndex from fqPathCStr + defFqIdxExt
+|     o 0 if there is no index, the index is out of date, or had a
+|       memory error
+\---------------------------------------------------------------------*/
+struct fqIndex * readFqIndex(
+    char *fqPathCStr /*Fastq file to get the index for*/
+); /*Reads in a fastq index if it is up to date*/
+
+/*---------------------------------------------------------------------\
+| Output:
+|   - Returns:
+|     o fqIndex for fqPathCStr (reads or builds & saves the index)
+|     o 0 if could not make an index
+\---------------------------------------------------------------------*/
+struct fqIndex * getFqIndex(
+    char *fqPathCStr /*Fastq file to get the index for*/
+); /*Gets an up to date index for a fastq file*/
+
+/*---------------------------------------------------------------------\
+| Output:
+|   - Returns:
+|     o First entry in idxST with the same key as idBigNum
+|     o idxST->numEntriesUL if no entry has the key
+\---------------------------------------------------------------------*/
+unsigned long findFqIndexKey(
+    struct fqIndex *idxST,  /*Index to search*/
+    struct bigNum *idBigNum /*Read id to find*/
+); /*Binary search for the first entry with a read ids key*/
+
+/*---------------------------------------------------------------------\
+| Output:
+|   - Modifies:
+|     o buffCStr to have the fastq entry (resized if to small)
+|     o lenBuffUL to be the new size of buffCStr
+|   - Returns:
+|     o 1 if read in the entry
+|     o 4 if could not read the entry from fqFd
+|     o 64 for memory errors
+\---------------------------------------------------------------------*/
+uint8_t preadFqIndexEntry(
+    struct fqIndex *idxST,   /*Index with the entry*/
+    unsigned long entryUL,   /*Entry to read in*/
+    int fqFd,                /*Open fastq file the index is for*/
+    char **buffCStr,         /*Buffer to hold the entry*/
+    unsigned long *lenBuffUL /*Size of buffCStr*/
+); /*Reads one fastq entry in with pread*/
+
+/*---------------------------------------------------------------------\
+| Output:
+|   - Returns:
+|     o 1 if the fastq entry in entryCStr has idBigNum as its read id
+|     o 0 if the read ids are different
+|   - Modifies:
+|     o scratchBigNum to have the entries read id
+\---------------------------------------------------------------------*/
+uint8_t fqIndexEntryIsId(
+    char *entryCStr,            /*Fastq entry from preadFqIndexEntry*/
+    unsigned long lenEntryUL,   /*Length of entryCStr*/
+    struct bigNum *idBigNum,    /*Read id looking for*/
+    struct bigNum *scratchBigNum/*Holds entries id (has limbs)*/
+); /*Checks that a key match (index) is the read id looking for*/
+
+/*---------------------------------------------------------------------\
+| Output:
+|   - Prints:
+|     o The reads in readList to outFILE in the order they are in the
+|       fastq file
+|   - Modifies:
+|     o numPrintedUL to be the number of reads printed
+|   - Returns:
+|     o 1 if no errors
+|     o 4 if could not read the fastq file
+|     o 64 for memory errors
+\---------------------------------------------------------------------*/
+uint8_t fqIndexExtract(
+    struct fqIndex *idxST,      /*Index of the fastq file*/
+    char *fqPathCStr,           /*Fastq file to extract reads from*/
+    struct readInfo *readList,  /*Reads to extract (rightChild list)*/
+    FILE *outFILE,              /*File to print reads to*/
+    unsigned long *numPrintedUL /*Number of reads printed*/
+); /*Extracts a list of reads from a fastq with its index*/
+
+/*---------------------------------------------------------------------\
+| Output:
+|   - Modifies:
+|     o idxST to not have entryUL and the reads after entryUL to start
+|       entryUL's length sooner (the fastq without the entry)
+\---------------------------------------------------------------------*/
+void rmFqIndexEntry(
+    struct fqIndex *idxST, /*Index to remove an entry from*/
+    unsigned long entryUL  /*Entry to remove*/
+); /*Removes a read from an index (read was removed from the fastq)*/
+
+/*---------------------------------------------------------------------\
+| Output:
+|   - Frees:
+|     o idxST and sets it to 0
+\---------------------------------------------------------------------*/
+void freeFqIndex(
+    struct fqIndex **idxST /*Index to free*/
+); /*Frees a fqIndex struct*/
+
+/*---------------------------------------------------------------------\
+| Output:
+|   - Prints:
+|     o The fastq entry with idCStr to keptFILE
+|   - Modifies:
+|     o fqPathCStr to not have the read (rewritten with a tmp file)
+|     o The index of fqPathCStr to not have the read (is not rebuilt)
+|   - Returns:
+|     o 1 if moved the read
+|     o 2 if could not index fqPathCStr or the read is not in it
+|     o 4 if could not read fqPathCStr or write the new fastq
+|     o 64 for memory errors
+|   - Note:
+|     o fqPathCStr is not changed unless 1 is returned
+\---------------------------------------------------------------------*/
+uint8_t fqIndexMvRead(
+    char *idCStr,     /*Read id to move ('@' at start is ignored)*/
+    char *fqPathCStr, /*Fastq file to move the read out of*/
+    FILE *keptFILE    /*File to print the read to*/
+); /*Moves one read out of an indexed fastq file*/
+
+#endif
@@ -67,8 +67,14 @@ uint8_t fastqExtract(
     struct readInfo *readTree = 0;
     struct readInfo **hashTbl = 0;
 
+    /*Holds the readInfo/bigNum nodes for the hash table or tree,
+    ` so the nodes are freed as a few blocks at the end instead
+    ` of walking every tree*/
+    struct memArena *arenaST = 0;
+
     FILE *filtFILE = 0;          /*to file with ID's to search for*/
     FILE *fqFILE = 0; /*fastq file to search*/
+    uint8_t pipeBl = 0; /*1: fastq file is gzip compressed*/
     FILE *outFILE = 0;           /*File to write extracted reads to*/
 
     /*>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>\
@@ -86,10 +92,8 @@ uint8_t fastqExtract(
     if(filtFILE == 0)
         return 2;      /*No input file with read ids*/
 
-    if(fqPathCStr == 0)
-        fqFILE = stdin;
-    else
-        fqFILE = fopen(fqPathCStr, "r");
+    /*stdin if fqPathCStr is 0, gzip files are uncompressed*/
+    fqFILE = openFastqFile(fqPathCStr, &pipeBl);
 
     if(fqFILE == 0)
     { /*If could not open the fastq file*/
@@ -105,7 +109,7 @@ uint8_t fastqExtract(
     if(outFILE == 0)
     { /*if I could not open the output file*/
         fclose(filtFILE);
-        fclose(fqFILE);
+        closeFastqFile(fqFILE, pipeBl);
     } /*if I could not open the output file*/
 
     /*>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>\
@@ -116,6 +120,10 @@ uint8_t fastqExtract(
     readStack[0].readNode = 0;
     readStack[sizeReadStackUChar + 1].readNode = 0;
 
+    /*If the arena can not be made (memory) arenaST is 0 and
+    ` each node is malloced*/
+    arenaST = makeMemArena();
+
     if(hashSearchChar == 0)
     { /*If just using the avl tree for searching*/
         readTree =
@@ -123,7 +131,8 @@ uint8_t fastqExtract(
                 filtFILE,    /*File with target read ids*/
                 readStack,   /*Stack for searching trees*/
                 buffCStr,  /*Buffer to hold one line from file*/
-                lenBuffUI /*Size of buffer*/
+                lenBuffUI, /*Size of buffer*/
+                arenaST    /*Arena for the nodes*/
         ); /*Build the tree of reads to search*/
     } /*If just using the avl tree for searching*/
 
@@ -138,14 +147,18 @@ uint8_t fastqExtract(
                 &hashSizeULng,  /*Will hold Size of hash table*/
                 &digPerKeyUChar, /*Number digitis used per key in hash*/
                 &majicNumULng,   /*Will hold the majic number*/
-                &hashFailedBool /*Holds if manged to make hash table*/
+                &hashFailedBool, /*Holds if manged to make hash table*/
+                arenaST          /*Arena for the nodes*/
         ); /*Build the hash table*/
     } /*Else I am searching using a hash function*/
 
     fclose(filtFILE); /*No longer need open*/
 
-    if(readTree == 0 && hashFailedBool == 1) /*Calloc errored out*/
+    if(readTree == 0 && hashFailedBool == 1)
+    { /*If calloc errored out*/
+        freeMemArena(&arenaST);
         return 0;
+    } /*If calloc errored out*/
 
     /*>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>
     # Fun-1 Sec-3: Call the tree or hash table function to search the file
@@ -161,18 +174,24 @@ uint8_t fastqExtract(
             digPerKeyUChar,    /*Digits needed to get a key*/
             &printReverseChar,
             readTree,          /*AVL tree to search if hashTbl == 0*/
-            hashTbl            /*hash table to search*/
+            hashTbl,           /*hash table to search*/
+            0                  /*No cuckoo prefilter*/
     );
 
     /*>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>
     # Fun-1 Sec-4: Handle errors, clean up, & exit
     <<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<*/
 
-    fclose(fqFILE); /*No longer need open*/
+    closeFastqFile(fqFILE, pipeBl); /*No longer need open*/
     fclose(outFILE); /*No longer need open*/
 
     /*Check if freeing tree or hash table with tree*/
-    if(hashSearchChar == 0)
+    if(arenaST != 0)
+    { /*If the nodes are in the arena*/
+        free(hashTbl); /*Tree nodes are freed with the arena*/
+        freeMemArena(&arenaST);
+    } /*If the nodes are in the arena*/
+    else if(hashSearchChar == 0)
         freeReadTree(&readTree, readStack);
     else
     { /*If used hashing, free the hashing variables*/
@@ -189,12 +208,14 @@ uint8_t fastqExtract(
 # Output:
 #    Returns: balanced readInfo tree with all read id's in filtFILE
 #    Returns: 0 if calloc errored out
+#    Note: If arenaST is not 0, the tree is freed with freeMemArena
 ##############################################################################*/
 struct readInfo * buildAvlTree(
     FILE *filtFILE,                 /*File with read ids to keep or ignore*/
     struct readNodeStack *readStack,  /*Stack to use in building AVL tree*/
     char *buffCStr,        /*Buffer to hold one line from file*/
-    uint32_t lenBuffUI         /*Size of buffer to read each line*/
+    uint32_t lenBuffUI,        /*Size of buffer to read each line*/
+    struct memArena *arenaST   /*Arena for the nodes (0: malloc)*/
 ) /*Builds a readInfo tree with read id's in filtFILE*/
 { /*buildAvlTree function*/
 
@@ -233,14 +254,15 @@ struct readInfo * buildAvlTree(
                &tmpIdCStr,
                &lenInputULng,
                &maxHexChar,
-               filtFILE
+               filtFILE,
+               arenaST
        ); /*Read in id and convert to big number*/
 
        if(lastRead == 0)
        { /*If was a falied read*/
            if(lenInputULng == 0)
            { /*If was a memory allocation error (message already printed)*/
-               freeReadTree(&readTree, readStack);
+               if(arenaST == 0) freeReadTree(&readTree, readStack);
                return 0;
            } /*If was a memory allocation error (message already printed)*/
 
@@ -249,7 +271,8 @@ struct readInfo * buildAvlTree(
 
        if(insertNodeIntoReadTree(lastRead, &readTree, readStack) == 0)
        { /*If id is in tree, need to free*/
-           freeReadInfoStruct(&lastRead); /*If id already in tree*/
+           /*Arena nodes are freed with the arena*/
+           if(arenaST == 0) freeReadInfoStruct(&lastRead);
            lastRead = readTree;           /*Prevent loop ending early*/
        } /*If id is in tree, need to free*/
 
@@ -292,7 +315,8 @@ uint8_t extractReads(
     uint8_t digPerKeyUChar,     /*Digits needed to get a key*/
     uint8_t *printNonMatchBool, /*1: print non-match, 0: print match*/
     struct readInfo *readTree,  /*For AVL search (hashTbl == 0)*/
-    struct readInfo **hashTbl   /*Hash table to search for ids in*/
+    struct readInfo **hashTbl,  /*Hash table to search for ids in*/
+    struct cuckooFilt *cuckooFilt /*Checked first if not 0*/
 ) /*Extract target reads from fastq file with hash table or tree*/
 { /*extractReadsInHash*/
 
@@ -311,7 +335,7 @@ uint8_t extractReads(
 
     char
        *readPosCStr = 0,        /*Position in buffCStr*/
-       dummyConvertUChar = '0',  /*blanck number to initalize bignum*/
+       dummyConvertCStr[] = "0", /*blanck number to initalize bignum*/
        *startReadCStr = 0;      /*Start of read id for a fastq entry*/
 
     int32_t
@@ -340,7 +364,7 @@ uint8_t extractReads(
 
     /*Intalize the bigNum struct*/
     lenIdInt = 256;
-    idBigNum = makeBigNumStruct(&dummyConvertUChar, &lenIdInt);
+    idBigNum = makeBigNumStruct(dummyConvertCStr, &lenIdInt);
 
     if(idBigNum == 0)
     { /*If could not allocatem memory*/
@@ -380,7 +404,11 @@ uint8_t extractReads(
         # Fun-3 Sec-3 Sub-2: Determine if read is in tree
         ***********************************************************************/
 
-        if(hashTbl == 0)
+        if(
+               cuckooFilt != 0
+            && findIdInCuckooFilt(idBigNum, cuckooFilt) == 0
+        ) lastRead = 0; /*Not in filter, skip hash table/tree*/
+        else if(hashTbl == 0)
             lastRead = searchTree(idBigNum, readTree); /*Use avl tree*/
         else 
         { /*Else doing a hash table*/
@@ -12,6 +12,7 @@
 
 #include "fqGetIdsFqFun.h" /*includes fqGetIdsStructs.h*/
 #include "fqGetIdsHash.h"
+#include "fqGetIdsCuckoo.h"   /*Prefilter for hash/tree search*/
     /*Includes:
           - fqGetIdsAVLTree.h:
               - <string.h>
@@ -41,12 +42,14 @@ uint8_t fastqExtract(
 # Output:
 #    Returns: balanced readInfo tree with all read id's in filterFile
 #    Returns: 0 if malloc errored out
+#    Note: If arenaST is not 0, the tree is freed with freeMemArena
 ##############################################################################*/
 struct readInfo * buildAvlTree(
     FILE *filterFile,                 /*File with read ids to keep or ignore*/
     struct readNodeStack *readStack,  /*Stack to use in building AVL tree*/
     char *lineInCStr,        /*Buffer to hold one line from file*/
-    uint32_t buffSizeUInt         /*Size of buffer to read each line*/
+    uint32_t buffSizeUInt,        /*Size of buffer to read each line*/
+    struct memArena *arenaST      /*Arena for the nodes (0: malloc)*/
 ); /*Builds a readInfo tree with read id's in filterFile*/
 
 /*##############################################################################
@@ -63,7 +66,8 @@ uint8_t extractReads(
     uint8_t digPerKeyUChar,     /*Digits needed to get a key*/
     uint8_t *printNonMatchBool, /*1: print non-match, 0: print match*/
     struct readInfo *readTree,  /*For AVL search (hashTbl == 0)*/
-    struct readInfo **hashTbl   /*Hash table to search for ids in*/
+    struct readInfo **hashTbl,  /*Hash table to search for ids in*/
+    struct cuckooFilt *cuckooFilt /*Checked first if not 0*/
 ); /*Extract target reads from fastq file with hash table or tree*/
 
 #endif
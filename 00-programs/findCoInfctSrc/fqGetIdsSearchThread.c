@@ -8,11 +8,72 @@
 '     o Get length of file (set up to be called by a separate thread)
 '   - fun-4 findStartPos:
 '     o Find starting position of a thread in a read id extraction
+'   - fun-5 writeChunkRings:
+'     o Prints the chunks of reads the threads extracted
+'   - fun-6 pushOutChunk:
+'     o Adds a chunk to a threads ring (waits if the ring is full)
+'   - fun-7 popOutChunk:
+'     o Prints and frees the oldest chunk in a ring
+'   - fun-8 extractReadsMapThread:
+'     o Extracts reads by id from a memory mapped fastq file
+'   - fun-9 mapFindStartPos:
+'     o Finds the first read in a section of a memory mapped fastq
+'   - fun-10 writeSlices:
+'     o Prints slices of a memory mapped fastq with writev
+'   - fun-11 extractReadsBgzfThread:
+'     o Extracts reads by id from the sections of a BGZF fastq file
+'   - fun-12 readBgzfPipe:
+'     o Reads more of a BGZF section from its gzip -dc pipe
 \~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~*/
 
-#include "fqGetIdsSearchThread.h"
+/*open_memstream is from POSIX 2008*/
+#ifndef _POSIX_C_SOURCE
+    #define _POSIX_C_SOURCE 200809L
+#endif
 
-pthread_mutex_t lockerMutex;
+#include "fqGetIdsSearchThread.h"
+#include <sched.h>  /*sched_yield*/
+#include <errno.h>
+#include <fcntl.h>
+#include <unistd.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+
+static void pushOutChunk(
+    struct chunkRing *ringST, /*Ring of the thread that made the chunk*/
+    char *textCStr,           /*Kept reads*/
+    size_t lenTextUL,         /*Length of textCStr*/
+    struct iovec *sliceAry,   /*Kept reads in a mapped fastq or 0*/
+    unsigned int numSlicesUI, /*Number of slices in sliceAry*/
+    uint8_t endSectionBl      /*1: Last chunk in the section*/
+); /*Adds a chunk to a threads ring (waits if the ring is full)*/
+
+static uint8_t popOutChunk(
+    struct chunkRing *ringST, /*Ring to get chunk from*/
+    uint8_t *endSectionBl,    /*Set to 1 if chunk ended a section*/
+    FILE *outFILE             /*File to print the chunk to*/
+); /*Prints and frees the oldest chunk in a ring*/
+
+static char * mapFindStartPos(
+    char *mapCStr,      /*Memory mapped fastq file*/
+    unsigned long startUL,  /*Start of the section*/
+    unsigned long lenFileUL,/*Length of the fastq file*/
+    uint8_t endFileBl   /*1: lenFileUL is the end of the file*/
+); /*Finds the first read in a section of a memory mapped fastq*/
+
+static void writeSlices(
+    int outFD,               /*File descriptor to print to*/
+    struct iovec *sliceAry,  /*Slices to print*/
+    unsigned int numSlicesUI /*Number of slices in sliceAry*/
+); /*Prints slices of a memory mapped fastq with writev*/
+
+static uint8_t readBgzfPipe(
+    FILE *pipeFILE,            /*gzip -dc pipe to read from*/
+    char **buffCStr,           /*Buffer to add to (resized if needed)*/
+    unsigned long *lenBuffUL,  /*Size of buffCStr*/
+    unsigned long *lenDataUL,  /*Number of bytes in buffCStr*/
+    unsigned long lenReadUL    /*Number of bytes to read*/
+); /*Reads more of a BGZF section from its gzip -dc pipe*/
 
 /*---------------------------------------------------------------------\
 | Output:
@@ -31,8 +92,11 @@ uint8_t fastqThreadExtract(
     uint8_t sizeReadStackUC,   /*Number of elements to use in stack*/
     uint32_t lenBuffUI,        /*Size of buffer to read input with*/
     uint8_t hashSearchC,    /*1: do hash search, 0: do Tree search*/
-    uint8_t printReverseC   /*1: Keep reads in filter file
+    uint8_t printReverseC,  /*1: Keep reads in filter file
                                  0: ingore reads in filter file*/
+    uint8_t keepOrderBl,    /*1: Print reads in input order*/
+    uint8_t mapFileBl,      /*1: Memory map the fastq file*/
+    uint8_t prefilterBl     /*1: Check a cuckoo filter first*/
 ) /*Searches and extracts reads from a fastq file using read id's*/
 { /*fastqExtract*/
 
@@ -63,13 +127,32 @@ uint8_t fastqThreadExtract(
     /*For multi-threading*/
     pthread_t threadsAry[threadsUC];
     struct getFileLenStruct fileLenCall;
-    unsigned long startUL[threadsUC + 1];/*Starting point each thread*/
     struct extReadsST extAryST[threadsUC];
+    struct chunkRing *ringAry = 0;  /*Kept reads from each thread*/
+    unsigned long lenSectionUL = defSectionBytes;
+    unsigned long numSectionsUL = 0;
+    uint8_t ringsBl = 0;  /*1: Threads print to the chunk rings*/
+    uint8_t fileLenBl = 0;/*1: Need the length of the fastq file*/
+
+    /*For memory mapping the fastq file (mapFileBl)*/
+    char *mapCStr = 0;
+    struct stat fqStat;
+
+    /*For gzip compressed fastq files*/
+    uint8_t gzipTypeUC = defNotGzip;
+    uint8_t pipeBl = 0;  /*1: fqAryFILE[0] is a gzip -dc pipe*/
+    struct bgzfSections *bgzfST = 0; /*Threads split BGZF files*/
 
     /*Stack to use for searching tree. (depth = 73 = 10^18 nodes)*/
     struct readNodeStack readStack[sizeReadStackUC + 2];
     struct readInfo *readTree = 0;
     struct readInfo **hashTbl = 0;
+    struct cuckooFilt *cuckooFilt = 0; /*Prefilter (-prefilter)*/
+
+    /*Holds the readInfo/bigNum nodes for the hash table or tree,
+    ` so the nodes are freed as a few blocks at the end instead
+    ` of walking every tree*/
+    struct memArena *arenaST = 0;
 
     FILE *filtFILE = 0;          /*to file with ID's to search for*/
     FILE *fqAryFILE[threadsUC]; /*fastq file to search*/
@@ -101,6 +184,78 @@ uint8_t fastqThreadExtract(
         return 4;      /*No input file with reads to extract*/
     } /*If could not open the fastq file*/
 
+    if(fqPathCStr == 0)
+        threadsUC = 1; /*Threads seek to their sections, stdin can not*/
+
+    else
+    { /*Else check if the fastq file is compressed*/
+        gzipTypeUC = checkGzipFile(fqAryFILE[0]);
+
+        /*Each thread uncompresses its own BGZF blocks*/
+        if(gzipTypeUC == defBgzf && threadsUC > 1)
+            bgzfST =
+                makeBgzfSections(fqAryFILE[0], defSectionBytes, threadsUC);
+
+        if(gzipTypeUC != defNotGzip && bgzfST == 0)
+        { /*If need to read from one gzip -dc pipe*/
+            fclose(fqAryFILE[0]);
+            fqAryFILE[0] = openFastqFile(fqPathCStr, &pipeBl);
+            threadsUC = 1; /*Can not seek in a pipe*/
+
+            if(fqAryFILE[0] == 0)
+            { /*If could not start gzip*/
+                fclose(filtFILE);
+                return 4;
+            } /*If could not start gzip*/
+        } /*If need to read from one gzip -dc pipe*/
+    } /*Else check if the fastq file is compressed*/
+
+    if(mapFileBl && fqPathCStr != 0 && gzipTypeUC == defNotGzip)
+    { /*If memory mapping the fastq file*/
+        /*Only regular files can be mapped (not pipes)*/
+        if(
+               fstat(fileno(fqAryFILE[0]), &fqStat) == 0
+            && S_ISREG(fqStat.st_mode)
+            && fqStat.st_size > 0
+        ){ /*If can map the fastq file*/
+            mapCStr =
+                mmap(
+                    0,
+                    fqStat.st_size,
+                    PROT_READ,
+                    MAP_PRIVATE,
+                    fileno(fqAryFILE[0]),
+                    0
+            );
+
+            if(mapCStr == MAP_FAILED)
+                mapCStr = 0;
+            else
+            { /*Else the file was mapped*/
+                /*Each thread reads its sections in order*/
+                posix_madvise(
+                    mapCStr,
+                    fqStat.st_size,
+                    POSIX_MADV_SEQUENTIAL
+                );
+                fileLenCall.lenFileUL = fqStat.st_size;
+            } /*Else the file was mapped*/
+        } /*If can map the fastq file*/
+
+        if(mapCStr == 0)
+            fprintf(
+                stderr,
+                "Could not memory map %s, reading it instead\n",
+                fqPathCStr
+            );
+    } /*Else if memory mapping the fastq file*/
+
+    /*Mapped files always use the threads, since they do not copy*/
+    ringsBl = (threadsUC > 1 || mapCStr != 0);
+
+    /*Uncompressed files are split by length (getFileLen)*/
+    fileLenBl = (threadsUC > 1 && mapCStr == 0 && bgzfST == 0);
+
     if(outPathCStr == 0) 
         outFILE = stdout;
     else
@@ -120,7 +275,7 @@ uint8_t fastqThreadExtract(
     readStack[0].readNode = 0;
     readStack[sizeReadStackUC + 1].readNode = 0;
 
-    if(threadsUC > 1)
+    if(fileLenBl)
     { /*If I am using multiple threads*/
         fileLenCall.lenFileUL = 0;
         fileLenCall.inFILE = fqAryFILE[0];
@@ -128,6 +283,10 @@ uint8_t fastqThreadExtract(
         pthread_create(&threadsAry[0], 0, getFileLen, &fileLenCall);
     } /*If I am using multiple threads*/
 
+    /*If the arena can not be made (memory) arenaST is 0 and
+    ` each node is malloced*/
+    arenaST = makeMemArena();
+
     if(hashSearchC == 0)
     { /*If just using the avl tree for searching*/
         readTree =
@@ -135,7 +294,8 @@ uint8_t fastqThreadExtract(
                 filtFILE,    /*File with target read ids*/
                 readStack,   /*Stack for searching trees*/
                 buffCStr,  /*Buffer to hold one line from file*/
-                lenBuffUI /*Size of buffer*/
+                lenBuffUI, /*Size of buffer*/
+                arenaST    /*Arena for the nodes*/
         ); /*Build the tree of reads to search*/
     } /*If just using the avl tree for searching*/
 
@@ -150,13 +310,14 @@ uint8_t fastqThreadExtract(
                 &hashSizeUL,  /*Will hold Size of hash table*/
                 &digPerKeyUC, /*Number digitis used per key in hash*/
                 &majicNumUL,   /*Will hold the majic number*/
-                &hashFailedBl /*Holds if manged to make hash table*/
+                &hashFailedBl, /*Holds if manged to make hash table*/
+                arenaST        /*Arena for the nodes*/
         ); /*Build the hash table*/
     } /*Else I am searching using a hash function*/
 
     fclose(filtFILE); /*No longer need open*/
 
-    if(threadsUC > 1)
+    if(fileLenBl)
         pthread_join(threadsAry[0], 0); /*Wait till 2nd thread finshes*/
 
     if(readTree == 0 && hashFailedBl == 1)
@@ -166,35 +327,88 @@ uint8_t fastqThreadExtract(
             "calloc failed: fastqGrepSearchFastq.c: Fun-1: 99\n"
         ); /*Warn user calloc failed*/
 
+        freeMemArena(&arenaST);
         return 0;
     } /*If calloc errored out in making the tree*/
 
+    /*The threads share the filter (read only). If it can not
+    ` be made (memory) the search is done without it.
+    */
+    if(prefilterBl)
+        cuckooFilt =
+            cuckooFiltFromHash(
+                hashTbl,
+                hashSizeUL + 1, /*makeReadHash adds one tree*/
+                readTree,
+                readStack
+        ); /*Make the filter from the read ids*/
+
     /*>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>\
     ^ Fun-1 Sec-3: Assing file sections to each thread
     \<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<*/
 
-    if(threadsUC > 1)
+    if(ringsBl)
     { /*If have more than one thread*/
-       /*Get number of bytes for each thread to handel*/
-       startUL[threadsUC] = fileLenCall.lenFileUL; /*Ending piont*/
+       /*Sections are handed out in turn (section % threadsUC), so
+       ` small files still get split between all the threads
+       */
+       if(bgzfST != 0)
+           numSectionsUL = bgzfST->numSectionsUL; /*Whole blocks*/
+
+       else
+       { /*Else split the file by length*/
+           if(fileLenCall.lenFileUL / threadsUC < lenSectionUL)
+               lenSectionUL = fileLenCall.lenFileUL / threadsUC + 1;
+
+           numSectionsUL =
+               (fileLenCall.lenFileUL + lenSectionUL - 1)/lenSectionUL;
+       } /*Else split the file by length*/
+
+       ringAry = calloc(threadsUC, sizeof(struct chunkRing));
+
+       if(ringAry == 0)
+       { /*If could not make the rings*/
+           fprintf(
+               stderr,
+               "calloc failed: fqGetIdsSearchThread.c: Fun-1\n"
+           ); /*Warn user calloc failed*/
+
+           threadsUC = 1; /*Fall back to one thread*/
+           ringsBl = 0;
+
+           if(mapCStr != 0)
+               munmap(mapCStr, fileLenCall.lenFileUL);
+           mapCStr = 0;
+
+           if(bgzfST != 0)
+           { /*If need to read from one gzip -dc pipe*/
+               freeBgzfSections(&bgzfST);
+               fclose(fqAryFILE[0]);
+               fqAryFILE[0] = openFastqFile(fqPathCStr, &pipeBl);
+
+               if(fqAryFILE[0] == 0)
+                   return 4;
+           } /*If need to read from one gzip -dc pipe*/
+       } /*If could not make the rings*/
+    } /*If have more than one thread*/
 
+    if(ringsBl)
+    { /*If have more than one thread*/
        for(unsigned char ucThread = 0; ucThread < threadsUC; ++ucThread)
        { /*Initalize the thread values*/
-           if(ucThread == 0)
-               startUL[ucThread] = 0;
-           else 
-           { /*Else if not on the first thread*/
-               if(ucThread == 1)
-                   startUL[1]= fileLenCall.lenFileUL / threadsUC;
+           if(ucThread != 0)
+           { /*If this thread needs its own file*/
+               if(mapCStr == 0 && bgzfST == 0)
+                   fqAryFILE[ucThread] = fopen(fqPathCStr, "r");
                else
-                   startUL[ucThread] +=startUL[ucThread - 1]+startUL[1];
-
-               fqAryFILE[ucThread] = fopen(fqPathCStr, "r");
-               fseek(fqAryFILE[ucThread], startUL[ucThread], SEEK_SET);
-           } /*Else if not on the first thread*/
-
-           extAryST[ucThread].startPosUL = &startUL[ucThread];
-           extAryST[ucThread].endPosUL = &startUL[ucThread + 1];
+                   fqAryFILE[ucThread] = 0; /*Reads the map or pipe*/
+           } /*If this thread needs its own file*/
+
+           extAryST[ucThread].threadUC = ucThread;
+           extAryST[ucThread].numThreadsUC = threadsUC;
+           extAryST[ucThread].lenFileUL = fileLenCall.lenFileUL;
+           extAryST[ucThread].lenSectionUL = lenSectionUL;
+           extAryST[ucThread].numSectionsUL = numSectionsUL;
            extAryST[ucThread].lenBuffUI = lenBuffUI;
            extAryST[ucThread].majicNumUL = majicNumUL;
            extAryST[ucThread].digPerKeyUC = digPerKeyUC;
@@ -202,9 +416,13 @@ uint8_t fastqThreadExtract(
 
            extAryST[ucThread].readTree = readTree;
            extAryST[ucThread].hashTbl = hashTbl;
+           extAryST[ucThread].cuckooFilt = cuckooFilt;
 
            extAryST[ucThread].fqFILE = fqAryFILE[ucThread];
-           extAryST[ucThread].outFILE = outFILE;
+           extAryST[ucThread].mapCStr = mapCStr;
+           extAryST[ucThread].fqPathCStr = fqPathCStr;
+           extAryST[ucThread].bgzfST = bgzfST;
+           extAryST[ucThread].ringST = &ringAry[ucThread];
        } /*Initalize the thread values*/
     } /*If have more than one thread*/
 
@@ -212,7 +430,7 @@ uint8_t fastqThreadExtract(
     ^ Fun-1 Sec-4: Call tree or hash table function to search fastq
     \<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<*/
 
-    if(threadsUC < 2)
+    if(! ringsBl)
     { /*If working with only one thread*/
         fastqErrUL =
             extractReads(
@@ -224,35 +442,62 @@ uint8_t fastqThreadExtract(
                 digPerKeyUC, /*Digits needed to get a key*/
                 &printReverseC,
                 readTree,       /*AVL tree to search if hashTbl == 0*/
-                hashTbl         /*hash table to search*/
+                hashTbl,        /*hash table to search*/
+                cuckooFilt      /*Prefilter (0 if not using)*/
         );
+
+        closeFastqFile(fqAryFILE[0], pipeBl);
     } /*If working with only one thread*/
 
     else
     { /*Else I am working with multiple threads*/
-        pthread_mutex_init(&lockerMutex,0); /*intiate my mutext*/
-
         for(unsigned char ucThread = 0; ucThread <threadsUC; ++ucThread)
-           pthread_create(
-               &threadsAry[ucThread],
-               0,
-               extractReadsThread,
-               &extAryST[ucThread]
-           ); /*Launch threads*/
+        { /*Loop: launch the threads*/
+           if(bgzfST != 0)
+               pthread_create(
+                   &threadsAry[ucThread],
+                   0,
+                   extractReadsBgzfThread,
+                   &extAryST[ucThread]
+               );
+
+           else
+               pthread_create(
+                   &threadsAry[ucThread],
+                   0,
+                   mapCStr != 0 ? extractReadsMapThread:extractReadsThread,
+                   &extAryST[ucThread]
+               );
+        } /*Loop: launch the threads*/
+
+        /*This thread is the only one that prints*/
+        writeChunkRings(
+            ringAry,
+            threadsUC,
+            numSectionsUL,
+            keepOrderBl,
+            outFILE
+        );
 
         /*Join all threads so have not loose threads*/
         for(unsigned char ucThread = 0; ucThread <threadsUC; ++ucThread)
             pthread_join(threadsAry[ucThread], 0);
 
-        pthread_mutex_destroy(&lockerMutex);
+        free(ringAry);
         fastqErrUL = 1;
 
+        if(mapCStr != 0)
+            munmap(mapCStr, fileLenCall.lenFileUL);
+
+        freeBgzfSections(&bgzfST);
+
         for(unsigned char ucThread=0; ucThread < threadsUC; ++ucThread)
         { /*loop to close all my opened files*/
-            fclose(fqAryFILE[ucThread]);
+            if(fqAryFILE[ucThread] != 0)
+                fclose(fqAryFILE[ucThread]);
             fqAryFILE[ucThread] = 0;
 
-            if(extAryST[ucThread].retValUC == 0)
+            if(extAryST[ucThread].retValUC != 1)
                 fastqErrUL = 0;
         } /*loop to close all my opened files*/
     } /*Else I am working with multiple threads*/
@@ -264,13 +509,20 @@ uint8_t fastqThreadExtract(
     fclose(outFILE); /*No longer need open*/
 
     /*Check if freeing tree or hash table with tree*/
-    if(hashSearchC == 0)
+    if(arenaST != 0)
+    { /*If the nodes are in the arena*/
+        free(hashTbl); /*Tree nodes are freed with the arena*/
+        freeMemArena(&arenaST);
+    } /*If the nodes are in the arena*/
+    else if(hashSearchC == 0)
         freeReadTree(&readTree, readStack);
     else
     { /*If used hashing, free the hashing variables*/
         freeHashTbl(&hashTbl, &hashSizeUL, readStack);
     } /*If used hashing, free the hashing variables*/
 
+    freeCuckooFilt(&cuckooFilt);
+
     if(fastqErrUL == 0)
         return 0;         /*Not a valid fastq file*/
 
@@ -279,7 +531,11 @@ uint8_t fastqThreadExtract(
 
 /*---------------------------------------------------------------------\
 | Output:
-|    stdout: Prints out reads in hash table
+|   - Modifies:
+|     o extReadsST->ringST to have the kept reads for each section
+|       (section % numThreadsUC == threadUC) this thread searched
+|     o extReadsST->retValUC: 1 no errors, 0 invalid fastq, 64 memory
+|       error
 \---------------------------------------------------------------------*/
 void * extractReadsThread(
     void *parmST /*extReadsST Structer with parameters*/
@@ -289,7 +545,9 @@ void * extractReadsThread(
     /*>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>
     # Fun-2 TOC:
     #    fun-2 sec-1: Variable declerations
-    #    fun-2 sec-2: Extract target reads from fastq file
+    #    fun-2 sec-2: Set up the buffer and bigNum struct
+    #    fun-2 sec-3: Extract target reads from each section
+    #    fun-2 sec-4: Clean up and let the writer know I am done
     <<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<*/
 
     /*>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>
@@ -302,7 +560,7 @@ void * extractReadsThread(
 
     char *buffCStr = malloc(sizeof(char) * extParmST->lenBuffUI + 1);
     char *readPosCStr = 0;      /*Position in buffCStr*/
-    char dummyConvertUC = '0';  /*blank number to initalize bignum*/
+    char dummyConvertCStr[] = "0"; /*blank number to initalize bignum*/
     char *startReadCStr = 0;    /*Start of read id for a fastq entry*/
 
     int32_t lenIdInt = 0;    /*Holds length of read id*/
@@ -310,215 +568,295 @@ void * extractReadsThread(
     uint64_t lenInputUL = 0;/*Holds number char fread grabbed from file*/
     uint64_t posInFileUL = 0; /*Position at in the file*/
 
+    /*Section of the file working on*/
+    unsigned long sectionUL = extParmST->threadUC;
+    unsigned long startUL = 0;
+    unsigned long endUL = 0;
+
+    /*Private chunk to print kept reads to*/
+    FILE *chunkFILE = 0;
+    char *chunkCStr = 0;
+    size_t lenChunkUL = 0;
+
     struct bigNum *idBigNum = 0;
 
     struct readInfo *lastRead = 0; /*Holds node of read id found*/
 
     /*>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>\
-    ^ Fun-2 Sec-2: Extract target reads from fastq file
-    ^    fun-2 sec-3 sub-1: Get the read name of a single fastq entry
-    ^    fun-2 sec-3 sub-2: Determine if read is in tree
-    ^    fun-2 sec-3 sub-3: Decide if should keep read
-    ^    fun-2 sec-3 sub-4: Keeping read, print out read
+    ^ Fun-2 Sec-2: Set up the buffer and bigNum struct
     \<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<*/
 
+    /*findStartPos sets these, so each thread keeps its own copy*/
+    extParmST->startPosUL = &startUL;
+    extParmST->endPosUL = &endUL;
+    extParmST->retValUC = 1;
+
     if(buffCStr == 0)
     { /*If had a memory allocation error*/
-        free(buffCStr);
         extParmST->retValUC = 64;
-        pthread_exit(0);
+        goto done_fun2_sec4;
     } /*If had a memory allocation error*/
 
-    /*Make sure the buffer is a c-string for fread*/
-    *(buffCStr + extParmST->lenBuffUI - 1) = '\0';
-    lenInputUL =
-            fread(
-                buffCStr,
-                sizeof(char),
-                extParmST->lenBuffUI,
-                extParmST->fqFILE
-    ); /*Read in the first few bytes*/
-
-    readPosCStr = buffCStr;
-
-    if(*extParmST->startPosUL != 0)
-    { /*If this is not the first thread*/
-        findStartPos(
-            &buffCStr,
-            &readPosCStr,
-            &lenInputUL,
-            extParmST
-        ); /*Find starting position of first read*/
-    } /*If this is not the first thread*/
-
-    else
-        extParmST->retValUC = 1; /*Else at the start of the file*/
-
-    if(!(extParmST->retValUC & 1))
-        return 0; /*Something when wrong*/
-
     /*Intalize the bigNum struct*/
     lenIdInt = 256;
-    idBigNum = makeBigNumStruct(&dummyConvertUC, &lenIdInt);
+    idBigNum = makeBigNumStruct(dummyConvertCStr, &lenIdInt);
 
     if(idBigNum == 0)
     { /*If could not allocatem memory*/
-        free(buffCStr);
         extParmST->retValUC = 64;
-        pthread_exit(0);
+        goto done_fun2_sec4;
     } /*If could not allocatem memory*/
 
-    while(endOfFileC != 4)
-    { /*While there are lines in the file*/
+    /*>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>\
+    ^ Fun-2 Sec-3: Extract target reads from each section
+    ^    fun-2 sec-3 sub-1: Find the first read in the section
+    ^    fun-2 sec-3 sub-2: Get the read name of a single fastq entry
+    ^    fun-2 sec-3 sub-3: Determine if read is in tree
+    ^    fun-2 sec-3 sub-4: Print kept reads to the chunk or skip read
+    ^    fun-2 sec-3 sub-5: Check if at the end of the section
+    ^    fun-2 sec-3 sub-6: Give the last chunk of the section to writer
+    \<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<*/
+
+    while(sectionUL < extParmST->numSectionsUL)
+    { /*While I have sections to search*/
 
         /**************************************************************\
-        * Fun-2 Sec-3 Sub-1: Get the read name of a single fastq entry
+        * Fun-2 Sec-3 Sub-1: Find the first read in the section
         \**************************************************************/
 
-        endOfFileC =
-            parseFastqHeader(
-                buffCStr,       /*Buffer to hold file input*/
-                &startReadCStr, /*Will hold start of read name*/
-                &readPosCStr,   /*Start of read name, wil hold end*/
-                &lenInputUL,
+        startUL = sectionUL * extParmST->lenSectionUL;
+        endUL = startUL + extParmST->lenSectionUL;
+
+        if(endUL > extParmST->lenFileUL)
+            endUL = extParmST->lenFileUL;
+
+        /*Start one byte back, so findStartPos can see if a read
+        ` starts on the first byte of the section
+        */
+        if(startUL != 0)
+            --startUL;
+
+        chunkFILE = open_memstream(&chunkCStr, &lenChunkUL);
+
+        if(chunkFILE == 0)
+        { /*If could not make the chunk*/
+            extParmST->retValUC = 64;
+            break;
+        } /*If could not make the chunk*/
+
+        fseek(extParmST->fqFILE, startUL, SEEK_SET);
+
+        lenInputUL =
+            fread(
+                buffCStr,
+                sizeof(char),
                 extParmST->lenBuffUI,
-                &lenIdInt,     /*Will hold the lenght of read id*/
-                idBigNum,
                 extParmST->fqFILE
-        ); /*Get read name from file*/
+        ); /*Read in the first few bytes*/
 
-         if(endOfFileC == 0)
-         { /*If ended to early*/
-             free(buffCStr);
-             freeBigNumStruct(&idBigNum);
-             extParmST->retValUC = 0;
-             return 0; /*If fastq file ends on a header*/
-         } /*If ended to early*/
+        *(buffCStr + lenInputUL) = '\0';
+        readPosCStr = buffCStr;
 
-         else if(endOfFileC == 4)
-             continue;            /*At end of file, return*/
+        if(startUL != 0)
+        { /*If not at the start of the file*/
+            findStartPos(
+                &buffCStr,
+                &readPosCStr,
+                &lenInputUL,
+                extParmST
+            ); /*Find starting position of first read*/
+
+            /*2: No reads start after startUL*/
+            if(extParmST->retValUC != 1 || startUL >= endUL)
+            { /*If the section has no reads*/
+                extParmST->retValUC = 1;
+                goto endSection_fun2_sec3_sub6;
+            } /*If the section has no reads*/
+        } /*If not at the start of the file*/
+
+        while(1)
+        { /*While there are reads in the section*/
+
+            /**********************************************************\
+            * Fun-2 Sec-3 Sub-2: Get the read name of a single entry
+            \**********************************************************/
+
+            endOfFileC =
+                parseFastqHeader(
+                    buffCStr,       /*Buffer to hold file input*/
+                    &startReadCStr, /*Will hold start of read name*/
+                    &readPosCStr,   /*Start of read name, wil hold end*/
+                    &lenInputUL,
+                    extParmST->lenBuffUI,
+                    &lenIdInt,     /*Will hold the lenght of read id*/
+                    idBigNum,
+                    extParmST->fqFILE
+            ); /*Get read name from file*/
+
+            if(endOfFileC == 0)
+            { /*If ended to early*/
+                extParmST->retValUC = 0;
+                break; /*If fastq file ends on a header*/
+            } /*If ended to early*/
+
+            else if(endOfFileC == 4)
+                break;            /*At end of file*/
+
+            /**********************************************************\
+            * Fun-2 Sec-3 Sub-3: Determine if read is in tree
+            \**********************************************************/
+
+            /*Check if using hash table or AVL tree*/
+            if(
+                   extParmST->cuckooFilt != 0
+                && findIdInCuckooFilt(idBigNum,extParmST->cuckooFilt)==0
+            ) lastRead = 0; /*Not in filter, skip hash table/tree*/
+            else if(extParmST->hashTbl == 0)
+                lastRead = searchTree(idBigNum, extParmST->readTree);
+            else
+            { /*Else doing a hash table*/
+                lastRead =
+                    findReadInHashTbl(
+                        idBigNum,
+                        &(extParmST->majicNumUL),
+                        &(extParmST->digPerKeyUC),
+                        extParmST->hashTbl
+                );  /*See if read id is in the hash table*/
+            } /*Else doing a hash table*/
+
+            /**********************************************************\
+            * Fun-2 Sec-3 Sub-4: Print kept reads to chunk or skip read
+            \**********************************************************/
+
+            /*Check if should print read (!! converts address to 1)
+              read is match, priting matches only = 1 ^ 0 = 1
+              read is match, priting non-matches only = 1 ^ 1 = 0
+              read is not match, priting matches only = 0 ^ 0 = 0
+              read is not match, priting non-matches only = 0 ^ 1 = 1
+            */
+            if(((!!lastRead) ^ extParmST->printNonMatchBl) == 0)
+            { /*If is a read I am not printing out*/
+                 endOfFileC =
+                     moveToNextFastqEntry(
+                         buffCStr,
+                         &readPosCStr,/*Start of read name, wil hold end*/
+                         extParmST->lenBuffUI,
+                         &lenInputUL,/*How many characters fread got*/
+                         extParmST->fqFILE
+                 ); /*Move to next fastq entry*/
+            } /*If is a read I am not printing out*/
+
+            else
+            { /*Else I am keeping the read*/
+                /*The chunk is private, so no lock is needed*/
+                endOfFileC =
+                    printFastqEntry(
+                        buffCStr,
+                        &readPosCStr,   /*Start of read name, wil hold end*/
+                        &startReadCStr, /*points to start of read name*/
+                        extParmST->lenBuffUI,
+                        &lenInputUL,
+                        chunkFILE,
+                        extParmST->fqFILE
+                ); /*Print read & move to next read*/
+
+                if(ftell(chunkFILE) >= defOutChunkBytes)
+                { /*If the chunk is full, give it to the writer*/
+                    fclose(chunkFILE);
+                    pushOutChunk(
+                        extParmST->ringST,
+                        chunkCStr,
+                        lenChunkUL,
+                        0,
+                        0,
+                        0
+                    );
+
+                    chunkFILE = open_memstream(&chunkCStr, &lenChunkUL);
+
+                    if(chunkFILE == 0)
+                    { /*If could not make the chunk*/
+                        extParmST->retValUC = 64;
+                        goto done_fun2_sec4;
+                    } /*If could not make the chunk*/
+                } /*If the chunk is full, give it to the writer*/
+            } /*Else I am keeping the read*/
+
+            if(endOfFileC == 0)
+            { /*If ended to early*/
+                extParmST->retValUC = 0;
+                break;
+            } /*If ended to early*/
+
+            else if(endOfFileC == 4)
+                break;            /*At end of file*/
+
+            /**********************************************************\
+            * Fun-2 Sec-3 Sub-5: Check if at the end of the section
+            \**********************************************************/
+
+            /*The next read starts at readPosCStr (moveToNextFastqEntry)
+            ` or one past it (printFastqEntry ends on the new line).
+            ` The start of the buffer is ftell() - lenInputUL.
+            */
+            posInFileUL =
+                  ftell(extParmST->fqFILE)
+                - lenInputUL
+                + (readPosCStr - buffCStr)
+                + (*readPosCStr == '\n');
+
+            /*Reads starting in the next section are for the next
+            ` thread (findStartPos finds the same read)
+            */
+            if(posInFileUL >= endUL)
+                break;
+        } /*While there are reads in the section*/
 
         /**************************************************************\
-        * Fun-2 Sec-3 Sub-2: Determine if read is in tree
+        * Fun-2 Sec-3 Sub-6: Give the last chunk of the section to writer
         \**************************************************************/
 
-        /*Check if using hash table or AVL tree*/
-        if(extParmST->hashTbl == 0)
-            lastRead = searchTree(idBigNum, extParmST->readTree);
-        else 
-        { /*Else doing a hash table*/
-            lastRead = 
-                findReadInHashTbl(
-                    idBigNum,
-                    &(extParmST->majicNumUL),
-                    &(extParmST->digPerKeyUC),
-                    extParmST->hashTbl
-            );  /*See if read id is in the hash table*/
-        } /*Else doing a hash table*/
+        endSection_fun2_sec3_sub6:
 
-        /**************************************************************\
-        * Fun-2 Sec-3 Sub-3: Decide if should keep read
-        \**************************************************************/
+        fclose(chunkFILE);
+        chunkFILE = 0;
 
-        /*Check if should print read (!! converts address to 1)
-          read is match, priting matches only = 1 ^ 0 = 1
-          read is match, priting non-matches only = 1 ^ 1 = 0
-          read is not match, priting matches only = 0 ^ 0 = 0
-          read is not match, priting non-matches only = 0 ^ 1 = 1
-        */
-        if(((!!lastRead) ^ extParmST->printNonMatchBl) == 0)
-        { /*If is a read I am not printing out*/
-             endOfFileC =
-                 moveToNextFastqEntry(
-                     buffCStr,
-                     &readPosCStr, /*Start of read name, wil hold end*/
-                     extParmST->lenBuffUI,
-                     &lenInputUL,/*Holds how many characters fread got*/
-                     extParmST->fqFILE
-             ); /*Move to next fastq entry*/
-
-             if(endOfFileC == 0)
-             { /*If ended to early*/
-                 free(buffCStr);
-                 freeBigNumStruct(&idBigNum);
-                 extParmST->retValUC = 0;
-                 pthread_exit(0);
-             } /*If ended to early*/
-
-             if(ftell(extParmST->fqFILE) >= *extParmST->endPosUL)
-             { /*If on the last buffer read in*/
-                 /*Find the positoin in the file*/
-                 posInFileUL =
-                     1 +                        /*Account for \n or @*/
-                     ftell(extParmST->fqFILE) - /*piont in file*/
-                     lenInputUL -          /*Number of bytes in buffer*/
-                     (readPosCStr - buffCStr);  /*byte of position on*/
-
-
-                 if(posInFileUL >= *extParmST->endPosUL)
-                 { /*If finshed all entries assigned to this thread*/
-                     free(buffCStr);
-                     freeBigNumStruct(&idBigNum);
-                     extParmST->retValUC = 1;
-                     pthread_exit(0);
-                 } /*If finshed all entries assigned to this thread*/
-             } /*If on the last buffer read in*/
-
-            continue;
-         } /*If is a read I am not printing out*/
-
-        /***************************************************************
-        * Fun-2 Sec-3 Sub-4: Keeping read, print out read
-        \**************************************************************/
+        pushOutChunk(
+            extParmST->ringST,
+            chunkCStr,
+            lenChunkUL,
+            0,
+            0,
+            1
+        );
+
+        if(extParmST->retValUC != 1)
+            break; /*Had an error, the writer stops at this section*/
+
+        sectionUL += extParmST->numThreadsUC;
+    } /*While I have sections to search*/
+
+    /*>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>\
+    ^ Fun-2 Sec-4: Clean up and let the writer know I am done
+    \<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<*/
+
+    done_fun2_sec4:
+
+    if(chunkFILE != 0)
+    { /*If had an error with a chunk open*/
+        fclose(chunkFILE);
+        free(chunkCStr);
+    } /*If had an error with a chunk open*/
+
+    /*Release, so the writer sees all my chunks before doneBl*/
+    __atomic_store_n(&extParmST->ringST->doneBl, 1, __ATOMIC_RELEASE);
+
+    if(buffCStr != 0)
+        free(buffCStr);
+
+    if(idBigNum != 0)
+        freeBigNumStruct(&idBigNum);
 
-         /*allow only one thread print fastq entries at a time*/
-         pthread_mutex_lock(&lockerMutex);
-
-         endOfFileC =
-             printFastqEntry(
-                 buffCStr,
-                 &readPosCStr,   /*Start of read name, wil hold end*/
-                 &startReadCStr, /*points to start of read name*/
-                 extParmST->lenBuffUI,
-                 &lenInputUL,
-                 extParmST->outFILE,
-                 extParmST->fqFILE
-         ); /*Print read & move to next read*/
-
-         /*Allow another thread to print out a fastq entry*/
-         pthread_mutex_unlock(&lockerMutex);
-
-         if(endOfFileC == 0)
-         { /*If ended to early*/
-             free(buffCStr);
-             freeBigNumStruct(&idBigNum);
-             extParmST->retValUC = 0;
-             pthread_exit(0);
-         } /*If ended to early*/
-
-         if(ftell(extParmST->fqFILE) >= *extParmST->endPosUL)
-         { /*If on the last buffer read in*/
-             /*Find the positoin in the file*/
-             posInFileUL =
-                 1 +                        /*Account for \n or @*/
-                 ftell(extParmST->fqFILE) - /*piont in file*/
-                 lenInputUL -              /*Number of bytes in buffer*/
-                 (readPosCStr - buffCStr);  /*byte of position on*/
-
-
-             if(posInFileUL >= *extParmST->endPosUL)
-             { /*If finshed all entries assigned to this thread*/
-                 free(buffCStr);
-                 freeBigNumStruct(&idBigNum);
-                 extParmST->retValUC = 1;
-                 pthread_exit(0);
-             } /*If finshed all entries assigned to this thread*/
-         } /*If on the last buffer read in*/
-    } /*While there are lines in the file*/
-
-    free(buffCStr);
-    freeBigNumStruct(&idBigNum);
-    extParmST->retValUC = 1;
     pthread_exit(0);
 } /*extractReadsInHash*/
 
@@ -576,67 +914,88 @@ unsigned char findStartPos(
     ^ Fun-4 Sec-1: Variable declerations
     \<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<*/
 
-    uint64_t lastHeaderUL = 0; /*Postion of header to start at*/
     unsigned long cntUL = *extParmST->startPosUL;
+    char prevC = 0; /*Character before the one on (0 for the first)*/
 
     /*>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>\
     ^ Fun-4 Sec-2: Find a point were I know I have read past a header
     \<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<*/
 
-    while(lastHeaderUL == 0)
-    { /*While I have to find the starting point*/
-        while(**startOfBuffCStr != ' ' || **startOfBuffCStr != '\t')
-        { /*While I have not found a new entry*/
-             if(**startOfBuffCStr == '+')
-             { /*If I may be on the spacer entry*/
-                 if(lastHeaderUL != 0 &&
-                    *(*startOfBuffCStr - 1) == '\n' &&
-                    *(*startOfBuffCStr + 1) == '\n'
-                 ) break; /*If on the spacer entry*/
-             } /*If I may be on the spacer entry*/
-
-             if(**startOfBuffCStr == '@')
-             { /*If this may be the header*/
-                 /*Check if I may have found a header*/
-                 if(*startOfBuffCStr != *buffCStr && 
-                    *(*startOfBuffCStr - 1) == '\n'
-                 ) { /*If I may have found the header line*/
-                     lastHeaderUL = cntUL;
-                     *extParmST->startPosUL = lastHeaderUL;
-                 } /*If I may have found the header line*/
-             } /*If this may be the header*/
-
-             if(**startOfBuffCStr == '\0')
-             { /*If need to read in more buffer*/
-                 *lenInUL =
-                     fread(
-                         *buffCStr,
-                         sizeof(char),
-                         extParmST->lenBuffUI,
-                         extParmST->fqFILE
-                 ); /*read in next part of file*/
-
-                 if(*lenInUL == 0)
-                 { /*If at the end of the file*/
-                     extParmST->retValUC = 2;
-                     return 0;
-                 } /*If at the end of the file*/
- 
-                 *startOfBuffCStr = *buffCStr;
-                 continue;
-             } /*If need to read in more buffer*/
-
-             /*Adjust start position so next read knows this reads end*/
+    /*A line starting with @ may be a header or a q-score line (q-score
+    ` lines can also start with a +). So each @ line is checked by
+    ` scanning the entry it would start (checkFastqEntry). It is only a
+    ` header if the q-score entry is as long as the sequence, the next
+    ` line is a header, and the next few entries also pass. The previous
+    ` thread reads up to the same header, so no reads are lost or
+    ` printed twice.
+    */
+    while(1)
+    { /*While I have not found a new entry*/
+         if(**startOfBuffCStr == '\0')
+         { /*If need to read in more buffer*/
+             if(*lenInUL < extParmST->lenBuffUI)
+             { /*If at the end of the file*/
+                 extParmST->retValUC = 2;
+                 return 0;
+             } /*If at the end of the file*/
+
+             *lenInUL =
+                 fread(
+                     *buffCStr,
+                     sizeof(char),
+                     extParmST->lenBuffUI,
+                     extParmST->fqFILE
+             ); /*read in next part of file*/
+
+             *(*buffCStr + *lenInUL) = '\0';
+             *startOfBuffCStr = *buffCStr;
+             continue;
+         } /*If need to read in more buffer*/
+
+         if(prevC == '\n' && **startOfBuffCStr == '@')
+         { /*If this line may be a header*/
+             if(
+                 checkFastqEntry(
+                     cntUL,
+                     *buffCStr,
+                     extParmST->lenBuffUI,
+                     extParmST->fqFILE
+                 )
+             ) break; /*Is a header*/
+
+             /*Was a q-score line. checkFastqEntry used the buffer, so
+             ` read in the file after the '@' again
+             */
+             fseek(extParmST->fqFILE, cntUL + 1, SEEK_SET);
+
+             *lenInUL =
+                 fread(
+                     *buffCStr,
+                     sizeof(char),
+                     extParmST->lenBuffUI,
+                     extParmST->fqFILE
+             ); /*read in the rest of the q-score line*/
+
+             *(*buffCStr + *lenInUL) = '\0';
+             *startOfBuffCStr = *buffCStr;
+             prevC = '@';
              ++cntUL;
-             ++(*startOfBuffCStr);
-        } /*While I have not found a new entry*/
-    } /*While I have to find the starting point*/
+             continue;
+         } /*If this line may be a header*/
+
+         /*Adjust start position so next read knows this reads end*/
+         prevC = **startOfBuffCStr;
+         ++cntUL;
+         ++(*startOfBuffCStr);
+    } /*While I have not found a new entry*/
+
+    *extParmST->startPosUL = cntUL;
 
     /*>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>\
     ^ Fun-4 Sec-3: Update file location variables
     \<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<*/
     
-    fseek(extParmST->fqFILE, lastHeaderUL, SEEK_SET);
+    fseek(extParmST->fqFILE, cntUL, SEEK_SET);
     *lenInUL = 
         fread(
             *buffCStr,
@@ -647,8 +1006,995 @@ unsigned char findStartPos(
 
     *startOfBuffCStr = *buffCStr;
     *(*buffCStr + *lenInUL) = '\0';
-    /*Make sure the previous thread knows were to end*/
     extParmST->retValUC = 1; /*So user knows succeded*/
 
     return 1;
 } /*findStartPos*/
+
+/*---------------------------------------------------------------------\
+| Output:
+|   - Prints:
+|     o The chunks in ringAry to outFILE
+|   - Frees:
+|     o The text in each chunk printed
+\---------------------------------------------------------------------*/
+void writeChunkRings(
+    struct chunkRing *ringAry,   /*One ring per thread*/
+    unsigned char numThreadsUC,  /*Number of rings in ringAry*/
+    unsigned long numSectionsUL, /*Number of sections in the file*/
+    uint8_t keepOrderBl,         /*1: Print in input (section) order*/
+    FILE *outFILE                /*File to print reads to*/
+) /*Prints the chunks of reads the threads extracted*/
+{ /*writeChunkRings*/
+
+    /*~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~\
+    ' Fun-5 TOC: writeChunkRings
+    '   o fun-5 sec-1: Variable declerations
+    '   o fun-5 sec-2: Print sections in order (section % threads)
+    '   o fun-5 sec-3: Print chunks as the threads finish them
+    \~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~*/
+
+    /*>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>\
+    ^ Fun-5 Sec-1: Variable declerations
+    \<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<*/
+
+    struct chunkRing *ringST = 0;
+    uint8_t endSectionBl = 0;
+    uint8_t gotChunkBl = 0;
+    unsigned char numDoneUC = 0;
+
+    /*>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>\
+    ^ Fun-5 Sec-2: Print sections in order (section % threads)
+    \<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<*/
+
+    if(keepOrderBl)
+    { /*If keeping the input order*/
+        /*Each thread does its sections in order, so the next chunk
+        ` in a ring is always the next chunk of that threads section
+        */
+        for(
+            unsigned long sectionUL = 0;
+            sectionUL < numSectionsUL;
+            ++sectionUL
+        ){ /*Loop: print each section*/
+            ringST = &ringAry[sectionUL % numThreadsUC];
+            endSectionBl = 0;
+
+            while(endSectionBl == 0)
+            { /*While the section has chunks*/
+                if(popOutChunk(ringST, &endSectionBl, outFILE))
+                    continue;
+
+                /*Acquire, then check again, since the thread may have
+                ` added its last chunk before setting doneBl
+                */
+                if(__atomic_load_n(&ringST->doneBl, __ATOMIC_ACQUIRE))
+                { /*If the thread stopped*/
+                    if(popOutChunk(ringST, &endSectionBl, outFILE))
+                        continue;
+
+                    return; /*Thread had an error*/
+                } /*If the thread stopped*/
+
+                sched_yield(); /*Give the thread time to work*/
+            } /*While the section has chunks*/
+        } /*Loop: print each section*/
+
+        return;
+    } /*If keeping the input order*/
+
+    /*>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>\
+    ^ Fun-5 Sec-3: Print chunks as the threads finish them
+    \<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<*/
+
+    while(numDoneUC < numThreadsUC)
+    { /*While threads are still extracting reads*/
+        gotChunkBl = 0;
+        numDoneUC = 0;
+
+        for(
+            unsigned char ucThread = 0;
+            ucThread < numThreadsUC;
+            ++ucThread
+        ){ /*Loop: print the chunks each thread has ready*/
+            ringST = &ringAry[ucThread];
+
+            if(__atomic_load_n(&ringST->doneBl, __ATOMIC_ACQUIRE))
+                ++numDoneUC;
+
+            while(popOutChunk(ringST, &endSectionBl, outFILE))
+                gotChunkBl = 1;
+        } /*Loop: print the chunks each thread has ready*/
+
+        if(gotChunkBl == 0 && numDoneUC < numThreadsUC)
+            sched_yield(); /*Give the threads time to work*/
+    } /*While threads are still extracting reads*/
+} /*writeChunkRings*/
+
+/*---------------------------------------------------------------------\
+| Output:
+|   - Modifies:
+|     o ringST to have the chunk (waits for the writer if full)
+\---------------------------------------------------------------------*/
+static void pushOutChunk(
+    struct chunkRing *ringST, /*Ring of the thread that made the chunk*/
+    char *textCStr,           /*Kept reads*/
+    size_t lenTextUL,         /*Length of textCStr*/
+    struct iovec *sliceAry,   /*Kept reads in a mapped fastq or 0*/
+    unsigned int numSlicesUI, /*Number of slices in sliceAry*/
+    uint8_t endSectionBl      /*1: Last chunk in the section*/
+) /*Adds a chunk to a threads ring (waits if the ring is full)*/
+{ /*pushOutChunk*/
+
+    /*~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~\
+    ' Fun-6 TOC: pushOutChunk
+    \~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~*/
+
+    uint32_t headUI = ringST->headUI; /*Only this thread sets head*/
+    struct outChunk *chunkST = 0;
+
+    while(
+          headUI - __atomic_load_n(&ringST->tailUI, __ATOMIC_ACQUIRE)
+       >= defChunkRingSize
+    ) sched_yield(); /*Wait for the writer to print a chunk*/
+
+    chunkST = &ringST->chunkAry[headUI & (defChunkRingSize - 1)];
+    chunkST->textCStr = textCStr;
+    chunkST->lenTextUL = lenTextUL;
+    chunkST->sliceAry = sliceAry;
+    chunkST->numSlicesUI = numSlicesUI;
+    chunkST->endSectionBl = endSectionBl;
+
+    /*Release, so the writer sees the chunk before the new head*/
+    __atomic_store_n(&ringST->headUI, headUI + 1, __ATOMIC_RELEASE);
+} /*pushOutChunk*/
+
+/*---------------------------------------------------------------------\
+| Output:
+|   - Prints:
+|     o The oldest chunk in ringST to outFILE
+|   - Modifies:
+|     o endSectionBl to be 1 if the chunk ended a section
+|   - Returns:
+|     o 1 if printed a chunk
+|     o 0 if the ring was empty
+\---------------------------------------------------------------------*/
+static uint8_t popOutChunk(
+    struct chunkRing *ringST, /*Ring to get chunk from*/
+    uint8_t *endSectionBl,    /*Set to 1 if chunk ended a section*/
+    FILE *outFILE             /*File to print the chunk to*/
+) /*Prints and frees the oldest chunk in a ring*/
+{ /*popOutChunk*/
+
+    /*~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~\
+    ' Fun-7 TOC: popOutChunk
+    \~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~*/
+
+    uint32_t tailUI = ringST->tailUI; /*Only the writer sets tail*/
+    struct outChunk *chunkST = 0;
+
+    if(tailUI == __atomic_load_n(&ringST->headUI, __ATOMIC_ACQUIRE))
+        return 0; /*No chunks ready*/
+
+    chunkST = &ringST->chunkAry[tailUI & (defChunkRingSize - 1)];
+
+    if(chunkST->sliceAry != 0)
+    { /*If the chunk is slices of a mapped fastq*/
+        fflush(outFILE); /*writev skips the FILE buffer*/
+        writeSlices(
+            fileno(outFILE),
+            chunkST->sliceAry,
+            chunkST->numSlicesUI
+        );
+
+        free(chunkST->sliceAry);
+    } /*If the chunk is slices of a mapped fastq*/
+
+    else
+    { /*Else the chunk is text*/
+        fwrite(
+            chunkST->textCStr,
+            sizeof(char),
+            chunkST->lenTextUL,
+            outFILE
+        );
+
+        free(chunkST->textCStr);
+    } /*Else the chunk is text*/
+
+    *endSectionBl = chunkST->endSectionBl;
+
+    /*Release, so the thread does not reuse the slot till I am done*/
+    __atomic_store_n(&ringST->tailUI, tailUI + 1, __ATOMIC_RELEASE);
+    return 1;
+} /*popOutChunk*/
+
+/*---------------------------------------------------------------------\
+| Output:
+|   - Modifies:
+|     o extReadsST->ringST to have slices of extReadsST->mapCStr with
+|       the kept reads for each section
+|       (section % numThreadsUC == threadUC) this thread searched
+|     o extReadsST->retValUC: 1 no errors, 0 invalid fastq, 64 memory
+|       error
+|   - Note:
+|     o Nothing is copied, the writer prints the slices straight from
+|       the map, so the map must stay open till the writer finishes
+\---------------------------------------------------------------------*/
+void * extractReadsMapThread(
+    void *parmST /*extReadsST Structer with parameters*/
+) /*Extract target reads from a memory mapped fastq file*/
+{ /*extractReadsMapThread*/
+
+    /*>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>
+    # Fun-8 TOC:
+    #    fun-8 sec-1: Variable declerations
+    #    fun-8 sec-2: Set up the bigNum struct
+    #    fun-8 sec-3: Extract target reads from each section
+    #    fun-8 sec-4: Clean up and let the writer know I am done
+    <<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<*/
+
+    /*>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>
+    # Fun-8 Sec-1: Variable declerations
+    <<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<*/
+
+    /*Cast input as the required struct*/
+    struct extReadsST *extParmST = (struct extReadsST *) parmST;
+
+    char dummyConvertCStr[] = "0"; /*blank number to initalize bignum*/
+    int32_t lenIdInt = 0;
+
+    /*Positions in the memory map*/
+    char *endFileCStr = extParmST->mapCStr + extParmST->lenFileUL;
+    char *endSectionCStr = 0;  /*Reads starting here are next sections*/
+    char *entryCStr = 0;       /*Start of the fastq entry on*/
+    char *nextEntryCStr = 0;   /*Start of the next fastq entry*/
+
+    /*Section of the file working on*/
+    unsigned long sectionUL = extParmST->threadUC;
+    unsigned long startUL = 0;
+    unsigned long endUL = 0;
+
+    /*Private chunk of slices to give to the writer*/
+    struct iovec *sliceAry = 0;
+    unsigned int numSlicesUI = 0;
+    unsigned long lenChunkUL = 0;  /*Bytes in the slices*/
+
+    struct bigNum *idBigNum = 0;
+    struct readInfo *lastRead = 0; /*Holds node of read id found*/
+
+    /*>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>\
+    ^ Fun-8 Sec-2: Set up the bigNum struct
+    \<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<*/
+
+    extParmST->retValUC = 1;
+
+    /*Intalize the bigNum struct*/
+    lenIdInt = 256;
+    idBigNum = makeBigNumStruct(dummyConvertCStr, &lenIdInt);
+
+    if(idBigNum == 0)
+    { /*If could not allocatem memory*/
+        extParmST->retValUC = 64;
+        goto done_fun8_sec4;
+    } /*If could not allocatem memory*/
+
+    /*>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>\
+    ^ Fun-8 Sec-3: Extract target reads from each section
+    ^    fun-8 sec-3 sub-1: Find the first read in the section
+    ^    fun-8 sec-3 sub-2: Get the read id and the end of the entry
+    ^    fun-8 sec-3 sub-3: Determine if read is in tree
+    ^    fun-8 sec-3 sub-4: Add kept reads to the chunk
+    ^    fun-8 sec-3 sub-5: Give the last chunk of the section to writer
+    \<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<*/
+
+    while(sectionUL < extParmST->numSectionsUL)
+    { /*While I have sections to search*/
+
+        /**************************************************************\
+        * Fun-8 Sec-3 Sub-1: Find the first read in the section
+        \**************************************************************/
+
+        startUL = sectionUL * extParmST->lenSectionUL;
+        endUL = startUL + extParmST->lenSectionUL;
+
+        if(endUL > extParmST->lenFileUL)
+            endUL = extParmST->lenFileUL;
+
+        endSectionCStr = extParmST->mapCStr + endUL;
+
+        sliceAry = malloc(defMaxSlices * sizeof(struct iovec));
+        numSlicesUI = 0;
+        lenChunkUL = 0;
+
+        if(sliceAry == 0)
+        { /*If could not make the chunk*/
+            extParmST->retValUC = 64;
+            break;
+        } /*If could not make the chunk*/
+
+        entryCStr =
+            mapFindStartPos(
+                extParmST->mapCStr,
+                startUL,
+                extParmST->lenFileUL,
+                1
+        ); /*Find the first read starting in this section*/
+
+        while(entryCStr < endSectionCStr)
+        { /*While there are reads in the section*/
+
+            /**********************************************************\
+            * Fun-8 Sec-3 Sub-2: Get the read id and the end of the entry
+            \**********************************************************/
+
+            if(*entryCStr == '\n')
+            { /*If on a blank line*/
+                ++entryCStr;
+                continue;
+            } /*If on a blank line*/
+
+            if(*entryCStr != '@')
+            { /*If this is not a fastq header*/
+                extParmST->retValUC = 0;
+                break;
+            } /*If this is not a fastq header*/
+
+            parseMapFastqHeader(entryCStr + 1, endFileCStr, idBigNum);
+            nextEntryCStr = mapNextFastqEntry(entryCStr, endFileCStr);
+
+            if(nextEntryCStr == 0)
+            { /*If ended to early*/
+                extParmST->retValUC = 0;
+                break;
+            } /*If ended to early*/
+
+            /**********************************************************\
+            * Fun-8 Sec-3 Sub-3: Determine if read is in tree
+            \**********************************************************/
+
+            /*Check if using hash table or AVL tree*/
+            if(
+                   extParmST->cuckooFilt != 0
+                && findIdInCuckooFilt(idBigNum,extParmST->cuckooFilt)==0
+            ) lastRead = 0; /*Not in filter, skip hash table/tree*/
+            else if(extParmST->hashTbl == 0)
+                lastRead = searchTree(idBigNum, extParmST->readTree);
+            else
+            { /*Else doing a hash table*/
+                lastRead =
+                    findReadInHashTbl(
+                        idBigNum,
+                        &(extParmST->majicNumUL),
+                        &(extParmST->digPerKeyUC),
+                        extParmST->hashTbl
+                );  /*See if read id is in the hash table*/
+            } /*Else doing a hash table*/
+
+            /**********************************************************\
+            * Fun-8 Sec-3 Sub-4: Add kept reads to the chunk
+            \**********************************************************/
+
+            /*Same check as extractReadsThread (fun-2 sec-3 sub-4)*/
+            if(((!!lastRead) ^ extParmST->printNonMatchBl) != 0)
+            { /*If I am keeping the read*/
+                if(
+                      numSlicesUI > 0
+                   &&    (char *) sliceAry[numSlicesUI - 1].iov_base
+                       + sliceAry[numSlicesUI - 1].iov_len
+                      == entryCStr
+                ) /*If the last kept read was just before this one*/
+                    sliceAry[numSlicesUI - 1].iov_len +=
+                        nextEntryCStr - entryCStr;
+
+                else
+                { /*Else this read starts a new slice*/
+                    sliceAry[numSlicesUI].iov_base = entryCStr;
+                    sliceAry[numSlicesUI].iov_len =
+                        nextEntryCStr - entryCStr;
+                    ++numSlicesUI;
+                } /*Else this read starts a new slice*/
+
+                lenChunkUL += nextEntryCStr - entryCStr;
+
+                if(
+                      numSlicesUI >= defMaxSlices
+                   || lenChunkUL >= defOutChunkBytes
+                ){ /*If the chunk is full, give it to the writer*/
+                    pushOutChunk(
+                        extParmST->ringST,
+                        0,
+                        0,
+                        sliceAry,
+                        numSlicesUI,
+                        0
+                    );
+
+                    sliceAry = malloc(defMaxSlices*sizeof(struct iovec));
+                    numSlicesUI = 0;
+                    lenChunkUL = 0;
+
+                    if(sliceAry == 0)
+                    { /*If could not make the chunk*/
+                        extParmST->retValUC = 64;
+                        goto done_fun8_sec4;
+                    } /*If could not make the chunk*/
+                } /*If the chunk is full, give it to the writer*/
+            } /*If I am keeping the read*/
+
+            entryCStr = nextEntryCStr;
+        } /*While there are reads in the section*/
+
+        /**************************************************************\
+        * Fun-8 Sec-3 Sub-5: Give the last chunk of the section to writer
+        \**************************************************************/
+
+        pushOutChunk(
+            extParmST->ringST,
+            0,
+            0,
+            sliceAry,
+            numSlicesUI,
+            1
+        );
+
+        sliceAry = 0;
+
+        if(extParmST->retValUC != 1)
+            break; /*Had an error, the writer stops at this section*/
+
+        sectionUL += extParmST->numThreadsUC;
+    } /*While I have sections to search*/
+
+    /*>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>\
+    ^ Fun-8 Sec-4: Clean up and let the writer know I am done
+    \<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<*/
+
+    done_fun8_sec4:
+
+    /*Release, so the writer sees all my chunks before doneBl*/
+    __atomic_store_n(&extParmST->ringST->doneBl, 1, __ATOMIC_RELEASE);
+
+    if(idBigNum != 0)
+        freeBigNumStruct(&idBigNum);
+
+    pthread_exit(0);
+} /*extractReadsMapThread*/
+
+/*---------------------------------------------------------------------\
+| Output:
+|   - Returns:
+|     o Pointer to the header of the first fastq entry that starts at
+|       or after startUL
+|     o mapCStr + lenFileUL if no entries start at or after startUL or
+|       if endFileBl is 0 and an entry needs more of the file to check
+\---------------------------------------------------------------------*/
+static char * mapFindStartPos(
+    char *mapCStr,      /*Memory mapped fastq file*/
+    unsigned long startUL,  /*Start of the section*/
+    unsigned long lenFileUL,/*Length of the fastq file*/
+    uint8_t endFileBl   /*1: lenFileUL is the end of the file*/
+) /*Finds the first read in a section of a memory mapped fastq*/
+{ /*mapFindStartPos*/
+
+    /*~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~\
+    ' Fun-9 TOC: mapFindStartPos
+    '   - Quality lines can start with '@' or '+', so each line starting
+    '     with '@' is checked by scanning the entry it would start
+    '     (mapCheckFastqEntry, same as findStartPos).
+    \~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~*/
+
+    char *endFileCStr = mapCStr + lenFileUL;
+    char *lineCStr = mapCStr + startUL;
+    uint8_t headerUC = 0; /*mapCheckFastqEntry return value*/
+
+    if(startUL == 0)
+        return mapCStr;
+
+    if(*(lineCStr - 1) != '\n')
+    { /*If startUL is not the start of a line*/
+        lineCStr = memchr(lineCStr, '\n', endFileCStr - lineCStr);
+
+        if(lineCStr == 0)
+            return endFileCStr;
+
+        ++lineCStr;
+    } /*If startUL is not the start of a line*/
+
+    while(lineCStr < endFileCStr)
+    { /*Loop: Find the first header*/
+        if(*lineCStr == '@')
+        { /*If this line may be a header*/
+            headerUC =
+                mapCheckFastqEntry(lineCStr, endFileCStr, endFileBl);
+
+            if(headerUC == 1)
+                return lineCStr;
+
+            if(headerUC == 2)
+                break; /*Need more of the file to check*/
+        } /*If this line may be a header*/
+
+        lineCStr = memchr(lineCStr, '\n', endFileCStr - lineCStr);
+
+        if(lineCStr == 0)
+            break;
+
+        ++lineCStr;
+    } /*Loop: Find the first header*/
+
+    return endFileCStr; /*No complete entries start here*/
+} /*mapFindStartPos*/
+
+/*---------------------------------------------------------------------\
+| Output:
+|   - Prints:
+|     o The bytes in each slice of sliceAry to outFD
+\---------------------------------------------------------------------*/
+static void writeSlices(
+    int outFD,               /*File descriptor to print to*/
+    struct iovec *sliceAry,  /*Slices to print*/
+    unsigned int numSlicesUI /*Number of slices in sliceAry*/
+) /*Prints slices of a memory mapped fastq with writev*/
+{ /*writeSlices*/
+
+    /*~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~\
+    ' Fun-10 TOC: writeSlices
+    '   - writev can print only part of the slices (pipes), so this
+    '     keeps calling writev till all slices are printed
+    \~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~*/
+
+    ssize_t lenOutSL = 0;
+
+    while(numSlicesUI > 0)
+    { /*While have slices to print*/
+        lenOutSL = writev(outFD, sliceAry, numSlicesUI);
+
+        if(lenOutSL < 0)
+        { /*If writev had an error*/
+            if(errno == EINTR)
+                continue;
+
+            return; /*Nothing more can be printed*/
+        } /*If writev had an error*/
+
+        /*Skip the slices writev finished*/
+        while(
+               numSlicesUI > 0
+            && (size_t) lenOutSL >= sliceAry->iov_len
+        ){ /*Loop: remove printed slices*/
+            lenOutSL -= sliceAry->iov_len;
+            ++sliceAry;
+            --numSlicesUI;
+        } /*Loop: remove printed slices*/
+
+        if(numSlicesUI > 0)
+        { /*If writev stopped in a slice*/
+            sliceAry->iov_base = (char *) sliceAry->iov_base + lenOutSL;
+            sliceAry->iov_len -= lenOutSL;
+        } /*If writev stopped in a slice*/
+    } /*While have slices to print*/
+} /*writeSlices*/
+
+/*---------------------------------------------------------------------\
+| Output:
+|   - Modifies:
+|     o extReadsST->ringST to have the kept reads for each BGZF section
+|       (section % numThreadsUC == threadUC) this thread searched
+|     o extReadsST->retValUC: 1 no errors, 0 invalid fastq, 64 memory
+|       error
+|   - Note:
+|     o Sections are whole BGZF blocks, so each section is uncompressed
+|       by its own gzip -dc pipe. The pipe is read past the end of the
+|       section to finish the last read.
+|     o A section owns the reads starting at or before its last byte,
+|       so the next section always skips its first (partial) line
+\---------------------------------------------------------------------*/
+void * extractReadsBgzfThread(
+    void *parmST /*extReadsST Structer with parameters*/
+) /*Extract target reads from a BGZF compressed fastq file*/
+{ /*extractReadsBgzfThread*/
+
+    /*>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>
+    # Fun-11 TOC:
+    #    fun-11 sec-1: Variable declerations
+    #    fun-11 sec-2: Set up the bigNum struct
+    #    fun-11 sec-3: Extract target reads from each section
+    #    fun-11 sec-4: Clean up and let the writer know I am done
+    <<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<*/
+
+    /*>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>
+    # Fun-11 Sec-1: Variable declerations
+    <<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<*/
+
+    /*Cast input as the required struct*/
+    struct extReadsST *extParmST = (struct extReadsST *) parmST;
+    struct bgzfSections *bgzfST = extParmST->bgzfST;
+
+    char dummyConvertCStr[] = "0"; /*blank number to initalize bignum*/
+    int32_t lenIdInt = 0;
+
+    char gzipCmdCStr[2048];  /*Command to uncompress a section*/
+    FILE *pipeFILE = 0;      /*gzip -dc output for the section*/
+    uint8_t pipeStatUC = 0;  /*1: pipe may have more, 0: EOF, 64: mem*/
+
+    /*Uncompressed section*/
+    char *buffCStr = 0;
+    unsigned long lenBuffUL = 0;
+    unsigned long lenDataUL = 0;
+
+    char *tmpCStr = 0;
+    char *nextEntryCStr = 0; /*Start of the next fastq entry*/
+    unsigned long entryUL = 0; /*Start of the entry on in buffCStr*/
+
+    /*Section of the file working on*/
+    unsigned long sectionUL = extParmST->threadUC;
+    unsigned long lenSecUL = 0;
+
+    /*Private chunk to print kept reads to*/
+    FILE *chunkFILE = 0;
+    char *chunkCStr = 0;
+    size_t lenChunkUL = 0;
+
+    struct bigNum *idBigNum = 0;
+    struct readInfo *lastRead = 0; /*Holds node of read id found*/
+
+    /*>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>\
+    ^ Fun-11 Sec-2: Set up the bigNum struct
+    \<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<*/
+
+    extParmST->retValUC = 1;
+
+    /*Intalize the bigNum struct*/
+    lenIdInt = 256;
+    idBigNum = makeBigNumStruct(dummyConvertCStr, &lenIdInt);
+
+    if(idBigNum == 0)
+    { /*If could not allocatem memory*/
+        extParmST->retValUC = 64;
+        goto done_fun11_sec4;
+    } /*If could not allocatem memory*/
+
+    /*>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>\
+    ^ Fun-11 Sec-3: Extract target reads from each section
+    ^    fun-11 sec-3 sub-1: Start uncompressing the section
+    ^    fun-11 sec-3 sub-2: Find the first read in the section
+    ^    fun-11 sec-3 sub-3: Make sure have the full fastq entry
+    ^    fun-11 sec-3 sub-4: Determine if read is in tree
+    ^    fun-11 sec-3 sub-5: Print kept reads to the chunk
+    ^    fun-11 sec-3 sub-6: Give the last chunk of the section to writer
+    \<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<*/
+
+    while(sectionUL < bgzfST->numSectionsUL)
+    { /*While I have sections to search*/
+
+        /**************************************************************\
+        * Fun-11 Sec-3 Sub-1: Start uncompressing the section
+        \**************************************************************/
+
+        lenSecUL = bgzfST->lenAryUL[sectionUL];
+        lenDataUL = 0;
+        entryUL = 0;
+
+        chunkFILE = open_memstream(&chunkCStr, &lenChunkUL);
+
+        if(chunkFILE == 0)
+        { /*If could not make the chunk*/
+            extParmST->retValUC = 64;
+            break;
+        } /*If could not make the chunk*/
+
+        /*tail is 1 based. Reading stops after the last read, so gzip
+        ` stops (broken pipe) instead of uncompressing the whole file
+        */
+        snprintf(
+            gzipCmdCStr,
+            2048,
+            "tail -c +%lu \"%s\" 2>/dev/null | gzip -dc 2>/dev/null",
+            bgzfST->compStartAryUL[sectionUL] + 1,
+            extParmST->fqPathCStr
+        );
+
+        pipeFILE = popen(gzipCmdCStr, "r");
+
+        if(pipeFILE == 0)
+        { /*If could not start gzip*/
+            extParmST->retValUC = 0;
+            goto endSection_fun11_sec3_sub6;
+        } /*If could not start gzip*/
+
+        pipeStatUC =
+            readBgzfPipe(
+                pipeFILE,
+                &buffCStr,
+                &lenBuffUL,
+                &lenDataUL,
+                lenSecUL + defBgzfPadBytes
+        ); /*Read in the section*/
+
+        /**************************************************************\
+        * Fun-11 Sec-3 Sub-2: Find the first read in the section
+        \**************************************************************/
+
+        while(sectionUL != 0 && pipeStatUC != 64)
+        { /*Loop: find the first header after the first line*/
+            tmpCStr = memchr(buffCStr, '\n', lenDataUL);
+
+            if(tmpCStr != 0)
+            { /*If have the first line*/
+                tmpCStr =
+                    mapFindStartPos(
+                        buffCStr,
+                        tmpCStr - buffCStr + 1,
+                        lenDataUL,
+                        pipeStatUC == 0
+                );
+
+                entryUL = tmpCStr - buffCStr;
+
+                if(entryUL < lenDataUL)
+                    break; /*Found the first header*/
+            } /*If have the first line*/
+
+            entryUL = lenDataUL;
+
+            if(pipeStatUC == 0)
+                break; /*No reads start in this section*/
+
+            pipeStatUC =
+                readBgzfPipe(
+                    pipeFILE,
+                    &buffCStr,
+                    &lenBuffUL,
+                    &lenDataUL,
+                    defBgzfPadBytes
+            );
+        } /*Loop: find the first header after the first line*/
+
+        if(pipeStatUC == 64)
+            extParmST->retValUC = 64;
+
+        while(entryUL <= lenSecUL)
+        { /*While there are reads in the section*/
+
+            /**********************************************************\
+            * Fun-11 Sec-3 Sub-3: Make sure have the full fastq entry
+            \**********************************************************/
+
+            if(pipeStatUC == 64)
+            { /*If had a memory error*/
+                extParmST->retValUC = 64;
+                break;
+            } /*If had a memory error*/
+
+            if(entryUL >= lenDataUL)
+            { /*If need more of the file*/
+                if(pipeStatUC == 0)
+                    break; /*End of the file*/
+
+                pipeStatUC =
+                    readBgzfPipe(
+                        pipeFILE,
+                        &buffCStr,
+                        &lenBuffUL,
+                        &lenDataUL,
+                        defBgzfPadBytes
+                );
+
+                continue;
+            } /*If need more of the file*/
+
+            if(buffCStr[entryUL] == '\n')
+            { /*If on a blank line*/
+                ++entryUL;
+                continue;
+            } /*If on a blank line*/
+
+            if(buffCStr[entryUL] != '@')
+            { /*If this is not a fastq header*/
+                extParmST->retValUC = 0;
+                break;
+            } /*If this is not a fastq header*/
+
+            nextEntryCStr =
+                mapNextFastqEntry(
+                    buffCStr + entryUL,
+                    buffCStr + lenDataUL
+            );
+
+            if(
+                   pipeStatUC == 1
+                && (
+                        nextEntryCStr == 0
+                     || (   nextEntryCStr == buffCStr + lenDataUL
+                         && buffCStr[lenDataUL - 1] != '\n'
+                        )
+                   )
+            ){ /*If the entry may go past the data I have*/
+                pipeStatUC =
+                    readBgzfPipe(
+                        pipeFILE,
+                        &buffCStr,
+                        &lenBuffUL,
+                        &lenDataUL,
+                        defBgzfPadBytes
+                );
+
+                continue;
+            } /*If the entry may go past the data I have*/
+
+            if(nextEntryCStr == 0)
+            { /*If ended to early*/
+                extParmST->retValUC = 0;
+                break;
+            } /*If ended to early*/
+
+            parseMapFastqHeader(
+                buffCStr + entryUL + 1,
+                buffCStr + lenDataUL,
+                idBigNum
+            );
+
+            /**********************************************************\
+            * Fun-11 Sec-3 Sub-4: Determine if read is in tree
+            \**********************************************************/
+
+            /*Check if using hash table or AVL tree*/
+            if(
+                   extParmST->cuckooFilt != 0
+                && findIdInCuckooFilt(idBigNum,extParmST->cuckooFilt)==0
+            ) lastRead = 0; /*Not in filter, skip hash table/tree*/
+            else if(extParmST->hashTbl == 0)
+                lastRead = searchTree(idBigNum, extParmST->readTree);
+            else
+            { /*Else doing a hash table*/
+                lastRead =
+                    findReadInHashTbl(
+                        idBigNum,
+                        &(extParmST->majicNumUL),
+                        &(extParmST->digPerKeyUC),
+                        extParmST->hashTbl
+                );  /*See if read id is in the hash table*/
+            } /*Else doing a hash table*/
+
+            /**********************************************************\
+            * Fun-11 Sec-3 Sub-5: Print kept reads to the chunk
+            \**********************************************************/
+
+            /*Same check as extractReadsThread (fun-2 sec-3 sub-4)*/
+            if(((!!lastRead) ^ extParmST->printNonMatchBl) != 0)
+            { /*If I am keeping the read*/
+                fwrite(
+                    buffCStr + entryUL,
+                    sizeof(char),
+                    nextEntryCStr - (buffCStr + entryUL),
+                    chunkFILE
+                );
+
+                if(ftell(chunkFILE) >= defOutChunkBytes)
+                { /*If the chunk is full, give it to the writer*/
+                    fclose(chunkFILE);
+                    pushOutChunk(
+                        extParmST->ringST,
+                        chunkCStr,
+                        lenChunkUL,
+                        0,
+                        0,
+                        0
+                    );
+
+                    chunkFILE = open_memstream(&chunkCStr, &lenChunkUL);
+
+                    if(chunkFILE == 0)
+                    { /*If could not make the chunk*/
+                        extParmST->retValUC = 64;
+                        pclose(pipeFILE);
+                        goto done_fun11_sec4;
+                    } /*If could not make the chunk*/
+                } /*If the chunk is full, give it to the writer*/
+            } /*If I am keeping the read*/
+
+            entryUL = nextEntryCStr - buffCStr;
+        } /*While there are reads in the section*/
+
+        pclose(pipeFILE);
+
+        /**************************************************************\
+        * Fun-11 Sec-3 Sub-6: Give the last chunk of the section to writer
+        \**************************************************************/
+
+        endSection_fun11_sec3_sub6:
+
+        fclose(chunkFILE);
+        chunkFILE = 0;
+
+        pushOutChunk(
+            extParmST->ringST,
+            chunkCStr,
+            lenChunkUL,
+            0,
+            0,
+            1
+        );
+
+        if(extParmST->retValUC != 1)
+            break; /*Had an error, the writer stops at this section*/
+
+        sectionUL += extParmST->numThreadsUC;
+    } /*While I have sections to search*/
+
+    /*>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>\
+    ^ Fun-11 Sec-4: Clean up and let the writer know I am done
+    \<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<*/
+
+    done_fun11_sec4:
+
+    /*Release, so the writer sees all my chunks before doneBl*/
+    __atomic_store_n(&extParmST->ringST->doneBl, 1, __ATOMIC_RELEASE);
+
+    if(buffCStr != 0)
+        free(buffCStr);
+
+    if(idBigNum != 0)
+        freeBigNumStruct(&idBigNum);
+
+    pthread_exit(0);
+} /*extractReadsBgzfThread*/
+
+/*---------------------------------------------------------------------\
+| Output:
+|   - Modifies:
+|     o buffCStr to have up to lenReadUL more bytes from pipeFILE
+|       (resized if needed)
+|     o lenBuffUL to be the new size of buffCStr
+|     o lenDataUL to have the number of bytes read in
+|   - Returns:
+|     o 1 if read in more of the file
+|     o 0 if at the end of the file
+|     o 64 for memory errors
+\---------------------------------------------------------------------*/
+static uint8_t readBgzfPipe(
+    FILE *pipeFILE,            /*gzip -dc pipe to read from*/
+    char **buffCStr,           /*Buffer to add to (resized if needed)*/
+    unsigned long *lenBuffUL,  /*Size of buffCStr*/
+    unsigned long *lenDataUL,  /*Number of bytes in buffCStr*/
+    unsigned long lenReadUL    /*Number of bytes to read*/
+) /*Reads more of a BGZF section from its gzip -dc pipe*/
+{ /*readBgzfPipe*/
+
+    /*~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~\
+    ' Fun-12 TOC: readBgzfPipe
+    '   - The buffer is only made bigger (doubled), so it is reused for
+    '     each section the thread works on
+    \~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~*/
+
+    unsigned long lenNewUL = *lenBuffUL;
+    size_t lenInUL = 0;
+    char *tmpCStr = 0;
+
+    if(*lenDataUL + lenReadUL > *lenBuffUL)
+    { /*If need a bigger buffer*/
+        lenNewUL = *lenBuffUL << 1;
+
+        if(lenNewUL < *lenDataUL + lenReadUL)
+            lenNewUL = *lenDataUL + lenReadUL;
+
+        tmpCStr = realloc(*buffCStr, lenNewUL);
+
+        if(tmpCStr == 0)
+            return 64;
+
+        *buffCStr = tmpCStr;
+        *lenBuffUL = lenNewUL;
+    } /*If need a bigger buffer*/
+
+    lenInUL =
+        fread(*buffCStr + *lenDataUL, sizeof(char), lenReadUL, pipeFILE);
+
+    *lenDataUL += lenInUL;
+
+    if(lenInUL < lenReadUL)
+        return 0; /*fread only stops early at the end of a pipe*/
+
+    return 1;
+} /*readBgzfPipe*/
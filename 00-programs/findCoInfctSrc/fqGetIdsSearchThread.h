@@ -6,13 +6,38 @@
 #    fastqGrepAVLTree
 #    fastqGrepStructs (called by fastqGrepAVLTree)
 #    fqGetIdsSearchFq (single thread version + some needed functions)
+#    fqGetIdsBgzf (splits BGZF files into sections)
 ######################################################################*/
 
 #ifndef FQGREPSEARCHTHREAD_H
 #define FQGREPSEARCHTHREAD_H
 
 #include <pthread.h> /*For multi-threading*/
+#include <sys/uio.h> /*struct iovec and writev (-mmap)*/
 #include "fqGetIdsSearchFq.h"
+#include "fqGetIdsBgzf.h"
+
+/*Each thread prints kept reads to a private chunk. A chunk is
+  handed to the writer (the main thread) once it has this many
+  bytes or the thread finishes a section*/
+#define defOutChunkBytes (1 << 20)
+
+/*Number of chunks a thread can have waiting for the writer
+  (must be a power of two)*/
+#define defChunkRingSize 64
+
+/*The fastq file is split into sections of this size, which are
+  handed out to the threads in turn (section % threads). Smaller
+  sections keep the threads busy when keeping the input order.*/
+#define defSectionBytes (1 << 24)
+
+/*Most slices of the mapped fastq a chunk can have (-mmap). This is
+  the smallest IOV_MAX (writev limit) on most systems.*/
+#define defMaxSlices 1024
+
+/*Extra room to start a BGZF sections buffer with, so most reads at
+  the end of the section do not need the buffer to be resized*/
+#define defBgzfPadBytes (1 << 20)
 
 /*---------------------------------------------------------------------\
 | Struct-1: getFileLenStruct
@@ -25,7 +50,39 @@ typedef struct getFileLenStruct
 }getFileLenStruct;
 
 /*---------------------------------------------------------------------\
-| Struct-2: extReadsST
+| Struct-2: outChunk
+|   o Kept reads a thread printed (open_memstream buffer) or, for
+|     a memory mapped fastq, the parts of the map with kept reads
+\---------------------------------------------------------------------*/
+typedef struct outChunk
+{ /*outChunk*/
+    char *textCStr;       /*Fastq entries (writer frees)*/
+    size_t lenTextUL;     /*Number of bytes in textCStr*/
+
+    struct iovec *sliceAry;  /*Used instead if not 0 (writer frees)*/
+    unsigned int numSlicesUI;/*Number of slices in sliceAry*/
+
+    uint8_t endSectionBl; /*1: last chunk of the section*/
+}outChunk;
+
+/*---------------------------------------------------------------------\
+| Struct-3: chunkRing
+|   o Single producer (thread), single consumer (writer) ring of
+|     chunks. No locks are used. headUI and tailUI only go up and
+|     are read/set with atomic acquire/release loads/stores.
+|   o Chunks come out in the order the thread made them, so the
+|     count of taken chunks is the chunk sequence number.
+\---------------------------------------------------------------------*/
+typedef struct chunkRing
+{ /*chunkRing*/
+    struct outChunk chunkAry[defChunkRingSize];
+    uint32_t headUI;  /*Chunks added (only the thread sets)*/
+    uint32_t tailUI;  /*Chunks taken (only the writer sets)*/
+    uint8_t doneBl;   /*1: thread will not add any more chunks*/
+}chunkRing;
+
+/*---------------------------------------------------------------------\
+| Struct-4: extReadsST
 |   o Structer to hold parameters for a multithread read extract
 \---------------------------------------------------------------------*/
 typedef struct extReadsST
@@ -40,9 +97,19 @@ typedef struct extReadsST
 
     struct readInfo *readTree;  /*For AVL search (hashTbl == 0)*/
     struct readInfo **hashTbl;  /*Hash table to search for ids in*/
+    struct cuckooFilt *cuckooFilt; /*Checked first if not 0*/
+
+    unsigned char threadUC;     /*Index of this thread*/
+    unsigned char numThreadsUC; /*Number of threads extracting*/
+    unsigned long lenFileUL;    /*Length of the fastq file*/
+    unsigned long lenSectionUL; /*Bytes in each section*/
+    unsigned long numSectionsUL;/*Number of sections in file*/
 
     FILE *fqFILE;
-    FILE *outFILE;
+    char *mapCStr;              /*Memory mapped fastq (-mmap)*/
+    char *fqPathCStr;           /*Fastq file (BGZF threads open it)*/
+    struct bgzfSections *bgzfST;/*Sections of a BGZF fastq or 0*/
+    struct chunkRing *ringST;   /*Gets this threads chunks*/
 }extReadsST;
 
 
@@ -63,18 +130,48 @@ uint8_t fastqThreadExtract(
     uint8_t sizeReadStackUC,   /*Number of elements to use in stack*/
     uint32_t lenBuffUI,        /*Size of buffer to read input with*/
     uint8_t hashSearchC,    /*1: do hash search, 0: do Tree search*/
-    uint8_t printReverseC   /*1: Keep reads in filter file
+    uint8_t printReverseC,  /*1: Keep reads in filter file
                                  0: ingore reads in filter file*/
+    uint8_t keepOrderBl,    /*1: Print reads in input order*/
+    uint8_t mapFileBl,      /*1: Memory map the fastq file*/
+    uint8_t prefilterBl     /*1: Check a cuckoo filter first*/
 ); /*Searches and extracts reads from a fastq file using read id's*/
 
 /*---------------------------------------------------------------------\
 | Output:
-|    stdout: Prints out reads in hash table
+|   - Modifies:
+|     o extReadsST->ringST to have the kept reads for each section
+|       (section % numThreadsUC == threadUC) this thread searched
+|     o extReadsST->retValUC: 1 no errors, 0 invalid fastq, 64 memory
+|       error
 \---------------------------------------------------------------------*/
 void * extractReadsThread(
     void *parmST /*extReadsST Structer with parameters*/
 ); /*Extract target reads from fastq file with hash table or tree*/
 
+/*---------------------------------------------------------------------\
+| Output:
+|   - Modifies:
+|     o extReadsST->ringST to have slices of extReadsST->mapCStr with
+|       the kept reads for each section this thread searched
+|     o extReadsST->retValUC: 1 no errors, 0 invalid fastq, 64 memory
+|       error
+\---------------------------------------------------------------------*/
+void * extractReadsMapThread(
+    void *parmST /*extReadsST Structer with parameters*/
+); /*Extract target reads from a memory mapped fastq file*/
+
+/*---------------------------------------------------------------------| Output:
+|   - Modifies:
+|     o extReadsST->ringST to have the kept reads for each BGZF section
+|       (extReadsST->bgzfST) this thread searched
+|     o extReadsST->retValUC: 1 no errors, 0 invalid fastq, 64 memory
+|       error
+\---------------------------------------------------------------------*/
+void * extractReadsBgzfThread(
+    void *parmST /*extReadsST Structer with parameters*/
+); /*Extract target reads from a BGZF compressed fastq file*/
+
 /*---------------------------------------------------------------------\
 | Output:
 |   - Modifies:
@@ -102,4 +199,19 @@ unsigned char findStartPos(
     struct extReadsST *extParmST /*Holds parameters to use*/
 ); /*Finds the next read after the starting position*/
 
+/*---------------------------------------------------------------------\
+| Output:
+|   - Prints:
+|     o The chunks in ringAry to outFILE
+|   - Frees:
+|     o The text in each chunk printed
+\---------------------------------------------------------------------*/
+void writeChunkRings(
+    struct chunkRing *ringAry,   /*One ring per thread*/
+    unsigned char numThreadsUC,  /*Number of rings in ringAry*/
+    unsigned long numSectionsUL, /*Number of sections in the file*/
+    uint8_t keepOrderBl,         /*1: Print in input (section) order*/
+    FILE *outFILE                /*File to print reads to*/
+); /*Prints the chunks of reads the threads extracted*/
+
 #endif
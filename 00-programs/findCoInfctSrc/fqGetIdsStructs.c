@@ -415,6 +415,9 @@ long cmpBigNums(
 |    Returns:
 |      - 0 if fails or end of file (lenIdULng < buffSizeInt)
 |      - pointer to struct with bigNum struct having converted read id
+|    Note:
+|      - If arenaST is not 0, the readInfo, bigNum, and bigNum array
+|        are from arenaST and are only freed with freeMemArena
 \---------------------------------------------------------------------*/
 struct readInfo * cnvtIdToBigNum(
     char *bufferCStr,  /*buffer to hold fread input (can have data)*/
@@ -422,7 +425,8 @@ struct readInfo * cnvtIdToBigNum(
     char **endCStr, /*Points to start of id, will point to end*/
     uint64_t *lenInputULng, /*Length of input from fread*/
     unsigned char *lenBigNumChar, /*Holds size to make bigNumber*/
-    FILE *idFILE         /*Fastq file to get data from*/
+    FILE *idFILE,        /*Fastq file to get data from*/
+    struct memArena *arenaST /*Arena for the nodes (0: malloc)*/
 ) /*Converts read id to bigNum read id, will grab new file input*/
 { /*cnvtIdToBigNum*/
 
@@ -438,8 +442,9 @@ struct readInfo * cnvtIdToBigNum(
     \<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<*/
 
     unsigned char charBit = 0;
-    struct bigNum *idBigNum = malloc(sizeof(struct bigNum));
-    struct readInfo *readNode = malloc(sizeof(struct readInfo));
+    struct bigNum *idBigNum = 0;
+    struct readInfo *readNode = 0;
+    void *tmpAry = 0;
 
     #ifndef MEM
         #if defOSBit == 64
@@ -455,10 +460,22 @@ struct readInfo * cnvtIdToBigNum(
     ^ Fun-9 Sec-2: Initalize readInfo & bigNum structs
     \<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<*/
 
+    if(arenaST != 0)
+    { /*If putting the nodes in an arena (freed as one block)*/
+        idBigNum = arenaAlloc(arenaST, sizeof(struct bigNum));
+        readNode = arenaAlloc(arenaST, sizeof(struct readInfo));
+    } /*If putting the nodes in an arena (freed as one block)*/
+
+    else
+    { /*Else each node is its own malloc*/
+        idBigNum = malloc(sizeof(struct bigNum));
+        readNode = malloc(sizeof(struct readInfo));
+    } /*Else each node is its own malloc*/
+
     if(idBigNum == 0 || readNode == 0)
     { /*If memory allocation failed*/
-        if(idBigNum != 0) free(idBigNum);
-        if(readNode != 0) free(readNode);
+        if(arenaST == 0 && idBigNum != 0) free(idBigNum);
+        if(arenaST == 0 && readNode != 0) free(readNode);
 
         *lenInputULng = 0; /*Make sure user detects failure*/
         return 0; 
@@ -473,23 +490,30 @@ struct readInfo * cnvtIdToBigNum(
 
     #ifndef MEM
         idBigNum->totalL = 0;
-
-         #if defOSBit == 64
-           idBigNum->bigNumAryIOrL=malloc(sizeof(int)*(*lenBigNumChar));
-        #else
-         idBigNum->bigNumAryIOrL=malloc(sizeof(short)*(*lenBigNumChar));
-        #endif
-    #else
-        idBigNum->bigNumAryIOrL = malloc(sizeof(long)*(*lenBigNumChar));
     #endif
 
+    if(arenaST != 0)
+        idBigNum->bigNumAryIOrL =
+            arenaAlloc(
+                arenaST,
+                sizeof(*idBigNum->bigNumAryIOrL) * (*lenBigNumChar)
+            ); /*int, short, or long limbs (MEM & defOSBit)*/
+    else
+        idBigNum->bigNumAryIOrL =
+            malloc(sizeof(*idBigNum->bigNumAryIOrL) * (*lenBigNumChar));
+
     idBigNum->lenAllElmChar = *lenBigNumChar;
 
     if(idBigNum->bigNumAryIOrL == 0)
     { /*If memory reallocation failed*/
         *lenInputULng = 0; /*Make sure user detects failure*/
-        free(idBigNum);
-        free(readNode);
+
+        if(arenaST == 0)
+        { /*If not using an arena*/
+            free(idBigNum);
+            free(readNode);
+        } /*If not using an arena*/
+
         return 0;
     } /*If memory reallocation failed*/
 
@@ -504,9 +528,13 @@ struct readInfo * cnvtIdToBigNum(
 
         if(*lenInputULng < buffSizeInt)
         { /*If at end of file*/
-          free(idBigNum->bigNumAryIOrL);
-          free(idBigNum);
-          free(readNode);
+          if(arenaST == 0)
+          { /*If not using an arena (arena nodes are freed later)*/
+              free(idBigNum->bigNumAryIOrL);
+              free(idBigNum);
+              free(readNode);
+          } /*If not using an arena (arena nodes are freed later)*/
+
           return 0;                    /*Done with file*/
         } /*If at end of file*/
 
@@ -536,28 +564,39 @@ struct readInfo * cnvtIdToBigNum(
         { /*If need to reallocate memory*/
             (idBigNum->lenAllElmChar)++;
             (*lenBigNumChar)++;
-            idBigNum->bigNumAryIOrL =
-                realloc(
-                    idBigNum->bigNumAryIOrL,
-                    #ifndef MEM
-                         #if defOSBit == 64
-                            sizeof(int) * idBigNum->lenAllElmChar
-                        #else
-                            sizeof(short) * idBigNum->lenAllElmChar
-                        #endif /*Check if 32 bit or 64 bit*/
-                    #else
-                        sizeof(long) * idBigNum->lenAllElmChar
-                    #endif
-            ); /*Rellocate memory for the array*/
 
-            if(idBigNum == 0 || readNode == 0)
+            if(arenaST != 0)
+                tmpAry =
+                    arenaRealloc(
+                        arenaST,
+                        idBigNum->bigNumAryIOrL,
+                          sizeof(*idBigNum->bigNumAryIOrL)
+                        * (idBigNum->lenAllElmChar - 1),
+                          sizeof(*idBigNum->bigNumAryIOrL)
+                        * idBigNum->lenAllElmChar
+                ); /*Grows in place (array is the last allocation)*/
+            else
+                tmpAry =
+                    realloc(
+                        idBigNum->bigNumAryIOrL,
+                          sizeof(*idBigNum->bigNumAryIOrL)
+                        * idBigNum->lenAllElmChar
+                ); /*Rellocate memory for the array*/
+
+            if(tmpAry == 0)
             { /*If memory allocation failed*/
-                free(idBigNum->bigNumAryIOrL);
-                free(idBigNum);
-                free(readNode);
+                if(arenaST == 0)
+                { /*If not using an arena*/
+                    free(idBigNum->bigNumAryIOrL);
+                    free(idBigNum);
+                    free(readNode);
+                } /*If not using an arena*/
+
                 *lenInputULng = 0; /*Make sure user detects failure*/
                 return 0; 
             } /*If memory allocation failed*/
+
+            idBigNum->bigNumAryIOrL = tmpAry;
         } /*If need to reallocate memory*/
 
         /*Graph unsigned long element working on*/
@@ -624,13 +663,15 @@ struct readInfo * cnvtIdToBigNum(
 |     o This will only read the buffer untile hte first invisible 
 |       character. It is up to you to ensure that you are on the next
 |       read id.
+|     o If arenaST is not 0, the bigNum is only freed with freeMemArena
 \---------------------------------------------------------------------*/
 struct bigNum * buffToBigNum(
     char *idCStr,  /*buffer to hold fread input (can have data)*/
     char **endCStr, /*Will point to end of read id*/
-    unsigned char *lenBigNumChar
+    unsigned char *lenBigNumChar,
         /*Holds starting size to make bigNumber. This will be updated
           each time I have to resize the array.*/
+    struct memArena *arenaST /*Arena for the bigNum (0: malloc)*/
 ) /*Converts read id in the input cString to bigNum read id. This 
     function will not grab new file input, so make sure your entire
     read id is in idCStr.*/
@@ -648,7 +689,8 @@ struct bigNum * buffToBigNum(
     \<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<*/
 
     unsigned char charBit = 0;
-    struct bigNum *idBigNum = malloc(sizeof(struct bigNum));
+    struct bigNum *idBigNum = 0;
+    void *tmpAry = 0;
 
     #ifndef MEM
         #if defOSBit == 64
@@ -664,10 +706,13 @@ struct bigNum * buffToBigNum(
     ^ Fun-9 Sec-2: Initalize readInfo & bigNum structs
     \<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<*/
 
+    if(arenaST != 0)
+        idBigNum = arenaAlloc(arenaST, sizeof(struct bigNum));
+    else
+        idBigNum = malloc(sizeof(struct bigNum));
+
     if(idBigNum == 0)
     { /*If memory allocation failed*/
-        if(idBigNum != 0) free(idBigNum);
-
         *lenBigNumChar = 0; /*Make sure user detects failure*/
         return 0; 
     } /*If memory allocation failed*/
@@ -676,22 +721,24 @@ struct bigNum * buffToBigNum(
 
     #ifndef MEM
         idBigNum->totalL = 0;
-
-         #if defOSBit == 64
-           idBigNum->bigNumAryIOrL=malloc(sizeof(int)*(*lenBigNumChar));
-        #else
-         idBigNum->bigNumAryIOrL=malloc(sizeof(short)*(*lenBigNumChar));
-        #endif
-    #else
-        idBigNum->bigNumAryIOrL = malloc(sizeof(long)*(*lenBigNumChar));
     #endif
 
+    if(arenaST != 0)
+        idBigNum->bigNumAryIOrL =
+            arenaAlloc(
+                arenaST,
+                sizeof(*idBigNum->bigNumAryIOrL) * (*lenBigNumChar)
+            ); /*int, short, or long limbs (MEM & defOSBit)*/
+    else
+        idBigNum->bigNumAryIOrL =
+            malloc(sizeof(*idBigNum->bigNumAryIOrL) * (*lenBigNumChar));
+
     idBigNum->lenAllElmChar = *lenBigNumChar;
 
     if(idBigNum->bigNumAryIOrL == 0)
     { /*If memory reallocation failed*/
         *lenBigNumChar = 0; /*Make sure user detects failure*/
-        free(idBigNum);
+        if(arenaST == 0) free(idBigNum);
         return 0;
     } /*If memory reallocation failed*/
 
@@ -713,27 +760,38 @@ struct bigNum * buffToBigNum(
         { /*If need to reallocate memory*/
             (idBigNum->lenAllElmChar)++;
             (*lenBigNumChar)++;
-            idBigNum->bigNumAryIOrL =
-                realloc(
-                    idBigNum->bigNumAryIOrL,
-                    #ifndef MEM
-                         #if defOSBit == 64
-                            sizeof(int) * idBigNum->lenAllElmChar
-                        #else
-                            sizeof(short) * idBigNum->lenAllElmChar
-                        #endif /*Check if 32 bit or 64 bit*/
-                    #else
-                        sizeof(long) * idBigNum->lenAllElmChar
-                    #endif
-            ); /*Rellocate memory for the array*/
 
-            if(idBigNum == 0)
+            if(arenaST != 0)
+                tmpAry =
+                    arenaRealloc(
+                        arenaST,
+                        idBigNum->bigNumAryIOrL,
+                          sizeof(*idBigNum->bigNumAryIOrL)
+                        * (idBigNum->lenAllElmChar - 1),
+                          sizeof(*idBigNum->bigNumAryIOrL)
+                        * idBigNum->lenAllElmChar
+                ); /*Grows in place (array is the last allocation)*/
+            else
+                tmpAry =
+                    realloc(
+                        idBigNum->bigNumAryIOrL,
+                          sizeof(*idBigNum->bigNumAryIOrL)
+                        * idBigNum->lenAllElmChar
+                ); /*Rellocate memory for the array*/
+
+            if(tmpAry == 0)
             { /*If memory allocation failed*/
-                free(idBigNum->bigNumAryIOrL);
-                free(idBigNum);
+                if(arenaST == 0)
+                { /*If not using an arena*/
+                    free(idBigNum->bigNumAryIOrL);
+                    free(idBigNum);
+                } /*If not using an arena*/
+
                 *lenBigNumChar = 0;
                 return 0; 
             } /*If memory allocation failed*/
+
+            idBigNum->bigNumAryIOrL = tmpAry;
         } /*If need to reallocate memory*/
 
         /*Graph unsigned long element working on*/
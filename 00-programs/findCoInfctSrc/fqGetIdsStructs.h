@@ -10,6 +10,7 @@
 #include <stdlib.h>
 #include <stdio.h>
 #include <stdint.h> /*for intx_t & uintx_t variables*/
+#include "fqGetIdsArena.h" /*Arena for readInfo/bigNum nodes*/
 
 /*Look up table to use in converting char to hext*/
 extern char hexTblCharAry[];
@@ -167,6 +168,9 @@ long cmpBigNums(
 |    Returns:
 |      - 0 if fails or end of file (lenIdULng < buffSizeInt)
 |      - pointer to struct with bigNum struct having converted read id
+|    Note:
+|      - If arenaST is not 0, the readInfo, bigNum, and bigNum array
+|        are from arenaST and are only freed with freeMemArena
 \---------------------------------------------------------------------*/
 struct readInfo * cnvtIdToBigNum(
     char *bufferCStr, /*buffer to hold fread input (can have data)*/
@@ -174,7 +178,8 @@ struct readInfo * cnvtIdToBigNum(
     char **endNameCStr, /*Points to start of id, will point to end*/
     uint64_t *lenInputULng,        /*Length of input from fread*/
     unsigned char *lenBigNumChar, /*Holds size to make bigNumber*/
-    FILE *idFILE          /*Fastq file to get data from*/
+    FILE *idFILE,         /*Fastq file to get data from*/
+    struct memArena *arenaST /*Arena for the nodes (0: malloc)*/
 ); /*Converts read id to bigNum read id, will grab new file input*/
 
 /*---------------------------------------------------------------------\
@@ -190,13 +195,15 @@ struct readInfo * cnvtIdToBigNum(
 |     o This will only read the buffer untile hte first invisible 
 |       character. It is up to you to ensure that you are on the next
 |       read id.
+|     o If arenaST is not 0, the bigNum is only freed with freeMemArena
 \---------------------------------------------------------------------*/
 struct bigNum * buffToBigNum(
     char *idCStr,  /*buffer to hold fread input (can have data)*/
     char **endCStr, /*Will point to end of read id*/
-    unsigned char *lenBigNumChar
+    unsigned char *lenBigNumChar,
         /*Holds starting size to make bigNumber. This will be updated
           each time I have to resize the array.*/
+    struct memArena *arenaST /*Arena for the bigNum (0: malloc)*/
 ); /*Converts read id in the input cString to bigNum read id. This 
     function will not grab new file input, so make sure your entire
     read id is in idCStr.*/
@@ -14,12 +14,26 @@
 #      - Do not use with stdin-fastq (will break)
 #    -fastq file.fastq:
 #      - Fastq file to filter reads from                     [Required]
+#      - Can be gzip compressed (.fastq.gz)
+#      - BGZF files (bgzip) are uncompressed by each thread
 #      -no-hash:
 #          - Use a tree search instead of hashing.           [Default: hashing]
 #              - Default search is hash combined with tree. 
 #          - Adds more time, but uses slightly less memory. 
+#      -prefilter:
+#          - Check a cuckoo filter of the read ids before
+#            the hash table or tree.                     [Default: only -v]
+#          - Faster when most reads are not in -f.
+#      -no-prefilter:
+#          - Do not use the cuckoo filter.
 #    -threads:                                               [2]
 #      - Number of threads to use
+#    -keep-order:
+#      - Print reads in the same order as the fastq file     [Default: not set]
+#      - Only changes the output when using 2+ threads
+#    -mmap:
+#      - Memory map the fastq file instead of reading it [Default: not set]
+#      - Kept reads are printed straight from the map
 #    -v:
 #      - Print reads not provided by -f                      [Default: not set]
 #    -V:
@@ -34,11 +48,11 @@
 #    fun-2: checkInput: check and process the user input (TO BE WRITTEN)
 <<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<*/
 
-#include "cStrToNumberFun.h"       /*Functions for number conversions*/
 #include "fqGetIdsSearchThread.h" /*Holds functions to do read extraction*/
     /*
       Includes:
           - "fqGetIdsFqFun.h"    # Functoions to read fastq file
+              - "cStrToNumberFun.h" # Number conversions (fqAndFaFun.h)
               - <stdio.h>            # FILE, fread, printf, & fprintf 
           - "fqGetIdsHash.h"        # functions to build my hash table
               - "fqGetIdsAVLTree.h" # functions to build AVL tree
@@ -48,6 +62,14 @@
                       - <stdio.h>   # fprintf
     */
 
+/*Size of the buffer each thread reads the fastq file with. Can be set
+` when compiling (-DdefLenFqBuff=97) to check reads that are split
+` across buffers.
+*/
+#ifndef defLenFqBuff
+    #define defLenFqBuff (1 << 17) /*Around 100kb*/
+#endif
+
 /*##############################################################################
 # Output:
 #    Returns: 0 if no errors, pointer to argumet errored on for errors
@@ -63,8 +85,11 @@ char * checkInput(int *lenArgsInt,        /*Number of arugments user input*/
                   char *stdinFastqChar,   /*1: stdin input for fastq*/
                   char *stdinFiltChar,    /*1: stdin input for filter*/
                   char *useHashChar,      /*Set to 0 if user wants tree search*/
-                  char *flipChar          /*1: print reads not in filtFileCStr
+                  char *flipChar,         /*1: print reads not in filtFileCStr
                                             0: print reads in filtFileCStr*/
+                  char *keepOrderChar,    /*1: print reads in input order*/
+                  char *mapChar,          /*1: memory map the fastq file*/
+                  char *prefilterChar     /*0: no, 1: yes, 2: only -v*/
 ); /*Checks user input & puts input into variables for later use*/
 
 int main(int lenArgsInt, char *argsCStr[])
@@ -84,7 +109,7 @@ int main(int lenArgsInt, char *argsCStr[])
     <<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<*/
 
     unsigned long
-        buffSizeULng = 1 << 17;  /*Around 100kb*/
+        buffSizeULng = defLenFqBuff;
 
     char
         *filtFileCStr = 0,    /*file to open*/
@@ -94,6 +119,9 @@ int main(int lenArgsInt, char *argsCStr[])
         stdinFiltChar = 0,    /*If 1 taking input from stdin*/
         printReverseChar = 0, /*Print sequences not in filter file*/
         useHashChar = 1,      /*Holds if user wanted hashing [1: use hash]*/
+        keepOrderChar = 0,    /*1: Print reads in input order*/
+        mapChar = 0,          /*1: Memory map the fastq file*/
+        prefilterChar = 2,    /*Cuckoo filter; 0: no, 1: yes, 2: if -v*/
         *inputChar = 0;       /*Holds arguemnt that had input error*/
 
     unsigned char sizeReadStackUChar = 200;
@@ -114,14 +142,26 @@ int main(int lenArgsInt, char *argsCStr[])
             \n      - Take filter file from stdin            [Default: not set]\
             \n    -fastq file.fastq:\
             \n      - Fastq file to filter reads from        [Required]\
+            \n      - Can be gzip compressed (.fastq.gz)\
             \n    -threads                                   [2]\
             \n      - Number of threads to use.\
+            \n    -keep-order:\
+            \n      - Print reads in the fastq files order   [Default: not set]\
+            \n    -mmap:\
+            \n      - Memory map the fastq file              [Default: not set]\
+            \n      - Kept reads are printed from the map (no copies)\
             \n    - out:\
             \n      - Name of file to output reads to        [stdout]\
             \n    -no-hash:\
             \n      - Use a tree search instead of hashing.  [Default: hashing]\
             \n          - Default search is hash combined with tree.\
             \n      - Adds more time, but uses slightly less memory.\
+            \n    -prefilter:\
+            \n      - Check a cuckoo filter of the read ids  [Default: only -v]\
+            \n        before the hash table or tree.\
+            \n      - Faster when most reads are not in -f.\
+            \n    -no-prefilter:\
+            \n      - Do not use the cuckoo filter.\
             \n    -v:\
             \n      - Print reads not provided by -f         [Default: not set]\
             \n    -V:\
@@ -143,7 +183,10 @@ int main(int lenArgsInt, char *argsCStr[])
                            &stdinFastqChar,
                            &stdinFiltChar,
                            &useHashChar,
-                           &printReverseChar
+                           &printReverseChar,
+                           &keepOrderChar,
+                           &mapChar,
+                           &prefilterChar
     ); /*Get the user input*/
 
     if(
@@ -286,6 +329,9 @@ int main(int lenArgsInt, char *argsCStr[])
     # Main Sec-6: Run function to extract reads by id and exit
     <<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<*/
 
+    if(prefilterChar == 2)
+        prefilterChar = printReverseChar; /*Most reads miss with -v*/
+
     if(
         fastqThreadExtract(
             filtFileCStr,  /*File with read targets to keep or ignore*/
@@ -295,7 +341,10 @@ int main(int lenArgsInt, char *argsCStr[])
             sizeReadStackUChar, /*Number of elements to use in stack*/
             buffSizeULng,       /*Size of buffer to read input with*/
             useHashChar,        /*Tells if doing search with hashing*/
-            printReverseChar /*Tells if extracting filter ids (1) or other (0)*/
+            printReverseChar,/*Tells if extracting filter ids (1) or other (0)*/
+            keepOrderChar,      /*1: Print reads in input order*/
+            mapChar,            /*1: Memory map the fastq file*/
+            prefilterChar       /*1: Check cuckoo filter first*/
         ) == 0
     ) { /*If fastq file was not a valid fastq file, issue a warning*/
         fprintf(
@@ -326,8 +375,11 @@ char * checkInput(int *lenArgsInt,        /*Number of arugments user input*/
                   char *stdinFastqChar,   /*1: stdin input for fastq*/
                   char *stdinFiltChar,    /*1: stdin input for filter*/
                   char *useHashChar,      /*Set to 0 if user wants tree search*/
-                  char *flipChar          /*1: print reads not in filtFileCStr
+                  char *flipChar,         /*1: print reads not in filtFileCStr
                                             0: print reads in filtFileCStr*/
+                  char *keepOrderChar,    /*1: print reads in input order*/
+                  char *mapChar,          /*1: memory map the fastq file*/
+                  char *prefilterChar     /*0: no, 1: yes, 2: only -v*/
 ) /*Checks user input & puts input into variables for later use*/
 { /*checkInput*/
     char *tmpCStr = 0, *singleArgCStr = 0;
@@ -358,6 +410,18 @@ char * checkInput(int *lenArgsInt,        /*Number of arugments user input*/
             intArg--;                  /*Account for incurment at end of loop*/
         } /*If user wants to do tree search instead*/
 
+        else if(strcmp(tmpCStr, "-prefilter") == 0)
+        { /*If user wants the cuckoo filter*/
+            *prefilterChar = 1;
+            intArg--;                  /*Account for incurment at end of loop*/
+        } /*If user wants the cuckoo filter*/
+
+        else if(strcmp(tmpCStr, "-no-prefilter") == 0)
+        { /*If user does not want the cuckoo filter*/
+            *prefilterChar = 0;
+            intArg--;                  /*Account for incurment at end of loop*/
+        } /*If user does not want the cuckoo filter*/
+
         else if(strcmp(tmpCStr, "-stdin-fastq") == 0)
         { /*If if taking input from stdin*/
             *stdinFastqChar = 1;
@@ -370,6 +434,18 @@ char * checkInput(int *lenArgsInt,        /*Number of arugments user input*/
             intArg--;                  /*Account for incurment at end of loop*/
         } /*If if taking input from stdin*/
 
+        else if(strcmp(tmpCStr, "-keep-order") == 0)
+        { /*If user wants the reads in input order*/
+            *keepOrderChar = 1;
+            intArg--;                  /*Account for incurment at end of loop*/
+        } /*If user wants the reads in input order*/
+
+        else if(strcmp(tmpCStr, "-mmap") == 0)
+        { /*If user wants to memory map the fastq file*/
+            *mapChar = 1;
+            intArg--;                  /*Account for incurment at end of loop*/
+        } /*If user wants to memory map the fastq file*/
+
         else if(strcmp(tmpCStr, "-v") == 0)
         { /*If if taking input from stdin*/
             *flipChar = 1;
@@ -395,6 +471,13 @@ char * checkInput(int *lenArgsInt,        /*Number of arugments user input*/
     while(*tmpCStr != '\0')
         tmpCStr++;            /*find the end of the file name*/
 
+    if(
+        tmpCStr - *fastqFileCStr > 3 &&
+        *(tmpCStr - 1) == 'z' &&
+        *(tmpCStr - 2) == 'g' &&
+        *(tmpCStr - 3) == '.'
+    ) tmpCStr -= 3;   /*Gzip compressed fastq files (.fastq.gz) are fine*/
+
     if(
         *(tmpCStr - 1) != 'q' ||
         *(tmpCStr - 2) != 't' ||
@@ -406,7 +489,7 @@ char * checkInput(int *lenArgsInt,        /*Number of arugments user input*/
     { /*If input is not a fastq file*/
         fprintf(
             stderr,
-            "%s is not a fastq file (should end in .fastq)\n",
+            "%s is not a fastq file (should end in .fastq(.gz))\n",
             *fastqFileCStr
         ); /*Warn user that provided fastq file is not a fastq file*/
 
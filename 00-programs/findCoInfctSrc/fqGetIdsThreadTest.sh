@@ -0,0 +1,154 @@
+#!/usr/bin/env bash
+
+########################################################################
+# Name: fqGetIdsThreadTest.sh
+# Use:
+#    Checks that fqGetIdsThread keeps the same reads as fqGetIds on a
+#    multi-line fastq file. The sequence and q-score entries are split
+#    over several lines and many q-score lines start with '@' or '+',
+#    so a thread that starts its section on a q-score line will be
+#    caught. Each read mode (plain, -keep-order, -mmap, and BGZF if
+#    bgzip is installed) is run with 1 to 8 threads.
+# Input:
+#    $1: Number of reads to make                          [20000]
+#    $2: Directory with fqGetIds and fqGetIdsThread       [.]
+#    $3: Name of the fqGetIdsThread program to check      [fqGetIdsThread]
+# Output:
+#    stdout: One line for each failed run and a pass/fail count
+#    Returns: 0 if all runs matched fqGetIds, else 1
+# Run:
+#    make testFqGetIdsThread (also checks a 97 byte read buffer) or
+#    make fqGetIds fqGetIdsThread && bash fqGetIdsThreadTest.sh
+########################################################################
+
+numReadsI="$1";
+progDirStr="$2";
+threadProgStr="$3";
+
+if [[ "$numReadsI" == "" ]]; then numReadsI=20000; fi
+if [[ "$progDirStr" == "" ]]; then progDirStr="."; fi
+if [[ "$threadProgStr" == "" ]]; then threadProgStr="fqGetIdsThread"; fi
+
+tmpDirStr="$(mktemp -d)";
+fqStr="$tmpDirStr/multiLine.fastq";
+idsStr="$tmpDirStr/ids.txt";
+expectStr="$tmpDirStr/expect.fastq";
+outStr="$tmpDirStr/out.fastq";
+
+numPassI=0;
+numFailI=0;
+
+trap 'rm -r "$tmpDirStr"' EXIT;
+
+#***********************************************************************
+# Sec-1: Make the multi-line fastq file and the read ids to keep
+#***********************************************************************
+
+# Lines are 60 bases long. Each q-score line starts with '@' or '+'
+# two thirds of the time, so a q-score line often looks like a header
+# or a spacer.
+awk \
+    -v numReadsI="$numReadsI" \
+    -v idsStr="$idsStr" \
+    'BEGIN{
+        srand(1);
+        baseStr = "ACGT";
+        qStr = "!#$%&()*,-./0123456789:;<=>?ABCDEFGHIJ";
+
+        for(readI = 0; readI < numReadsI; ++readI)
+        { # Loop: make each read
+            idStr = sprintf("%08x-aaaa-bbbb-cccc-%012x", readI, readI);
+            lenSeqI = 20 + int(rand() * 300);
+
+            if(readI % 3 == 0) print idStr > idsStr;
+            print "@" idStr " runid=1";
+
+            for(posI = 0; posI < lenSeqI; posI += 60)
+            { # Loop: print the sequence lines
+                lineStr = "";
+
+                for(baseI = posI; baseI < lenSeqI && baseI < posI+60; ++baseI)
+                    lineStr = lineStr substr(baseStr, 1 + int(rand()*4), 1);
+
+                print lineStr;
+            } # Loop: print the sequence lines
+
+            print "+";
+
+            for(posI = 0; posI < lenSeqI; posI += 60)
+            { # Loop: print the q-score lines
+                randF = rand();
+
+                if(randF < 0.33) lineStr = "@";
+                else if(randF < 0.66) lineStr = "+";
+                else lineStr = "I";
+
+                for(baseI = posI + 1; baseI < lenSeqI && baseI < posI+60; ++baseI)
+                    lineStr = lineStr substr(qStr, 1 + int(rand()*38), 1);
+
+                print lineStr;
+            } # Loop: print the q-score lines
+        } # Loop: make each read
+    }' > "$fqStr";
+
+"$progDirStr/fqGetIds" -f "$idsStr" -fastq "$fqStr" > "$expectStr";
+
+#***********************************************************************
+# Sec-2: Compare fqGetIdsThread to fqGetIds
+#***********************************************************************
+
+# Without -keep-order the reads can be in any order, so the sorted
+# lines are compared. -keep-order must match byte for byte.
+function checkRun(){
+    if [[ "$1" == "-keep-order" ]]; then
+        cmp -s "$expectStr" "$outStr";
+    else
+        cmp -s <(sort "$expectStr") <(sort "$outStr");
+    fi
+
+    if [[ $? -eq 0 ]]; then
+        numPassI=$((numPassI + 1));
+    else
+        numFailI=$((numFailI + 1));
+        printf "FAIL: %s (%s of %s bytes)\n" \
+            "$2" \
+            "$(wc -c < "$outStr")" \
+            "$(wc -c < "$expectStr")";
+    fi
+} # checkRun
+
+modeAryStr=("" "-keep-order" "-mmap" "-mmap -keep-order");
+
+if [[ "$(command -v bgzip)" != "" ]]; then
+    bgzip -c "$fqStr" > "$fqStr.gz";
+fi
+
+for threadsI in 1 2 3 4 5 6 7 8; do
+    for modeStr in "${modeAryStr[@]}"; do
+        # $modeStr is not quoted, so it splits into its flags
+        "$progDirStr/$threadProgStr" \
+            -f "$idsStr" \
+            -fastq "$fqStr" \
+            -threads "$threadsI" \
+            $modeStr \
+            > "$outStr" 2>/dev/null;
+
+        checkRun "$modeStr" "-threads $threadsI $modeStr";
+    done
+
+    if [[ -f "$fqStr.gz" ]]; then
+        "$progDirStr/$threadProgStr" \
+            -f "$idsStr" \
+            -fastq "$fqStr.gz" \
+            -threads "$threadsI" \
+            -keep-order \
+            > "$outStr" 2>/dev/null;
+
+        checkRun "-keep-order" "-threads $threadsI bgzf -keep-order";
+    fi
+done
+
+printf "%s passed, %s failed\n" "$numPassI" "$numFailI";
+
+if [[ "$numFailI" -gt 0 ]]; then exit 1; fi
+exit 0;
@@ -0,0 +1,1462 @@
+/*#########################################################
+# Name: interAln
+# Use:
+#  - Holds an inter-sequence vector Waterman Smith kernel
+#    (one query/reference pair per int16 lane) and a primer
+#    search that uses it to make paf files.
+# Libraries:
+#  - "interAln.h"
+#  - "interAlnKern.h" (included once per kernel)
+# C Standard Libraries:
+#  - <stdlib.h>
+#  - <string.h>
+#  - <immintrin.h> (x86 only)
+#  o <stdio.h>
+#  o <stdint.h>
+#########################################################*/
+
+#include "interAln.h"
+
+#include <stdlib.h>
+#include <string.h>
+
+/*~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~\
+' SOF: Start Of Functions
+'  o sec-01:
+'    - Build the kernels
+'  o fun-01 interSeqToMask:
+'    - Converts a sequence to 4 bit IUPAC masks
+'  o fun-02 interRevCompMask:
+'    - Reverse complements a sequence of 4 bit masks
+'  o fun-03 interMaxScore:
+'    - Finds the best possible score for a query
+'  o fun-04 interWaterScores:
+'    - Finds the best score and end of many pairs with the
+'      inter-sequence kernel
+'  o fun-05 interFindStart:
+'    - Finds the start of an alignment found by
+'      interWaterScores
+'  o fun-06 interReadLine:
+'    - Reads in one line from a file (no new line)
+'  o fun-07 interPrintHits:
+'    - Prints the paf lines for a batch of scored pairs
+'  o fun-08 interPrimerPaf:
+'    - Aligns every primer in a fasta file to every read in
+'      a fastq file and prints the hits as paf lines
+\~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~*/
+
+/*Scores used by the kernels (interAln.h)*/
+#define interMatchS ((int16_t) defInterMatch)
+#define interSnpS ((int16_t) defInterSnp)
+#define interExtendS ((int16_t) defInterGapExtend)
+
+#ifdef NOGAPOPEN
+   #define interOpenS ((int16_t) defInterGapExtend)
+#else
+   #define interOpenS ((int16_t) defInterGapOpen)
+#endif
+
+/*Kernel functions all have the same arguments*/
+typedef void (*interKernFun)(
+   int16_t *, int16_t *,
+   unsigned long, unsigned long,
+   int16_t *, int16_t *, int16_t *, int16_t *, int16_t *,
+   unsigned long *,
+   int16_t, int16_t, int16_t, int16_t
+);
+
+/*>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>\
+^ Sec-01:
+^  - Build the kernels
+^  o sec-01 sub-01:
+^    - Scalar kernel (no vector support)
+^  o sec-01 sub-02:
+^    - SSE2 kernel
+^  o sec-01 sub-03:
+^    - AVX2 kernel
+^  o sec-01 sub-04:
+^    - AVX512 kernel
+\<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<*/
+
+/*********************************************************\
+* Sec-01 Sub-01:
+*  - Scalar kernel (no vector support)
+\*********************************************************/
+
+/*The scores never go past defInterMaxScore, so a long
+` does not need to saturate
+*/
+#define kernName interScalarI16
+#define kernTarget
+#define vectT long
+#define defLanes 1
+#define vLoad(ptr) ((long) *(ptr))
+#define vStore(ptr, vect) (*(ptr) = (int16_t) (vect))
+#define vSet1(val) ((long) (val))
+#define vAdd(vect1, vect2) ((vect1) + (vect2))
+#define vMax(vect1, vect2) \
+   ((vect1) > (vect2) ? (vect1) : (vect2))
+#define vScore(qry, ref, matchVect, snpVect) \
+   ((qry) & (ref) ? (matchVect) : (snpVect))
+#define vGtSel(vect1, vect2, gtVect, leVect) \
+   ((vect1) > (vect2) ? (gtVect) : (leVect))
+#define vGtAny(vect1, vect2) ((vect1) > (vect2))
+#include "interAlnKern.h"
+
+#if defined __GNUC__ && (defined __x86_64__ || defined __i386__)
+   #define INTERX86
+
+   #include <immintrin.h>
+
+   /******************************************************\
+   * Sec-01 Sub-02:
+   *  - SSE2 kernel
+   \******************************************************/
+
+   #define kernName interSSE2I16
+   #define kernTarget __attribute__((target("sse2")))
+   #define vectT __m128i
+   #define defLanes 8
+   #define vLoad(ptr) _mm_loadu_si128((__m128i *) (ptr))
+   #define vStore(ptr, vect) \
+      _mm_storeu_si128((__m128i *) (ptr), (vect))
+   #define vSet1(val) _mm_set1_epi16(val)
+   #define vAdd(vect1, vect2) _mm_adds_epi16(vect1, vect2)
+   #define vMax(vect1, vect2) _mm_max_epi16(vect1, vect2)
+   #define vScore(qry, ref, matchVect, snpVect) \
+      _mm_or_si128( \
+         _mm_and_si128( \
+            _mm_cmpeq_epi16( \
+               _mm_and_si128(qry, ref), \
+               _mm_setzero_si128() \
+            ), \
+            snpVect \
+         ), \
+         _mm_andnot_si128( \
+            _mm_cmpeq_epi16( \
+               _mm_and_si128(qry, ref), \
+               _mm_setzero_si128() \
+            ), \
+            matchVect \
+         ) \
+      )
+   #define vGtSel(vect1, vect2, gtVect, leVect) \
+      _mm_or_si128( \
+         _mm_and_si128( \
+            _mm_cmpgt_epi16(vect1, vect2), \
+            gtVect \
+         ), \
+         _mm_andnot_si128( \
+            _mm_cmpgt_epi16(vect1, vect2), \
+            leVect \
+         ) \
+      )
+   #define vGtAny(vect1, vect2) \
+      _mm_movemask_epi8(_mm_cmpgt_epi16(vect1, vect2))
+   #include "interAlnKern.h"
+
+   /******************************************************\
+   * Sec-01 Sub-03:
+   *  - AVX2 kernel
+   \******************************************************/
+
+   #define kernName interAVX2I16
+   #define kernTarget __attribute__((target("avx2")))
+   #define vectT __m256i
+   #define defLanes 16
+   #define vLoad(ptr) _mm256_loadu_si256((__m256i *) (ptr))
+   #define vStore(ptr, vect) \
+      _mm256_storeu_si256((__m256i *) (ptr), (vect))
+   #define vSet1(val) _mm256_set1_epi16(val)
+   #define vAdd(vect1, vect2) \
+      _mm256_adds_epi16(vect1, vect2)
+   #define vMax(vect1, vect2) _mm256_max_epi16(vect1,vect2)
+   #define vScore(qry, ref, matchVect, snpVect) \
+      _mm256_blendv_epi8( \
+         matchVect, \
+         snpVect, \
+         _mm256_cmpeq_epi16( \
+            _mm256_and_si256(qry, ref), \
+            _mm256_setzero_si256() \
+         ) \
+      )
+   #define vGtSel(vect1, vect2, gtVect, leVect) \
+      _mm256_blendv_epi8( \
+         leVect, \
+         gtVect, \
+         _mm256_cmpgt_epi16(vect1, vect2) \
+      )
+   #define vGtAny(vect1, vect2) \
+      _mm256_movemask_epi8(_mm256_cmpgt_epi16(vect1,vect2))
+   #include "interAlnKern.h"
+
+   /******************************************************\
+   * Sec-01 Sub-04:
+   *  - AVX512 kernel
+   \******************************************************/
+
+   #define kernName interAVX512I16
+   #define kernTarget \
+      __attribute__((target("avx512f,avx512bw")))
+   #define vectT __m512i
+   #define defLanes 32
+   #define vLoad(ptr) _mm512_loadu_si512((void *) (ptr))
+   #define vStore(ptr, vect) \
+      _mm512_storeu_si512((void *) (ptr), (vect))
+   #define vSet1(val) _mm512_set1_epi16(val)
+   #define vAdd(vect1, vect2) \
+      _mm512_adds_epi16(vect1, vect2)
+   #define vMax(vect1, vect2) _mm512_max_epi16(vect1,vect2)
+   #define vScore(qry, ref, matchVect, snpVect) \
+      _mm512_mask_blend_epi16( \
+         _mm512_test_epi16_mask(qry, ref), \
+         snpVect, \
+         matchVect \
+      )
+   #define vGtSel(vect1, vect2, gtVect, leVect) \
+      _mm512_mask_blend_epi16( \
+         _mm512_cmpgt_epi16_mask(vect1, vect2), \
+         leVect, \
+         gtVect \
+      )
+   #define vGtAny(vect1, vect2) \
+      (_mm512_cmpgt_epi16_mask(vect1, vect2) != 0)
+   #include "interAlnKern.h"
+#endif /*If on an x86 cpu*/
+
+/*--------------------------------------------------------\
+| Output:
+|  - Modifies:
+|    o seqStr to have 4 bit IUPAC masks instead of bases.
+|      Anything that is not a base is set to 0 (never
+|      matches).
+\--------------------------------------------------------*/
+void interSeqToMask(
+   char *seqStr,         /*Sequence to convert*/
+   unsigned long lenSeqUL  /*Number of bases in seqStr*/
+){ /*interSeqToMask*/
+   unsigned long baseUL = 0;
+
+   for(baseUL = 0; baseUL < lenSeqUL; ++baseUL)
+   { /*Loop: convert each base*/
+      switch(seqStr[baseUL] & ~32) /*Remove lower case*/
+      { /*Switch: find the mask for the base*/
+         case 'A': seqStr[baseUL] = 1; break;
+         case 'C': seqStr[baseUL] = 2; break;
+         case 'G': seqStr[baseUL] = 4; break;
+         case 'T': seqStr[baseUL] = 8; break;
+         case 'U': seqStr[baseUL] = 8; break;
+         case 'M': seqStr[baseUL] = 1 | 2; break;
+         case 'R': seqStr[baseUL] = 1 | 4; break;
+         case 'W': seqStr[baseUL] = 1 | 8; break;
+         case 'S': seqStr[baseUL] = 2 | 4; break;
+         case 'Y': seqStr[baseUL] = 2 | 8; break;
+         case 'K': seqStr[baseUL] = 4 | 8; break;
+         case 'V': seqStr[baseUL] = 1 | 2 | 4; break;
+         case 'H': seqStr[baseUL] = 1 | 2 | 8; break;
+         case 'D': seqStr[baseUL] = 1 | 4 | 8; break;
+         case 'B': seqStr[baseUL] = 2 | 4 | 8; break;
+         case 'N': seqStr[baseUL] = 15; break;
+         case 'X': seqStr[baseUL] = 15; break;
+         default: seqStr[baseUL] = 0;
+      } /*Switch: find the mask for the base*/
+   } /*Loop: convert each base*/
+} /*interSeqToMask*/
+
+/*--------------------------------------------------------\
+| Output:
+|  - Modifies:
+|    o outStr to have the reverse complement of seqStr
+|      (both are 4 bit masks)
+\--------------------------------------------------------*/
+void interRevCompMask(
+   char *seqStr,          /*Masks to reverse complement*/
+   char *outStr,          /*Gets reverse complement*/
+   unsigned long lenSeqUL /*Number of bases in seqStr*/
+){ /*interRevCompMask*/
+   unsigned long baseUL = 0;
+   char maskC = 0;
+
+   for(baseUL = 0; baseUL < lenSeqUL; ++baseUL)
+   { /*Loop: reverse complement each base*/
+      maskC = seqStr[lenSeqUL - 1 - baseUL];
+
+      /*Swap A (1) with T (8) and C (2) with G (4)*/
+      outStr[baseUL] =
+           ((maskC & 1) << 3)
+         | ((maskC & 8) >> 3)
+         | ((maskC & 2) << 1)
+         | ((maskC & 4) >> 1);
+   } /*Loop: reverse complement each base*/
+} /*interRevCompMask*/
+
+/*--------------------------------------------------------\
+| Output:
+|  - Returns:
+|    o Score of a query that matches at every base
+\--------------------------------------------------------*/
+long interMaxScore(
+   unsigned long lenQryUL /*Length of the query*/
+){ /*interMaxScore*/
+   return (long) lenQryUL * (long) interMatchS;
+} /*interMaxScore*/
+
+/*--------------------------------------------------------\
+| Output:
+|  - Returns:
+|    o < 0 if pair 1 has the shorter reference
+|    o > 0 if pair 1 has the longer reference
+|    o 0 if both are the same length
+| Note:
+|  - This is the qsort comparison for interWaterScores.
+|    Each element is the reference length, the query
+|    length, and the pair index.
+\--------------------------------------------------------*/
+static int interCmpPairLen(
+   const void *pair1Ptr,
+   const void *pair2Ptr
+){ /*interCmpPairLen*/
+   const unsigned long *pair1Ary = pair1Ptr;
+   const unsigned long *pair2Ary = pair2Ptr;
+
+   if(pair1Ary[0] != pair2Ary[0])
+      return pair1Ary[0] < pair2Ary[0] ? -1 : 1;
+
+   if(pair1Ary[1] != pair2Ary[1])
+      return pair1Ary[1] < pair2Ary[1] ? -1 : 1;
+
+   return pair1Ary[2] < pair2Ary[2] ? -1 : 1;
+} /*interCmpPairLen*/
+
+/*--------------------------------------------------------\
+| Output:
+|  - Modifies:
+|    o hitAry to have the best score and end of each pair.
+|      The start coordinates are set to the end (use
+|      interFindStart to find the start).
+|  - Returns:
+|    o 0 for success
+|    o 2 if a query is to long for int16 scores (the best
+|      possible score is over defInterMaxScore)
+|    o 64 for memory errors
+\--------------------------------------------------------*/
+unsigned char interWaterScores(
+   char **qryAry,           /*Queries (interSeqToMask)*/
+   unsigned long *lenQryAry,/*Length of each query*/
+   char **refAry,           /*References (interSeqToMask)*/
+   unsigned long *lenRefAry,/*Length of each reference*/
+   unsigned long numPairsUL,/*Number of pairs to score*/
+   struct interHit *hitAry  /*Gets the score of each pair*/
+){ /*~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~\
+   ' Fun-04 TOC: interWaterScores
+   '  - Finds the best score and end of many pairs with the
+   '    inter-sequence kernel
+   '  o fun-04 sec-01:
+   '    - Variable declerations
+   '  o fun-04 sec-02:
+   '    - Pick the kernel and sort pairs by length
+   '  o fun-04 sec-03:
+   '    - Score each group of pairs
+   '  o fun-04 sec-04:
+   '    - Clean up
+   \~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~*/
+
+   /*>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>\
+   ^ Fun-04 Sec-01:
+   ^  - Variable declerations
+   \<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<*/
+
+   unsigned char errUC = 0;
+   unsigned int lanesUI = 1;  /*Pairs per kernel call*/
+   unsigned int laneUI = 0;
+   interKernFun kernFun = interScalarI16;
+
+   unsigned long pairUL = 0;
+   unsigned long firstUL = 0; /*First pair in the group*/
+   unsigned long indexUL = 0; /*Pair on (not sorted)*/
+   unsigned long posUL = 0;
+   unsigned long maxQryUL = 0;  /*Longest query in group*/
+   unsigned long maxRefUL = 0;  /*Longest ref in group*/
+   unsigned long lenQryMemUL = 0; /*Query positions held*/
+   unsigned long lenRefMemUL = 0; /*Ref positions held*/
+
+   /*Reference length, query length, and index of each pair
+   ` (sorted by length, so each group is about the same
+   ` size)
+   */
+   unsigned long *sortAry = 0;
+
+   int16_t *qryVAry = 0;   /*Queries by position, lane*/
+   int16_t *refVAry = 0;   /*References by position, lane*/
+   int16_t *hAry = 0;      /*Score column*/
+   int16_t *eAry = 0;      /*Reference gap column*/
+   int16_t *tmpPtr = 0;
+
+   /*Sized for the widest kernel (32 lanes)*/
+   int16_t scratchAry[64];
+   int16_t bestAry[32];
+   int16_t qryEndAry[32];
+   unsigned long refEndAry[32];
+
+   /*>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>\
+   ^ Fun-04 Sec-02:
+   ^  - Pick the kernel and sort pairs by length
+   \<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<*/
+
+   #ifdef INTERX86
+      __builtin_cpu_init();
+
+      if(__builtin_cpu_supports("avx512bw"))
+      { /*If the cpu has AVX512BW*/
+         kernFun = interAVX512I16;
+         lanesUI = 32;
+      } /*If the cpu has AVX512BW*/
+
+      else if(__builtin_cpu_supports("avx2"))
+      { /*Else if the cpu has AVX2*/
+         kernFun = interAVX2I16;
+         lanesUI = 16;
+      } /*Else if the cpu has AVX2*/
+
+      else if(__builtin_cpu_supports("sse2"))
+      { /*Else if the cpu has SSE2*/
+         kernFun = interSSE2I16;
+         lanesUI = 8;
+      } /*Else if the cpu has SSE2*/
+   #endif
+
+   if(numPairsUL == 0) return 0;
+
+   sortAry = malloc(3 * numPairsUL * sizeof(unsigned long));
+   if(sortAry == 0) return 64;
+
+   for(pairUL = 0; pairUL < numPairsUL; ++pairUL)
+   { /*Loop: set up the sort array*/
+      if(interMaxScore(lenQryAry[pairUL]) > defInterMaxScore)
+      { /*If the query could overflow the int16 scores*/
+         free(sortAry);
+         return 2;
+      } /*If the query could overflow the int16 scores*/
+
+      sortAry[pairUL * 3] = lenRefAry[pairUL];
+      sortAry[pairUL * 3 + 1] = lenQryAry[pairUL];
+      sortAry[pairUL * 3 + 2] = pairUL;
+   } /*Loop: set up the sort array*/
+
+   qsort(
+      sortAry,
+      numPairsUL,
+      3 * sizeof(unsigned long),
+      interCmpPairLen
+   );
+
+   /*>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>\
+   ^ Fun-04 Sec-03:
+   ^  - Score each group of pairs
+   ^  o fun-04 sec-03 sub-01:
+   ^    - Find the group size and get memory
+   ^  o fun-04 sec-03 sub-02:
+   ^    - Copy the sequences into the lanes
+   ^  o fun-04 sec-03 sub-03:
+   ^    - Run the kernel and save the scores
+   \<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<*/
+
+   for(firstUL = 0; firstUL < numPairsUL; firstUL += lanesUI)
+   { /*Loop: through each group of pairs*/
+
+      /***************************************************\
+      * Fun-04 Sec-03 Sub-01:
+      *  - Find the group size and get memory
+      \***************************************************/
+
+      maxQryUL = 0;
+      maxRefUL = 0;
+
+      for(laneUI = 0; laneUI < lanesUI; ++laneUI)
+      { /*Loop: find the longest query and reference*/
+         if(firstUL + laneUI >= numPairsUL) break;
+
+         indexUL = sortAry[(firstUL + laneUI) * 3 + 2];
+
+         if(lenQryAry[indexUL] > maxQryUL)
+            maxQryUL = lenQryAry[indexUL];
+
+         if(lenRefAry[indexUL] > maxRefUL)
+            maxRefUL = lenRefAry[indexUL];
+      } /*Loop: find the longest query and reference*/
+
+      if(maxQryUL > lenQryMemUL)
+      { /*If need more memory for the queries*/
+         lenQryMemUL = maxQryUL;
+         tmpPtr =
+            realloc(
+               qryVAry,
+               3 * lenQryMemUL * lanesUI * sizeof(int16_t)
+            );
+
+         if(tmpPtr == 0)
+         { /*If had a memory error*/
+            errUC = 64;
+            goto cleanUp;
+         } /*If had a memory error*/
+
+         qryVAry = tmpPtr;
+         hAry = qryVAry + lenQryMemUL * lanesUI;
+         eAry = hAry + lenQryMemUL * lanesUI;
+      } /*If need more memory for the queries*/
+
+      if(maxRefUL > lenRefMemUL)
+      { /*If need more memory for the references*/
+         lenRefMemUL = maxRefUL;
+         tmpPtr =
+            realloc(
+               refVAry,
+               lenRefMemUL * lanesUI * sizeof(int16_t)
+            );
+
+         if(tmpPtr == 0)
+         { /*If had a memory error*/
+            errUC = 64;
+            goto cleanUp;
+         } /*If had a memory error*/
+
+         refVAry = tmpPtr;
+      } /*If need more memory for the references*/
+
+      /***************************************************\
+      * Fun-04 Sec-03 Sub-02:
+      *  - Copy the sequences into the lanes
+      \***************************************************/
+
+      for(laneUI = 0; laneUI < lanesUI; ++laneUI)
+      { /*Loop: copy each pair into its lane*/
+         if(firstUL + laneUI < numPairsUL)
+         { /*If this lane has a pair*/
+            indexUL = sortAry[(firstUL + laneUI) * 3 + 2];
+
+            for(posUL = 0; posUL < maxQryUL; ++posUL)
+               qryVAry[posUL * lanesUI + laneUI] =
+                  posUL < lenQryAry[indexUL]
+                     ? (int16_t) qryAry[indexUL][posUL]
+                     : 0;
+
+            for(posUL = 0; posUL < maxRefUL; ++posUL)
+               refVAry[posUL * lanesUI + laneUI] =
+                  posUL < lenRefAry[indexUL]
+                     ? (int16_t) refAry[indexUL][posUL]
+                     : 0;
+         } /*If this lane has a pair*/
+
+         else
+         { /*Else this lane is empty (last group)*/
+            for(posUL = 0; posUL < maxQryUL; ++posUL)
+               qryVAry[posUL * lanesUI + laneUI] = 0;
+
+            for(posUL = 0; posUL < maxRefUL; ++posUL)
+               refVAry[posUL * lanesUI + laneUI] = 0;
+         } /*Else this lane is empty (last group)*/
+      } /*Loop: copy each pair into its lane*/
+
+      /***************************************************\
+      * Fun-04 Sec-03 Sub-03:
+      *  - Run the kernel and save the scores
+      \***************************************************/
+
+      kernFun(
+         qryVAry,
+         refVAry,
+         maxQryUL,
+         maxRefUL,
+         hAry,
+         eAry,
+         scratchAry,
+         bestAry,
+         qryEndAry,
+         refEndAry,
+         interMatchS,
+         interSnpS,
+         interOpenS,
+         interExtendS
+      );
+
+      for(laneUI = 0; laneUI < lanesUI; ++laneUI)
+      { /*Loop: save the score for each pair*/
+         if(firstUL + laneUI >= numPairsUL) break;
+
+         indexUL = sortAry[(firstUL + laneUI) * 3 + 2];
+
+         hitAry[indexUL].scoreL = bestAry[laneUI];
+         hitAry[indexUL].qryEndUL =
+            (unsigned long) qryEndAry[laneUI];
+         hitAry[indexUL].refEndUL = refEndAry[laneUI];
+         hitAry[indexUL].qryStartUL = hitAry[indexUL].qryEndUL;
+         hitAry[indexUL].refStartUL = hitAry[indexUL].refEndUL;
+      } /*Loop: save the score for each pair*/
+   } /*Loop: through each group of pairs*/
+
+   /*>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>\
+   ^ Fun-04 Sec-04:
+   ^  - Clean up
+   \<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<*/
+
+   cleanUp:
+
+   free(sortAry);
+   free(qryVAry);
+   free(refVAry);
+
+   return errUC;
+} /*interWaterScores*/
+
+/*--------------------------------------------------------\
+| Output:
+|  - Modifies:
+|    o refStartUL and qryStartUL in hitST to be the start
+|      of the alignment ending at refEndUL and qryEndUL
+|  - Returns:
+|    o 0 for success
+|    o 64 for memory errors
+\--------------------------------------------------------*/
+unsigned char interFindStart(
+   char *qryStr,           /*Query (interSeqToMask)*/
+   char *refStr,           /*Reference (interSeqToMask)*/
+   struct interHit *hitST  /*Hit from interWaterScores*/
+){ /*~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~\
+   ' Fun-05 TOC: interFindStart
+   '  - Finds the start of an alignment found by
+   '    interWaterScores
+   '  o fun-05 sec-01:
+   '    - Variable declerations
+   '  o fun-05 sec-02:
+   '    - Set up the reverse window
+   '  o fun-05 sec-03:
+   '    - Align backwards from the end till the score is
+   '      found
+   \~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~*/
+
+   /*>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>\
+   ^ Fun-05 Sec-01:
+   ^  - Variable declerations
+   \<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<*/
+
+   unsigned long lenQryUL = hitST->qryEndUL + 1;
+   unsigned long lenRefUL = hitST->refEndUL + 1;
+   unsigned long rowUL = 0;  /*Query base on (reversed)*/
+   unsigned long colUL = 0;  /*Ref base on (reversed)*/
+
+   long openL = (long) interOpenS;
+   long extendL = (long) interExtendS;
+   long hL = 0;        /*Score of the current cell*/
+   long hDiagL = 0;    /*Score of the diagonal cell*/
+   long fL = 0;        /*Reference gap (from the left)*/
+
+   long *hRowAry = 0;  /*Scores for the last row*/
+   long *eRowAry = 0;  /*Query gaps (from above)*/
+
+   /*>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>\
+   ^ Fun-05 Sec-02:
+   ^  - Set up the reverse window
+   \<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<*/
+
+   if(hitST->scoreL <= 0) return 0;
+
+   /*Each reference base past the query length needs a gap,
+   ` so the alignment can not span more reference bases
+   ` than the best score can pay for
+   */
+   if(extendL < 0)
+   { /*If gaps have a penalty*/
+      colUL =
+           lenQryUL
+         + (unsigned long) (hitST->scoreL / -extendL)
+         + 1;
+
+      if(colUL < lenRefUL) lenRefUL = colUL;
+   } /*If gaps have a penalty*/
+
+   hRowAry = malloc(2 * (lenRefUL + 1) * sizeof(long));
+   if(hRowAry == 0) return 64;
+   eRowAry = hRowAry + lenRefUL + 1;
+
+   /*The alignment is anchored at the end, so the gap row
+   ` is not floored at 0 like a normal Waterman
+   */
+   hRowAry[0] = 0;
+
+   for(colUL = 1; colUL <= lenRefUL; ++colUL)
+   { /*Loop: set up the gap row*/
+      hRowAry[colUL] = openL + extendL * (long) (colUL - 1);
+      eRowAry[colUL] = hRowAry[colUL] + openL;
+   } /*Loop: set up the gap row*/
+
+   /*>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>\
+   ^ Fun-05 Sec-03:
+   ^  - Align backwards from the end till the score is
+   ^    found
+   \<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<*/
+
+   for(rowUL = 1; rowUL <= lenQryUL; ++rowUL)
+   { /*Loop: through each query base (backwards)*/
+      hDiagL = hRowAry[0];
+      hRowAry[0] = openL + extendL * (long) (rowUL - 1);
+      fL = hRowAry[0] + openL;
+
+      for(colUL = 1; colUL <= lenRefUL; ++colUL)
+      { /*Loop: through each reference base (backwards)*/
+         eRowAry[colUL] =
+            (hRowAry[colUL] + openL > eRowAry[colUL] + extendL)
+               ? hRowAry[colUL] + openL
+               : eRowAry[colUL] + extendL;
+
+         hL = hDiagL;
+
+         if(
+              qryStr[lenQryUL - rowUL]
+            & refStr[hitST->refEndUL + 1 - colUL]
+         ) hL += interMatchS;
+         else hL += interSnpS;
+
+         if(eRowAry[colUL] > hL) hL = eRowAry[colUL];
+         if(fL > hL) hL = fL;
+
+         hDiagL = hRowAry[colUL];
+         hRowAry[colUL] = hL;
+
+         fL =
+            (hL + openL > fL + extendL)
+               ? hL + openL
+               : fL + extendL;
+
+         if(hL == hitST->scoreL)
+         { /*If found the start of the alignment*/
+            hitST->qryStartUL = lenQryUL - rowUL;
+            hitST->refStartUL = hitST->refEndUL + 1 - colUL;
+            free(hRowAry);
+            return 0;
+         } /*If found the start of the alignment*/
+      } /*Loop: through each reference base (backwards)*/
+   } /*Loop: through each query base (backwards)*/
+
+   /*Should not happen, but use the widest window*/
+   hitST->qryStartUL = 0;
+   hitST->refStartUL = hitST->refEndUL + 1 - lenRefUL;
+   free(hRowAry);
+   return 0;
+} /*interFindStart*/
+
+/*--------------------------------------------------------\
+| Output:
+|  - Modifies:
+|    o buffStr to have the next line (no new line). This
+|      is resized when it is to small.
+|    o lenBuffUL to have the new buffer size
+|  - Returns:
+|    o Length of the line
+|    o -1 if at the end of the file
+|    o -2 for memory errors
+\--------------------------------------------------------*/
+static long interReadLine(
+   FILE *inFILE,             /*File to read from*/
+   char **buffStr,           /*Buffer to read into*/
+   unsigned long *lenBuffUL  /*Size of buffStr*/
+){ /*interReadLine*/
+   unsigned long lenLineUL = 0;
+   char *tmpStr = 0;
+
+   if(*buffStr == 0)
+   { /*If need to make the buffer*/
+      *lenBuffUL = 1024;
+      *buffStr = malloc(*lenBuffUL);
+      if(*buffStr == 0) return -2;
+   } /*If need to make the buffer*/
+
+   while(
+      fgets(
+         *buffStr + lenLineUL,
+         (int) (*lenBuffUL - lenLineUL),
+         inFILE
+      )
+   ){ /*Loop: read till the end of the line*/
+      lenLineUL += strlen(*buffStr + lenLineUL);
+
+      if((*buffStr)[lenLineUL - 1] == '\n') break;
+
+      if(lenLineUL + 1 < *lenBuffUL) break; /*End of file*/
+
+      tmpStr = realloc(*buffStr, *lenBuffUL << 1);
+      if(tmpStr == 0) return -2;
+
+      *buffStr = tmpStr;
+      *lenBuffUL <<= 1;
+   } /*Loop: read till the end of the line*/
+
+   if(lenLineUL == 0) return -1;
+
+   while(
+         lenLineUL > 0
+      && (   (*buffStr)[lenLineUL - 1] == '\n'
+          || (*buffStr)[lenLineUL - 1] == '\r')
+   ) --lenLineUL;
+
+   (*buffStr)[lenLineUL] = '\0';
+   return (long) lenLineUL;
+} /*interReadLine*/
+
+/*--------------------------------------------------------\
+| Output:
+|  - Prints:
+|    o A paf line for every pair in the batch that scored
+|      at least minPercUC of the primers best score
+|  - Returns:
+|    o 0 for success
+|    o 64 for memory errors
+| Note:
+|  - Each pair is described by four numbers in pairAry:
+|    the read, the primer, the strand (0 forward, 1 reverse
+|    complement), and the first read base in the window
+\--------------------------------------------------------*/
+static unsigned char interPrintHits(
+   unsigned long *pairAry,   /*read, primer, strand, start*/
+   char **qryAry,            /*Primer of each pair*/
+   unsigned long *lenQryAry, /*Primer length of each pair*/
+   char **refAry,            /*Read window of each pair*/
+   struct interHit *hitAry,  /*Scores from the kernel*/
+   unsigned long numPairsUL, /*Number of pairs*/
+   char *readIdStr,          /*Read ids ('\0' separated)*/
+   unsigned long *readIdAry, /*Start of each read id*/
+   unsigned long *lenReadAry,/*Length of each read*/
+   char **primIdAry,         /*Primer ids*/
+   unsigned char minPercUC,  /*Min percent of max score*/
+   FILE *outFILE             /*File to print to*/
+){ /*interPrintHits*/
+   unsigned long pairUL = 0;
+   unsigned long readUL = 0;
+   unsigned long lenPrimUL = 0;
+   unsigned long primStartUL = 0;
+   unsigned long primEndUL = 0;
+   unsigned long lenAlnUL = 0;
+   unsigned long matchUL = 0;
+   struct interHit *hitST = 0;
+
+   for(pairUL = 0; pairUL < numPairsUL; ++pairUL)
+   { /*Loop: through all pairs*/
+      hitST = &hitAry[pairUL];
+      lenPrimUL = lenQryAry[pairUL];
+
+      if(hitST->scoreL <= 0) continue;
+
+      if(
+           hitST->scoreL * 100
+         < interMaxScore(lenPrimUL) * (long) minPercUC
+      ) continue; /*Score is to low*/
+
+      if(interFindStart(qryAry[pairUL], refAry[pairUL], hitST))
+         return 64;
+
+      readUL = pairAry[pairUL * 4];
+
+      if(pairAry[pairUL * 4 + 2])
+      { /*If the primer was reverse complemented*/
+         primStartUL = lenPrimUL - 1 - hitST->qryEndUL;
+         primEndUL = lenPrimUL - hitST->qryStartUL;
+      } /*If the primer was reverse complemented*/
+
+      else
+      { /*Else the primer is forward*/
+         primStartUL = hitST->qryStartUL;
+         primEndUL = hitST->qryEndUL + 1;
+      } /*Else the primer is forward*/
+
+      lenAlnUL = hitST->refEndUL - hitST->refStartUL + 1;
+
+      if(primEndUL - primStartUL > lenAlnUL)
+         lenAlnUL = primEndUL - primStartUL;
+
+      /*There is no traceback, so the matches are estimated
+      ` from the score (as if there were no gaps)
+      */
+      matchUL =
+           (unsigned long)
+              (hitST->scoreL - interSnpS * (long) lenAlnUL)
+         / (unsigned long) (interMatchS - interSnpS);
+
+      if(matchUL > lenAlnUL) matchUL = lenAlnUL;
+
+      fprintf(
+         outFILE,
+         "%s\t%lu\t%lu\t%lu\t%c\t%s\t%lu\t%lu\t%lu\t%lu\t%lu",
+         readIdStr + readIdAry[readUL],
+         lenReadAry[readUL],
+         pairAry[pairUL * 4 + 3] + hitST->refStartUL,
+         pairAry[pairUL * 4 + 3] + hitST->refEndUL + 1,
+         pairAry[pairUL * 4 + 2] ? '-' : '+',
+         primIdAry[pairAry[pairUL * 4 + 1]],
+         lenPrimUL,
+         primStartUL,
+         primEndUL,
+         matchUL,
+         lenAlnUL
+      );
+
+      fprintf(outFILE, "\t255\tAS:i:%li\n", hitST->scoreL);
+   } /*Loop: through all pairs*/
+
+   return 0;
+} /*interPrintHits*/
+
+/*--------------------------------------------------------\
+| Output:
+|  - Prints:
+|    o One paf line (read is the query, primer is the
+|      target) to outFILE for every primer (and primer
+|      reverse complement) that hit a read. Lines for a
+|      read are printed together, like minimap2 does.
+|  - Returns:
+|    o 0 for success
+|    o 2 if the primer file could not be opened or had no
+|      primers
+|    o 4 if the fastq file could not be opened or was not
+|      a fastq file
+|    o 64 for memory errors
+\--------------------------------------------------------*/
+unsigned char interPrimerPaf(
+   char *primFaStr,       /*Fasta file with primers*/
+   char *fqStr,           /*Fastq file with reads*/
+   unsigned long endLenUL,
+      /*0: search the whole read; else search only the
+      `    first and last endLenUL bases of each read
+      */
+   unsigned char minPercUC, /*Min percent of max score*/
+   FILE *outFILE          /*File to print paf lines to*/
+){ /*~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~\
+   ' Fun-08 TOC: interPrimerPaf
+   '  - Aligns every primer in a fasta file to every read
+   '    in a fastq file and prints the hits as paf lines
+   '  o fun-08 sec-01:
+   '    - Variable declerations
+   '  o fun-08 sec-02:
+   '    - Read in the primers
+   '  o fun-08 sec-03:
+   '    - Read in reads and score them in batches
+   '  o fun-08 sec-04:
+   '    - Clean up
+   \~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~*/
+
+   /*>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>\
+   ^ Fun-08 Sec-01:
+   ^  - Variable declerations
+   \<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<*/
+
+   unsigned char errUC = 0;
+   long lenLineL = 0;
+   unsigned long lenBuffUL = 0;
+   char *buffStr = 0;
+   char *tmpStr = 0;
+   void *tmpPtr = 0;
+
+   /*Primers; the reverse complement of primer x is at
+   ` primSeqAry[x + numPrimUL]
+   */
+   unsigned long numPrimUL = 0;
+   unsigned long sizePrimUL = 0;
+   unsigned long primUL = 0;
+   unsigned long numRevUL = 0; /*Reverse complements made*/
+   char **primIdAry = 0;
+   char **primSeqAry = 0;
+   unsigned long *lenPrimAry = 0;
+
+   /*Reads in the batch. The ids and sequences are kept in
+   ` one buffer each, so the batch only needs a few
+   ` allocations.
+   */
+   unsigned long numReadUL = 0;
+   unsigned long sizeReadUL = 0;
+   unsigned long readUL = 0;
+   unsigned long lenReadUL = 0;
+   unsigned long lenQualUL = 0;
+   char *readIdStr = 0;        /*Read ids ('\0' separated)*/
+   unsigned long lenIdUL = 0;  /*Bytes used in readIdStr*/
+   unsigned long sizeIdUL = 0;
+   char *readSeqStr = 0;       /*Read sequences*/
+   unsigned long lenSeqUL = 0; /*Bytes used in readSeqStr*/
+   unsigned long sizeSeqUL = 0;
+   unsigned long *readIdAry = 0;  /*Start of each id*/
+   unsigned long *readSeqAry = 0; /*Start of each read*/
+   unsigned long *lenReadAry = 0; /*Length of each read*/
+
+   /*Pairs in the batch*/
+   unsigned long numPairsUL = 0;
+   unsigned long sizePairsUL = 0;
+   unsigned long pairUL = 0;
+   unsigned long winUL = 0;
+   unsigned long numWinUL = 0;
+   unsigned long winStartAry[2];
+   unsigned long *pairAry = 0;  /*read, primer, strand, start*/
+   char **qryAry = 0;
+   char **refAry = 0;
+   unsigned long *lenQryAry = 0;
+   unsigned long *lenRefAry = 0;
+   struct interHit *hitAry = 0;
+
+   FILE *inFILE = 0;
+
+   /*>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>\
+   ^ Fun-08 Sec-02:
+   ^  - Read in the primers
+   \<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<*/
+
+   inFILE = fopen(primFaStr, "r");
+   if(inFILE == 0) return 2;
+
+   while((lenLineL = interReadLine(inFILE,&buffStr,&lenBuffUL)))
+   { /*Loop: read in the primers*/
+      if(lenLineL == -2) goto memErr;
+      if(lenLineL == -1) break;
+      if(lenLineL == 0) continue;
+
+      if(buffStr[0] == '>')
+      { /*If this is a new primer*/
+         if(numPrimUL >= sizePrimUL)
+         { /*If need more room for primers*/
+            sizePrimUL = (sizePrimUL << 1) + 8;
+
+            tmpPtr =
+               realloc(primIdAry, sizePrimUL*sizeof(char *));
+            if(tmpPtr == 0) goto memErr;
+            primIdAry = tmpPtr;
+
+            tmpPtr =
+               realloc(
+                  primSeqAry,
+                  2 * sizePrimUL * sizeof(char *)
+               );
+            if(tmpPtr == 0) goto memErr;
+            primSeqAry = tmpPtr;
+
+            tmpPtr =
+               realloc(
+                  lenPrimAry,
+                  sizePrimUL * sizeof(unsigned long)
+               );
+            if(tmpPtr == 0) goto memErr;
+            lenPrimAry = tmpPtr;
+         } /*If need more room for primers*/
+
+         /*The id ends at the first white space*/
+         tmpStr = buffStr + 1;
+         while(*tmpStr > 32) ++tmpStr;
+         *tmpStr = '\0';
+
+         primIdAry[numPrimUL] = malloc(tmpStr - buffStr);
+         if(primIdAry[numPrimUL] == 0) goto memErr;
+         strcpy(primIdAry[numPrimUL], buffStr + 1);
+
+         primSeqAry[numPrimUL] = 0;
+         lenPrimAry[numPrimUL] = 0;
+         ++numPrimUL;
+         continue;
+      } /*If this is a new primer*/
+
+      if(numPrimUL == 0) continue; /*Sequence before id*/
+
+      primUL = numPrimUL - 1;
+
+      tmpPtr =
+         realloc(
+            primSeqAry[primUL],
+            lenPrimAry[primUL] + (unsigned long) lenLineL
+         );
+      if(tmpPtr == 0) goto memErr;
+      primSeqAry[primUL] = tmpPtr;
+
+      memcpy(
+         primSeqAry[primUL] + lenPrimAry[primUL],
+         buffStr,
+         (unsigned long) lenLineL
+      );
+
+      lenPrimAry[primUL] += (unsigned long) lenLineL;
+   } /*Loop: read in the primers*/
+
+   fclose(inFILE);
+   inFILE = 0;
+
+   if(numPrimUL == 0)
+   { /*If there were no primers*/
+      errUC = 2;
+      goto cleanUp;
+   } /*If there were no primers*/
+
+   /*The reverse complements go after the forward primers
+   ` (primSeqAry was made with room for them)
+   */
+   for(primUL = 0; primUL < numPrimUL; ++primUL)
+   { /*Loop: convert primers and reverse complement*/
+      if(primSeqAry[primUL] == 0)
+      { /*If the primer had no sequence*/
+         errUC = 2;
+         goto cleanUp;
+      } /*If the primer had no sequence*/
+
+      interSeqToMask(primSeqAry[primUL], lenPrimAry[primUL]);
+
+      primSeqAry[primUL + numPrimUL] =
+         malloc(lenPrimAry[primUL]);
+
+      if(primSeqAry[primUL + numPrimUL] == 0) goto memErr;
+      ++numRevUL;
+
+      interRevCompMask(
+         primSeqAry[primUL],
+         primSeqAry[primUL + numPrimUL],
+         lenPrimAry[primUL]
+      );
+   } /*Loop: convert primers and reverse complement*/
+
+   /*>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>\
+   ^ Fun-08 Sec-03:
+   ^  - Read in reads and score them in batches
+   ^  o fun-08 sec-03 sub-01:
+   ^    - Read in the header and sequence
+   ^  o fun-08 sec-03 sub-02:
+   ^    - Skip the q-score lines
+   ^  o fun-08 sec-03 sub-03:
+   ^    - Add the pairs for this read
+   ^  o fun-08 sec-03 sub-04:
+   ^    - Score and print a full batch
+   \<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<*/
+
+   inFILE = fopen(fqStr, "r");
+
+   if(inFILE == 0)
+   { /*If could not open the fastq file*/
+      errUC = 4;
+      goto cleanUp;
+   } /*If could not open the fastq file*/
+
+   lenLineL = 0;
+
+   while(lenLineL != -1)
+   { /*Loop: read in the reads*/
+
+      /***************************************************\
+      * Fun-08 Sec-03 Sub-01:
+      *  - Read in the header and sequence
+      \***************************************************/
+
+      lenLineL = interReadLine(inFILE, &buffStr, &lenBuffUL);
+
+      if(lenLineL == -2) goto memErr;
+      if(lenLineL == 0) continue; /*Blank line*/
+
+      if(lenLineL > 0)
+      { /*If have another read*/
+         if(buffStr[0] != '@')
+         { /*If this is not a fastq file*/
+            errUC = 4;
+            goto cleanUp;
+         } /*If this is not a fastq file*/
+
+         if(numReadUL >= sizeReadUL)
+         { /*If need more room for reads*/
+            sizeReadUL = (sizeReadUL << 1) + 64;
+
+            tmpPtr =
+               realloc(
+                  readIdAry,
+                  sizeReadUL * sizeof(unsigned long)
+               );
+            if(tmpPtr == 0) goto memErr;
+            readIdAry = tmpPtr;
+
+            tmpPtr =
+               realloc(
+                  readSeqAry,
+                  sizeReadUL * sizeof(unsigned long)
+               );
+            if(tmpPtr == 0) goto memErr;
+            readSeqAry = tmpPtr;
+
+            tmpPtr =
+               realloc(
+                  lenReadAry,
+                  sizeReadUL * sizeof(unsigned long)
+               );
+            if(tmpPtr == 0) goto memErr;
+            lenReadAry = tmpPtr;
+         } /*If need more room for reads*/
+
+         tmpStr = buffStr + 1;
+         while(*tmpStr > 32) ++tmpStr;
+         *tmpStr = '\0';
+
+         if(lenIdUL + (tmpStr - buffStr) > sizeIdUL)
+         { /*If need more room for read ids*/
+            sizeIdUL =
+               (sizeIdUL << 1) + (tmpStr - buffStr) + 1024;
+            tmpPtr = realloc(readIdStr, sizeIdUL);
+            if(tmpPtr == 0) goto memErr;
+            readIdStr = tmpPtr;
+         } /*If need more room for read ids*/
+
+         readIdAry[numReadUL] = lenIdUL;
+         strcpy(readIdStr + lenIdUL, buffStr + 1);
+         lenIdUL += tmpStr - buffStr;
+
+         readSeqAry[numReadUL] = lenSeqUL;
+         lenReadUL = 0;
+
+         while(1)
+         { /*Loop: read in the sequence lines*/
+            lenLineL =
+               interReadLine(inFILE, &buffStr, &lenBuffUL);
+
+            if(lenLineL == -2) goto memErr;
+
+            if(lenLineL == -1 || buffStr[0] == '+') break;
+
+            if(lenSeqUL + (unsigned long) lenLineL > sizeSeqUL)
+            { /*If need more room for sequences*/
+               sizeSeqUL =
+                    (sizeSeqUL << 1)
+                  + (unsigned long) lenLineL
+                  + 4096;
+               tmpPtr = realloc(readSeqStr, sizeSeqUL);
+               if(tmpPtr == 0) goto memErr;
+               readSeqStr = tmpPtr;
+            } /*If need more room for sequences*/
+
+            memcpy(
+               readSeqStr + lenSeqUL,
+               buffStr,
+               (unsigned long) lenLineL
+            );
+
+            lenSeqUL += (unsigned long) lenLineL;
+            lenReadUL += (unsigned long) lenLineL;
+         } /*Loop: read in the sequence lines*/
+
+         if(lenLineL == -1)
+         { /*If the file ended before the q-score line*/
+            errUC = 4;
+            goto cleanUp;
+         } /*If the file ended before the q-score line*/
+
+         /************************************************\
+         * Fun-08 Sec-03 Sub-02:
+         *  - Skip the q-score lines
+         \************************************************/
+
+         lenQualUL = 0;
+
+         while(lenQualUL < lenReadUL)
+         { /*Loop: read in the q-score lines*/
+            lenLineL =
+               interReadLine(inFILE, &buffStr, &lenBuffUL);
+
+            if(lenLineL == -2) goto memErr;
+
+            if(lenLineL == -1)
+            { /*If the file ended in the q-score line*/
+               errUC = 4;
+               goto cleanUp;
+            } /*If the file ended in the q-score line*/
+
+            lenQualUL += (unsigned long) lenLineL;
+         } /*Loop: read in the q-score lines*/
+
+         lenLineL = 0; /*Not at the end of the file*/
+
+         interSeqToMask(
+            readSeqStr + readSeqAry[numReadUL],
+            lenReadUL
+         );
+
+         lenReadAry[numReadUL] = lenReadUL;
+
+         /************************************************\
+         * Fun-08 Sec-03 Sub-03:
+         *  - Add the pairs for this read
+         \************************************************/
+
+         /*Short reads are searched as one window, so a hit
+         ` is not printed twice
+         */
+         winStartAry[0] = 0;
+         numWinUL = 1;
+
+         if(endLenUL > 0 && lenReadUL > (endLenUL << 1))
+         { /*If only searching the read ends*/
+            winStartAry[1] = lenReadUL - endLenUL;
+            numWinUL = 2;
+         } /*If only searching the read ends*/
+
+         if(
+              numPairsUL + (numWinUL * numPrimUL << 1)
+            > sizePairsUL
+         ){ /*If need more room for pairs*/
+            sizePairsUL =
+                 (sizePairsUL << 1)
+               + (numWinUL * numPrimUL << 1)
+               + defInterBatchPairs;
+
+            tmpPtr =
+               realloc(
+                  pairAry,
+                  4 * sizePairsUL * sizeof(unsigned long)
+               );
+            if(tmpPtr == 0) goto memErr;
+            pairAry = tmpPtr;
+         } /*If need more room for pairs*/
+
+         for(winUL = 0; winUL < numWinUL; ++winUL)
+         { /*Loop: through each read window*/
+            for(primUL = 0; primUL < (numPrimUL << 1); ++primUL)
+            { /*Loop: through each primer and strand*/
+               pairAry[numPairsUL * 4] = numReadUL;
+               pairAry[numPairsUL * 4 + 1] = primUL % numPrimUL;
+               pairAry[numPairsUL * 4 + 2] = primUL >= numPrimUL;
+               pairAry[numPairsUL * 4 + 3] = winStartAry[winUL];
+               ++numPairsUL;
+            } /*Loop: through each primer and strand*/
+         } /*Loop: through each read window*/
+
+         ++numReadUL;
+
+         if(numPairsUL < defInterBatchPairs) continue;
+      } /*If have another read*/
+
+      /***************************************************\
+      * Fun-08 Sec-03 Sub-04:
+      *  - Score and print a full batch
+      \***************************************************/
+
+      if(numPairsUL == 0) continue; /*At end of file*/
+
+      tmpPtr =
+         realloc(
+            qryAry,
+            2 * numPairsUL * sizeof(char *)
+         );
+      if(tmpPtr == 0) goto memErr;
+      qryAry = tmpPtr;
+      refAry = qryAry + numPairsUL;
+
+      tmpPtr =
+         realloc(
+            lenQryAry,
+            2 * numPairsUL * sizeof(unsigned long)
+         );
+      if(tmpPtr == 0) goto memErr;
+      lenQryAry = tmpPtr;
+      lenRefAry = lenQryAry + numPairsUL;
+
+      tmpPtr =
+         realloc(hitAry, numPairsUL * sizeof(struct interHit));
+      if(tmpPtr == 0) goto memErr;
+      hitAry = tmpPtr;
+
+      for(pairUL = 0; pairUL < numPairsUL; ++pairUL)
+      { /*Loop: point each pair to its sequences*/
+         readUL = pairAry[pairUL * 4];
+         primUL = pairAry[pairUL * 4 + 1];
+
+         qryAry[pairUL] =
+            primSeqAry[
+               primUL + numPrimUL * pairAry[pairUL * 4 + 2]
+            ];
+         lenQryAry[pairUL] = lenPrimAry[primUL];
+
+         refAry[pairUL] =
+              readSeqStr
+            + readSeqAry[readUL]
+            + pairAry[pairUL * 4 + 3];
+
+         lenRefAry[pairUL] = lenReadAry[readUL];
+
+         if(endLenUL > 0 && lenRefAry[pairUL] > (endLenUL << 1))
+            lenRefAry[pairUL] = endLenUL;
+      } /*Loop: point each pair to its sequences*/
+
+      errUC =
+         interWaterScores(
+            qryAry,
+            lenQryAry,
+            refAry,
+            lenRefAry,
+            numPairsUL,
+            hitAry
+         );
+
+      if(errUC == 64) goto memErr;
+
+      if(errUC)
+      { /*If a primer was to long*/
+         errUC = 2;
+         goto cleanUp;
+      } /*If a primer was to long*/
+
+      errUC =
+         interPrintHits(
+            pairAry,
+            qryAry,
+            lenQryAry,
+            refAry,
+            hitAry,
+            numPairsUL,
+            readIdStr,
+            readIdAry,
+            lenReadAry,
+            primIdAry,
+            minPercUC,
+            outFILE
+         );
+
+      if(errUC) goto memErr;
+
+      numPairsUL = 0;
+      numReadUL = 0;
+      lenIdUL = 0;
+      lenSeqUL = 0;
+   } /*Loop: read in the reads*/
+
+   /*>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>\
+   ^ Fun-08 Sec-04:
+   ^  - Clean up
+   \<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<*/
+
+   errUC = 0;
+   goto cleanUp;
+
+   memErr:
+   errUC = 64;
+
+   cleanUp:
+
+   if(inFILE != 0) fclose(inFILE);
+
+   for(primUL = 0; primUL < numPrimUL; ++primUL)
+   { /*Loop: free the primers*/
+      free(primIdAry[primUL]);
+      free(primSeqAry[primUL]);
+   } /*Loop: free the primers*/
+
+   for(primUL = 0; primUL < numRevUL; ++primUL)
+      free(primSeqAry[primUL + numPrimUL]);
+
+   free(buffStr);
+   free(primIdAry);
+   free(primSeqAry);
+   free(lenPrimAry);
+   free(readIdStr);
+   free(readSeqStr);
+   free(readIdAry);
+   free(readSeqAry);
+   free(lenReadAry);
+   free(pairAry);
+   free(qryAry);
+   free(lenQryAry);
+   free(hitAry);
+
+   return errUC;
+} /*interPrimerPaf*/
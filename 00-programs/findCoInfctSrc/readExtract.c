@@ -53,8 +53,8 @@ uint8_t extractBestRead(
     \<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<*/
 
     char
-        *tmpFqCStr ="tmp-202301110827-reads-09876543211234567890.fastq",
-        *tmpStatCStr ="tmp-202301110827-stats-09876543211234567890.tsv",
+        tmpFqCStr[300],   /*Temporary fastq file (named after bin)*/
+        tmpStatCStr[300], /*Temporary stats file (named after bin)*/
         *tmpCStr = 0;
 
     int8_t ignoreC = 0;
@@ -93,6 +93,24 @@ uint8_t extractBestRead(
         "--best-read.fastq"
     ); /*Add in the best read ending*/
 
+    /*The temporary files are named after the bin, so bins can be
+      clustered at the same time*/
+    tmpCStr = cStrCpInvsDelm(tmpFqCStr, binIn->fqPathCStr);
+
+    /*Get to end of .fastq or .fq*/
+    if(*(tmpCStr - 2) == 't') tmpCStr -= 6; /*.fastq*/
+    else tmpCStr -= 3;                      /*.fq*/
+
+    cStrCpInvsDelm(tmpCStr, "--tmp.fastq");
+
+    tmpCStr = cStrCpInvsDelm(tmpStatCStr, binIn->fqPathCStr);
+
+    /*Get to end of .fastq or .fq*/
+    if(*(tmpCStr - 2) == 't') tmpCStr -= 6; /*.fastq*/
+    else tmpCStr -= 3;                      /*.fq*/
+
+    cStrCpInvsDelm(tmpCStr, "--tmp-stats.tsv");
+
     /*>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>
     ^ Fun-1 Sec-3: Check if can open fastq file & stats file           v
     <<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<*/
@@ -219,6 +237,32 @@ uint8_t extractBestRead(
     ^ Fun-1 Sec-7: Extract the best read                               v
     \<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<*/
 
+    if(binIn->fqIdxBl & 1)
+    { /*If can move the best read out with the fastq index*/
+        outFILE = fopen(binIn->bestReadCStr, "w");
+
+        if(outFILE == 0)
+            return 32;
+
+        /*Also updates the index, so the next round does not rescan*/
+        errUC =
+            fqIndexMvRead(
+                bestRead.queryIdCStr,
+                binIn->fqPathCStr,
+                outFILE
+        );
+
+        fclose(outFILE);
+
+        if(errUC & 1)
+        { /*If moved the best read*/
+            --binIn->numReadsULng;
+            return 1;
+        } /*If moved the best read*/
+
+        /*Else the read was not found, so scan the fastq file*/
+    } /*If can move the best read out with the fastq index*/
+
     /*Open the fastq file (already check if could open)*/
     inFILE = fopen(binIn->fqPathCStr, "r");
 
@@ -477,6 +521,7 @@ uint8_t fqOneIdExtract(
 |     - 4: if could not read reference
 |     - 8: if could not open the fastq file
 |     - 16: if minimap2 errored out or returned nothing
+|     - 64: memory error (only when using the fastq index)
 | Note:
 |     - Score: percMult * (keptSNPs + keptIns + keptDels) / read length
 |     - minSimUSht ranges from 1 (0.01%) to precMult (100%)            
@@ -506,9 +551,9 @@ uint8_t findBestXReads(
    \\    fun-3 sec-4: Trim, score, & select best mapped reads         /
    //    fun-3 sec-5: Set up the best x read file name                \
    \\    fun-3 sec-6: Set up hash table to extract reads              /
-   //    fun-3 sec-7: Extract reads with fastq greps hash extract     \
-   \\    fun-3 sec-8: Clean up                                        /
-   //                                                                  \
+   //    fun-3 sec-7: Extract reads with the fastq index (if using)   \
+   \\    fun-3 sec-8: Extract reads with fastq greps hash extract     /
+   //    fun-3 sec-9: Clean up                                        \
    \\~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~*/
 
     /*>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>\
@@ -523,9 +568,8 @@ uint8_t findBestXReads(
     unsigned char lenStackUC = 128;
     unsigned char lenBigNum = 0;
 
-    char minimapCmdCStr[2048];
     char *tmpCStr = 0;
-    char buffCStr[lenBuffUInt];  /*Buffer to extract reads with*/
+    char buffCStr[lenBuffUInt + 1];  /*Buffer to extract reads with*/
 
     int32_t lenIdUInt = 100;/*number of characters allowed for read id*/
 
@@ -548,7 +592,12 @@ uint8_t findBestXReads(
 
     FILE *testFILE = 0;
     FILE *bestReadsFILE = 0;  /*Holds the read to polish with*/
-    FILE *stdinFILE = 0;
+    FILE *stdinFILE = 0;      /*Fastq file (no reference)*/
+    uint8_t pipeBl = 0;       /*1: fastq file is gzip compressed*/
+    struct samMapper mapST;   /*Maps reads to the best read (minimap2)*/
+
+    struct fqIndex *idxST = 0;    /*Read id index of the fastq file*/
+    unsigned long numPrintedUL = 0;
 
     /*>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>
     # Fun-3 Sec-2: Check if can open files and copy reference
@@ -599,34 +648,33 @@ uint8_t findBestXReads(
 
     if(!(noRefBl & 1))
     { /*If using a reference*/
-        /*Build the command to run minimap2*/
-        tmpCStr = cStrCpInvsDelm(minimapCmdCStr, minimap2CMD);
-        tmpCStr = cpParmAndArg(tmpCStr, "-t", threadsCStr);
-        tmpCStr =
-           cpParmAndArg(
-               tmpCStr,
+        /*Map the reads to the best read*/
+        errUC =
+           openSamMapper(
                binTree->bestReadCStr,
-               binTree->fqPathCStr
-        ); /*Finsh off the minimap2 command*/
-        
-        /*Run minimap2 results*/
-        stdinFILE = popen(minimapCmdCStr, "r");
+               binTree->fqPathCStr,
+               threadsCStr,
+               &mapST
+        ); /*Start minimap2*/
+
+        if(!(errUC & 1))
+            return 16;
 
         blankSamEntry(samST); /*Make sure start with blank*/
 
         /*Read in a single sam file line to check if valid (header)*/
-        errUC = readSamLine(samST, stdinFILE);
+        errUC = readSamMapper(samST, &mapST);
 
         if(!(errUC & 1))
         { /*If an error occured*/
-            pclose(stdinFILE);
+            closeSamMapper(&mapST);
             return 16;
         } /*If an error occured*/
     } /*If using a reference*/
 
     else
     { /*Else just using the fastq file*/
-        stdinFILE = fopen(binTree->fqPathCStr, "r");
+        stdinFILE = openFastqFile(binTree->fqPathCStr, &pipeBl);
         errUC = readRefFqSeq(stdinFILE, samST, 0);
     } /*Else just using the fastq file*/
 
@@ -659,14 +707,14 @@ uint8_t findBestXReads(
             if(*samST->samEntryCStr == '@')
             { /*If was a header*/
                 blankSamEntry(samST); /*Make sure start with blank*/
-                errUC = readSamLine(samST,stdinFILE);
+                errUC = readSamMapper(samST, &mapST);
                 continue; /*Is a header line, move to next line in file*/
             } /*If was a header*/
 
             if(samST->flagUSht & (2048 | 256 | 4))
             { /*If was a suplemental, secondary, or unmapped alignment*/
                 blankSamEntry(samST); /*Make sure start with blank*/
-                errUC = readSamLine(samST,stdinFILE);
+                errUC = readSamMapper(samST, &mapST);
                 continue; /*Is a header line, move to next line*/
             } /*If was a suplemental, secondary, or unmapped alignment*/
 
@@ -676,7 +724,7 @@ uint8_t findBestXReads(
             if(errUC >> 2)
             { /*If entry did not have a sequence, discard*/
                 blankSamEntry(samST); /*Make sure start with blank*/
-                errUC = readSamLine(samST, stdinFILE);
+                errUC = readSamMapper(samST, &mapST);
                 continue;
             } /*If entry did not have a sequence, discard*/
         } /*If using minimap2 input*/
@@ -707,7 +755,7 @@ uint8_t findBestXReads(
             ) { /*If the read Is to different from the reference*/
                 /*Move to the next entry*/
                 blankSamEntry(samST); /*Make sure start with blank*/
-                errUC = readSamLine(samST,stdinFILE);
+                errUC = readSamMapper(samST, &mapST);
                 continue;
             } /*If the read Is to different from the reference*/
         } /*If readning from minimap2*/
@@ -764,7 +812,7 @@ uint8_t findBestXReads(
         { /*If still accepting new reads*/
             readOn = makeBlankReadInfoStruct();
             readOn->idBigNum =
-               buffToBigNum(samST->queryCStr, &tmpCStr, &lenBigNum);
+               buffToBigNum(samST->queryCStr, &tmpCStr, &lenBigNum, 0);
                /*read id, pointer to id end, Number ints in big number*/
 
             /*Check if new lowest score*/
@@ -820,13 +868,13 @@ uint8_t findBestXReads(
         } /*Else if only keeping better reads*/
 
         /*Move to the next read*/
-        if(!(noRefBl & 1)) errUC = readSamLine(samST,stdinFILE);
+        if(!(noRefBl & 1)) errUC = readSamMapper(samST, &mapST);
         else errUC = readRefFqSeq(stdinFILE, samST, 0);
     } /*While their is a samfile entry to read in*/
 
     /*check which file close method I need to use*/
-    if(!(errUC & 1)) pclose(stdinFILE);
-    else             fclose(stdinFILE);
+    if(!(noRefBl & 1)) closeSamMapper(&mapST); /*minimap2 output*/
+    else closeFastqFile(stdinFILE, pipeBl);
 
     stdinFILE = 0;
 
@@ -873,6 +921,47 @@ uint8_t findBestXReads(
        } /*If I do not have a blank read*/
     } /*For all kept reads, set built the list for the hash table*/
 
+    /*>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>\
+    ^ Fun-3 Sec-7: Extract reads with the fastq index (if using)      v
+    \<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<*/
+
+    /*The index is only rebuilt when the fastq changes, so the rounds
+    ` after the first are a binary search and a pread per read
+    */
+    if(binTree->fqIdxBl & 1)
+        idxST = getFqIndex(binTree->fqPathCStr);
+
+    if(idxST != 0)
+    { /*If extracting reads with the index*/
+        if(binTree->topReadsCStr[0] != '\0')
+            bestReadsFILE = fopen(binTree->topReadsCStr, "w");
+        else
+            bestReadsFILE = stdout;
+
+        errUC =
+            fqIndexExtract(
+                idxST,
+                binTree->fqPathCStr,
+                readOn,          /*List of reads to extract*/
+                bestReadsFILE,
+                &numPrintedUL
+        ); /*Extract the reads with the index*/
+
+        freeFqIndex(&idxST);
+        fclose(bestReadsFILE);
+
+        while(readOn != 0)
+        { /*While have kept reads to free*/
+            tmpRead = readOn->rightChild;
+            freeReadInfoStruct(&readOn);
+            readOn = tmpRead;
+        } /*While have kept reads to free*/
+
+        if(errUC & 64) return 64;
+        if(!(errUC & 1)) return 8;
+        return 1;
+    } /*If extracting reads with the index*/
+
     hashTbl = 
         readListToHash(
             readOn,
@@ -884,11 +973,11 @@ uint8_t findBestXReads(
     ); /*Build the hash table*/
 
     /*>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>\
-    ^ Fun-3 Sec-7: Extract reads with fastq greps hash extract        v
+    ^ Fun-3 Sec-8: Extract reads with fastq greps hash extract        v
     \<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<*/
 
     /*Open fastq file and file to store the best reads in*/
-    testFILE = fopen(binTree->fqPathCStr, "r");
+    testFILE = openFastqFile(binTree->fqPathCStr, &pipeBl);
 
     if(binTree->topReadsCStr[0] != '\0')
         bestReadsFILE = fopen(binTree->topReadsCStr, "w");
@@ -906,16 +995,17 @@ uint8_t findBestXReads(
         digPerKeyUChar, /*Power of two hash size is at*/
         &zeroUChar,      /*Print the matches*/
         tmpRead,
-        hashTbl
+        hashTbl,
+        0               /*No cuckoo prefilter*/
     );
 
     /*>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>\
-    ^ Fun-3 Sec-8: Clean up
+    ^ Fun-3 Sec-9: Clean up
     \<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<*/
 
     freeHashTbl(&hashTbl, &hashSizeULng, searchStack);
 
-    fclose(testFILE);
+    closeFastqFile(testFILE, pipeBl);
     fclose(bestReadsFILE);
 
     return 1;
@@ -955,7 +1045,7 @@ uint8_t fqGetBestReadByMedQ(
 
     uint8_t errUC = 0;
     uint8_t flagUC = 0;
-    char *tmpFqCStr = "20232102-tmp10435y205y2034914701712097134.fastq";
+    char tmpFqCStr[300]; /*Temporary fastq file (named after bin)*/
     char *tmpCStr = 0;
     struct samEntry *swapStruct = 0;
 
@@ -972,6 +1062,15 @@ uint8_t fqGetBestReadByMedQ(
     if(fqFILE == 0)
         return 4;
 
+    /*Named after the bin, so bins can be clustered at the same time*/
+    tmpCStr = cStrCpInvsDelm(tmpFqCStr, clustOn->fqPathCStr);
+
+    /*Get to end of .fastq or .fq*/
+    if(*(tmpCStr - 2) == 't') tmpCStr -= 6; /*.fastq*/
+    else tmpCStr -= 3;                      /*.fq*/
+
+    cStrCpInvsDelm(tmpCStr, "--tmp.fastq");
+
     tmpFqFILE = fopen(tmpFqCStr, "w");
 
     if(tmpFqFILE == 0)
@@ -35,6 +35,11 @@
 #            o <stdlib.h>
 #            o <stdio.h>
 #            o <stdint.h>
+#   o fqGetIdsIndex
+#     - "fqGetIdsFqFun.h"
+#   o findCoInftSamMap
+#     - "samEntryStruct.h"
+#     - "cStrFun.h"
 ######################################################################*/
 
 #ifndef READEXTRACT_H
@@ -46,6 +51,8 @@
 #include "fqAndFaFun.h"        /*Fastq and fasta functions*/
 #include "findCoInftBinTree.h" /*for readBin struct*/
 #include "fqGetIdsSearchFq.h"  /*For extracting reads by id*/
+#include "fqGetIdsIndex.h"     /*Read id index for repeat extractions*/
+#include "findCoInftSamMap.h"  /*Maps reads with minimap2*/
 #include "dataTypeShortHand.h"
 
 /*---------------------------------------------------------------------\
@@ -94,6 +101,7 @@ uint8_t fqOneIdExtract(
 |     - 4: if could not read reference
 |     - 8: if could not open the fastq file
 |     - 16: if minimap2 errored out or returned nothing
+|     - 64: memory error (only when using the fastq index)
 | Note:
 |     - Score: percMult * (keptSNPs + keptIns + keptDels) / read length
 |     - minSimUSht ranges from 1 (0.01%) to precMult (100%)            
@@ -12,12 +12,16 @@
 #      o Takes lonber, but uses slightly (~10%) less memory. 
 #    -end-trim:
 #      o Only trim of the primers at the ends
+#    -inter-aln:
+#      o Find primers with the alnSeq vector aligner instead
+#        of minimap2
 #    -v:
 #      o Print version & exit
 # Output:
 #    stdout: prints out the trimmed reads to stdout
 # Includes:
 #   - "trimPrimersSeach.h"
+#   o "interAln.h"
 #   o "trimPrimersHash.h"
 #   o "fqGetIdsHash.h"
 #   o "trimPrimersAVLTree.h"
@@ -61,7 +65,8 @@ char * checkInput(
     char **outFileCStr,   /*Will hold path of output file*/
     char *styleC,         /*Holds if trimming end primers*/
     char *hashBl,    /*Set to 0 if user wants tree search*/
-    char *threadsCStr /*Number of threads to use with minimap2*/
+    char *threadsCStr, /*Number of threads to use with minimap2*/
+    char *interAlnBl /*Set to 1 to find primers with interAln*/
 ); /*~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~\
    | Fun-1 TOC: Sec-1 Sub-1: checkInput
    |  - Checks user input & puts input into variables for later use
@@ -88,6 +93,7 @@ int main(int lenArgsInt, char *argsCStr[])
     char *fqFileCStr = 0;  /*file to open*/
     char *outFileCStr = 0; /*file to write to*/
     char hashBl = 1;       /*Holds if user wanted hashing [1: use hash]*/
+    char interAlnBl = 0;   /*1: Use interAln instead of minimap2*/
     char *inputChar = 0;   /*Holds arguemnt that had input error*/
     char threadsCStr[128]; /*Holds number of threads to use*/
     char styleC = 0;
@@ -114,6 +120,12 @@ int main(int lenArgsInt, char *argsCStr[])
         \n     o Fastq file to filter reads from\
         \n   -end-trim:                                      [No]\
         \n     o Only trim primers off ends of each read.\
+        \n   -inter-aln:                                     [No]\
+        \n     o Find the primers with the alnSeq vector\
+        \n       aligner instead of minimap2. Each vector\
+        \n       lane aligns a different primer/read pair.\
+        \n     o With -end-trim only the first and last 200\
+        \n       bases of each read are searched.\
         \n   -no-hash:                                       [Hashing]\
         \n     o Do search with only the AVL tree (no hashing)\
         \n     o Takes lonber, but uses slightly (~10%) less memory.\
@@ -140,7 +152,8 @@ int main(int lenArgsInt, char *argsCStr[])
                            &outFileCStr,
                            &styleC,
                            &hashBl,
-                           threadsCStr
+                           threadsCStr,
+                           &interAlnBl
     ); /*Get the user input*/
 
     if(inputChar != 0)
@@ -299,7 +312,8 @@ int main(int lenArgsInt, char *argsCStr[])
           outFileCStr,
           styleC,
           threadsCStr,
-          hashBl
+          hashBl,
+          interAlnBl
     );
 
     if(errUC & 64)
@@ -332,7 +346,8 @@ char * checkInput(
     char **outFileCStr,   /*Will hold path of output file*/
     char *styleC,         /*Holds if trimming end primers*/
     char *hashBl,    /*Set to 0 if user wants tree search*/
-    char *threadsCStr /*Number of threads to use with minimap2*/
+    char *threadsCStr, /*Number of threads to use with minimap2*/
+    char *interAlnBl /*Set to 1 to find primers with interAln*/
 ){ /*~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~\
    | Fun-1 TOC: Sec-1 Sub-1: checkInput
    |  - Checks user input & puts input into variables for later use
@@ -376,6 +391,12 @@ char * checkInput(
         else if(strcmp(tmpCStr, "-threads") == 0)
             strcpy(threadsCStr, singleArgCStr);
 
+        else if(strcmp(tmpCStr, "-inter-aln") == 0)
+        { /*If finding primers without minimap2*/
+            *interAlnBl = 1;
+            --intArg;
+        } /*If finding primers without minimap2*/
+
         else if(strcmp(tmpCStr, "-no-hash") == 0)
         { /*If user wants to do tree search instead*/
             *hashBl = 0;
@@ -59,6 +59,8 @@
 |       memory in hashTbl & readTree (both set to 0)
 |     o Variables in hashST to hold the readPrim list (readTree) and 
 |       length of the readPrim list (hashVarST.numIdsUL)
+|     o hashST->arenaST to hold the list nodes (0 if the arena could
+|       not be made, then each node is malloced)
 \---------------------------------------------------------------------*/
 unsigned char makeReadPrimList(
     char *primFaFileCStr,     /*Path to fasta file with primers*/
@@ -133,6 +135,11 @@ unsigned char makeReadPrimList(
 
    else stdinFILE = pafFILE;
 
+   /*The readPrim, bigNum, and primCord nodes are freed as a few
+   ` blocks. If the arena can not be made (memory) arenaST is 0
+   ` and each node is malloced*/
+   hashST->arenaST = makeMemArena();
+
    /*>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>\
    ^ Fun-1 Sec-4: Get read ids in file & convert to readPrim list
    ^   o sec-4 sub-1: Convert read id to a big number
@@ -155,7 +162,8 @@ unsigned char makeReadPrimList(
    while(fgets(buffCStr, lenBuffUS, stdinFILE))
     { /*While ids to read in*/
        /*Convert read id to big number*/
-       bigNumST = buffToBigNum(buffCStr, &tmpCStr, &maxHexChar);
+       bigNumST =
+           buffToBigNum(buffCStr, &tmpCStr, &maxHexChar, hashST->arenaST);
            /*maxHexChar will hold the number of limbs needed to hold
                largest big number read in.
              tmpCStr will point to the end of the read id*/
@@ -174,7 +182,8 @@ unsigned char makeReadPrimList(
        \***************************************************************/
 
        /*Read in the primer coordinates*/
-       primCordST = makePrimCord();/*Make stucture to hold coordinates*/
+       /*Make stucture to hold coordinates*/
+       primCordST = makePrimCord(hashST->arenaST);
 
        ++tmpCStr; /*Get off the tab after the read id*/
 
@@ -199,7 +208,9 @@ unsigned char makeReadPrimList(
           cmpBigNums(bigNumST, hashST->readTree->idBigNum) == 0
        ) { /*If it is another entry for the same id*/
            insPrimCordST(primCordST, &hashST->readTree->primCordST);
-           freeBigNumStruct(&bigNumST); /*No longer need*/
+
+           /*No longer need (arena ids are freed with the arena)*/
+           if(hashST->arenaST == 0) freeBigNumStruct(&bigNumST);
        } /*If it is another entry for the same id*/
 
        else
@@ -213,14 +224,17 @@ unsigned char makeReadPrimList(
            ++(hashST->hashVarST.numIdsUL);
 
            /*Make a new readPrim structer to add to the list*/
-           readPrimST = makeReadPrimST();
+           readPrimST = makeReadPrimST(hashST->arenaST);
 
            /*Memory allcoation error, need to free stuff*/
            if(readPrimST == 0)
            { /*If have to free structers*/
                /*Free structures and close files*/
-               freePrimCordST(&primCordST);
-               freeBigNumStruct(&bigNumST);
+               if(hashST->arenaST == 0)
+               { /*If the structures are not in the arena*/
+                   freePrimCordST(&primCordST);
+                   freeBigNumStruct(&bigNumST);
+               } /*If the structures are not in the arena*/
 
                if(pafFILE == 0) pclose(stdinFILE);
 
@@ -480,6 +494,7 @@ void freeReadPrimHashTblOrTree(
 |     o majicNumUL to hold the majic number for the hash
 |     o lenHashUL to be 0
 |     o lenLog2HashUC to be 0
+|     o arenaST to be 0
 \---------------------------------------------------------------------*/
 void initReadPrimHashST(
     struct readPrimHash *hashST /*Structer to initialize*/
@@ -491,6 +506,7 @@ void initReadPrimHashST(
    initHashTblVarST(&hashST->hashVarST);
    hashST->readTree = 0;
    hashST->hashTbl = 0;
+   hashST->arenaST = 0;
 
    /*Make sure start & end of my stacks are marked*/
    hashST->readStack[0].readNode = 0;
@@ -506,6 +522,8 @@ void initReadPrimHashST(
 |  o This functions assumes that the hash table is on the heap.
 |  o If the hash table is not on the heap, then you will need to free
 |    things manually
+|  o If hashST->arenaST is not 0, the nodes are freed with the arena
+|    (hashElmOnHeapBl is ignored)
 \---------------------------------------------------------------------*/
 void freeReadPrimHashST(
     char stOnHeapBl,              /*1: is on heap; 0 on stack*/
@@ -519,7 +537,13 @@ void freeReadPrimHashST(
 
    unsigned long numElmInTblUL = 0;
 
-   if(hashElmOnHeapBl & 1)
+   if(hashST->arenaST != 0)
+   { /*If the nodes are in an arena*/
+       free(hashST->hashTbl); /*0 if using the AVL tree*/
+       freeMemArena(&hashST->arenaST);
+   } /*If the nodes are in an arena*/
+
+   else if(hashElmOnHeapBl & 1)
        freeReadPrimHashTblOrTree(hashST); /*Free the hash table/tree*/
    else
    { /*Else only the hash table (not the nodes) are on the heap*/
@@ -82,6 +82,8 @@ typedef struct readPrimHash
     struct hashTblVar hashVarST;  /*Gereral hash variables*/
     struct readPrim *readTree;    /*AVL tree or list*/
     struct readPrim **hashTbl;    /*Hash table*/
+    struct memArena *arenaST;
+      /*Holds the readPrim, bigNum, & primCord nodes (0: malloc)*/
     struct readPrimStack readStack[defLenStack];
       /*For hash and tree search & free functions*/
       /*defLenStack from fqGetIdsHash*/
@@ -99,6 +101,8 @@ typedef struct readPrimHash
 |       memory in hashTbl & readTree (both set to 0)
 |     o Variables in hashST to hold the readPrim list (readTree) and 
 |       length of the readPrim list (hashVarST.numIdsUL)
+|     o hashST->arenaST to hold the list nodes (0 if the arena could
+|       not be made, then each node is malloced)
 \---------------------------------------------------------------------*/
 unsigned char makeReadPrimList(
     char *primFaFileCStr,     /*Path to fasta file with primers*/
@@ -190,6 +194,7 @@ void freeReadPrimHashTblOrTree(
 |     o majicNumUL to hold the majic number for the hash
 |     o lenHashUL to be 0
 |     o lenLog2HashUL to be 0
+|     o arenaST to be 0
 \---------------------------------------------------------------------*/
 void initReadPrimHashST(
     struct readPrimHash *hashST /*Structer to initialize*/
@@ -205,6 +210,8 @@ void initReadPrimHashST(
 |  o This functions assumes that the hash table is on the heap.
 |  o If the hash table is not on the heap, then you will need to free
 |    things manually
+|  o If hashST->arenaST is not 0, the nodes are freed with the arena
+|    (hashElmOnHeapBl is ignored)
 \---------------------------------------------------------------------*/
 void freeReadPrimHashST(
     char stOnHeapBl,              /*1: is on heap; 0 on stack*/
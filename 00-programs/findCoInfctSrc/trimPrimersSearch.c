@@ -8,6 +8,7 @@
 #   o Trimmed reads are output to a fastq file
 # Includes:
 #   - "trimPrimersHash.h"
+#   - "interAln.h"
 #   o "fqGetIdsHash.h"
 #   o "trimPrimersAVLTree.h"
 #   o "defaultSettings.h"
@@ -67,7 +68,8 @@ unsigned char trimPrimers(
        ` 1: Trim off only the extreme primers
        */
     char *threadsCStr,     /*Number of threads to use with minimap2*/
-    char hashSearchBl      /*1: do hash search, 0: do Tree search*/
+    char hashSearchBl,     /*1: do hash search, 0: do Tree search*/
+    char interAlnBl        /*1: Use interAln instead of minimap2*/
 ){ /*~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~\
    ' Fun-1 TOC: trimPrimers
    '   - Wrapper functions for a series of functions that map the reads
@@ -86,8 +88,9 @@ unsigned char trimPrimers(
     /*Majic number for kunth multiplicative hashing*/
     unsigned char errUC = 0;       /*Tells if error in fastq entry*/
     struct readPrimHash hashST;
-    FILE *pafFILE = 0;           /*For skipping minimap2*/
+    FILE *pafFILE = 0;           /*For skipping minimap2 (or interAln)*/
     FILE *fqFILE = 0;            /*For getting reads from fastq file*/
+    uint8_t pipeBl = 0;          /*1: fastq is gzip compressed*/
     FILE *outFILE = 0;           /*File to write extracted reads to*/
 
     /*>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>\
@@ -104,6 +107,36 @@ unsigned char trimPrimers(
 
         fclose(outFILE); /*Minimap2 will handel this*/
         outFILE = 0;
+
+        if(interAlnBl)
+        { /*If finding the primers with the vector aligner*/
+            /*Same paf file minimap2 would make, just kept in a
+              temporary file, so makeReadPrimList can read it*/
+            pafFILE = tmpfile();
+
+            if(pafFILE == 0)
+                return 8; /*Could not make the temporary file*/
+
+            errUC =
+                interPrimerPaf(
+                    faPathCStr,
+                    fqPathCStr,
+                    (styleC & 1) ? defInterEndLen : 0,
+                    defInterMinPerc,
+                    pafFILE
+            ); /*Align the primers to the reads*/
+
+            if(errUC != 0)
+            { /*If had an error*/
+                fclose(pafFILE);
+
+                if(errUC & 64) return 64;
+                if(errUC & 4) return 32; /*Not a fastq file*/
+                return 2;                /*No primers*/
+            } /*If had an error*/
+
+            rewind(pafFILE);
+        } /*If finding the primers with the vector aligner*/
     } /*If running minimap2*/
 
     else if(!(stdinPafBl & 1))
@@ -162,9 +195,10 @@ unsigned char trimPrimers(
     if(!(errUC & 1))
         return errUC;
     
-    /*Make the AVL tree*/
-    if(hashSearchBl == 0) readPrimListToTree(1, &hashST.readTree); 
-    else errUC = readPrimListToHash(1, &hashST);
+    /*Make the AVL tree (duplicates in the arena are not freed)*/
+    if(hashSearchBl == 0)
+        readPrimListToTree(hashST.arenaST == 0, &hashST.readTree); 
+    else errUC = readPrimListToHash(hashST.arenaST == 0, &hashST);
 
     if(!(errUC & 1))
         return errUC; /*Something errored out, likely memory*/
@@ -179,12 +213,12 @@ unsigned char trimPrimers(
     else
         outFILE = fopen(outPathCStr, "w");
 
-    fqFILE = fopen(fqPathCStr, "r");
+    fqFILE = openFastqFile(fqPathCStr, &pipeBl); /*Uncompresses .gz*/
     errUC =
        extracAndTrimReads(fqFILE,outFILE,&hashST,styleC);
 
     fflush(outFILE); /*Make sure nothing in buffer*/
-    fclose(fqFILE); /*No longer need open*/
+    closeFastqFile(fqFILE, pipeBl); /*No longer need open*/
     fclose(outFILE); /*No longer need open*/
     freeReadPrimHashST(0, 1, &hashST);
 
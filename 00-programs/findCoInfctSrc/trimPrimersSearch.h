@@ -8,6 +8,7 @@
 #   o Trimmed reads are output to a fastq file
 # Includes:
 #   - "trimPrimersHash.h"
+#   - "interAln.h"
 #   o "fqGetIdsHash.h"
 #   o "trimPrimersAVLTree.h"
 #   o "defaultSettings.h"
@@ -31,6 +32,7 @@
 #define TRIMPRIMERSSEARCH_H
 
 #include "trimPrimersHash.h" /*includes fqGetIdsStructs.h*/
+#include "interAln.h"
 
 /*~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~\
 ' trimPrimersSerach SOH: Start Of Header
@@ -71,7 +73,8 @@ unsigned char trimPrimers(
        ` 1: Trim off only the extreme primers
        */
     char *threadsCStr,     /*Number of threads to use with minimap2*/
-    char hashSearchBl      /*1: do hash search, 0: do Tree search*/
+    char hashSearchBl,     /*1: do hash search, 0: do Tree search*/
+    char interAlnBl        /*1: Use interAln instead of minimap2*/
 ); /*~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~\
    ' Fun-1 TOC: trimPrimers
    '   - Wrapper functions for a series of functions that map the reads
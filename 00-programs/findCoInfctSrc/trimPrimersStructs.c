@@ -34,16 +34,24 @@
 
 /*---------------------------------------------------------------------\
 | Output: Returns: a readPrim structer heap or 0 for memory errors
+|   - If arenaST is not 0, the readPrim is from arenaST and is only
+|     freed with freeMemArena
 \---------------------------------------------------------------------*/
-struct readPrim * makeReadPrimST()
-/*Makes a blank readPrim structer on the heap*/
+struct readPrim * makeReadPrimST(
+    struct memArena *arenaST /*Arena for the node (0: malloc)*/
+) /*Makes a blank readPrim structer on the heap*/
 { /*makeReadInfoStruct*/
 
     /*~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~\
     ' Fun-1 TOC: Sec-1 Sub-1: makeReadPrimST
     \~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~*/
 
-    struct readPrim *readPrimST = malloc(sizeof(struct readPrim));
+    struct readPrim *readPrimST = 0;
+
+    if(arenaST != 0)
+        readPrimST = arenaAlloc(arenaST, sizeof(struct readPrim));
+    else
+        readPrimST = malloc(sizeof(struct readPrim));
 
     if(readPrimST == 0)
         return 0; /*memory allocation error*/
@@ -281,16 +289,24 @@ void insPrimCordST(
 
 /*---------------------------------------------------------------------\
 | Output: Returns: a blank primCord structer or 0 for memory errors
+|   - If arenaST is not 0, the primCord is from arenaST and is only
+|     freed with freeMemArena
 \---------------------------------------------------------------------*/
-struct primCord * makePrimCord()
-/*make a blank primCord structure on the heap*/
+struct primCord * makePrimCord(
+    struct memArena *arenaST /*Arena for the node (0: malloc)*/
+) /*make a blank primCord structure on the heap*/
 { /*makePrimCord*/
 
     /*~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~\
     ' Fun-8 TOC: Sec-1 Sub-1: makePrimCord
     \~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~*/
 
-    struct primCord *primCordST = malloc(sizeof(struct primCord));
+    struct primCord *primCordST = 0;
+
+    if(arenaST != 0)
+        primCordST = arenaAlloc(arenaST, sizeof(struct primCord));
+    else
+        primCordST = malloc(sizeof(struct primCord));
 
     if(primCordST == 0)
         return 0;     /*memory alloction error*/
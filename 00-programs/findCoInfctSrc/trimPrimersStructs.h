@@ -56,9 +56,12 @@ typedef struct readPrimStack
 
 /*---------------------------------------------------------------------\
 | Output: Returns: a readPrim structer heap or 0 for memory errors
+|   - If arenaST is not 0, the readPrim is from arenaST and is only
+|     freed with freeMemArena
 \---------------------------------------------------------------------*/
-struct readPrim * makeReadPrimST();
-/*Makes a blank readPrim structer on the heap*/
+struct readPrim * makeReadPrimST(
+    struct memArena *arenaST /*Arena for the node (0: malloc)*/
+); /*Makes a blank readPrim structer on the heap*/
 
 /*---------------------------------------------------------------------\
 | Output: frees a readPrim structer and sets its pointer to 0
@@ -119,8 +122,11 @@ void insPrimCordST(
 
 /*---------------------------------------------------------------------\
 | Output: Returns: a blank primCord structer or 0 for memory errors
+|   - If arenaST is not 0, the primCord is from arenaST and is only
+|     freed with freeMemArena
 \---------------------------------------------------------------------*/
-struct primCord * makePrimCord();
-/*make a blank primCord structure on the heap*/
+struct primCord * makePrimCord(
+    struct memArena *arenaST /*Arena for the node (0: malloc)*/
+); /*make a blank primCord structure on the heap*/
 
 #endif
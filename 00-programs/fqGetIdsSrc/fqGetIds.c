@@ -17,6 +17,19 @@
 #          - Use a tree search instead of hashing.           [Default: hashing]
 #              - Default search is hash combined with tree. 
 #          - Adds more time, but uses slightly less memory. 
+#      -flat-hash:
+#          - Use an open addressing hash table with the ids
+#            stored in the table (no trees).             [Default: hashing]
+#          - Faster to build and search for large id lists.
+#          - UUID read ids (nanopore) are searched as 128 bit
+#            keys.
+#      -prefilter:
+#          - Check a cuckoo filter of the read ids before
+#            the hash table or tree.                     [Default: only -v]
+#          - Faster when most reads are not in -f.
+#          - Not used with -flat-hash.
+#      -no-prefilter:
+#          - Do not use the cuckoo filter.
 #    -v:
 #      - Print reads not provided by -f                      [Default: not set]
 #    -V:
@@ -59,7 +72,8 @@ char * checkInput(int *lenArgsInt,        /*Number of arugments user input*/
                   char **outFileCStr,     /*Holds path/name of output file*/
                   char *stdinFastqChar,   /*1: stdin input for fastq*/
                   char *stdinFiltChar,    /*1: stdin input for filter*/
-                  char *useHashChar,      /*Set to 0 if user wants tree search*/
+                  char *useHashChar,      /*0: tree search, 2: flat hash*/
+                  char *prefilterChar,    /*0: no, 1: yes, 2: only -v*/
                   char *flipChar          /*1: print reads not in filtFileCStr
                                             0: print reads in filtFileCStr*/
 ); /*Checks user input & puts input into variables for later use*/
@@ -90,7 +104,8 @@ int main(int lenArgsInt, char *argsCStr[])
         stdinFastqChar = 0,   /*If 1 taking input from stdin*/
         stdinFiltChar = 0,    /*If 1 taking input from stdin*/
         printReverseChar = 0, /*Print sequences not in filter file*/
-        useHashChar = 1,      /*Holds if user wanted hashing [1: use hash]*/
+        useHashChar = 1,      /*0: tree, 1: hash + tree, 2: flat hash*/
+        prefilterChar = 2,    /*Cuckoo filter; 0: no, 1: yes, 2: if -v*/
         *inputChar = 0;       /*Holds arguemnt that had input error*/
 
     unsigned char
@@ -117,6 +132,19 @@ int main(int lenArgsInt, char *argsCStr[])
             \n      - Use a tree search instead of hashing.  [Default: hashing]\
             \n          - Default search is hash combined with tree.\
             \n      - Adds more time, but uses slightly less memory.\
+            \n    -flat-hash:\
+            \n      - Use an open addressing hash table with  [Default: hashing]\
+            \n        the ids stored in the table (no trees).\
+            \n      - Faster to build and search for large id lists.\
+            \n      - UUID read ids (nanopore) are searched as 128\
+            \n        bit keys.\
+            \n    -prefilter:\
+            \n      - Check a cuckoo filter of the read ids  [Default: only -v]\
+            \n        before the hash table or tree.\
+            \n      - Faster when most reads are not in -f.\
+            \n      - Not used with -flat-hash.\
+            \n    -no-prefilter:\
+            \n      - Do not use the cuckoo filter.\
             \n    -v:\
             \n      - Print reads not provided by -f         [Default: not set]\
             \n    -V:\
@@ -137,6 +165,7 @@ int main(int lenArgsInt, char *argsCStr[])
                            &stdinFastqChar,
                            &stdinFiltChar,
                            &useHashChar,
+                           &prefilterChar,
                            &printReverseChar
     ); /*Get the user input*/
 
@@ -300,6 +329,9 @@ int main(int lenArgsInt, char *argsCStr[])
     # Main Sec-6: Run function to extract reads by id and exit
     <<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<*/
 
+    if(prefilterChar == 2)
+        prefilterChar = printReverseChar; /*Most reads miss with -v*/
+
     if(
         fastqExtract(
             filtFileCStr,  /*File with read targets to keep or ignore*/
@@ -308,7 +340,8 @@ int main(int lenArgsInt, char *argsCStr[])
             sizeReadStackUChar, /*Number of elements to use in stack*/
             buffSizeULng,       /*Size of buffer to read input with*/
             useHashChar,        /*Tells if doing search with hashing*/
-            printReverseChar /*Tells if extracting filter ids (1) or other (0)*/
+            printReverseChar, /*Tells if extracting filter ids (1) or other (0)*/
+            prefilterChar       /*1: Check cuckoo filter first*/
         )
     ) { /*If fastq file was not a valid fastq file, issue a warning*/
         fprintf(
@@ -329,6 +362,7 @@ int main(int lenArgsInt, char *argsCStr[])
 #    Modifies: filtFileCStr, fastqFileCStr, stdinChar, & flipChar to hold or
 #              point to user input.
 #    Sets: useHashChar to 0 if user did not want to using hashing
+#          and to 2 if the user wanted the flat hash table
 ##############################################################################*/
 char * checkInput(int *lenArgsInt,        /*Number of arugments user input*/
                   char *argsCStr[],       /*Argumenas & parameters input*/
@@ -337,7 +371,8 @@ char * checkInput(int *lenArgsInt,        /*Number of arugments user input*/
                   char **outFileCStr,     /*Holds path/name of output file*/
                   char *stdinFastqChar,   /*1: stdin input for fastq*/
                   char *stdinFiltChar,    /*1: stdin input for filter*/
-                  char *useHashChar,      /*Set to 0 if user wants tree search*/
+                  char *useHashChar,      /*0: tree search, 2: flat hash*/
+                  char *prefilterChar,    /*0: no, 1: yes, 2: only -v*/
                   char *flipChar          /*1: print reads not in filtFileCStr
                                             0: print reads in filtFileCStr*/
 ) /*Checks user input & puts input into variables for later use*/
@@ -367,6 +402,24 @@ char * checkInput(int *lenArgsInt,        /*Number of arugments user input*/
             intArg--;                  /*Account for incurment at end of loop*/
         } /*If user wants to do tree search instead*/
 
+        else if(strcmp(tmpCStr, "-flat-hash") == 0)
+        { /*If user wants the open addressing hash table*/
+            *useHashChar = 2;
+            intArg--;                  /*Account for incurment at end of loop*/
+        } /*If user wants the open addressing hash table*/
+
+        else if(strcmp(tmpCStr, "-prefilter") == 0)
+        { /*If user wants the cuckoo filter*/
+            *prefilterChar = 1;
+            intArg--;                  /*Account for incurment at end of loop*/
+        } /*If user wants the cuckoo filter*/
+
+        else if(strcmp(tmpCStr, "-no-prefilter") == 0)
+        { /*If user does not want the cuckoo filter*/
+            *prefilterChar = 0;
+            intArg--;                  /*Account for incurment at end of loop*/
+        } /*If user does not want the cuckoo filter*/
+
         else if(strcmp(tmpCStr, "-stdin-fastq") == 0)
         { /*If if taking input from stdin*/
             *stdinFastqChar = 1;
@@ -0,0 +1,1011 @@
+/*#########################################################
+# Name: fqGetIdsBench
+# Use:
+#  - Makes a synthetic fastq (UUID read ids) and a read id
+#    file with a set number of ids in the fastq (hits).
+#    It then runs fqGetIds (AVL tree, hash, hash with
+#    prefilter, flat hash) and fqGetIdsThread (each thread
+#    count) on them and prints a tsv of the times.
+#  - The build time is the time to extract from a one read
+#    fastq with the same read id file. The scan time is the
+#    full time minus the build time.
+# Input:
+#  - See the help message (-h)
+# Output:
+#  - stdout: tsv with one line per program/mode/threads
+#    o program, mode, threads, reads, ids, hitRatio,
+#      readLen, fastqMB, buildSec, totalSec, scanSec,
+#      scanMBps, lookupsPerSec, peakRssKb, keptReads,
+#      expectReads
+#    o Times are the fastest of -reps runs. peakRssKb is
+#      the largest of the full runs.
+# C Standard Libraries:
+#  o <stdio.h>
+#  o <stdlib.h>
+#  o <stdint.h>
+#  o <string.h>
+#  o <time.h>
+#  o <unistd.h>
+#  o <fcntl.h>
+#  o <sys/wait.h>
+#  o <sys/resource.h>
+#########################################################*/
+
+/*~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~\
+' SOF: Start Of Functions
+' o fun-01 benchRand:
+'   - xorshift64* random number generator
+' o fun-02 uuidToCStr:
+'   - Prints two 64 bit numbers as a UUID
+' o fun-03 makeBenchData:
+'   - Makes the synthetic fastq and read id files
+' o fun-04 runTimed:
+'   - Runs a program and gets its time and peak memory
+' o fun-05 countFqReads:
+'   - Counts the reads in an output fastq
+' o fun-06 benchMode:
+'   - Benchmarks one program/mode/thread count
+' o fun-07 checkBenchInput:
+'   - Gets the user input
+' o main:
+'   - Runs everything
+\~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~*/
+
+#ifndef _DEFAULT_SOURCE
+   #define _DEFAULT_SOURCE /*wait4 & clock_gettime (glibc)*/
+#endif
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <stdint.h>
+#include <string.h>
+#include <time.h>
+#include <unistd.h>
+#include <fcntl.h>
+#include <sys/wait.h>
+#include <sys/resource.h>
+
+#define defVersion 20230712
+
+#define defNumReads 100000
+#define defNumIds 10000
+#define defHitRatio 0.5
+#define defReadLen 300
+#define defReps 3
+#define defSeed 1024
+#define defMaxThreads 16
+
+static char *benchModesCStr[] =
+   {"avl", "hash", "prefilter", "flat", "thread"};
+#define defNumModes 5
+
+/*--------------------------------------------------------\
+| Output:
+|  - Returns:
+|    o Next random number
+|  - Modifies:
+|    o stateUL to the next state
+\--------------------------------------------------------*/
+static uint64_t benchRand(
+    uint64_t *stateUL  /*State of the generator (not 0)*/
+){ /*~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~\
+   ' Fun-01 TOC: benchRand
+   '  - xorshift64* random number generator
+   \~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~*/
+
+    *stateUL ^= *stateUL >> 12;
+    *stateUL ^= *stateUL << 25;
+    *stateUL ^= *stateUL >> 27;
+    return *stateUL * 0x2545F4914F6CDD1DULL;
+} /*benchRand*/
+
+/*--------------------------------------------------------\
+| Output:
+|  - Modifies:
+|    o uuidCStr to hold the UUID (36 characters + '\0')
+\--------------------------------------------------------*/
+static void uuidToCStr(
+    uint64_t highUL,  /*First 64 bits of the UUID*/
+    uint64_t lowUL,   /*Last 64 bits of the UUID*/
+    char *uuidCStr    /*Buffer to hold the UUID (37 bytes)*/
+){ /*~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~\
+   ' Fun-02 TOC: uuidToCStr
+   '  - Prints two 64 bit numbers as a UUID
+   '    (8-4-4-4-12 hex characters)
+   \~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~*/
+
+    sprintf(
+       uuidCStr,
+       "%08x-%04x-%04x-%04x-%012llx",
+       (unsigned int) (highUL >> 32),
+       (unsigned int) ((highUL >> 16) & 0xffff),
+       (unsigned int) (highUL & 0xffff),
+       (unsigned int) (lowUL >> 48),
+       (unsigned long long) (lowUL & 0xffffffffffffULL)
+    );
+} /*uuidToCStr*/
+
+/*--------------------------------------------------------\
+| Output:
+|  - Makes:
+|    o fqCStr: fastq with numReadsUL reads of readLenUI
+|      random bases. Each read id is a UUID.
+|    o oneFqCStr: fastq with the first read in fqCStr
+|    o idsCStr: numIdsUL read ids in a random order.
+|      numHitsUL of these are in fqCStr, the rest are not.
+|  - Modifies:
+|    o fqBytesUL to have the size of fqCStr
+|  - Returns:
+|    o 0 for no errors
+|    o 1 for a file error
+|    o 2 for a memory error
+\--------------------------------------------------------*/
+static uint8_t makeBenchData(
+    char *fqCStr,         /*Name of fastq to make*/
+    char *oneFqCStr,      /*Name of one read fastq to make*/
+    char *idsCStr,        /*Name of read id file to make*/
+    uint64_t numReadsUL,  /*Number of reads in the fastq*/
+    uint64_t numIdsUL,    /*Number of read ids to print*/
+    uint64_t numHitsUL,   /*Number of ids in the fastq*/
+    uint32_t readLenUI,   /*Length of each read*/
+    uint64_t seedUL,      /*Seed for the generator*/
+    uint64_t *fqBytesUL   /*Gets size of the fastq*/
+){ /*~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~\
+   ' Fun-03 TOC: makeBenchData
+   '  - Makes the synthetic fastq and read id files
+   '  o fun-03 sec-01:
+   '    - Variable declerations
+   '  o fun-03 sec-02:
+   '    - Make the read ids and the fastq
+   '  o fun-03 sec-03:
+   '    - Pick the hits, shuffle, and print the read ids
+   \~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~*/
+
+    /*>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>\
+    ^ Fun-03 Sec-01:
+    ^  - Variable declerations
+    \<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<*/
+
+    char *baseCStr = "ACGT";
+    char uuidCStr[40];
+    char *seqCStr = 0;
+    char *qCStr = 0;
+    uint64_t stateUL = seedUL ? seedUL : defSeed;
+    uint64_t randUL = 0;
+    uint64_t *readIdAryUL = 0;  /*Two numbers per read id*/
+    uint64_t *idAryUL = 0;      /*Read ids to print*/
+    uint64_t swapUL = 0;
+    uint64_t ulRead = 0;
+    uint64_t ulSwap = 0;
+    uint32_t uiBase = 0;
+    uint8_t errUC = 0;
+
+    FILE *fqFILE = 0;
+    FILE *oneFILE = 0;
+    FILE *idsFILE = 0;
+
+    /*>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>\
+    ^ Fun-03 Sec-02:
+    ^  - Make the read ids and the fastq
+    \<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<*/
+
+    readIdAryUL = malloc(2 * numReadsUL * sizeof(uint64_t));
+    idAryUL = malloc(2 * numIdsUL * sizeof(uint64_t));
+    seqCStr = malloc(readLenUI + 1);
+    qCStr = malloc(readLenUI + 1);
+
+    if(! readIdAryUL || ! idAryUL || ! seqCStr || ! qCStr)
+    { /*If had a memory error*/
+        errUC = 2;
+        goto cleanUp;
+    } /*If had a memory error*/
+
+    fqFILE = fopen(fqCStr, "w");
+    oneFILE = fopen(oneFqCStr, "w");
+    idsFILE = fopen(idsCStr, "w");
+
+    if(! fqFILE || ! oneFILE || ! idsFILE)
+    { /*If could not make a file*/
+        errUC = 1;
+        goto cleanUp;
+    } /*If could not make a file*/
+
+    for(uiBase = 0; uiBase < readLenUI; ++uiBase)
+        qCStr[uiBase] = '!' + 10 + (uiBase % 30);
+
+    qCStr[readLenUI] = '\0';
+    seqCStr[readLenUI] = '\0';
+
+    for(ulRead = 0; ulRead < numReadsUL; ++ulRead)
+    { /*Loop: Make each read*/
+        readIdAryUL[ulRead << 1] = benchRand(&stateUL);
+        readIdAryUL[(ulRead << 1) + 1] = benchRand(&stateUL);
+
+        for(uiBase = 0; uiBase < readLenUI; ++uiBase)
+        { /*Loop: Make the sequence (32 bases a number)*/
+            if((uiBase & 31) == 0) randUL = benchRand(&stateUL);
+            seqCStr[uiBase] = baseCStr[randUL & 3];
+            randUL >>= 2;
+        } /*Loop: Make the sequence (32 bases a number)*/
+
+        uuidToCStr(
+           readIdAryUL[ulRead << 1],
+           readIdAryUL[(ulRead << 1) + 1],
+           uuidCStr
+        );
+
+        fprintf(
+           fqFILE,
+           "@%s runid=fqGetIdsBench read=%llu ch=1\n%s\n+\n%s\n",
+           uuidCStr,
+           (unsigned long long) ulRead,
+           seqCStr,
+           qCStr
+        );
+
+        if(ulRead == 0)
+           fprintf(
+              oneFILE,
+              "@%s runid=fqGetIdsBench read=0 ch=1\n%s\n+\n%s\n",
+              uuidCStr,
+              seqCStr,
+              qCStr
+           );
+    } /*Loop: Make each read*/
+
+    /*>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>\
+    ^ Fun-03 Sec-03:
+    ^  - Pick the hits, shuffle, and print the read ids
+    \<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<*/
+
+    /*Partial Fisher-Yates shuffle; the first numHitsUL
+    ` read ids are a random pick of the reads
+    */
+    for(ulRead = 0; ulRead < numHitsUL; ++ulRead)
+    { /*Loop: Pick the hits*/
+        ulSwap = ulRead + benchRand(&stateUL) % (numReadsUL - ulRead);
+
+        swapUL = readIdAryUL[ulRead << 1];
+        readIdAryUL[ulRead << 1] = readIdAryUL[ulSwap << 1];
+        readIdAryUL[ulSwap << 1] = swapUL;
+
+        swapUL = readIdAryUL[(ulRead << 1) + 1];
+        readIdAryUL[(ulRead << 1) + 1] = readIdAryUL[(ulSwap << 1) + 1];
+        readIdAryUL[(ulSwap << 1) + 1] = swapUL;
+
+        idAryUL[ulRead << 1] = readIdAryUL[ulRead << 1];
+        idAryUL[(ulRead << 1) + 1] = readIdAryUL[(ulRead << 1) + 1];
+    } /*Loop: Pick the hits*/
+
+    for(ulRead = numHitsUL; ulRead < numIdsUL; ++ulRead)
+    { /*Loop: Make the misses (a collision is 1 in 2^128)*/
+        idAryUL[ulRead << 1] = benchRand(&stateUL);
+        idAryUL[(ulRead << 1) + 1] = benchRand(&stateUL);
+    } /*Loop: Make the misses (a collision is 1 in 2^128)*/
+
+    for(ulRead = numIdsUL; ulRead > 1; --ulRead)
+    { /*Loop: Shuffle the read ids*/
+        ulSwap = benchRand(&stateUL) % ulRead;
+
+        swapUL = idAryUL[(ulRead - 1) << 1];
+        idAryUL[(ulRead - 1) << 1] = idAryUL[ulSwap << 1];
+        idAryUL[ulSwap << 1] = swapUL;
+
+        swapUL = idAryUL[((ulRead - 1) << 1) + 1];
+        idAryUL[((ulRead - 1) << 1) + 1] = idAryUL[(ulSwap << 1) + 1];
+        idAryUL[(ulSwap << 1) + 1] = swapUL;
+    } /*Loop: Shuffle the read ids*/
+
+    for(ulRead = 0; ulRead < numIdsUL; ++ulRead)
+    { /*Loop: Print the read ids*/
+        uuidToCStr(
+           idAryUL[ulRead << 1],
+           idAryUL[(ulRead << 1) + 1],
+           uuidCStr
+        );
+
+        fprintf(idsFILE, "%s\n", uuidCStr);
+    } /*Loop: Print the read ids*/
+
+    *fqBytesUL = (uint64_t) ftell(fqFILE);
+
+    cleanUp:;
+
+    if(fqFILE) fclose(fqFILE);
+    if(oneFILE) fclose(oneFILE);
+    if(idsFILE) fclose(idsFILE);
+
+    free(readIdAryUL);
+    free(idAryUL);
+    free(seqCStr);
+    free(qCStr);
+
+    return errUC;
+} /*makeBenchData*/
+
+/*--------------------------------------------------------\
+| Output:
+|  - Modifies:
+|    o secDbl to have the wall clock time of the run
+|    o rssKbUL to have the peak resident memory (kb)
+|  - Returns:
+|    o Exit status of the program
+|    o -1 if the program could not be run
+\--------------------------------------------------------*/
+static int runTimed(
+    char *argsAryCStr[], /*Program + arguments (0 ended)*/
+    double *secDbl,      /*Gets the time in seconds*/
+    uint64_t *rssKbUL    /*Gets the peak memory usage*/
+){ /*~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~\
+   ' Fun-04 TOC: runTimed
+   '  - Runs a program and gets its time and peak memory.
+   '    stdout goes to /dev/null.
+   \~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~*/
+
+    struct timespec startST;
+    struct timespec endST;
+    struct rusage useST;
+    int statusI = 0;
+    int nullFD = 0;
+    pid_t childPid = 0;
+
+    fflush(stdout);
+    clock_gettime(CLOCK_MONOTONIC, &startST);
+
+    childPid = fork();
+
+    if(childPid < 0) return -1;
+
+    if(childPid == 0)
+    { /*If the child process*/
+        nullFD = open("/dev/null", O_WRONLY);
+
+        if(nullFD >= 0)
+        { /*If could open /dev/null*/
+            dup2(nullFD, STDOUT_FILENO);
+            close(nullFD);
+        } /*If could open /dev/null*/
+
+        execv(argsAryCStr[0], argsAryCStr);
+        _exit(127); /*Could not run the program*/
+    } /*If the child process*/
+
+    if(wait4(childPid, &statusI, 0, &useST) < 0) return -1;
+
+    clock_gettime(CLOCK_MONOTONIC, &endST);
+
+    *secDbl =
+         (double) (endST.tv_sec - startST.tv_sec)
+       + (double) (endST.tv_nsec - startST.tv_nsec) / 1e9;
+
+    *rssKbUL = (uint64_t) useST.ru_maxrss; /*kb on linux*/
+
+    if(! WIFEXITED(statusI)) return -1;
+    if(WEXITSTATUS(statusI) == 127) return -1;
+    return WEXITSTATUS(statusI);
+} /*runTimed*/
+
+/*--------------------------------------------------------\
+| Output:
+|  - Returns:
+|    o Number of reads in fqCStr (lines / 4). The bench
+|      reads are one line of sequence and q-score.
+\--------------------------------------------------------*/
+static uint64_t countFqReads(
+    char *fqCStr   /*Fastq file to count reads in*/
+){ /*~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~\
+   ' Fun-05 TOC: countFqReads
+   '  - Counts the reads in an output fastq
+   \~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~*/
+
+    char buffCStr[1 << 16];
+    uint64_t linesUL = 0;
+    size_t lenBuffUL = 0;
+    FILE *fqFILE = fopen(fqCStr, "r");
+
+    if(fqFILE == 0) return 0;
+
+    while((lenBuffUL = fread(buffCStr, 1, sizeof(buffCStr), fqFILE)))
+    { /*Loop: Count the new lines*/
+        for(size_t ulChar = 0; ulChar < lenBuffUL; ++ulChar)
+            linesUL += (buffCStr[ulChar] == '\n');
+    } /*Loop: Count the new lines*/
+
+    fclose(fqFILE);
+    return linesUL >> 2;
+} /*countFqReads*/
+
+/*--------------------------------------------------------\
+| Output:
+|  - Prints:
+|    o One tsv line to stdout with the fastest times of
+|      repsUI runs for modeCStr
+|  - Returns:
+|    o 0 if ran
+|    o 1 if a run failed (an error is printed to stderr)
+\--------------------------------------------------------*/
+static uint8_t benchMode(
+    char *progCStr,    /*fqGetIds or fqGetIdsThread*/
+    char *modeCStr,    /*Mode to benchmark*/
+    uint8_t threadsUC, /*Number of threads (thread mode)*/
+    char *fqCStr,      /*Fastq to extract reads from*/
+    char *oneFqCStr,   /*One read fastq (build time)*/
+    char *idsCStr,     /*Read ids to extract*/
+    char *outCStr,     /*File to print reads to*/
+    uint64_t numReadsUL,   /*Reads in fqCStr*/
+    uint64_t numIdsUL,     /*Read ids in idsCStr*/
+    uint64_t numHitsUL,    /*Read ids in fqCStr*/
+    uint32_t readLenUI,    /*Length of each read*/
+    uint64_t fqBytesUL,    /*Size of fqCStr*/
+    uint32_t repsUI        /*Number of runs*/
+){ /*~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~\
+   ' Fun-06 TOC: benchMode
+   '  - Benchmarks one program/mode/thread count
+   '  o fun-06 sec-01:
+   '    - Variable declerations
+   '  o fun-06 sec-02:
+   '    - Set up the arguments for the mode
+   '  o fun-06 sec-03:
+   '    - Time the build (one read) and full runs
+   '  o fun-06 sec-04:
+   '    - Print the tsv line
+   \~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~*/
+
+    /*>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>\
+    ^ Fun-06 Sec-01:
+    ^  - Variable declerations
+    \<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<*/
+
+    char threadsCStr[8];
+    char *argsAryCStr[16];
+    int fqArgI = 0;    /*Index of the fastq in argsAryCStr*/
+    int numArgsI = 0;
+    int retI = 0;
+
+    double secDbl = 0;
+    double buildDbl = -1;
+    double totalDbl = -1;
+    double scanDbl = 0;
+    double fqMbDbl = (double) fqBytesUL / (1024 * 1024);
+    uint64_t rssKbUL = 0;
+    uint64_t maxRssKbUL = 0;
+    uint64_t keptUL = 0;
+
+    /*>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>\
+    ^ Fun-06 Sec-02:
+    ^  - Set up the arguments for the mode
+    \<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<*/
+
+    argsAryCStr[numArgsI++] = progCStr;
+    argsAryCStr[numArgsI++] = "-f";
+    argsAryCStr[numArgsI++] = idsCStr;
+    argsAryCStr[numArgsI++] = "-fastq";
+    fqArgI = numArgsI;
+    argsAryCStr[numArgsI++] = fqCStr;
+    argsAryCStr[numArgsI++] = "-out";
+    argsAryCStr[numArgsI++] = outCStr;
+
+    if(strcmp(modeCStr, "avl") == 0)
+    { /*If benchmarking the AVL tree*/
+        argsAryCStr[numArgsI++] = "-no-hash";
+        argsAryCStr[numArgsI++] = "-no-prefilter";
+    } /*If benchmarking the AVL tree*/
+
+    else if(strcmp(modeCStr, "hash") == 0)
+        argsAryCStr[numArgsI++] = "-no-prefilter";
+
+    else if(strcmp(modeCStr, "prefilter") == 0)
+        argsAryCStr[numArgsI++] = "-prefilter";
+
+    else if(strcmp(modeCStr, "flat") == 0)
+        argsAryCStr[numArgsI++] = "-flat-hash";
+
+    else
+    { /*Else benchmarking fqGetIdsThread*/
+        sprintf(threadsCStr, "%u", (unsigned int) threadsUC);
+        argsAryCStr[numArgsI++] = "-no-prefilter";
+        argsAryCStr[numArgsI++] = "-threads";
+        argsAryCStr[numArgsI++] = threadsCStr;
+    } /*Else benchmarking fqGetIdsThread*/
+
+    argsAryCStr[numArgsI] = 0;
+
+    /*>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>\
+    ^ Fun-06 Sec-03:
+    ^  - Time the build (one read) and full runs
+    \<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<*/
+
+    for(uint32_t uiRep = 0; uiRep < repsUI; ++uiRep)
+    { /*Loop: Run each replicate*/
+        argsAryCStr[fqArgI] = oneFqCStr;
+        retI = runTimed(argsAryCStr, &secDbl, &rssKbUL);
+        if(retI != 0) goto runErr;
+        if(buildDbl < 0 || secDbl < buildDbl) buildDbl = secDbl;
+
+        argsAryCStr[fqArgI] = fqCStr;
+        retI = runTimed(argsAryCStr, &secDbl, &rssKbUL);
+        if(retI != 0) goto runErr;
+        if(totalDbl < 0 || secDbl < totalDbl) totalDbl = secDbl;
+        if(rssKbUL > maxRssKbUL) maxRssKbUL = rssKbUL;
+    } /*Loop: Run each replicate*/
+
+    keptUL = countFqReads(outCStr);
+
+    if(keptUL != numHitsUL)
+        fprintf(
+           stderr,
+           "%s %s (%u threads) kept %llu reads, expected %llu\n",
+           progCStr,
+           modeCStr,
+           (unsigned int) threadsUC,
+           (unsigned long long) keptUL,
+           (unsigned long long) numHitsUL
+        );
+
+    /*>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>\
+    ^ Fun-06 Sec-04:
+    ^  - Print the tsv line
+    \<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<*/
+
+    scanDbl = totalDbl - buildDbl;
+    if(scanDbl < 1e-6) scanDbl = 1e-6; /*Noise on tiny files*/
+
+    fprintf(
+       stdout,
+       "%s\t%s\t%u\t%llu\t%llu\t%.3f\t%u\t%.2f\t%.4f\t%.4f\t%.4f",
+       progCStr,
+       modeCStr,
+       (unsigned int) threadsUC,
+       (unsigned long long) numReadsUL,
+       (unsigned long long) numIdsUL,
+       numIdsUL ? (double) numHitsUL / numIdsUL : 0,
+       (unsigned int) readLenUI,
+       fqMbDbl,
+       buildDbl,
+       totalDbl,
+       scanDbl
+    );
+
+    fprintf(
+       stdout,
+       "\t%.1f\t%.0f\t%llu\t%llu\t%llu\n",
+       fqMbDbl / scanDbl,
+       (double) numReadsUL / scanDbl,
+       (unsigned long long) maxRssKbUL,
+       (unsigned long long) keptUL,
+       (unsigned long long) numHitsUL
+    );
+
+    fflush(stdout);
+    return 0;
+
+    runErr:;
+
+    fprintf(
+       stderr,
+       "%s %s (%u threads) %s (exit %i)\n",
+       progCStr,
+       modeCStr,
+       (unsigned int) threadsUC,
+       retI < 0 ? "could not be run" : "failed",
+       retI
+    );
+
+    return 1;
+} /*benchMode*/
+
+/*--------------------------------------------------------\
+| Output:
+|  - Modifies:
+|    o Each input variable to hold the user input
+|  - Returns:
+|    o 0 if no errors
+|    o Pointer to the argument with an error
+\--------------------------------------------------------*/
+static char * checkBenchInput(
+    int lenArgsI,          /*Number of arguments*/
+    char *argsCStr[],      /*User arguments*/
+    char **fqGetIdsCStr,   /*Path to fqGetIds*/
+    char **threadCStr,     /*Path to fqGetIdsThread*/
+    char **prefixCStr,     /*Prefix for the bench files*/
+    uint64_t *numReadsUL,  /*Reads in the fastq*/
+    uint64_t *numIdsUL,    /*Read ids in the id file*/
+    double *hitRatioDbl,   /*Fraction of ids in fastq*/
+    uint32_t *readLenUI,   /*Length of each read*/
+    uint32_t *repsUI,      /*Runs per mode*/
+    uint64_t *seedUL,      /*Seed for the generator*/
+    char *modesBlAry,      /*1: benchmark mode; 0: skip*/
+    uint8_t *threadsAryUC, /*Thread counts for thread mode*/
+    uint8_t *numThreadsUC, /*Number of thread counts*/
+    uint8_t *keepBl        /*1: Keep the bench files*/
+){ /*~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~\
+   ' Fun-07 TOC: checkBenchInput
+   '  - Gets the user input
+   \~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~*/
+
+    char *flagCStr = 0;
+    char *argCStr = 0;
+    char *listCStr = 0;
+    char *endCStr = 0;
+    int iMode = 0;
+
+    for(int iArg = 1; iArg < lenArgsI; iArg += 2)
+    { /*Loop: Get the user input*/
+        flagCStr = argsCStr[iArg];
+        argCStr = iArg + 1 < lenArgsI ? argsCStr[iArg + 1] : 0;
+
+        if(strcmp(flagCStr, "-keep") == 0)
+        { /*If keeping the bench files*/
+            *keepBl = 1;
+            --iArg;   /*No argument*/
+            continue;
+        } /*If keeping the bench files*/
+
+        if(argCStr == 0) return flagCStr;
+
+        if(strcmp(flagCStr, "-fqGetIds") == 0)
+            *fqGetIdsCStr = argCStr;
+
+        else if(strcmp(flagCStr, "-fqGetIdsThread") == 0)
+            *threadCStr = argCStr;
+
+        else if(strcmp(flagCStr, "-prefix") == 0)
+            *prefixCStr = argCStr;
+
+        else if(strcmp(flagCStr, "-reads") == 0)
+            *numReadsUL = strtoull(argCStr, &endCStr, 10);
+
+        else if(strcmp(flagCStr, "-ids") == 0)
+            *numIdsUL = strtoull(argCStr, &endCStr, 10);
+
+        else if(strcmp(flagCStr, "-hit-ratio") == 0)
+            *hitRatioDbl = strtod(argCStr, &endCStr);
+
+        else if(strcmp(flagCStr, "-read-len") == 0)
+            *readLenUI = (uint32_t) strtoul(argCStr, &endCStr, 10);
+
+        else if(strcmp(flagCStr, "-reps") == 0)
+            *repsUI = (uint32_t) strtoul(argCStr, &endCStr, 10);
+
+        else if(strcmp(flagCStr, "-seed") == 0)
+            *seedUL = strtoull(argCStr, &endCStr, 10);
+
+        else if(strcmp(flagCStr, "-modes") == 0)
+        { /*Else if getting the modes to benchmark*/
+            for(iMode = 0; iMode < defNumModes; ++iMode)
+                modesBlAry[iMode] = 0;
+
+            listCStr = argCStr;
+
+            while(*listCStr != '\0')
+            { /*Loop: Get each mode*/
+                for(iMode = 0; iMode < defNumModes; ++iMode)
+                { /*Loop: Find the mode*/
+                    endCStr = benchModesCStr[iMode];
+                    size_t lenModeUL = strlen(endCStr);
+
+                    if(
+                          strncmp(listCStr, endCStr, lenModeUL) == 0
+                       && (   listCStr[lenModeUL] == ','
+                           || listCStr[lenModeUL] == '\0')
+                    ) break;
+                } /*Loop: Find the mode*/
+
+                if(iMode == defNumModes) return argCStr;
+
+                modesBlAry[iMode] = 1;
+                listCStr += strlen(benchModesCStr[iMode]);
+                if(*listCStr == ',') ++listCStr;
+            } /*Loop: Get each mode*/
+
+            endCStr = listCStr;
+        } /*Else if getting the modes to benchmark*/
+
+        else if(strcmp(flagCStr, "-threads") == 0)
+        { /*Else if getting the thread counts*/
+            *numThreadsUC = 0;
+            listCStr = argCStr;
+
+            while(*listCStr != '\0')
+            { /*Loop: Get each thread count*/
+                if(*numThreadsUC >= defMaxThreads) return argCStr;
+
+                threadsAryUC[*numThreadsUC] =
+                   (uint8_t) strtoul(listCStr, &endCStr, 10);
+
+                if(endCStr == listCStr) return argCStr;
+                if(threadsAryUC[*numThreadsUC] == 0) return argCStr;
+
+                ++(*numThreadsUC);
+                listCStr = endCStr;
+                if(*listCStr == ',') ++listCStr;
+            } /*Loop: Get each thread count*/
+
+            endCStr = listCStr;
+        } /*Else if getting the thread counts*/
+
+        else return flagCStr;
+
+        if(endCStr != 0 && *endCStr != '\0') return argCStr;
+        endCStr = 0;
+    } /*Loop: Get the user input*/
+
+    return 0;
+} /*checkBenchInput*/
+
+int main(
+    int lenArgsI,
+    char *argsCStr[]
+){ /*~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~\
+   ' Main TOC:
+   '  - Makes the bench files and benchmarks each mode
+   '  o main sec-01:
+   '    - Variable declerations
+   '  o main sec-02:
+   '    - Get and check the user input
+   '  o main sec-03:
+   '    - Make the bench files
+   '  o main sec-04:
+   '    - Benchmark each mode
+   \~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~*/
+
+    /*>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>\
+    ^ Main Sec-01:
+    ^  - Variable declerations
+    \<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<*/
+
+    char *fqGetIdsCStr = "./fqGetIdsBenchSSE";
+    char *threadCStr = "./fqGetIdsThreadBench";
+    char *prefixCStr = "fqGetIdsBench";
+    char *errCStr = 0;
+
+    char fqCStr[1024];
+    char oneFqCStr[1024];
+    char idsCStr[1024];
+    char outCStr[1024];
+
+    uint64_t numReadsUL = defNumReads;
+    uint64_t numIdsUL = defNumIds;
+    uint64_t numHitsUL = 0;
+    uint64_t seedUL = defSeed;
+    uint64_t fqBytesUL = 0;
+    double hitRatioDbl = defHitRatio;
+    uint32_t readLenUI = defReadLen;
+    uint32_t repsUI = defReps;
+
+    char modesBlAry[defNumModes] = {1, 1, 1, 1, 1};
+    uint8_t threadsAryUC[defMaxThreads] = {1, 2, 4};
+    uint8_t numThreadsUC = 3;
+    uint8_t keepBl = 0;
+    uint8_t errUC = 0;
+
+    char *helpCStr = "fqGetIdsBench [options...] > bench.tsv\
+      \n Use:\
+      \n   - Makes a synthetic fastq (UUID read ids) and read id\
+      \n     file, then times fqGetIds and fqGetIdsThread on them\
+      \n Input:\
+      \n   -fqGetIds:                  [./fqGetIdsBenchSSE]\
+      \n     - fqGetIds program to benchmark\
+      \n   -fqGetIdsThread:            [./fqGetIdsThreadBench]\
+      \n     - fqGetIdsThread program to benchmark\
+      \n   -reads:                     [100000]\
+      \n     - Number of reads in the synthetic fastq\
+      \n   -ids:                       [10000]\
+      \n     - Number of read ids in the read id file\
+      \n   -hit-ratio:                 [0.5]\
+      \n     - Fraction (0 to 1) of the read ids in the fastq\
+      \n   -read-len:                  [300]\
+      \n     - Length of each read\
+      \n   -modes:                     [avl,hash,prefilter,flat,thread]\
+      \n     - Comma separated list of modes to benchmark\
+      \n     - avl: fqGetIds -no-hash\
+      \n     - hash: fqGetIds (no prefilter)\
+      \n     - prefilter: fqGetIds -prefilter\
+      \n     - flat: fqGetIds -flat-hash\
+      \n     - thread: fqGetIdsThread -threads (each -threads)\
+      \n   -threads:                   [1,2,4]\
+      \n     - Comma separated list of thread counts\
+      \n   -reps:                      [3]\
+      \n     - Number of runs for each mode (fastest is kept)\
+      \n   -seed:                      [1024]\
+      \n     - Seed for the random number generator\
+      \n   -prefix:                    [fqGetIdsBench]\
+      \n     - Prefix to name the bench files with\
+      \n   -keep:                      [No]\
+      \n     - Keep the bench files\
+      \n Output:\
+      \n   - stdout: tsv with one line per mode and thread count\
+      \n     o buildSec: time with a one read fastq (read ids)\
+      \n     o scanSec: totalSec - buildSec\
+      \n     o scanMBps: fastq MB / scanSec\
+      \n     o lookupsPerSec: reads / scanSec\
+      \n     o peakRssKb: peak memory of the full run\
+      \n";
+
+    /*>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>\
+    ^ Main Sec-02:
+    ^  - Get and check the user input
+    \<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<*/
+
+    errCStr =
+       checkBenchInput(
+          lenArgsI,
+          argsCStr,
+          &fqGetIdsCStr,
+          &threadCStr,
+          &prefixCStr,
+          &numReadsUL,
+          &numIdsUL,
+          &hitRatioDbl,
+          &readLenUI,
+          &repsUI,
+          &seedUL,
+          modesBlAry,
+          threadsAryUC,
+          &numThreadsUC,
+          &keepBl
+       );
+
+    if(errCStr != 0)
+    { /*If had an input error*/
+        if(
+              strcmp(errCStr, "-h") == 0
+           || strcmp(errCStr, "--help") == 0
+           || strcmp(errCStr, "help") == 0
+        ){ /*If the user wanted the help message*/
+            fprintf(stdout, "%s", helpCStr);
+            exit(0);
+        } /*If the user wanted the help message*/
+
+        if(
+              strcmp(errCStr, "-V") == 0
+           || strcmp(errCStr, "--version") == 0
+        ){ /*If the user wanted the version number*/
+            fprintf(stdout, "fqGetIdsBench version %u\n", defVersion);
+            exit(0);
+        } /*If the user wanted the version number*/
+
+        fprintf(stderr, "%s\n%s is invalid\n", helpCStr, errCStr);
+        exit(-1);
+    } /*If had an input error*/
+
+    if(
+          numReadsUL == 0
+       || readLenUI == 0
+       || repsUI == 0
+       || hitRatioDbl < 0
+       || hitRatioDbl > 1
+    ){ /*If have an invalid number*/
+        fprintf(
+           stderr,
+           "-reads, -read-len, and -reps must be above 0 and\n"
+        );
+        fprintf(stderr, "-hit-ratio must be 0 to 1\n");
+        exit(-1);
+    } /*If have an invalid number*/
+
+    numHitsUL = (uint64_t) (hitRatioDbl * (double) numIdsUL + 0.5);
+
+    if(numHitsUL > numReadsUL)
+    { /*If have more hits than reads*/
+        fprintf(
+           stderr,
+           "-ids * -hit-ratio (%llu) is more than -reads (%llu)\n",
+           (unsigned long long) numHitsUL,
+           (unsigned long long) numReadsUL
+        );
+        exit(-1);
+    } /*If have more hits than reads*/
+
+    /*>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>\
+    ^ Main Sec-03:
+    ^  - Make the bench files
+    \<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<*/
+
+    /*fqGetIds wants .fastq at the end of the fastq*/
+    snprintf(fqCStr, sizeof(fqCStr), "%s.fastq", prefixCStr);
+    snprintf(oneFqCStr, sizeof(oneFqCStr), "%s-one.fastq", prefixCStr);
+    snprintf(idsCStr, sizeof(idsCStr), "%s.ids", prefixCStr);
+    snprintf(outCStr, sizeof(outCStr), "%s-out.fastq", prefixCStr);
+
+    errUC =
+       makeBenchData(
+          fqCStr,
+          oneFqCStr,
+          idsCStr,
+          numReadsUL,
+          numIdsUL,
+          numHitsUL,
+          readLenUI,
+          seedUL,
+          &fqBytesUL
+       );
+
+    if(errUC)
+    { /*If could not make the bench files*/
+        fprintf(
+           stderr,
+           "%s making the bench files (%s)\n",
+           errUC == 1 ? "File error" : "Memory error",
+           fqCStr
+        );
+        exit(-1);
+    } /*If could not make the bench files*/
+
+    /*>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>\
+    ^ Main Sec-04:
+    ^  - Benchmark each mode
+    \<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<*/
+
+    fprintf(
+       stdout,
+       "program\tmode\tthreads\treads\tids\thitRatio\treadLen"
+    );
+
+    fprintf(
+       stdout,
+       "\tfastqMB\tbuildSec\ttotalSec\tscanSec\tscanMBps"
+    );
+
+    fprintf(
+       stdout,
+       "\tlookupsPerSec\tpeakRssKb\tkeptReads\texpectReads\n"
+    );
+
+    for(int iMode = 0; iMode < defNumModes; ++iMode)
+    { /*Loop: Benchmark each mode*/
+        if(! modesBlAry[iMode]) continue;
+
+        if(strcmp(benchModesCStr[iMode], "thread") != 0)
+        { /*If benchmarking fqGetIds*/
+            errUC |=
+               benchMode(
+                  fqGetIdsCStr,
+                  benchModesCStr[iMode],
+                  1,
+                  fqCStr,
+                  oneFqCStr,
+                  idsCStr,
+                  outCStr,
+                  numReadsUL,
+                  numIdsUL,
+                  numHitsUL,
+                  readLenUI,
+                  fqBytesUL,
+                  repsUI
+               );
+
+            continue;
+        } /*If benchmarking fqGetIds*/
+
+        for(uint8_t ucThread = 0; ucThread < numThreadsUC; ++ucThread)
+        { /*Loop: Benchmark each thread count*/
+            errUC |=
+               benchMode(
+                  threadCStr,
+                  benchModesCStr[iMode],
+                  threadsAryUC[ucThread],
+                  fqCStr,
+                  oneFqCStr,
+                  idsCStr,
+                  outCStr,
+                  numReadsUL,
+                  numIdsUL,
+                  numHitsUL,
+                  readLenUI,
+                  fqBytesUL,
+                  repsUI
+               );
+        } /*Loop: Benchmark each thread count*/
+    } /*Loop: Benchmark each mode*/
+
+    if(! keepBl)
+    { /*If removing the bench files*/
+        remove(fqCStr);
+        remove(oneFqCStr);
+        remove(idsCStr);
+        remove(outCStr);
+    } /*If removing the bench files*/
+
+    exit(errUC);
+} /*main*/
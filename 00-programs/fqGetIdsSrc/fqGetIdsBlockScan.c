@@ -0,0 +1,428 @@
+/*#########################################################
+# Name: fqGetIdsBlockScan
+# Use:
+#  - Finds where fastq entries end by scanning 64 byte
+#    blocks of new line and '+' bit masks.
+# Libraries:
+#  - "fqGetIdsBlockScan.h"
+# C Standard Libraries
+#  o <stdint.h>
+#  o <string.h>
+#  o <immintrin.h> or <arm_neon.h> (vector builds)
+#########################################################*/
+
+/*~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~\
+' SOF: Start Of Functions
+' o fun-01 mkFqBlockMasks:
+'   - Makes the new line and '+' bit masks for a block
+' o fun-02 scanFqBlocks:
+'   - Finds the end of the fastq entry being scanned
+\~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~*/
+
+#include "fqGetIdsBlockScan.h"
+#include <string.h>
+
+/*The SSE2 and NEON masks are used even when no vector
+` flag was given, since every x86-64 and aarch64 cpu has
+` them.
+*/
+#if defined AVX512 || defined AVX2 || defined SSE || defined __SSE2__
+  #include <immintrin.h>
+#elif defined NEON || defined NEON64 || defined __ARM_NEON
+  #include <arm_neon.h>
+#endif
+
+/*--------------------------------------------------------\
+| Output:
+|  - Modifies:
+|    o nlMaskUL to have bit i set if byte i is a '\n'
+|    o plusMaskUL to have bit i set if byte i is a '+'
+|  - Note:
+|    o blockCStr must have defFqBlockBytes readable bytes
+\--------------------------------------------------------*/
+void mkFqBlockMasks(
+    char *blockCStr,      /*Block of 64 bytes to scan*/
+    uint64_t *nlMaskUL,   /*Gets the new line mask*/
+    uint64_t *plusMaskUL  /*Gets the '+' mask*/
+){ /*~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~\
+   ' Fun-01 TOC: mkFqBlockMasks
+   '  - Makes the new line and '+' bit masks for a block
+   \~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~*/
+
+  #ifdef AVX512
+    __m512i blockVect = _mm512_loadu_si512(blockCStr);
+
+    *nlMaskUL =
+      _mm512_cmpeq_epi8_mask(blockVect,_mm512_set1_epi8('\n'));
+    *plusMaskUL =
+      _mm512_cmpeq_epi8_mask(blockVect,_mm512_set1_epi8('+'));
+
+  #elif defined AVX2
+    __m256i nlVect = _mm256_set1_epi8('\n');
+    __m256i plusVect = _mm256_set1_epi8('+');
+    __m256i loVect =
+      _mm256_loadu_si256((__m256i *) blockCStr);
+    __m256i hiVect =
+      _mm256_loadu_si256((__m256i *) (blockCStr + 32));
+
+    *nlMaskUL =
+        (uint32_t)
+          _mm256_movemask_epi8(_mm256_cmpeq_epi8(loVect,nlVect))
+      | (
+          (uint64_t) (uint32_t)
+            _mm256_movemask_epi8(_mm256_cmpeq_epi8(hiVect,nlVect))
+        << 32
+      );
+
+    *plusMaskUL =
+        (uint32_t)
+          _mm256_movemask_epi8(_mm256_cmpeq_epi8(loVect,plusVect))
+      | (
+          (uint64_t) (uint32_t)
+            _mm256_movemask_epi8(_mm256_cmpeq_epi8(hiVect,plusVect))
+        << 32
+      );
+
+  #elif defined SSE || defined __SSE2__
+    __m128i nlVect = _mm_set1_epi8('\n');
+    __m128i plusVect = _mm_set1_epi8('+');
+    __m128i laneVect;
+    int laneI = 0;
+
+    *nlMaskUL = 0;
+    *plusMaskUL = 0;
+
+    for(laneI = 0; laneI < 4; ++laneI)
+    { /*Loop: Make the masks for each 16 byte lane*/
+      laneVect =
+        _mm_loadu_si128((__m128i *) (blockCStr + (laneI << 4)));
+
+      *nlMaskUL |=
+           (uint64_t) (uint16_t)
+             _mm_movemask_epi8(_mm_cmpeq_epi8(laneVect,nlVect))
+        << (laneI << 4);
+
+      *plusMaskUL |=
+           (uint64_t) (uint16_t)
+             _mm_movemask_epi8(_mm_cmpeq_epi8(laneVect,plusVect))
+        << (laneI << 4);
+    } /*Loop: Make the masks for each 16 byte lane*/
+
+  #elif defined NEON || defined NEON64 || defined __ARM_NEON
+    /*NEON has no movemask, so each byte that matched is
+    ` given its own bit (1 to 128) and the two halves of
+    ` the lane are added together
+    */
+    static const uint8_t bitAryUC[16] =
+      {1, 2, 4, 8, 16, 32, 64, 128, 1, 2, 4, 8, 16, 32, 64, 128};
+
+    uint8x16_t bitVect = vld1q_u8(bitAryUC);
+    uint8x16_t nlVect = vdupq_n_u8('\n');
+    uint8x16_t plusVect = vdupq_n_u8('+');
+    uint8x16_t laneVect;
+    uint8x8_t sumVect;
+    int laneI = 0;
+
+    *nlMaskUL = 0;
+    *plusMaskUL = 0;
+
+    for(laneI = 0; laneI < 4; ++laneI)
+    { /*Loop: Make the masks for each 16 byte lane*/
+      laneVect =
+        vld1q_u8((uint8_t *) (blockCStr + (laneI << 4)));
+
+      sumVect =
+        vget_low_u8(
+          vandq_u8(vceqq_u8(laneVect, nlVect), bitVect)
+        );
+      sumVect =
+        vpadd_u8(
+          sumVect,
+          vget_high_u8(
+            vandq_u8(vceqq_u8(laneVect, nlVect), bitVect)
+          )
+        );
+      sumVect = vpadd_u8(sumVect, sumVect);
+      sumVect = vpadd_u8(sumVect, sumVect);
+
+      *nlMaskUL |=
+           (uint64_t)
+             (vget_lane_u8(sumVect,0)|(vget_lane_u8(sumVect,1)<<8))
+        << (laneI << 4);
+
+      sumVect =
+        vget_low_u8(
+          vandq_u8(vceqq_u8(laneVect, plusVect), bitVect)
+        );
+      sumVect =
+        vpadd_u8(
+          sumVect,
+          vget_high_u8(
+            vandq_u8(vceqq_u8(laneVect, plusVect), bitVect)
+          )
+        );
+      sumVect = vpadd_u8(sumVect, sumVect);
+      sumVect = vpadd_u8(sumVect, sumVect);
+
+      *plusMaskUL |=
+           (uint64_t)
+             (vget_lane_u8(sumVect,0)|(vget_lane_u8(sumVect,1)<<8))
+        << (laneI << 4);
+    } /*Loop: Make the masks for each 16 byte lane*/
+
+  #else
+    /*SWAR: A byte is zero after the xor if it matched.
+    ` (x & 0x7f..) + 0x7f.. sets the high bit of every non
+    ` zero byte (no carry between bytes), so ~(that | x)
+    ` has only the high bits of the zero bytes set. The
+    ` multiply packs the 8 high bits into the top byte.
+    ` This assumes a little endian cpu.
+    */
+    uint64_t lowBitsUL = 0x7f7f7f7f7f7f7f7fULL;
+    uint64_t nlRepUL = 0x0a0a0a0a0a0a0a0aULL;   /*'\n'*/
+    uint64_t plusRepUL = 0x2b2b2b2b2b2b2b2bULL; /*'+'*/
+    uint64_t packUL = 0x0102040810204080ULL;
+    uint64_t wordUL = 0;
+    uint64_t cmpUL = 0;
+    int wordI = 0;
+
+    *nlMaskUL = 0;
+    *plusMaskUL = 0;
+
+    for(wordI = 0; wordI < 8; ++wordI)
+    { /*Loop: Make the masks for each 8 bytes*/
+      memcpy(&wordUL, blockCStr + (wordI << 3), 8);
+
+      cmpUL = wordUL ^ nlRepUL;
+      cmpUL = ~(((cmpUL & lowBitsUL) + lowBitsUL) | cmpUL | lowBitsUL);
+      *nlMaskUL |= (((cmpUL >> 7) * packUL) >> 56) << (wordI << 3);
+
+      cmpUL = wordUL ^ plusRepUL;
+      cmpUL = ~(((cmpUL & lowBitsUL) + lowBitsUL) | cmpUL | lowBitsUL);
+      *plusMaskUL |= (((cmpUL >> 7) * packUL) >> 56) << (wordI << 3);
+    } /*Loop: Make the masks for each 8 bytes*/
+  #endif
+} /*mkFqBlockMasks*/
+
+/*--------------------------------------------------------\
+| Output:
+|  - Returns:
+|    o Pointer to the start of the next fastq entry (one
+|      past the last q-score lines new line)
+|    o 0 if the entry does not end before endCStr. In this
+|      case scanST has where the entry is at, so the scan
+|      can be continued on the next buffer.
+|  - Modifies:
+|    o scanST to be at the start of an entry (found end)
+|      or at the end of the scanned bytes (no end found)
+\--------------------------------------------------------*/
+char * scanFqBlocks(
+    struct fqBlockScan *scanST, /*Where the scan is at*/
+    char *startCStr,            /*First byte to scan*/
+    char *endCStr               /*One past last byte*/
+){ /*~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~\
+   ' Fun-02 TOC: scanFqBlocks
+   '  - Finds the end of the fastq entry being scanned
+   '  o fun-02 sec-01:
+   '    - Variable declerations
+   '  o fun-02 sec-02:
+   '    - Get the masks for the next block
+   '  o fun-02 sec-03:
+   '    - Move through the entry with the masks
+   \~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~*/
+
+    /*>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>\
+    ^ Fun-02 Sec-01:
+    ^  - Variable declerations
+    \<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<*/
+
+    /*Zeros never match, so a short block can be padded*/
+    char lastBlockAryC[defFqBlockBytes];
+    char *blockCStr = 0;
+    unsigned long lenBlockUL = 0;
+
+    uint64_t nlMaskUL = 0;     /*New lines in the block*/
+    uint64_t plusMaskUL = 0;   /*'+'s in the block*/
+    uint64_t lineMaskUL = 0;   /*Bytes that start a line*/
+    uint64_t byteMaskUL = 0;   /*Bytes not moved past yet*/
+    uint64_t bitUL = 0;
+    unsigned int posUI = 0;    /*Bit (byte) in the block*/
+    unsigned long numNlUL = 0;
+
+    /*>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>\
+    ^ Fun-02 Sec-02:
+    ^  - Get the masks for the next block
+    \<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<*/
+
+    while(startCStr < endCStr)
+    { /*Loop: Scan the buffer 64 bytes at a time*/
+        lenBlockUL = endCStr - startCStr;
+        blockCStr = startCStr;
+
+        if(lenBlockUL < defFqBlockBytes)
+        { /*If this is the last (short) block*/
+            memset(lastBlockAryC, 0, defFqBlockBytes);
+            memcpy(lastBlockAryC, startCStr, lenBlockUL);
+            blockCStr = lastBlockAryC;
+            byteMaskUL = ((uint64_t) 1 << lenBlockUL) - 1;
+        } /*If this is the last (short) block*/
+
+        else
+        { /*Else this is a full block*/
+            lenBlockUL = defFqBlockBytes;
+            byteMaskUL = ~(uint64_t) 0;
+        } /*Else this is a full block*/
+
+        mkFqBlockMasks(blockCStr, &nlMaskUL, &plusMaskUL);
+
+        /*The byte after each new line starts a line. The
+        ` carry is if the last block ended on a new line.
+        */
+        lineMaskUL = (nlMaskUL << 1) | scanST->lineStartBl;
+        scanST->lineStartBl = (nlMaskUL >> (lenBlockUL - 1)) & 1;
+
+        /*>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>\
+        ^ Fun-02 Sec-03:
+        ^  - Move through the entry with the masks
+        ^  o fun-02 sec-03 sub-01:
+        ^    - Move past the header or the spacer
+        ^  o fun-02 sec-03 sub-02:
+        ^    - Count the sequence lines
+        ^  o fun-02 sec-03 sub-03:
+        ^    - Move past the q-score lines
+        \<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<*/
+
+        nextPart_fun02_sec03:
+
+        switch(scanST->stateUC)
+        { /*Switch: Find which part of the entry I am on*/
+
+            /*********************************************\
+            * Fun-02 Sec-03 Sub-01:
+            *  - Move past the header or the spacer
+            \*********************************************/
+
+            case defFqScanHead:
+            case defFqScanSpacer:
+            /*Case: Header or spacer (ends at first '\n')*/
+                if(nlMaskUL == 0) break; /*Not in block*/
+
+                posUI = __builtin_ctzll(nlMaskUL);
+
+                /*Clear the bits up to and at the new line (is 0
+                ` if the new line is the last byte)
+                */
+                bitUL = (nlMaskUL & -nlMaskUL) << 1;
+                bitUL = -bitUL;
+
+                nlMaskUL &= bitUL;
+                plusMaskUL &= bitUL;
+                lineMaskUL &= bitUL;
+                byteMaskUL &= bitUL;
+
+                if(scanST->stateUC == defFqScanHead)
+                { /*If this was the header*/
+                    scanST->stateUC = defFqScanSeq;
+                    scanST->numLinesUL = 0;
+                    scanST->lenSeqUL = 0;
+                    scanST->lenQUL = 0;
+                    scanST->seqLineBl = 0;
+                    goto nextPart_fun02_sec03;
+                } /*If this was the header*/
+
+                scanST->stateUC = defFqScanQ;
+
+                if(scanST->numLinesUL == 0)
+                { /*If the entry has no sequence*/
+                    /*The lengths are kept for fqBlockScanLenOk*/
+                    scanST->stateUC = defFqScanHead;
+                    scanST->lineStartBl = 0;
+                    return startCStr + posUI + 1;
+                } /*If the entry has no sequence*/
+
+                goto nextPart_fun02_sec03;
+            /*Case: Header or spacer (ends at first '\n')*/
+
+            /*********************************************\
+            * Fun-02 Sec-03 Sub-02:
+            *  - Count the sequence lines
+            \*********************************************/
+
+            case defFqScanSeq:
+            /*Case: On the sequence lines*/
+                /*A '+' at the start of a line is the spacer*/
+                bitUL = plusMaskUL & lineMaskUL;
+
+                if(bitUL == 0)
+                { /*If the sequence does not end here*/
+                    scanST->numLinesUL +=
+                       __builtin_popcountll(nlMaskUL);
+                    scanST->lenSeqUL +=
+                       __builtin_popcountll(byteMaskUL & ~nlMaskUL);
+                    break;
+                } /*If the sequence does not end here*/
+
+                /*Bits before the spacer (sequence lines)*/
+                bitUL = (bitUL & -bitUL) - 1;
+
+                scanST->numLinesUL +=
+                   __builtin_popcountll(nlMaskUL & bitUL);
+                scanST->lenSeqUL +=
+                   __builtin_popcountll(byteMaskUL & ~nlMaskUL & bitUL);
+
+                nlMaskUL &= ~bitUL;
+                plusMaskUL &= ~bitUL;
+                lineMaskUL &= ~bitUL;
+                byteMaskUL &= ~bitUL;
+
+                scanST->seqLineBl = scanST->numLinesUL > 0;
+                scanST->stateUC = defFqScanSpacer;
+                goto nextPart_fun02_sec03;
+            /*Case: On the sequence lines*/
+
+            /*********************************************\
+            * Fun-02 Sec-03 Sub-03:
+            *  - Move past the q-score lines
+            \*********************************************/
+
+            case defFqScanQ:
+            /*Case: On the q-score lines*/
+                /*Only new lines are looked at here, so q-score
+                ` lines starting with '@' or '+' are skipped
+                */
+                numNlUL = __builtin_popcountll(nlMaskUL);
+
+                if(numNlUL < scanST->numLinesUL)
+                { /*If the q-score entry does not end here*/
+                    scanST->numLinesUL -= numNlUL;
+                    scanST->lenQUL +=
+                       __builtin_popcountll(byteMaskUL & ~nlMaskUL);
+                    break;
+                } /*If the q-score entry does not end here*/
+
+                /*Remove the new lines before the last line*/
+                bitUL = nlMaskUL; /*Kept for the q-score length*/
+
+                while(--(scanST->numLinesUL) > 0)
+                    nlMaskUL &= nlMaskUL - 1;
+
+                posUI = __builtin_ctzll(nlMaskUL);
+
+                /*Q-score bytes before the last new line*/
+                scanST->lenQUL +=
+                   __builtin_popcountll(
+                      byteMaskUL & ~bitUL & ((nlMaskUL & -nlMaskUL) - 1)
+                   );
+
+                /*The lengths are kept for fqBlockScanLenOk*/
+                scanST->stateUC = defFqScanHead;
+                scanST->lineStartBl = 0;
+                return startCStr + posUI + 1;
+            /*Case: On the q-score lines*/
+        } /*Switch: Find which part of the entry I am on*/
+
+        startCStr += lenBlockUL;
+    } /*Loop: Scan the buffer 64 bytes at a time*/
+
+    return 0; /*The entry goes past endCStr*/
+} /*scanFqBlocks*/
@@ -0,0 +1,177 @@
+/*#########################################################
+# Name: fqGetIdsBlockScan
+# Use:
+#  - Finds where fastq entries end by scanning 64 byte
+#    blocks. Each block is turned into a bit mask of new
+#    lines and a bit mask of '+'s (one bit per byte), so a
+#    block of sequence or q-score lines is one popcount.
+#  - The scan state (which part of the entry and how many
+#    q-score lines are left) is kept in a fqBlockScan
+#    struct, so an entry can be split across buffers.
+#  - The scan also counts the sequence and q-score bytes,
+#    so a line starting with '@' can be checked to see if
+#    it is really a header.
+#  - The masks are made with AVX512, AVX2, SSE2, or NEON
+#    when the compiler has them and 8 bytes at a time
+#    (SWAR) when it does not.
+# C Standard Libraries
+#  o <stdint.h>
+#  o <string.h>
+#  o <immintrin.h> or <arm_neon.h> (vector builds)
+#########################################################*/
+
+#ifndef FQGETIDSBLOCKSCAN_H
+#define FQGETIDSBLOCKSCAN_H
+
+#include <stdint.h>
+
+/*~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~\
+' SOH: Start Of Header
+' o st-01 fqBlockScan:
+'   - Where a scan is in a fastq entry
+' o fun-01 mkFqBlockMasks:
+'   - Makes the new line and '+' bit masks for a block
+' o fun-02 scanFqBlocks:
+'   - Finds the end of the fastq entry being scanned
+' o fun-03 fqBlockScanEndOk:
+'   - Checks if a scan that ran out of file ended on the
+'     last q-score line (file has no final new line)
+' o fun-04 initFqBlockScan:
+'   - Sets a fqBlockScan to the start of an entry
+' o fun-05 fqBlockScanLenOk:
+'   - Checks if the last scanned entry has a sequence line
+'     and as many q-score bytes as sequence bytes
+\~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~*/
+
+#define defFqBlockBytes 64 /*Bytes in one scanned block*/
+
+/*Parts of a fastq entry (fqBlockScan->stateUC)*/
+#define defFqScanHead 0   /*On the header*/
+#define defFqScanSeq 1    /*On the sequence lines*/
+#define defFqScanSpacer 2 /*On the '+' line*/
+#define defFqScanQ 3      /*On the q-score lines*/
+
+/*--------------------------------------------------------\
+| ST-01: fqBlockScan
+|  - Where a scan is in a fastq entry. This is what is
+|    carried from one buffer to the next.
+|  - On the sequence lines numLinesUL counts the sequence
+|    lines. On the q-score lines it counts down the
+|    q-score lines left. This is what keeps a q-score line
+|    starting with '@' or '+' from being taken as a header
+|    or spacer.
+|  - lenSeqUL and lenQUL are the number of sequence and
+|    q-score bytes (no new lines) and seqLineBl is 1 if
+|    the entry had a sequence line. They are kept after
+|    the end of the entry is found (cleared on the next
+|    header).
+\--------------------------------------------------------*/
+typedef struct fqBlockScan
+{ /*fqBlockScan*/
+    uint8_t stateUC;      /*defFqScan* part of the entry*/
+    uint8_t lineStartBl;  /*1: next byte starts a line*/
+    uint64_t numLinesUL;  /*Seq lines or q-score lines left*/
+    uint64_t lenSeqUL;    /*Sequence bytes in the entry*/
+    uint64_t lenQUL;      /*Q-score bytes in the entry*/
+    uint8_t seqLineBl;    /*1: entry has a sequence line*/
+}fqBlockScan;
+
+/*--------------------------------------------------------\
+| Output:
+|  - Modifies:
+|    o nlMaskUL to have bit i set if byte i is a '\n'
+|    o plusMaskUL to have bit i set if byte i is a '+'
+|  - Note:
+|    o blockCStr must have defFqBlockBytes readable bytes
+\--------------------------------------------------------*/
+void mkFqBlockMasks(
+    char *blockCStr,      /*Block of 64 bytes to scan*/
+    uint64_t *nlMaskUL,   /*Gets the new line mask*/
+    uint64_t *plusMaskUL  /*Gets the '+' mask*/
+); /*~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~\
+   ' Fun-01 TOC: mkFqBlockMasks
+   '  - Makes the new line and '+' bit masks for a block
+   \~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~*/
+
+/*--------------------------------------------------------\
+| Output:
+|  - Returns:
+|    o Pointer to the start of the next fastq entry (one
+|      past the last q-score lines new line)
+|    o 0 if the entry does not end before endCStr. In this
+|      case scanST has where the entry is at, so the scan
+|      can be continued on the next buffer.
+|  - Modifies:
+|    o scanST to be at the start of an entry (found end)
+|      or at the end of the scanned bytes (no end found)
+\--------------------------------------------------------*/
+char * scanFqBlocks(
+    struct fqBlockScan *scanST, /*Where the scan is at*/
+    char *startCStr,            /*First byte to scan*/
+    char *endCStr               /*One past last byte*/
+); /*~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~\
+   ' Fun-02 TOC: scanFqBlocks
+   '  - Finds the end of the fastq entry being scanned
+   '  o fun-02 sec-01:
+   '    - Variable declerations
+   '  o fun-02 sec-02:
+   '    - Get the masks for the next block
+   '  o fun-02 sec-03:
+   '    - Move through the entry with the masks
+   \~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~*/
+
+/*--------------------------------------------------------\
+| Output:
+|  - Returns:
+|    o 1 if a scan that scanFqBlocks returned 0 for is on
+|      the last q-score line and the line has q-scores
+|      (the file just does not end in a new line)
+|    o 0 if the entry was cut short
+\--------------------------------------------------------*/
+#define fqBlockScanEndOk(scanST)(\
+     (scanST)->stateUC == defFqScanQ \
+  && (scanST)->numLinesUL == 1 \
+  && (scanST)->lineStartBl == 0 \
+) /*~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~\
+  ' Fun-03 TOC: fqBlockScanEndOk
+  '  - Checks if a scan that ran out of file ended on the
+  '    last q-score line
+  \~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~*/
+
+/*--------------------------------------------------------\
+| Output:
+|  - Modifies:
+|    o scanST to be at the start of an entry (the scan
+|      can start anywhere in the header)
+\--------------------------------------------------------*/
+#define initFqBlockScan(scanST){\
+  (scanST)->stateUC = defFqScanHead;\
+  (scanST)->lineStartBl = 0;\
+  (scanST)->numLinesUL = 0;\
+  (scanST)->lenSeqUL = 0;\
+  (scanST)->lenQUL = 0;\
+  (scanST)->seqLineBl = 0;\
+} /*~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~\
+  ' Fun-04 TOC: initFqBlockScan
+  '  - Sets a fqBlockScan to the start of an entry
+  \~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~*/
+
+/*--------------------------------------------------------\
+| Output:
+|  - Returns:
+|    o 1 if the entry scanFqBlocks just finished (or the
+|      cut short last entry) has a sequence line and as
+|      many q-score bytes as sequence bytes
+|    o 0 if the lengths differ or the spacer came right
+|      after the header
+\--------------------------------------------------------*/
+#define fqBlockScanLenOk(scanST)(\
+     (scanST)->seqLineBl \
+  && (scanST)->lenQUL == (scanST)->lenSeqUL \
+) /*~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~\
+  ' Fun-05 TOC: fqBlockScanLenOk
+  '  - Checks if the last scanned entry has a sequence line
+  '    and as many q-score bytes as sequence bytes
+  \~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~*/
+
+#endif
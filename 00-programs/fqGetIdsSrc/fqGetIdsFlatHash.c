@@ -0,0 +1,923 @@
+/*#########################################################
+# Name: fqGetIdsFlatHash
+# Use:
+#  - Open addressing hash table of read ids. The read ids
+#    are stored inline as fixed width limb arrays, so
+#    building the table has no per id allocations and
+#    a search is one tag scan of a 64 byte bucket (vector
+#    compare) plus one key compare.
+#  - UUID read ids (nanopore) are kept in a second table
+#    as 128 bit keys (see cnvtUuidToKey).
+# Libraries:
+#  - "fqGetIdsFlatHash.h"
+#  - "fqGetIdsHash.h"
+#  o "vectorWrap.h"
+#  o "fqGetIdsStructs.h"
+# C Standard Libraries
+#  - <string.h>
+#  o <stdint.h>
+#  o <stdio.h>
+#  o <stdlib.h>
+#  o <immintrin.h>
+#########################################################*/
+
+#include "fqGetIdsFlatHash.h"
+#include "fqGetIdsHash.h" /*findMajicNumber*/
+#include <string.h>
+
+/*~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~\
+' SOF: Start Of Functions
+' o fun-01 makeFlatIdTbl:
+'   - Reads in the ids in a filter file and builds a
+'     flatIdTbl with them
+' o fun-02 findIdInFlatTbl:
+'   - Checks if a read id is in a flatIdTbl
+' o fun-03 freeFlatIdTbl:
+'   - Frees a flatIdTbl
+' o fun-04 findUuidInFlatTbl:
+'   - Checks if a UUID (from cnvtUuidToKey) is in a
+'     flatIdTbl
+' o fun-05 flatNextCStr:
+'   - Moves to the next character in the filter file,
+'     reading in more of the file when needed
+' o fun-06 flatFillCStr:
+'   - Moves the unread part of the buffer to the start and
+'     reads in more of the filter file
+' o fun-07 flatHashKey:
+'   - Hashes a key (fixed width array)
+' o fun-08 flatBuckMasks:
+'   - Finds the slots in a bucket that match a tag and
+'     the slots that are empty
+' o fun-09 flatFirstBit:
+'   - Finds the index of the lowest set bit
+' o fun-10 makeFlatKeyTbl:
+'   - Allocates the tags and keys for a flatKeyTbl
+' o fun-11 insertFlatKey:
+'   - Inserts a key into a flatKeyTbl
+' o fun-12 findFlatKey:
+'   - Checks if a key is in a flatKeyTbl
+\~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~*/
+
+static inline char * flatNextCStr(
+    char *posCStr, char *buffCStr, uint32_t lenBuffUI,
+    uint64_t *lenInULng, FILE *filtFILE
+);
+
+static char * flatFillCStr(
+    char *posCStr, char *buffCStr, uint32_t lenBuffUI,
+    uint64_t *lenInULng, FILE *filtFILE
+);
+
+static inline uint64_t flatHashKey(
+    uint64_t *keyAryUL, unsigned int lenKeyUI,
+    unsigned long majicNumUL
+);
+
+static inline void flatBuckMasks(
+    uint8_t *tagsUC, uint8_t tagUC,
+    uint64_t *matchULPtr, uint64_t *emptyULPtr
+);
+
+static inline unsigned char flatFirstBit(uint64_t bitsUL);
+
+static uint8_t makeFlatKeyTbl(
+    struct flatKeyTbl *keyTbl, uint64_t numKeysULng,
+    unsigned int lenSlotUI
+);
+
+static void insertFlatKey(
+    uint64_t *keyAryUL, struct flatKeyTbl *keyTbl,
+    unsigned long majicNumUL
+);
+
+static inline uint8_t findFlatKey(
+    uint64_t *keyAryUL, struct flatKeyTbl *keyTbl,
+    unsigned long majicNumUL
+);
+
+/*--------------------------------------------------------\
+| Output:
+|  - Returns:
+|    o Pointer to a flatIdTbl with the read ids in filtFILE
+|    o 0 if had a memory allocation error
+|  - Modifies:
+|    o buffCStr to hold the last part of filtFILE
+\--------------------------------------------------------*/
+struct flatIdTbl * makeFlatIdTbl(
+    FILE *filtFILE,     /*File with read ids to filter by*/
+    char *buffCStr,     /*Buffer to read filtFILE with*/
+    uint32_t lenBuffUI  /*Length of buffCStr - 1*/
+){ /*~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~\
+   ' Fun-01 TOC: makeFlatIdTbl
+   '  - Reads in the ids in a filter file and builds a
+   '    flatIdTbl with them
+   '  o fun-01 sec-01:
+   '    - Variable declerations
+   '  o fun-01 sec-02:
+   '    - Read in and convert the read ids
+   '  o fun-01 sec-03:
+   '    - Find the table sizes and make the tables
+   '  o fun-01 sec-04:
+   '    - Put the read ids in the tables
+   \~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~*/
+
+    /*>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>\
+    ^ Fun-01 Sec-01:
+    ^  - Variable declerations
+    \<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<*/
+
+    char *posCStr = 0;
+    char *idCStr = 0;
+    char endIdCStr[40];   /*For UUID checks at end of file*/
+    char hexC = 0;
+    uint8_t charBit = 0;
+    uint8_t uuidBl = 0;
+
+    uint64_t lenInULng = 0;
+
+    /*The converted ids are kept in one array as
+    ` [number limbs][limbs]...[number limbs][limbs]
+    */
+    uint64_t *idAryUL = 0;
+    uint64_t sizeIdAryULng = 1 << 16;
+    uint64_t lenIdAryULng = 0;
+    uint64_t startIdULng = 0; /*Index of current id*/
+    uint64_t numIdsULng = 0;
+    uint64_t maxLimbsULng = 1;
+
+    /*UUIDs are kept as [first half][second half]...*/
+    uint64_t *uuidAryUL = 0;
+    uint64_t sizeUuidAryULng = 1 << 16;
+    uint64_t numUuidsULng = 0;
+
+    uint64_t *tmpAryUL = 0;
+    uint64_t idULng = 0;
+
+    struct flatIdTbl *flatTbl = 0;
+
+    /*>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>\
+    ^ Fun-01 Sec-02:
+    ^  - Read in and convert the read ids
+    ^  o fun-01 sec-02 sub-01:
+    ^    - Set up the id arrays and buffer
+    ^  o fun-01 sec-02 sub-02:
+    ^    - Check if the id is a UUID
+    ^  o fun-01 sec-02 sub-03:
+    ^    - Convert the id (same conversion as
+    ^      cnvtIdToBigNum and parseFastqHeader)
+    ^  o fun-01 sec-02 sub-04:
+    ^    - Move to the next line
+    \<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<*/
+
+    /*****************************************************\
+    * Fun-01 Sec-02 Sub-01:
+    *  - Set up the id arrays and buffer
+    \*****************************************************/
+
+    idAryUL = malloc(sizeIdAryULng * sizeof(uint64_t));
+    uuidAryUL = malloc(sizeUuidAryULng * sizeof(uint64_t));
+
+    if(idAryUL == 0 || uuidAryUL == 0)
+        goto memErr_fun01_sec02_sub01;
+
+    lenInULng =
+       fread(buffCStr, sizeof(char), lenBuffUI, filtFILE);
+
+    *(buffCStr + lenInULng) = '\0';
+    posCStr = buffCStr;
+
+    while(*posCStr != '\0')
+    { /*While there are ids to read in*/
+
+        if(*posCStr == '\n')
+        { /*If this is a blank line*/
+            posCStr =
+               flatNextCStr(
+                  posCStr,
+                  buffCStr,
+                  lenBuffUI,
+                  &lenInULng,
+                  filtFILE
+            );
+
+            continue;
+        } /*If this is a blank line*/
+
+        /*************************************************\
+        * Fun-01 Sec-02 Sub-02:
+        *  - Check if the id is a UUID
+        \*************************************************/
+
+        /*Make sure the whole UUID (+ @ and white space) is
+        ` in the buffer
+        */
+        if(buffCStr + lenInULng - posCStr < 38)
+        { /*If near the end of the buffer*/
+            posCStr =
+               flatFillCStr(
+                  posCStr,
+                  buffCStr,
+                  lenBuffUI,
+                  &lenInULng,
+                  filtFILE
+            );
+        } /*If near the end of the buffer*/
+
+        idCStr = posCStr + (*posCStr == '@');
+
+        if(buffCStr + lenInULng - idCStr >= 37)
+            uuidBl =
+               cnvtUuidToKey(
+                  idCStr,
+                  uuidAryUL + (numUuidsULng << 1)
+               );
+
+        else
+        { /*Else at the end of the file*/
+            memset(endIdCStr, 0, 40);
+            memcpy(
+               endIdCStr,
+               idCStr,
+               buffCStr + lenInULng - idCStr
+            );
+
+            uuidBl =
+               cnvtUuidToKey(
+                  endIdCStr,
+                  uuidAryUL + (numUuidsULng << 1)
+               );
+        } /*Else at the end of the file*/
+
+        if(uuidBl)
+        { /*If this id was a UUID*/
+            ++numUuidsULng;
+            posCStr = idCStr + 36;
+
+            if((numUuidsULng << 1) + 2 > sizeUuidAryULng)
+            { /*If I need more room for UUIDs*/
+                sizeUuidAryULng <<= 1;
+
+                tmpAryUL =
+                   realloc(
+                      uuidAryUL,
+                      sizeUuidAryULng * sizeof(uint64_t)
+                   );
+
+                if(tmpAryUL == 0) goto memErr_fun01_sec02_sub01;
+                uuidAryUL = tmpAryUL;
+            } /*If I need more room for UUIDs*/
+
+            goto nextLine_fun01_sec02_sub04;
+        } /*If this id was a UUID*/
+
+        /*************************************************\
+        * Fun-01 Sec-02 Sub-03:
+        *  - Convert the id (same conversion as
+        *    cnvtIdToBigNum and parseFastqHeader)
+        \*************************************************/
+
+        startIdULng = lenIdAryULng;
+        *(idAryUL + startIdULng) = 0;
+        ++lenIdAryULng;
+
+        do { /*While still on the read id*/
+
+            if(lenIdAryULng + 1 >= sizeIdAryULng)
+            { /*If I need more room for ids*/
+                sizeIdAryULng <<= 1;
+
+                tmpAryUL =
+                   realloc(
+                      idAryUL,
+                      sizeIdAryULng * sizeof(uint64_t)
+                   );
+
+                if(tmpAryUL == 0) goto memErr_fun01_sec02_sub01;
+                idAryUL = tmpAryUL;
+            } /*If I need more room for ids*/
+
+            /*lenUsedElmChar in a bigNum is a char*/
+            if(*(idAryUL + startIdULng) < 255)
+                ++(*(idAryUL + startIdULng));
+            else --lenIdAryULng; /*Overwrite last limb*/
+
+            *(idAryUL + lenIdAryULng) = 0;
+            charBit = 0;
+
+            while(charBit < defMaxDigPerLimb)
+            { /*While the current limb has room*/
+                hexC = hexTblCharAry[(unsigned char) *posCStr];
+
+                if(hexC & 64) break; /*End of read id*/
+
+                if(!(hexC & 32))
+                { /*If is a hex character*/
+                    *(idAryUL + lenIdAryULng) =
+                       *(idAryUL + lenIdAryULng)
+                       << defBitsPerChar;
+
+                    *(idAryUL + lenIdAryULng) += hexC;
+                    ++charBit;
+                } /*If is a hex character*/
+
+                posCStr =
+                   flatNextCStr(
+                      posCStr,
+                      buffCStr,
+                      lenBuffUI,
+                      &lenInULng,
+                      filtFILE
+                );
+            } /*While the current limb has room*/
+
+            ++lenIdAryULng;
+        } while(
+           !(hexTblCharAry[(unsigned char) *posCStr] & 64)
+        ); /*While still on the read id*/
+
+        if(*(idAryUL + startIdULng) > maxLimbsULng)
+            maxLimbsULng = *(idAryUL + startIdULng);
+        ++numIdsULng;
+
+        /*************************************************\
+        * Fun-01 Sec-02 Sub-04:
+        *  - Move to the next line
+        \*************************************************/
+
+        nextLine_fun01_sec02_sub04:
+
+        while(*posCStr != '\n' && *posCStr != '\0')
+        { /*While not at the end of the line*/
+            posCStr =
+               flatNextCStr(
+                  posCStr,
+                  buffCStr,
+                  lenBuffUI,
+                  &lenInULng,
+                  filtFILE
+            );
+        } /*While not at the end of the line*/
+    } /*While there are ids to read in*/
+
+    /*>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>\
+    ^ Fun-01 Sec-03:
+    ^  - Find the table sizes and make the tables
+    \<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<*/
+
+    flatTbl = calloc(1, sizeof(struct flatIdTbl));
+    if(flatTbl == 0) goto memErr_fun01_sec02_sub01;
+
+    flatTbl->majicNumULng = findMajicNumber() | 1;
+       /*Odd, so the multiply does not throw away bits*/
+
+    /*Limb count + limbs*/
+    flatTbl->qryAryUL =
+       malloc((maxLimbsULng + 1) * sizeof(uint64_t));
+
+    if(
+          flatTbl->qryAryUL == 0
+       || makeFlatKeyTbl(
+             &flatTbl->limbTbl,
+             numIdsULng,
+             maxLimbsULng + 1
+          )
+       || makeFlatKeyTbl(&flatTbl->uuidTbl, numUuidsULng, 2)
+    ) goto memErr_fun01_sec02_sub01;
+
+    /*>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>\
+    ^ Fun-01 Sec-04:
+    ^  - Put the read ids in the tables
+    \<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<*/
+
+    idULng = 0;
+
+    while(idULng < lenIdAryULng)
+    { /*While I have ids to add to the table*/
+        /*Zero pad the id to the slot size*/
+        memset(
+           flatTbl->qryAryUL,
+           0,
+           flatTbl->limbTbl.lenSlotUI * sizeof(uint64_t)
+        );
+
+        memcpy(
+           flatTbl->qryAryUL,
+           idAryUL + idULng,
+           (*(idAryUL + idULng) + 1) * sizeof(uint64_t)
+        );
+
+        insertFlatKey(
+           flatTbl->qryAryUL,
+           &flatTbl->limbTbl,
+           flatTbl->majicNumULng
+        );
+
+        idULng += *(idAryUL + idULng) + 1;
+    } /*While I have ids to add to the table*/
+
+    for(idULng = 0; idULng < numUuidsULng; ++idULng)
+        insertFlatKey(
+           uuidAryUL + (idULng << 1),
+           &flatTbl->uuidTbl,
+           flatTbl->majicNumULng
+        );
+
+    free(idAryUL);
+    free(uuidAryUL);
+    return flatTbl;
+
+    memErr_fun01_sec02_sub01:
+
+    if(idAryUL != 0) free(idAryUL);
+    if(uuidAryUL != 0) free(uuidAryUL);
+    freeFlatIdTbl(&flatTbl);
+    return 0;
+} /*makeFlatIdTbl*/
+
+/*--------------------------------------------------------\
+| Output:
+|  - Returns:
+|    o 1 if idBigNum is in flatTbl
+|    o 0 if idBigNum is not in flatTbl
+|  - Note:
+|    o UUID read ids are only in the UUID table, so use
+|      findUuidInFlatTbl for them
+\--------------------------------------------------------*/
+uint8_t findIdInFlatTbl(
+    struct bigNum *idBigNum,   /*Read id to search for*/
+    struct flatIdTbl *flatTbl  /*Table to search*/
+){ /*~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~\
+   ' Fun-02 TOC: findIdInFlatTbl
+   '  - Checks if a read id is in a flatIdTbl
+   \~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~*/
+
+    unsigned int limbUI = 0;
+    unsigned int lenLimbUI = idBigNum->lenUsedElmChar;
+
+    /*Longer than every id in the table*/
+    if(lenLimbUI >= flatTbl->limbTbl.lenSlotUI) return 0;
+
+    *flatTbl->qryAryUL = lenLimbUI;
+
+    for(limbUI = 0; limbUI < lenLimbUI; ++limbUI)
+        *(flatTbl->qryAryUL + limbUI + 1) =
+           (uint64_t) *(idBigNum->bigNumAryIOrL + limbUI);
+
+    for(++limbUI; limbUI < flatTbl->limbTbl.lenSlotUI; ++limbUI)
+        *(flatTbl->qryAryUL + limbUI) = 0;
+
+    return
+       findFlatKey(
+          flatTbl->qryAryUL,
+          &flatTbl->limbTbl,
+          flatTbl->majicNumULng
+       );
+} /*findIdInFlatTbl*/
+
+/*--------------------------------------------------------\
+| Output:
+|  - Frees:
+|    o flatTbl and sets it to 0
+\--------------------------------------------------------*/
+void freeFlatIdTbl(
+    struct flatIdTbl **flatTbl /*Table to free*/
+){ /*~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~\
+   ' Fun-03 TOC: freeFlatIdTbl
+   '  - Frees a flatIdTbl
+   \~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~*/
+
+    if(*flatTbl == 0) return;
+
+    if((*flatTbl)->limbTbl.tagMemPtr != 0)
+        free((*flatTbl)->limbTbl.tagMemPtr);
+    if((*flatTbl)->limbTbl.keyAryUL != 0)
+        free((*flatTbl)->limbTbl.keyAryUL);
+
+    if((*flatTbl)->uuidTbl.tagMemPtr != 0)
+        free((*flatTbl)->uuidTbl.tagMemPtr);
+    if((*flatTbl)->uuidTbl.keyAryUL != 0)
+        free((*flatTbl)->uuidTbl.keyAryUL);
+
+    if((*flatTbl)->qryAryUL != 0) free((*flatTbl)->qryAryUL);
+
+    free(*flatTbl);
+    *flatTbl = 0;
+} /*freeFlatIdTbl*/
+
+/*--------------------------------------------------------\
+| Output:
+|  - Returns:
+|    o 1 if the UUID is in flatTbl
+|    o 0 if the UUID is not in flatTbl
+\--------------------------------------------------------*/
+uint8_t findUuidInFlatTbl(
+    uint64_t *uuidAryUL,       /*UUID from cnvtUuidToKey*/
+    struct flatIdTbl *flatTbl  /*Table to search*/
+){ /*~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~\
+   ' Fun-04 TOC: findUuidInFlatTbl
+   '  - Checks if a UUID (from cnvtUuidToKey) is in a
+   '    flatIdTbl
+   \~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~*/
+
+    return
+       findFlatKey(
+          uuidAryUL,
+          &flatTbl->uuidTbl,
+          flatTbl->majicNumULng
+       );
+} /*findUuidInFlatTbl*/
+
+/*--------------------------------------------------------\
+| Output:
+|  - Returns:
+|    o Pointer to the next character in the filter file
+|    o Pointer to '\0' at the end of the file
+|  - Modifies:
+|    o buffCStr and lenInULng if more of the file was read
+\--------------------------------------------------------*/
+static inline char * flatNextCStr(
+    char *posCStr,      /*Character on*/
+    char *buffCStr,     /*Buffer with filter file*/
+    uint32_t lenBuffUI, /*Size of buffCStr*/
+    uint64_t *lenInULng,/*Number characters in buffCStr*/
+    FILE *filtFILE      /*Filter file*/
+){ /*~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~\
+   ' Fun-05 TOC: flatNextCStr
+   '  - Moves to the next character in the filter file,
+   '    reading in more of the file when needed
+   \~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~*/
+
+    ++posCStr;
+
+    if(*posCStr != '\0') return posCStr;
+    if(*lenInULng < lenBuffUI) return posCStr; /*EOF*/
+
+    *lenInULng =
+       fread(buffCStr, sizeof(char), lenBuffUI, filtFILE);
+
+    *(buffCStr + *lenInULng) = '\0';
+    return buffCStr;
+} /*flatNextCStr*/
+
+/*--------------------------------------------------------\
+| Output:
+|  - Returns:
+|    o Pointer to the start of buffCStr (the character
+|      posCStr was on)
+|  - Modifies:
+|    o buffCStr to start with the unread characters and
+|      be filled with the next part of filtFILE
+|    o lenInULng to the number of characters in buffCStr
+\--------------------------------------------------------*/
+static char * flatFillCStr(
+    char *posCStr,      /*Character on*/
+    char *buffCStr,     /*Buffer with filter file*/
+    uint32_t lenBuffUI, /*Size of buffCStr*/
+    uint64_t *lenInULng,/*Number characters in buffCStr*/
+    FILE *filtFILE      /*Filter file*/
+){ /*~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~\
+   ' Fun-06 TOC: flatFillCStr
+   '  - Moves the unread part of the buffer to the start and
+   '    reads in more of the filter file
+   \~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~*/
+
+    uint64_t lenLeftULng = buffCStr + *lenInULng - posCStr;
+
+    if(*lenInULng < lenBuffUI) return posCStr; /*EOF*/
+
+    memmove(buffCStr, posCStr, lenLeftULng);
+
+    *lenInULng =
+         lenLeftULng
+       + fread(
+            buffCStr + lenLeftULng,
+            sizeof(char),
+            lenBuffUI - lenLeftULng,
+            filtFILE
+         );
+
+    *(buffCStr + *lenInULng) = '\0';
+
+    /*A short read means the end of file, which is what the
+    ` *lenInULng < lenBuffUI checks need
+    */
+    return buffCStr;
+} /*flatFillCStr*/
+
+/*--------------------------------------------------------\
+| Output:
+|  - Returns:
+|    o 64 bit hash of the key. The top digPerKeyUChar bits
+|      are the bucket and the next 8 are the tag.
+\--------------------------------------------------------*/
+static inline uint64_t flatHashKey(
+    uint64_t *keyAryUL,     /*Key to hash*/
+    unsigned int lenKeyUI,  /*Number of elements in key*/
+    unsigned long majicNumUL/*Odd kunths multiplier*/
+){ /*~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~\
+   ' Fun-07 TOC: flatHashKey
+   '  - Hashes a key (fixed width array)
+   \~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~*/
+
+    uint64_t hashULng = 0;
+
+    /*Unlike calcHash, every element is used, since nanopore
+    ` ids often only differ in a few characters
+    */
+    for(unsigned int elmUI = 0; elmUI < lenKeyUI; ++elmUI)
+    { /*Loop: mix in each element*/
+        hashULng ^= *(keyAryUL + elmUI);
+        hashULng *= (uint64_t) majicNumUL;
+    } /*Loop: mix in each element*/
+
+    return hashULng;
+} /*flatHashKey*/
+
+/*--------------------------------------------------------\
+| Output:
+|  - Modifies:
+|    o matchULPtr to have a bit set for each slot in the
+|      bucket with tagUC as its tag
+|    o emptyULPtr to have a bit set for each empty slot
+\--------------------------------------------------------*/
+static inline void flatBuckMasks(
+    uint8_t *tagsUC,     /*Tags for the bucket (64)*/
+    uint8_t tagUC,       /*Tag to find*/
+    uint64_t *matchULPtr,/*Gets slots with tagUC*/
+    uint64_t *emptyULPtr /*Gets empty slots*/
+){ /*~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~\
+   ' Fun-08 TOC: flatBuckMasks
+   '  - Finds the slots in a bucket that match a tag and
+   '    the slots that are empty
+   \~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~*/
+
+    unsigned char slotUC = 0;
+
+    *matchULPtr = 0;
+    *emptyULPtr = 0;
+
+    #if defined AVX512 || AVX2 || SSE
+        unsigned long tmpUL = 0;
+
+        vectI8 tagVect;
+        vectI8 findVect;
+        vectI8 emptyVect;
+        mmaskI8 cmpMaskI8;
+
+        mmSet1I8(findVect, (char) tagUC);
+        mmSet1I8(emptyVect, defFlatEmptyTag);
+
+        for(
+           slotUC = 0;
+           slotUC < defFlatBuckSize;
+           slotUC += vectorBytes
+        ){ /*Loop: compare each vector of tags*/
+            mmLoadUI8(tagVect, tagsUC + slotUC);
+
+            /*AVX512 stores the mask to a pointer, the others
+            ` return a (signed) int from movemask
+            */
+            mmCmpEqI8(cmpMaskI8, tagVect, findVect);
+            #ifdef AVX512
+               storeI8CmpMask(&tmpUL, cmpMaskI8);
+            #else
+               storeI8CmpMask(tmpUL, cmpMaskI8);
+               tmpUL = (uint32_t) tmpUL;
+            #endif
+            *matchULPtr |= (uint64_t) tmpUL << slotUC;
+
+            mmCmpEqI8(cmpMaskI8, tagVect, emptyVect);
+            #ifdef AVX512
+               storeI8CmpMask(&tmpUL, cmpMaskI8);
+            #else
+               storeI8CmpMask(tmpUL, cmpMaskI8);
+               tmpUL = (uint32_t) tmpUL;
+            #endif
+            *emptyULPtr |= (uint64_t) tmpUL << slotUC;
+        } /*Loop: compare each vector of tags*/
+    #else
+        for(slotUC = 0; slotUC < defFlatBuckSize; ++slotUC)
+        { /*Loop: compare each tag*/
+            *matchULPtr |=
+               (uint64_t) (*(tagsUC + slotUC) == tagUC)
+               << slotUC;
+
+            *emptyULPtr |=
+               (uint64_t) (*(tagsUC + slotUC)==defFlatEmptyTag)
+               << slotUC;
+        } /*Loop: compare each tag*/
+    #endif
+} /*flatBuckMasks*/
+
+/*--------------------------------------------------------\
+| Output:
+|  - Returns:
+|    o Index of the lowest set bit in bitsUL (bitsUL must
+|      not be 0)
+\--------------------------------------------------------*/
+static inline unsigned char flatFirstBit(
+    uint64_t bitsUL /*Bits to search*/
+){ /*~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~\
+   ' Fun-09 TOC: flatFirstBit
+   '  - Finds the index of the lowest set bit
+   \~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~*/
+
+    #if defined __GNUC__ || defined __clang__
+        return (unsigned char) __builtin_ctzll(bitsUL);
+    #else
+        unsigned char bitUC = 0;
+
+        while(!(bitsUL & 1))
+        { /*Loop: find the first set bit*/
+            bitsUL >>= 1;
+            ++bitUC;
+        } /*Loop: find the first set bit*/
+
+        return bitUC;
+    #endif
+} /*flatFirstBit*/
+
+/*--------------------------------------------------------\
+| Output:
+|  - Modifies:
+|    o keyTbl to have empty tags and keys for numKeysULng
+|      keys (at most 2/3rds full). keyTbl is left blank if
+|      numKeysULng is 0.
+|  - Returns:
+|    o 0 for success
+|    o 64 for memory errors
+\--------------------------------------------------------*/
+static uint8_t makeFlatKeyTbl(
+    struct flatKeyTbl *keyTbl, /*Table to set up*/
+    uint64_t numKeysULng,      /*Number keys to hold*/
+    unsigned int lenSlotUI     /*Elements per key*/
+){ /*~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~\
+   ' Fun-10 TOC: makeFlatKeyTbl
+   '  - Allocates the tags and keys for a flatKeyTbl
+   \~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~*/
+
+    uint64_t numSlotsULng = defFlatBuckSize << 1;
+
+    keyTbl->lenSlotUI = lenSlotUI;
+    if(numKeysULng == 0) return 0; /*Searches check this*/
+
+    /*At least 2 buckets. Buckets of 64 keep probing short
+    ` even when a bit full.
+    */
+    keyTbl->digPerKeyUChar = 1;
+
+    while(numSlotsULng < numKeysULng + (numKeysULng >> 1))
+    { /*While I need a larger table*/
+        numSlotsULng <<= 1;
+        ++keyTbl->digPerKeyUChar;
+    } /*While I need a larger table*/
+
+    keyTbl->numBucketsULng = numSlotsULng / defFlatBuckSize;
+
+    /*Extra 64 bytes so the tags can be cache line aligned*/
+    keyTbl->tagMemPtr = calloc(numSlotsULng + 64, 1);
+
+    keyTbl->keyAryUL =
+       calloc(numSlotsULng * lenSlotUI, sizeof(uint64_t));
+
+    if(keyTbl->tagMemPtr == 0 || keyTbl->keyAryUL == 0)
+        return 64; /*Caller frees*/
+
+    keyTbl->tagAryUC =
+       (uint8_t *)
+       (((uintptr_t) keyTbl->tagMemPtr + 63) & ~(uintptr_t) 63);
+
+    return 0;
+} /*makeFlatKeyTbl*/
+
+/*--------------------------------------------------------\
+| Output:
+|  - Modifies:
+|    o keyTbl to have keyAryUL (duplicates are ignored)
+\--------------------------------------------------------*/
+static void insertFlatKey(
+    uint64_t *keyAryUL,        /*Key (lenSlotUI elements)*/
+    struct flatKeyTbl *keyTbl, /*Table to insert key into*/
+    unsigned long majicNumUL   /*Multiplier for hash*/
+){ /*~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~\
+   ' Fun-11 TOC: insertFlatKey
+   '  - Inserts a key into a flatKeyTbl
+   \~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~*/
+
+    uint64_t *slotUL = 0;
+
+    uint64_t hashULng = 0;
+    uint64_t buckULng = 0;
+    uint64_t matchULng = 0;
+    uint64_t emptyULng = 0;
+    uint8_t tagUC = 0;
+
+    /*Finds duplicates and is the same probe as insert*/
+    if(findFlatKey(keyAryUL, keyTbl, majicNumUL)) return;
+
+    hashULng =
+       flatHashKey(keyAryUL, keyTbl->lenSlotUI, majicNumUL);
+
+    buckULng = hashULng >> (64 - keyTbl->digPerKeyUChar);
+    tagUC = hashULng >> (56 - keyTbl->digPerKeyUChar);
+    tagUC += (tagUC == defFlatEmptyTag);
+
+    while(1)
+    { /*Loop till find an empty slot*/
+        flatBuckMasks(
+           keyTbl->tagAryUC + buckULng * defFlatBuckSize,
+           tagUC,
+           &matchULng,
+           &emptyULng
+        );
+
+        if(emptyULng)
+        { /*If have an empty slot*/
+            buckULng =
+                 buckULng * defFlatBuckSize
+               + flatFirstBit(emptyULng);
+
+            *(keyTbl->tagAryUC + buckULng) = tagUC;
+            slotUL = keyTbl->keyAryUL + buckULng*keyTbl->lenSlotUI;
+
+            memcpy(
+               slotUL,
+               keyAryUL,
+               keyTbl->lenSlotUI * sizeof(uint64_t)
+            );
+
+            return;
+        } /*If have an empty slot*/
+
+        buckULng = (buckULng + 1) & (keyTbl->numBucketsULng-1);
+    } /*Loop till find an empty slot*/
+} /*insertFlatKey*/
+
+/*--------------------------------------------------------\
+| Output:
+|  - Returns:
+|    o 1 if keyAryUL is in keyTbl
+|    o 0 if keyAryUL is not in keyTbl
+\--------------------------------------------------------*/
+static inline uint8_t findFlatKey(
+    uint64_t *keyAryUL,        /*Key (lenSlotUI elements)*/
+    struct flatKeyTbl *keyTbl, /*Table to search*/
+    unsigned long majicNumUL   /*Multiplier for hash*/
+){ /*~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~\
+   ' Fun-12 TOC: findFlatKey
+   '  - Checks if a key is in a flatKeyTbl
+   \~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~*/
+
+    unsigned int elmUI = 0;
+    uint64_t *slotUL = 0;
+
+    uint64_t hashULng = 0;
+    uint64_t buckULng = 0;
+    uint64_t matchULng = 0;
+    uint64_t emptyULng = 0;
+    uint8_t tagUC = 0;
+
+    if(keyTbl->numBucketsULng == 0) return 0; /*No keys*/
+
+    hashULng =
+       flatHashKey(keyAryUL, keyTbl->lenSlotUI, majicNumUL);
+
+    buckULng = hashULng >> (64 - keyTbl->digPerKeyUChar);
+    tagUC = hashULng >> (56 - keyTbl->digPerKeyUChar);
+    tagUC += (tagUC == defFlatEmptyTag);
+
+    while(1)
+    { /*Loop till find the key or an empty slot*/
+        flatBuckMasks(
+           keyTbl->tagAryUC + buckULng * defFlatBuckSize,
+           tagUC,
+           &matchULng,
+           &emptyULng
+        );
+
+        while(matchULng)
+        { /*While have slots with the same tag*/
+            slotUL =
+                 keyTbl->keyAryUL
+               +   (
+                        buckULng * defFlatBuckSize
+                      + flatFirstBit(matchULng)
+                   )
+                 * keyTbl->lenSlotUI;
+
+            for(elmUI = 0; elmUI < keyTbl->lenSlotUI; ++elmUI)
+                if(*(slotUL + elmUI) != *(keyAryUL + elmUI)) break;
+
+            if(elmUI == keyTbl->lenSlotUI) return 1;
+
+            matchULng &= matchULng - 1; /*Clear lowest bit*/
+        } /*While have slots with the same tag*/
+
+        /*Inserts fill the first empty slot, so an empty
+        ` slot means the key was never inserted
+        */
+        if(emptyULng) return 0;
+
+        buckULng = (buckULng + 1) & (keyTbl->numBucketsULng-1);
+    } /*Loop till find the key or an empty slot*/
+} /*findFlatKey*/
@@ -0,0 +1,152 @@
+/*#########################################################
+# Name: fqGetIdsFlatHash
+# Use:
+#  - Open addressing hash table of read ids. The read ids
+#    are stored inline as fixed width limb arrays, so
+#    building the table has no per id allocations and
+#    a search is one tag scan of a 64 byte bucket (vector
+#    compare) plus one key compare.
+#  - UUID read ids (nanopore) are kept in a second table
+#    as 128 bit keys (see cnvtUuidToKey).
+# Libraries:
+#  - "vectorWrap.h"
+#  - "fqGetIdsStructs.h"
+# C Standard Libraries
+#  o <stdint.h>
+#  o <stdio.h>
+#  o <stdlib.h>
+#  o <immintrin.h>
+#########################################################*/
+
+#ifndef FQGETIDSFLATHASH_H
+#define FQGETIDSFLATHASH_H
+
+#include "vectorWrap.h"
+#include "fqGetIdsStructs.h" /*<stdlib.h>, <stdio.h>, <stdint.h>*/
+
+/*~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~\
+' SOH: Start Of Header
+' o st-01 flatKeyTbl:
+'   - Open addressing table of fixed width keys
+' o st-02 flatIdTbl:
+'   - Holds the tables for UUID and other read ids
+' o fun-01 makeFlatIdTbl:
+'   - Reads in the ids in a filter file and builds a
+'     flatIdTbl with them
+' o fun-02 findIdInFlatTbl:
+'   - Checks if a read id is in a flatIdTbl
+' o fun-03 freeFlatIdTbl:
+'   - Frees a flatIdTbl
+' o fun-04 findUuidInFlatTbl:
+'   - Checks if a UUID (from cnvtUuidToKey) is in a
+'     flatIdTbl
+\~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~*/
+
+#define defFlatBuckSize 64  /*Slots (tags) per bucket*/
+#define defFlatEmptyTag 0   /*Tag for an empty slot*/
+
+/*--------------------------------------------------------\
+| ST-01: flatKeyTbl
+|  - Open addressing table of fixed width keys
+|  - Slots are split into buckets of 64. Each slot has a
+|    one byte tag (8 bits of the hash, 0 is empty), so the
+|    tags for a bucket are one cache line.
+|  - Each slot in keyAryUL is lenSlotUI elements.
+\--------------------------------------------------------*/
+typedef struct flatKeyTbl
+{ /*flatKeyTbl*/
+    uint8_t *tagAryUC;    /*Tags (64 byte aligned)*/
+    void *tagMemPtr;      /*What malloc returned for tags*/
+    uint64_t *keyAryUL;   /*Keys (lenSlotUI per slot)*/
+
+    uint64_t numBucketsULng; /*Number of 64 slot buckets*/
+    uint8_t digPerKeyUChar;  /*numBucketsULng is 2^this*/
+    unsigned int lenSlotUI;  /*Elements per slot*/
+}flatKeyTbl;
+
+/*--------------------------------------------------------\
+| ST-02: flatIdTbl
+|  - Holds the tables for UUID and other read ids
+|  - Slots in limbTbl are the number of limbs the id used
+|    and then the limbs of the id (zero padded).
+|  - Slots in uuidTbl are the two halves of the UUID
+\--------------------------------------------------------*/
+typedef struct flatIdTbl
+{ /*flatIdTbl*/
+    struct flatKeyTbl limbTbl; /*Non-UUID (bigNum) ids*/
+    struct flatKeyTbl uuidTbl; /*UUID ids*/
+    uint64_t *qryAryUL;        /*Pads bigNum ids to search*/
+    unsigned long majicNumULng;/*For kunths hash*/
+}flatIdTbl;
+
+/*--------------------------------------------------------\
+| Output:
+|  - Returns:
+|    o Pointer to a flatIdTbl with the read ids in filtFILE
+|    o 0 if had a memory allocation error
+|  - Modifies:
+|    o buffCStr to hold the last part of filtFILE
+\--------------------------------------------------------*/
+struct flatIdTbl * makeFlatIdTbl(
+    FILE *filtFILE,     /*File with read ids to filter by*/
+    char *buffCStr,     /*Buffer to read filtFILE with*/
+    uint32_t lenBuffUI  /*Length of buffCStr - 1*/
+); /*~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~\
+   ' Fun-01 TOC: makeFlatIdTbl
+   '  - Reads in the ids in a filter file and builds a
+   '    flatIdTbl with them
+   '  o fun-01 sec-01:
+   '    - Variable declerations
+   '  o fun-01 sec-02:
+   '    - Read in and convert the read ids
+   '  o fun-01 sec-03:
+   '    - Find the table sizes and make the tables
+   '  o fun-01 sec-04:
+   '    - Put the read ids in the tables
+   \~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~*/
+
+/*--------------------------------------------------------\
+| Output:
+|  - Returns:
+|    o 1 if idBigNum is in flatTbl
+|    o 0 if idBigNum is not in flatTbl
+|  - Note:
+|    o UUID read ids are only in the UUID table, so use
+|      findUuidInFlatTbl for them
+\--------------------------------------------------------*/
+uint8_t findIdInFlatTbl(
+    struct bigNum *idBigNum,   /*Read id to search for*/
+    struct flatIdTbl *flatTbl  /*Table to search*/
+); /*~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~\
+   ' Fun-02 TOC: findIdInFlatTbl
+   '  - Checks if a read id is in a flatIdTbl
+   \~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~*/
+
+/*--------------------------------------------------------\
+| Output:
+|  - Frees:
+|    o flatTbl and sets it to 0
+\--------------------------------------------------------*/
+void freeFlatIdTbl(
+    struct flatIdTbl **flatTbl /*Table to free*/
+); /*~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~\
+   ' Fun-03 TOC: freeFlatIdTbl
+   '  - Frees a flatIdTbl
+   \~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~*/
+
+/*--------------------------------------------------------\
+| Output:
+|  - Returns:
+|    o 1 if the UUID is in flatTbl
+|    o 0 if the UUID is not in flatTbl
+\--------------------------------------------------------*/
+uint8_t findUuidInFlatTbl(
+    uint64_t *uuidAryUL,       /*UUID from cnvtUuidToKey*/
+    struct flatIdTbl *flatTbl  /*Table to search*/
+); /*~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~\
+   ' Fun-04 TOC: findUuidInFlatTbl
+   '  - Checks if a UUID (from cnvtUuidToKey) is in a
+   '    flatIdTbl
+   \~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~*/
+
+#endif
@@ -26,12 +26,9 @@
 ' SOH: Start Of Header
 ' o fun-01 parseFastqHeader:
 '   - Reads in and converts read id in buffer to al number
-' o fun-02/fun-04 moveToNextFastqEntry:
-Usesing'   - Moves the the next fastq entry and prints to the
+' o fun-02 moveToNextFastqEntry:
+'   - Moves the the next fastq entry and prints to the
 '     output file if an output file was provided.
-'   - fun-02 is the vector version of moveToNextFastqEntry
-'   - fun-04 has the same header and is the scaler version
-'     moveToNextFastqEntry
 ' o fun-03 repositionBuff:
 '   - Reposition posUL to point to the element you want
 '     to move past in the buffer (true value in result
@@ -46,6 +43,9 @@ Usesing'   - Moves the the next fastq entry and prints to the
 |    o buffCStr to hold more input if needed
 |    o LenIdInt to hold the length of the read id if more
 |      input was raead in
+|    o uuidAryUL to hold the read id as a 128 bit key if
+|      uuidAryUL is not 0 and the read id is a UUID. In
+|      this case idBigNum->lenUsedElmChar is set to 0.
 |  - Returns:
 |    o 0 if nothing went wrong
 |    o 1 If the end of the file
@@ -60,6 +60,7 @@ uint8_t parseFastqHeader(
     unsigned long *lenInUL,  //Number of char in buffer
     unsigned int buffSizeUI, // Size of the buffer
     struct bigNum *idBigNum, // Will hold big number
+    uint64_t *uuidAryUL,     // 0 or gets UUID read ids
     FILE *fqFile             // Fastq file to get data from
 ); /*~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~\
    ' Fun-01 TOC: parseFastqHeader
@@ -95,20 +96,20 @@ uint8_t moveToNextFastqEntry(
       // This function will skip printing output if
       // outFILE == 0
 ); /*~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~\
-   ' Fun-02 TOC: or Fun-04 TOC: moveToNextFastqEntry
+   ' Fun-02 TOC: moveToNextFastqEntry
    '  - Moves the the next fastq entry and prints to the
    '    output file if an output file was provided.
-   '  - This is the vector version of moveToNextFastqEntry
-   '  o fun-02 sec-01: or fun-04 sec-01:
+   '  - The entry is found with scanFqBlocks (64 byte new
+   '    line and '+' masks), which keeps its place when
+   '    the entry goes past the end of the buffer.
+   '  o fun-02 sec-01:
    '    -  Variable declerations
-   '  o fun-02 sec-02: or fun-04 sec-02:
-   '    - Move past header
-   '  o fun-02 sec-03: or fun-04 sec-03:
-   '    - Find number newlines in sequence & move to spacer
-   '  o fun-02 sec-04: or fun-04 sec-04:
-   '    - Move past spacer
-   '  o fun-02 Sec-05: or fun-04 sec-05:
-   '    - Move past Q-score entry
+   '  o fun-02 sec-02:
+   '    - Ensure have data in buffer
+   '  o fun-02 sec-03:
+   '    - Find the end of the entry
+   '  o fun-02 sec-04:
+   '    - Adjust positoin for the next read
    \~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~*/
 
 #endif
@@ -42,6 +42,8 @@ double
 #    Modifies: numCharChar to hold the number of characters used in hash
 #    Modifies: digPerKeyUChar to hold the hash size (as multiple of two)
 #    Modifies: magickNumULng to hold the magick number for this hash table
+#    Note: If arenaST is not 0, the readInfo nodes are from arenaST, so
+#          free the table with free(hashTbl) & freeMemArena, not freeHashTbl
 ##############################################################################*/
 struct readInfo ** makeReadHash(
     FILE * filtFILE,               /*file with read id's to filter by*/
@@ -51,7 +53,8 @@ struct readInfo ** makeReadHash(
     uint64_t *hashSizeULng,       /*Will hold Size of hash table*/
     uint8_t *digPerKeyUChar,      /*Power of two hash size is at*/
     unsigned long *majicNumULng,  /*Holds majick number for kunths hash*/
-    uint8_t *failedChar           /*Tells if did not make hash table*/
+    uint8_t *failedChar,          /*Tells if did not make hash table*/
+    struct memArena *arenaST      /*Arena for the nodes (0: malloc)*/
 ) /*Makes a read hash array using input read ids*/
 { /*makeReadHash function*/
 
@@ -99,14 +102,15 @@ struct readInfo ** makeReadHash(
                &tmpBuffCStr,
                &lenInputULng,
                &maxHexChar,
-               filtFILE
+               filtFILE,
+               arenaST
        ); /*Read in id and convert to big number*/
 
        if(tmpRead == 0)
        { /*If was a falied read*/
            if(lenInputULng == 0)
            { /*If was a memory allocation error (message already printed)*/
-               freeReadTree(&readTree, readStackAry);
+               if(arenaST == 0) freeReadTree(&readTree, readStackAry);
                return 0;
            } /*If was a memory allocation error (message already printed)*/
 
@@ -186,7 +190,8 @@ struct readInfo ** makeReadHash(
            readTree,          /*readNode to insert into hash table*/
            majicNumULng,  /*Will hold final majick number*/
            digPerKeyUChar,
-           readStackAry       /*Stack, (as array) for searching*/
+           readStackAry,      /*Stack, (as array) for searching*/
+           arenaST            /*Arena the read is from*/
         ); /*Insert the read into the hash table*/
 
         readTree = tmpRead;  /*move to the next read*/
@@ -255,7 +260,8 @@ void insertHashEntry(
     struct readInfo *readNode,   /*readNode to insert into hash table*/
     const unsigned long *majicNumULng,  /*Majick number to mulitply by*/
     const uint8_t *digPerKeyUChar, /*Hash table size 2^digPerKeyUChar*/
-    struct readNodeStack *readStack /*Stack, (as array) for searching*/
+    struct readNodeStack *readStack, /*Stack, (as array) for searching*/
+    struct memArena *arenaST       /*Arena readNode is from (0: malloc)*/
 ) /*Iinserts a read into a hash table*/
 { /*insertHashEntry*/
 
@@ -283,7 +289,8 @@ void insertHashEntry(
                readStack             /*Stack, (as array) for searching*/
            ) == 0
        ) { /*If read was a duplicate*/
-           freeReadInfoStruct(&readNode); /*Free the duplicate node*/
+           /*Arena nodes are freed with the arena*/
+           if(arenaST == 0) freeReadInfoStruct(&readNode);
        } /*If read was a duplicate*/
    } /*Else already have nodes at hash, insert node into tree*/
 
@@ -440,7 +447,8 @@ struct readInfo ** readListToHash(
            readList,          /*readNode to insert into hash table*/
            majicNumULng,  /*Will hold final majick number*/
            digPerKeyUChar,
-           readStackAry       /*Stack, (as array) for searching*/
+           readStackAry,      /*Stack, (as array) for searching*/
+           0                  /*readList nodes are malloced*/
         ); /*Insert the read into the hash table*/
 
         readList = tmpRead;  /*move to the next read*/
@@ -33,9 +33,12 @@ uint8_t fastqExtract(
     char *outPathCStr,         /*Path to fastq file to to write reads*/
     uint8_t sizeReadStackUChar,/*Number of elements to use in stack*/
     uint32_t lenBuffUI,     /*Size of buffer to read input with*/
-    uint8_t hashSearchChar,    /*1: do hash search, 0: do Tree search*/
-    uint8_t printReverseChar   /*1: Keep reads in filter file
+    uint8_t hashSearchChar,    /*1: hash search, 0: Tree search
+                                 2: flat hash search*/
+    uint8_t printReverseChar,  /*1: Keep reads in filter file
                                  0: ingore reads in filter file*/
+    uint8_t prefilterBl        /*1: check a cuckoo filter before
+                                    the hash table or tree*/
 ) /*Searches and extracts reads from a fastq file using read id's*/
 { /*fastqExtract*/
 
@@ -63,11 +66,19 @@ uint8_t fastqExtract(
     uint64_t hashSizeULng = 0;       /*Will hold Size of hash table*/
 
     uint64_t fastqErrULng = 0;       /*Tells if error in fastq entry*/
+    int firstCharI = 0;              /*Checks for an empty id file*/
 
     /*Stack to use for searching tree. (depth = 73 = 10^18 nodes)*/
     struct readNodeStack readStack[sizeReadStackUChar + 2];
     struct readInfo *readTree = 0;
     struct readInfo **hashTbl = 0;
+    struct flatIdTbl *flatTbl = 0;
+    struct cuckooFilt *cuckooFilt = 0; /*Prefilter (-prefilter)*/
+
+    /*Holds the readInfo/bigNum nodes for the hash table or tree,
+    ` so the nodes are freed as a few blocks at the end instead
+    ` of walking every tree*/
+    struct memArena *arenaST = 0;
 
     FILE *filtFILE = 0;          /*to file with ID's to search for*/
     FILE *fqFILE = 0; /*fastq file to search*/
@@ -118,17 +129,50 @@ uint8_t fastqExtract(
     readStack[0].readNode = 0;
     readStack[sizeReadStackUChar + 1].readNode = 0;
 
-    if(hashSearchChar == 0)
+    /*An empty id file has no ids to build a tree or hash
+    ` table with. Search an empty tree instead, so every
+    ` read is a non-match (-v prints all reads).*/
+    firstCharI = getc(filtFILE);
+
+    if(firstCharI == EOF)
+    { /*If the id file is empty*/
+        hashSearchChar = 0;
+        prefilterBl = 0;
+    } /*If the id file is empty*/
+
+    else
+        ungetc(firstCharI, filtFILE);
+
+    /*If the arena can not be made (memory) arenaST is 0 and
+    ` each node is malloced*/
+    if(hashSearchChar != 2)
+        arenaST = makeMemArena();
+
+    if(firstCharI == EOF)
+        hashFailedBool = 0; /*Nothing to build*/
+
+    else if(hashSearchChar == 0)
     { /*If just using the avl tree for searching*/
         readTree =
             buildAvlTree(
                 filtFILE,    /*File with target read ids*/
                 readStack,   /*Stack for searching trees*/
                 buffCStr,  /*Buffer to hold one line from file*/
-                lenBuffUI /*Size of buffer*/
+                lenBuffUI, /*Size of buffer*/
+                arenaST    /*Arena for the nodes*/
         ); /*Build the tree of reads to search*/
     } /*If just using the avl tree for searching*/
 
+    else if(hashSearchChar == 2)
+    { /*Else if using the open addressing hash table*/
+        flatTbl =
+            makeFlatIdTbl(
+                filtFILE,   /*File with target read ids*/
+                buffCStr,   /*Buffer to read the file with*/
+                lenBuffUI   /*Size of buffer*/
+        ); /*Build the flat hash table*/
+    } /*Else if using the open addressing hash table*/
+
     else
     { /*Else I am searching using a hash function*/
         hashTbl =
@@ -140,14 +184,44 @@ uint8_t fastqExtract(
                 &hashSizeULng,  /*Will hold Size of hash table*/
                 &digPerKeyUChar, /*Number digitis used per key in hash*/
                 &majicNumULng,   /*Will hold the majic number*/
-                &hashFailedBool /*Holds if manged to make hash table*/
+                &hashFailedBool, /*Holds if manged to make hash table*/
+                arenaST          /*Arena for the nodes*/
         ); /*Build the hash table*/
     } /*Else I am searching using a hash function*/
 
     fclose(filtFILE); /*No longer need open*/
 
-    if(readTree == 0 && hashFailedBool == 1) /*Calloc errored out*/
+    if(hashSearchChar == 2)
+    { /*If using the flat hash table*/
+        if(flatTbl == 0)
+        { /*If could not make the flat hash table*/
+            fclose(fqFILE);
+            fclose(outFILE);
+            return 64;
+        } /*If could not make the flat hash table*/
+
+        hashFailedBool = 0;
+    } /*If using the flat hash table*/
+
+    if(readTree == 0 && hashFailedBool == 1)
+    { /*If calloc errored out*/
+        freeMemArena(&arenaST);
         return 0;
+    } /*If calloc errored out*/
+
+    /*The flat hash table already checks one cache line of
+    ` tags, so the prefilter is only for the hash table/tree.
+    ` If the filter can not be made (memory), cuckooFilt is 0
+    ` and the search is done without it.
+    */
+    if(prefilterBl && hashSearchChar != 2)
+        cuckooFilt =
+            cuckooFiltFromHash(
+                hashTbl,
+                hashSizeULng + 1, /*makeReadHash adds one tree*/
+                readTree,
+                readStack
+        ); /*Make the filter from the read ids*/
 
     /*>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>
     # Fun-1 Sec-3: Call the tree or hash table function to search the file
@@ -163,7 +237,9 @@ uint8_t fastqExtract(
             digPerKeyUChar,    /*Digits needed to get a key*/
             &printReverseChar,
             readTree,          /*AVL tree to search if hashTbl == 0*/
-            hashTbl            /*hash table to search*/
+            hashTbl,           /*hash table to search*/
+            flatTbl,           /*Flat hash table (-flat-hash)*/
+            cuckooFilt         /*Prefilter (0 if not using)*/
     );
 
     /*>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>
@@ -174,12 +250,20 @@ uint8_t fastqExtract(
     fclose(outFILE); /*No longer need open*/
 
     /*Check if freeing tree or hash table with tree*/
-    if(hashSearchChar == 0)
+    if(hashSearchChar == 2)
+        freeFlatIdTbl(&flatTbl);
+    else if(arenaST != 0)
+    { /*Else if the nodes are in the arena*/
+        free(hashTbl); /*Tree nodes are freed with the arena*/
+        freeMemArena(&arenaST);
+    } /*Else if the nodes are in the arena*/
+    else if(hashSearchChar == 0)
         freeReadTree(&readTree, readStack);
     else
     { /*If used hashing, free the hashing variables*/
         freeHashTbl(&hashTbl, &hashSizeULng, readStack);
     } /*If used hashing, free the hashing variables*/
+    freeCuckooFilt(&cuckooFilt);
 
     if(fastqErrULng & 4) return fastqErrULng;
     else if(fastqErrULng & 64) return 64;
@@ -191,12 +275,14 @@ uint8_t fastqExtract(
 # Output:
 #    Returns: balanced readInfo tree with all read id's in filtFILE
 #    Returns: 0 if calloc errored out
+#    Note: If arenaST is not 0, the tree is freed with freeMemArena
 ##############################################################################*/
 struct readInfo * buildAvlTree(
     FILE *filtFILE,                 /*File with read ids to keep or ignore*/
     struct readNodeStack *readStack,  /*Stack to use in building AVL tree*/
     char *buffCStr,        /*Buffer to hold one line from file*/
-    uint32_t lenBuffUI         /*Size of buffer to read each line*/
+    uint32_t lenBuffUI,        /*Size of buffer to read each line*/
+    struct memArena *arenaST   /*Arena for the nodes (0: malloc)*/
 ) /*Builds a readInfo tree with read id's in filtFILE*/
 { /*buildAvlTree function*/
 
@@ -235,14 +321,15 @@ struct readInfo * buildAvlTree(
                &tmpIdCStr,
                &lenInUL,
                &maxHexChar,
-               filtFILE
+               filtFILE,
+               arenaST
        ); /*Read in id and convert to big number*/
 
        if(lastRead == 0)
        { /*If was a falied read*/
            if(lenInUL == 0)
            { /*If was a memory allocation error (message already printed)*/
-               freeReadTree(&readTree, readStack);
+               if(arenaST == 0) freeReadTree(&readTree, readStack);
                return 0;
            } /*If was a memory allocation error (message already printed)*/
 
@@ -251,7 +338,8 @@ struct readInfo * buildAvlTree(
 
        if(insertNodeIntoReadTree(lastRead, &readTree, readStack) == 0)
        { /*If id is in tree, need to free*/
-           freeReadInfoStruct(&lastRead); /*If id already in tree*/
+           /*Arena nodes are freed with the arena*/
+           if(arenaST == 0) freeReadInfoStruct(&lastRead);
            lastRead = readTree;           /*Prevent loop ending early*/
        } /*If id is in tree, need to free*/
 
@@ -298,7 +386,9 @@ uint8_t extractReads(
     uint8_t digPerKeyUChar,     /*Digits needed to get a key*/
     uint8_t *printNonMatchBool, /*1: print non-match, 0: print match*/
     struct readInfo *readTree,  /*For AVL search (hashTbl == 0)*/
-    struct readInfo **hashTbl   /*Hash table to search for ids in*/
+    struct readInfo **hashTbl,  /*Hash table to search for ids in*/
+    struct flatIdTbl *flatTbl,  /*Used instead if not 0*/
+    struct cuckooFilt *cuckooFilt /*Checked first if not 0*/
 ) /*Extract target reads from fastq file with hash table or tree*/
 { /*extractReadsInHash*/
 
@@ -332,6 +422,8 @@ uint8_t extractReads(
 
     // For searching read id tree (part of hash table)
     struct readInfo *lastRead = 0;
+    uint8_t matchBl = 0;       // 1: read id is in the filter
+    uint64_t uuidAryUL[2];     // UUID read id (-flat-hash)
 
     /*>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>
     # Fun-3 Sec-2: Extract target reads from fastq file
@@ -369,6 +461,7 @@ uint8_t extractReads(
                 &lenInUL,
                 lenBuffUI,
                 idBigNum,
+                flatTbl != 0 ? uuidAryUL : 0,
                 fqFILE
         ); /*Get read name from file*/
 
@@ -387,9 +480,22 @@ uint8_t extractReads(
         # Fun-3 Sec-3 Sub-2: Determine if read is in tree
         ***********************************************************************/
 
-        // Check if using hash table/AVL tree or just AVL
-        if(hashTbl == 0)
-            lastRead = searchTree(idBigNum, readTree);
+        // Check if using the flat hash table, hash table/AVL
+        // tree, or just AVL
+        if(flatTbl != 0)
+        { /*If using the flat hash table*/
+            /*lenUsedElmChar is 0 for UUID read ids*/
+            if(idBigNum->lenUsedElmChar == 0)
+                matchBl = findUuidInFlatTbl(uuidAryUL, flatTbl);
+            else
+                matchBl = findIdInFlatTbl(idBigNum, flatTbl);
+        } /*If using the flat hash table*/
+        else if(
+               cuckooFilt != 0
+            && findIdInCuckooFilt(idBigNum, cuckooFilt) == 0
+        ) matchBl = 0; /*Not in filter, skip hash table/tree*/
+        else if(hashTbl == 0)
+            matchBl = !!searchTree(idBigNum, readTree);
         else 
         { /*Else doing a hash table / AVL tree*/
             lastRead = 
@@ -399,19 +505,21 @@ uint8_t extractReads(
                     &digPerKeyUChar,
                     hashTbl
             );  /*See if read id is in the hash table*/
+
+            matchBl = !!lastRead;
         } /*Else doing a hash table / AVL tree*/
 
         /***********************************************************************
         # Fun-3 Sec-3 Sub-3: Decide if should keep read
         ***********************************************************************/
 
-        /*Check if should print read (!! converts address to 1)
+        /*Check if should print read
           read is match, priting matches only = 1 ^ 0 = 1
           read is match, priting non-matches only = 1 ^ 1 = 0
           read is not match, priting matches only = 0 ^ 0 = 0
           read is not match, priting non-matches only = 0 ^ 1 = 1
         */
-        if(((!!lastRead) ^ *printNonMatchBool) == 0)
+        if((matchBl ^ *printNonMatchBool) == 0)
         { /*If is a read I am not printing out*/
              eofC =
                  moveToNextFastqEntry(
@@ -12,6 +12,8 @@
 
 #include "fqGetIdsFqFun.h" /*includes fqGetIdsStructs.h*/
 #include "fqGetIdsHash.h"
+#include "fqGetIdsFlatHash.h" /*Open addressing hash table*/
+#include "fqGetIdsCuckoo.h"   /*Prefilter for hash/tree search*/
     /*Includes:
           - fqGetIdsAVLTree.h:
               - <string.h>
@@ -32,21 +34,26 @@ uint8_t fastqExtract(
     char *outPathCStr,         /*Path to fastq file to to write reads*/
     uint8_t sizeReadStackUChar, /*Number of elements to use in stack*/
     uint32_t buffSizeUInt,      /*Size of buffer to read input with*/
-    uint8_t hashSearchChar,     /*1: do hash search, 0: do Tree search*/
-    uint8_t printReverseChar    /*1: Keep reads in filter file
+    uint8_t hashSearchChar,     /*1: hash search, 0: Tree search
+                                  2: flat hash search*/
+    uint8_t printReverseChar,   /*1: Keep reads in filter file
                                   0: ingore reads in filter file*/
+    uint8_t prefilterBl         /*1: check a cuckoo filter before
+                                     the hash table or tree*/
 ); /*Searches and extracts reads from a fastq file using read id's*/
 
 /*##############################################################################
 # Output:
 #    Returns: balanced readInfo tree with all read id's in filterFile
 #    Returns: 0 if malloc errored out
+#    Note: If arenaST is not 0, the tree is freed with freeMemArena
 ##############################################################################*/
 struct readInfo * buildAvlTree(
     FILE *filterFile,                 /*File with read ids to keep or ignore*/
     struct readNodeStack *readStack,  /*Stack to use in building AVL tree*/
     char *lineInCStr,        /*Buffer to hold one line from file*/
-    uint32_t buffSizeUInt         /*Size of buffer to read each line*/
+    uint32_t buffSizeUInt,        /*Size of buffer to read each line*/
+    struct memArena *arenaST      /*Arena for the nodes (0: malloc)*/
 ); /*Builds a readInfo tree with read id's in filterFile*/
 
 /*##############################################################################
@@ -63,7 +70,9 @@ uint8_t extractReads(
     uint8_t digPerKeyUChar,     /*Digits needed to get a key*/
     uint8_t *printNonMatchBool, /*1: print non-match, 0: print match*/
     struct readInfo *readTree,  /*For AVL search (hashTbl == 0)*/
-    struct readInfo **hashTbl   /*Hash table to search for ids in*/
+    struct readInfo **hashTbl,  /*Hash table to search for ids in*/
+    struct flatIdTbl *flatTbl,  /*Used instead if not 0*/
+    struct cuckooFilt *cuckooFilt /*Checked first if not 0*/
 ); /*Extract target reads from fastq file with hash table or tree*/
 
 #endif
@@ -23,9 +23,15 @@
 '      o Compare two big numbers
 '    fun-9 cnvtIdToBigNum:
 '      o Read in read id line & convert to big num
+'    fun-10 cnvtUuidToKey:
+'      o Converts a UUID read id to a 128 bit key
+'    fun-11 hexWordToUI:
+'      o Converts eight hex characters in a long to an int (used by
+'        fun-10, so is above it)
 \~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~*/
 
 #include "fqGetIdsStructs.h"
+#include <string.h> /*memcpy*/
 
 /*Make look up table to look if character is valid hex character
     64 is invisivle character
@@ -413,6 +419,9 @@ long cmpBigNums(
 |    Returns:
 |      - 0 if fails or end of file (lenIdULng < buffSizeInt)
 |      - pointer to struct with bigNum struct having converted read id
+|    Note:
+|      - If arenaST is not 0, the readInfo, bigNum, and bigNum array
+|        are from arenaST and are only freed with freeMemArena
 \---------------------------------------------------------------------*/
 struct readInfo * cnvtIdToBigNum(
     char *bufferCStr,  /*buffer to hold fread input (can have data)*/
@@ -420,7 +429,8 @@ struct readInfo * cnvtIdToBigNum(
     char **endCStr, /*Points to start of id, will point to end*/
     uint64_t *lenInputULng, /*Length of input from fread*/
     unsigned char *lenBigNumChar, /*Holds size to make bigNumber*/
-    FILE *idFILE         /*Fastq file to get data from*/
+    FILE *idFILE,        /*Fastq file to get data from*/
+    struct memArena *arenaST /*Arena for the nodes (0: malloc)*/
 ) /*Converts read id to bigNum read id, will grab new file input*/
 { /*cnvtIdToBigNum*/
 
@@ -436,18 +446,31 @@ struct readInfo * cnvtIdToBigNum(
     \<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<*/
 
     unsigned char charBit = 0;
-    struct bigNum *idBigNum = malloc(sizeof(struct bigNum));
-    struct readInfo *readNode = malloc(sizeof(struct readInfo));
+    struct bigNum *idBigNum = 0;
+    struct readInfo *readNode = 0;
     long *elmILPtr = 0;
+    long *tmpAryIL = 0;
 
     /*>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>\
     ^ Fun-9 Sec-2: Initalize readInfo & bigNum structs
     \<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<*/
 
+    if(arenaST != 0)
+    { /*If putting the nodes in an arena (freed as one block)*/
+        idBigNum = arenaAlloc(arenaST, sizeof(struct bigNum));
+        readNode = arenaAlloc(arenaST, sizeof(struct readInfo));
+    } /*If putting the nodes in an arena (freed as one block)*/
+
+    else
+    { /*Else each node is its own malloc*/
+        idBigNum = malloc(sizeof(struct bigNum));
+        readNode = malloc(sizeof(struct readInfo));
+    } /*Else each node is its own malloc*/
+
     if(idBigNum == 0 || readNode == 0)
     { /*If memory allocation failed*/
-        if(idBigNum != 0) free(idBigNum);
-        if(readNode != 0) free(readNode);
+        if(arenaST == 0 && idBigNum != 0) free(idBigNum);
+        if(arenaST == 0 && readNode != 0) free(readNode);
 
         *lenInputULng = 0; /*Make sure user detects failure*/
         return 0; 
@@ -460,15 +483,25 @@ struct readInfo * cnvtIdToBigNum(
 
     idBigNum->lenUsedElmChar = 0;
     idBigNum->totalL = 0;
-    idBigNum->bigNumAryIOrL = malloc(sizeof(long)*(*lenBigNumChar));
+
+    if(arenaST != 0)
+        idBigNum->bigNumAryIOrL =
+            arenaAlloc(arenaST, sizeof(long) * (*lenBigNumChar));
+    else
+        idBigNum->bigNumAryIOrL = malloc(sizeof(long)*(*lenBigNumChar));
 
     idBigNum->lenAllElmChar = *lenBigNumChar;
 
     if(idBigNum->bigNumAryIOrL == 0)
     { /*If memory reallocation failed*/
         *lenInputULng = 0; /*Make sure user detects failure*/
-        free(idBigNum);
-        free(readNode);
+
+        if(arenaST == 0)
+        { /*If not using an arena*/
+            free(idBigNum);
+            free(readNode);
+        } /*If not using an arena*/
+
         return 0;
     } /*If memory reallocation failed*/
 
@@ -483,9 +516,13 @@ struct readInfo * cnvtIdToBigNum(
 
         if(*lenInputULng < buffSizeInt)
         { /*If at end of file*/
-          free(idBigNum->bigNumAryIOrL);
-          free(idBigNum);
-          free(readNode);
+          if(arenaST == 0)
+          { /*If not using an arena (arena nodes are freed later)*/
+              free(idBigNum->bigNumAryIOrL);
+              free(idBigNum);
+              free(readNode);
+          } /*If not using an arena (arena nodes are freed later)*/
+
           return 0;                    /*Done with file*/
         } /*If at end of file*/
 
@@ -515,20 +552,36 @@ struct readInfo * cnvtIdToBigNum(
         { /*If need to reallocate memory*/
             (idBigNum->lenAllElmChar)++;
             (*lenBigNumChar)++;
-            idBigNum->bigNumAryIOrL =
-                realloc(
-                    idBigNum->bigNumAryIOrL,
-                    sizeof(long) * idBigNum->lenAllElmChar
-            ); /*Rellocate memory for the array*/
 
-            if(idBigNum == 0)
+            if(arenaST != 0)
+                tmpAryIL =
+                    arenaRealloc(
+                        arenaST,
+                        idBigNum->bigNumAryIOrL,
+                        sizeof(long) * (idBigNum->lenAllElmChar - 1),
+                        sizeof(long) * idBigNum->lenAllElmChar
+                ); /*Grows in place (array is the last allocation)*/
+            else
+                tmpAryIL =
+                    realloc(
+                        idBigNum->bigNumAryIOrL,
+                        sizeof(long) * idBigNum->lenAllElmChar
+                ); /*Rellocate memory for the array*/
+
+            if(tmpAryIL == 0)
             { /*If memory allocation failed*/
-                free(idBigNum->bigNumAryIOrL);
-                free(idBigNum);
-                free(readNode);
+                if(arenaST == 0)
+                { /*If not using an arena*/
+                    free(idBigNum->bigNumAryIOrL);
+                    free(idBigNum);
+                    free(readNode);
+                } /*If not using an arena*/
+
                 *lenInputULng = 0; /*Make sure user detects failure*/
                 return 0; 
             } /*If memory allocation failed*/
+
+            idBigNum->bigNumAryIOrL = tmpAryIL;
         } /*If need to reallocate memory*/
 
         elmILPtr =
@@ -594,6 +647,136 @@ struct readInfo * cnvtIdToBigNum(
     return readNode; /*Copied name sucessfully*/
 } /*cnvtIdToBigNum*/
 
+/*---------------------------------------------------------------------\
+| Output:
+|    Returns:
+|      - The 8 hex digits in hexUL packed into 32 bits
+|      - defNotHexUL if hexUL has a non-hex character
+\---------------------------------------------------------------------*/
+#define defNotHexUL ((uint64_t) 1 << 32)
+#define defOnesUL 0x0101010101010101ULL
+#define defHighUL 0x8080808080808080ULL
+
+static inline uint64_t hexWordToUI(
+    uint64_t hexUL /*Eight hex characters (loaded from a c-string)*/
+) /*Converts eight hex characters at once (no vectors needed)*/
+{ /*hexWordToUI*/
+
+    /*~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~\
+    ' Fun-11 TOC: hexWordToUI
+    '   - Each byte is a character. Bytes below 128 can have up to 128
+    '     added without carrying into the next byte, so a few adds
+    '     check if every byte is in a range.
+    \~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~*/
+
+    uint64_t lowerUL = hexUL | (0x20 * defOnesUL); /*A-F to a-f*/
+    uint64_t digitUL = 0;
+    uint64_t alphaUL = 0;
+
+    if(hexUL & defHighUL) return defNotHexUL; /*Not ascii*/
+
+    /*High bit set if >= '0' and not set if > '9'*/
+    digitUL =
+          (hexUL + (0x80 - '0') * defOnesUL)
+        & ~(hexUL + (0x7F - '9') * defOnesUL)
+        & defHighUL;
+
+    /*High bit set if >= 'a' and not set if > 'f'*/
+    alphaUL =
+          (lowerUL + (0x80 - 'a') * defOnesUL)
+        & ~(lowerUL + (0x7F - 'f') * defOnesUL)
+        & defHighUL;
+
+    if((digitUL | alphaUL) != defHighUL) return defNotHexUL;
+
+    /*'0' to '9' is x & 15; 'a' to 'f' and 'A' to 'F' is (x & 15) + 9*/
+    hexUL = (hexUL & (0x0F * defOnesUL)) + (alphaUL >> 7) * 9;
+
+    /*Pack the eight nibbles into 32 bits*/
+    hexUL = ((hexUL << 4) | (hexUL >> 8)) & 0x00FF00FF00FF00FFULL;
+    hexUL = (hexUL | (hexUL >> 8)) & 0x0000FFFF0000FFFFULL;
+    hexUL = (hexUL | (hexUL >> 16)) & 0x00000000FFFFFFFFULL;
+
+    return hexUL;
+} /*hexWordToUI*/
+
+/*---------------------------------------------------------------------\
+| Output:
+|    Modifies:
+|      - uuidAryUL[0] and uuidAryUL[1] to hold the 32 hex digits of the
+|        UUID (case ignored) if idCStr is a UUID
+|    Returns:
+|      - 1 if idCStr is a UUID (8-4-4-4-12 hex digits followed by white
+|        space, a new line, or '\0')
+|      - 0 if idCStr is not a UUID (uuidAryUL is not changed)
+|    Note:
+|      - idCStr must have at least 37 readable bytes
+\---------------------------------------------------------------------*/
+uint8_t cnvtUuidToKey(
+    char *idCStr,       /*Read id to convert (no @)*/
+    uint64_t *uuidAryUL /*Gets the 128 bit UUID (2 elements)*/
+) /*Converts a UUID read id to a 128 bit key (8 hex digits at a time)*/
+{ /*cnvtUuidToKey*/
+
+    /*~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~\
+    ' Fun-10 TOC:
+    '    fun-10 sec-1: Check the UUID format
+    '    fun-10 sec-2: Convert the four groups of eight hex digits
+    \~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~*/
+
+    /*>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>\
+    ^ Fun-10 Sec-1: Check the UUID format
+    \<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<*/
+
+    uint64_t hexAryUL[4];
+    uint32_t halfUI = 0;
+
+    if(
+         idCStr[8] != '-'
+      || idCStr[13] != '-'
+      || idCStr[18] != '-'
+      || idCStr[23] != '-'
+      || !(hexTblCharAry[(unsigned char) idCStr[36]] & 64)
+    ) return 0;
+
+    /*>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>\
+    ^ Fun-10 Sec-2: Convert the four groups of eight hex digits
+    ^   - memcpy is used for unaligned loads (compiles to one load)
+    \<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<*/
+
+    /*xxxxxxxx-*/
+    memcpy(&hexAryUL[0], idCStr, 8);
+
+    /*xxxx-xxxx-*/
+    memcpy(&halfUI, idCStr + 9, 4);
+    hexAryUL[1] = halfUI;
+    memcpy(&halfUI, idCStr + 14, 4);
+    hexAryUL[1] |= (uint64_t) halfUI << 32;
+
+    /*xxxx-xxxx*/
+    memcpy(&halfUI, idCStr + 19, 4);
+    hexAryUL[2] = halfUI;
+    memcpy(&halfUI, idCStr + 24, 4);
+    hexAryUL[2] |= (uint64_t) halfUI << 32;
+
+    /*xxxxxxxx*/
+    memcpy(&hexAryUL[3], idCStr + 28, 8);
+
+    hexAryUL[0] = hexWordToUI(hexAryUL[0]);
+    hexAryUL[1] = hexWordToUI(hexAryUL[1]);
+    hexAryUL[2] = hexWordToUI(hexAryUL[2]);
+    hexAryUL[3] = hexWordToUI(hexAryUL[3]);
+
+    if(
+        (hexAryUL[0] | hexAryUL[1] | hexAryUL[2] | hexAryUL[3])
+      & defNotHexUL
+    ) return 0;
+
+    uuidAryUL[0] = (hexAryUL[0] << 32) | hexAryUL[1];
+    uuidAryUL[1] = (hexAryUL[2] << 32) | hexAryUL[3];
+    return 1;
+} /*cnvtUuidToKey*/
+
 /* Ascii table
 Dec  Char                           Dec  Char     Dec  Char     Dec Char
 ---------                           ---------     ---------     --------
@@ -10,6 +10,7 @@
 #include <stdlib.h>
 #include <stdio.h>
 #include <stdint.h> /*for intx_t & uintx_t variables*/
+#include "fqGetIdsArena.h" /*Arena for readInfo/bigNum nodes*/
 
 /*Look up table to use in converting char to hext*/
 extern char hexTblCharAry[];
@@ -152,6 +153,9 @@ long cmpBigNums(
 |    Returns:
 |      - 0 if fails or end of file (lenIdULng < buffSizeInt)
 |      - pointer to struct with bigNum struct having converted read id
+|    Note:
+|      - If arenaST is not 0, the readInfo, bigNum, and bigNum array
+|        are from arenaST and are only freed with freeMemArena
 \---------------------------------------------------------------------*/
 struct readInfo * cnvtIdToBigNum(
     char *bufferCStr, /*buffer to hold fread input (can have data)*/
@@ -159,7 +163,25 @@ struct readInfo * cnvtIdToBigNum(
     char **endNameCStr, /*Points to start of id, will point to end*/
     uint64_t *lenInputULng,        /*Length of input from fread*/
     unsigned char *lenBigNumChar, /*Holds size to make bigNumber*/
-    FILE *idFILE          /*Fastq file to get data from*/
+    FILE *idFILE,         /*Fastq file to get data from*/
+    struct memArena *arenaST /*Arena for the nodes (0: malloc)*/
 ); /*Converts read id to bigNum read id, will grab new file input*/
 
+/*---------------------------------------------------------------------\
+| Output:
+|    Modifies:
+|      - uuidAryUL[0] and uuidAryUL[1] to hold the 32 hex digits of the
+|        UUID (case ignored) if idCStr is a UUID
+|    Returns:
+|      - 1 if idCStr is a UUID (8-4-4-4-12 hex digits followed by white
+|        space, a new line, or '\0')
+|      - 0 if idCStr is not a UUID (uuidAryUL is not changed)
+|    Note:
+|      - idCStr must have at least 37 readable bytes
+\---------------------------------------------------------------------*/
+uint8_t cnvtUuidToKey(
+    char *idCStr,       /*Read id to convert (no @)*/
+    uint64_t *uuidAryUL /*Gets the 128 bit UUID (2 elements)*/
+); /*Converts a UUID read id to a 128 bit key (8 hex digits at a time)*/
+
 #endif
@@ -390,6 +390,14 @@ void pStichHelp(
     outFILE,
     "     o Reference (as fasta) to align amplicons with\n"
    );
+   fprintf(
+    outFILE,
+    "     o Can also be a minimap2 index (minimap2 -d), so\n"
+   );
+   fprintf(
+    outFILE,
+    "       minimap2 does not index the reference each run\n"
+   );
 
    fprintf(outFILE, "   -amps: [Required]\n");
    fprintf(
@@ -6,6 +6,7 @@
 # Libraries:
 #  - "sitchAmpStruct.h"              (No .c file)
 #  - "samFunSrc/trimSam.h"
+#  - "stichSamMap.h"
 #  - "samFunSrc/cStrFun.h"           (No .c file)
 #  - "stichSetStruct.h"              (No .c file)
 #  o "stichDefaults.h"               (No .c file)
@@ -103,16 +104,16 @@ struct samEntry * getAmpPosMinimap(
    ^  - Variable declerations
    \<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<*/
 
-   char minimap2CmdStr[2048];
+   char magicStr[4];   /*Checks for a minimap2 index*/
    char threadsStr[8];
-   char *tmpStr = 0;
    uchar errUC = 0;
 
    struct samEntry *ampsST = 0;
    struct samEntry *ampIterST = 0;
    struct seqStruct seqST;
 
-   FILE *stdinFILE = 0; /*Minimap2 output*/
+   FILE *stdinFILE = 0; /*Fasta files*/
+   struct samMapper mapST; /*Minimap2 output*/
 
    /*>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>\
    ^ Fun-01 Sec-02:
@@ -177,6 +178,24 @@ struct samEntry * getAmpPosMinimap(
       return 0;
    } /*If: I could not open the reference file*/
 
+   /*A minimap2 index (minimap2 -d ref.mmi ref.fa) lets
+   ` minimap2 skip indexing the reference each run. It is
+   ` not a fasta file, so it can not be checked here.
+   */
+   if(
+         fread(magicStr, 1, 4, stdinFILE) == 4
+      && magicStr[0] == 'M'
+      && magicStr[1] == 'M'
+      && magicStr[2] == 'I'
+      && magicStr[3] == 2
+   ){ /*If: this is a minimap2 index*/
+      fclose(stdinFILE);
+      stdinFILE = 0;
+      freeSeqST(&seqST, 0); /*Struct is on stack*/
+      goto ampsMemAlloc;
+   } /*If: this is a minimap2 index*/
+
+   rewind(stdinFILE);
    errUC = readFaSeq(stdinFILE, &seqST);
 
    if(errUC > 1)
@@ -211,6 +230,8 @@ struct samEntry * getAmpPosMinimap(
    *  - Do memory allocations
    \******************************************************/
 
+   ampsMemAlloc:
+
    ampsST = malloc(sizeof(struct samEntry) * *numAmpsUL);
 
    if(ampsST == 0)
@@ -239,25 +260,21 @@ struct samEntry * getAmpPosMinimap(
    *  - Run minimap2 and check if have output
    \******************************************************/
 
+   uCharToCStr(threadsStr, settings->threadsUC);
 
-    tmpStr=cStrCpInvsDelm(minimap2CmdStr,stichMinimap2CMD);
-
-    uCharToCStr(threadsStr, settings->threadsUC);
-    tmpStr = cpParmAndArg(tmpStr, "-t", threadsStr);
-
-    tmpStr = cpParmAndArg(tmpStr, refFileStr, ampFileStr);
+   /*Run minimap2 (or libminimap2 with -DLIBMINIMAP2)*/
+   errUC =
+      openSamMapper(refFileStr, ampFileStr, threadsStr, &mapST);
 
-   /*Run minimap2*/
-   stdinFILE = popen(minimap2CmdStr, "r");
-   if(stdinFILE == 0) goto stichAlnAmpsErr;
+   if(!(errUC & 1)) goto stichAlnAmpsErr;
 
    initSamEntry(ampIterST);
-   errUC = readSamLine(ampIterST, stdinFILE);
+   errUC = readSamMapper(ampIterST, &mapST);
 
    /*Check if I have something to work with*/
    if(!(errUC & 1))
    { /*If: I had an error*/
-      pclose(stdinFILE);
+      closeSamMapper(&mapST);
 
       stichAlnAmpsErr:
 
@@ -282,11 +299,11 @@ struct samEntry * getAmpPosMinimap(
    while(*ampIterST->samEntryCStr == '@')
    { /*Loop: Get past the header*/
       initSamEntry(ampIterST);
-      errUC = readSamLine(ampIterST, stdinFILE);
+      errUC = readSamMapper(ampIterST, &mapST);
 
       if(!(errUC & 1))
       { /*If: I had an error or file has only headers*/
-         pclose(stdinFILE);
+         closeSamMapper(&mapST);
 
          while(ampIterST >= ampsST)
          { /*Loop: Free all internal variables*/
@@ -316,7 +333,7 @@ struct samEntry * getAmpPosMinimap(
       /*Check if have an alignment I can use*/
       if(ampIterST->flagUSht & (4 | 256 | 2048))
       { /*If: I had an invalid alingment*/
-         errUC = readSamLine(ampIterST, stdinFILE);
+         errUC = readSamMapper(ampIterST, &mapST);
          continue;
          /*4=unmapped, 256=secondary, 2048=supplemental*/
       } /*If: I had an invalid alingment*/
@@ -325,10 +342,10 @@ struct samEntry * getAmpPosMinimap(
       ++ampIterST;
       initSamEntry(ampIterST);
 
-      errUC = readSamLine(ampIterST, stdinFILE);
+      errUC = readSamMapper(ampIterST, &mapST);
    } /*Loop: Find the starting position for each amplicon*/
 
-   pclose(stdinFILE);
+   closeSamMapper(&mapST);
 
    /******************************************************\
    * Fun-01 Sec-03 Sub-04:
@@ -6,6 +6,7 @@
 # Libraries:
 #  - "sitchAmpStruct.h"              (No .c file)
 #  - "samFunSrc/trimSam.h"
+#  - "stichSamMap.h"
 #  - "samFunSrc/cStrFun.h"           (No .c file)
 #  - "stichSetStruct.h"              (No .c file)
 #  o "stichDefaults.h"               (No .c file)
@@ -19,7 +20,8 @@
 #  o <stdio.h>
 #  o <string.h>
 # Requires:
-#  - Minimap2 be in your file path
+#  - Minimap2 be in your file path (or build with
+#    -DLIBMINIMAP2, see stichSamMap.h)
 #########################################################*/
 
 #ifndef STICHMINIMAPFUN_H
@@ -33,6 +35,7 @@
 #include "stichAmpStruct.h"
 #include "bitTwidle.h"
 #include "stichSetStruct.h"
+#include "stichSamMap.h"
 
 /*~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~\
 ' stichMinimapFun SOH: Start Of Header